@@ -23,6 +23,7 @@ typedef struct _ReflectTypeEnumerant _ReflectTypeEnumerant;
 #define _REFLECT_KIND_VLA 13
 #define _REFLECT_KIND_STRUCT 14
 #define _REFLECT_KIND_UNION 15
+#define _REFLECT_KIND_INT128 16
 
 #define _REFLECT_TYPEFLAG_UNSIGNED 0x0001  // Integer types only
 #define _REFLECT_TYPEFLAG_ATOMIC 0x0002    // Integer types only
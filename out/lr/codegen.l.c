@@ -0,0 +1,5165 @@
+/*
+** This file has been pre-processed with DynASM.
+** https://luajit.org/dynasm.html
+** DynASM version 1.5.0, DynASM x64 version 1.5.0
+** DO NOT EDIT! The original file is in "../../src/codegen.in.c".
+*/
+
+#line 1 "../../src/codegen.in.c"
+#include "dyibicc.h"
+
+#define C(x) compiler_state.codegen__##x
+
+#define DASM_CHECKS 1
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#pragma warning(disable : 4244)
+#endif
+#include "dynasm/dasm_proto.h"
+#include "dynasm/dasm_x86.h"
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include "dyn_basic_pdb.h"
+
+//| .arch x64
+#if DASM_VERSION != 10500
+#error "Version mismatch between DynASM and included encoding engine"
+#endif
+#line 21 "../../src/codegen.in.c"
+//| .section code, cold, pdata
+#define DASM_SECTION_CODE	0
+#define DASM_SECTION_COLD	1
+#define DASM_SECTION_PDATA	2
+#define DASM_MAXSECTION		3
+#line 22 "../../src/codegen.in.c"
+//| .actionlist dynasm_actions
+static const unsigned char dynasm_actions[2254] = {
+  249,255,80,255,64,88,240,42,255,72,131,252,236,8,252,242,15,17,4,36,255,252,
+  242,64,15,16,4,240,140,36,72,131,196,8,255,72,184,240,34,237,237,255,72,139,
+  128,253,240,131,240,3,233,255,82,80,255,72,131,252,236,8,255,65,252,255,210,
+  255,252,243,15,16,0,255,252,242,15,16,0,255,219,40,255,72,139,80,8,72,139,
+  0,255,15,182,0,255,15,190,0,255,15,183,0,255,15,191,0,255,72,99,0,255,68,
+  138,128,233,68,136,135,233,255,252,243,15,17,7,255,252,242,15,17,7,255,219,
+  63,255,72,137,7,72,137,87,8,255,136,7,255,102,137,7,255,72,137,7,255,72,139,
+  133,233,255,72,141,133,233,255,72,141,5,245,255,72,129,192,239,255,15,87,
+  201,15,46,193,255,102,15,87,201,102,15,46,193,255,217,252,238,223,232,221,
+  216,255,72,9,208,255,131,252,248,0,255,72,131,252,248,0,255,15,190,192,255,
+  15,182,192,255,15,191,192,255,15,183,192,255,252,243,15,42,192,255,72,99,
+  192,255,252,242,15,42,192,255,137,68,36,252,252,219,68,36,252,252,255,137,
+  192,252,243,72,15,42,192,255,137,192,255,137,192,252,242,72,15,42,192,255,
+  137,192,72,137,68,36,252,248,223,108,36,252,248,255,72,133,192,15,136,244,
+  247,102,15,252,239,192,252,242,72,15,42,192,252,233,244,248,248,1,72,137,
+  199,131,224,1,102,15,252,239,192,72,209,252,239,72,9,199,252,242,72,15,42,
+  199,252,242,15,88,192,248,2,255,72,137,68,36,252,248,223,108,36,252,248,72,
+  133,192,15,137,244,247,184,0,0,128,95,137,68,36,252,252,216,68,36,252,252,
+  248,1,255,252,243,15,44,192,15,190,192,255,252,243,15,44,192,15,182,192,255,
+  252,243,15,44,192,15,191,192,255,252,243,15,44,192,15,183,192,255,252,243,
+  15,44,192,255,252,243,72,15,44,192,255,252,243,15,90,192,255,252,243,15,17,
+  68,36,252,252,217,68,36,252,252,255,252,242,15,44,192,15,190,192,255,252,
+  242,15,44,192,15,182,192,255,252,242,15,44,192,15,191,192,255,252,242,15,
+  44,192,15,183,192,255,252,242,15,44,192,255,252,242,72,15,44,192,255,252,
+  242,15,90,192,255,252,242,15,17,68,36,252,248,221,68,36,252,248,255,217,124,
+  36,252,246,15,183,68,36,252,246,128,204,12,102,137,68,36,252,244,217,108,
+  36,252,244,255,219,92,36,232,217,108,36,252,246,15,191,68,36,232,255,219,
+  92,36,232,217,108,36,252,246,15,183,68,36,232,37,252,255,0,0,0,255,219,92,
+  36,232,217,108,36,252,246,15,183,68,36,232,255,219,92,36,232,217,108,36,252,
+  246,139,68,36,232,255,223,124,36,232,217,108,36,252,246,72,139,68,36,232,
+  255,217,92,36,252,248,252,243,15,16,68,36,252,248,255,221,92,36,252,248,252,
+  242,15,16,68,36,252,248,255,49,210,255,72,153,255,72,137,199,72,137,214,255,
+  15,149,208,15,182,192,255,72,129,252,236,239,255,68,138,144,233,68,136,148,
+  253,36,233,255,72,131,252,236,16,219,60,36,255,64,15,40,192,240,140,255,72,
+  137,192,240,35,255,252,243,15,17,133,233,255,252,242,15,17,133,233,255,136,
+  133,233,72,193,232,8,255,252,243,64,15,17,133,253,240,140,233,255,252,242,
+  64,15,17,133,253,240,140,233,255,64,136,133,253,240,131,233,72,193,232,240,
+  35,8,255,72,137,199,255,252,243,15,16,7,255,252,242,15,16,7,255,72,199,192,
+  0,0,0,0,255,72,193,224,8,102,139,135,233,255,252,243,64,15,16,71,240,140,
+  8,255,252,242,64,15,16,71,240,140,8,255,72,199,192,240,35,0,0,0,0,255,72,
+  193,224,240,35,8,64,138,135,253,240,131,233,255,72,139,189,233,255,138,144,
+  233,136,151,233,255,72,131,199,15,131,231,252,240,255,72,139,141,233,72,41,
+  225,72,137,224,72,41,252,252,72,137,226,248,1,72,131,252,249,0,15,132,244,
+  248,68,138,0,68,136,2,72,252,255,194,72,252,255,192,72,252,255,201,252,233,
+  244,1,248,2,255,72,139,133,233,72,41,252,248,72,137,133,233,255,72,15,165,
+  194,72,211,224,252,246,193,64,15,132,244,247,72,137,194,49,192,248,1,255,
+  72,15,173,208,72,211,252,234,252,246,193,64,15,132,244,247,72,137,208,49,
+  210,248,1,255,72,15,173,208,72,211,252,250,252,246,193,64,15,132,244,247,
+  72,137,208,72,193,252,250,63,248,1,255,72,1,252,248,72,17,252,242,255,72,
+  41,252,248,72,25,252,242,255,73,137,192,73,137,209,76,15,175,207,73,15,175,
+  252,240,73,1,252,241,72,252,247,231,76,1,202,255,72,137,252,241,73,137,252,
+  248,72,137,199,72,137,214,76,137,194,255,72,33,252,248,72,33,252,242,255,
+  72,9,252,248,72,9,252,242,255,72,49,252,248,72,49,252,242,255,72,49,252,248,
+  72,49,252,242,72,9,208,255,15,148,208,255,15,149,208,255,72,15,182,192,255,
+  72,57,252,248,72,25,252,242,255,15,146,208,255,15,156,208,255,72,57,199,72,
+  25,214,255,15,147,208,255,15,157,208,255,250,31,255,250,15,255,85,72,137,
+  229,87,86,82,81,65,80,65,81,80,72,131,228,252,240,72,131,252,236,64,255,252,
+  242,64,15,17,132,253,240,140,36,233,255,76,137,223,72,184,237,237,252,255,
+  208,73,137,195,255,252,242,64,15,16,132,253,240,140,36,233,255,72,141,101,
+  200,88,65,89,65,88,89,90,94,95,93,255,73,187,237,237,73,131,3,1,73,129,59,
+  239,15,133,245,73,187,237,237,255,15,49,72,193,226,32,72,9,208,255,72,141,
+  61,245,72,139,117,8,72,184,237,237,252,255,208,255,73,187,237,237,73,131,
+  3,1,255,72,131,228,252,240,72,131,252,236,32,72,137,4,36,72,137,84,36,8,252,
+  242,15,17,68,36,16,252,242,15,17,76,36,24,255,72,43,133,233,73,187,237,237,
+  73,1,67,8,255,72,139,4,36,72,139,84,36,8,252,242,15,16,68,36,16,252,242,15,
+  16,76,36,24,255,254,1,252,233,245,255,254,0,184,237,102,72,15,110,192,255,
+  72,184,237,237,102,72,15,110,192,255,72,184,237,237,72,137,68,36,252,240,
+  72,184,237,237,72,137,68,36,252,248,219,108,36,252,240,255,72,184,237,237,
+  255,72,199,192,237,255,72,199,192,1,0,0,0,72,193,224,31,102,72,15,110,200,
+  15,87,193,255,72,199,192,1,0,0,0,72,193,224,63,102,72,15,110,200,102,15,87,
+  193,255,217,224,255,72,252,247,216,72,131,210,0,72,252,247,218,255,72,252,
+  247,216,255,72,193,224,235,255,72,193,232,235,255,72,193,252,248,235,255,
+  72,199,192,237,137,133,233,255,73,137,192,255,72,137,199,72,129,231,239,72,
+  193,231,235,255,72,139,4,36,255,73,199,193,237,76,33,200,72,9,252,248,255,
+  76,137,192,255,87,255,72,199,193,237,72,141,189,233,176,0,252,243,170,255,
+  95,255,15,133,245,255,15,132,245,255,252,233,245,249,255,15,148,208,72,15,
+  182,192,255,72,252,247,208,255,72,252,247,210,255,15,132,245,72,199,192,1,
+  0,0,0,252,233,245,249,72,199,192,0,0,0,0,249,255,15,133,245,72,199,192,0,
+  0,0,0,252,233,245,249,72,199,192,1,0,0,0,249,255,72,131,192,8,255,102,72,
+  15,126,192,240,132,240,36,255,72,129,252,236,239,73,137,194,65,252,255,210,
+  72,129,196,239,255,72,137,133,233,72,141,133,233,255,73,137,194,255,72,199,
+  192,237,65,252,255,210,72,129,196,239,255,252,240,15,176,23,255,102,252,240,
+  15,177,23,255,252,240,72,15,177,23,255,15,148,209,15,132,244,247,255,65,136,
+  0,255,102,65,137,0,255,73,137,0,255,248,1,15,182,193,255,134,7,255,102,135,
+  7,255,72,135,7,255,252,243,15,88,193,255,252,242,15,88,193,255,252,243,15,
+  92,193,255,252,242,15,92,193,255,252,243,15,89,193,255,252,242,15,89,193,
+  255,252,243,15,94,193,255,252,242,15,94,193,255,15,46,200,255,102,15,46,200,
+  255,15,148,208,15,155,210,32,208,255,15,149,208,15,154,210,8,208,255,15,151,
+  208,255,36,1,72,15,182,192,255,222,193,255,222,225,255,222,201,255,222,252,
+  241,255,223,252,241,221,216,255,72,1,252,248,255,72,41,252,248,255,72,15,
+  175,199,255,72,199,194,0,0,0,0,72,252,247,252,247,255,186,0,0,0,0,252,247,
+  252,247,255,72,252,247,252,255,255,72,137,208,255,72,33,252,248,255,72,49,
+  252,248,255,72,57,252,248,255,15,150,208,255,15,158,208,255,72,137,252,249,
+  255,72,211,224,255,72,211,232,255,72,211,252,248,255,15,133,245,249,255,72,
+  129,252,248,239,15,133,245,72,129,252,250,239,15,132,245,255,72,137,199,73,
+  137,211,72,129,252,239,239,73,129,219,239,15,133,245,72,129,252,255,239,15,
+  134,245,255,72,129,252,248,239,255,72,137,199,72,129,252,239,239,72,129,252,
+  255,239,255,137,199,129,252,239,239,129,252,255,239,255,252,255,224,255,64,
+  136,133,253,240,131,233,255,102,64,137,133,253,240,139,233,255,72,137,133,
+  253,240,131,233,255,249,254,0,249,85,72,137,229,255,65,252,255,210,72,41,
+  196,255,254,2,250,3,249,235,255,235,235,255,235,236,255,235,235,235,235,255,
+  72,137,165,233,255,199,133,233,237,199,133,233,237,72,137,173,233,72,131,
+  133,233,16,72,137,173,233,72,129,133,233,239,255,72,137,189,233,72,137,181,
+  233,72,137,149,233,72,137,141,233,76,137,133,233,76,137,141,233,252,242,15,
+  17,133,233,252,242,15,17,141,233,252,242,15,17,149,233,252,242,15,17,157,
+  233,252,242,15,17,165,233,252,242,15,17,173,233,252,242,15,17,181,233,252,
+  242,15,17,189,233,255,72,137,189,233,72,137,181,233,72,137,149,233,72,137,
+  141,233,255,72,141,101,0,255,72,137,252,236,255,249,195,255,65,252,255,227,
+  255,249,73,187,237,237,65,252,255,35,249,255,250,3,249,254,0
+};
+
+#line 23 "../../src/codegen.in.c"
+//| .globals dynasm_globals
+enum {
+  dynasm_globals_MAX
+};
+#line 24 "../../src/codegen.in.c"
+//| .if WIN
+//| .define X64WIN, 1
+//| .endif
+
+#define Dst &C(dynasm)
+
+#define REG_AX 0
+#define REG_DI 7
+#define REG_SI 6
+#define REG_DX 2
+#define REG_CX 1
+#define REG_R8 8
+#define REG_R9 9
+#define REG_R10 10
+
+// Used with Rq(), Rd(), Rw(), Rb()
+#if X64WIN
+static int dasmargreg[] = {REG_CX, REG_DX, REG_R8, REG_R9};
+#define REG_UTIL REG_CX
+#define X64WIN_REG_MAX 4
+#define PARAMETER_SAVE_SIZE (4 * 8)
+#else
+static int dasmargreg[] = {REG_DI, REG_SI, REG_DX, REG_CX, REG_R8, REG_R9};
+#define REG_UTIL REG_DI
+#define SYSV_GP_MAX 6
+#define SYSV_FP_MAX 8
+#endif
+//| .if X64WIN
+//| .define CARG1, rcx
+//| .define CARG1d, ecx
+//| .define CARG2, rdx
+//| .define CARG3, r8
+//| .define CARG4, r9
+//| .define RUTIL, rcx
+//| .define RUTILd, ecx
+//| .define RUTILenc, 0x11
+//| .else
+//| .define CARG1, rdi
+//| .define CARG1d, edi
+//| .define CARG2, rsi
+//| .define CARG3, rdx
+//| .define CARG4, rcx
+//| .define CARG5, r8
+//| .define CARG6, r9
+//| .define RUTIL, rdi
+//| .define RUTILd, edi
+//| .define RUTILenc, 0x17
+//| .endif
+
+static void gen_expr(Node* node);
+static void gen_stmt(Node* node);
+
+// Whether the line that each statement's code came from is recorded, for
+// debug symbols, and for jitdump.
+static bool wants_line_info(void) {
+  return user_context->generate_debug_symbols || user_context->jitdump_dir;
+}
+
+static void record_line_syminfo(int file_no, int line_no, int pclabel) {
+  // If file and line haven't changed, then we're working through parts of a
+  // single statement; just ignore.
+  int cur_len = C(current_fn)->file_line_label_data.len;
+  if (cur_len > 0 && C(current_fn)->file_line_label_data.data[cur_len - 1].a == file_no &&
+      C(current_fn)->file_line_label_data.data[cur_len - 1].b == line_no) {
+    return;
+  }
+
+  //|=>pclabel:
+  dasm_put(Dst, 0, pclabel);
+#line 92 "../../src/codegen.in.c"
+  intintintarray_push(&C(current_fn)->file_line_label_data, (IntIntInt){file_no, line_no, pclabel},
+                      AL_Compile);
+  // printf("%s:%d:label %d\n", compiler_state.tokenize__all_tokenized_files.data[file_no]->name,
+  // line_no, pclabel);
+}
+
+IMPLSTATIC int codegen_pclabel(void) {
+  int ret = C(numlabels);
+  dasm_growpc(&C(dynasm), ++C(numlabels));
+  return ret;
+}
+
+static void push(void) {
+  //| push rax
+  dasm_put(Dst, 2);
+#line 106 "../../src/codegen.in.c"
+  C(depth)++;
+}
+
+static void pop(int dasmreg) {
+  //| pop Rq(dasmreg)
+  dasm_put(Dst, 4, (dasmreg));
+#line 111 "../../src/codegen.in.c"
+  C(depth)--;
+}
+
+static void pushf(void) {
+  //| sub rsp, 8
+  //| movsd qword [rsp], xmm0
+  dasm_put(Dst, 9);
+#line 117 "../../src/codegen.in.c"
+  C(depth)++;
+}
+
+static void popf(int reg) {
+  //| movsd xmm(reg), qword [rsp]
+  //| add rsp, 8
+  dasm_put(Dst, 21, (reg));
+#line 123 "../../src/codegen.in.c"
+  C(depth)--;
+}
+
+// Loads the address of the function or global |name| into |reg| from its
+// slot, and records the reference so the linker knows to fill the slot.
+static void load_symbol_address(int reg, char* name) {
+  SymbolSlot* slot = get_symbol_slot(C(file_index), name);
+  strarray_push(&C(symbol_refs), name, AL_Compile);
+  //| mov64 Rq(reg), (uintptr_t)slot
+  dasm_put(Dst, 35, (reg), (unsigned int)((uintptr_t)slot), (unsigned int)(((uintptr_t)slot)>>32));
+#line 132 "../../src/codegen.in.c"
+  // Marks the end of the slot's address in the code, so it can be repointed
+  // when the code is loaded into another process.
+  int label = codegen_pclabel();
+  //|=>label:
+  dasm_put(Dst, 0, label);
+#line 136 "../../src/codegen.in.c"
+  intarray_push(&C(symbol_ref_labels), label, AL_Compile);
+  //| mov Rq(reg), [Rq(reg)]
+  dasm_put(Dst, 42, (reg), (reg), 0);
+#line 138 "../../src/codegen.in.c"
+}
+
+#if !X64WIN
+// 128-bit integers are held in rdx:rax, and pushed so that the low half is at
+// the top of the stack, matching their in-memory layout.
+static void push128(void) {
+  //| push rdx
+  //| push rax
+  dasm_put(Dst, 52);
+#line 146 "../../src/codegen.in.c"
+  C(depth) += 2;
+}
+
+// Calls a compiler runtime helper (see link.c) for operations that don't have
+// a reasonable inline expansion, e.g. 128-bit division.
+static void call_runtime_helper(char* name) {
+  bool realign = C(depth) % 2 == 1;
+  if (realign) {
+    //| sub rsp, 8
+    dasm_put(Dst, 55);
+#line 155 "../../src/codegen.in.c"
+  }
+  load_symbol_address(REG_R10, name);
+  //| call r10
+  dasm_put(Dst, 61);
+#line 158 "../../src/codegen.in.c"
+  if (realign) {
+    //| add rsp, 8
+    dasm_put(Dst, 30);
+#line 160 "../../src/codegen.in.c"
+  }
+}
+#endif
+
+// Load a value from where %rax is pointing to.
+static void load(Type* ty) {
+  switch (ty->kind) {
+    case TY_STRUCT:
+    case TY_UNION:
+    case TY_ARRAY:
+    case TY_FUNC:
+    case TY_VLA:
+      // If it is an array, do not attempt to load a value to the
+      // register because in general we can't load an entire array to a
+      // register. As a result, the result of an evaluation of an array
+      // becomes not the array itself but the address of the array.
+      // This is where "array is automatically converted to a pointer to
+      // the first element of the array in C" occurs.
+      return;
+    case TY_FLOAT:
+      //| movss xmm0, dword [rax]
+      dasm_put(Dst, 66);
+#line 181 "../../src/codegen.in.c"
+      return;
+    case TY_DOUBLE:
+      //| movsd xmm0, qword [rax]
+      dasm_put(Dst, 72);
+#line 184 "../../src/codegen.in.c"
+      return;
+#if !X64WIN
+    case TY_LDOUBLE:
+      //| fld tword [rax]
+      dasm_put(Dst, 78);
+#line 188 "../../src/codegen.in.c"
+      return;
+    case TY_INT128:
+      //| mov rdx, [rax+8]
+      //| mov rax, [rax]
+      dasm_put(Dst, 81);
+#line 192 "../../src/codegen.in.c"
+      return;
+#endif
+  }
+
+  // When we load a char or a short value to a register, we always
+  // extend them to the size of int, so we can assume the lower half of
+  // a register always contains a valid value. The upper half of a
+  // register for char, short and int may contain garbage. When we load
+  // a long value to a register, it simply occupies the entire register.
+  if (ty->size == 1) {
+    if (ty->is_unsigned) {
+      //| movzx eax, byte [rax]
+      dasm_put(Dst, 89);
+#line 204 "../../src/codegen.in.c"
+    } else {
+      //| movsx eax, byte [rax]
+      dasm_put(Dst, 93);
+#line 206 "../../src/codegen.in.c"
+    }
+  } else if (ty->size == 2) {
+    if (ty->is_unsigned) {
+      //| movzx eax, word [rax]
+      dasm_put(Dst, 97);
+#line 210 "../../src/codegen.in.c"
+    } else {
+      //| movsx eax, word [rax]
+      dasm_put(Dst, 101);
+#line 212 "../../src/codegen.in.c"
+    }
+  } else if (ty->size == 4) {
+    //| movsxd rax, dword [rax]
+    dasm_put(Dst, 105);
+#line 215 "../../src/codegen.in.c"
+  } else {
+    //| mov rax, qword [rax]
+    dasm_put(Dst, 85);
+#line 217 "../../src/codegen.in.c"
+  }
+}
+
+// Store %rax to an address that the stack top is pointing to.
+static void store(Type* ty) {
+  pop(REG_UTIL);
+
+  switch (ty->kind) {
+    case TY_STRUCT:
+    case TY_UNION:
+      for (int i = 0; i < ty->size; i++) {
+        //| mov r8b, [rax+i]
+        //| mov [RUTIL+i], r8b
+        dasm_put(Dst, 109, i, i);
+#line 230 "../../src/codegen.in.c"
+      }
+      return;
+    case TY_FLOAT:
+      //| movss dword [RUTIL], xmm0
+      dasm_put(Dst, 118);
+#line 234 "../../src/codegen.in.c"
+      return;
+    case TY_DOUBLE:
+      //| movsd qword [RUTIL], xmm0
+      dasm_put(Dst, 124);
+#line 237 "../../src/codegen.in.c"
+      return;
+#if !X64WIN
+    case TY_LDOUBLE:
+      //| fstp tword [RUTIL]
+      dasm_put(Dst, 130);
+#line 241 "../../src/codegen.in.c"
+      return;
+    case TY_INT128:
+      //| mov [RUTIL], rax
+      //| mov [RUTIL+8], rdx
+      dasm_put(Dst, 133);
+#line 245 "../../src/codegen.in.c"
+      return;
+#endif
+  }
+
+  if (ty->size == 1) {
+    //| mov [RUTIL], al
+    dasm_put(Dst, 141);
+#line 251 "../../src/codegen.in.c"
+  } else if (ty->size == 2) {
+    //| mov [RUTIL], ax
+    dasm_put(Dst, 144);
+#line 253 "../../src/codegen.in.c"
+  } else if (ty->size == 4) {
+    //| mov [RUTIL], eax
+    dasm_put(Dst, 145);
+#line 255 "../../src/codegen.in.c"
+  } else {
+    //| mov [RUTIL], rax
+    dasm_put(Dst, 148);
+#line 257 "../../src/codegen.in.c"
+  }
+}
+
+// Compute the absolute address of a given node.
+// It's an error if a given node does not reside in memory.
+static void gen_addr(Node* node) {
+  switch (node->kind) {
+    case ND_VAR:
+      // Variable-length array, which is always local.
+      if (node->var->ty->kind == TY_VLA) {
+        //| mov rax, [rbp+node->var->offset]
+        dasm_put(Dst, 152, node->var->offset);
+#line 268 "../../src/codegen.in.c"
+        return;
+      }
+
+      // Local variable
+      if (node->var->is_local) {
+        //| lea rax, [rbp+node->var->offset]
+        dasm_put(Dst, 157, node->var->offset);
+#line 274 "../../src/codegen.in.c"
+#if X64WIN
+        if (node->var->is_param_passed_by_reference) {
+          //| mov rax, [rax]
+          dasm_put(Dst, 85);
+#line 277 "../../src/codegen.in.c"
+        }
+#endif
+        return;
+      }
+
+      // Thread-local variable
+      if (node->var->is_tls) {
+        // println("  mov rax, fs:0");
+        // println("  add rax, [rel %s wrt ..gottpoff]", node->var->name);
+        error_tok(node->tok, "TLS not implemented");
+        return;
+      }
+
+      // Function
+      if (node->ty->kind == TY_FUNC) {
+#if X64WIN
+        if (node->var->is_definition) {
+          //| lea rax, [=>node->var->dasm_entry_label]
+          dasm_put(Dst, 162, node->var->dasm_entry_label);
+#line 295 "../../src/codegen.in.c"
+        } else {
+#else
+        // Functions in the same file also go through slots, so that the
+        // code for a function can be reused by a later update even if the
+        // functions it refers to were recompiled elsewhere (see codegen()).
+        {
+#endif
+          load_symbol_address(REG_AX, node->var->name);
+        }
+        return;
+      }
+
+      // Global variable
+      load_symbol_address(REG_AX, node->var->name);
+      return;
+    case ND_DEREF:
+      gen_expr(node->lhs);
+      return;
+    case ND_COMMA:
+      gen_expr(node->lhs);
+      gen_addr(node->rhs);
+      return;
+    case ND_MEMBER:
+      gen_addr(node->lhs);
+      //| add rax, node->member->offset
+      dasm_put(Dst, 167, node->member->offset);
+#line 320 "../../src/codegen.in.c"
+      return;
+    case ND_FUNCALL:
+      if (node->ret_buffer) {
+        gen_expr(node);
+        return;
+      }
+      break;
+    case ND_ASSIGN:
+    case ND_COND:
+      if (node->ty->kind == TY_STRUCT || node->ty->kind == TY_UNION) {
+        gen_expr(node);
+        return;
+      }
+      break;
+    case ND_VLA_PTR:
+      //| lea rax, [rbp+node->var->offset]
+      dasm_put(Dst, 157, node->var->offset);
+#line 336 "../../src/codegen.in.c"
+      return;
+  }
+
+  error_tok(node->tok, "not an lvalue");
+}
+
+static void cmp_zero(Type* ty) {
+  switch (ty->kind) {
+    case TY_FLOAT:
+      //| xorps xmm1, xmm1
+      //| ucomiss xmm0, xmm1
+      dasm_put(Dst, 172);
+#line 347 "../../src/codegen.in.c"
+      return;
+    case TY_DOUBLE:
+      //| xorpd xmm1, xmm1
+      //| ucomisd xmm0, xmm1
+      dasm_put(Dst, 179);
+#line 351 "../../src/codegen.in.c"
+      return;
+#if !X64WIN
+    case TY_LDOUBLE:
+      //| fldz
+      //| fucomip st0
+      //| fstp st0
+      dasm_put(Dst, 188);
+#line 357 "../../src/codegen.in.c"
+      return;
+    case TY_INT128:
+      //| or rax, rdx
+      dasm_put(Dst, 196);
+#line 360 "../../src/codegen.in.c"
+      return;
+#endif
+  }
+
+  if (is_integer(ty) && ty->size <= 4) {
+    //| cmp eax, 0
+    dasm_put(Dst, 200);
+#line 366 "../../src/codegen.in.c"
+  } else {
+    //| cmp rax, 0
+    dasm_put(Dst, 205);
+#line 368 "../../src/codegen.in.c"
+  }
+}
+
+enum { I8, I16, I32, I64, U8, U16, U32, U64, F32, F64, F80 };
+
+static int get_type_id(Type* ty) {
+  switch (ty->kind) {
+    case TY_CHAR:
+      return ty->is_unsigned ? U8 : I8;
+    case TY_SHORT:
+      return ty->is_unsigned ? U16 : I16;
+    case TY_INT:
+      return ty->is_unsigned ? U32 : I32;
+    case TY_LONG:
+      return ty->is_unsigned ? U64 : I64;
+    case TY_FLOAT:
+      return F32;
+    case TY_DOUBLE:
+      return F64;
+#if !X64WIN
+    case TY_LDOUBLE:
+      return F80;
+#endif
+  }
+  return U64;
+}
+
+static void i32i8(void) {
+  //| movsx eax, al
+  dasm_put(Dst, 211);
+#line 397 "../../src/codegen.in.c"
+}
+static void i32u8(void) {
+  //| movzx eax, al
+  dasm_put(Dst, 215);
+#line 400 "../../src/codegen.in.c"
+}
+static void i32i16(void) {
+  //| movsx eax, ax
+  dasm_put(Dst, 219);
+#line 403 "../../src/codegen.in.c"
+}
+static void i32u16(void) {
+  //| movzx eax, ax
+  dasm_put(Dst, 223);
+#line 406 "../../src/codegen.in.c"
+}
+static void i32f32(void) {
+  //| cvtsi2ss xmm0, eax
+  dasm_put(Dst, 227);
+#line 409 "../../src/codegen.in.c"
+}
+static void i32i64(void) {
+  //| movsxd rax, eax
+  dasm_put(Dst, 233);
+#line 412 "../../src/codegen.in.c"
+}
+static void i32f64(void) {
+  //| cvtsi2sd xmm0, eax
+  dasm_put(Dst, 237);
+#line 415 "../../src/codegen.in.c"
+}
+static void i32f80(void) {
+  //| mov [rsp-4], eax
+  //| fild dword [rsp-4]
+  dasm_put(Dst, 243);
+#line 419 "../../src/codegen.in.c"
+}
+
+static void u32f32(void) {
+  //| mov eax, eax
+  //| cvtsi2ss xmm0, rax
+  dasm_put(Dst, 254);
+#line 424 "../../src/codegen.in.c"
+}
+static void u32i64(void) {
+  //| mov eax, eax
+  dasm_put(Dst, 263);
+#line 427 "../../src/codegen.in.c"
+}
+static void u32f64(void) {
+  //| mov eax, eax
+  //| cvtsi2sd xmm0, rax
+  dasm_put(Dst, 266);
+#line 431 "../../src/codegen.in.c"
+}
+static void u32f80(void) {
+  //| mov eax, eax
+  //| mov [rsp-8], rax
+  //| fild qword [rsp-8]
+  dasm_put(Dst, 275);
+#line 436 "../../src/codegen.in.c"
+}
+
+static void i64f32(void) {
+  //| cvtsi2ss xmm0, rax
+  dasm_put(Dst, 256);
+#line 440 "../../src/codegen.in.c"
+}
+static void i64f64(void) {
+  //| cvtsi2sd xmm0, rax
+  dasm_put(Dst, 268);
+#line 443 "../../src/codegen.in.c"
+}
+static void i64f80(void) {
+  //| mov [rsp-8], rax
+  //| fild qword [rsp-8]
+  dasm_put(Dst, 277);
+#line 447 "../../src/codegen.in.c"
+}
+
+static void u64f32(void) {
+  //| cvtsi2ss xmm0, rax
+  dasm_put(Dst, 256);
+#line 451 "../../src/codegen.in.c"
+}
+static void u64f64(void) {
+  //| test rax,rax
+  //| js >1
+  //| pxor xmm0,xmm0
+  //| cvtsi2sd xmm0,rax
+  //| jmp >2
+  //|1:
+  //| mov RUTIL,rax
+  //| and eax,1
+  //| pxor xmm0,xmm0
+  //| shr RUTIL, 1
+  //| or RUTIL,rax
+  //| cvtsi2sd xmm0,RUTIL
+  //| addsd xmm0,xmm0
+  //|2:
+  dasm_put(Dst, 289);
+#line 467 "../../src/codegen.in.c"
+}
+static void u64f80(void) {
+  //| mov [rsp-8], rax
+  //| fild qword [rsp-8]
+  //| test rax, rax
+  //| jns >1
+  //| mov eax, 1602224128
+  //| mov [rsp-4], eax
+  //| fadd dword [rsp-4]
+  //|1:
+  dasm_put(Dst, 345);
+#line 477 "../../src/codegen.in.c"
+}
+
+static void f32i8(void) {
+  //| cvttss2si eax, xmm0
+  //| movsx eax, al
+  dasm_put(Dst, 381);
+#line 482 "../../src/codegen.in.c"
+}
+static void f32u8(void) {
+  //| cvttss2si eax, xmm0
+  //| movzx eax, al
+  dasm_put(Dst, 390);
+#line 486 "../../src/codegen.in.c"
+}
+static void f32i16(void) {
+  //| cvttss2si eax, xmm0
+  //| movsx eax, ax
+  dasm_put(Dst, 399);
+#line 490 "../../src/codegen.in.c"
+}
+static void f32u16(void) {
+  //| cvttss2si eax, xmm0
+  //| movzx eax, ax
+  dasm_put(Dst, 408);
+#line 494 "../../src/codegen.in.c"
+}
+static void f32i32(void) {
+  //| cvttss2si eax, xmm0
+  dasm_put(Dst, 417);
+#line 497 "../../src/codegen.in.c"
+}
+static void f32u32(void) {
+  //| cvttss2si rax, xmm0
+  dasm_put(Dst, 423);
+#line 500 "../../src/codegen.in.c"
+}
+static void f32i64(void) {
+  //| cvttss2si rax, xmm0
+  dasm_put(Dst, 423);
+#line 503 "../../src/codegen.in.c"
+}
+static void f32u64(void) {
+  //| cvttss2si rax, xmm0
+  dasm_put(Dst, 423);
+#line 506 "../../src/codegen.in.c"
+}
+static void f32f64(void) {
+  //| cvtss2sd xmm0, xmm0
+  dasm_put(Dst, 430);
+#line 509 "../../src/codegen.in.c"
+}
+static void f32f80(void) {
+  //| movss dword [rsp-4], xmm0
+  //| fld dword [rsp-4]
+  dasm_put(Dst, 436);
+#line 513 "../../src/codegen.in.c"
+}
+
+static void f64i8(void) {
+  //| cvttsd2si eax, xmm0
+  //| movsx eax, al
+  dasm_put(Dst, 450);
+#line 518 "../../src/codegen.in.c"
+}
+static void f64u8(void) {
+  //| cvttsd2si eax, xmm0
+  //| movzx eax, al
+  dasm_put(Dst, 459);
+#line 522 "../../src/codegen.in.c"
+}
+static void f64i16(void) {
+  //| cvttsd2si eax, xmm0
+  //| movsx eax, ax
+  dasm_put(Dst, 468);
+#line 526 "../../src/codegen.in.c"
+}
+static void f64u16(void) {
+  //| cvttsd2si eax, xmm0
+  //| movzx eax, ax
+  dasm_put(Dst, 477);
+#line 530 "../../src/codegen.in.c"
+}
+static void f64i32(void) {
+  //| cvttsd2si eax, xmm0
+  dasm_put(Dst, 486);
+#line 533 "../../src/codegen.in.c"
+}
+static void f64u32(void) {
+  //| cvttsd2si rax, xmm0
+  dasm_put(Dst, 492);
+#line 536 "../../src/codegen.in.c"
+}
+static void f64i64(void) {
+  //| cvttsd2si rax, xmm0
+  dasm_put(Dst, 492);
+#line 539 "../../src/codegen.in.c"
+}
+static void f64u64(void) {
+  //| cvttsd2si rax, xmm0
+  dasm_put(Dst, 492);
+#line 542 "../../src/codegen.in.c"
+}
+static void f64f32(void) {
+  //| cvtsd2ss xmm0, xmm0
+  dasm_put(Dst, 499);
+#line 545 "../../src/codegen.in.c"
+}
+static void f64f80(void) {
+  //| movsd qword [rsp-8], xmm0
+  //| fld qword [rsp-8]
+  dasm_put(Dst, 505);
+#line 549 "../../src/codegen.in.c"
+}
+
+static void from_f80_1(void) {
+  //| fnstcw word [rsp-10]
+  //| movzx eax, word [rsp-10]
+  //| or ah, 12
+  //| mov [rsp-12], ax
+  //| fldcw word [rsp-12]
+  dasm_put(Dst, 519);
+#line 557 "../../src/codegen.in.c"
+}
+
+#define FROM_F80_2 " [rsp-24]\n fldcw [rsp-10]\n "
+
+static void f80i8(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| movsx eax, word [rsp-24]
+  dasm_put(Dst, 545);
+#line 566 "../../src/codegen.in.c"
+}
+static void f80u8(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| movzx eax, word [rsp-24]
+  //| and eax, 0xff
+  dasm_put(Dst, 560);
+#line 573 "../../src/codegen.in.c"
+}
+static void f80i16(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| movsx eax, word [rsp-24]
+  dasm_put(Dst, 545);
+#line 579 "../../src/codegen.in.c"
+}
+static void f80u16(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| movzx eax, word [rsp-24]
+  dasm_put(Dst, 581);
+#line 585 "../../src/codegen.in.c"
+}
+static void f80i32(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| mov eax, [rsp-24]
+  dasm_put(Dst, 596);
+#line 591 "../../src/codegen.in.c"
+}
+static void f80u32(void) {
+  from_f80_1();
+  //| fistp dword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| mov eax, [rsp-24]
+  dasm_put(Dst, 596);
+#line 597 "../../src/codegen.in.c"
+}
+static void f80i64(void) {
+  from_f80_1();
+  //| fistp qword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| mov rax, [rsp-24]
+  dasm_put(Dst, 610);
+#line 603 "../../src/codegen.in.c"
+}
+static void f80u64(void) {
+  from_f80_1();
+  //| fistp qword [rsp-24]
+  //| fldcw word [rsp-10]
+  //| mov rax, [rsp-24]
+  dasm_put(Dst, 610);
+#line 609 "../../src/codegen.in.c"
+}
+static void f80f32(void) {
+  //| fstp dword [rsp-8]
+  //| movss xmm0, dword [rsp-8]
+  dasm_put(Dst, 625);
+#line 613 "../../src/codegen.in.c"
+}
+static void f80f64(void) {
+  //| fstp qword [rsp-8]
+  //| movsd xmm0, qword [rsp-8]
+  dasm_put(Dst, 639);
+#line 617 "../../src/codegen.in.c"
+}
+
+typedef void (*DynasmCastFunc)(void);
+
+// clang-format off
+
+// The table for type casts
+static DynasmCastFunc dynasm_cast_table[][11] = {
+  // "to" is the rows, "from" the columns
+  // i8   i16     i32     i64     u8     u16     u32     u64     f32     f64     f80
+  {NULL,  NULL,   NULL,   i32i64, i32u8, i32u16, NULL,   i32i64, i32f32, i32f64, i32f80}, // i8
+  {i32i8, NULL,   NULL,   i32i64, i32u8, i32u16, NULL,   i32i64, i32f32, i32f64, i32f80}, // i16
+  {i32i8, i32i16, NULL,   i32i64, i32u8, i32u16, NULL,   i32i64, i32f32, i32f64, i32f80}, // i32
+  {i32i8, i32i16, NULL,   NULL,   i32u8, i32u16, NULL,   NULL,   i64f32, i64f64, i64f80}, // i64
+
+  {i32i8, NULL,   NULL,   i32i64, NULL,  NULL,   NULL,   i32i64, i32f32, i32f64, i32f80}, // u8
+  {i32i8, i32i16, NULL,   i32i64, i32u8, NULL,   NULL,   i32i64, i32f32, i32f64, i32f80}, // u16
+  {i32i8, i32i16, NULL,   u32i64, i32u8, i32u16, NULL,   u32i64, u32f32, u32f64, u32f80}, // u32
+  {i32i8, i32i16, NULL,   NULL,   i32u8, i32u16, NULL,   NULL,   u64f32, u64f64, u64f80}, // u64
+
+  {f32i8, f32i16, f32i32, f32i64, f32u8, f32u16, f32u32, f32u64, NULL,   f32f64, f32f80}, // f32
+  {f64i8, f64i16, f64i32, f64i64, f64u8, f64u16, f64u32, f64u64, f64f32, NULL,   f64f80}, // f64
+  {f80i8, f80i16, f80i32, f80i64, f80u8, f80u16, f80u32, f80u64, f80f32, f80f64, NULL},   // f80
+};
+
+// clang-format on
+
+#if !X64WIN
+// Casts to and from __int128 go via the 64 bit types in the table above, and
+// then either extend into or discard rdx. Floating point conversions are done
+// through double by runtime helpers.
+static void cast_int128(Type* from, Type* to) {
+  if (from->kind == TY_INT128 && to->kind == TY_INT128)
+    return;
+
+  if (to->kind == TY_INT128) {
+    if (is_flonum(from)) {
+      if (from->kind == TY_FLOAT)
+        f32f64();
+      else if (from->kind == TY_LDOUBLE)
+        f80f64();
+      call_runtime_helper(to->is_unsigned ? "__dyibicc_fixunsdfti" : "__dyibicc_fixdfti");
+      return;
+    }
+
+    int t1 = get_type_id(from);
+    int t2 = from->is_unsigned ? U64 : I64;
+    if (dynasm_cast_table[t1][t2]) {
+      dynasm_cast_table[t1][t2]();
+    }
+    if (from->is_unsigned) {
+      //| xor edx, edx
+      dasm_put(Dst, 653);
+#line 669 "../../src/codegen.in.c"
+    } else {
+      //| cqo
+      dasm_put(Dst, 656);
+#line 671 "../../src/codegen.in.c"
+    }
+    return;
+  }
+
+  if (is_flonum(to)) {
+    //| mov rdi, rax
+    //| mov rsi, rdx
+    dasm_put(Dst, 659);
+#line 678 "../../src/codegen.in.c"
+    call_runtime_helper(from->is_unsigned ? "__dyibicc_floatuntidf" : "__dyibicc_floattidf");
+    if (to->kind == TY_FLOAT)
+      f64f32();
+    else if (to->kind == TY_LDOUBLE)
+      f64f80();
+    return;
+  }
+
+  int t1 = from->is_unsigned ? U64 : I64;
+  int t2 = get_type_id(to);
+  if (dynasm_cast_table[t1][t2]) {
+    dynasm_cast_table[t1][t2]();
+  }
+}
+#endif
+
+// This can't be "cast()" when amalgamated because parse has a cast() as well.
+static void cg_cast(Type* from, Type* to) {
+  if (to->kind == TY_VOID)
+    return;
+
+  if (to->kind == TY_BOOL) {
+    cmp_zero(from);
+    //| setne al
+    //| movzx eax, al
+    dasm_put(Dst, 666);
+#line 703 "../../src/codegen.in.c"
+    return;
+  }
+
+#if !X64WIN
+  if (from->kind == TY_INT128 || to->kind == TY_INT128) {
+    cast_int128(from, to);
+    return;
+  }
+#endif
+
+  int t1 = get_type_id(from);
+  int t2 = get_type_id(to);
+  if (dynasm_cast_table[t1][t2]) {
+    dynasm_cast_table[t1][t2]();
+  }
+}
+
+#if !X64WIN
+
+// Structs or unions equal or smaller than 16 bytes are passed
+// using up to two registers.
+//
+// If the first 8 bytes contains only floating-point type members,
+// they are passed in an XMM register. Otherwise, they are passed
+// in a general-purpose register.
+//
+// If a struct/union is larger than 8 bytes, the same rule is
+// applied to the the next 8 byte chunk.
+//
+// This function returns true if `ty` has only floating-point
+// members in its byte range [lo, hi).
+static bool has_flonum(Type* ty, int lo, int hi, int offset) {
+  if (ty->kind == TY_STRUCT || ty->kind == TY_UNION) {
+    for (Member* mem = ty->members; mem; mem = mem->next)
+      if (!has_flonum(mem->ty, lo, hi, offset + mem->offset))
+        return false;
+    return true;
+  }
+
+  if (ty->kind == TY_ARRAY) {
+    for (int i = 0; i < ty->array_len; i++)
+      if (!has_flonum(ty->base, lo, hi, offset + ty->base->size * i))
+        return false;
+    return true;
+  }
+
+  return offset < lo || hi <= offset || ty->kind == TY_FLOAT || ty->kind == TY_DOUBLE;
+}
+
+static bool has_flonum1(Type* ty) {
+  return has_flonum(ty, 0, 8, 0);
+}
+
+static bool has_flonum2(Type* ty) {
+  return has_flonum(ty, 8, 16, 0);
+}
+
+#endif
+
+static int push_struct(Type* ty) {
+  int sz = (int)align_to_s(ty->size, 8);
+  //| sub rsp, sz
+  dasm_put(Dst, 673, sz);
+#line 765 "../../src/codegen.in.c"
+  C(depth) += sz / 8;
+
+  for (int i = 0; i < ty->size; i++) {
+    //| mov r10b, [rax+i]
+    //| mov [rsp+i], r10b
+    dasm_put(Dst, 679, i, i);
+#line 770 "../../src/codegen.in.c"
+  }
+
+  return sz;
+}
+
+#if X64WIN
+
+bool type_passed_in_register(Type* ty) {
+  // https://learn.microsoft.com/en-us/cpp/build/x64-calling-convention:
+  //   "__m128 types, arrays, and strings are never passed by immediate value.
+  //   Instead, a pointer is passed to memory allocated by the caller. Structs
+  //   and unions of size 8, 16, 32, or 64 bits, and __m64 types, are passed as
+  //   if they were integers of the same size."
+  //
+  // Note that e.g. a pragma pack 5 byte structure will be passed by reference,
+  // so this is not just size <= 8 as it is for 16 on SysV.
+  //
+  // Arrays and strings as mentioned won't be TY_STRUCT/TY_UNION so they should
+  // not use this function.
+  return ty->size == 1 || ty->size == 2 || ty->size == 4 || ty->size == 8;
+}
+
+static void push_args2_win(Node* args, bool first_pass) {
+  if (!args)
+    return;
+  push_args2_win(args->next, first_pass);
+
+  // Push all the by-stack first, then on the second pass, push all the things
+  // that will be popped back into registers by the actual call.
+  if ((first_pass && !args->pass_by_stack) || (!first_pass && args->pass_by_stack))
+    return;
+
+  if ((args->ty->kind != TY_STRUCT && args->ty->kind != TY_UNION) ||
+      type_passed_in_register(args->ty)) {
+    gen_expr(args);
+  }
+
+  switch (args->ty->kind) {
+    case TY_STRUCT:
+    case TY_UNION:
+      if (!type_passed_in_register(args->ty)) {
+        assert(args->pass_by_reference);
+        //| lea rax, [rbp - C(current_fn)->stack_size - args->pass_by_reference]
+        dasm_put(Dst, 157, - C(current_fn)->stack_size - args->pass_by_reference);
+#line 813 "../../src/codegen.in.c"
+      } else {
+        //| mov rax, [rax]
+        dasm_put(Dst, 85);
+#line 815 "../../src/codegen.in.c"
+      }
+      push();
+      break;
+    case TY_FLOAT:
+    case TY_DOUBLE:
+      pushf();
+      break;
+    default:
+      push();
+      break;
+  }
+}
+
+// --- Windows ---
+// Load function call arguments. Arguments are already evaluated and
+// stored to the stack as local variables. What we need to do in this
+// function is to load them to registers or push them to the stack as
+// required by the Windows ABI.
+//
+// - Integer arguments in the leftmost four positions are passed in RCX, RDX,
+//   R8, and R9.
+//
+// - Floating point arguments in the leftmost four position are passed in
+//   XMM0-XM3.
+//
+// - The 5th and subsequent arguments are push on the stack in right-to-left
+//   order.
+//
+// - Arguments larger than 8 bytes are always passed by reference.
+//
+// - When mixing integer and floating point arguments, the opposite type's
+//   register is left unused, e.g.
+//
+//     void func(int a, double b, int c, float d, int e, float f);
+//
+//   would have a in RCX, b in XMM1, c in R8, d in XMM3, f then e pushed on stack.
+//
+// - Varargs follow the same conventions, but floating point values must also
+//   have their value stored in the corresponding integer register for the first
+//   four arguments.
+//
+// - For larger than 8 byte structs, they're passed by reference. So we first
+//   need to make a local copy on the stack (since they're still passed by value
+//   not reference as far as the language is concerned), but then pass a pointer
+//   to the copy rather than to the actual data. This difference definitely
+//   casues the most changes vs. SysV in the rest of the compiler.
+//
+// - Integer return values of 8 bytes or less are in RAX (including user-defined
+//   types like small structures). Floating point are returned in XMM0. For
+//   user-defined types that are larger than 8 bytes, the caller allocates a
+//   buffer and passes the address of the buffer in RCX, taking up the first
+//   integer register slot. The function returns the same address passed in RCX
+//   in RAX.
+//
+// - RAX, RCX, RDX, R8, R9, R10, R11, and XMM0-XMM5 are volatile.
+// - RBX, RBP, RDI, RSI, RSP, R12, R13, R14, R15, and XMM6-XMM15 are
+//   non-volatile.
+//
+// --- Windows ---
+static int push_args_win(Node* node, int* by_ref_copies_size) {
+  int stack = 0, reg = 0;
+
+  bool has_by_ref_args = false;
+  for (Node* arg = node->args; arg; arg = arg->next) {
+    if ((arg->ty->kind == TY_STRUCT || arg->ty->kind == TY_UNION) &&
+        !type_passed_in_register(arg->ty)) {
+      has_by_ref_args = true;
+      break;
+    }
+  }
+
+  // If the return type is a large struct/union, the caller passes
+  // a pointer to a buffer as if it were the first argument.
+  if (node->ret_buffer && !type_passed_in_register(node->ty))
+    reg++;
+
+  *by_ref_copies_size = 0;
+
+  // Load as many arguments to the registers as possible.
+  for (Node* arg = node->args; arg; arg = arg->next) {
+    Type* ty = arg->ty;
+
+    switch (ty->kind) {
+      case TY_STRUCT:
+      case TY_UNION:
+        // It's either small and so passed in a register, or isn't and then
+        // we're instead storing the pointer to the larger struct.
+        if (reg++ >= X64WIN_REG_MAX) {
+          arg->pass_by_stack = true;
+          ++stack;
+        }
+        if (!type_passed_in_register(ty)) {
+          // Make a copy, and note the offset for passing by reference.
+          gen_expr(arg);
+          *by_ref_copies_size += push_struct(ty);
+          arg->pass_by_reference = C(depth) * 8;
+        }
+        break;
+      case TY_FLOAT:
+      case TY_DOUBLE:
+        if (reg++ >= X64WIN_REG_MAX) {
+          arg->pass_by_stack = true;
+          stack++;
+        }
+        break;
+      default:
+        if (reg++ >= X64WIN_REG_MAX) {
+          arg->pass_by_stack = true;
+          stack++;
+        }
+    }
+  }
+
+  assert((*by_ref_copies_size == 0 && !has_by_ref_args) ||
+         (*by_ref_copies_size && has_by_ref_args));
+
+  // Realign the stack to 16 bytes if rsp fiddling mucked it up.
+  if ((C(depth) + stack) % 2 == 1) {
+    //| sub rsp, 8
+    dasm_put(Dst, 55);
+#line 934 "../../src/codegen.in.c"
+    C(depth)++;
+    stack++;
+  }
+
+  push_args2_win(node->args, true);
+  push_args2_win(node->args, false);
+
+  // If the return type is a large struct/union, the caller passes
+  // a pointer to a buffer as if it were the first argument.
+  if (node->ret_buffer && !type_passed_in_register(node->ty)) {
+    //| lea rax, [rbp+node->ret_buffer->offset]
+    dasm_put(Dst, 157, node->ret_buffer->offset);
+#line 945 "../../src/codegen.in.c"
+    push();
+  }
+
+  return stack;
+}
+
+#else
+
+// Whether an argument can be evaluated directly into its argument register.
+// This is only the case for expressions whose code uses nothing but rax and
+// xmm0 (variables, constants, member loads, etc.), so that evaluating one can't
+// clobber another argument register that's already been loaded.
+static bool is_simple_arg(Node* node) {
+  switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return true;
+    case ND_MEMBER:
+    case ND_DEREF:
+    case ND_ADDR:
+      return is_simple_arg(node->lhs);
+    case ND_CAST: {
+      Type* from = node->lhs->ty;
+      Type* to = node->ty;
+      return (is_integer(from) || from->kind == TY_PTR) && from->size <= 8 &&
+             (is_integer(to) || to->kind == TY_PTR) && to->size <= 8 &&
+             is_simple_arg(node->lhs);
+    }
+  }
+  return false;
+}
+
+static void push_args2_sysv(Node* args, bool first_pass) {
+  if (!args)
+    return;
+  push_args2_sysv(args->next, first_pass);
+
+  if (args->eval_into_reg)
+    return;
+
+  // Push all the by-stack first, then on the second pass, push all the things
+  // that will be popped back into registers by the actual call.
+  if ((first_pass && !args->pass_by_stack) || (!first_pass && args->pass_by_stack))
+    return;
+
+  gen_expr(args);
+
+  switch (args->ty->kind) {
+    case TY_STRUCT:
+    case TY_UNION:
+      push_struct(args->ty);
+      break;
+    case TY_FLOAT:
+    case TY_DOUBLE:
+      pushf();
+      break;
+    case TY_LDOUBLE:
+      //| sub rsp, 16
+      //| fstp tword [rsp]
+      dasm_put(Dst, 690);
+#line 1004 "../../src/codegen.in.c"
+      C(depth) += 2;
+      break;
+    case TY_INT128:
+      push128();
+      // Pushed right to left, so the hole below it comes after.
+      if (args->stack_pad) {
+        //| sub rsp, 8
+        dasm_put(Dst, 55);
+#line 1011 "../../src/codegen.in.c"
+        C(depth)++;
+      }
+      break;
+    default:
+      push();
+      break;
+  }
+}
+
+// --- SysV ---
+//
+// Load function call arguments. Arguments are already evaluated and
+// stored to the stack as local variables. What we need to do in this
+// function is to load them to registers or push them to the stack as
+// specified by the x86-64 psABI. Here is what the spec says:
+//
+// - Up to 6 arguments of integral type are passed using RDI, RSI,
+//   RDX, RCX, R8 and R9.
+//
+// - Up to 8 arguments of floating-point type are passed using XMM0 to
+//   XMM7.
+//
+// - If all registers of an appropriate type are already used, push an
+//   argument to the stack in the right-to-left order.
+//
+// - Each argument passed on the stack takes 8 bytes, and the end of
+//   the argument area must be aligned to a 16 byte boundary. An
+//   __int128 on the stack is itself aligned to 16.
+//
+// - If a function is variadic, set the number of floating-point type
+//   arguments to RAX.
+//
+// --- SysV ---
+static int push_args_sysv(Node* node) {
+  int stack = 0, gp = 0, fp = 0;
+
+  // If the return type is a large struct/union, the caller passes
+  // a pointer to a buffer as if it were the first argument.
+  if (node->ret_buffer && node->ty->size > 16)
+    gp++;
+
+  // Load as many arguments to the registers as possible.
+  for (Node* arg = node->args; arg; arg = arg->next) {
+    Type* ty = arg->ty;
+
+    switch (ty->kind) {
+      case TY_STRUCT:
+      case TY_UNION:
+        if (ty->size > 16) {
+          arg->pass_by_stack = true;
+          stack += align_to_s(ty->size, 8) / 8;
+        } else {
+          bool fp1 = has_flonum1(ty);
+          bool fp2 = has_flonum2(ty);
+
+          if (fp + fp1 + fp2 < SYSV_FP_MAX && gp + !fp1 + !fp2 < SYSV_GP_MAX) {
+            fp = fp + fp1 + fp2;
+            gp = gp + !fp1 + !fp2;
+          } else {
+            arg->pass_by_stack = true;
+            stack += align_to_s(ty->size, 8) / 8;
+          }
+        }
+        break;
+      case TY_FLOAT:
+      case TY_DOUBLE:
+        if (fp >= SYSV_FP_MAX) {
+          arg->pass_by_stack = true;
+          stack++;
+        } else if (is_simple_arg(arg)) {
+          arg->eval_into_reg = true;
+          arg->eval_reg = fp;
+        }
+        fp++;
+        break;
+      case TY_LDOUBLE:
+        arg->pass_by_stack = true;
+        stack += 2;
+        break;
+      case TY_INT128:
+        // Passed in a pair of registers, or entirely on the stack.
+        if (gp + 2 <= SYSV_GP_MAX) {
+          gp += 2;
+        } else {
+          arg->pass_by_stack = true;
+          arg->stack_pad = stack % 2 == 1;
+          stack += arg->stack_pad + 2;
+        }
+        break;
+      default:
+        if (gp >= SYSV_GP_MAX) {
+          arg->pass_by_stack = true;
+          stack++;
+        } else if (is_simple_arg(arg)) {
+          arg->eval_into_reg = true;
+          arg->eval_reg = gp;
+        }
+        gp++;
+    }
+  }
+
+  if ((C(depth) + stack) % 2 == 1) {
+    //| sub rsp, 8
+    dasm_put(Dst, 55);
+#line 1114 "../../src/codegen.in.c"
+    C(depth)++;
+    stack++;
+  }
+
+  push_args2_sysv(node->args, true);
+  push_args2_sysv(node->args, false);
+
+  // If the return type is a large struct/union, the caller passes
+  // a pointer to a buffer as if it were the first argument.
+  if (node->ret_buffer && node->ty->size > 16) {
+    //| lea rax, [rbp+node->ret_buffer->offset]
+    dasm_put(Dst, 157, node->ret_buffer->offset);
+#line 1125 "../../src/codegen.in.c"
+    push();
+  }
+
+  return stack;
+}
+
+// Evaluate the arguments flagged by push_args_sysv() directly into their
+// registers. This is done right-to-left, so the argument destined for xmm0 (the
+// only register other than rax that they might use) is evaluated last.
+static void eval_reg_args_sysv(Node* args) {
+  if (!args)
+    return;
+  eval_reg_args_sysv(args->next);
+
+  if (!args->eval_into_reg)
+    return;
+
+  gen_expr(args);
+  if (is_flonum(args->ty)) {
+    if (args->eval_reg != 0) {
+      //| movaps xmm(args->eval_reg), xmm0
+      dasm_put(Dst, 699, (args->eval_reg));
+#line 1146 "../../src/codegen.in.c"
+    }
+  } else {
+    //| mov Rq(dasmargreg[args->eval_reg]), rax
+    dasm_put(Dst, 706, (dasmargreg[args->eval_reg]));
+#line 1149 "../../src/codegen.in.c"
+  }
+}
+
+static void copy_ret_buffer(Obj* var) {
+  Type* ty = var->ty;
+  int gp = 0, fp = 0;
+
+  if (has_flonum1(ty)) {
+    assert(ty->size == 4 || 8 <= ty->size);
+    if (ty->size == 4) {
+      //| movss dword [rbp+var->offset], xmm0
+      dasm_put(Dst, 712, var->offset);
+#line 1160 "../../src/codegen.in.c"
+    } else {
+      //| movsd qword [rbp+var->offset], xmm0
+      dasm_put(Dst, 719, var->offset);
+#line 1162 "../../src/codegen.in.c"
+    }
+    fp++;
+  } else {
+    for (int i = 0; i < MIN(8, ty->size); i++) {
+      //| mov [rbp+var->offset+i], al
+      //| shr rax, 8
+      dasm_put(Dst, 726, var->offset+i);
+#line 1168 "../../src/codegen.in.c"
+    }
+    gp++;
+  }
+
+  if (ty->size > 8) {
+    if (has_flonum2(ty)) {
+      assert(ty->size == 12 || ty->size == 16);
+      if (ty->size == 12) {
+        //| movss dword [rbp+var->offset+8], xmm(fp)
+        dasm_put(Dst, 734, (fp), var->offset+8);
+#line 1177 "../../src/codegen.in.c"
+      } else {
+        //| movsd qword [rbp+var->offset+8], xmm(fp)
+        dasm_put(Dst, 745, (fp), var->offset+8);
+#line 1179 "../../src/codegen.in.c"
+      }
+    } else {
+      for (int i = 8; i < MIN(16, ty->size); i++) {
+        //| mov [rbp+var->offset+i], Rb(gp)
+        //| shr Rq(gp), 8
+        dasm_put(Dst, 756, (gp), var->offset+i, (gp));
+#line 1184 "../../src/codegen.in.c"
+      }
+    }
+  }
+}
+
+#endif
+
+static void copy_struct_reg(void) {
+#if X64WIN
+  // TODO: I'm not sure if this is right/sufficient.
+  //| mov rax, [rax]
+  dasm_put(Dst, 85);
+#line 1195 "../../src/codegen.in.c"
+#else
+  Type* ty = C(current_fn)->ty->return_ty;
+
+  int gp = 0, fp = 0;
+
+  //| mov RUTIL, rax
+  dasm_put(Dst, 770);
+#line 1201 "../../src/codegen.in.c"
+
+  if (has_flonum(ty, 0, 8, 0)) {
+    assert(ty->size == 4 || 8 <= ty->size);
+    if (ty->size == 4) {
+      //| movss xmm0, dword [RUTIL]
+      dasm_put(Dst, 774);
+#line 1206 "../../src/codegen.in.c"
+    } else {
+      //| movsd xmm0, qword [RUTIL]
+      dasm_put(Dst, 780);
+#line 1208 "../../src/codegen.in.c"
+    }
+    fp++;
+  } else {
+    //| mov rax, 0
+    dasm_put(Dst, 786);
+#line 1212 "../../src/codegen.in.c"
+    for (int i = MIN(8, ty->size) - 1; i >= 0; i--) {
+      //| shl rax, 8
+      //| mov ax, [RUTIL+i]
+      dasm_put(Dst, 794, i);
+#line 1215 "../../src/codegen.in.c"
+    }
+    gp++;
+  }
+
+  if (ty->size > 8) {
+    if (has_flonum(ty, 8, 16, 0)) {
+      assert(ty->size == 12 || ty->size == 16);
+      if (ty->size == 4) {
+        //| movss xmm(fp), dword [RUTIL+8]
+        dasm_put(Dst, 803, (fp));
+#line 1224 "../../src/codegen.in.c"
+      } else {
+        //| movsd xmm(fp), qword [RUTIL+8]
+        dasm_put(Dst, 813, (fp));
+#line 1226 "../../src/codegen.in.c"
+      }
+    } else {
+      //| mov Rq(gp), 0
+      dasm_put(Dst, 823, (gp));
+#line 1229 "../../src/codegen.in.c"
+      for (int i = MIN(16, ty->size) - 1; i >= 8; i--) {
+        //| shl Rq(gp), 8
+        //| mov Rb(gp), [RUTIL+i]
+        dasm_put(Dst, 833, (gp), (gp), i);
+#line 1232 "../../src/codegen.in.c"
+      }
+    }
+  }
+#endif
+}
+
+static void copy_struct_mem(void) {
+  Type* ty = C(current_fn)->ty->return_ty;
+  Obj* var = C(current_fn)->params;
+
+  //| mov RUTIL, [rbp+var->offset]
+  dasm_put(Dst, 847, var->offset);
+#line 1243 "../../src/codegen.in.c"
+
+  for (int i = 0; i < ty->size; i++) {
+    //| mov dl, [rax+i]
+    //| mov [RUTIL+i], dl
+    dasm_put(Dst, 852, i, i);
+#line 1247 "../../src/codegen.in.c"
+  }
+}
+
+static void builtin_alloca(void) {
+  // Align size to 16 bytes.
+  //| add CARG1, 15
+  //| and CARG1d, 0xfffffff0
+  dasm_put(Dst, 859);
+#line 1254 "../../src/codegen.in.c"
+
+  // Shift the temporary area by CARG1.
+  //| mov CARG4, [rbp+C(current_fn)->alloca_bottom->offset]
+  //| sub CARG4, rsp
+  //| mov rax, rsp
+  //| sub rsp, CARG1
+  //| mov rdx, rsp
+  //|1:
+  //| cmp CARG4, 0
+  //| je >2
+  //| mov r8b, [rax]
+  //| mov [rdx], r8b
+  //| inc rdx
+  //| inc rax
+  //| dec CARG4
+  //| jmp <1
+  //|2:
+  dasm_put(Dst, 868, C(current_fn)->alloca_bottom->offset);
+#line 1271 "../../src/codegen.in.c"
+
+  // Move alloca_bottom pointer.
+  //| mov rax, [rbp+C(current_fn)->alloca_bottom->offset]
+  //| sub rax, CARG1
+  //| mov [rbp+C(current_fn)->alloca_bottom->offset], rax
+  dasm_put(Dst, 921, C(current_fn)->alloca_bottom->offset, C(current_fn)->alloca_bottom->offset);
+#line 1276 "../../src/codegen.in.c"
+}
+
+#if !X64WIN
+// Binary operators where the lhs is an __int128. Operations are done on
+// register pairs with carries between the halves, lhs in rdx:rax and rhs in
+// rsi:rdi.
+static void gen_binary_int128(Node* node) {
+  if (node->kind == ND_SHL || node->kind == ND_SHR) {
+    // The rhs of a shift isn't converted to the type of the lhs, and only the
+    // low byte of the count is relevant in any case.
+    gen_expr(node->rhs);
+    push();
+    gen_expr(node->lhs);
+    pop(REG_CX);
+
+    if (node->kind == ND_SHL) {
+      //| shld rdx, rax, cl
+      //| shl rax, cl
+      //| test cl, 64
+      //| je >1
+      //| mov rdx, rax
+      //| xor eax, eax
+      //|1:
+      dasm_put(Dst, 934);
+#line 1299 "../../src/codegen.in.c"
+    } else if (node->lhs->ty->is_unsigned) {
+      //| shrd rax, rdx, cl
+      //| shr rdx, cl
+      //| test cl, 64
+      //| je >1
+      //| mov rax, rdx
+      //| xor edx, edx
+      //|1:
+      dasm_put(Dst, 957);
+#line 1307 "../../src/codegen.in.c"
+    } else {
+      //| shrd rax, rdx, cl
+      //| sar rdx, cl
+      //| test cl, 64
+      //| je >1
+      //| mov rax, rdx
+      //| sar rdx, 63
+      //|1:
+      dasm_put(Dst, 981);
+#line 1315 "../../src/codegen.in.c"
+    }
+    return;
+  }
+
+  gen_expr(node->rhs);
+  push128();
+  gen_expr(node->lhs);
+  pop(REG_DI);
+  pop(REG_SI);
+
+  switch (node->kind) {
+    case ND_ADD:
+      //| add rax, rdi
+      //| adc rdx, rsi
+      dasm_put(Dst, 1008);
+#line 1329 "../../src/codegen.in.c"
+      return;
+    case ND_SUB:
+      //| sub rax, rdi
+      //| sbb rdx, rsi
+      dasm_put(Dst, 1017);
+#line 1333 "../../src/codegen.in.c"
+      return;
+    case ND_MUL:
+      // (ah:al * bh:bl) mod 2^128 = al*bl + ((ah*bl + al*bh) << 64)
+      //| mov r8, rax
+      //| mov r9, rdx
+      //| imul r9, rdi
+      //| imul rsi, r8
+      //| add r9, rsi
+      //| mul rdi
+      //| add rdx, r9
+      dasm_put(Dst, 1026);
+#line 1343 "../../src/codegen.in.c"
+      return;
+    case ND_DIV:
+    case ND_MOD: {
+      // Runtime helpers take the dividend in rsi:rdi and the divisor in
+      // rcx:rdx, as normal SysV __int128 arguments.
+      //| mov rcx, rsi
+      //| mov r8, rdi
+      //| mov rdi, rax
+      //| mov rsi, rdx
+      //| mov rdx, r8
+      dasm_put(Dst, 1053);
+#line 1353 "../../src/codegen.in.c"
+      bool is_unsigned = node->ty->is_unsigned;
+      if (node->kind == ND_DIV) {
+        call_runtime_helper(is_unsigned ? "__dyibicc_udivti3" : "__dyibicc_divti3");
+      } else {
+        call_runtime_helper(is_unsigned ? "__dyibicc_umodti3" : "__dyibicc_modti3");
+      }
+      return;
+    }
+    case ND_BITAND:
+      //| and rax, rdi
+      //| and rdx, rsi
+      dasm_put(Dst, 1071);
+#line 1364 "../../src/codegen.in.c"
+      return;
+    case ND_BITOR:
+      //| or rax, rdi
+      //| or rdx, rsi
+      dasm_put(Dst, 1080);
+#line 1368 "../../src/codegen.in.c"
+      return;
+    case ND_BITXOR:
+      //| xor rax, rdi
+      //| xor rdx, rsi
+      dasm_put(Dst, 1089);
+#line 1372 "../../src/codegen.in.c"
+      return;
+    case ND_EQ:
+    case ND_NE:
+      //| xor rax, rdi
+      //| xor rdx, rsi
+      //| or rax, rdx
+      dasm_put(Dst, 1098);
+#line 1378 "../../src/codegen.in.c"
+      if (node->kind == ND_EQ) {
+        //| sete al
+        dasm_put(Dst, 1110);
+#line 1380 "../../src/codegen.in.c"
+      } else {
+        //| setne al
+        dasm_put(Dst, 1114);
+#line 1382 "../../src/codegen.in.c"
+      }
+      //| movzx rax, al
+      dasm_put(Dst, 1118);
+#line 1384 "../../src/codegen.in.c"
+      return;
+    case ND_LT:
+      // Flags of lhs - rhs via a borrow chain.
+      //| cmp rax, rdi
+      //| sbb rdx, rsi
+      dasm_put(Dst, 1123);
+#line 1389 "../../src/codegen.in.c"
+      if (node->lhs->ty->is_unsigned) {
+        //| setb al
+        dasm_put(Dst, 1132);
+#line 1391 "../../src/codegen.in.c"
+      } else {
+        //| setl al
+        dasm_put(Dst, 1136);
+#line 1393 "../../src/codegen.in.c"
+      }
+      //| movzx rax, al
+      dasm_put(Dst, 1118);
+#line 1395 "../../src/codegen.in.c"
+      return;
+    case ND_LE:
+      // lhs <= rhs is !(rhs < lhs), so compute rhs - lhs instead.
+      //| cmp rdi, rax
+      //| sbb rsi, rdx
+      dasm_put(Dst, 1140);
+#line 1400 "../../src/codegen.in.c"
+      if (node->lhs->ty->is_unsigned) {
+        //| setae al
+        dasm_put(Dst, 1147);
+#line 1402 "../../src/codegen.in.c"
+      } else {
+        //| setge al
+        dasm_put(Dst, 1151);
+#line 1404 "../../src/codegen.in.c"
+      }
+      //| movzx rax, al
+      dasm_put(Dst, 1118);
+#line 1406 "../../src/codegen.in.c"
+      return;
+  }
+
+  error_tok(node->tok, "invalid expression");
+}
+#endif
+
+// Generate code for a given node.
+// Function entries and loop headers are aligned so that they start on a fresh
+// fetch block. DynASM pads with single byte nops, which are all executed when
+// the code before falls through, so the padding is marked with a label on each
+// side and written over with longer nops by fill_align_padding() once encoded.
+static void align_code(void) {
+  int start = codegen_pclabel();
+  int end = codegen_pclabel();
+  //|=>start:
+  dasm_put(Dst, 0, start);
+#line 1422 "../../src/codegen.in.c"
+  if (user_context->code_alignment == 32) {
+    //| .align 32
+    dasm_put(Dst, 1155);
+#line 1424 "../../src/codegen.in.c"
+  } else {
+    //| .align 16
+    dasm_put(Dst, 1158);
+#line 1426 "../../src/codegen.in.c"
+  }
+  //|=>end:
+  dasm_put(Dst, 0, end);
+#line 1428 "../../src/codegen.in.c"
+  intarray_push(&C(align_labels), start, AL_Compile);
+  intarray_push(&C(align_labels), end, AL_Compile);
+}
+
+// The recommended nop forms for each length, 0F 1F /0 with growing operands.
+static const unsigned char multi_byte_nops[9][9] = {
+    {0x90},
+    {0x66, 0x90},
+    {0x0f, 0x1f, 0x00},
+    {0x0f, 0x1f, 0x40, 0x00},
+    {0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+static void fill_align_padding(char* base) {
+  for (int i = 0; i < C(align_labels).len; i += 2) {
+    char* p = base + dasm_getpclabel(&C(dynasm), C(align_labels).data[i]);
+    char* end = base + dasm_getpclabel(&C(dynasm), C(align_labels).data[i + 1]);
+    while (p < end) {
+      int len = MIN((int)(end - p), 9);
+      memcpy(p, multi_byte_nops[len - 1], len);
+      p += len;
+    }
+  }
+}
+
+#if !X64WIN
+// Calls |fn| with r11 as its argument, preserving the argument registers and
+// rax (which holds the number of vector registers used by a varargs call), and
+// leaves its result in r11. The stack is realigned, so this can go before a
+// function's prologue or at a statement within its body.
+static void emit_call_preserving_args(void* fn) {
+  //| push rbp
+  //| mov rbp, rsp
+  //| push rdi
+  //| push rsi
+  //| push rdx
+  //| push rcx
+  //| push r8
+  //| push r9
+  //| push rax
+  //| and rsp, -16
+  //| sub rsp, 64
+  dasm_put(Dst, 1161);
+#line 1474 "../../src/codegen.in.c"
+  for (int i = 0; i < 8; ++i) {
+    //| movsd qword [rsp+i*8], xmm(i)
+    dasm_put(Dst, 1185, (i), i*8);
+#line 1476 "../../src/codegen.in.c"
+  }
+  //| mov rdi, r11
+  //| mov64 rax, (uintptr_t)fn
+  //| call rax
+  //| mov r11, rax
+  dasm_put(Dst, 1197, (unsigned int)((uintptr_t)fn), (unsigned int)(((uintptr_t)fn)>>32));
+#line 1481 "../../src/codegen.in.c"
+  for (int i = 0; i < 8; ++i) {
+    //| movsd xmm(i), qword [rsp+i*8]
+    dasm_put(Dst, 1211, (i), i*8);
+#line 1483 "../../src/codegen.in.c"
+  }
+  //| lea rsp, [rbp-56]
+  //| pop rax
+  //| pop r9
+  //| pop r8
+  //| pop rcx
+  //| pop rdx
+  //| pop rsi
+  //| pop rdi
+  //| pop rbp
+  dasm_put(Dst, 1223);
+#line 1493 "../../src/codegen.in.c"
+}
+
+// Calls or loop iterations after which a function is promoted out of tier 0.
+#define TIER_UP_CALLS 1000
+#define TIER_UP_BACKEDGES 10000
+
+// In tier 0 code, counts an entry or a loop back-edge in |counter|, and
+// requests that the function be promoted when it reaches |threshold|. The
+// counts aren't atomic, as they only have to be roughly right.
+static void emit_tier0_count(uint64_t* counter, int threshold) {
+  int lskip = codegen_pclabel();
+  //| mov64 r11, (uintptr_t)counter
+  //| add qword [r11], 1
+  //| cmp qword [r11], threshold
+  //| jne =>lskip
+  //| mov64 r11, (uintptr_t)C(tier0_function)
+  dasm_put(Dst, 1238, (unsigned int)((uintptr_t)counter), (unsigned int)(((uintptr_t)counter)>>32), threshold, lskip, (unsigned int)((uintptr_t)C(tier0_function)), (unsigned int)(((uintptr_t)C(tier0_function))>>32));
+#line 1509 "../../src/codegen.in.c"
+  emit_call_preserving_args((void*)request_promotion);
+  //|=>lskip:
+  dasm_put(Dst, 0, lskip);
+#line 1511 "../../src/codegen.in.c"
+}
+
+// Whether |fn| calls the instrument hooks or counts cycles, see
+// instrument_functions.
+static bool is_instrumented(Obj* fn) {
+  UserContext* uc = user_context;
+  return (uc->instrument_functions || fn->is_instrumented) &&
+         (uc->instrument_enter || uc->instrument_exit || uc->instrument_cycles);
+}
+
+// Reads the time stamp counter into rax, clobbering rdx.
+static void emit_rdtsc(void) {
+  //| rdtsc
+  //| shl rdx, 32
+  //| or rax, rdx
+  dasm_put(Dst, 1258);
+#line 1526 "../../src/codegen.in.c"
+}
+
+// Calls |hook| with the current function's address and the address it was
+// called from. The stack must be aligned.
+static void emit_instrument_hook(void* hook) {
+  //| lea rdi, [=>C(current_fn)->dasm_entry_label]
+  //| mov rsi, [rbp+8]
+  //| mov64 rax, (uintptr_t)hook
+  //| call rax
+  dasm_put(Dst, 1268, C(current_fn)->dasm_entry_label, (unsigned int)((uintptr_t)hook), (unsigned int)(((uintptr_t)hook)>>32));
+#line 1535 "../../src/codegen.in.c"
+}
+
+// Goes after the prologue of an instrumented function, once the arguments have
+// been stored, so they don't need preserving.
+static void emit_instrument_enter(Obj* fn) {
+  if (user_context->instrument_enter)
+    emit_instrument_hook(user_context->instrument_enter);
+  if (fn->instrument_counts) {
+    //| mov64 r11, (uintptr_t)fn->instrument_counts
+    //| add qword [r11], 1
+    dasm_put(Dst, 1284, (unsigned int)((uintptr_t)fn->instrument_counts), (unsigned int)(((uintptr_t)fn->instrument_counts)>>32));
+#line 1545 "../../src/codegen.in.c"
+    emit_rdtsc();
+    //| mov [rbp+fn->instrument_tsc_offset], rax
+    dasm_put(Dst, 929, fn->instrument_tsc_offset);
+#line 1547 "../../src/codegen.in.c"
+  }
+}
+
+// Goes at the return label of an instrumented function, preserving the return
+// value.
+static void emit_instrument_exit(Obj* fn) {
+  // The epilogue restores rsp from rbp, so it can be realigned here freely.
+  //| and rsp, -16
+  //| sub rsp, 32
+  //| mov [rsp], rax
+  //| mov [rsp+8], rdx
+  //| movsd qword [rsp+16], xmm0
+  //| movsd qword [rsp+24], xmm1
+  dasm_put(Dst, 1293);
+#line 1560 "../../src/codegen.in.c"
+  if (fn->instrument_counts) {
+    emit_rdtsc();
+    //| sub rax, [rbp+fn->instrument_tsc_offset]
+    //| mov64 r11, (uintptr_t)fn->instrument_counts
+    //| add [r11+8], rax
+    dasm_put(Dst, 1327, fn->instrument_tsc_offset, (unsigned int)((uintptr_t)fn->instrument_counts), (unsigned int)(((uintptr_t)fn->instrument_counts)>>32));
+#line 1565 "../../src/codegen.in.c"
+  }
+  if (user_context->instrument_exit)
+    emit_instrument_hook(user_context->instrument_exit);
+  //| mov rax, [rsp]
+  //| mov rdx, [rsp+8]
+  //| movsd xmm0, qword [rsp+16]
+  //| movsd xmm1, qword [rsp+24]
+  dasm_put(Dst, 1340);
+#line 1572 "../../src/codegen.in.c"
+}
+#endif
+
+// With profile_branches, adds one to the current function's count at |index|.
+static void emit_profile_count(int index) {
+  uint64_t* counts = C(current_fn)->profile_counts;
+  if (!counts || index < 0)
+    return;
+  //| mov64 r11, (uintptr_t)&counts[index]
+  //| add qword [r11], 1
+  dasm_put(Dst, 1284, (unsigned int)((uintptr_t)&counts[index]), (unsigned int)(((uintptr_t)&counts[index])>>32));
+#line 1582 "../../src/codegen.in.c"
+}
+
+// Whether there's a loaded profile that applies to |node|, and if so, its
+// |offset|th count.
+static bool has_profile(Node* node) {
+  return C(profile) && node->profile_site;
+}
+
+static uint64_t profile_count(Node* node, int offset) {
+  return has_profile(node) ? C(profile)->counts[node->profile_site - 1 + offset] : 0;
+}
+
+// Whether |node| ends in a call to a function that doesn't return, so it can be
+// assumed to be an error path.
+static bool is_noreturn(Node* node) {
+  switch (node->kind) {
+    case ND_FUNCALL:
+      return node->func_ty->is_noreturn;
+    case ND_CAST:
+    case ND_EXPR_STMT:
+      return is_noreturn(node->lhs);
+    case ND_COMMA:
+      return is_noreturn(node->lhs) || is_noreturn(node->rhs);
+    case ND_BLOCK:
+      for (Node* n = node->body; n; n = n->next) {
+        if (is_noreturn(n))
+          return true;
+      }
+      return false;
+  }
+  return false;
+}
+
+// For an ND_IF or ND_COND, returns the branch that should be moved to the
+// .cold section at the end of the code segment, if any. A branch is cold if
+// the profile says it was never taken while the other was, if the condition is
+// hinted with __builtin_expect(), or if it ends in a noreturn call (e.g.
+// abort() or an assert failure).
+static Node* cold_branch(Node* node) {
+#if X64WIN
+  // Code has to stay within the range of its function's unwind info.
+  (void)node;
+  return NULL;
+#else
+  if (C(in_cold_section))
+    return NULL;
+
+  uint64_t then_count = profile_count(node, 0);
+  uint64_t els_count = profile_count(node, 1);
+  if (then_count + els_count > 0) {
+    if (then_count == 0)
+      return node->then;
+    if (node->els && els_count == 0)
+      return node->els;
+    return NULL;
+  }
+
+  if (node->cond->branch_hint < 0)
+    return node->then;
+  if (!node->els)
+    return is_noreturn(node->then) ? node->then : NULL;
+  if (node->cond->branch_hint > 0)
+    return node->els;
+
+  bool then_cold = is_noreturn(node->then);
+  bool els_cold = is_noreturn(node->els);
+  if (then_cold != els_cold)
+    return then_cold ? node->then : node->els;
+  return NULL;
+#endif
+}
+
+// Emits |node| into the .cold section at |lcold|, jumping back to |lret| when
+// done. |profile_index| is the branch's count, if any.
+static void gen_cold(Node* node, bool is_expr, int lcold, int lret, int profile_index) {
+  //| .cold
+  dasm_put(Dst, 1364);
+#line 1658 "../../src/codegen.in.c"
+  C(in_cold_section) = true;
+  //|=>lcold:
+  dasm_put(Dst, 0, lcold);
+#line 1660 "../../src/codegen.in.c"
+  emit_profile_count(profile_index);
+  if (is_expr) {
+    gen_expr(node);
+  } else {
+    gen_stmt(node);
+  }
+  //| jmp =>lret
+  dasm_put(Dst, 1366, lret);
+#line 1667 "../../src/codegen.in.c"
+  C(in_cold_section) = false;
+  //| .code
+  dasm_put(Dst, 1370);
+#line 1669 "../../src/codegen.in.c"
+}
+
+static void gen_expr(Node* node) {
+  switch (node->kind) {
+    case ND_NULL_EXPR:
+      return;
+    case ND_NUM: {
+      switch (node->ty->kind) {
+        case TY_FLOAT: {
+          union {
+            float f32;
+            uint32_t u32;
+          } u = {(float)node->fval};
+          //| mov eax, u.u32
+          //| movd xmm0, rax
+          dasm_put(Dst, 1372, u.u32);
+#line 1684 "../../src/codegen.in.c"
+          return;
+        }
+        case TY_DOUBLE: {
+          union {
+            double f64;
+            uint64_t u64;
+          } u = {(double)node->fval};
+          //| mov64 rax, u.u64
+          //| movd xmm0, rax
+          dasm_put(Dst, 1380, (unsigned int)(u.u64), (unsigned int)((u.u64)>>32));
+#line 1693 "../../src/codegen.in.c"
+          return;
+        }
+#if !X64WIN
+        case TY_LDOUBLE: {
+          union {
+            long double f80;
+            uint64_t u64[2];
+          } u;
+          memset(&u, 0, sizeof(u));
+          u.f80 = node->fval;
+          //| mov64 rax, u.u64[0]
+          //| mov [rsp-16], rax
+          //| mov64 rax, u.u64[1]
+          //| mov [rsp-8], rax
+          //| fld tword [rsp-16]
+          dasm_put(Dst, 1390, (unsigned int)(u.u64[0]), (unsigned int)((u.u64[0])>>32), (unsigned int)(u.u64[1]), (unsigned int)((u.u64[1])>>32));
+#line 1708 "../../src/codegen.in.c"
+          return;
+        }
+#endif
+      }
+
+      if (node->val < INT_MIN || node->val > INT_MAX) {
+        //| mov64 rax, node->val
+        dasm_put(Dst, 1416, (unsigned int)(node->val), (unsigned int)((node->val)>>32));
+#line 1715 "../../src/codegen.in.c"
+      } else {
+        //| mov rax, node->val
+        dasm_put(Dst, 1421, node->val);
+#line 1717 "../../src/codegen.in.c"
+      }
+#if !X64WIN
+      if (node->ty->kind == TY_INT128) {
+        //| cqo
+        dasm_put(Dst, 656);
+#line 1721 "../../src/codegen.in.c"
+      }
+#endif
+      return;
+    }
+    case ND_NEG:
+      gen_expr(node->lhs);
+
+      switch (node->ty->kind) {
+        case TY_FLOAT:
+          //| mov rax, 1
+          //| shl rax, 31
+          //| movd xmm1, rax
+          //| xorps xmm0, xmm1
+          dasm_put(Dst, 1426);
+#line 1734 "../../src/codegen.in.c"
+          return;
+        case TY_DOUBLE:
+          //| mov rax, 1
+          //| shl rax, 63
+          //| movd xmm1, rax
+          //| xorpd xmm0, xmm1
+          dasm_put(Dst, 1446);
+#line 1740 "../../src/codegen.in.c"
+          return;
+#if !X64WIN
+        case TY_LDOUBLE:
+          //| fchs
+          dasm_put(Dst, 1467);
+#line 1744 "../../src/codegen.in.c"
+          return;
+        case TY_INT128:
+          //| neg rax
+          //| adc rdx, 0
+          //| neg rdx
+          dasm_put(Dst, 1470);
+#line 1749 "../../src/codegen.in.c"
+          return;
+#endif
+      }
+
+      //| neg rax
+      dasm_put(Dst, 1483);
+#line 1754 "../../src/codegen.in.c"
+      return;
+    case ND_VAR:
+      gen_addr(node);
+      load(node->ty);
+      return;
+    case ND_MEMBER: {
+      gen_addr(node);
+      load(node->ty);
+
+      Member* mem = node->member;
+      if (mem->is_bitfield) {
+        //| shl rax, 64 - mem->bit_width - mem->bit_offset
+        dasm_put(Dst, 1488, 64 - mem->bit_width - mem->bit_offset);
+#line 1766 "../../src/codegen.in.c"
+        if (mem->ty->is_unsigned) {
+          //| shr rax, 64 - mem->bit_width
+          dasm_put(Dst, 1493, 64 - mem->bit_width);
+#line 1768 "../../src/codegen.in.c"
+        } else {
+          //| sar rax, 64 - mem->bit_width
+          dasm_put(Dst, 1498, 64 - mem->bit_width);
+#line 1770 "../../src/codegen.in.c"
+        }
+      }
+      return;
+    }
+    case ND_DEREF:
+      gen_expr(node->lhs);
+      load(node->ty);
+      return;
+    case ND_ADDR:
+      gen_addr(node->lhs);
+      return;
+    case ND_ASSIGN:
+      // Special case "int into a local". Normally this would compile to:
+      //   lea rax,[rbp+node->lhs->offset]
+      //   push rax
+      //   mov rax, node->rhs->val
+      //   pop rcx
+      //   mov [rcx], eax
+      if (node->lhs->kind == ND_VAR && node->lhs->var->is_local && node->rhs->kind == ND_NUM &&
+          node->rhs->ty->kind != TY_FLOAT && node->rhs->ty->kind != TY_DOUBLE &&
+          node->rhs->ty->kind != TY_LDOUBLE && node->rhs->val >= INT_MIN &&
+          node->rhs->val <= INT_MAX) {
+        //| mov rax, node->rhs->val
+        //| mov dword [rbp+node->lhs->var->offset], eax
+        dasm_put(Dst, 1504, node->rhs->val, node->lhs->var->offset);
+#line 1794 "../../src/codegen.in.c"
+      } else {
+        gen_addr(node->lhs);
+        push();
+        gen_expr(node->rhs);
+
+        if (node->lhs->kind == ND_MEMBER && node->lhs->member->is_bitfield) {
+          //| mov r8, rax
+          dasm_put(Dst, 1512);
+#line 1801 "../../src/codegen.in.c"
+
+          // If the lhs is a bitfield, we need to read the current value
+          // from memory and merge it with a new value.
+          Member* mem = node->lhs->member;
+          //| mov RUTIL, rax
+          //| and RUTIL, (1L << mem->bit_width) - 1
+          //| shl RUTIL, mem->bit_offset
+          dasm_put(Dst, 1516, (1L << mem->bit_width) - 1, mem->bit_offset);
+#line 1808 "../../src/codegen.in.c"
+
+          //| mov rax, [rsp]
+          dasm_put(Dst, 1528);
+#line 1810 "../../src/codegen.in.c"
+          load(mem->ty);
+
+          long mask = ((1L << mem->bit_width) - 1) << mem->bit_offset;
+          //| mov r9, ~mask
+          //| and rax, r9
+          //| or rax, RUTIL
+          dasm_put(Dst, 1533, ~mask);
+#line 1816 "../../src/codegen.in.c"
+          store(node->ty);
+          //| mov rax, r8
+          dasm_put(Dst, 1545);
+#line 1818 "../../src/codegen.in.c"
+          return;
+        }
+
+        store(node->ty);
+      }
+      return;
+    case ND_STMT_EXPR:
+      for (Node* n = node->body; n; n = n->next)
+        gen_stmt(n);
+      return;
+    case ND_COMMA:
+      gen_expr(node->lhs);
+      gen_expr(node->rhs);
+      return;
+    case ND_CAST:
+      gen_expr(node->lhs);
+      cg_cast(node->lhs->ty, node->ty);
+      return;
+    case ND_MEMZERO:
+      // `rep stosb` is equivalent to `memset(rdi, al, rcx)`.
+#if X64WIN
+      //| push rdi
+      dasm_put(Dst, 1549);
+#line 1840 "../../src/codegen.in.c"
+#endif
+      //| mov rcx, node->var->ty->size
+      //| lea rdi, [rbp+node->var->offset]
+      //| mov al, 0
+      //| rep
+      //| stosb
+      dasm_put(Dst, 1551, node->var->ty->size, node->var->offset);
+#line 1846 "../../src/codegen.in.c"
+#if X64WIN
+      //| pop rdi
+      dasm_put(Dst, 1565);
+#line 1848 "../../src/codegen.in.c"
+#endif
+      return;
+    case ND_COND: {
+      int lelse = codegen_pclabel();
+      int lend = codegen_pclabel();
+      gen_expr(node->cond);
+      cmp_zero(node->cond->ty);
+      Node* cold = cold_branch(node);
+      if (cold) {
+        // lelse is the start of the cold branch, placed out of line.
+        if (cold == node->then) {
+          //| jne =>lelse
+          dasm_put(Dst, 1567, lelse);
+#line 1860 "../../src/codegen.in.c"
+          gen_expr(node->els);
+        } else {
+          //| je =>lelse
+          dasm_put(Dst, 1571, lelse);
+#line 1863 "../../src/codegen.in.c"
+          gen_expr(node->then);
+        }
+        //|=>lend:
+        dasm_put(Dst, 0, lend);
+#line 1866 "../../src/codegen.in.c"
+        gen_cold(cold, true, lelse, lend, -1);
+        return;
+      }
+      //| je =>lelse
+      dasm_put(Dst, 1571, lelse);
+#line 1870 "../../src/codegen.in.c"
+      gen_expr(node->then);
+      //| jmp =>lend
+      //|=>lelse:
+      dasm_put(Dst, 1575, lend, lelse);
+#line 1873 "../../src/codegen.in.c"
+      gen_expr(node->els);
+      //|=>lend:
+      dasm_put(Dst, 0, lend);
+#line 1875 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_NOT:
+      gen_expr(node->lhs);
+      cmp_zero(node->lhs->ty);
+      //| sete al
+      //| movzx rax, al
+      dasm_put(Dst, 1580);
+#line 1882 "../../src/codegen.in.c"
+      return;
+    case ND_BITNOT:
+      gen_expr(node->lhs);
+      //| not rax
+      dasm_put(Dst, 1588);
+#line 1886 "../../src/codegen.in.c"
+#if !X64WIN
+      if (node->ty->kind == TY_INT128) {
+        //| not rdx
+        dasm_put(Dst, 1593);
+#line 1889 "../../src/codegen.in.c"
+      }
+#endif
+      return;
+    case ND_LOGAND: {
+      int lfalse = codegen_pclabel();
+      int lend = codegen_pclabel();
+      gen_expr(node->lhs);
+      cmp_zero(node->lhs->ty);
+      //| je =>lfalse
+      dasm_put(Dst, 1571, lfalse);
+#line 1898 "../../src/codegen.in.c"
+      gen_expr(node->rhs);
+      cmp_zero(node->rhs->ty);
+      //| je =>lfalse
+      //| mov rax, 1
+      //| jmp =>lend
+      //|=>lfalse:
+      //| mov rax, 0
+      //|=>lend:
+      dasm_put(Dst, 1598, lfalse, lend, lfalse, lend);
+#line 1906 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_LOGOR: {
+      int ltrue = codegen_pclabel();
+      int lend = codegen_pclabel();
+      gen_expr(node->lhs);
+      cmp_zero(node->lhs->ty);
+      //| jne =>ltrue
+      dasm_put(Dst, 1567, ltrue);
+#line 1914 "../../src/codegen.in.c"
+      gen_expr(node->rhs);
+      cmp_zero(node->rhs->ty);
+      //| jne =>ltrue
+      //| mov rax, 0
+      //| jmp =>lend
+      //|=>ltrue:
+      //| mov rax, 1
+      //|=>lend:
+      dasm_put(Dst, 1621, ltrue, lend, ltrue, lend);
+#line 1922 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_FUNCALL: {
+      if (node->lhs->kind == ND_VAR && !strcmp(node->lhs->var->name, "alloca")) {
+        gen_expr(node->args);
+        //| mov CARG1, rax
+        dasm_put(Dst, 770);
+#line 1928 "../../src/codegen.in.c"
+        builtin_alloca();
+        return;
+      }
+
+#if X64WIN
+      if (node->lhs->kind == ND_VAR && !strcmp(node->lhs->var->name, "__va_start")) {
+        // va_start(ap, x) turns into __va_start(&ap, x), so we only want the
+        // expr here, not the address.
+        gen_expr(node->args);
+        push();
+        // ToS is now &ap.
+
+        gen_addr(node->args->next);
+        // RAX is now &x, move it to the next qword.
+        //| add rax, 8
+        dasm_put(Dst, 1644);
+#line 1943 "../../src/codegen.in.c"
+
+        // Store one-past the second argument into &ap.
+        pop(REG_UTIL);
+        //| mov [RUTIL], rax
+        dasm_put(Dst, 148);
+#line 1947 "../../src/codegen.in.c"
+        return;
+      }
+#endif
+
+#if X64WIN
+
+      int by_ref_copies_size = 0;
+      int stack_args = push_args_win(node, &by_ref_copies_size);
+      gen_expr(node->lhs);
+
+      int reg = 0;
+
+      // If the return type is a large struct/union, the caller passes
+      // a pointer to a buffer as if it were the first argument.
+      if (node->ret_buffer && !type_passed_in_register(node->ty)) {
+        pop(dasmargreg[reg++]);
+      }
+
+      for (Node* arg = node->args; arg; arg = arg->next) {
+        Type* ty = arg->ty;
+
+        switch (ty->kind) {
+          case TY_STRUCT:
+          case TY_UNION:
+            if ((type_passed_in_register(ty) && reg < X64WIN_REG_MAX) ||
+                (arg->pass_by_reference && reg < X64WIN_REG_MAX)) {
+              pop(dasmargreg[reg++]);
+            }
+            break;
+          case TY_FLOAT:
+          case TY_DOUBLE:
+            if (reg < X64WIN_REG_MAX) {
+              popf(reg);
+              // Varargs requires a copy of fp in gp.
+              //| movd Rq(dasmargreg[reg]), xmm(reg)
+              dasm_put(Dst, 1649, (reg), (dasmargreg[reg]));
+#line 1982 "../../src/codegen.in.c"
+              ++reg;
+            }
+            break;
+          default:
+            if (reg < X64WIN_REG_MAX) {
+              pop(dasmargreg[reg++]);
+            }
+        }
+      }
+
+      //| sub rsp, PARAMETER_SAVE_SIZE
+      //| mov r10, rax
+      //| call r10
+      //| add rsp, stack_args*8 + PARAMETER_SAVE_SIZE + by_ref_copies_size
+      dasm_put(Dst, 1659, PARAMETER_SAVE_SIZE, stack_args*8 + PARAMETER_SAVE_SIZE + by_ref_copies_size);
+#line 1996 "../../src/codegen.in.c"
+
+      C(depth) -= by_ref_copies_size / 8;
+      C(depth) -= stack_args;
+
+      // It looks like the most significant 48 or 56 bits in RAX may
+      // contain garbage if a function return type is short or bool/char,
+      // respectively. We clear the upper bits here.
+      switch (node->ty->kind) {
+        case TY_BOOL:
+          //| movzx eax, al
+          dasm_put(Dst, 215);
+#line 2006 "../../src/codegen.in.c"
+          return;
+        case TY_CHAR:
+          if (node->ty->is_unsigned) {
+            //| movzx eax, al
+            dasm_put(Dst, 215);
+#line 2010 "../../src/codegen.in.c"
+          } else {
+            //| movsx eax, al
+            dasm_put(Dst, 211);
+#line 2012 "../../src/codegen.in.c"
+          }
+          return;
+        case TY_SHORT:
+          if (node->ty->is_unsigned) {
+            //| movzx eax, ax
+            dasm_put(Dst, 223);
+#line 2017 "../../src/codegen.in.c"
+          } else {
+            //| movsx eax, ax
+            dasm_put(Dst, 219);
+#line 2019 "../../src/codegen.in.c"
+          }
+          return;
+      }
+
+      // If the return type is a small struct, a value is returned it's actually
+      // returned in rax, so copy it back into the return buffer where we're
+      // expecting it.
+      if (node->ret_buffer && type_passed_in_register(node->ty)) {
+        //| mov [rbp+node->ret_buffer->offset], rax
+        //| lea rax, [rbp+node->ret_buffer->offset]
+        dasm_put(Dst, 1676, node->ret_buffer->offset, node->ret_buffer->offset);
+#line 2029 "../../src/codegen.in.c"
+      }
+
+#else  // SysV
+
+      int stack_args = push_args_sysv(node);
+      gen_expr(node->lhs);
+      //| mov r10, rax
+      dasm_put(Dst, 1685);
+#line 2036 "../../src/codegen.in.c"
+
+      eval_reg_args_sysv(node->args);
+
+      int gp = 0, fp = 0;
+
+      // If the return type is a large struct/union, the caller passes
+      // a pointer to a buffer as if it were the first argument.
+      if (node->ret_buffer && node->ty->size > 16) {
+        pop(dasmargreg[gp++]);
+      }
+
+      for (Node* arg = node->args; arg; arg = arg->next) {
+        Type* ty = arg->ty;
+
+        switch (ty->kind) {
+          case TY_STRUCT:
+          case TY_UNION:
+            if (ty->size > 16)
+              continue;
+
+            bool fp1 = has_flonum1(ty);
+            bool fp2 = has_flonum2(ty);
+
+            if (fp + fp1 + fp2 < SYSV_FP_MAX && gp + !fp1 + !fp2 < SYSV_GP_MAX) {
+              if (fp1) {
+                popf(fp++);
+              } else {
+                pop(dasmargreg[gp++]);
+              }
+
+              if (ty->size > 8) {
+                if (fp2) {
+                  popf(fp++);
+                } else {
+                  pop(dasmargreg[gp++]);
+                }
+              }
+            }
+            break;
+          case TY_FLOAT:
+          case TY_DOUBLE:
+            if (fp < SYSV_FP_MAX) {
+              if (arg->eval_into_reg) {
+                fp++;
+              } else {
+                popf(fp++);
+              }
+            }
+            break;
+          case TY_LDOUBLE:
+            break;
+          case TY_INT128:
+            if (gp + 2 <= SYSV_GP_MAX) {
+              pop(dasmargreg[gp++]);
+              pop(dasmargreg[gp++]);
+            }
+            break;
+          default:
+            if (gp < SYSV_GP_MAX) {
+              if (arg->eval_into_reg) {
+                gp++;
+              } else {
+                pop(dasmargreg[gp++]);
+              }
+            }
+        }
+      }
+
+      //| mov rax, fp
+      //| call r10
+      //| add rsp, stack_args*8
+      dasm_put(Dst, 1689, fp, stack_args*8);
+#line 2107 "../../src/codegen.in.c"
+
+      C(depth) -= stack_args;
+
+      // It looks like the most significant 48 or 56 bits in RAX may
+      // contain garbage if a function return type is short or bool/char,
+      // respectively. We clear the upper bits here.
+      switch (node->ty->kind) {
+        case TY_BOOL:
+          //| movzx eax, al
+          dasm_put(Dst, 215);
+#line 2116 "../../src/codegen.in.c"
+          return;
+        case TY_CHAR:
+          if (node->ty->is_unsigned) {
+            //| movzx eax, al
+            dasm_put(Dst, 215);
+#line 2120 "../../src/codegen.in.c"
+          } else {
+            //| movsx eax, al
+            dasm_put(Dst, 211);
+#line 2122 "../../src/codegen.in.c"
+          }
+          return;
+        case TY_SHORT:
+          if (node->ty->is_unsigned) {
+            //| movzx eax, ax
+            dasm_put(Dst, 223);
+#line 2127 "../../src/codegen.in.c"
+          } else {
+            //| movsx eax, ax
+            dasm_put(Dst, 219);
+#line 2129 "../../src/codegen.in.c"
+          }
+          return;
+      }
+
+      // If the return type is a small struct, a value is returned
+      // using up to two registers.
+      if (node->ret_buffer && node->ty->size <= 16) {
+        copy_ret_buffer(node->ret_buffer);
+        //| lea rax, [rbp+node->ret_buffer->offset]
+        dasm_put(Dst, 157, node->ret_buffer->offset);
+#line 2138 "../../src/codegen.in.c"
+      }
+
+#endif  // SysV
+
+      return;
+    }
+    case ND_LABEL_VAL:
+      //| lea rax, [=>node->pc_label]
+      dasm_put(Dst, 162, node->pc_label);
+#line 2146 "../../src/codegen.in.c"
+      return;
+    case ND_REFLECT_TYPE_PTR:
+      // The type only exists in this process.
+      C(current_fn)->is_process_specific = true;
+      //| mov64 rax, node->reflect_ty;
+      dasm_put(Dst, 1416, (unsigned int)(node->reflect_ty), (unsigned int)((node->reflect_ty)>>32));
+#line 2151 "../../src/codegen.in.c"
+      return;
+    case ND_CAS:
+    case ND_LOCKCE: {
+      bool is_locked_ce = node->kind == ND_LOCKCE;
+
+      gen_expr(node->cas_addr);
+      push();
+      gen_expr(node->cas_new);
+      push();
+      gen_expr(node->cas_old);
+      if (!is_locked_ce) {
+        //| mov r8, rax
+        dasm_put(Dst, 1512);
+#line 2163 "../../src/codegen.in.c"
+        load(node->cas_old->ty->base);
+      }
+      pop(REG_DX);    // new
+      pop(REG_UTIL);  // addr
+
+      int sz = node->cas_addr->ty->base->size;
+      // dynasm doesn't support cmpxchg, and I didn't grok the encoding yet.
+      // Hack in the various bytes for the instructions we want since there's
+      // limited forms. RUTILenc is either 0x17 for RDI or 0x11 for RCX
+      // depending on whether we're encoding for Windows or SysV.
+      switch (sz) {
+        case 1:
+          // lock cmpxchg BYTE PTR [rdi/rcx], dl
+          //| .byte 0xf0
+          //| .byte 0x0f
+          //| .byte 0xb0
+          //| .byte RUTILenc
+          dasm_put(Dst, 1702);
+#line 2180 "../../src/codegen.in.c"
+          break;
+        case 2:
+          // lock cmpxchg WORD PTR [rdi/rcx],dx
+          //| .byte 0x66
+          //| .byte 0xf0
+          //| .byte 0x0f
+          //| .byte 0xb1
+          //| .byte RUTILenc
+          dasm_put(Dst, 1708);
+#line 2188 "../../src/codegen.in.c"
+          break;
+        case 4:
+          // lock cmpxchg DWORD PTR [rdi/rcx],edx
+          //| .byte 0xf0
+          //| .byte 0x0f
+          //| .byte 0xb1
+          //| .byte RUTILenc
+          dasm_put(Dst, 1709);
+#line 2195 "../../src/codegen.in.c"
+          break;
+        case 8:
+          // lock cmpxchg QWORD PTR [rdi/rcx],rdx
+          //| .byte 0xf0
+          //| .byte 0x48
+          //| .byte 0x0f
+          //| .byte 0xb1
+          //| .byte RUTILenc
+          dasm_put(Dst, 1715);
+#line 2203 "../../src/codegen.in.c"
+          break;
+        default:
+          unreachable();
+      }
+      if (!is_locked_ce) {
+        //| sete cl
+        //| je >1
+        dasm_put(Dst, 1722);
+#line 2210 "../../src/codegen.in.c"
+        switch (sz) {
+          case 1:
+            //| mov [r8], al
+            dasm_put(Dst, 1730);
+#line 2213 "../../src/codegen.in.c"
+            break;
+          case 2:
+            //| mov [r8], ax
+            dasm_put(Dst, 1734);
+#line 2216 "../../src/codegen.in.c"
+            break;
+          case 4:
+            //| mov [r8], eax
+            dasm_put(Dst, 1735);
+#line 2219 "../../src/codegen.in.c"
+            break;
+          case 8:
+            //| mov [r8], rax
+            dasm_put(Dst, 1739);
+#line 2222 "../../src/codegen.in.c"
+            break;
+          default:
+            unreachable();
+        }
+        //|1:
+        //| movzx eax, cl
+        dasm_put(Dst, 1743);
+#line 2228 "../../src/codegen.in.c"
+      }
+
+      return;
+    }
+    case ND_EXCH: {
+      gen_expr(node->lhs);
+      push();
+      gen_expr(node->rhs);
+      pop(REG_UTIL);
+
+      int sz = node->lhs->ty->base->size;
+      switch (sz) {
+        case 1:
+          //| xchg [RUTIL], al
+          dasm_put(Dst, 1749);
+#line 2242 "../../src/codegen.in.c"
+          break;
+        case 2:
+          //| xchg [RUTIL], ax
+          dasm_put(Dst, 1752);
+#line 2245 "../../src/codegen.in.c"
+          break;
+        case 4:
+          //| xchg [RUTIL], eax
+          dasm_put(Dst, 1753);
+#line 2248 "../../src/codegen.in.c"
+          break;
+        case 8:
+          //| xchg [RUTIL], rax
+          dasm_put(Dst, 1756);
+#line 2251 "../../src/codegen.in.c"
+          break;
+        default:
+          unreachable();
+      }
+      return;
+    }
+  }
+
+  switch (node->lhs->ty->kind) {
+    case TY_FLOAT:
+    case TY_DOUBLE: {
+      gen_expr(node->rhs);
+      pushf();
+      gen_expr(node->lhs);
+      popf(1);
+
+      bool is_float = node->lhs->ty->kind == TY_FLOAT;
+
+      switch (node->kind) {
+        case ND_ADD:
+          if (is_float) {
+            //| addss xmm0, xmm1
+            dasm_put(Dst, 1760);
+#line 2273 "../../src/codegen.in.c"
+          } else {
+            //| addsd xmm0, xmm1
+            dasm_put(Dst, 1766);
+#line 2275 "../../src/codegen.in.c"
+          }
+          return;
+        case ND_SUB:
+          if (is_float) {
+            //| subss xmm0, xmm1
+            dasm_put(Dst, 1772);
+#line 2280 "../../src/codegen.in.c"
+          } else {
+            //| subsd xmm0, xmm1
+            dasm_put(Dst, 1778);
+#line 2282 "../../src/codegen.in.c"
+          }
+          return;
+        case ND_MUL:
+          if (is_float) {
+            //| mulss xmm0, xmm1
+            dasm_put(Dst, 1784);
+#line 2287 "../../src/codegen.in.c"
+          } else {
+            //| mulsd xmm0, xmm1
+            dasm_put(Dst, 1790);
+#line 2289 "../../src/codegen.in.c"
+          }
+          return;
+        case ND_DIV:
+          if (is_float) {
+            //| divss xmm0, xmm1
+            dasm_put(Dst, 1796);
+#line 2294 "../../src/codegen.in.c"
+          } else {
+            //| divsd xmm0, xmm1
+            dasm_put(Dst, 1802);
+#line 2296 "../../src/codegen.in.c"
+          }
+          return;
+        case ND_EQ:
+        case ND_NE:
+        case ND_LT:
+        case ND_LE:
+          if (is_float) {
+            //| ucomiss xmm1, xmm0
+            dasm_put(Dst, 1808);
+#line 2304 "../../src/codegen.in.c"
+          } else {
+            //| ucomisd xmm1, xmm0
+            dasm_put(Dst, 1812);
+#line 2306 "../../src/codegen.in.c"
+          }
+
+          if (node->kind == ND_EQ) {
+            //| sete al
+            //| setnp dl
+            //| and al, dl
+            dasm_put(Dst, 1817);
+#line 2312 "../../src/codegen.in.c"
+          } else if (node->kind == ND_NE) {
+            //| setne al
+            //| setp dl
+            //| or al, dl
+            dasm_put(Dst, 1826);
+#line 2316 "../../src/codegen.in.c"
+          } else if (node->kind == ND_LT) {
+            //| seta al
+            dasm_put(Dst, 1835);
+#line 2318 "../../src/codegen.in.c"
+          } else {
+            //| setae al
+            dasm_put(Dst, 1147);
+#line 2320 "../../src/codegen.in.c"
+          }
+
+          //| and al, 1
+          //| movzx rax, al
+          dasm_put(Dst, 1839);
+#line 2324 "../../src/codegen.in.c"
+          return;
+      }
+
+      error_tok(node->tok, "invalid expression");
+    }
+#if !X64WIN
+    case TY_LDOUBLE: {
+      gen_expr(node->lhs);
+      gen_expr(node->rhs);
+
+      switch (node->kind) {
+        case ND_ADD:
+          //| faddp st1, st0
+          dasm_put(Dst, 1846);
+#line 2337 "../../src/codegen.in.c"
+          return;
+        case ND_SUB:
+          //| fsubrp st1, st0
+          dasm_put(Dst, 1849);
+#line 2340 "../../src/codegen.in.c"
+          return;
+        case ND_MUL:
+          //| fmulp st1, st0
+          dasm_put(Dst, 1852);
+#line 2343 "../../src/codegen.in.c"
+          return;
+        case ND_DIV:
+          //| fdivrp st1, st0
+          dasm_put(Dst, 1855);
+#line 2346 "../../src/codegen.in.c"
+          return;
+        case ND_EQ:
+        case ND_NE:
+        case ND_LT:
+        case ND_LE:
+          //| fcomip st1
+          //| fstp st0
+          dasm_put(Dst, 1859);
+#line 2353 "../../src/codegen.in.c"
+
+          if (node->kind == ND_EQ) {
+            //| sete al
+            dasm_put(Dst, 1110);
+#line 2356 "../../src/codegen.in.c"
+          } else if (node->kind == ND_NE) {
+            //| setne al
+            dasm_put(Dst, 1114);
+#line 2358 "../../src/codegen.in.c"
+          } else if (node->kind == ND_LT) {
+            //| seta al
+            dasm_put(Dst, 1835);
+#line 2360 "../../src/codegen.in.c"
+          } else {
+            //| setae al
+            dasm_put(Dst, 1147);
+#line 2362 "../../src/codegen.in.c"
+          }
+
+          //| movzx rax, al
+          dasm_put(Dst, 1118);
+#line 2365 "../../src/codegen.in.c"
+          return;
+      }
+
+      error_tok(node->tok, "invalid expression");
+    }
+    case TY_INT128:
+      gen_binary_int128(node);
+      return;
+#endif
+  }
+
+  gen_expr(node->rhs);
+  push();
+  gen_expr(node->lhs);
+  pop(REG_UTIL);
+
+  bool is_long = node->lhs->ty->kind == TY_LONG || node->lhs->ty->base;
+
+  switch (node->kind) {
+    case ND_ADD:
+      if (is_long) {
+        //| add rax, RUTIL
+        dasm_put(Dst, 1865);
+#line 2387 "../../src/codegen.in.c"
+      } else {
+        //| add eax, RUTILd
+        dasm_put(Dst, 1866);
+#line 2389 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_SUB:
+      if (is_long) {
+        //| sub rax, RUTIL
+        dasm_put(Dst, 1870);
+#line 2394 "../../src/codegen.in.c"
+      } else {
+        //| sub eax, RUTILd
+        dasm_put(Dst, 1871);
+#line 2396 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_MUL:
+      if (is_long) {
+        //| imul rax, RUTIL
+        dasm_put(Dst, 1875);
+#line 2401 "../../src/codegen.in.c"
+      } else {
+        //| imul eax, RUTILd
+        dasm_put(Dst, 1876);
+#line 2403 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_DIV:
+    case ND_MOD:
+      if (node->ty->is_unsigned) {
+        if (is_long) {
+          //| mov rdx, 0
+          //| div RUTIL
+          dasm_put(Dst, 1880);
+#line 2411 "../../src/codegen.in.c"
+        } else {
+          //| mov edx, 0
+          //| div RUTILd
+          dasm_put(Dst, 1893);
+#line 2414 "../../src/codegen.in.c"
+        }
+      } else {
+        if (node->lhs->ty->size == 8) {
+          //| cqo
+          dasm_put(Dst, 656);
+#line 2418 "../../src/codegen.in.c"
+        } else {
+          //| cdq
+          dasm_put(Dst, 657);
+#line 2420 "../../src/codegen.in.c"
+        }
+        if (is_long) {
+          //| idiv RUTIL
+          dasm_put(Dst, 1903);
+#line 2423 "../../src/codegen.in.c"
+        } else {
+          //| idiv RUTILd
+          dasm_put(Dst, 1904);
+#line 2425 "../../src/codegen.in.c"
+        }
+      }
+
+      if (node->kind == ND_MOD) {
+        //| mov rax, rdx
+        dasm_put(Dst, 1909);
+#line 2430 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_BITAND:
+      if (is_long) {
+        //| and rax, RUTIL
+        dasm_put(Dst, 1913);
+#line 2435 "../../src/codegen.in.c"
+      } else {
+        //| and eax, RUTILd
+        dasm_put(Dst, 1914);
+#line 2437 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_BITOR:
+      if (is_long) {
+        //| or rax, RUTIL
+        dasm_put(Dst, 1540);
+#line 2442 "../../src/codegen.in.c"
+      } else {
+        //| or eax, RUTILd
+        dasm_put(Dst, 1541);
+#line 2444 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_BITXOR:
+      if (is_long) {
+        //| xor rax, RUTIL
+        dasm_put(Dst, 1918);
+#line 2449 "../../src/codegen.in.c"
+      } else {
+        //| xor eax, RUTILd
+        dasm_put(Dst, 1919);
+#line 2451 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+      if (is_long) {
+        //| cmp rax, RUTIL
+        dasm_put(Dst, 1923);
+#line 2459 "../../src/codegen.in.c"
+      } else {
+        //| cmp eax, RUTILd
+        dasm_put(Dst, 1924);
+#line 2461 "../../src/codegen.in.c"
+      }
+
+      if (node->kind == ND_EQ) {
+        //| sete al
+        dasm_put(Dst, 1110);
+#line 2465 "../../src/codegen.in.c"
+      } else if (node->kind == ND_NE) {
+        //| setne al
+        dasm_put(Dst, 1114);
+#line 2467 "../../src/codegen.in.c"
+      } else if (node->kind == ND_LT) {
+        if (node->lhs->ty->is_unsigned) {
+          //| setb al
+          dasm_put(Dst, 1132);
+#line 2470 "../../src/codegen.in.c"
+        } else {
+          //| setl al
+          dasm_put(Dst, 1136);
+#line 2472 "../../src/codegen.in.c"
+        }
+      } else if (node->kind == ND_LE) {
+        if (node->lhs->ty->is_unsigned) {
+          //| setbe al
+          dasm_put(Dst, 1928);
+#line 2476 "../../src/codegen.in.c"
+        } else {
+          //| setle al
+          dasm_put(Dst, 1932);
+#line 2478 "../../src/codegen.in.c"
+        }
+      }
+
+      //| movzx rax, al
+      dasm_put(Dst, 1118);
+#line 2482 "../../src/codegen.in.c"
+      return;
+    case ND_SHL:
+      //| mov rcx, RUTIL
+      dasm_put(Dst, 1936);
+#line 2485 "../../src/codegen.in.c"
+      if (is_long) {
+        //| shl rax, cl
+        dasm_put(Dst, 1941);
+#line 2487 "../../src/codegen.in.c"
+      } else {
+        //| shl eax, cl
+        dasm_put(Dst, 1942);
+#line 2489 "../../src/codegen.in.c"
+      }
+      return;
+    case ND_SHR:
+      //| mov rcx, RUTIL
+      dasm_put(Dst, 1936);
+#line 2493 "../../src/codegen.in.c"
+      if (node->lhs->ty->is_unsigned) {
+        if (is_long) {
+          //| shr rax, cl
+          dasm_put(Dst, 1945);
+#line 2496 "../../src/codegen.in.c"
+        } else {
+          //| shr eax, cl
+          dasm_put(Dst, 1946);
+#line 2498 "../../src/codegen.in.c"
+        }
+      } else {
+        if (is_long) {
+          //| sar rax, cl
+          dasm_put(Dst, 1949);
+#line 2502 "../../src/codegen.in.c"
+        } else {
+          //| sar eax, cl
+          dasm_put(Dst, 1950);
+#line 2504 "../../src/codegen.in.c"
+        }
+      }
+      return;
+  }
+
+  error_tok(node->tok, "invalid expression");
+}
+
+static void gen_stmt(Node* node) {
+  if (wants_line_info()) {
+    record_line_syminfo(node->tok->file->file_no, node->tok->line_no, codegen_pclabel());
+  }
+
+  switch (node->kind) {
+    case ND_IF: {
+      int lelse = codegen_pclabel();
+      int lend = codegen_pclabel();
+      // Counts of the then and else branches, see profile_branches.
+      int then_index = node->profile_site - 1;
+      int els_index = then_index < 0 ? -1 : then_index + 1;
+      gen_expr(node->cond);
+      cmp_zero(node->cond->ty);
+      Node* cold = cold_branch(node);
+      if (cold) {
+        // lelse is the start of the cold branch, placed out of line.
+        if (cold == node->then) {
+          //| jne =>lelse
+          dasm_put(Dst, 1567, lelse);
+#line 2531 "../../src/codegen.in.c"
+          emit_profile_count(els_index);
+          if (node->els)
+            gen_stmt(node->els);
+        } else {
+          //| je =>lelse
+          dasm_put(Dst, 1571, lelse);
+#line 2536 "../../src/codegen.in.c"
+          emit_profile_count(then_index);
+          gen_stmt(node->then);
+        }
+        //|=>lend:
+        dasm_put(Dst, 0, lend);
+#line 2540 "../../src/codegen.in.c"
+        gen_cold(cold, false, lelse, lend, cold == node->then ? then_index : els_index);
+        return;
+      }
+      if (node->els && profile_count(node, 1) > profile_count(node, 0)) {
+        // The else branch is taken more often, so it's the one to fall through
+        // to, and lelse is the then branch instead.
+        //| jne =>lelse
+        dasm_put(Dst, 1567, lelse);
+#line 2547 "../../src/codegen.in.c"
+        emit_profile_count(els_index);
+        gen_stmt(node->els);
+        //| jmp =>lend
+        //|=>lelse:
+        dasm_put(Dst, 1575, lend, lelse);
+#line 2551 "../../src/codegen.in.c"
+        emit_profile_count(then_index);
+        gen_stmt(node->then);
+        //|=>lend:
+        dasm_put(Dst, 0, lend);
+#line 2554 "../../src/codegen.in.c"
+        return;
+      }
+      //| je =>lelse
+      dasm_put(Dst, 1571, lelse);
+#line 2557 "../../src/codegen.in.c"
+      emit_profile_count(then_index);
+      gen_stmt(node->then);
+      //| jmp =>lend
+      //|=>lelse:
+      dasm_put(Dst, 1575, lend, lelse);
+#line 2561 "../../src/codegen.in.c"
+      emit_profile_count(els_index);
+      if (node->els)
+        gen_stmt(node->els);
+      //|=>lend:
+      dasm_put(Dst, 0, lend);
+#line 2565 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_FOR: {
+      if (node->init)
+        gen_stmt(node->init);
+      int lbegin = codegen_pclabel();
+      // Loops that the profile says never went round aren't worth padding.
+      if (!C(in_cold_section) && !(has_profile(node) && profile_count(node, 0) == 0))
+        align_code();
+      //|=>lbegin:
+      dasm_put(Dst, 0, lbegin);
+#line 2575 "../../src/codegen.in.c"
+      if (node->cond) {
+        gen_expr(node->cond);
+        cmp_zero(node->cond->ty);
+        //| je =>node->brk_pc_label
+        dasm_put(Dst, 1571, node->brk_pc_label);
+#line 2579 "../../src/codegen.in.c"
+      }
+      gen_stmt(node->then);
+      //|=>node->cont_pc_label:
+      dasm_put(Dst, 0, node->cont_pc_label);
+#line 2582 "../../src/codegen.in.c"
+      emit_profile_count(node->profile_site - 1);
+#if !X64WIN
+      if (C(tier0_function))
+        emit_tier0_count(&C(tier0_function)->backedges, TIER_UP_BACKEDGES);
+#endif
+      if (node->inc)
+        gen_expr(node->inc);
+      //| jmp =>lbegin
+      //|=>node->brk_pc_label:
+      dasm_put(Dst, 1575, lbegin, node->brk_pc_label);
+#line 2591 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_DO: {
+      int lbegin = codegen_pclabel();
+      if (!C(in_cold_section) && !(has_profile(node) && profile_count(node, 0) == 0))
+        align_code();
+      //|=>lbegin:
+      dasm_put(Dst, 0, lbegin);
+#line 2598 "../../src/codegen.in.c"
+      gen_stmt(node->then);
+      //|=>node->cont_pc_label:
+      dasm_put(Dst, 0, node->cont_pc_label);
+#line 2600 "../../src/codegen.in.c"
+      emit_profile_count(node->profile_site - 1);
+#if !X64WIN
+      if (C(tier0_function))
+        emit_tier0_count(&C(tier0_function)->backedges, TIER_UP_BACKEDGES);
+#endif
+      gen_expr(node->cond);
+      cmp_zero(node->cond->ty);
+      //| jne =>lbegin
+      //|=>node->brk_pc_label:
+      dasm_put(Dst, 1954, lbegin, node->brk_pc_label);
+#line 2609 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_SWITCH: {
+      gen_expr(node->cond);
+
+      // The most common cases are compared first, if there's a profile.
+      int num_cases = 0;
+      for (Node* n = node->case_next; n; n = n->case_next) {
+        ++num_cases;
+      }
+      Node** cases = bumpcalloc(num_cases, sizeof(Node*), AL_Compile);
+      num_cases = 0;
+      for (Node* n = node->case_next; n; n = n->case_next) {
+        int i = num_cases++;
+        for (; i > 0 && profile_count(cases[i - 1], 0) < profile_count(n, 0); --i) {
+          cases[i] = cases[i - 1];
+        }
+        cases[i] = n;
+      }
+
+      for (int i = 0; i < num_cases; ++i) {
+        Node* n = cases[i];
+        bool is_long = node->cond->ty->size == 8;
+
+#if !X64WIN
+        // Case values are ints, converted to the __int128, so the upper half
+        // has to be their sign too.
+        if (node->cond->ty->kind == TY_INT128) {
+          int lnext = codegen_pclabel();
+          int hi = n->begin < 0 ? -1 : 0;
+          if (n->begin == n->end) {
+            //| cmp rax, n->begin
+            //| jne =>lnext
+            //| cmp rdx, hi
+            //| je =>n->pc_label
+            dasm_put(Dst, 1959, n->begin, lnext, hi, n->pc_label);
+#line 2644 "../../src/codegen.in.c"
+          } else {
+            //| mov RUTIL, rax
+            //| mov r11, rdx
+            //| sub RUTIL, n->begin
+            //| sbb r11, hi
+            //| jne =>lnext
+            //| cmp RUTIL, n->end - n->begin
+            //| jbe =>n->pc_label
+            dasm_put(Dst, 1976, n->begin, hi, lnext, n->end - n->begin, n->pc_label);
+#line 2652 "../../src/codegen.in.c"
+          }
+          //|=>lnext:
+          dasm_put(Dst, 0, lnext);
+#line 2654 "../../src/codegen.in.c"
+          continue;
+        }
+#endif
+
+        if (n->begin == n->end) {
+          if (is_long) {
+            //| cmp rax, n->begin
+            dasm_put(Dst, 2003, n->begin);
+#line 2661 "../../src/codegen.in.c"
+          } else {
+            //| cmp eax, n->begin
+            dasm_put(Dst, 2004, n->begin);
+#line 2663 "../../src/codegen.in.c"
+          }
+          //| je =>n->pc_label
+          dasm_put(Dst, 1571, n->pc_label);
+#line 2665 "../../src/codegen.in.c"
+          continue;
+        }
+
+        // [GNU] Case ranges
+        if (is_long) {
+          //| mov RUTIL, rax
+          //| sub RUTIL, n->begin
+          //| cmp RUTIL, n->end - n->begin
+          dasm_put(Dst, 2009, n->begin, n->end - n->begin);
+#line 2673 "../../src/codegen.in.c"
+        } else {
+          //| mov RUTILd, eax
+          //| sub RUTILd, n->begin
+          //| cmp RUTILd, n->end - n->begin
+          dasm_put(Dst, 2023, n->begin, n->end - n->begin);
+#line 2677 "../../src/codegen.in.c"
+        }
+        //| jbe =>n->pc_label
+        dasm_put(Dst, 1999, n->pc_label);
+#line 2679 "../../src/codegen.in.c"
+      }
+
+      if (node->default_case) {
+        //| jmp =>node->default_case->pc_label
+        dasm_put(Dst, 1366, node->default_case->pc_label);
+#line 2683 "../../src/codegen.in.c"
+      }
+
+      //| jmp =>node->brk_pc_label
+      dasm_put(Dst, 1366, node->brk_pc_label);
+#line 2686 "../../src/codegen.in.c"
+      gen_stmt(node->then);
+      //|=>node->brk_pc_label:
+      dasm_put(Dst, 0, node->brk_pc_label);
+#line 2688 "../../src/codegen.in.c"
+      return;
+    }
+    case ND_CASE:
+      //|=>node->pc_label:
+      dasm_put(Dst, 0, node->pc_label);
+#line 2692 "../../src/codegen.in.c"
+      emit_profile_count(node->profile_site - 1);
+      gen_stmt(node->lhs);
+      return;
+    case ND_BLOCK:
+      for (Node* n = node->body; n; n = n->next)
+        gen_stmt(n);
+      return;
+    case ND_GOTO:
+      //| jmp =>node->pc_label
+      dasm_put(Dst, 1366, node->pc_label);
+#line 2701 "../../src/codegen.in.c"
+      return;
+    case ND_GOTO_EXPR:
+      gen_expr(node->lhs);
+      //| jmp rax
+      dasm_put(Dst, 2034);
+#line 2705 "../../src/codegen.in.c"
+      return;
+    case ND_LABEL:
+      //|=>node->pc_label:
+      dasm_put(Dst, 0, node->pc_label);
+#line 2708 "../../src/codegen.in.c"
+      gen_stmt(node->lhs);
+      return;
+    case ND_RETURN:
+      if (node->lhs) {
+        gen_expr(node->lhs);
+        Type* ty = node->lhs->ty;
+
+        switch (ty->kind) {
+          case TY_STRUCT:
+          case TY_UNION:
+            if (
+#if X64WIN
+                type_passed_in_register(ty)
+#else
+                ty->size <= 16
+#endif
+            ) {
+              copy_struct_reg();
+            } else {
+              copy_struct_mem();
+            }
+            break;
+        }
+      }
+
+      //| jmp =>C(current_fn)->dasm_return_label
+      dasm_put(Dst, 1366, C(current_fn)->dasm_return_label);
+#line 2734 "../../src/codegen.in.c"
+      return;
+    case ND_EXPR_STMT:
+      gen_expr(node->lhs);
+      return;
+    case ND_ASM:
+      error_tok(node->tok, "asm statement not supported");
+  }
+
+  error_tok(node->tok, "invalid statement");
+}
+
+// AMD64 System V ABI has a special alignment rule for an array of
+// length at least 16 bytes. We need to align such array to at least
+// 16-byte boundaries. See p.14 of
+// https://github.com/hjl-tools/x86-psABI/wiki/x86-64-psABI-draft.pdf.
+// The same is used on Windows for simplicity.
+static int lvar_slot_bottom(Obj* var, int bottom) {
+  int align =
+      (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
+  bottom += var->ty->size;
+  return (int)align_to_s(bottom, align);
+}
+
+// Assign offsets to the locals declared directly in |sc| starting below
+// |bottom|, and then to those in nested scopes. Sibling scopes can't be live at
+// the same time, so each child starts at the same bottom and they overlap.
+// Returns the deepest bottom used by |sc| and its children.
+static int assign_scope_lvar_offsets(Obj* fn, Scope* sc, int bottom) {
+  for (Obj* var = fn->locals; var; var = var->next) {
+    if (var->offset || var->scope != sc)
+      continue;
+    bottom = lvar_slot_bottom(var, bottom);
+    var->offset = -bottom;
+  }
+
+  int deepest = bottom;
+  for (Scope* child = sc->children; child; child = child->sibling) {
+    int child_bottom = assign_scope_lvar_offsets(fn, child, bottom);
+    deepest = MAX(deepest, child_bottom);
+  }
+  return deepest;
+}
+
+// Assign offsets to all locals not already placed (i.e. not stack parameters),
+// and record the frame size in stats along with what it would have been
+// without slot sharing.
+static int assign_local_offsets(Obj* fn, int bottom) {
+  int unshared = bottom;
+  for (Obj* var = fn->locals; var; var = var->next) {
+    if (!var->offset)
+      unshared = lvar_slot_bottom(var, unshared);
+  }
+
+  bottom = assign_scope_lvar_offsets(fn, fn->scope, bottom);
+
+  C(stats).frame_bytes += align_to_s(bottom, 16);
+  C(stats).frame_bytes_unshared += align_to_s(unshared, 16);
+  return bottom;
+}
+
+#if X64WIN
+
+// Assign offsets to local variables.
+static void assign_lvar_offsets(Obj* prog) {
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    // outaf("--- %s\n", fn->name);
+
+    // The parameter home area starts at 16 above rbp:
+    //   ...
+    //   stack arg 2 (6th arg)
+    //   stack arg 1 (5th arg)
+    //   R9 home
+    //   R8 home
+    //   RDX home
+    //   RCX home
+    //   return address pushed by call instr
+    //   old RBP (for the called function)  <<< RBP after push rbp; mov rbp, rsp
+    //   ...
+    //   ... stack space used by called function
+    //   ...
+    //
+    // The top of the diagram is addr 0xffffffff.. and the bottom is 0.
+    // PUSH decrements RSP and then stores.
+    // So, "top" means the highest numbered address corresponding the to root
+    // function and bottom moves to the frames for the leaf-ward functions.
+    int top = 16;
+    int bottom = 8;
+
+    int reg = 0;
+
+    // Assign offsets to pass-by-stack parameters and register homes.
+    for (Obj* var = fn->params; var; var = var->next) {
+      Type* ty = var->ty;
+
+      switch (ty->kind) {
+        case TY_STRUCT:
+        case TY_UNION:
+          if (!type_passed_in_register(ty)) {
+            // If it's too big for a register, then the value we're getting is a
+            // pointer to a copy, rather than the actual value, so flag it as
+            // such and then either assign a register or stack slot for the
+            // reference.
+            // outaf("by ref %s\n", var->name);
+            assert(var->is_param_passed_by_reference);
+          }
+
+          // If the pointer to a referenced value or the value itself can be
+          // passed in a register then assign here.
+          if (reg++ < X64WIN_REG_MAX) {
+            var->offset = top;
+            // outaf("  assigned reg offset 0x%x\n", var->offset);
+            top += 8;
+            continue;
+          }
+
+          // Otherwise fall through to the stack slot assignment below.
+          break;
+        case TY_FLOAT:
+        case TY_DOUBLE:
+          if (reg++ < X64WIN_REG_MAX) {
+            var->offset = top;
+            top += 8;
+            continue;
+          }
+          break;
+        default:
+          if (reg++ < X64WIN_REG_MAX) {
+            var->offset = top;
+            top += 8;
+            // outaf("int reg %s at home 0x%x\n", var->name, var->offset);
+            continue;
+          }
+      }
+
+      var->offset = top;
+      // outaf("int stack %s at stack 0x%x\n", var->name, var->offset);
+      if (var->is_param_passed_by_reference) {
+        top += 8;
+      } else {
+        top += MAX(8, var->ty->size);
+      }
+    }
+
+    // Assign offsets to local variables.
+    bottom = assign_local_offsets(fn, bottom);
+
+    fn->stack_size = (int)align_to_s(bottom, 16);
+  }
+}
+
+#else  // SysV
+
+// Assign offsets to local variables.
+static void assign_lvar_offsets(Obj* prog) {
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function)
+      continue;
+
+    // If a function has many parameters, some parameters are
+    // inevitably passed by stack rather than by register.
+    // The first passed-by-stack parameter resides at RBP+16.
+    int top = 16;
+    int bottom = 0;
+
+    int gp = 0, fp = 0;
+
+    // Assign offsets to pass-by-stack parameters.
+    for (Obj* var = fn->params; var; var = var->next) {
+      Type* ty = var->ty;
+
+      switch (ty->kind) {
+        case TY_STRUCT:
+        case TY_UNION:
+          if (ty->size <= 8) {
+            bool fp1 = has_flonum(ty, 0, 8, 0);
+            if (fp + fp1 < SYSV_FP_MAX && gp + !fp1 < SYSV_GP_MAX) {
+              fp = fp + fp1;
+              gp = gp + !fp1;
+              continue;
+            }
+          } else if (ty->size <= 16) {
+            bool fp1 = has_flonum(ty, 0, 8, 0);
+            bool fp2 = has_flonum(ty, 8, 16, 8);
+            if (fp + fp1 + fp2 < SYSV_FP_MAX && gp + !fp1 + !fp2 < SYSV_GP_MAX) {
+              fp = fp + fp1 + fp2;
+              gp = gp + !fp1 + !fp2;
+              continue;
+            }
+          }
+          break;
+        case TY_FLOAT:
+        case TY_DOUBLE:
+          if (fp++ < SYSV_FP_MAX)
+            continue;
+          break;
+        case TY_LDOUBLE:
+          break;
+        case TY_INT128:
+          if (gp + 2 <= SYSV_GP_MAX) {
+            gp += 2;
+            continue;
+          }
+          break;
+        default:
+          if (gp++ < SYSV_GP_MAX)
+            continue;
+      }
+
+      // rbp+16 is 16 byte aligned, as the caller's rsp was.
+      top = align_to_s(top, ty->kind == TY_INT128 ? 16 : 8);
+      var->offset = top;
+      top += var->ty->size;
+    }
+
+    // Assign offsets to pass-by-register parameters and local variables.
+    if (fn->is_definition && fn->is_live) {
+      bottom = assign_local_offsets(fn, bottom);
+      if (user_context->instrument_cycles && is_instrumented(fn)) {
+        bottom = align_to_s(bottom, 8) + 8;
+        fn->instrument_tsc_offset = -bottom;
+      }
+    }
+
+    fn->stack_size = align_to_s(bottom, 16);
+  }
+}
+
+#endif  // SysV
+
+static void linkfixup_push(FileLinkData* fld, char* target, char* fixup, int addend) {
+  if (!fld->fixups) {
+    fld->fixups = calloc(8, sizeof(LinkFixup));
+    fld->fcap = 8;
+  }
+
+  if (fld->fcap == fld->flen) {
+    fld->fixups = realloc(fld->fixups, sizeof(LinkFixup) * fld->fcap * 2);
+    fld->fcap *= 2;
+  }
+
+  fld->fixups[fld->flen++] = (LinkFixup){fixup, strdup(target), addend};
+}
+
+static int data_object_alignment(Obj* var) {
+  return (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
+}
+
+// Allocates data object |name| in global_data[idx], and returns it to be
+// initialized. Returns NULL if it's writable and already exists, in which case
+// it keeps its current contents. Global data is shared between files, so this
+// must be called with compile_mutex held.
+static char* create_data_object(size_t idx, char* name, bool is_rodata, int size, int align) {
+  // - rodata, always free existing entry in either static/extern
+  // global_data, and then recreate and reinitialize
+  //
+  // - if writeable data has an entry, it shouldn't be recreated. the
+  // dyo version doesn't reprocess kTypeInitializerDataRelocation or
+  // kTypeInitializerCodeRelocation; that's possibly a bug, but it'll
+  // need some testing to get a case where it comes up.
+  //
+  // TODO: if it changes from static to extern, is it the same
+  // variable? currently they're separate, so a switch causes a
+  // reinit, a leak, and some confusion.
+  //
+  // can't easily make a large single data segment allocation for all
+  // data because 1) the rodata change size link-over-link (put in
+  // codeseg?); 2) wdata don't move or reinit, but new ones get added
+  // as code evolves and we can't blow away or move the old ones.
+  //
+  // for now, just continue with individual regular aligned_allocate
+  // for all data objects and maintain their addresses here.
+
+  UserContext* uc = user_context;
+  // bool was_freed = false;
+  void* prev = hashmap_get(&uc->global_data[idx], name);
+  if (prev) {
+    if (is_rodata) {
+      retire_aligned(prev, size);
+      // was_freed = true;
+    } else {
+      // data already created and initialized, don't reinit.
+      return NULL;
+    }
+  }
+
+  void* global_data = aligned_allocate(size, align);
+  memset(global_data, 0, size);
+
+  // TODO: Is this wrong (or above)? If writable |x| in one file
+  // already existed and |x| in another is added, then it'll be
+  // silently ignored. If it's rodata it'll be silently replaced here
+  // by getting thrown away above and then recreated.
+  // Need to figure out where/how to have a duplicate symbol check.
+#if 0
+    if (!was_freed) {
+      void* prev = hashmap_get(&uc->global_data[idx], strings.data[name_index]);
+      if (prev) {
+        outaf("duplicated symbol: %s\n", strings.data[name_index]);
+        goto fail;
+      }
+    }
+#endif
+  // TODO: intern
+  hashmap_put(&uc->global_data[idx], strdup(name), global_data);
+  return global_data;
+}
+
+IMPLSTATIC void free_data_objects(FileLinkData* fld) {
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    free(obj->name);
+    free(obj->init_data);
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      free(obj->relocs[j].name);
+    }
+    free(obj->relocs);
+  }
+  free(fld->data_objects);
+  fld->data_objects = NULL;
+  fld->num_data_objects = 0;
+}
+
+// Records the data objects defined by |prog|, replacing those from the file's
+// previous compile.
+static void update_data_objects(Obj* prog, FileLinkData* fld) {
+  free_data_objects(fld);
+
+  int num_data_objects = 0;
+  for (Obj* var = prog; var; var = var->next) {
+    if (!var->is_function && var->is_definition)
+      ++num_data_objects;
+  }
+  fld->data_objects = calloc(num_data_objects + 1, sizeof(DataObject));
+
+  for (Obj* var = prog; var; var = var->next) {
+    if (var->is_function || !var->is_definition)
+      continue;
+
+    DataObject* obj = &fld->data_objects[fld->num_data_objects++];
+    obj->name = strdup(var->name);
+    obj->is_static = var->is_static;
+    obj->is_rodata = var->is_rodata;
+    obj->size = var->ty->size;
+    obj->align = data_object_alignment(var);
+
+    // If no init_data, it's .bss and only needs to be cleared.
+    if (!var->init_data)
+      continue;
+    obj->init_data = malloc(obj->size);
+    memcpy(obj->init_data, var->init_data, obj->size);
+
+    int num_relocs = 0;
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      ++num_relocs;
+    }
+    obj->relocs = calloc(num_relocs + 1, sizeof(DataReloc));
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      assert(!(rel->string_label && rel->internal_code_label));  // Shouldn't be both.
+      assert(rel->string_label ||
+             rel->internal_code_label);  // But should be at least one if we're here.
+
+      DataReloc* dr = &obj->relocs[obj->num_relocs++];
+      dr->offset = rel->offset;
+      dr->addend = (int)rel->addend;
+      if (rel->string_label)
+        dr->name = strdup(*rel->string_label);
+      else
+        dr->code_offset = dasm_getpclabel(&C(dynasm), *rel->internal_code_label);
+    }
+  }
+}
+
+// Creates the file's data objects, and the fixups for the pointers in their
+// initializers. |codeseg_base_address| is where the code that was emitted
+// along with them starts, for any that point into it.
+IMPLSTATIC void install_data_objects(size_t file_index, char* codeseg_base_address) {
+  UserContext* uc = user_context;
+  FileLinkData* fld = &uc->files[file_index];
+  free_link_fixups(fld);
+
+  // Global data is shared with other files being compiled at the same time.
+  mutex_lock(uc->compile_mutex);
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    size_t idx = obj->is_static ? file_index : uc->num_files;
+    char* fillp = create_data_object(idx, obj->name, obj->is_rodata, obj->size, obj->align);
+    if (!fillp || !obj->init_data)
+      continue;
+
+    // .data or .tdata
+    memcpy(fillp, obj->init_data, obj->size);
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      DataReloc* dr = &obj->relocs[j];
+      if (dr->name) {
+        linkfixup_push(fld, dr->name, fillp + dr->offset, dr->addend);
+      } else {
+        uintptr_t address = (uintptr_t)(codeseg_base_address + dr->code_offset + dr->addend);
+        memcpy(fillp + dr->offset, &address, sizeof(address));
+      }
+    }
+  }
+  mutex_unlock(uc->compile_mutex);
+}
+
+static void store_fp(int r, int offset, int sz) {
+  switch (sz) {
+    case 4:
+      //| movss dword [rbp+offset], xmm(r)
+      dasm_put(Dst, 734, (r), offset);
+#line 3145 "../../src/codegen.in.c"
+      return;
+    case 8:
+      //| movsd qword [rbp+offset], xmm(r)
+      dasm_put(Dst, 745, (r), offset);
+#line 3148 "../../src/codegen.in.c"
+      return;
+  }
+  unreachable();
+}
+
+static void store_gp(int r, int offset, int sz) {
+  switch (sz) {
+    case 1:
+      //| mov [rbp+offset], Rb(dasmargreg[r])
+      dasm_put(Dst, 2038, (dasmargreg[r]), offset);
+#line 3157 "../../src/codegen.in.c"
+      return;
+    case 2:
+      //| mov [rbp+offset], Rw(dasmargreg[r])
+      dasm_put(Dst, 2046, (dasmargreg[r]), offset);
+#line 3160 "../../src/codegen.in.c"
+      return;
+      return;
+    case 4:
+      //| mov [rbp+offset], Rd(dasmargreg[r])
+      dasm_put(Dst, 2047, (dasmargreg[r]), offset);
+#line 3164 "../../src/codegen.in.c"
+      return;
+    case 8:
+      //| mov [rbp+offset], Rq(dasmargreg[r])
+      dasm_put(Dst, 2055, (dasmargreg[r]), offset);
+#line 3167 "../../src/codegen.in.c"
+      return;
+    default:
+      for (int i = 0; i < sz; i++) {
+        //| mov [rbp+offset+i], Rb(dasmargreg[r])
+        //| shr Rq(dasmargreg[r]), 8
+        dasm_put(Dst, 756, (dasmargreg[r]), offset+i, (dasmargreg[r]));
+#line 3172 "../../src/codegen.in.c"
+      }
+      return;
+  }
+}
+
+#if X64WIN
+extern int __chkstk(void);
+#endif  // X64WIN
+
+static void emit_function(Obj* fn) {
+  fn->symbol_refs_begin = C(symbol_refs).len;
+  fn->file_line_label_data = (IntIntIntArray){0};
+
+  align_code();
+  //|=>fn->dasm_entry_label:
+  dasm_put(Dst, 0, fn->dasm_entry_label);
+#line 3187 "../../src/codegen.in.c"
+
+#if !X64WIN
+  if (C(tier0_function))
+    emit_tier0_count(&C(tier0_function)->calls, TIER_UP_CALLS);
+#endif
+
+  fn->dasm_cold_label = codegen_pclabel();
+  //| .cold
+  dasm_put(Dst, 1364);
+#line 3195 "../../src/codegen.in.c"
+  //|=>fn->dasm_cold_label:
+  //| .code
+  dasm_put(Dst, 2063, fn->dasm_cold_label);
+#line 3197 "../../src/codegen.in.c"
+
+  C(current_fn) = fn;
+  C(profile) = find_profile(C(file_index), fn);
+  if (user_context->profile_branches && fn->num_profile_sites && !fn->profile_counts) {
+    fn->profile_counts = aligned_allocate(fn->num_profile_sites * sizeof(uint64_t), 8);
+    memset(fn->profile_counts, 0, fn->num_profile_sites * sizeof(uint64_t));
+  }
+#if !X64WIN
+  if (is_instrumented(fn)) {
+    // The hooks and counts are referred to by their addresses in this process.
+    fn->is_process_specific = true;
+    if (user_context->instrument_cycles && !fn->instrument_counts) {
+      fn->instrument_counts = aligned_allocate(2 * sizeof(uint64_t), 8);
+      memset(fn->instrument_counts, 0, 2 * sizeof(uint64_t));
+    }
+  }
+#endif
+
+  if (wants_line_info())
+    record_line_syminfo(fn->ty->name->file->file_no, fn->ty->name->line_no, codegen_pclabel());
+
+  // outaf("---- %s\n", fn->name);
+
+  // Prologue
+  fn->dasm_prologue_label = codegen_pclabel();
+  //|=>fn->dasm_prologue_label:
+  //| push rbp
+  //| mov rbp, rsp
+  dasm_put(Dst, 2066, fn->dasm_prologue_label);
+#line 3225 "../../src/codegen.in.c"
+
+#if X64WIN
+  // Stack probe on Windows if necessary. The MSDN reference for __chkstk says
+  // it's only necessary beyond 8k for x64, but cl does it at 4k.
+  if (fn->stack_size >= 4096) {
+    //| mov rax, fn->stack_size
+    dasm_put(Dst, 1421, fn->stack_size);
+#line 3231 "../../src/codegen.in.c"
+    load_symbol_address(REG_R10, "__chkstk");
+    //| call r10
+    //| sub rsp, rax
+    dasm_put(Dst, 2072);
+#line 3234 "../../src/codegen.in.c"
+
+    // TODO: pdata emission
+  } else
+#endif
+
+  {
+    //| sub rsp, fn->stack_size
+    dasm_put(Dst, 673, fn->stack_size);
+#line 3241 "../../src/codegen.in.c"
+
+    // TODO: add a label here to assert that the prolog size is as expected
+
+#if X64WIN
+    // RtlAddFunctionTable() requires these to be at an offset with the same
+    // base as the function offsets, so we need to emit these into the main
+    // codeseg allocation, rather than just allocating them separately, since
+    // we can't easily guarantee a <4G offset to them otherwise.
+
+    // Unfortunately, we can't build another section with this as dynasm
+    // doesn't seem to allow resolving these offsets, so this is done later
+    //| .dword =>fn->dasm_entry_label
+    //| .dword =>fn->dasm_end_of_function_label
+    //| .dword =>fn->dasm_unwind_info_label
+
+    // TODO: probably info about rdi pushed for memsets.
+
+    // https://learn.microsoft.com/en-us/cpp/build/exception-handling-x64?view=msvc-170
+    enum {
+      UWOP_PUSH_NONVOL = 0,
+      UWOP_ALLOC_LARGE = 1,
+      UWOP_ALLOC_SMALL = 2,
+      UWOP_SET_FPREG = 3,
+    };
+
+    // These are the UNWIND_INFO structure that is referenced by the third
+    // element of RUNTIME_FUNCTION.
+    //| .pdata
+    dasm_put(Dst, 2080);
+#line 3269 "../../src/codegen.in.c"
+    // This takes care of cases where CountOfCodes is odd.
+    //| .align 4
+    //|=>fn->dasm_unwind_info_label:
+    //| .byte 1  /* Version:3 (1) and Flags:5 (0) */
+    dasm_put(Dst, 2082, fn->dasm_unwind_info_label, 1  /* Version:3 (1) and Flags:5 (0) */);
+#line 3273 "../../src/codegen.in.c"
+    bool small_stack = fn->stack_size / 8 - 1 <= 15;
+    if (small_stack) {
+      // We just happen to "know" this is the form used for small stack sizes.
+      // xxxxxxxxxxxx0000 55                   push        rbp
+      // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
+      // xxxxxxxxxxxx0004 48 83 EC 10          sub         rsp,10h
+      // xxxxxxxxxxxx0009 ...
+      //| .byte 8  /* SizeOfProlog */
+      //| .byte 3  /* CountOfCodes */
+      dasm_put(Dst, 2087, 8  /* SizeOfProlog */, 3  /* CountOfCodes */);
+#line 3282 "../../src/codegen.in.c"
+    } else {
+      // And this one for larger reservations.
+      // xxxxxxxxxxxx0000 55                   push        rbp
+      // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
+      // xxxxxxxxxxxx0004 48 81 EC B0 01 00 00 sub         rsp,1B0h
+      // xxxxxxxxxxxx000b ...
+      //| .byte 11  /* SizeOfProlog */
+      //| .byte 4  /* CountOfCodes */
+      dasm_put(Dst, 2087, 11  /* SizeOfProlog */, 4  /* CountOfCodes */);
+#line 3290 "../../src/codegen.in.c"
+    }
+    //| .byte 5  /* FrameRegister:4 (RBP) | FrameOffset:4: 0 offset */
+    dasm_put(Dst, 1491, 5  /* FrameRegister:4 (RBP) | FrameOffset:4: 0 offset */);
+#line 3292 "../../src/codegen.in.c"
+
+    if (small_stack) {
+      //| .byte 8  /* CodeOffset */
+      //| .byte UWOP_ALLOC_SMALL | (((unsigned char)((fn->stack_size / 8) - 1)) << 4)
+      dasm_put(Dst, 2087, 8  /* CodeOffset */, UWOP_ALLOC_SMALL | (((unsigned char)((fn->stack_size / 8) - 1)) << 4));
+#line 3296 "../../src/codegen.in.c"
+    } else {
+      //| .byte 11  /* CodeOffset */
+      dasm_put(Dst, 1491, 11  /* CodeOffset */);
+#line 3298 "../../src/codegen.in.c"
+      assert(fn->stack_size / 8 <= 65535 && "todo; not UWOP_ALLOC_LARGE 0-style");
+      //| .byte UWOP_ALLOC_LARGE
+      //| .word fn->stack_size / 8
+      dasm_put(Dst, 2090, UWOP_ALLOC_LARGE, fn->stack_size / 8);
+#line 3301 "../../src/codegen.in.c"
+    }
+    //| .byte 4  /* CodeOffset */
+    //| .byte UWOP_SET_FPREG
+    //| .byte 1  /* CodeOffset */
+    //| .byte UWOP_PUSH_NONVOL | (5 /* RBP */ << 4)
+    dasm_put(Dst, 2093, 4  /* CodeOffset */, UWOP_SET_FPREG, 1  /* CodeOffset */, UWOP_PUSH_NONVOL | (5 /* RBP */ << 4));
+#line 3306 "../../src/codegen.in.c"
+
+    //| .code
+    dasm_put(Dst, 1370);
+#line 3308 "../../src/codegen.in.c"
+#endif
+  }
+
+  //| mov [rbp+fn->alloca_bottom->offset], rsp
+  dasm_put(Dst, 2098, fn->alloca_bottom->offset);
+#line 3312 "../../src/codegen.in.c"
+
+#if !X64WIN
+  // Save arg registers if function is variadic
+  if (fn->va_area) {
+    int gp = 0, fp = 0;
+    for (Obj* var = fn->params; var; var = var->next) {
+      if (is_flonum(var->ty))
+        fp++;
+      else if (var->ty->kind == TY_INT128)
+        gp += 2;
+      else
+        gp++;
+    }
+
+    int off = fn->va_area->offset;
+
+    // va_elem
+    //| mov dword [rbp+off], gp*8            // gp_offset
+    //| mov dword [rbp+off+4], fp * 8 + 48   // fp_offset
+    //| mov [rbp+off+8], rbp                 // overflow_arg_area
+    //| add qword [rbp+off+8], 16
+    //| mov [rbp+off+16], rbp                // reg_save_area
+    //| add qword [rbp+off+16], off+24
+    dasm_put(Dst, 2103, off, gp*8, off+4, fp * 8 + 48, off+8, off+8, off+16, off+16, off+24);
+#line 3335 "../../src/codegen.in.c"
+
+    // __reg_save_area__
+    //| mov [rbp + off + 24], rdi
+    //| mov [rbp + off + 32], rsi
+    //| mov [rbp + off + 40], rdx
+    //| mov [rbp + off + 48], rcx
+    //| mov [rbp + off + 56], r8
+    //| mov [rbp + off + 64], r9
+    //| movsd qword [rbp + off + 72], xmm0
+    //| movsd qword [rbp + off + 80], xmm1
+    //| movsd qword [rbp + off + 88], xmm2
+    //| movsd qword [rbp + off + 96], xmm3
+    //| movsd qword [rbp + off + 104], xmm4
+    //| movsd qword [rbp + off + 112], xmm5
+    //| movsd qword [rbp + off + 120], xmm6
+    //| movsd qword [rbp + off + 128], xmm7
+    dasm_put(Dst, 2130, off + 24, off + 32, off + 40, off + 48, off + 56, off + 64, off + 72, off + 80, off + 88, off + 96, off + 104, off + 112, off + 120, off + 128);
+#line 3351 "../../src/codegen.in.c"
+  }
+#endif
+
+#if X64WIN
+  // If variadic, we have to store all registers; floats will have been
+  // duplicated into the integer registers.
+  if (fn->ty->is_variadic) {
+    //| mov [rbp + 16], CARG1
+    //| mov [rbp + 24], CARG2
+    //| mov [rbp + 32], CARG3
+    //| mov [rbp + 40], CARG4
+    dasm_put(Dst, 2203, 16, 24, 32, 40);
+#line 3362 "../../src/codegen.in.c"
+  } else {
+    // Save passed-by-register arguments to the stack
+    int reg = 0;
+    for (Obj* var = fn->params; var; var = var->next) {
+      if (var->offset >= 16 + PARAMETER_SAVE_SIZE)
+        continue;
+
+      Type* ty = var->ty;
+
+      switch (ty->kind) {
+        case TY_STRUCT:
+        case TY_UNION:
+          // It's either small and so passed in a register, or isn't and then
+          // we're instead storing the pointer to the larger struct.
+          if (type_passed_in_register(ty)) {
+            store_gp(reg++, var->offset, ty->size);
+          } else {
+            store_gp(reg++, var->offset, 8);
+          }
+          break;
+        case TY_FLOAT:
+        case TY_DOUBLE:
+          store_fp(reg++, var->offset, ty->size);
+          break;
+        default:
+          store_gp(reg++, var->offset, ty->size);
+          break;
+      }
+    }
+  }
+#else
+  // Save passed-by-register arguments to the stack
+  int gp = 0, fp = 0;
+  for (Obj* var = fn->params; var; var = var->next) {
+    if (var->offset > 0)
+      continue;
+
+    Type* ty = var->ty;
+
+    switch (ty->kind) {
+      case TY_STRUCT:
+      case TY_UNION:
+        assert(ty->size <= 16);
+        if (has_flonum(ty, 0, 8, 0))
+          store_fp(fp++, var->offset, MIN(8, ty->size));
+        else
+          store_gp(gp++, var->offset, MIN(8, ty->size));
+
+        if (ty->size > 8) {
+          if (has_flonum(ty, 8, 16, 0))
+            store_fp(fp++, var->offset + 8, ty->size - 8);
+          else
+            store_gp(gp++, var->offset + 8, ty->size - 8);
+        }
+        break;
+      case TY_FLOAT:
+      case TY_DOUBLE:
+        store_fp(fp++, var->offset, ty->size);
+        break;
+      case TY_INT128:
+        store_gp(gp++, var->offset, 8);
+        store_gp(gp++, var->offset + 8, 8);
+        break;
+      default:
+        store_gp(gp++, var->offset, ty->size);
+    }
+  }
+#endif
+
+#if !X64WIN
+  if (is_instrumented(fn))
+    emit_instrument_enter(fn);
+#endif
+
+  // Emit code
+  gen_stmt(fn->body);
+  assert(C(depth) == 0);
+
+  // [https://www.sigbus.info/n1570#5.1.2.2.3p1] The C spec defines
+  // a special rule for the main function. Reaching the end of the
+  // main function is equivalent to returning 0, even though the
+  // behavior is undefined for the other functions.
+  if (strcmp(fn->name, "main") == 0) {
+    //| mov rax, 0
+    dasm_put(Dst, 786);
+#line 3446 "../../src/codegen.in.c"
+  }
+
+  // Epilogue
+  //|=>fn->dasm_return_label:
+  dasm_put(Dst, 0, fn->dasm_return_label);
+#line 3450 "../../src/codegen.in.c"
+#if !X64WIN
+  if (is_instrumented(fn))
+    emit_instrument_exit(fn);
+#endif
+#if X64WIN
+  // https://learn.microsoft.com/en-us/cpp/build/prolog-and-epilog?view=msvc-170#epilog-code
+  // says this the required form to recognize an epilog.
+  //| lea rsp, [rbp]
+  dasm_put(Dst, 2220);
+#line 3458 "../../src/codegen.in.c"
+#else
+  //| mov rsp, rbp
+  dasm_put(Dst, 2225);
+#line 3460 "../../src/codegen.in.c"
+#endif
+  //| pop rbp
+  dasm_put(Dst, 1236);
+#line 3462 "../../src/codegen.in.c"
+  fn->dasm_epilogue_ret_label = codegen_pclabel();
+  //|=>fn->dasm_epilogue_ret_label:
+  //| ret
+  dasm_put(Dst, 2230, fn->dasm_epilogue_ret_label);
+#line 3465 "../../src/codegen.in.c"
+
+  //|=>fn->dasm_end_of_function_label:
+  dasm_put(Dst, 0, fn->dasm_end_of_function_label);
+#line 3467 "../../src/codegen.in.c"
+  fn->dasm_end_of_cold_label = codegen_pclabel();
+  //| .cold
+  dasm_put(Dst, 1364);
+#line 3469 "../../src/codegen.in.c"
+  //|=>fn->dasm_end_of_cold_label:
+  //| .code
+  dasm_put(Dst, 2063, fn->dasm_end_of_cold_label);
+#line 3471 "../../src/codegen.in.c"
+
+  fn->symbol_refs_end = C(symbol_refs).len;
+}
+
+#if !X64WIN
+// The code that lazy functions' stubs initially jump to, with the address of
+// the function's LazyFunction in r11. Compiles the function, and then
+// continues into it with the argument registers as they were.
+static void emit_lazy_thunk(void) {
+  C(lazy_thunk_label) = codegen_pclabel();
+  align_code();
+  //|=>C(lazy_thunk_label):
+  dasm_put(Dst, 0, C(lazy_thunk_label));
+#line 3483 "../../src/codegen.in.c"
+  emit_call_preserving_args((void*)compile_lazy_function);
+  //| jmp r11
+  dasm_put(Dst, 2233);
+#line 3485 "../../src/codegen.in.c"
+}
+
+// Emits a stub in place of |fn|'s code, that jumps through its LazyFunction's
+// target.
+static void emit_lazy_stub(Obj* fn) {
+  LazyFunction* lf = bumpcalloc(1, sizeof(LazyFunction), AL_Compile);
+  lf->fn = fn;
+  lf->file = C(lazy_file);
+  lf->next = C(lazy_file)->functions;
+  C(lazy_file)->functions = lf;
+  fn->lazy = lf;
+
+  fn->symbol_refs_begin = fn->symbol_refs_end = C(symbol_refs).len;
+  align_code();
+  //|=>fn->dasm_entry_label:
+  //| mov64 r11, (uintptr_t)lf
+  //| jmp qword [r11]
+  //|=>fn->dasm_end_of_function_label:
+  dasm_put(Dst, 2238, fn->dasm_entry_label, (unsigned int)((uintptr_t)lf), (unsigned int)(((uintptr_t)lf)>>32), fn->dasm_end_of_function_label);
+#line 3503 "../../src/codegen.in.c"
+}
+
+// In lazy_compilation (or tiered_compilation) mode, starts the LazyFile that the file's functions will
+// be compiled from.
+static void start_lazy_file(Obj* prog) {
+  if (!user_context->lazy_compilation && !user_context->tiered_compilation)
+    return;
+
+  bool any = false;
+  for (Obj* var = prog; var; var = var->next) {
+    // Labels taken as values in data initializers have to be in the code
+    // emitted along with the data.
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      if (rel->internal_code_label)
+        return;
+    }
+    if (var->is_function && var->is_definition && var->is_live && !var->reused_code)
+      any = true;
+  }
+  if (!any)
+    return;
+
+  C(lazy_file) = bumpcalloc(1, sizeof(LazyFile), AL_Compile);
+  C(lazy_file)->ctx = user_context;
+  C(lazy_file)->file_index = C(file_index);
+  C(lazy_file)->files = compiler_state.tokenize__all_tokenized_files;
+}
+#endif
+
+static void emit_text(Obj* prog) {
+  // Preallocate the dasm labels so they can be used in functions out of order.
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live || fn->reused_code)
+      continue;
+
+    fn->dasm_return_label = codegen_pclabel();
+    fn->dasm_entry_label = codegen_pclabel();
+    fn->dasm_end_of_function_label = codegen_pclabel();
+    fn->dasm_unwind_info_label = codegen_pclabel();
+  }
+
+  //| .code
+  dasm_put(Dst, 1370);
+#line 3545 "../../src/codegen.in.c"
+
+#if !X64WIN
+  if (C(lazy_file))
+    emit_lazy_thunk();
+#endif
+
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live || fn->reused_code)
+      continue;
+
+#if !X64WIN
+    if (C(lazy_file)) {
+      emit_lazy_stub(fn);
+      continue;
+    }
+#endif
+    double trace_start = trace_begin();
+    emit_function(fn);
+    trace_end(trace_start, "emit function", fn->name);
+  }
+}
+
+IMPLSTATIC void free_link_fixups(FileLinkData* fld) {
+  for (int i = 0; i < fld->flen; ++i) {
+    free(fld->fixups[i].name);
+  }
+  free(fld->fixups);
+  fld->fixups = NULL;
+  fld->flen = 0;
+  fld->fcap = 0;
+}
+
+static void free_function_code_record(FunctionCode* fc) {
+  free(fc->name);
+  free(fc->slots);
+  free(fc->slot_refs);
+  if (fc->profile_counts)
+    aligned_free(fc->profile_counts);
+  if (fc->instrument_counts)
+    aligned_free(fc->instrument_counts);
+}
+
+IMPLSTATIC void free_function_code(FileLinkData* fld) {
+  for (int i = 0; i < fld->num_functions; ++i) {
+    free_function_code_record(&fld->functions[i]);
+  }
+  free(fld->functions);
+  fld->functions = NULL;
+  fld->num_functions = 0;
+
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    free_executable_memory(fld->chunks[i].base_address, fld->chunks[i].size);
+  }
+  free(fld->chunks);
+  fld->chunks = NULL;
+  fld->num_chunks = 0;
+
+  free_lazy_file(fld->lazy);
+  fld->lazy = NULL;
+}
+
+static bool chunk_contains(CodeChunk* chunk, char* address) {
+  return address >= chunk->base_address && address < chunk->base_address + chunk->size;
+}
+
+// Marks the functions whose code from the previous update can be used as is,
+// i.e. those with the same name and code_hash (and lines, if there's line
+// info) as before. Everything else in
+// the file is referenced through symbol slots, so that code doesn't depend
+// on where the rest of the file ends up.
+static void find_reusable_code(Obj* prog, FileLinkData* fld) {
+#if X64WIN
+  // Functions refer to each other by label and the unwind tables are built for
+  // a single code segment, so everything is compiled each time.
+  (void)prog;
+  (void)fld;
+#else
+  // Labels taken as values in data initializers are only known while the code
+  // that contains them is being emitted.
+  for (Obj* var = prog; var; var = var->next) {
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      if (rel->internal_code_label)
+        return;
+    }
+  }
+
+  HashMap previous = {0};
+  for (int i = 0; i < fld->num_functions; ++i) {
+    hashmap_put(&previous, fld->functions[i].name, &fld->functions[i]);
+  }
+
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    // Stubs for lazy functions go with the file's previous LazyFile. The line
+    // info registered for the code stays as it was, so it's only reused if
+    // the function's lines are too.
+    FunctionCode* fc = hashmap_get(&previous, fn->name);
+    if (fc && fc->hash == fn->code_hash && !fc->lazy &&
+        (!wants_line_info() || fc->line_hash == fn->line_hash))
+      fn->reused_code = fc;
+  }
+
+  // If only a little of an old chunk is still in use, recompile what's left in
+  // it instead, so that the chunk can be released rather than accumulating
+  // mostly dead code over many updates.
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    CodeChunk* chunk = &fld->chunks[i];
+    size_t used = 0;
+    for (Obj* fn = prog; fn; fn = fn->next) {
+      if (fn->is_function && fn->reused_code && chunk_contains(chunk, fn->reused_code->address))
+        used += fn->reused_code->size;
+    }
+    if (used * 4 >= chunk->code_size)
+      continue;
+    for (Obj* fn = prog; fn; fn = fn->next) {
+      if (fn->is_function && fn->reused_code && chunk_contains(chunk, fn->reused_code->address))
+        fn->reused_code = NULL;
+    }
+  }
+#endif
+}
+
+// Called with lazy_mutex and compile_mutex held when the file's function
+// records are replaced. Threads may still be running in the stubs and compiled code, so
+// it's all released once they're done with it.
+static void retire_lazy_file(LazyFile* lazy) {
+  HeapData heap = lazy->heap;
+  lazy->is_retired = true;
+  LazyFunction** prev = &lazy->ctx->promotion_queue;
+  while (*prev) {
+    if ((*prev)->file == lazy)
+      *prev = (*prev)->next_promotion;
+    else
+      prev = &(*prev)->next_promotion;
+  }
+  for (LazyFunction* lf = lazy->functions; lf; lf = lf->next) {
+    if (lf->code.size)
+      retire_executable_memory(lf->code.base_address, lf->code.size);
+  }
+  retire_executable_memory(heap.base, heap.size);
+}
+
+IMPLSTATIC void free_lazy_file(LazyFile* lazy) {
+  if (!lazy)
+    return;
+  HeapData heap = lazy->heap;
+  for (LazyFunction* lf = lazy->functions; lf; lf = lf->next) {
+    if (lf->code.size)
+      free_executable_memory(lf->code.base_address, lf->code.size);
+  }
+  free_executable_memory(heap.base, heap.size);
+}
+// Replaces the file's function records with |functions|, and its chunks with
+// those of its current ones and |new_chunks| that hold code for any of them.
+// Records and chunks that are no longer needed are freed.
+IMPLSTATIC void replace_function_code(FileLinkData* fld,
+                                      FunctionCode* functions,
+                                      int num_functions,
+                                      CodeChunk* new_chunks,
+                                      int num_new_chunks) {
+  mutex_lock(user_context->lazy_mutex);
+  mutex_lock(user_context->compile_mutex);
+  if (fld->lazy) {
+    retire_lazy_file(fld->lazy);
+    fld->lazy = NULL;
+  }
+  mutex_unlock(user_context->compile_mutex);
+  mutex_unlock(user_context->lazy_mutex);
+
+  for (int i = 0; i < fld->num_functions; ++i) {
+    // Other threads may still be running the old code, which writes these.
+    FunctionCode* fc = &fld->functions[i];
+    if (fc->profile_counts)
+      retire_aligned(fc->profile_counts, fc->num_profile_counts * sizeof(uint64_t));
+    fc->profile_counts = NULL;
+    if (fc->instrument_counts)
+      retire_aligned(fc->instrument_counts, 2 * sizeof(uint64_t));
+    fc->instrument_counts = NULL;
+    free_function_code_record(fc);
+  }
+  free(fld->functions);
+  fld->functions = functions;
+  fld->num_functions = num_functions;
+
+  mutex_lock(user_context->compile_mutex);
+  for (int i = 0; i < fld->num_used_slots; ++i) {
+    fld->used_slots[i]->in_use = false;
+  }
+  fld->num_used_slots = 0;
+  for (int i = 0; i < num_functions; ++i) {
+    for (int j = 0; j < functions[i].num_slots; ++j) {
+      use_symbol_slot(fld, functions[i].slots[j]);
+    }
+  }
+  fld->link_all_slots = true;
+  mutex_unlock(user_context->compile_mutex);
+
+  CodeChunk* chunks = calloc(fld->num_chunks + num_new_chunks + 1, sizeof(CodeChunk));
+  int num_chunks = 0;
+  for (int i = 0; i < fld->num_chunks + num_new_chunks; ++i) {
+    CodeChunk* c = i < fld->num_chunks ? &fld->chunks[i] : &new_chunks[i - fld->num_chunks];
+    if (!c->base_address)
+      continue;
+    bool in_use = false;
+    for (int j = 0; j < num_functions && !in_use; ++j) {
+      in_use = chunk_contains(c, functions[j].address);
+    }
+    if (in_use) {
+      chunks[num_chunks++] = *c;
+    } else {
+      // Other threads may still be running the old code.
+      retire_executable_memory(c->base_address, c->size);
+    }
+  }
+  free(fld->chunks);
+  fld->chunks = chunks;
+  fld->num_chunks = num_chunks;
+
+  // The exports are replaced when this is linked.
+  fld->exports_pending = true;
+}
+
+// Describes the code emitted for |fn|, which is only a lazy stub if
+// |is_stub|.
+static JitCode jit_code(Obj* fn, char* base_address, FilePtrArray* files, bool is_stub) {
+  int entry = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+  int end = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label);
+  JitCode code = {fn->name, base_address + entry, end - entry, -1, -1, NULL, 0, NULL, 0};
+  if (!is_stub) {
+    code.frame_offset = dasm_getpclabel(&C(dynasm), fn->dasm_prologue_label) - entry;
+    code.ret_offset = dasm_getpclabel(&C(dynasm), fn->dasm_epilogue_ret_label) - entry;
+    int cold = dasm_getpclabel(&C(dynasm), fn->dasm_cold_label);
+    code.cold_address = base_address + cold;
+    code.cold_size = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_cold_label) - cold;
+  }
+  if (fn->file_line_label_data.len > 0) {
+    code.lines = bumpcalloc(fn->file_line_label_data.len, sizeof(JitLine), AL_Compile);
+    for (int i = 0; i < fn->file_line_label_data.len; ++i) {
+      IntIntInt* fll = &fn->file_line_label_data.data[i];
+      int offset = dasm_getpclabel(&C(dynasm), fll->c);
+      // Lines of cold code are out of the function's range.
+      if (offset < entry || offset >= end)
+        continue;
+      code.lines[code.num_lines++] =
+          (JitLine){base_address + offset, files->data[fll->a]->name, fll->b};
+    }
+  }
+  return code;
+}
+
+// Tells the unwinder, perf, and debuggers about the code that was just emitted
+// into |chunk|.
+static void record_jit_code(Obj* prog, FileLinkData* fld, CodeChunk* chunk) {
+  int num_code = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live && !fn->reused_code)
+      ++num_code;
+  }
+  JitCode* code = bumpcalloc(num_code, sizeof(JitCode), AL_Compile);
+  int n = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live && !fn->reused_code)
+      code[n++] = jit_code(fn, chunk->base_address, &compiler_state.tokenize__all_tokenized_files,
+                           C(lazy_file) != NULL);
+  }
+  if (n > 0) {
+    perf_record_code(code, n);
+    register_jit_code(code, n, chunk->base_address, chunk->code_size, fld->source_name);
+  }
+}
+
+// Makes records for the functions that were just emitted into |chunk|, and
+// carries over those for reused functions.
+static void update_function_code(Obj* prog, FileLinkData* fld, CodeChunk* chunk) {
+  int num_functions = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live)
+      ++num_functions;
+  }
+
+  FunctionCode* functions = calloc(num_functions, sizeof(FunctionCode));
+  int n = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    FunctionCode* fc = &functions[n++];
+    if (fn->reused_code) {
+      // Take ownership of the previous record's allocations.
+      *fc = *fn->reused_code;
+      *fn->reused_code = (FunctionCode){0};
+      ++C(stats).functions_reused;
+      continue;
+    }
+
+    int entry = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+    fc->name = strdup(fn->name);
+    fc->lazy = fn->lazy;
+    fc->hash = fn->code_hash;
+    fc->line_hash = fn->line_hash;
+    fc->is_static = fn->is_static;
+    fc->is_process_specific = fn->is_process_specific;
+    fc->profile_counts = fn->profile_counts;
+    fc->num_profile_counts = fn->profile_counts ? fn->num_profile_sites : 0;
+    fc->instrument_counts = fn->instrument_counts;
+    fc->address = chunk->base_address + entry;
+    fc->size = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label) - entry;
+    fc->slots = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(SymbolSlot*));
+    for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+      SymbolSlot* slot = get_symbol_slot(C(file_index), C(symbol_refs).data[i]);
+      bool seen = false;
+      for (int j = 0; j < fc->num_slots && !seen; ++j) {
+        seen = fc->slots[j] == slot;
+      }
+      if (!seen)
+        fc->slots[fc->num_slots++] = slot;
+    }
+    fc->slot_refs = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(char*));
+    for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+      int end = dasm_getpclabel(&C(dynasm), C(symbol_ref_labels).data[i]);
+      fc->slot_refs[fc->num_slot_refs++] = chunk->base_address + end - sizeof(void*);
+    }
+    if (fc->lazy)
+      ++C(stats).functions_deferred;
+    else
+      ++C(stats).functions_compiled;
+  }
+
+  replace_function_code(fld, functions, num_functions, chunk, 1);
+}
+
+#if X64WIN
+
+typedef struct RuntimeFunction {
+  unsigned long BeginAddress;
+  unsigned long EndAddress;
+  unsigned long UnwindData;
+} RuntimeFunction;
+
+static void emit_symbols_and_exception_function_table(Obj* prog,
+                                                      char* base_addr,
+                                                      int pdata_start_offset,
+                                                      int pdata_end_offset) {
+  int func_count = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    ++func_count;
+  }
+
+  size_t alloc_size = (sizeof(RuntimeFunction) * func_count);
+
+  unregister_and_free_function_table_data(user_context);
+  char* function_table_data = malloc(alloc_size);
+  user_context->function_table_data = function_table_data;
+  char* pfuncs = function_table_data;
+
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    RuntimeFunction* rf = (RuntimeFunction*)pfuncs;
+    int func_start_offset = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+    rf->BeginAddress = func_start_offset;
+    rf->EndAddress = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label);
+    rf->UnwindData = dasm_getpclabel(&C(dynasm), fn->dasm_unwind_info_label);
+    pfuncs += sizeof(RuntimeFunction);
+
+    if (user_context->generate_debug_symbols) {
+      DbpFunctionSymbol* dbp_func_sym =
+          dbp_add_function_symbol(user_context->dbp_ctx, fn->name, fn->ty->name->filename,
+                                  dasm_getpclabel(&C(dynasm), fn->dasm_entry_label),
+                                  dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label));
+      for (int i = 0; i < fn->file_line_label_data.len; ++i) {
+        // TODO: ignoring file index, might not be needed unless something got
+        // inlined (which doesn't happen). Maybe there's a macro case that could
+        // cause it already though?
+        int offset = dasm_getpclabel(&C(dynasm), fn->file_line_label_data.data[i].c);
+        dbp_add_line_mapping(user_context->dbp_ctx, dbp_func_sym, offset,
+                             fn->file_line_label_data.data[i].b);
+      }
+    }
+  }
+
+  if (user_context->generate_debug_symbols) {
+    char* unwind_base = base_addr + pdata_start_offset;
+    size_t unwind_len = pdata_end_offset - pdata_start_offset;
+    DbpExceptionTables exception_tables = {
+        .pdata = (DbpRUNTIME_FUNCTION*)user_context->function_table_data,
+        .num_pdata_entries = func_count,
+        .unwind_info = (unsigned char*)unwind_base,
+        .unwind_info_byte_length = unwind_len,
+    };
+    dbp_ready_to_execute(user_context->dbp_ctx, &exception_tables);
+  }
+
+  register_function_table_data(user_context, func_count, base_addr);
+}
+
+#else  // !X64WIN
+
+static void emit_symbols_and_exception_function_table(Obj* prog,
+                                                      char* base_addr,
+                                                      int pdata_start_offset,
+                                                      int pdata_end_offset) {
+  (void)prog;
+  (void)base_addr;
+  (void)pdata_start_offset;
+  (void)pdata_end_offset;
+}
+
+#endif
+
+IMPLSTATIC void codegen_init(void) {
+  dasm_init(&C(dynasm), DASM_MAXSECTION);
+  dasm_growpc(&C(dynasm), 1 << 16);  // Arbitrary number to avoid lots of reallocs of that array.
+
+  C(numlabels) = 1;
+}
+
+IMPLSTATIC void codegen(Obj* prog, size_t file_index) {
+  C(file_index) = file_index;
+
+  void* globals[dynasm_globals_MAX + 1];
+  dasm_setupglobal(&C(dynasm), globals, dynasm_globals_MAX + 1);
+
+  dasm_setup(&C(dynasm), dynasm_actions);
+
+  //| .pdata
+  dasm_put(Dst, 2080);
+#line 3977 "../../src/codegen.in.c"
+  int start_of_pdata = codegen_pclabel();
+  //|.align 4
+  //|=>start_of_pdata:
+  //| .code
+  dasm_put(Dst, 2249, start_of_pdata);
+#line 3981 "../../src/codegen.in.c"
+
+  FileLinkData* fld = &user_context->files[C(file_index)];
+
+  assign_lvar_offsets(prog);
+  find_reusable_code(prog, fld);
+#if !X64WIN
+  start_lazy_file(prog);
+#endif
+  emit_text(prog);
+
+  //| .pdata
+  dasm_put(Dst, 2080);
+#line 3992 "../../src/codegen.in.c"
+  int end_of_pdata = codegen_pclabel();
+  //|=>end_of_pdata:
+  //| .code
+  dasm_put(Dst, 2063, end_of_pdata);
+#line 3995 "../../src/codegen.in.c"
+
+  size_t code_size;
+  dasm_link(&C(dynasm), &code_size);
+
+  // Everything that was emitted this time goes in a new chunk. There's nothing
+  // to allocate if all the functions were reused.
+  CodeChunk chunk = {NULL, 0, code_size};
+  if (code_size > 0) {
+    chunk.size = align_to_u(code_size, get_page_size());
+#if X64WIN
+    if (user_context->generate_debug_symbols) {
+      user_context->dbp_ctx = dbp_create(chunk.size, get_temp_pdb_filename(AL_Compile));
+      chunk.base_address = dbp_get_image_base(user_context->dbp_ctx);
+    } else {
+      chunk.base_address = allocate_writable_memory(chunk.size);
+    }
+#else
+    chunk.base_address = allocate_writable_memory(chunk.size);
+#endif
+  }
+  // outaf("code_size: %zu, page_sized: %zu\n", code_size, chunk.size);
+
+  // This needs to point into code for fixups, so has to go late-ish.
+  update_data_objects(prog, fld);
+  C(stats).code_bytes = code_size;
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    C(stats).data_bytes += fld->data_objects[i].size;
+  }
+  install_data_objects(C(file_index), chunk.base_address);
+
+  if (chunk.base_address) {
+    dasm_encode(&C(dynasm), chunk.base_address);
+    fill_align_padding(chunk.base_address);
+
+#if 0
+    FILE* f = fopen("code.raw", "wb");
+    fwrite(chunk.base_address, code_size, 1, f);
+    fclose(f);
+    system("ndisasm -b64 code.raw");
+#endif
+
+    int check_result = dasm_checkstep(&C(dynasm), 0);
+    if (check_result != DASM_S_OK) {
+      outaf("check_result: 0x%08x\n", check_result);
+      ABORT("dasm_checkstep failed");
+    }
+  }
+
+  emit_symbols_and_exception_function_table(prog, chunk.base_address,
+                                            dasm_getpclabel(&C(dynasm), start_of_pdata),
+                                            dasm_getpclabel(&C(dynasm), end_of_pdata));
+
+  // Before update_function_code(), which takes the reused functions' records.
+  record_jit_code(prog, fld, &chunk);
+
+  update_function_code(prog, fld, &chunk);
+
+#if !X64WIN
+  if (C(lazy_file)) {
+    char* thunk = chunk.base_address + dasm_getpclabel(&C(dynasm), C(lazy_thunk_label));
+    for (LazyFunction* lf = C(lazy_file)->functions; lf; lf = lf->next) {
+      lf->target = thunk;
+    }
+    C(lazy_file)->numlabels = C(numlabels);
+    fld->lazy = C(lazy_file);
+  }
+#endif
+
+  mutex_lock(user_context->compile_mutex);
+  DyibiccStats* stats = &user_context->stats;
+  stats->frame_bytes += C(stats).frame_bytes;
+  stats->frame_bytes_unshared += C(stats).frame_bytes_unshared;
+  stats->functions_compiled += C(stats).functions_compiled;
+  stats->functions_reused += C(stats).functions_reused;
+  stats->functions_deferred += C(stats).functions_deferred;
+  stats->code_bytes += C(stats).code_bytes;
+  stats->data_bytes += C(stats).data_bytes;
+  mutex_unlock(user_context->compile_mutex);
+
+  codegen_free();
+}
+
+// This can be called after a longjmp in update.
+IMPLSTATIC void codegen_free(void) {
+  if (C(dynasm)) {
+    dasm_free(&C(dynasm));
+  }
+}
+
+#if !X64WIN
+// Generates code for |lf| from the parse that was kept for it, at |tier|, and
+// points its stub at it. Called with lazy_mutex held, as emitting code writes
+// to the parse. The thread may be part way through compiling something else
+// (the stub was called from a host callback during an update), so its compiler
+// state is put back afterwards.
+static char* compile_lazy_code(LazyFunction* lf, int tier) {
+  LazyFile* lazy = lf->file;
+  SavedCompile* saved = alloc_save_compile();
+
+  jmp_buf prev_jmpbuf;
+  memcpy(prev_jmpbuf, toplevel_update_jmpbuf, sizeof(jmp_buf));
+  if (setjmp(toplevel_update_jmpbuf) != 0) {
+    // The function has already been called, so there's nothing to go back to.
+    // The error's been reported through the context's output_function.
+    memcpy(toplevel_update_jmpbuf, prev_jmpbuf, sizeof(jmp_buf));
+    fprintf(stderr, "dyibicc: failed to compile lazy function %s\n", lf->fn->name);
+    abort();
+  }
+
+  alloc_init(AL_Compile);
+  C(file_index) = lazy->file_index;
+  C(numlabels) = lazy->numlabels;
+  if (user_context->tiered_compilation && tier == 0)
+    C(tier0_function) = lf;
+  dasm_init(&C(dynasm), DASM_MAXSECTION);
+  dasm_growpc(&C(dynasm), C(numlabels));
+  void* globals[dynasm_globals_MAX + 1];
+  dasm_setupglobal(&C(dynasm), globals, dynasm_globals_MAX + 1);
+  dasm_setup(&C(dynasm), dynasm_actions);
+
+  //| .code
+  dasm_put(Dst, 1370);
+#line 4116 "../../src/codegen.in.c"
+  Obj* fn = lf->fn;
+  emit_function(fn);
+
+  size_t code_size;
+  dasm_link(&C(dynasm), &code_size);
+  CodeChunk chunk = {NULL, align_to_u(code_size, get_page_size()), code_size};
+  chunk.base_address = allocate_writable_memory(chunk.size);
+  dasm_encode(&C(dynasm), chunk.base_address);
+  fill_align_padding(chunk.base_address);
+  if (!make_memory_executable(chunk.base_address, chunk.size))
+    ABORT("failed to make lazy function executable");
+  chunk.is_executable = true;
+  JitCode code = jit_code(fn, chunk.base_address, &lazy->files, false);
+  perf_record_code(&code, 1);
+  register_jit_code(&code, 1, chunk.base_address, chunk.code_size,
+                    user_context->files[lazy->file_index].source_name);
+
+  int num_slots = 0;
+  SymbolSlot** slots = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(SymbolSlot*));
+  for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+    SymbolSlot* slot = get_symbol_slot(C(file_index), C(symbol_refs).data[i]);
+    bool seen = false;
+    for (int j = 0; j < num_slots && !seen; ++j) {
+      seen = slots[j] == slot;
+    }
+    if (!seen)
+      slots[num_slots++] = slot;
+  }
+
+  mutex_lock(user_context->compile_mutex);
+  if (!link_slots(C(file_index), slots, num_slots))
+    ABORT("failed to link lazy function");
+  // Threads may still be running the previous tier's code.
+  if (lf->code.size)
+    retire_executable_memory(lf->code.base_address, lf->code.size);
+  lf->code = chunk;
+  lf->tier = tier;
+  if (lazy->is_retired) {
+    // A later update already replaced the file, but the old code can still be
+    // running, so keep this until the stub's own code is released.
+    retire_executable_memory(chunk.base_address, chunk.size);
+    lf->code.size = 0;
+  } else {
+    // The slots go with the stub's record so that later links update them.
+    FileLinkData* fld = &user_context->files[C(file_index)];
+    for (int i = 0; i < fld->num_functions; ++i) {
+      FunctionCode* fc = &fld->functions[i];
+      if (fc->lazy != lf)
+        continue;
+      if (!fc->profile_counts && fn->profile_counts) {
+        fc->profile_counts = fn->profile_counts;
+        fc->num_profile_counts = fn->num_profile_sites;
+      }
+      if (!fc->instrument_counts && fn->instrument_counts)
+        fc->instrument_counts = fn->instrument_counts;
+      fc->slots = realloc(fc->slots, (fc->num_slots + num_slots) * sizeof(SymbolSlot*));
+      for (int j = 0; j < num_slots; ++j) {
+        bool seen = false;
+        for (int k = 0; k < fc->num_slots && !seen; ++k) {
+          seen = fc->slots[k] == slots[j];
+        }
+        if (!seen)
+          fc->slots[fc->num_slots++] = slots[j];
+        use_symbol_slot(fld, slots[j]);
+      }
+    }
+    if (tier == 0)
+      ++user_context->stats.functions_compiled;
+    else
+      ++user_context->stats.functions_promoted;
+  }
+  free(slots);
+  char* target = chunk.base_address + dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+  __atomic_store_n(&lf->target, target, __ATOMIC_RELEASE);
+  mutex_unlock(user_context->compile_mutex);
+
+  codegen_free();
+  alloc_reset(AL_Compile);
+  alloc_restore_compile(saved);
+  memcpy(toplevel_update_jmpbuf, prev_jmpbuf, sizeof(jmp_buf));
+  return target;
+}
+
+// Called from the thunk the first time one of the stubs emitted for
+// lazy_compilation is, on whichever thread that happens to be. Returns the
+// address of the function's code, which later calls then jump to directly.
+IMPLSTATIC char* compile_lazy_function(LazyFunction* lf) {
+  UserContext* prev = user_context;
+  user_context = lf->file->ctx;
+
+  mutex_lock(user_context->lazy_mutex);
+  char* target = __atomic_load_n(&lf->target, __ATOMIC_ACQUIRE);
+  if (!lf->code.base_address)
+    target = compile_lazy_code(lf, 0);
+  mutex_unlock(user_context->lazy_mutex);
+
+  user_context = prev;
+  return target;
+}
+
+static void promotion_worker(void* arg) {
+  UserContext* ctx = arg;
+  user_context = ctx;
+  mutex_lock(ctx->lazy_mutex);
+  while (ctx->promotion_queue) {
+    LazyFunction* lf = ctx->promotion_queue;
+    ctx->promotion_queue = lf->next_promotion;
+    compile_lazy_code(lf, 1);
+  }
+  ctx->promoting = false;
+  mutex_unlock(ctx->lazy_mutex);
+}
+
+// Called from tier 0 code when one of its counts reaches its threshold. Queues
+// the function to be compiled again without counts, starting a thread to do
+// that if there isn't one already working through the queue.
+IMPLSTATIC void request_promotion(LazyFunction* lf) {
+  UserContext* ctx = lf->file->ctx;
+  mutex_lock(ctx->lazy_mutex);
+  if (!lf->promotion_requested && !lf->file->is_retired) {
+    lf->promotion_requested = true;
+    lf->next_promotion = ctx->promotion_queue;
+    ctx->promotion_queue = lf;
+    if (!ctx->promoting) {
+      // The previous thread has already finished with the queue.
+      if (ctx->promotion_thread)
+        thread_join(ctx->promotion_thread);
+      ctx->promotion_thread = thread_start(promotion_worker, ctx);
+      ctx->promoting = ctx->promotion_thread != NULL;
+    }
+  }
+  mutex_unlock(ctx->lazy_mutex);
+}
+#endif
+
+// Waits for any functions queued by request_promotion() to be compiled.
+IMPLSTATIC void finish_promotions(UserContext* ctx) {
+  mutex_lock(ctx->lazy_mutex);
+  Thread* thread = ctx->promotion_thread;
+  ctx->promotion_thread = NULL;
+  mutex_unlock(ctx->lazy_mutex);
+  if (thread)
+    thread_join(thread);
+}
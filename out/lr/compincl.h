@@ -0,0 +1,6800 @@
+typedef struct CompilerInclude {
+    char* path;
+    int offset;
+} CompilerInclude;
+
+static CompilerInclude compiler_includes[17] = {
+    { "__include__/mac/stdbool.h", 0 },
+    { "__include__/mac/stddef.h", 140 },
+    { "__include__/mac/stdarg.h", 389 },
+    { "__include__/mac/float.h", 1888 },
+    { "__include__/mac/stdnoreturn.h", 2930 },
+    { "__include__/linux/stdbool.h", 3015 },
+    { "__include__/linux/stddef.h", 3155 },
+    { "__include__/linux/stdarg.h", 3404 },
+    { "__include__/linux/float.h", 5036 },
+    { "__include__/linux/stdnoreturn.h", 6078 },
+    { "__include__/win/stddef.h", 6163 },
+    { "__include__/all/stdatomic.h", 6300 },
+    { "__include__/all/reflect.h", 10179 },
+    { "__include__/all/_map.h", 12473 },
+    { "__include__/all/stdnoreturn.h", 58897 },
+    { "__include__/all/stdalign.h", 58982 },
+    { "__include__/all/_vec.h", 59146 },
+};
+static unsigned char compiler_include_blob[105382] = {
+35, 105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68, 66, 79, 79,
+76, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83, 84,
+68, 66, 79, 79, 76, 95, 72, 10, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 98, 111, 111, 108, 32, 95, 66, 111, 111, 108, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 116, 114, 117, 101, 32, 49, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 102, 97, 108, 115, 101, 32, 48, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 95, 98, 111, 111, 108, 95, 116, 114,
+117, 101, 95, 102, 97, 108, 115, 101, 95, 97, 114, 101, 95, 100, 101,
+102, 105, 110, 101, 100, 32, 49, 10, 10, 35, 101, 110, 100, 105, 102,
+10, 0, 35, 105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68, 68,
+69, 70, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83,
+84, 68, 68, 69, 70, 95, 72, 10, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 78, 85, 76, 76, 32, 40, 40, 118, 111, 105, 100, 42, 41, 48, 41,
+10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 115, 105, 122, 101,
+95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 108, 111, 110,
+103, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100,
+32, 105, 110, 116, 32, 119, 99, 104, 97, 114, 95, 116, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 108, 111, 110, 103, 32, 109, 97,
+120, 95, 97, 108, 105, 103, 110, 95, 116, 59, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 111, 102, 102, 115, 101, 116, 111, 102, 40,
+116, 121, 112, 101, 44, 32, 109, 101, 109, 98, 101, 114, 41, 32, 40,
+40, 115, 105, 122, 101, 95, 116, 41, 32, 38, 32, 40, 40, 40, 116, 121,
+112, 101, 42, 41, 48, 41, 45, 62, 109, 101, 109, 98, 101, 114, 41, 41,
+10, 10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102, 110, 100,
+101, 102, 32, 95, 95, 83, 84, 68, 65, 82, 71, 95, 72, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68, 65, 82, 71, 95, 72,
+10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 95, 118, 97, 95,
+101, 108, 101, 109, 32, 118, 97, 95, 108, 105, 115, 116, 91, 49, 93,
+59, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 118, 97, 95, 115,
+116, 97, 114, 116, 40, 97, 112, 44, 32, 108, 97, 115, 116, 41, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32, 100, 111, 32,
+123, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92,
+10, 32, 32, 32, 32, 42, 40, 97, 112, 41, 32, 61, 32, 42, 40, 95, 95,
+118, 97, 95, 101, 108, 101, 109, 42, 41, 95, 95, 118, 97, 95, 97, 114,
+101, 97, 95, 95, 59, 32, 92, 10, 32, 32, 125, 32, 119, 104, 105, 108,
+101, 32, 40, 48, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+118, 97, 95, 101, 110, 100, 40, 97, 112, 41, 10, 10, 115, 116, 97,
+116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 109, 101, 109, 40, 95, 95, 118, 97, 95, 101, 108, 101,
+109, 42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44, 32,
+105, 110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32, 32,
+118, 111, 105, 100, 42, 32, 112, 32, 61, 32, 97, 112, 45, 62, 111,
+118, 101, 114, 102, 108, 111, 119, 95, 97, 114, 103, 95, 97, 114, 101,
+97, 59, 10, 32, 32, 105, 102, 32, 40, 97, 108, 105, 103, 110, 32, 62,
+32, 56, 41, 10, 32, 32, 32, 32, 112, 32, 61, 32, 40, 112, 32, 43, 32,
+49, 53, 41, 32, 47, 32, 49, 54, 32, 42, 32, 49, 54, 59, 10, 32, 32,
+97, 112, 45, 62, 111, 118, 101, 114, 102, 108, 111, 119, 95, 97, 114,
+103, 95, 97, 114, 101, 97, 32, 61, 32, 40, 40, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 108, 111, 110, 103, 41, 112, 32, 43, 32, 115,
+122, 32, 43, 32, 55, 41, 32, 47, 32, 56, 32, 42, 32, 56, 59, 10, 32,
+32, 114, 101, 116, 117, 114, 110, 32, 112, 59, 10, 125, 10, 10, 115,
+116, 97, 116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118,
+97, 95, 97, 114, 103, 95, 103, 112, 40, 95, 95, 118, 97, 95, 101, 108,
+101, 109, 42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44,
+32, 105, 110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32,
+32, 105, 102, 32, 40, 97, 112, 45, 62, 103, 112, 95, 111, 102, 102,
+115, 101, 116, 32, 62, 61, 32, 52, 56, 41, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+109, 101, 109, 40, 97, 112, 44, 32, 115, 122, 44, 32, 97, 108, 105,
+103, 110, 41, 59, 10, 10, 32, 32, 118, 111, 105, 100, 42, 32, 114, 32,
+61, 32, 97, 112, 45, 62, 114, 101, 103, 95, 115, 97, 118, 101, 95, 97,
+114, 101, 97, 32, 43, 32, 97, 112, 45, 62, 103, 112, 95, 111, 102,
+102, 115, 101, 116, 59, 10, 32, 32, 97, 112, 45, 62, 103, 112, 95,
+111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 56, 59, 10, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 114, 59, 10, 125, 10, 10, 115, 116, 97,
+116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 102, 112, 40, 95, 95, 118, 97, 95, 101, 108, 101, 109,
+42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44, 32, 105,
+110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32, 32, 105,
+102, 32, 40, 97, 112, 45, 62, 102, 112, 95, 111, 102, 102, 115, 101,
+116, 32, 62, 61, 32, 49, 49, 50, 41, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95, 109,
+101, 109, 40, 97, 112, 44, 32, 115, 122, 44, 32, 97, 108, 105, 103,
+110, 41, 59, 10, 10, 32, 32, 118, 111, 105, 100, 42, 32, 114, 32, 61,
+32, 97, 112, 45, 62, 114, 101, 103, 95, 115, 97, 118, 101, 95, 97,
+114, 101, 97, 32, 43, 32, 97, 112, 45, 62, 102, 112, 95, 111, 102,
+102, 115, 101, 116, 59, 10, 32, 32, 97, 112, 45, 62, 102, 112, 95,
+111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 56, 59, 10, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 114, 59, 10, 125, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 118, 97, 95, 97, 114, 103, 40, 97, 112, 44,
+32, 116, 121, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32,
+40, 123, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32, 32,
+32, 105, 110, 116, 32, 107, 108, 97, 115, 115, 32, 61, 32, 95, 95, 98,
+117, 105, 108, 116, 105, 110, 95, 114, 101, 103, 95, 99, 108, 97, 115,
+115, 40, 116, 121, 41, 59, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32,
+32, 32, 32, 42, 40, 116, 121, 42, 41, 40, 107, 108, 97, 115, 115, 32,
+61, 61, 32, 48, 32, 63, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+103, 112, 40, 97, 112, 44, 32, 115, 105, 122, 101, 111, 102, 40, 116,
+121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111, 102, 40, 116, 121,
+41, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 32, 107, 108, 97, 115, 115,
+32, 61, 61, 32, 49, 32, 63, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+102, 112, 40, 97, 112, 44, 32, 115, 105, 122, 101, 111, 102, 40, 116,
+121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111, 102, 40, 116, 121,
+41, 41, 32, 32, 32, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 109, 101, 109, 40, 97, 112, 44, 32, 115, 105, 122, 101,
+111, 102, 40, 116, 121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111,
+102, 40, 116, 121, 41, 41, 41, 59, 32, 92, 10, 32, 32, 125, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 118, 97, 95, 99, 111, 112,
+121, 40, 100, 101, 115, 116, 44, 32, 115, 114, 99, 41, 32, 40, 40,
+100, 101, 115, 116, 41, 91, 48, 93, 32, 61, 32, 40, 115, 114, 99, 41,
+91, 48, 93, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95,
+71, 78, 85, 67, 95, 86, 65, 95, 76, 73, 83, 84, 32, 49, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 118, 97, 95, 108, 105, 115, 116, 32, 95,
+95, 103, 110, 117, 99, 95, 118, 97, 95, 108, 105, 115, 116, 59, 10,
+10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102, 110, 100, 101,
+102, 32, 95, 95, 83, 84, 68, 70, 76, 79, 65, 84, 95, 72, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68, 70, 76, 79, 65, 84,
+95, 72, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 69, 67, 73,
+77, 65, 76, 95, 68, 73, 71, 32, 50, 49, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 70, 76, 84, 95, 69, 86, 65, 76, 95, 77, 69, 84, 72, 79,
+68, 32, 48, 32, 32, 47, 47, 32, 67, 49, 49, 32, 53, 46, 50, 46, 52,
+46, 50, 46, 50, 112, 57, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70,
+76, 84, 95, 82, 65, 68, 73, 88, 32, 50, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 70, 76, 84, 95, 82, 79, 85, 78, 68, 83, 32, 49, 32, 32,
+47, 47, 32, 67, 49, 49, 32, 53, 46, 50, 46, 52, 46, 50, 46, 50, 112,
+56, 58, 32, 116, 111, 32, 110, 101, 97, 114, 101, 115, 116, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 68, 73, 71, 32,
+54, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 69, 80,
+83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 50, 51, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 65, 78, 84, 95, 68,
+73, 71, 32, 50, 52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76,
+84, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102, 102, 101,
+112, 43, 49, 50, 55, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76,
+84, 95, 77, 65, 88, 95, 49, 48, 95, 69, 88, 80, 32, 51, 56, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 65, 88, 95, 69,
+88, 80, 32, 49, 50, 56, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70,
+76, 84, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 50, 54, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 73, 78, 95, 49,
+48, 95, 69, 88, 80, 32, 45, 51, 55, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 70, 76, 84, 95, 77, 73, 78, 95, 69, 88, 80, 32, 45, 49, 50,
+53, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 84, 82,
+85, 69, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 52, 57, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 68, 73, 71, 32,
+49, 53, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 69,
+80, 83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 53, 50, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 65, 78, 84, 95, 68,
+73, 71, 32, 53, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66,
+76, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 112, 43, 49, 48, 50, 51, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 65, 88, 95, 49,
+48, 95, 69, 88, 80, 32, 51, 48, 56, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 68, 66, 76, 95, 77, 65, 88, 95, 69, 88, 80, 32, 49, 48, 50,
+52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 73,
+78, 32, 48, 120, 49, 112, 45, 49, 48, 50, 50, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 68, 66, 76, 95, 77, 73, 78, 95, 49, 48, 95, 69, 88,
+80, 32, 45, 51, 48, 55, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68,
+66, 76, 95, 77, 73, 78, 95, 69, 88, 80, 32, 45, 49, 48, 50, 49, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 84, 82, 85, 69,
+95, 77, 73, 78, 32, 48, 120, 48, 46, 48, 48, 48, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 49, 112, 45, 49, 48, 50, 50, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 68, 73, 71, 32, 49, 53,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 69, 80,
+83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 53, 50, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65, 78, 84, 95,
+68, 73, 71, 32, 53, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76,
+68, 66, 76, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 102, 102, 112, 43, 49, 48, 50, 51,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65,
+88, 95, 49, 48, 95, 69, 88, 80, 32, 51, 48, 56, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65, 88, 95, 69, 88, 80, 32,
+49, 48, 50, 52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66,
+76, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 48, 50, 50, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 73, 78, 95,
+49, 48, 95, 69, 88, 80, 32, 45, 51, 48, 55, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 73, 78, 95, 69, 88, 80, 32,
+45, 49, 48, 50, 49, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68,
+66, 76, 95, 84, 82, 85, 69, 95, 77, 73, 78, 32, 48, 120, 48, 46, 48,
+48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 112, 45, 49, 48, 50,
+50, 10, 10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102, 110,
+100, 101, 102, 32, 95, 95, 83, 84, 68, 78, 79, 82, 69, 84, 85, 82, 78,
+95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68,
+78, 79, 82, 69, 84, 85, 82, 78, 95, 72, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 110, 111, 114, 101, 116, 117, 114, 110, 32, 95, 78,
+111, 114, 101, 116, 117, 114, 110, 10, 10, 35, 101, 110, 100, 105,
+102, 10, 0, 35, 105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68,
+66, 79, 79, 76, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+95, 83, 84, 68, 66, 79, 79, 76, 95, 72, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 98, 111, 111, 108, 32, 95, 66, 111, 111, 108, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 116, 114, 117, 101, 32, 49, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 102, 97, 108, 115, 101, 32, 48,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 98, 111, 111, 108,
+95, 116, 114, 117, 101, 95, 102, 97, 108, 115, 101, 95, 97, 114, 101,
+95, 100, 101, 102, 105, 110, 101, 100, 32, 49, 10, 10, 35, 101, 110,
+100, 105, 102, 10, 0, 35, 105, 102, 110, 100, 101, 102, 32, 95, 95,
+83, 84, 68, 68, 69, 70, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 95, 83, 84, 68, 68, 69, 70, 95, 72, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 78, 85, 76, 76, 32, 40, 40, 118, 111, 105, 100, 42,
+41, 48, 41, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110,
+115, 105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 115, 105,
+122, 101, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 108,
+111, 110, 103, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110,
+101, 100, 32, 105, 110, 116, 32, 119, 99, 104, 97, 114, 95, 116, 59,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 108, 111, 110, 103, 32,
+109, 97, 120, 95, 97, 108, 105, 103, 110, 95, 116, 59, 10, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 111, 102, 102, 115, 101, 116, 111,
+102, 40, 116, 121, 112, 101, 44, 32, 109, 101, 109, 98, 101, 114, 41,
+32, 40, 40, 115, 105, 122, 101, 95, 116, 41, 32, 38, 32, 40, 40, 40,
+116, 121, 112, 101, 42, 41, 48, 41, 45, 62, 109, 101, 109, 98, 101,
+114, 41, 41, 10, 10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102,
+110, 100, 101, 102, 32, 95, 95, 83, 84, 68, 65, 82, 71, 95, 72, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68, 65, 82, 71,
+95, 72, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 10, 32, 32, 117, 110, 115, 105, 103, 110, 101,
+100, 32, 105, 110, 116, 32, 103, 112, 95, 111, 102, 102, 115, 101,
+116, 59, 10, 32, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 105,
+110, 116, 32, 102, 112, 95, 111, 102, 102, 115, 101, 116, 59, 10, 32,
+32, 118, 111, 105, 100, 42, 32, 111, 118, 101, 114, 102, 108, 111,
+119, 95, 97, 114, 103, 95, 97, 114, 101, 97, 59, 10, 32, 32, 118, 111,
+105, 100, 42, 32, 114, 101, 103, 95, 115, 97, 118, 101, 95, 97, 114,
+101, 97, 59, 10, 125, 32, 95, 95, 118, 97, 95, 101, 108, 101, 109, 59,
+10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 95, 118, 97, 95,
+101, 108, 101, 109, 32, 118, 97, 95, 108, 105, 115, 116, 91, 49, 93,
+59, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 118, 97, 95, 115,
+116, 97, 114, 116, 40, 97, 112, 44, 32, 108, 97, 115, 116, 41, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32, 100, 111, 32,
+123, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92,
+10, 32, 32, 32, 32, 42, 40, 97, 112, 41, 32, 61, 32, 42, 40, 95, 95,
+118, 97, 95, 101, 108, 101, 109, 42, 41, 95, 95, 118, 97, 95, 97, 114,
+101, 97, 95, 95, 59, 32, 92, 10, 32, 32, 125, 32, 119, 104, 105, 108,
+101, 32, 40, 48, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+118, 97, 95, 101, 110, 100, 40, 97, 112, 41, 10, 10, 115, 116, 97,
+116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 109, 101, 109, 40, 95, 95, 118, 97, 95, 101, 108, 101,
+109, 42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44, 32,
+105, 110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32, 32,
+118, 111, 105, 100, 42, 32, 112, 32, 61, 32, 97, 112, 45, 62, 111,
+118, 101, 114, 102, 108, 111, 119, 95, 97, 114, 103, 95, 97, 114, 101,
+97, 59, 10, 32, 32, 105, 102, 32, 40, 97, 108, 105, 103, 110, 32, 62,
+32, 56, 41, 10, 32, 32, 32, 32, 112, 32, 61, 32, 40, 112, 32, 43, 32,
+49, 53, 41, 32, 47, 32, 49, 54, 32, 42, 32, 49, 54, 59, 10, 32, 32,
+97, 112, 45, 62, 111, 118, 101, 114, 102, 108, 111, 119, 95, 97, 114,
+103, 95, 97, 114, 101, 97, 32, 61, 32, 40, 40, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 108, 111, 110, 103, 41, 112, 32, 43, 32, 115,
+122, 32, 43, 32, 55, 41, 32, 47, 32, 56, 32, 42, 32, 56, 59, 10, 32,
+32, 114, 101, 116, 117, 114, 110, 32, 112, 59, 10, 125, 10, 10, 115,
+116, 97, 116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118,
+97, 95, 97, 114, 103, 95, 103, 112, 40, 95, 95, 118, 97, 95, 101, 108,
+101, 109, 42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44,
+32, 105, 110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32,
+32, 105, 102, 32, 40, 97, 112, 45, 62, 103, 112, 95, 111, 102, 102,
+115, 101, 116, 32, 62, 61, 32, 52, 56, 41, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+109, 101, 109, 40, 97, 112, 44, 32, 115, 122, 44, 32, 97, 108, 105,
+103, 110, 41, 59, 10, 10, 32, 32, 118, 111, 105, 100, 42, 32, 114, 32,
+61, 32, 97, 112, 45, 62, 114, 101, 103, 95, 115, 97, 118, 101, 95, 97,
+114, 101, 97, 32, 43, 32, 97, 112, 45, 62, 103, 112, 95, 111, 102,
+102, 115, 101, 116, 59, 10, 32, 32, 97, 112, 45, 62, 103, 112, 95,
+111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 56, 59, 10, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 114, 59, 10, 125, 10, 10, 115, 116, 97,
+116, 105, 99, 32, 118, 111, 105, 100, 42, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 102, 112, 40, 95, 95, 118, 97, 95, 101, 108, 101, 109,
+42, 32, 97, 112, 44, 32, 105, 110, 116, 32, 115, 122, 44, 32, 105,
+110, 116, 32, 97, 108, 105, 103, 110, 41, 32, 123, 10, 32, 32, 105,
+102, 32, 40, 97, 112, 45, 62, 102, 112, 95, 111, 102, 102, 115, 101,
+116, 32, 62, 61, 32, 49, 49, 50, 41, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95, 109,
+101, 109, 40, 97, 112, 44, 32, 115, 122, 44, 32, 97, 108, 105, 103,
+110, 41, 59, 10, 10, 32, 32, 118, 111, 105, 100, 42, 32, 114, 32, 61,
+32, 97, 112, 45, 62, 114, 101, 103, 95, 115, 97, 118, 101, 95, 97,
+114, 101, 97, 32, 43, 32, 97, 112, 45, 62, 102, 112, 95, 111, 102,
+102, 115, 101, 116, 59, 10, 32, 32, 97, 112, 45, 62, 102, 112, 95,
+111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 56, 59, 10, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 114, 59, 10, 125, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 118, 97, 95, 97, 114, 103, 40, 97, 112, 44,
+32, 116, 121, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32,
+40, 123, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32, 32, 32,
+32, 105, 110, 116, 32, 107, 108, 97, 115, 115, 32, 61, 32, 95, 95, 98,
+117, 105, 108, 116, 105, 110, 95, 114, 101, 103, 95, 99, 108, 97, 115,
+115, 40, 116, 121, 41, 59, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 92, 10, 32,
+32, 32, 32, 42, 40, 116, 121, 42, 41, 40, 107, 108, 97, 115, 115, 32,
+61, 61, 32, 48, 32, 63, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+103, 112, 40, 97, 112, 44, 32, 115, 105, 122, 101, 111, 102, 40, 116,
+121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111, 102, 40, 116, 121,
+41, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 32, 107, 108, 97, 115, 115,
+32, 61, 61, 32, 49, 32, 63, 32, 95, 95, 118, 97, 95, 97, 114, 103, 95,
+102, 112, 40, 97, 112, 44, 32, 115, 105, 122, 101, 111, 102, 40, 116,
+121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111, 102, 40, 116, 121,
+41, 41, 32, 32, 32, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 32, 95, 95, 118, 97, 95, 97,
+114, 103, 95, 109, 101, 109, 40, 97, 112, 44, 32, 115, 105, 122, 101,
+111, 102, 40, 116, 121, 41, 44, 32, 95, 65, 108, 105, 103, 110, 111,
+102, 40, 116, 121, 41, 41, 41, 59, 32, 92, 10, 32, 32, 125, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 118, 97, 95, 99, 111, 112,
+121, 40, 100, 101, 115, 116, 44, 32, 115, 114, 99, 41, 32, 40, 40,
+100, 101, 115, 116, 41, 91, 48, 93, 32, 61, 32, 40, 115, 114, 99, 41,
+91, 48, 93, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95,
+71, 78, 85, 67, 95, 86, 65, 95, 76, 73, 83, 84, 32, 49, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 118, 97, 95, 108, 105, 115, 116, 32, 95,
+95, 103, 110, 117, 99, 95, 118, 97, 95, 108, 105, 115, 116, 59, 10,
+10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102, 110, 100, 101,
+102, 32, 95, 95, 83, 84, 68, 70, 76, 79, 65, 84, 95, 72, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68, 70, 76, 79, 65, 84,
+95, 72, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 69, 67, 73,
+77, 65, 76, 95, 68, 73, 71, 32, 50, 49, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 70, 76, 84, 95, 69, 86, 65, 76, 95, 77, 69, 84, 72, 79,
+68, 32, 48, 32, 32, 47, 47, 32, 67, 49, 49, 32, 53, 46, 50, 46, 52,
+46, 50, 46, 50, 112, 57, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70,
+76, 84, 95, 82, 65, 68, 73, 88, 32, 50, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 70, 76, 84, 95, 82, 79, 85, 78, 68, 83, 32, 49, 32, 32,
+47, 47, 32, 67, 49, 49, 32, 53, 46, 50, 46, 52, 46, 50, 46, 50, 112,
+56, 58, 32, 116, 111, 32, 110, 101, 97, 114, 101, 115, 116, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 68, 73, 71, 32,
+54, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 69, 80,
+83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 50, 51, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 65, 78, 84, 95, 68,
+73, 71, 32, 50, 52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76,
+84, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102, 102, 101,
+112, 43, 49, 50, 55, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76,
+84, 95, 77, 65, 88, 95, 49, 48, 95, 69, 88, 80, 32, 51, 56, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 65, 88, 95, 69,
+88, 80, 32, 49, 50, 56, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70,
+76, 84, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 50, 54, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 77, 73, 78, 95, 49,
+48, 95, 69, 88, 80, 32, 45, 51, 55, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 70, 76, 84, 95, 77, 73, 78, 95, 69, 88, 80, 32, 45, 49, 50,
+53, 10, 35, 100, 101, 102, 105, 110, 101, 32, 70, 76, 84, 95, 84, 82,
+85, 69, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 52, 57, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 68, 73, 71, 32,
+49, 53, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 69,
+80, 83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 53, 50, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 65, 78, 84, 95, 68,
+73, 71, 32, 53, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66,
+76, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 112, 43, 49, 48, 50, 51, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 65, 88, 95, 49,
+48, 95, 69, 88, 80, 32, 51, 48, 56, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 68, 66, 76, 95, 77, 65, 88, 95, 69, 88, 80, 32, 49, 48, 50,
+52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 77, 73,
+78, 32, 48, 120, 49, 112, 45, 49, 48, 50, 50, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 68, 66, 76, 95, 77, 73, 78, 95, 49, 48, 95, 69, 88,
+80, 32, 45, 51, 48, 55, 10, 35, 100, 101, 102, 105, 110, 101, 32, 68,
+66, 76, 95, 77, 73, 78, 95, 69, 88, 80, 32, 45, 49, 48, 50, 49, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 68, 66, 76, 95, 84, 82, 85, 69,
+95, 77, 73, 78, 32, 48, 120, 48, 46, 48, 48, 48, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 49, 112, 45, 49, 48, 50, 50, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 68, 73, 71, 32, 49, 53,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 69, 80,
+83, 73, 76, 79, 78, 32, 48, 120, 49, 112, 45, 53, 50, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65, 78, 84, 95,
+68, 73, 71, 32, 53, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76,
+68, 66, 76, 95, 77, 65, 88, 32, 48, 120, 49, 46, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 102, 102, 112, 43, 49, 48, 50, 51,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65,
+88, 95, 49, 48, 95, 69, 88, 80, 32, 51, 48, 56, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 65, 88, 95, 69, 88, 80, 32,
+49, 48, 50, 52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68, 66,
+76, 95, 77, 73, 78, 32, 48, 120, 49, 112, 45, 49, 48, 50, 50, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 73, 78, 95,
+49, 48, 95, 69, 88, 80, 32, 45, 51, 48, 55, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 76, 68, 66, 76, 95, 77, 73, 78, 95, 69, 88, 80, 32,
+45, 49, 48, 50, 49, 10, 35, 100, 101, 102, 105, 110, 101, 32, 76, 68,
+66, 76, 95, 84, 82, 85, 69, 95, 77, 73, 78, 32, 48, 120, 48, 46, 48,
+48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 112, 45, 49, 48, 50,
+50, 10, 10, 35, 101, 110, 100, 105, 102, 10, 0, 35, 105, 102, 110,
+100, 101, 102, 32, 95, 95, 83, 84, 68, 78, 79, 82, 69, 84, 85, 82, 78,
+95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83, 84, 68,
+78, 79, 82, 69, 84, 85, 82, 78, 95, 72, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 110, 111, 114, 101, 116, 117, 114, 110, 32, 95, 78,
+111, 114, 101, 116, 117, 114, 110, 10, 10, 35, 101, 110, 100, 105,
+102, 10, 0, 35, 105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68,
+68, 69, 70, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95,
+83, 84, 68, 68, 69, 70, 95, 72, 10, 10, 35, 105, 110, 99, 108, 117,
+100, 101, 32, 60, 118, 99, 114, 117, 110, 116, 105, 109, 101, 46, 104,
+62, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 111, 102, 102, 115,
+101, 116, 111, 102, 40, 116, 121, 112, 101, 44, 32, 109, 101, 109, 98,
+101, 114, 41, 32, 40, 40, 115, 105, 122, 101, 95, 116, 41, 32, 38, 32,
+40, 40, 40, 116, 121, 112, 101, 42, 41, 48, 41, 45, 62, 109, 101, 109,
+98, 101, 114, 41, 41, 10, 10, 35, 101, 110, 100, 105, 102, 10, 0, 35,
+105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68, 65, 84, 79, 77,
+73, 67, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 95, 83,
+84, 68, 65, 84, 79, 77, 73, 67, 95, 72, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 66, 79, 79, 76, 95, 76,
+79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 67, 72, 65, 82, 95, 76, 79,
+67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 65, 84, 79, 77, 73, 67, 95, 67, 72, 65, 82, 49, 54, 95, 84,
+95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 67, 72, 65, 82, 51, 50,
+95, 84, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 87, 67, 72,
+65, 82, 95, 84, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 83,
+72, 79, 82, 84, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 73,
+78, 84, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 76, 79, 78,
+71, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 76, 76, 79, 78,
+71, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 80, 79, 73, 78,
+84, 69, 82, 95, 76, 79, 67, 75, 95, 70, 82, 69, 69, 32, 49, 10, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 101, 110, 117, 109, 32, 123,
+10, 32, 32, 109, 101, 109, 111, 114, 121, 95, 111, 114, 100, 101, 114,
+95, 114, 101, 108, 97, 120, 101, 100, 44, 10, 32, 32, 109, 101, 109,
+111, 114, 121, 95, 111, 114, 100, 101, 114, 95, 99, 111, 110, 115,
+117, 109, 101, 44, 10, 32, 32, 109, 101, 109, 111, 114, 121, 95, 111,
+114, 100, 101, 114, 95, 97, 99, 113, 117, 105, 114, 101, 44, 10, 32,
+32, 109, 101, 109, 111, 114, 121, 95, 111, 114, 100, 101, 114, 95,
+114, 101, 108, 101, 97, 115, 101, 44, 10, 32, 32, 109, 101, 109, 111,
+114, 121, 95, 111, 114, 100, 101, 114, 95, 97, 99, 113, 95, 114, 101,
+108, 44, 10, 32, 32, 109, 101, 109, 111, 114, 121, 95, 111, 114, 100,
+101, 114, 95, 115, 101, 113, 95, 99, 115, 116, 44, 10, 125, 32, 109,
+101, 109, 111, 114, 121, 95, 111, 114, 100, 101, 114, 59, 10, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 65, 84, 79, 77, 73, 67, 95, 70, 76,
+65, 71, 95, 73, 78, 73, 84, 40, 120, 41, 32, 40, 120, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 105, 110,
+105, 116, 40, 97, 100, 100, 114, 44, 32, 118, 97, 108, 41, 32, 40, 42,
+40, 97, 100, 100, 114, 41, 32, 61, 32, 40, 118, 97, 108, 41, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 107, 105, 108, 108, 95, 100,
+101, 112, 101, 110, 100, 101, 110, 99, 121, 40, 120, 41, 32, 40, 120,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105,
+99, 95, 116, 104, 114, 101, 97, 100, 95, 102, 101, 110, 99, 101, 40,
+111, 114, 100, 101, 114, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+97, 116, 111, 109, 105, 99, 95, 115, 105, 103, 110, 97, 108, 95, 102,
+101, 110, 99, 101, 40, 111, 114, 100, 101, 114, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 105, 115, 95,
+108, 111, 99, 107, 95, 102, 114, 101, 101, 40, 120, 41, 32, 49, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99,
+95, 108, 111, 97, 100, 40, 97, 100, 100, 114, 41, 32, 40, 42, 40, 97,
+100, 100, 114, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97,
+116, 111, 109, 105, 99, 95, 115, 116, 111, 114, 101, 40, 97, 100, 100,
+114, 44, 32, 118, 97, 108, 41, 32, 40, 42, 40, 97, 100, 100, 114, 41,
+32, 61, 32, 40, 118, 97, 108, 41, 41, 10, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 108, 111, 97, 100, 95,
+101, 120, 112, 108, 105, 99, 105, 116, 40, 97, 100, 100, 114, 44, 32,
+111, 114, 100, 101, 114, 41, 32, 40, 42, 40, 97, 100, 100, 114, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105,
+99, 95, 115, 116, 111, 114, 101, 95, 101, 120, 112, 108, 105, 99, 105,
+116, 40, 97, 100, 100, 114, 44, 32, 118, 97, 108, 44, 32, 111, 114,
+100, 101, 114, 41, 32, 40, 42, 40, 97, 100, 100, 114, 41, 32, 61, 32,
+40, 118, 97, 108, 41, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 97, 116, 111, 109, 105, 99, 95, 102, 101, 116, 99, 104, 95, 97,
+100, 100, 40, 111, 98, 106, 44, 32, 118, 97, 108, 41, 32, 40, 42, 40,
+111, 98, 106, 41, 32, 43, 61, 32, 40, 118, 97, 108, 41, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 102,
+101, 116, 99, 104, 95, 115, 117, 98, 40, 111, 98, 106, 44, 32, 118,
+97, 108, 41, 32, 40, 42, 40, 111, 98, 106, 41, 32, 45, 61, 32, 40,
+118, 97, 108, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97,
+116, 111, 109, 105, 99, 95, 102, 101, 116, 99, 104, 95, 111, 114, 40,
+111, 98, 106, 44, 32, 118, 97, 108, 41, 32, 40, 42, 40, 111, 98, 106,
+41, 32, 124, 61, 32, 40, 118, 97, 108, 41, 41, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 102, 101, 116, 99,
+104, 95, 120, 111, 114, 40, 111, 98, 106, 44, 32, 118, 97, 108, 41,
+32, 40, 42, 40, 111, 98, 106, 41, 32, 94, 61, 32, 40, 118, 97, 108,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109,
+105, 99, 95, 102, 101, 116, 99, 104, 95, 97, 110, 100, 40, 111, 98,
+106, 44, 32, 118, 97, 108, 41, 32, 40, 42, 40, 111, 98, 106, 41, 32,
+38, 61, 32, 40, 118, 97, 108, 41, 41, 10, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 102, 101, 116, 99, 104,
+95, 97, 100, 100, 95, 101, 120, 112, 108, 105, 99, 105, 116, 40, 111,
+98, 106, 44, 32, 118, 97, 108, 44, 32, 111, 114, 100, 101, 114, 41,
+32, 40, 42, 40, 111, 98, 106, 41, 32, 43, 61, 32, 40, 118, 97, 108,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109,
+105, 99, 95, 102, 101, 116, 99, 104, 95, 115, 117, 98, 95, 101, 120,
+112, 108, 105, 99, 105, 116, 40, 111, 98, 106, 44, 32, 118, 97, 108,
+44, 32, 111, 114, 100, 101, 114, 41, 32, 40, 42, 40, 111, 98, 106, 41,
+32, 45, 61, 32, 40, 118, 97, 108, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 97, 116, 111, 109, 105, 99, 95, 102, 101, 116, 99, 104,
+95, 111, 114, 95, 101, 120, 112, 108, 105, 99, 105, 116, 40, 111, 98,
+106, 44, 32, 118, 97, 108, 44, 32, 111, 114, 100, 101, 114, 41, 32,
+40, 42, 40, 111, 98, 106, 41, 32, 124, 61, 32, 40, 118, 97, 108, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105,
+99, 95, 102, 101, 116, 99, 104, 95, 120, 111, 114, 95, 101, 120, 112,
+108, 105, 99, 105, 116, 40, 111, 98, 106, 44, 32, 118, 97, 108, 44,
+32, 111, 114, 100, 101, 114, 41, 32, 40, 42, 40, 111, 98, 106, 41, 32,
+94, 61, 32, 40, 118, 97, 108, 41, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 97, 116, 111, 109, 105, 99, 95, 102, 101, 116, 99, 104, 95,
+97, 110, 100, 95, 101, 120, 112, 108, 105, 99, 105, 116, 40, 111, 98,
+106, 44, 32, 118, 97, 108, 44, 32, 111, 114, 100, 101, 114, 41, 32,
+40, 42, 40, 111, 98, 106, 41, 32, 38, 61, 32, 40, 118, 97, 108, 41,
+41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109,
+105, 99, 95, 99, 111, 109, 112, 97, 114, 101, 95, 101, 120, 99, 104,
+97, 110, 103, 101, 95, 119, 101, 97, 107, 40, 112, 44, 32, 111, 108,
+100, 44, 32, 110, 101, 119, 41, 32, 95, 95, 98, 117, 105, 108, 116,
+105, 110, 95, 99, 111, 109, 112, 97, 114, 101, 95, 97, 110, 100, 95,
+115, 119, 97, 112, 40, 40, 112, 41, 44, 32, 40, 111, 108, 100, 41, 44,
+32, 40, 110, 101, 119, 41, 41, 10, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 97, 116, 111, 109, 105, 99, 95, 99, 111, 109, 112, 97, 114,
+101, 95, 101, 120, 99, 104, 97, 110, 103, 101, 95, 115, 116, 114, 111,
+110, 103, 40, 112, 44, 32, 111, 108, 100, 44, 32, 110, 101, 119, 41,
+32, 95, 95, 98, 117, 105, 108, 116, 105, 110, 95, 99, 111, 109, 112,
+97, 114, 101, 95, 97, 110, 100, 95, 115, 119, 97, 112, 40, 40, 112,
+41, 44, 32, 40, 111, 108, 100, 41, 44, 32, 40, 110, 101, 119, 41, 41,
+10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105,
+99, 95, 101, 120, 99, 104, 97, 110, 103, 101, 40, 111, 98, 106, 44,
+32, 118, 97, 108, 41, 32, 95, 95, 98, 117, 105, 108, 116, 105, 110,
+95, 97, 116, 111, 109, 105, 99, 95, 101, 120, 99, 104, 97, 110, 103,
+101, 40, 40, 111, 98, 106, 41, 44, 32, 40, 118, 97, 108, 41, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95,
+101, 120, 99, 104, 97, 110, 103, 101, 95, 101, 120, 112, 108, 105, 99,
+105, 116, 40, 111, 98, 106, 44, 32, 118, 97, 108, 44, 32, 111, 114,
+100, 101, 114, 41, 32, 95, 95, 98, 117, 105, 108, 116, 105, 110, 95,
+97, 116, 111, 109, 105, 99, 95, 101, 120, 99, 104, 97, 110, 103, 101,
+40, 40, 111, 98, 106, 41, 44, 32, 40, 118, 97, 108, 41, 41, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111, 109, 105, 99, 95,
+102, 108, 97, 103, 95, 116, 101, 115, 116, 95, 97, 110, 100, 95, 115,
+101, 116, 40, 111, 98, 106, 41, 32, 97, 116, 111, 109, 105, 99, 95,
+101, 120, 99, 104, 97, 110, 103, 101, 40, 40, 111, 98, 106, 41, 44,
+32, 49, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 116, 111,
+109, 105, 99, 95, 102, 108, 97, 103, 95, 116, 101, 115, 116, 95, 97,
+110, 100, 95, 115, 101, 116, 95, 101, 120, 112, 108, 105, 99, 105,
+116, 40, 111, 98, 106, 44, 32, 111, 114, 100, 101, 114, 41, 32, 97,
+116, 111, 109, 105, 99, 95, 101, 120, 99, 104, 97, 110, 103, 101, 40,
+40, 111, 98, 106, 41, 44, 32, 49, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 97, 116, 111, 109, 105, 99, 95, 102, 108, 97, 103, 95, 99,
+108, 101, 97, 114, 40, 111, 98, 106, 41, 32, 40, 42, 40, 111, 98, 106,
+41, 32, 61, 32, 48, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 97,
+116, 111, 109, 105, 99, 95, 102, 108, 97, 103, 95, 99, 108, 101, 97,
+114, 95, 101, 120, 112, 108, 105, 99, 105, 116, 40, 111, 98, 106, 44,
+32, 111, 114, 100, 101, 114, 41, 32, 40, 42, 40, 111, 98, 106, 41, 32,
+61, 32, 48, 41, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65,
+116, 111, 109, 105, 99, 32, 95, 66, 111, 111, 108, 32, 97, 116, 111,
+109, 105, 99, 95, 102, 108, 97, 103, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 95, 66, 111, 111,
+108, 32, 97, 116, 111, 109, 105, 99, 95, 98, 111, 111, 108, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 99, 104, 97, 114, 32, 97, 116, 111, 109, 105, 99, 95, 99, 104, 97,
+114, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111,
+109, 105, 99, 32, 115, 105, 103, 110, 101, 100, 32, 99, 104, 97, 114,
+32, 97, 116, 111, 109, 105, 99, 95, 115, 99, 104, 97, 114, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 99, 104, 97, 114, 32,
+97, 116, 111, 109, 105, 99, 95, 117, 99, 104, 97, 114, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32,
+115, 104, 111, 114, 116, 32, 97, 116, 111, 109, 105, 99, 95, 115, 104,
+111, 114, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65,
+116, 111, 109, 105, 99, 32, 117, 110, 115, 105, 103, 110, 101, 100,
+32, 115, 104, 111, 114, 116, 32, 97, 116, 111, 109, 105, 99, 95, 117,
+115, 104, 111, 114, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102,
+32, 95, 65, 116, 111, 109, 105, 99, 32, 105, 110, 116, 32, 97, 116,
+111, 109, 105, 99, 95, 105, 110, 116, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 105, 110, 116, 32, 97, 116, 111, 109, 105, 99,
+95, 117, 105, 110, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+95, 65, 116, 111, 109, 105, 99, 32, 108, 111, 110, 103, 32, 97, 116,
+111, 109, 105, 99, 95, 108, 111, 110, 103, 59, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110, 115,
+105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 97, 116, 111,
+109, 105, 99, 95, 117, 108, 111, 110, 103, 59, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 108, 111, 110,
+103, 32, 108, 111, 110, 103, 32, 97, 116, 111, 109, 105, 99, 95, 108,
+108, 111, 110, 103, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95,
+65, 116, 111, 109, 105, 99, 32, 117, 110, 115, 105, 103, 110, 101,
+100, 32, 108, 111, 110, 103, 32, 108, 111, 110, 103, 32, 97, 116, 111,
+109, 105, 99, 95, 117, 108, 108, 111, 110, 103, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110,
+115, 105, 103, 110, 101, 100, 32, 115, 104, 111, 114, 116, 32, 97,
+116, 111, 109, 105, 99, 95, 99, 104, 97, 114, 49, 54, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 97, 116, 111, 109,
+105, 99, 95, 99, 104, 97, 114, 51, 50, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110,
+115, 105, 103, 110, 101, 100, 32, 97, 116, 111, 109, 105, 99, 95, 119,
+99, 104, 97, 114, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102,
+32, 95, 65, 116, 111, 109, 105, 99, 32, 115, 105, 103, 110, 101, 100,
+32, 99, 104, 97, 114, 32, 97, 116, 111, 109, 105, 99, 95, 105, 110,
+116, 95, 108, 101, 97, 115, 116, 56, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110,
+115, 105, 103, 110, 101, 100, 32, 99, 104, 97, 114, 32, 97, 116, 111,
+109, 105, 99, 95, 117, 105, 110, 116, 95, 108, 101, 97, 115, 116, 56,
+95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116,
+111, 109, 105, 99, 32, 115, 104, 111, 114, 116, 32, 97, 116, 111, 109,
+105, 99, 95, 105, 110, 116, 95, 108, 101, 97, 115, 116, 49, 54, 95,
+116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111,
+109, 105, 99, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 115,
+104, 111, 114, 116, 32, 97, 116, 111, 109, 105, 99, 95, 117, 105, 110,
+116, 95, 108, 101, 97, 115, 116, 49, 54, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 105,
+110, 116, 32, 97, 116, 111, 109, 105, 99, 95, 105, 110, 116, 95, 108,
+101, 97, 115, 116, 51, 50, 95, 116, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 105, 110, 116, 32, 97, 116, 111, 109, 105, 99,
+95, 117, 105, 110, 116, 95, 108, 101, 97, 115, 116, 51, 50, 95, 116,
+59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109,
+105, 99, 32, 108, 111, 110, 103, 32, 97, 116, 111, 109, 105, 99, 95,
+105, 110, 116, 95, 108, 101, 97, 115, 116, 54, 52, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 108, 111, 110, 103,
+32, 97, 116, 111, 109, 105, 99, 95, 117, 105, 110, 116, 95, 108, 101,
+97, 115, 116, 54, 52, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 115, 105, 103, 110, 101,
+100, 32, 99, 104, 97, 114, 32, 97, 116, 111, 109, 105, 99, 95, 105,
+110, 116, 95, 102, 97, 115, 116, 56, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110,
+115, 105, 103, 110, 101, 100, 32, 99, 104, 97, 114, 32, 97, 116, 111,
+109, 105, 99, 95, 117, 105, 110, 116, 95, 102, 97, 115, 116, 56, 95,
+116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111,
+109, 105, 99, 32, 115, 104, 111, 114, 116, 32, 97, 116, 111, 109, 105,
+99, 95, 105, 110, 116, 95, 102, 97, 115, 116, 49, 54, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 115, 104, 111, 114,
+116, 32, 97, 116, 111, 109, 105, 99, 95, 117, 105, 110, 116, 95, 102,
+97, 115, 116, 49, 54, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 105, 110, 116, 32, 97,
+116, 111, 109, 105, 99, 95, 105, 110, 116, 95, 102, 97, 115, 116, 51,
+50, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65,
+116, 111, 109, 105, 99, 32, 117, 110, 115, 105, 103, 110, 101, 100,
+32, 105, 110, 116, 32, 97, 116, 111, 109, 105, 99, 95, 117, 105, 110,
+116, 95, 102, 97, 115, 116, 51, 50, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 108, 111,
+110, 103, 32, 97, 116, 111, 109, 105, 99, 95, 105, 110, 116, 95, 102,
+97, 115, 116, 54, 52, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110, 115, 105, 103,
+110, 101, 100, 32, 108, 111, 110, 103, 32, 97, 116, 111, 109, 105, 99,
+95, 117, 105, 110, 116, 95, 102, 97, 115, 116, 54, 52, 95, 116, 59,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105,
+99, 32, 108, 111, 110, 103, 32, 97, 116, 111, 109, 105, 99, 95, 105,
+110, 116, 112, 116, 114, 95, 116, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 97, 116, 111, 109,
+105, 99, 95, 117, 105, 110, 116, 112, 116, 114, 95, 116, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32,
+117, 110, 115, 105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32,
+97, 116, 111, 109, 105, 99, 95, 115, 105, 122, 101, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111, 109, 105, 99,
+32, 108, 111, 110, 103, 32, 97, 116, 111, 109, 105, 99, 95, 112, 116,
+114, 100, 105, 102, 102, 95, 116, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 65, 116, 111, 109, 105, 99, 32, 108, 111, 110, 103,
+32, 97, 116, 111, 109, 105, 99, 95, 105, 110, 116, 109, 97, 120, 95,
+116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 95, 65, 116, 111,
+109, 105, 99, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 108,
+111, 110, 103, 32, 97, 116, 111, 109, 105, 99, 95, 117, 105, 110, 116,
+109, 97, 120, 95, 116, 59, 10, 10, 35, 101, 110, 100, 105, 102, 10, 0,
+35, 112, 114, 97, 103, 109, 97, 32, 111, 110, 99, 101, 10, 10, 35,
+105, 110, 99, 108, 117, 100, 101, 32, 60, 115, 116, 100, 100, 101,
+102, 46, 104, 62, 10, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60,
+115, 116, 100, 105, 110, 116, 46, 104, 62, 10, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 95, 82, 101, 102,
+108, 101, 99, 116, 84, 121, 112, 101, 32, 95, 82, 101, 102, 108, 101,
+99, 116, 84, 121, 112, 101, 59, 10, 116, 121, 112, 101, 100, 101, 102,
+32, 115, 116, 114, 117, 99, 116, 32, 95, 82, 101, 102, 108, 101, 99,
+116, 84, 121, 112, 101, 77, 101, 109, 98, 101, 114, 32, 95, 82, 101,
+102, 108, 101, 99, 116, 84, 121, 112, 101, 77, 101, 109, 98, 101, 114,
+59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99,
+116, 32, 95, 82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 69,
+110, 117, 109, 101, 114, 97, 110, 116, 32, 95, 82, 101, 102, 108, 101,
+99, 116, 84, 121, 112, 101, 69, 110, 117, 109, 101, 114, 97, 110, 116,
+59, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76,
+69, 67, 84, 95, 75, 73, 78, 68, 95, 86, 79, 73, 68, 32, 48, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95,
+75, 73, 78, 68, 95, 66, 79, 79, 76, 32, 49, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68,
+95, 67, 72, 65, 82, 32, 50, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 83, 72, 79,
+82, 84, 32, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69,
+70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 73, 78, 84, 32, 52, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84,
+95, 75, 73, 78, 68, 95, 76, 79, 78, 71, 32, 53, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68,
+95, 70, 76, 79, 65, 84, 32, 54, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 68, 79,
+85, 66, 76, 69, 32, 55, 10, 47, 47, 32, 84, 79, 68, 79, 58, 32, 76,
+68, 79, 85, 66, 76, 69, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 69, 78, 85, 77,
+32, 57, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76,
+69, 67, 84, 95, 75, 73, 78, 68, 95, 80, 84, 82, 32, 49, 48, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95,
+75, 73, 78, 68, 95, 70, 85, 78, 67, 32, 49, 49, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68,
+95, 65, 82, 82, 65, 89, 32, 49, 50, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 86,
+76, 65, 32, 49, 51, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82,
+69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 83, 84, 82, 85, 67,
+84, 32, 49, 52, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69,
+70, 76, 69, 67, 84, 95, 75, 73, 78, 68, 95, 85, 78, 73, 79, 78, 32,
+49, 53, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76,
+69, 67, 84, 95, 75, 73, 78, 68, 95, 73, 78, 84, 49, 50, 56, 32, 49,
+54, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76,
+69, 67, 84, 95, 84, 89, 80, 69, 70, 76, 65, 71, 95, 85, 78, 83, 73,
+71, 78, 69, 68, 32, 48, 120, 48, 48, 48, 49, 32, 32, 47, 47, 32, 73,
+110, 116, 101, 103, 101, 114, 32, 116, 121, 112, 101, 115, 32, 111,
+110, 108, 121, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69,
+70, 76, 69, 67, 84, 95, 84, 89, 80, 69, 70, 76, 65, 71, 95, 65, 84,
+79, 77, 73, 67, 32, 48, 120, 48, 48, 48, 50, 32, 32, 32, 32, 47, 47,
+32, 73, 110, 116, 101, 103, 101, 114, 32, 116, 121, 112, 101, 115, 32,
+111, 110, 108, 121, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82,
+69, 70, 76, 69, 67, 84, 95, 84, 89, 80, 69, 70, 76, 65, 71, 95, 70,
+76, 69, 88, 73, 66, 76, 69, 32, 48, 120, 48, 48, 48, 52, 32, 32, 47,
+47, 32, 65, 114, 114, 97, 121, 115, 32, 97, 116, 32, 101, 110, 100,
+32, 111, 102, 32, 115, 116, 114, 117, 99, 116, 115, 32, 111, 110, 108,
+121, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 82, 69, 70, 76, 69,
+67, 84, 95, 84, 89, 80, 69, 70, 76, 65, 71, 95, 80, 65, 67, 75, 69,
+68, 32, 48, 120, 48, 48, 48, 56, 32, 32, 32, 32, 47, 47, 32, 83, 116,
+114, 117, 99, 116, 115, 32, 97, 110, 100, 32, 117, 110, 105, 111, 110,
+115, 32, 111, 110, 108, 121, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 82, 69, 70, 76, 69, 67, 84, 95, 84, 89, 80, 69, 70, 76, 65, 71,
+95, 86, 65, 82, 73, 65, 68, 73, 67, 32, 48, 120, 48, 48, 49, 48, 32,
+32, 47, 47, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 111,
+110, 108, 121, 10, 10, 35, 105, 102, 100, 101, 102, 32, 95, 77, 83,
+67, 95, 86, 69, 82, 10, 35, 112, 114, 97, 103, 109, 97, 32, 119, 97,
+114, 110, 105, 110, 103, 40, 112, 117, 115, 104, 41, 10, 35, 112, 114,
+97, 103, 109, 97, 32, 119, 97, 114, 110, 105, 110, 103, 40, 100, 105,
+115, 97, 98, 108, 101, 32, 58, 32, 52, 50, 48, 48, 41, 32, 32, 47, 47,
+32, 90, 101, 114, 111, 45, 115, 105, 122, 101, 100, 32, 97, 114, 114,
+97, 121, 46, 10, 35, 112, 114, 97, 103, 109, 97, 32, 119, 97, 114,
+110, 105, 110, 103, 40, 100, 105, 115, 97, 98, 108, 101, 32, 58, 32,
+52, 50, 48, 49, 41, 32, 32, 47, 47, 32, 85, 110, 110, 97, 109, 101,
+100, 32, 117, 110, 105, 111, 110, 46, 10, 35, 101, 110, 100, 105, 102,
+10, 10, 115, 116, 114, 117, 99, 116, 32, 95, 82, 101, 102, 108, 101,
+99, 116, 84, 121, 112, 101, 77, 101, 109, 98, 101, 114, 32, 123, 10,
+32, 32, 95, 82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 42,
+32, 116, 121, 112, 101, 59, 10, 32, 32, 99, 104, 97, 114, 42, 32, 110,
+97, 109, 101, 59, 10, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32, 97,
+108, 105, 103, 110, 59, 10, 32, 32, 105, 110, 116, 51, 50, 95, 116,
+32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 110, 116, 51,
+50, 95, 116, 32, 98, 105, 116, 95, 119, 105, 100, 116, 104, 59, 32,
+32, 32, 47, 47, 32, 45, 49, 32, 105, 102, 32, 110, 111, 116, 32, 98,
+105, 116, 102, 105, 101, 108, 100, 10, 32, 32, 105, 110, 116, 51, 50,
+95, 116, 32, 98, 105, 116, 95, 111, 102, 102, 115, 101, 116, 59, 32,
+32, 47, 47, 32, 45, 49, 32, 105, 102, 32, 110, 111, 116, 32, 98, 105,
+116, 102, 105, 101, 108, 100, 10, 125, 59, 10, 10, 115, 116, 114, 117,
+99, 116, 32, 95, 82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101,
+69, 110, 117, 109, 101, 114, 97, 110, 116, 32, 123, 10, 32, 32, 95,
+82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 69, 110, 117, 109,
+101, 114, 97, 110, 116, 42, 32, 110, 101, 120, 116, 59, 10, 32, 32,
+99, 104, 97, 114, 42, 32, 110, 97, 109, 101, 59, 10, 32, 32, 105, 110,
+116, 51, 50, 95, 116, 32, 118, 97, 108, 117, 101, 59, 10, 125, 59, 10,
+10, 115, 116, 114, 117, 99, 116, 32, 95, 82, 101, 102, 108, 101, 99,
+116, 84, 121, 112, 101, 32, 123, 10, 32, 32, 99, 104, 97, 114, 42, 32,
+110, 97, 109, 101, 59, 32, 32, 47, 47, 32, 69, 105, 116, 104, 101,
+114, 32, 116, 104, 101, 32, 98, 117, 105, 108, 116, 45, 105, 110, 32,
+116, 121, 112, 101, 110, 97, 109, 101, 44, 32, 111, 114, 32, 116, 104,
+101, 32, 117, 115, 101, 114, 32, 100, 101, 99, 108, 97, 114, 101, 100,
+32, 111, 110, 101, 46, 10, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32,
+115, 105, 122, 101, 59, 10, 32, 32, 105, 110, 116, 51, 50, 95, 116,
+32, 97, 108, 105, 103, 110, 59, 10, 32, 32, 105, 110, 116, 51, 50, 95,
+116, 32, 107, 105, 110, 100, 59, 32, 32, 32, 47, 47, 32, 79, 110, 101,
+32, 111, 102, 32, 95, 82, 69, 70, 76, 69, 67, 84, 95, 75, 73, 78, 68,
+95, 42, 46, 10, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32, 102, 108,
+97, 103, 115, 59, 32, 32, 47, 47, 32, 67, 111, 109, 98, 105, 110, 97,
+116, 105, 111, 110, 32, 111, 102, 32, 95, 82, 69, 70, 76, 69, 67, 84,
+95, 84, 89, 80, 69, 70, 76, 65, 71, 95, 42, 46, 10, 10, 32, 32, 117,
+110, 105, 111, 110, 32, 123, 10, 32, 32, 32, 32, 115, 116, 114, 117,
+99, 116, 32, 123, 10, 32, 32, 32, 32, 32, 32, 95, 82, 101, 102, 108,
+101, 99, 116, 84, 121, 112, 101, 42, 32, 98, 97, 115, 101, 59, 10, 32,
+32, 32, 32, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32, 108, 101, 110,
+59, 10, 32, 32, 32, 32, 125, 32, 97, 114, 114, 59, 10, 32, 32, 32, 32,
+115, 116, 114, 117, 99, 116, 32, 123, 10, 32, 32, 32, 32, 32, 32, 95,
+82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 42, 32, 98, 97,
+115, 101, 59, 10, 32, 32, 32, 32, 125, 32, 112, 116, 114, 59, 10, 32,
+32, 32, 32, 115, 116, 114, 117, 99, 116, 32, 123, 10, 32, 32, 32, 32,
+32, 32, 115, 105, 122, 101, 95, 116, 32, 110, 117, 109, 95, 109, 101,
+109, 98, 101, 114, 115, 59, 10, 32, 32, 32, 32, 32, 32, 95, 82, 101,
+102, 108, 101, 99, 116, 84, 121, 112, 101, 77, 101, 109, 98, 101, 114,
+32, 109, 101, 109, 98, 101, 114, 115, 91, 93, 59, 10, 32, 32, 32, 32,
+125, 32, 115, 117, 59, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99,
+116, 32, 123, 10, 32, 32, 32, 32, 32, 32, 95, 82, 101, 102, 108, 101,
+99, 116, 84, 121, 112, 101, 42, 32, 114, 101, 116, 117, 114, 110, 95,
+116, 121, 59, 10, 32, 32, 32, 32, 32, 32, 115, 105, 122, 101, 95, 116,
+32, 110, 117, 109, 95, 112, 97, 114, 97, 109, 115, 59, 10, 32, 32, 32,
+32, 32, 32, 95, 82, 101, 102, 108, 101, 99, 116, 84, 121, 112, 101,
+42, 32, 112, 97, 114, 97, 109, 115, 91, 93, 59, 10, 32, 32, 32, 32,
+125, 32, 102, 117, 110, 99, 59, 10, 32, 32, 32, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 10, 32, 32, 32, 32, 32, 32, 95, 82, 101, 102,
+108, 101, 99, 116, 84, 121, 112, 101, 69, 110, 117, 109, 101, 114, 97,
+110, 116, 42, 32, 101, 110, 117, 109, 115, 59, 10, 32, 32, 32, 32,
+125, 32, 101, 110, 117, 109, 101, 114, 59, 10, 32, 32, 32, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 10, 32, 32, 32, 32, 32, 32, 95, 82,
+101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 42, 32, 118, 108, 97,
+95, 115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32,
+108, 101, 110, 63, 10, 32, 32, 32, 32, 125, 32, 118, 108, 97, 59, 10,
+32, 32, 125, 59, 10, 125, 59, 10, 35, 105, 102, 100, 101, 102, 32, 95,
+77, 83, 67, 95, 86, 69, 82, 10, 35, 112, 114, 97, 103, 109, 97, 32,
+119, 97, 114, 110, 105, 110, 103, 40, 112, 111, 112, 41, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 95, 95, 100, 121, 105,
+98, 105, 99, 99, 95, 95, 10, 101, 120, 116, 101, 114, 110, 32, 95, 82,
+101, 102, 108, 101, 99, 116, 84, 121, 112, 101, 42, 32, 95, 82, 101,
+102, 108, 101, 99, 116, 84, 121, 112, 101, 79, 102, 40, 46, 46, 46,
+41, 59, 10, 35, 101, 110, 100, 105, 102, 10, 0, 47, 47, 32, 66, 69,
+71, 73, 78, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110, 116, 97,
+105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46, 112,
+121, 10, 35, 105, 102, 110, 100, 101, 102, 32, 95, 95, 100, 121, 105,
+98, 105, 99, 99, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 105,
+110, 99, 108, 117, 100, 101, 95, 95, 10, 35, 101, 114, 114, 111, 114,
+32, 67, 97, 110, 32, 111, 110, 108, 121, 32, 98, 101, 32, 105, 110,
+99, 108, 117, 100, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 99,
+111, 109, 112, 105, 108, 101, 114, 44, 32, 111, 114, 32, 99, 111, 110,
+102, 117, 115, 105, 110, 103, 32, 101, 114, 114, 111, 114, 115, 32,
+119, 105, 108, 108, 32, 114, 101, 115, 117, 108, 116, 33, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 117, 110, 100, 101, 102, 32, 95, 95, 97,
+116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 99,
+104, 97, 114, 32, 117, 105, 110, 116, 56, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100,
+32, 108, 111, 110, 103, 32, 108, 111, 110, 103, 32, 117, 105, 110,
+116, 54, 52, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+117, 110, 115, 105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32,
+108, 111, 110, 103, 32, 115, 105, 122, 101, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 108, 111, 110, 103, 32, 108, 111, 110,
+103, 32, 105, 110, 116, 54, 52, 95, 116, 59, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 115, 105, 103, 110, 101, 100, 32, 99, 104, 97, 114,
+32, 105, 110, 116, 56, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 115, 105, 103, 110, 101, 100, 32, 115, 104, 111, 114, 116,
+32, 105, 110, 116, 49, 54, 95, 116, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 115, 104,
+111, 114, 116, 32, 117, 105, 110, 116, 49, 54, 95, 116, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 105, 103, 110, 101, 100, 32,
+105, 110, 116, 32, 105, 110, 116, 51, 50, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 108, 111, 110, 103, 32, 108, 111, 110,
+103, 32, 105, 110, 116, 112, 116, 114, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32,
+108, 111, 110, 103, 32, 108, 111, 110, 103, 32, 117, 105, 110, 116,
+112, 116, 114, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+108, 111, 110, 103, 32, 108, 111, 110, 103, 32, 112, 116, 114, 100,
+105, 102, 102, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+117, 110, 115, 105, 103, 110, 101, 100, 32, 105, 110, 116, 32, 117,
+105, 110, 116, 51, 50, 95, 116, 59, 10, 118, 111, 105, 100, 42, 32,
+109, 101, 109, 115, 101, 116, 40, 118, 111, 105, 100, 42, 32, 100,
+101, 115, 116, 44, 32, 105, 110, 116, 32, 99, 104, 44, 32, 115, 105,
+122, 101, 95, 116, 32, 99, 111, 117, 110, 116, 41, 59, 10, 118, 111,
+105, 100, 42, 32, 109, 101, 109, 99, 112, 121, 40, 118, 111, 105, 100,
+42, 32, 100, 101, 115, 116, 44, 32, 99, 111, 110, 115, 116, 32, 118,
+111, 105, 100, 42, 32, 115, 114, 99, 44, 32, 115, 105, 122, 101, 95,
+116, 32, 99, 111, 117, 110, 116, 41, 59, 10, 105, 110, 116, 32, 109,
+101, 109, 99, 109, 112, 40, 99, 111, 110, 115, 116, 32, 118, 111, 105,
+100, 42, 32, 108, 104, 115, 44, 32, 99, 111, 110, 115, 116, 32, 118,
+111, 105, 100, 42, 32, 114, 104, 115, 44, 32, 115, 105, 122, 101, 95,
+116, 32, 99, 111, 117, 110, 116, 41, 59, 10, 118, 111, 105, 100, 42,
+32, 109, 101, 109, 109, 111, 118, 101, 40, 118, 111, 105, 100, 42, 32,
+100, 101, 115, 116, 44, 32, 99, 111, 110, 115, 116, 32, 118, 111, 105,
+100, 42, 32, 115, 114, 99, 44, 32, 115, 105, 122, 101, 95, 116, 32,
+99, 111, 117, 110, 116, 41, 59, 10, 115, 105, 122, 101, 95, 116, 32,
+115, 116, 114, 108, 101, 110, 40, 99, 111, 110, 115, 116, 32, 99, 104,
+97, 114, 42, 32, 115, 116, 114, 41, 59, 10, 118, 111, 105, 100, 32,
+102, 114, 101, 101, 40, 118, 111, 105, 100, 42, 32, 112, 116, 114, 41,
+59, 10, 118, 111, 105, 100, 32, 42, 109, 97, 108, 108, 111, 99, 40,
+115, 105, 122, 101, 95, 116, 32, 115, 105, 122, 101, 41, 59, 10, 118,
+111, 105, 100, 32, 42, 99, 97, 108, 108, 111, 99, 40, 115, 105, 122,
+101, 95, 116, 32, 110, 117, 109, 44, 32, 115, 105, 122, 101, 95, 116,
+32, 115, 105, 122, 101, 41, 59, 10, 118, 111, 105, 100, 42, 32, 114,
+101, 97, 108, 108, 111, 99, 40, 118, 111, 105, 100, 42, 32, 112, 116,
+114, 44, 32, 115, 105, 122, 101, 95, 116, 32, 110, 101, 119, 95, 115,
+105, 122, 101, 41, 59, 10, 35, 100, 101, 102, 105, 110, 101, 32, 78,
+85, 76, 76, 32, 40, 40, 118, 111, 105, 100, 42, 41, 48, 41, 32, 47,
+42, 32, 116, 111, 100, 111, 33, 32, 42, 47, 10, 47, 47, 32, 35, 35,
+35, 32, 69, 78, 68, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110,
+116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46,
+112, 121, 10, 47, 47, 32, 35, 35, 35, 32, 66, 69, 71, 73, 78, 95, 70,
+73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 104, 109, 97, 112,
+46, 104, 10, 10, 47, 47, 32, 85, 110, 111, 114, 100, 101, 114, 101,
+100, 32, 115, 101, 116, 47, 109, 97, 112, 32, 45, 32, 105, 109, 112,
+108, 101, 109, 101, 110, 116, 101, 100, 32, 119, 105, 116, 104, 32,
+116, 104, 101, 32, 114, 111, 98, 105, 110, 45, 104, 111, 111, 100, 32,
+104, 97, 115, 104, 105, 110, 103, 32, 115, 99, 104, 101, 109, 101, 46,
+10, 47, 47, 32, 35, 35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76,
+69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 108, 105, 110, 107, 97,
+103, 101, 46, 104, 10, 35, 117, 110, 100, 101, 102, 32, 83, 84, 67,
+95, 65, 80, 73, 10, 35, 117, 110, 100, 101, 102, 32, 83, 84, 67, 95,
+68, 69, 70, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 115, 116, 97, 116, 105, 99, 32, 38, 38, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 83, 84, 67, 95, 83, 84, 65, 84,
+73, 67, 32, 32, 38, 38, 32, 40, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 104, 101, 97, 100, 101, 114, 32, 124, 124, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 83, 84, 67, 95, 72, 69, 65, 68, 69, 82, 32,
+32, 124, 124, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+105, 109, 112, 108, 101, 109, 101, 110, 116, 32, 124, 124, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 83, 84, 67, 95, 73, 77, 80, 76, 69,
+77, 69, 78, 84, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+83, 84, 67, 95, 65, 80, 73, 32, 101, 120, 116, 101, 114, 110, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 68, 69, 70,
+10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 105, 95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 32,
+32, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95,
+71, 78, 85, 67, 95, 95, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 95, 95, 99, 108, 97, 110, 103, 95, 95, 32, 124, 124, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 73, 78, 84, 69, 76, 95,
+76, 76, 86, 77, 95, 67, 79, 77, 80, 73, 76, 69, 82, 10, 32, 32, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 65, 80, 73,
+32, 115, 116, 97, 116, 105, 99, 32, 95, 95, 97, 116, 116, 114, 105,
+98, 117, 116, 101, 95, 95, 40, 40, 117, 110, 117, 115, 101, 100, 41,
+41, 10, 32, 32, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 65, 80, 73, 32, 115, 116,
+97, 116, 105, 99, 32, 105, 110, 108, 105, 110, 101, 10, 32, 32, 35,
+101, 110, 100, 105, 102, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 83, 84, 67, 95, 68, 69, 70, 32, 115, 116, 97, 116, 105, 99, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 83, 84, 67, 95, 73, 77, 80, 76, 69, 77, 69, 78, 84,
+32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 105,
+109, 112, 111, 114, 116, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 108,
+108, 111, 99, 97, 116, 111, 114, 32, 99, 10, 35, 101, 110, 100, 105,
+102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 102, 114, 101,
+101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 109,
+97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 97,
+108, 108, 111, 99, 97, 116, 111, 114, 44, 32, 95, 109, 97, 108, 108,
+111, 99, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105,
+95, 99, 97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 97, 108, 108, 111, 99, 97, 116, 111, 114, 44, 32, 95, 99, 97, 108,
+108, 111, 99, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 114, 101, 97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78,
+40, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114, 44, 32, 95,
+114, 101, 97, 108, 108, 111, 99, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 102, 114, 101, 101, 32, 99, 95, 74, 79,
+73, 78, 40, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114, 44, 32,
+95, 102, 114, 101, 101, 41, 10, 35, 101, 110, 100, 105, 102, 10, 10,
+35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 99,
+108, 97, 110, 103, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115,
+10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103,
+32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 117, 115,
+104, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110,
+103, 32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97,
+114, 110, 105, 110, 103, 32, 34, 45, 87, 97, 108, 108, 34, 10, 32, 32,
+35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100,
+105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105,
+110, 103, 32, 34, 45, 87, 101, 120, 116, 114, 97, 34, 10, 32, 32, 35,
+112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105,
+97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110,
+103, 32, 34, 45, 87, 112, 101, 100, 97, 110, 116, 105, 99, 34, 10, 32,
+32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110,
+105, 110, 103, 32, 34, 45, 87, 99, 111, 110, 118, 101, 114, 115, 105,
+111, 110, 34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108,
+97, 110, 103, 32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32,
+119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87, 119, 114, 105, 116,
+101, 45, 115, 116, 114, 105, 110, 103, 115, 34, 10, 32, 32, 47, 47,
+32, 105, 103, 110, 111, 114, 101, 100, 10, 32, 32, 35, 112, 114, 97,
+103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97, 103, 110,
+111, 115, 116, 105, 99, 32, 105, 103, 110, 111, 114, 101, 100, 32, 34,
+45, 87, 109, 105, 115, 115, 105, 110, 103, 45, 102, 105, 101, 108,
+100, 45, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 114, 115,
+34, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 95, 95, 71, 78, 85, 67, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102,
+105, 110, 101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117,
+115, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 117, 115,
+104, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110,
+105, 110, 103, 32, 34, 45, 87, 97, 108, 108, 34, 10, 32, 32, 35, 112,
+114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110,
+111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34,
+45, 87, 101, 120, 116, 114, 97, 34, 10, 32, 32, 35, 112, 114, 97, 103,
+109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110, 111, 115, 116,
+105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87, 112,
+101, 100, 97, 110, 116, 105, 99, 34, 10, 32, 32, 35, 112, 114, 97,
+103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110, 111, 115,
+116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87,
+99, 111, 110, 118, 101, 114, 115, 105, 111, 110, 34, 10, 32, 32, 35,
+112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103,
+110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32,
+34, 45, 87, 119, 114, 105, 116, 101, 45, 115, 116, 114, 105, 110, 103,
+115, 34, 10, 32, 32, 47, 47, 32, 105, 103, 110, 111, 114, 101, 100,
+10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100,
+105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110, 111,
+114, 101, 100, 32, 34, 45, 87, 99, 108, 111, 98, 98, 101, 114, 101,
+100, 34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67,
+32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110,
+111, 114, 101, 100, 32, 34, 45, 87, 105, 109, 112, 108, 105, 99, 105,
+116, 45, 102, 97, 108, 108, 116, 104, 114, 111, 117, 103, 104, 61, 51,
+34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110,
+111, 114, 101, 100, 32, 34, 45, 87, 115, 116, 114, 105, 110, 103, 111,
+112, 45, 111, 118, 101, 114, 102, 108, 111, 119, 61, 34, 10, 32, 32,
+35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103,
+110, 111, 115, 116, 105, 99, 32, 105, 103, 110, 111, 114, 101, 100,
+32, 34, 45, 87, 109, 105, 115, 115, 105, 110, 103, 45, 102, 105, 101,
+108, 100, 45, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 114,
+115, 34, 10, 35, 101, 110, 100, 105, 102, 10, 47, 47, 32, 35, 35, 35,
+32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69,
+58, 32, 108, 105, 110, 107, 97, 103, 101, 46, 104, 10, 47, 47, 32, 35,
+35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67,
+76, 85, 68, 69, 58, 32, 116, 121, 112, 101, 115, 46, 104, 10, 10, 35,
+105, 102, 100, 101, 102, 32, 105, 95, 97, 117, 120, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 97, 117, 120, 95, 100,
+101, 102, 32, 105, 95, 97, 117, 120, 32, 97, 117, 120, 59, 10, 35,
+101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 10, 35, 101, 110, 100,
+105, 102, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83, 84, 67,
+95, 84, 89, 80, 69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 84, 89, 80,
+69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 10, 47, 47,
+32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117,
+100, 101, 32, 60, 115, 116, 100, 105, 110, 116, 46, 104, 62, 10, 47,
+47, 32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117,
+100, 101, 32, 60, 115, 116, 100, 100, 101, 102, 46, 104, 62, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 114, 99, 40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 97, 114, 99, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95,
+118, 101, 99, 40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 115, 116, 97, 99, 107, 40, 67, 44, 32, 75, 69, 89,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 112, 113, 117, 101, 117, 101, 40, 67, 44, 32, 75, 69,
+89, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115, 116, 97, 99,
+107, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 100, 101, 113, 117, 101,
+40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 113, 117, 101, 117, 101, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95,
+104, 97, 115, 104, 109, 97, 112, 40, 67, 44, 32, 75, 69, 89, 44, 32,
+86, 65, 76, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 116, 97,
+98, 108, 101, 40, 67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 44, 32,
+99, 95, 116, 114, 117, 101, 44, 32, 99, 95, 102, 97, 108, 115, 101,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 104, 97, 115, 104, 115, 101, 116, 40, 67, 44, 32, 75,
+69, 89, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 116, 97, 98,
+108, 101, 40, 67, 44, 32, 99, 115, 101, 116, 44, 32, 75, 69, 89, 44,
+32, 75, 69, 89, 44, 32, 99, 95, 102, 97, 108, 115, 101, 44, 32, 99,
+95, 116, 114, 117, 101, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 115, 111, 114, 116, 101, 100,
+109, 97, 112, 40, 67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 41, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 97, 97, 116, 114, 101, 101, 40,
+67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 44, 32, 99, 95, 116, 114,
+117, 101, 44, 32, 99, 95, 102, 97, 108, 115, 101, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115,
+111, 114, 116, 101, 100, 115, 101, 116, 40, 67, 44, 32, 75, 69, 89,
+41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 97, 116, 114, 101,
+101, 40, 67, 44, 32, 75, 69, 89, 44, 32, 75, 69, 89, 44, 32, 99, 95,
+102, 97, 108, 115, 101, 44, 32, 99, 95, 116, 114, 117, 101, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114,
+101, 95, 104, 109, 97, 112, 40, 46, 46, 46, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 104, 97, 115, 104, 109, 97, 112, 40, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32, 91, 100, 101, 112,
+114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 115, 101, 116, 40,
+46, 46, 46, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 97, 115,
+104, 115, 101, 116, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 115, 109, 97, 112, 40, 46, 46, 46, 41, 32, 100, 101,
+99, 108, 97, 114, 101, 95, 115, 111, 114, 116, 101, 100, 109, 97, 112,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32,
+91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115,
+115, 101, 116, 40, 46, 46, 46, 41, 32, 100, 101, 99, 108, 97, 114,
+101, 95, 115, 111, 114, 116, 101, 100, 115, 101, 116, 40, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32, 91, 100, 101, 112,
+114, 101, 99, 97, 116, 101, 100, 93, 10, 10, 47, 47, 32, 99, 115, 118,
+105, 101, 119, 32, 58, 32, 110, 111, 110, 45, 110, 117, 108, 108, 32,
+116, 101, 114, 109, 105, 110, 97, 116, 101, 100, 32, 115, 116, 114,
+105, 110, 103, 32, 118, 105, 101, 119, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 99,
+115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 99, 115,
+118, 105, 101, 119, 32, 123, 10, 32, 32, 32, 32, 99, 115, 118, 105,
+101, 119, 95, 118, 97, 108, 117, 101, 42, 32, 98, 117, 102, 59, 10,
+32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 32, 115,
+105, 122, 101, 59, 10, 125, 32, 99, 115, 118, 105, 101, 119, 59, 10,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110,
+32, 123, 10, 32, 32, 32, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97,
+108, 117, 101, 42, 32, 114, 101, 102, 59, 10, 32, 32, 32, 32, 99, 115,
+118, 105, 101, 119, 32, 99, 104, 114, 59, 10, 32, 32, 32, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 118, 105, 101, 119, 32,
+99, 104, 114, 59, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97, 108,
+117, 101, 42, 32, 101, 110, 100, 59, 32, 125, 32, 117, 56, 59, 10,
+125, 32, 99, 115, 118, 105, 101, 119, 95, 105, 116, 101, 114, 59, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 118, 40, 46,
+46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69, 82, 76,
+79, 65, 68, 40, 99, 95, 115, 118, 44, 32, 95, 95, 86, 65, 95, 65, 82,
+71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+115, 118, 95, 49, 40, 108, 105, 116, 101, 114, 97, 108, 41, 32, 99,
+95, 115, 118, 95, 50, 40, 108, 105, 116, 101, 114, 97, 108, 44, 32,
+99, 95, 108, 105, 116, 115, 116, 114, 108, 101, 110, 40, 108, 105,
+116, 101, 114, 97, 108, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 115, 118, 95, 50, 40, 115, 116, 114, 44, 32, 110, 41, 32,
+40, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 99, 115, 118, 105,
+101, 119, 41, 123, 115, 116, 114, 44, 32, 110, 125, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 115, 118, 102, 109, 116, 32, 34,
+37, 46, 42, 115, 34, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+115, 118, 97, 114, 103, 40, 115, 118, 41, 32, 40, 105, 110, 116, 41,
+40, 115, 118, 41, 46, 115, 105, 122, 101, 44, 32, 40, 115, 118, 41,
+46, 98, 117, 102, 32, 47, 47, 32, 112, 114, 105, 110, 116, 102, 40,
+99, 95, 115, 118, 102, 109, 116, 32, 34, 92, 110, 34, 44, 32, 99, 95,
+115, 118, 97, 114, 103, 40, 115, 118, 41, 41, 59, 10, 10, 47, 47, 32,
+122, 115, 118, 105, 101, 119, 32, 58, 32, 122, 101, 114, 111, 45, 116,
+101, 114, 109, 105, 110, 97, 116, 101, 100, 32, 115, 116, 114, 105,
+110, 103, 32, 118, 105, 101, 119, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 32,
+122, 115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32,
+122, 115, 118, 105, 101, 119, 32, 123, 10, 32, 32, 32, 32, 122, 115,
+118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 42, 32, 115, 116, 114,
+59, 10, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116,
+32, 115, 105, 122, 101, 59, 10, 125, 32, 122, 115, 118, 105, 101, 119,
+59, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111,
+110, 32, 123, 10, 32, 32, 32, 32, 122, 115, 118, 105, 101, 119, 95,
+118, 97, 108, 117, 101, 42, 32, 114, 101, 102, 59, 10, 32, 32, 32, 32,
+99, 115, 118, 105, 101, 119, 32, 99, 104, 114, 59, 10, 125, 32, 122,
+115, 118, 105, 101, 119, 95, 105, 116, 101, 114, 59, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 122, 118, 40, 108, 105, 116, 101,
+114, 97, 108, 41, 32, 40, 99, 95, 108, 105, 116, 101, 114, 97, 108,
+40, 122, 115, 118, 105, 101, 119, 41, 123, 108, 105, 116, 101, 114,
+97, 108, 44, 32, 99, 95, 108, 105, 116, 115, 116, 114, 108, 101, 110,
+40, 108, 105, 116, 101, 114, 97, 108, 41, 125, 41, 10, 10, 47, 47, 32,
+99, 115, 116, 114, 32, 58, 32, 122, 101, 114, 111, 45, 116, 101, 114,
+109, 105, 110, 97, 116, 101, 100, 32, 111, 119, 110, 105, 110, 103,
+32, 115, 116, 114, 105, 110, 103, 32, 40, 115, 104, 111, 114, 116, 32,
+115, 116, 114, 105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122,
+101, 100, 32, 45, 32, 115, 115, 111, 41, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 99, 104, 97, 114, 32, 99, 115, 116, 114, 95, 118, 97,
+108, 117, 101, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 116, 114, 95, 118, 97,
+108, 117, 101, 42, 32, 100, 97, 116, 97, 59, 32, 105, 110, 116, 112,
+116, 114, 95, 116, 32, 115, 105, 122, 101, 44, 32, 99, 97, 112, 59,
+32, 125, 32, 99, 115, 116, 114, 95, 98, 117, 102, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110, 32, 99, 115,
+116, 114, 32, 123, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 123, 32, 117, 105, 110, 116, 112, 116, 114, 95, 116, 32, 115, 105,
+122, 101, 59, 32, 99, 115, 116, 114, 95, 118, 97, 108, 117, 101, 42,
+32, 100, 97, 116, 97, 59, 32, 117, 105, 110, 116, 112, 116, 114, 95,
+116, 32, 110, 99, 97, 112, 59, 32, 125, 32, 108, 111, 110, 59, 10, 32,
+32, 32, 32, 115, 116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 116,
+114, 95, 118, 97, 108, 117, 101, 32, 100, 97, 116, 97, 91, 32, 115,
+105, 122, 101, 111, 102, 40, 99, 115, 116, 114, 95, 98, 117, 102, 41,
+32, 45, 32, 49, 32, 93, 59, 32, 117, 105, 110, 116, 56, 95, 116, 32,
+115, 105, 122, 101, 59, 32, 125, 32, 115, 109, 108, 59, 10, 125, 32,
+99, 115, 116, 114, 59, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+117, 110, 105, 111, 110, 32, 123, 10, 32, 32, 32, 32, 99, 115, 118,
+105, 101, 119, 32, 99, 104, 114, 59, 32, 47, 47, 32, 117, 116, 102,
+56, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 47, 99, 111, 100,
+101, 112, 111, 105, 110, 116, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+116, 32, 99, 115, 116, 114, 95, 118, 97, 108, 117, 101, 42, 32, 114,
+101, 102, 59, 10, 125, 32, 99, 115, 116, 114, 95, 105, 116, 101, 114,
+59, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 116, 114,
+117, 101, 40, 46, 46, 46, 41, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 97,
+108, 115, 101, 40, 46, 46, 46, 41, 10, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 114, 99, 40,
+83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70,
+35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116,
+32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 32, 83, 69, 76, 70,
+35, 35, 95, 99, 116, 114, 108, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110, 32,
+83, 69, 76, 70, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 103, 101,
+116, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70,
+35, 35, 95, 99, 116, 114, 108, 42, 32, 99, 116, 114, 108, 49, 59, 32,
+92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 114,
+99, 50, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 32, 83,
+69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 59, 32, 92, 10, 92, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116,
+32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 40, 40,
+109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69, 76, 70,
+35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 92, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108,
+117, 101, 42, 32, 103, 101, 116, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 42, 32, 99,
+116, 114, 108, 50, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69,
+76, 70, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99,
+108, 97, 114, 101, 95, 98, 111, 120, 40, 83, 69, 76, 70, 44, 32, 86,
+65, 76, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108,
+117, 101, 59, 32, 92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102,
+32, 115, 116, 114, 117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105,
+98, 117, 116, 101, 95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99,
+97, 108, 108, 40, 83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69,
+76, 70, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69,
+76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 103, 101, 116, 59,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 113,
+117, 101, 117, 101, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32,
+92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65,
+76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32,
+92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40,
+83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 32, 42, 99, 98, 117, 102, 59, 32, 92, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95,
+116, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 44, 32, 99,
+97, 112, 109, 97, 115, 107, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 32, 92, 10, 32,
+32, 32, 32, 125, 32, 83, 69, 76, 70, 59, 32, 92, 10, 92, 10, 32, 32,
+32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99,
+116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76,
+70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102,
+102, 95, 116, 32, 112, 111, 115, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 99, 111, 110, 115, 116, 32, 83, 69, 76, 70, 42, 32, 95,
+115, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 35, 35,
+95, 105, 116, 101, 114, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 108, 105, 115, 116, 40, 83, 69,
+76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69,
+76, 70, 35, 35, 95, 110, 111, 100, 101, 32, 83, 69, 76, 70, 35, 35,
+95, 110, 111, 100, 101, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32,
+123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59, 32, 92, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111,
+100, 101, 32, 42, 99, 111, 110, 115, 116, 32, 42, 95, 108, 97, 115,
+116, 44, 32, 42, 112, 114, 101, 118, 59, 32, 92, 10, 32, 32, 32, 32,
+125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32, 92,
+10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95,
+95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83,
+69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95,
+110, 111, 100, 101, 32, 42, 108, 97, 115, 116, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104,
+116, 97, 98, 108, 101, 40, 83, 69, 76, 70, 44, 32, 75, 69, 89, 44, 32,
+86, 65, 76, 44, 32, 77, 65, 80, 95, 79, 78, 76, 89, 44, 32, 83, 69,
+84, 95, 79, 78, 76, 89, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 75, 69, 89, 32, 83, 69, 76, 70, 35, 35, 95,
+107, 101, 121, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 109,
+97, 112, 112, 101, 100, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116,
+121, 112, 101, 100, 101, 102, 32, 83, 69, 84, 95, 79, 78, 76, 89, 40,
+32, 83, 69, 76, 70, 35, 35, 95, 107, 101, 121, 32, 41, 32, 92, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 80, 95, 79, 78,
+76, 89, 40, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 32, 41, 32, 92, 10, 32, 32, 32, 32,
+83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 44, 32, 83, 69,
+76, 70, 35, 35, 95, 101, 110, 116, 114, 121, 59, 32, 92, 10, 92, 10,
+32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102,
+59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 105, 122, 101,
+95, 116, 32, 105, 100, 120, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 66, 111, 111, 108, 32, 105, 110, 115, 101, 114, 116, 101,
+100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 117, 105, 110,
+116, 56, 95, 116, 32, 104, 97, 115, 104, 120, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 117, 105, 110, 116, 49, 54, 95, 116, 32, 100,
+105, 115, 116, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76,
+70, 35, 35, 95, 114, 101, 115, 117, 108, 116, 59, 32, 92, 10, 92, 10,
+32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102,
+44, 32, 42, 95, 101, 110, 100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97, 112, 95, 109,
+101, 116, 97, 32, 42, 95, 109, 114, 101, 102, 59, 32, 92, 10, 32, 32,
+32, 32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59,
+32, 92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116,
+114, 117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116,
+101, 95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108,
+40, 83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32,
+123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 42, 32, 116, 97, 98, 108, 101, 59, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 42, 32, 109, 101, 116,
+97, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114,
+100, 105, 102, 102, 95, 116, 32, 115, 105, 122, 101, 44, 32, 98, 117,
+99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97,
+97, 116, 114, 101, 101, 40, 83, 69, 76, 70, 44, 32, 75, 69, 89, 44,
+32, 86, 65, 76, 44, 32, 77, 65, 80, 95, 79, 78, 76, 89, 44, 32, 83,
+69, 84, 95, 79, 78, 76, 89, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 75, 69, 89, 32, 83, 69, 76, 70, 35, 35,
+95, 107, 101, 121, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 109,
+97, 112, 112, 101, 100, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76,
+70, 35, 35, 95, 110, 111, 100, 101, 32, 83, 69, 76, 70, 35, 35, 95,
+110, 111, 100, 101, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 83, 69, 84, 95, 79, 78, 76, 89, 40, 32,
+83, 69, 76, 70, 35, 35, 95, 107, 101, 121, 32, 41, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 80, 95, 79, 78, 76,
+89, 40, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 32, 41, 32, 92, 10, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 44, 32, 83, 69, 76,
+70, 35, 35, 95, 101, 110, 116, 114, 121, 59, 32, 92, 10, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69,
+76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 66, 111, 111, 108, 32,
+105, 110, 115, 101, 114, 116, 101, 100, 59, 32, 92, 10, 32, 32, 32,
+32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 114, 101, 115, 117, 108, 116,
+59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 115, 116, 114, 117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117,
+101, 32, 42, 114, 101, 102, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111, 100, 101, 32, 42, 95,
+100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 110, 116,
+32, 95, 116, 111, 112, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+105, 110, 116, 51, 50, 95, 116, 32, 95, 116, 110, 44, 32, 95, 115,
+116, 91, 51, 54, 93, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69,
+76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32, 92, 10, 92, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 95,
+95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 40, 40, 109,
+101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69, 76, 70, 35, 35,
+95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111, 100, 101,
+32, 42, 110, 111, 100, 101, 115, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32, 114, 111, 111, 116,
+44, 32, 100, 105, 115, 112, 44, 32, 104, 101, 97, 100, 44, 32, 115,
+105, 122, 101, 44, 32, 99, 97, 112, 97, 99, 105, 116, 121, 59, 32, 92,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95,
+100, 101, 102, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70,
+10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 115, 116, 97, 99, 107, 95, 102, 105, 120, 101, 100, 40,
+83, 69, 76, 70, 44, 32, 86, 65, 76, 44, 32, 67, 65, 80, 41, 32, 92,
+10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76,
+32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92,
+10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116,
+114, 117, 99, 116, 32, 123, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97,
+108, 117, 101, 32, 42, 114, 101, 102, 44, 32, 42, 101, 110, 100, 59,
+32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32,
+92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99,
+116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95,
+40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69,
+76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 100, 97, 116, 97,
+91, 67, 65, 80, 93, 59, 32, 112, 116, 114, 100, 105, 102, 102, 95,
+116, 32, 115, 105, 122, 101, 59, 32, 125, 32, 83, 69, 76, 70, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 115, 116, 97, 99, 107, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41,
+32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86,
+65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59,
+32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32,
+115, 116, 114, 117, 99, 116, 32, 123, 32, 83, 69, 76, 70, 35, 35, 95,
+118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 44, 32, 42, 101, 110,
+100, 59, 32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114,
+59, 32, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40,
+83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123,
+32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 100,
+97, 116, 97, 59, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 32,
+115, 105, 122, 101, 44, 32, 99, 97, 112, 97, 99, 105, 116, 121, 59,
+32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 32, 125, 32, 83, 69,
+76, 70, 10, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84,
+67, 95, 84, 89, 80, 69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69,
+68, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69,
+95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 116, 121, 112, 101, 115, 46,
+104, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83, 84, 67, 95, 72,
+77, 65, 80, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 72, 77, 65, 80, 95, 72,
+95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 47, 47, 32, 35, 35, 35, 32,
+66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68,
+69, 58, 32, 99, 111, 109, 109, 111, 110, 46, 104, 10, 35, 105, 102,
+110, 100, 101, 102, 32, 83, 84, 67, 95, 67, 79, 77, 77, 79, 78, 95,
+72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 83, 84, 67, 95, 67, 79, 77, 77, 79, 78, 95, 72, 95, 73,
+78, 67, 76, 85, 68, 69, 68, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+95, 77, 83, 67, 95, 86, 69, 82, 10, 32, 32, 32, 32, 35, 112, 114, 97,
+103, 109, 97, 32, 119, 97, 114, 110, 105, 110, 103, 40, 100, 105, 115,
+97, 98, 108, 101, 58, 32, 52, 49, 49, 54, 32, 52, 57, 57, 54, 41, 32,
+47, 47, 32, 117, 110, 110, 97, 109, 101, 100, 32, 116, 121, 112, 101,
+32, 100, 101, 102, 105, 110, 105, 116, 105, 111, 110, 32, 105, 110,
+32, 112, 97, 114, 101, 110, 116, 104, 101, 115, 101, 115, 10, 35, 101,
+110, 100, 105, 102, 10, 47, 47, 32, 69, 88, 67, 76, 85, 68, 69, 68,
+32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110, 116, 97,
+105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46, 112,
+121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60, 105, 110, 116,
+116, 121, 112, 101, 115, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67, 76,
+85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99, 111,
+110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114,
+115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60,
+115, 116, 100, 100, 101, 102, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67,
+76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99,
+111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101,
+114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32,
+60, 115, 116, 100, 98, 111, 111, 108, 46, 104, 62, 10, 47, 47, 32, 69,
+88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110,
+95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100,
+101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101,
+32, 60, 115, 116, 114, 105, 110, 103, 46, 104, 62, 10, 47, 47, 32, 69,
+88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110,
+95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100,
+101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101,
+32, 60, 97, 115, 115, 101, 114, 116, 46, 104, 62, 10, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 112, 116, 114, 100, 105, 102, 102, 95,
+116, 32, 32, 32, 32, 32, 32, 32, 105, 115, 105, 122, 101, 59, 10, 35,
+105, 102, 110, 100, 101, 102, 32, 83, 84, 67, 95, 78, 79, 95, 73, 78,
+84, 95, 68, 69, 70, 83, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100,
+101, 102, 32, 105, 110, 116, 56, 95, 116, 32, 32, 32, 32, 32, 32, 105,
+110, 116, 56, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 117, 105, 110, 116, 56, 95, 116, 32, 32, 32, 32, 32, 117,
+105, 110, 116, 56, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100,
+101, 102, 32, 105, 110, 116, 49, 54, 95, 116, 32, 32, 32, 32, 32, 105,
+110, 116, 49, 54, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100,
+101, 102, 32, 117, 105, 110, 116, 49, 54, 95, 116, 32, 32, 32, 32,
+117, 105, 110, 116, 49, 54, 59, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 105, 110, 116, 51, 50, 95, 116, 32, 32, 32,
+32, 32, 105, 110, 116, 51, 50, 59, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 117, 105, 110, 116, 51, 50, 95, 116, 32, 32,
+32, 32, 117, 105, 110, 116, 51, 50, 59, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 105, 110, 116, 54, 52, 95, 116, 32, 32,
+32, 32, 32, 105, 110, 116, 54, 52, 59, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 105, 110, 116, 54, 52, 95, 116, 32,
+32, 32, 32, 117, 105, 110, 116, 54, 52, 59, 10, 35, 101, 110, 100,
+105, 102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 83, 84, 67, 95, 72, 65, 83, 95, 84, 89, 80, 69, 79, 70, 32, 38,
+38, 32, 40, 95, 77, 83, 67, 95, 70, 85, 76, 76, 95, 86, 69, 82, 32,
+62, 61, 32, 49, 57, 51, 57, 51, 51, 52, 50, 56, 32, 124, 124, 32, 92,
+10, 32, 32, 32, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 71,
+78, 85, 67, 95, 95, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 95, 99, 108, 97, 110, 103, 95, 95, 32, 124, 124, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 95, 95, 84, 73, 78, 89, 67, 95, 95,
+41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84,
+67, 95, 72, 65, 83, 95, 84, 89, 80, 69, 79, 70, 32, 49, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 95, 95, 71, 78, 85, 67, 95, 95, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 71, 78, 85, 65, 84, 84, 82, 40,
+46, 46, 46, 41, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+95, 95, 40, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41,
+10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 71, 78, 85, 65, 84, 84, 82, 40, 46, 46, 46, 41, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 115, 116, 97, 116, 105,
+99, 32, 105, 110, 108, 105, 110, 101, 32, 99, 95, 71, 78, 85, 65, 84,
+84, 82, 40, 117, 110, 117, 115, 101, 100, 41, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 90, 73, 32, 80, 82, 73, 105, 80, 84, 82,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 90, 85, 32, 80, 82,
+73, 117, 80, 84, 82, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+78, 80, 79, 83, 32, 73, 78, 84, 80, 84, 82, 95, 77, 65, 88, 10, 10,
+47, 47, 32, 77, 97, 99, 114, 111, 32, 111, 118, 101, 114, 108, 111,
+97, 100, 105, 110, 103, 32, 102, 101, 97, 116, 117, 114, 101, 32, 115,
+117, 112, 112, 111, 114, 116, 32, 98, 97, 115, 101, 100, 32, 111, 110,
+58, 32, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 120, 116, 101,
+115, 116, 101, 114, 46, 99, 111, 109, 47, 79, 78, 80, 56, 48, 49, 48,
+55, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 77, 65, 67, 82,
+79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 110, 97, 109, 101, 44, 32,
+46, 46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 99, 95, 74, 79, 73, 78,
+40, 99, 95, 74, 79, 73, 78, 48, 40, 110, 97, 109, 101, 44, 95, 41, 44,
+99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 95, 95, 86, 65, 95, 65, 82,
+71, 83, 95, 95, 41, 41, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 74, 79, 73,
+78, 48, 40, 97, 44, 32, 98, 41, 32, 97, 32, 35, 35, 32, 98, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 74, 79, 73, 78, 40, 97, 44,
+32, 98, 41, 32, 99, 95, 74, 79, 73, 78, 48, 40, 97, 44, 32, 98, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 69, 88, 80, 65, 78,
+68, 40, 46, 46, 46, 41, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 78, 85, 77, 65,
+82, 71, 83, 40, 46, 46, 46, 41, 32, 95, 99, 95, 65, 80, 80, 76, 89,
+95, 65, 82, 71, 95, 78, 40, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 44, 32, 95, 99, 95, 82, 83, 69, 81, 95, 78, 41, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 99, 95, 65, 80, 80, 76, 89, 95,
+65, 82, 71, 95, 78, 40, 97, 114, 103, 115, 41, 32, 95, 99, 95, 65, 82,
+71, 95, 78, 32, 97, 114, 103, 115, 32, 32, 47, 47, 32, 119, 114, 97,
+112, 32, 99, 95, 69, 88, 80, 65, 78, 68, 40, 46, 46, 41, 32, 102, 111,
+114, 32, 77, 83, 86, 67, 32, 119, 105, 116, 104, 111, 117, 116, 32,
+47, 115, 116, 100, 58, 99, 49, 49, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 99, 95, 82, 83, 69, 81, 95, 78, 32, 49, 54, 44, 32, 49,
+53, 44, 32, 49, 52, 44, 32, 49, 51, 44, 32, 49, 50, 44, 32, 49, 49,
+44, 32, 49, 48, 44, 32, 57, 44, 32, 56, 44, 32, 55, 44, 32, 54, 44,
+32, 53, 44, 32, 52, 44, 32, 51, 44, 32, 50, 44, 32, 49, 44, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 99, 95, 65, 82, 71, 95, 78, 40,
+95, 49, 44, 95, 50, 44, 95, 51, 44, 95, 52, 44, 95, 53, 44, 95, 54,
+44, 95, 55, 44, 95, 56, 44, 95, 57, 44, 95, 49, 48, 44, 95, 49, 49,
+44, 95, 49, 50, 44, 95, 49, 51, 44, 95, 49, 52, 44, 95, 49, 53, 44,
+95, 49, 54, 44, 78, 44, 46, 46, 46, 41, 32, 78, 10, 10, 47, 47, 32,
+83, 97, 116, 117, 114, 97, 116, 101, 100, 32, 111, 118, 101, 114, 108,
+111, 97, 100, 105, 110, 103, 10, 47, 47, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 102, 111, 111, 40, 46, 46, 46, 41, 32, 102, 111, 111,
+95, 73, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 44, 32, 99,
+95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 51, 41, 44, 32,
+99, 95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 50, 41, 44,
+32, 99, 95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 49, 41,
+44, 41, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 47,
+47, 32, 35, 100, 101, 102, 105, 110, 101, 32, 102, 111, 111, 95, 73,
+40, 97, 44, 98, 44, 99, 44, 32, 110, 44, 32, 46, 46, 46, 41, 32, 99,
+95, 84, 85, 80, 76, 69, 95, 65, 84, 95, 49, 40, 110, 44, 32, 102, 111,
+111, 95, 110, 44, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 84, 85, 80, 76, 69, 95, 65, 84, 95, 49, 40, 120, 44, 121, 44, 46,
+46, 46, 41, 32, 121, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+67, 79, 77, 77, 65, 95, 78, 40, 120, 41, 32, 44, 120, 10, 10, 47, 47,
+32, 83, 101, 108, 101, 99, 116, 32, 97, 114, 103, 44, 32, 101, 46,
+103, 46, 32, 102, 111, 114, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 116, 121, 112, 101, 32, 65, 44, 66, 32, 116, 104, 101, 110,
+32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 50, 44, 32, 105, 95, 116, 121,
+112, 101, 41, 32, 105, 115, 32, 66, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 78, 44, 32, 46, 46, 46,
+41, 32, 99, 95, 65, 82, 71, 95, 35, 35, 78, 40, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 44, 41, 32, 47, 47, 32, 119, 114, 97, 112, 32,
+99, 95, 69, 88, 80, 65, 78, 68, 40, 46, 46, 41, 32, 102, 111, 114, 32,
+77, 83, 86, 67, 32, 119, 105, 116, 104, 111, 117, 116, 32, 47, 115,
+116, 100, 58, 99, 49, 49, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 65, 82, 71, 95, 49, 40, 97, 44, 32, 46, 46, 46, 41, 32, 97,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 50,
+40, 97, 44, 32, 98, 44, 32, 46, 46, 46, 41, 32, 98, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 51, 40, 97, 44, 32,
+98, 44, 32, 99, 44, 32, 46, 46, 46, 41, 32, 99, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 52, 40, 97, 44, 32, 98, 44,
+32, 99, 44, 32, 100, 44, 32, 46, 46, 46, 41, 32, 100, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 105, 95, 109, 97, 108, 108, 111, 99,
+40, 84, 44, 32, 110, 41, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 105,
+95, 109, 97, 108, 108, 111, 99, 40, 40, 110, 41, 42, 99, 95, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 99, 97, 108, 108, 111, 99, 40, 84, 44, 32,
+110, 41, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 105, 95, 99, 97, 108,
+108, 111, 99, 40, 40, 110, 41, 44, 32, 99, 95, 115, 105, 122, 101,
+111, 102, 40, 84, 41, 41, 41, 10, 35, 105, 102, 110, 100, 101, 102,
+32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110, 101, 119,
+40, 84, 44, 32, 46, 46, 46, 41, 32, 32, 32, 40, 40, 84, 42, 41, 99,
+95, 115, 97, 102, 101, 95, 109, 101, 109, 99, 112, 121, 40, 99, 95,
+109, 97, 108, 108, 111, 99, 40, 99, 95, 115, 105, 122, 101, 111, 102,
+40, 84, 41, 41, 44, 32, 40, 40, 84, 91, 93, 41, 123, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 125, 41, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 84, 41, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40,
+84, 41, 32, 32, 32, 32, 40, 84, 41, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114,
+97, 121, 40, 84, 44, 32, 46, 46, 46, 41, 32, 40, 40, 84, 91, 93, 41,
+95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 32, 32, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 107, 101, 95,
+97, 114, 114, 97, 121, 50, 100, 40, 84, 44, 32, 78, 44, 32, 46, 46,
+46, 41, 32, 40, 40, 84, 91, 93, 91, 78, 93, 41, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 10, 35, 101, 108, 115, 101, 10, 47, 47,
+32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 32, 32, 32, 32, 35, 105,
+110, 99, 108, 117, 100, 101, 32, 60, 110, 101, 119, 62, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110, 101, 119,
+40, 84, 44, 32, 46, 46, 46, 41, 32, 32, 32, 32, 32, 32, 32, 110, 101,
+119, 32, 40, 99, 95, 109, 97, 108, 108, 111, 99, 40, 99, 95, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 41, 41, 32, 84, 40, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 84,
+41, 32, 32, 32, 32, 32, 32, 32, 32, 84, 10, 32, 32, 32, 32, 116, 101,
+109, 112, 108, 97, 116, 101, 60, 116, 121, 112, 101, 110, 97, 109,
+101, 32, 84, 44, 32, 105, 110, 116, 32, 77, 44, 32, 105, 110, 116, 32,
+78, 62, 32, 115, 116, 114, 117, 99, 116, 32, 95, 99, 95, 65, 114, 114,
+97, 121, 32, 123, 32, 84, 32, 100, 97, 116, 97, 91, 77, 93, 91, 78,
+93, 59, 32, 125, 59, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114, 97, 121, 40, 84,
+44, 32, 46, 46, 46, 41, 32, 40, 95, 99, 95, 65, 114, 114, 97, 121, 60,
+84, 44, 32, 49, 44, 32, 115, 105, 122, 101, 111, 102, 40, 40, 84, 91,
+93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 62, 123, 123, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 125, 125, 46, 100, 97, 116, 97, 91, 48, 93, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109,
+97, 107, 101, 95, 97, 114, 114, 97, 121, 50, 100, 40, 84, 44, 32, 78,
+44, 32, 46, 46, 46, 41, 32, 40, 95, 99, 95, 65, 114, 114, 97, 121, 60,
+84, 44, 32, 115, 105, 122, 101, 111, 102, 40, 40, 84, 91, 93, 91, 78,
+93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105,
+122, 101, 111, 102, 40, 84, 91, 78, 93, 41, 44, 32, 78, 62, 123, 95,
+95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 125, 46, 100, 97, 116, 97, 41,
+10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 100, 101, 102, 32,
+83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 10, 32, 32, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 108, 108,
+111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 83, 84, 67, 95, 65, 76, 76,
+79, 67, 65, 84, 79, 82, 44, 32, 95, 109, 97, 108, 108, 111, 99, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99,
+97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 83, 84, 67, 95,
+65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32, 95, 99, 97, 108, 108, 111,
+99, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 114, 101, 97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40,
+83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32, 95, 114,
+101, 97, 108, 108, 111, 99, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 102, 114, 101, 101, 32, 99, 95, 74, 79, 73,
+78, 40, 83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32,
+95, 102, 114, 101, 101, 41, 10, 35, 101, 108, 115, 101, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 108,
+108, 111, 99, 40, 115, 122, 41, 32, 32, 32, 32, 32, 32, 32, 32, 109,
+97, 108, 108, 111, 99, 40, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 115, 122, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 99, 97, 108, 108, 111, 99, 40, 110, 44, 32, 115,
+122, 41, 32, 32, 32, 32, 32, 99, 97, 108, 108, 111, 99, 40, 99, 95,
+105, 50, 117, 95, 115, 105, 122, 101, 40, 110, 41, 44, 32, 99, 95,
+105, 50, 117, 95, 115, 105, 122, 101, 40, 115, 122, 41, 41, 10, 32,
+32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 101,
+97, 108, 108, 111, 99, 40, 112, 116, 114, 44, 32, 111, 108, 100, 95,
+115, 122, 44, 32, 115, 122, 41, 32, 114, 101, 97, 108, 108, 111, 99,
+40, 112, 116, 114, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 49, 32, 63, 32, 40, 115, 122, 41, 32, 58, 32, 40, 111, 108,
+100, 95, 115, 122, 41, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 102, 114, 101, 101, 40, 112, 116, 114, 44,
+32, 115, 122, 41, 32, 32, 32, 32, 32, 40, 40, 118, 111, 105, 100, 41,
+40, 115, 122, 41, 44, 32, 102, 114, 101, 101, 40, 112, 116, 114, 41,
+41, 10, 35, 101, 110, 100, 105, 102, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 110, 101, 119, 95, 110, 40, 84, 44, 32, 110, 41, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 99, 95,
+99, 97, 108, 108, 111, 99, 40, 110, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 84, 41, 41, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 100, 101, 108, 101, 116, 101, 40, 84, 44, 32, 112,
+116, 114, 41, 32, 32, 32, 32, 32, 32, 32, 32, 100, 111, 32, 123, 32,
+84, 42, 32, 95, 116, 112, 32, 61, 32, 112, 116, 114, 59, 32, 84, 35,
+35, 95, 100, 114, 111, 112, 40, 95, 116, 112, 41, 59, 32, 99, 95, 102,
+114, 101, 101, 40, 95, 116, 112, 44, 32, 99, 95, 115, 105, 122, 101,
+111, 102, 40, 84, 41, 41, 59, 32, 125, 32, 119, 104, 105, 108, 101,
+32, 40, 48, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100,
+101, 108, 101, 116, 101, 95, 110, 40, 84, 44, 32, 112, 116, 114, 44,
+32, 110, 41, 32, 32, 32, 100, 111, 32, 123, 32, 84, 42, 32, 95, 116,
+112, 32, 61, 32, 112, 116, 114, 59, 32, 105, 115, 105, 122, 101, 32,
+95, 110, 32, 61, 32, 110, 44, 32, 95, 109, 32, 61, 32, 95, 110, 59,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 95, 110, 45,
+45, 41, 32, 84, 35, 35, 95, 100, 114, 111, 112, 40, 40, 95, 116, 112,
+32, 43, 32, 95, 110, 41, 41, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 95, 102,
+114, 101, 101, 40, 95, 116, 112, 44, 32, 95, 109, 42, 99, 95, 115,
+105, 122, 101, 111, 102, 40, 84, 41, 41, 59, 32, 125, 32, 119, 104,
+105, 108, 101, 32, 40, 48, 41, 10, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 115, 116, 97, 116, 105, 99, 95, 97, 115, 115, 101,
+114, 116, 40, 101, 120, 112, 114, 41, 32, 32, 32, 40, 118, 111, 105,
+100, 41, 115, 105, 122, 101, 111, 102, 40, 105, 110, 116, 91, 40, 101,
+120, 112, 114, 41, 32, 63, 32, 49, 32, 58, 32, 45, 49, 93, 41, 10, 35,
+105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 83, 84, 67, 95,
+78, 68, 69, 66, 85, 71, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 78, 68, 69, 66, 85, 71, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40,
+101, 120, 112, 114, 41, 32, 32, 32, 32, 32, 32, 40, 118, 111, 105,
+100, 41, 115, 105, 122, 101, 111, 102, 40, 101, 120, 112, 114, 41, 10,
+35, 101, 108, 115, 101, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83,
+84, 67, 95, 65, 83, 83, 69, 82, 84, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 83, 84, 67, 95, 65, 83, 83, 69, 82, 84, 40, 101, 120, 112,
+114, 41, 10, 35, 101, 110, 100, 105, 102, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40,
+101, 120, 112, 114, 41, 32, 32, 32, 32, 32, 32, 83, 84, 67, 95, 65,
+83, 83, 69, 82, 84, 40, 101, 120, 112, 114, 41, 10, 35, 101, 110, 100,
+105, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99, 111,
+110, 116, 97, 105, 110, 101, 114, 95, 111, 102, 40, 112, 44, 32, 67,
+44, 32, 109, 41, 32, 40, 40, 67, 42, 41, 40, 40, 99, 104, 97, 114, 42,
+41, 40, 49, 32, 63, 32, 40, 112, 41, 32, 58, 32, 38, 40, 40, 67, 42,
+41, 48, 41, 45, 62, 109, 41, 32, 45, 32, 111, 102, 102, 115, 101, 116,
+111, 102, 40, 67, 44, 32, 109, 41, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 99, 111, 110, 115, 116, 95, 99, 97, 115, 116,
+40, 84, 112, 44, 32, 112, 41, 32, 32, 32, 32, 32, 40, 40, 84, 112, 41,
+40, 49, 32, 63, 32, 40, 112, 41, 32, 58, 32, 40, 84, 112, 41, 48, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 108, 105, 116,
+115, 116, 114, 108, 101, 110, 40, 108, 105, 116, 101, 114, 97, 108,
+41, 32, 32, 32, 32, 40, 99, 95, 115, 105, 122, 101, 111, 102, 40, 34,
+34, 32, 108, 105, 116, 101, 114, 97, 108, 41, 32, 45, 32, 49, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99, 111, 117, 110, 116,
+111, 102, 40, 97, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+40, 105, 115, 105, 122, 101, 41, 40, 115, 105, 122, 101, 111, 102, 40,
+97, 41, 47, 115, 105, 122, 101, 111, 102, 32, 48, 91, 97, 93, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 97, 114, 114, 97, 121,
+108, 101, 110, 40, 97, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+99, 95, 99, 111, 117, 110, 116, 111, 102, 40, 97, 41, 10, 10, 47, 47,
+32, 101, 120, 112, 101, 99, 116, 32, 115, 105, 103, 110, 101, 100, 32,
+105, 110, 116, 115, 32, 116, 111, 47, 102, 114, 111, 109, 32, 116,
+104, 101, 115, 101, 32, 40, 117, 115, 101, 32, 119, 105, 116, 104, 32,
+103, 99, 99, 32, 45, 87, 99, 111, 110, 118, 101, 114, 115, 105, 111,
+110, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 105,
+122, 101, 111, 102, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 40, 105, 115, 105, 122, 101, 41, 115, 105, 122, 101,
+111, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 116,
+114, 108, 101, 110, 40, 115, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 40, 105, 115, 105, 122, 101, 41, 115, 116, 114, 108,
+101, 110, 40, 115, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 115, 116, 114, 110, 99, 109, 112, 40, 97, 44, 32, 98, 44, 32, 105,
+108, 101, 110, 41, 32, 32, 32, 115, 116, 114, 110, 99, 109, 112, 40,
+97, 44, 32, 98, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122, 101,
+40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 109, 101, 109, 99, 112, 121, 40, 100, 44, 32, 115, 44, 32,
+105, 108, 101, 110, 41, 32, 32, 32, 32, 109, 101, 109, 99, 112, 121,
+40, 100, 44, 32, 115, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 109, 101, 109, 109, 111, 118, 101, 40, 100, 44, 32,
+115, 44, 32, 105, 108, 101, 110, 41, 32, 32, 32, 109, 101, 109, 109,
+111, 118, 101, 40, 100, 44, 32, 115, 44, 32, 99, 95, 105, 50, 117, 95,
+115, 105, 122, 101, 40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 109, 101, 109, 115, 101, 116, 40, 100,
+44, 32, 118, 97, 108, 44, 32, 105, 108, 101, 110, 41, 32, 32, 109,
+101, 109, 115, 101, 116, 40, 100, 44, 32, 118, 97, 108, 44, 32, 99,
+95, 105, 50, 117, 95, 115, 105, 122, 101, 40, 105, 108, 101, 110, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 101, 109,
+99, 109, 112, 40, 97, 44, 32, 98, 44, 32, 105, 108, 101, 110, 41, 32,
+32, 32, 32, 109, 101, 109, 99, 109, 112, 40, 97, 44, 32, 98, 44, 32,
+99, 95, 105, 50, 117, 95, 115, 105, 122, 101, 40, 105, 108, 101, 110,
+41, 41, 10, 47, 47, 32, 108, 105, 98, 114, 97, 114, 121, 32, 105, 110,
+116, 101, 114, 110, 97, 108, 44, 32, 98, 117, 116, 32, 109, 97, 121,
+32, 98, 101, 32, 117, 115, 101, 102, 117, 108, 32, 105, 110, 32, 117,
+115, 101, 114, 32, 99, 111, 100, 101, 58, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 117, 50, 105, 95, 115, 105, 122, 101, 40, 117,
+41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 105, 115, 105,
+122, 101, 41, 40, 49, 32, 63, 32, 40, 117, 41, 32, 58, 32, 40, 115,
+105, 122, 101, 95, 116, 41, 49, 41, 32, 47, 47, 32, 119, 97, 114, 110,
+115, 32, 105, 102, 32, 117, 32, 105, 115, 32, 115, 105, 103, 110, 101,
+100, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 105, 50, 117,
+95, 115, 105, 122, 101, 40, 105, 41, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 40, 115, 105, 122, 101, 95, 116, 41, 40, 49, 32, 63, 32,
+40, 105, 41, 32, 58, 32, 45, 49, 41, 32, 32, 32, 32, 32, 32, 32, 47,
+47, 32, 119, 97, 114, 110, 115, 32, 105, 102, 32, 105, 32, 105, 115,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 117, 108, 101, 115, 115, 40, 97, 44, 32,
+98, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 115, 105,
+122, 101, 95, 116, 41, 40, 97, 41, 32, 60, 32, 40, 115, 105, 122, 101,
+95, 116, 41, 40, 98, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116, 40, 84, 44, 32, 70,
+114, 111, 109, 44, 32, 120, 41, 32, 40, 40, 84, 41, 40, 49, 32, 63,
+32, 40, 120, 41, 32, 58, 32, 40, 70, 114, 111, 109, 41, 123, 48, 125,
+41, 41, 10, 10, 47, 47, 32, 120, 44, 32, 121, 32, 97, 114, 101, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 42, 32, 116, 121, 112, 101, 44,
+32, 119, 104, 105, 99, 104, 32, 100, 101, 102, 97, 117, 108, 116, 115,
+32, 116, 111, 32, 105, 95, 107, 101, 121, 42, 46, 32, 118, 112, 32,
+105, 115, 32, 105, 95, 107, 101, 121, 42, 32, 116, 121, 112, 101, 46,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 101, 109, 99,
+109, 112, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32, 32,
+32, 32, 40, 109, 101, 109, 99, 109, 112, 40, 120, 44, 32, 121, 44, 32,
+115, 105, 122, 101, 111, 102, 32, 42, 40, 120, 41, 41, 32, 61, 61, 32,
+48, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32,
+32, 32, 32, 32, 32, 40, 42, 40, 120, 41, 32, 61, 61, 32, 42, 40, 121,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 108, 101, 115, 115, 40, 120, 44, 32, 121,
+41, 32, 32, 32, 32, 40, 42, 40, 120, 41, 32, 60, 32, 42, 40, 121, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102,
+97, 117, 108, 116, 95, 99, 109, 112, 40, 120, 44, 32, 121, 41, 32, 32,
+32, 32, 32, 40, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 108,
+101, 115, 115, 40, 121, 44, 32, 120, 41, 32, 45, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 108, 101, 115, 115, 40, 120, 44, 32, 121,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 104, 97, 115, 104, 40, 118, 112, 41, 32,
+32, 32, 32, 32, 32, 99, 95, 104, 97, 115, 104, 95, 110, 40, 118, 112,
+44, 32, 115, 105, 122, 101, 111, 102, 32, 42, 40, 118, 112, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102, 97,
+117, 108, 116, 95, 99, 108, 111, 110, 101, 40, 118, 41, 32, 32, 32,
+32, 32, 32, 40, 118, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 100, 101, 102, 97, 117, 108, 116, 95, 116, 111, 114, 97, 119, 40,
+118, 112, 41, 32, 32, 32, 32, 32, 40, 42, 40, 118, 112, 41, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102, 97, 117,
+108, 116, 95, 100, 114, 111, 112, 40, 118, 112, 41, 32, 32, 32, 32,
+32, 32, 40, 40, 118, 111, 105, 100, 41, 32, 40, 118, 112, 41, 41, 10,
+10, 47, 47, 32, 110, 111, 110, 45, 111, 119, 110, 105, 110, 103, 32,
+99, 104, 97, 114, 32, 112, 111, 105, 110, 116, 101, 114, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 99, 111, 110, 115, 116, 32, 99, 104, 97,
+114, 42, 32, 99, 115, 116, 114, 95, 114, 97, 119, 59, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114, 97, 119, 95,
+99, 109, 112, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32, 32, 32, 115,
+116, 114, 99, 109, 112, 40, 42, 40, 120, 41, 44, 32, 42, 40, 121, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95,
+114, 97, 119, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32,
+32, 32, 32, 40, 99, 115, 116, 114, 95, 114, 97, 119, 95, 99, 109, 112,
+40, 120, 44, 32, 121, 41, 32, 61, 61, 32, 48, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114, 97, 119, 95, 104,
+97, 115, 104, 40, 118, 112, 41, 32, 32, 32, 32, 32, 32, 32, 99, 95,
+104, 97, 115, 104, 95, 115, 116, 114, 40, 42, 40, 118, 112, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114,
+97, 119, 95, 99, 108, 111, 110, 101, 40, 118, 41, 32, 32, 32, 32, 32,
+32, 32, 40, 118, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+115, 116, 114, 95, 114, 97, 119, 95, 100, 114, 111, 112, 40, 118, 112,
+41, 32, 32, 32, 32, 32, 32, 32, 40, 40, 118, 111, 105, 100, 41, 118,
+112, 41, 10, 10, 47, 47, 32, 67, 111, 110, 116, 114, 111, 108, 32, 98,
+108, 111, 99, 107, 32, 109, 97, 99, 114, 111, 115, 10, 10, 47, 47, 32,
+91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 58, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 105, 110, 105, 116, 40, 46,
+46, 46, 41, 32, 99, 95, 109, 97, 107, 101, 40, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 102, 111, 114, 108, 105, 115, 116, 40, 46, 46, 46, 41, 32, 102,
+111, 114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 102, 111, 114, 105, 116, 101, 109, 115, 40, 46, 46, 46,
+41, 32, 102, 111, 114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40,
+95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104, 40,
+46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 101, 97, 99, 104,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104,
+95, 110, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 101,
+97, 99, 104, 95, 110, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 111,
+114, 101, 97, 99, 104, 95, 107, 118, 40, 46, 46, 46, 41, 32, 102, 111,
+114, 32, 40, 99, 95, 101, 97, 99, 104, 95, 107, 118, 40, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104, 95, 114, 101,
+118, 101, 114, 115, 101, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32,
+40, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118, 101, 114, 115, 101,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 114, 97, 110, 103,
+101, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 114, 97,
+110, 103, 101, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 114,
+97, 110, 103, 101, 51, 50, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32,
+40, 99, 95, 114, 97, 110, 103, 101, 51, 50, 40, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 41, 10, 10, 47, 47, 32, 78, 101, 119, 58,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99, 104,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 101, 97, 99, 104, 44, 32, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 101, 97, 99, 104, 95, 51, 40, 105, 116, 44, 32, 67,
+44, 32, 99, 110, 116, 41, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95,
+105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 67, 35, 35, 95, 98, 101,
+103, 105, 110, 40, 38, 99, 110, 116, 41, 59, 32, 105, 116, 46, 114,
+101, 102, 59, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40, 38, 105,
+116, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 52, 40, 105, 116, 44, 32, 67, 44, 32, 115, 116, 97, 114,
+116, 44, 32, 101, 110, 100, 41, 32, 92, 10, 32, 32, 32, 32, 95, 99,
+95, 101, 97, 99, 104, 40, 105, 116, 44, 32, 67, 44, 32, 115, 116, 97,
+114, 116, 44, 32, 40, 101, 110, 100, 41, 46, 114, 101, 102, 44, 32,
+95, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 110, 40, 105, 116, 44, 32, 67, 44, 32, 99, 110, 116, 44,
+32, 110, 41, 32, 92, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 123, 67, 35, 35, 95, 105, 116, 101, 114, 32, 105, 116, 101, 114,
+59, 32, 67, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 114, 101, 102,
+59, 32, 105, 115, 105, 122, 101, 32, 115, 105, 122, 101, 44, 32, 105,
+110, 100, 101, 120, 59, 125, 32, 92, 10, 32, 32, 32, 32, 105, 116, 32,
+61, 32, 123, 46, 105, 116, 101, 114, 61, 67, 35, 35, 95, 98, 101, 103,
+105, 110, 40, 38, 99, 110, 116, 41, 44, 32, 46, 115, 105, 122, 101,
+61, 110, 125, 59, 32, 40, 105, 116, 46, 114, 101, 102, 32, 61, 32,
+105, 116, 46, 105, 116, 101, 114, 46, 114, 101, 102, 41, 32, 38, 38,
+32, 105, 116, 46, 105, 110, 100, 101, 120, 32, 60, 32, 105, 116, 46,
+115, 105, 122, 101, 59, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40,
+38, 105, 116, 46, 105, 116, 101, 114, 41, 44, 32, 43, 43, 105, 116,
+46, 105, 110, 100, 101, 120, 10, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118, 101, 114, 115, 101,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118,
+101, 114, 115, 101, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99,
+104, 95, 114, 101, 118, 101, 114, 115, 101, 95, 51, 40, 105, 116, 44,
+32, 67, 44, 32, 99, 110, 116, 41, 32, 47, 42, 32, 119, 111, 114, 107,
+115, 32, 102, 111, 114, 32, 115, 116, 97, 99, 107, 44, 32, 118, 101,
+99, 44, 32, 113, 117, 101, 117, 101, 44, 32, 100, 101, 113, 117, 101,
+32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95, 105, 116, 101,
+114, 32, 105, 116, 32, 61, 32, 67, 35, 35, 95, 114, 98, 101, 103, 105,
+110, 40, 38, 99, 110, 116, 41, 59, 32, 105, 116, 46, 114, 101, 102,
+59, 32, 67, 35, 35, 95, 114, 110, 101, 120, 116, 40, 38, 105, 116, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99, 104,
+95, 114, 101, 118, 101, 114, 115, 101, 95, 52, 40, 105, 116, 44, 32,
+67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 92,
+10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 40, 105, 116, 44,
+32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 40, 101, 110, 100, 41,
+46, 114, 101, 102, 44, 32, 95, 114, 41, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 99, 95, 101, 97, 99, 104, 40, 105, 116, 44, 32,
+67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 114, 101,
+102, 44, 32, 114, 101, 118, 41, 32, 47, 42, 32, 112, 114, 105, 118,
+97, 116, 101, 32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95,
+105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 40, 115, 116, 97, 114,
+116, 41, 44, 32, 42, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35,
+105, 116, 32, 61, 32, 99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116,
+40, 67, 35, 35, 95, 105, 116, 101, 114, 42, 44, 32, 67, 35, 35, 95,
+118, 97, 108, 117, 101, 42, 44, 32, 101, 110, 100, 114, 101, 102, 41,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 59, 32, 105, 116, 46,
+114, 101, 102, 32, 33, 61, 32, 40, 67, 35, 35, 95, 118, 97, 108, 117,
+101, 42, 41, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35, 105, 116,
+59, 32, 67, 35, 35, 114, 101, 118, 35, 35, 110, 101, 120, 116, 40, 38,
+105, 116, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+101, 97, 99, 104, 95, 107, 118, 40, 46, 46, 46, 41, 32, 99, 95, 77,
+65, 67, 82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 101,
+97, 99, 104, 95, 107, 118, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 107, 118, 95, 52, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 99, 110, 116, 41, 32, 47, 42, 32, 115, 116,
+114, 117, 99, 116, 117, 114, 101, 100, 32, 98, 105, 110, 100, 105,
+110, 103, 32, 102, 111, 114, 32, 109, 97, 112, 115, 32, 42, 47, 32,
+92, 10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 95, 107, 118,
+40, 107, 101, 121, 44, 32, 118, 97, 108, 44, 32, 67, 44, 32, 67, 35,
+35, 95, 98, 101, 103, 105, 110, 40, 38, 99, 110, 116, 41, 44, 32, 78,
+85, 76, 76, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101,
+97, 99, 104, 95, 107, 118, 95, 53, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110,
+100, 41, 32, 92, 10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 95,
+107, 118, 40, 107, 101, 121, 44, 32, 118, 97, 108, 44, 32, 67, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 40, 101, 110, 100, 41, 46, 114, 101,
+102, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 99, 95,
+101, 97, 99, 104, 95, 107, 118, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110,
+100, 114, 101, 102, 41, 32, 47, 42, 32, 112, 114, 105, 118, 97, 116,
+101, 32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+32, 67, 35, 35, 95, 107, 101, 121, 32, 42, 107, 101, 121, 32, 61, 32,
+40, 99, 111, 110, 115, 116, 32, 67, 35, 35, 95, 107, 101, 121, 42, 41,
+38, 107, 101, 121, 59, 32, 107, 101, 121, 59, 32, 41, 32, 92, 10, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 67, 35, 35, 95, 109, 97, 112, 112,
+101, 100, 32, 42, 118, 97, 108, 59, 32, 107, 101, 121, 59, 32, 107,
+101, 121, 32, 61, 32, 78, 85, 76, 76, 41, 32, 92, 10, 32, 32, 32, 32,
+102, 111, 114, 32, 40, 67, 35, 35, 95, 105, 116, 101, 114, 32, 95,
+105, 116, 95, 35, 35, 107, 101, 121, 32, 61, 32, 115, 116, 97, 114,
+116, 44, 32, 42, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35, 107,
+101, 121, 32, 61, 32, 99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116,
+40, 67, 35, 35, 95, 105, 116, 101, 114, 42, 44, 32, 67, 35, 35, 95,
+118, 97, 108, 117, 101, 42, 44, 32, 101, 110, 100, 114, 101, 102, 41,
+59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 105, 116, 95,
+35, 35, 107, 101, 121, 46, 114, 101, 102, 32, 33, 61, 32, 40, 67, 35,
+35, 95, 118, 97, 108, 117, 101, 42, 41, 95, 101, 110, 100, 114, 101,
+102, 95, 35, 35, 107, 101, 121, 32, 38, 38, 32, 40, 107, 101, 121, 32,
+61, 32, 38, 95, 105, 116, 95, 35, 35, 107, 101, 121, 46, 114, 101,
+102, 45, 62, 102, 105, 114, 115, 116, 44, 32, 118, 97, 108, 32, 61,
+32, 38, 95, 105, 116, 95, 35, 35, 107, 101, 121, 46, 114, 101, 102,
+45, 62, 115, 101, 99, 111, 110, 100, 41, 59, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40, 38,
+95, 105, 116, 95, 35, 35, 107, 101, 121, 41, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 105, 116, 101, 109, 115, 40, 105, 116,
+44, 32, 84, 44, 32, 46, 46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 84, 42, 32, 114, 101, 102, 59, 32,
+105, 110, 116, 32, 115, 105, 122, 101, 44, 32, 105, 110, 100, 101,
+120, 59, 125, 32, 92, 10, 32, 32, 32, 32, 105, 116, 32, 61, 32, 123,
+46, 114, 101, 102, 61, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114,
+97, 121, 40, 84, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 44, 32, 46, 115, 105, 122, 101, 61, 40, 105, 110, 116, 41, 40,
+115, 105, 122, 101, 111, 102, 40, 40, 84, 91, 93, 41, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105, 122, 101, 111, 102, 40,
+84, 41, 41, 125, 32, 92, 10, 32, 32, 32, 32, 59, 32, 105, 116, 46,
+105, 110, 100, 101, 120, 32, 60, 32, 105, 116, 46, 115, 105, 122, 101,
+32, 59, 32, 43, 43, 105, 116, 46, 114, 101, 102, 44, 32, 43, 43, 105,
+116, 46, 105, 110, 100, 101, 120, 10, 10, 47, 47, 32, 99, 95, 114, 97,
+110, 103, 101, 44, 32, 99, 95, 114, 97, 110, 103, 101, 51, 50, 58, 32,
+112, 121, 116, 104, 111, 110, 45, 108, 105, 107, 101, 32, 105, 110,
+116, 32, 114, 97, 110, 103, 101, 32, 105, 116, 101, 114, 97, 116, 105,
+111, 110, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 95, 116, 40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67,
+82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 114, 97, 110,
+103, 101, 95, 116, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110,
+103, 101, 95, 116, 95, 51, 40, 84, 44, 32, 105, 44, 32, 115, 116, 111,
+112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40, 84,
+44, 32, 105, 44, 32, 48, 44, 32, 115, 116, 111, 112, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116,
+95, 52, 40, 84, 44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32,
+115, 116, 111, 112, 41, 32, 92, 10, 32, 32, 32, 32, 84, 32, 105, 61,
+115, 116, 97, 114, 116, 44, 32, 95, 99, 95, 101, 110, 100, 95, 35, 35,
+105, 61, 115, 116, 111, 112, 59, 32, 105, 32, 60, 32, 95, 99, 95, 101,
+110, 100, 95, 35, 35, 105, 59, 32, 43, 43, 105, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 53,
+40, 84, 44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116,
+111, 112, 44, 32, 115, 116, 101, 112, 41, 32, 92, 10, 32, 32, 32, 32,
+84, 32, 105, 61, 115, 116, 97, 114, 116, 44, 32, 95, 99, 95, 105, 110,
+99, 95, 35, 35, 105, 61, 115, 116, 101, 112, 44, 32, 95, 99, 95, 101,
+110, 100, 95, 35, 35, 105, 61, 40, 115, 116, 111, 112, 41, 32, 45, 32,
+40, 95, 99, 95, 105, 110, 99, 95, 35, 35, 105, 32, 62, 32, 48, 41, 32,
+92, 10, 32, 32, 32, 32, 59, 32, 40, 95, 99, 95, 105, 110, 99, 95, 35,
+35, 105, 32, 62, 32, 48, 41, 32, 61, 61, 32, 40, 105, 32, 60, 61, 32,
+95, 99, 95, 101, 110, 100, 95, 35, 35, 105, 41, 32, 59, 32, 105, 32,
+43, 61, 32, 95, 99, 95, 105, 110, 99, 95, 35, 35, 105, 10, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 40,
+46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69, 82,
+76, 79, 65, 68, 40, 99, 95, 114, 97, 110, 103, 101, 44, 32, 95, 95,
+86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 49, 40, 115, 116,
+111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40,
+105, 115, 105, 122, 101, 44, 32, 95, 99, 95, 105, 49, 44, 32, 48, 44,
+32, 115, 116, 111, 112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 114, 97, 110, 103, 101, 95, 50, 40, 105, 44, 32, 115, 116,
+111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40,
+105, 115, 105, 122, 101, 44, 32, 105, 44, 32, 48, 44, 32, 115, 116,
+111, 112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114,
+97, 110, 103, 101, 95, 51, 40, 105, 44, 32, 115, 116, 97, 114, 116,
+44, 32, 115, 116, 111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101,
+95, 116, 95, 52, 40, 105, 115, 105, 122, 101, 44, 32, 105, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 52,
+40, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112,
+44, 32, 115, 116, 101, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101,
+95, 116, 95, 53, 40, 105, 115, 105, 122, 101, 44, 32, 105, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 44, 32, 115, 116,
+101, 112, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+114, 97, 110, 103, 101, 51, 50, 40, 46, 46, 46, 41, 32, 99, 95, 77,
+65, 67, 82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 114,
+97, 110, 103, 101, 51, 50, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 51, 50, 95, 50, 40, 105, 44, 32, 115, 116, 111, 112,
+41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40, 105, 110,
+116, 51, 50, 95, 116, 44, 32, 105, 44, 32, 48, 44, 32, 115, 116, 111,
+112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 51, 50, 95, 51, 40, 105, 44, 32, 115, 116, 97, 114,
+116, 44, 32, 115, 116, 111, 112, 41, 32, 99, 95, 114, 97, 110, 103,
+101, 95, 116, 95, 52, 40, 105, 110, 116, 51, 50, 95, 116, 44, 32, 105,
+44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101,
+51, 50, 95, 52, 40, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115,
+116, 111, 112, 44, 32, 115, 116, 101, 112, 41, 32, 99, 95, 114, 97,
+110, 103, 101, 95, 116, 95, 53, 40, 105, 110, 116, 51, 50, 95, 116,
+44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111,
+112, 44, 32, 115, 116, 101, 112, 41, 10, 10, 47, 47, 32, 109, 97, 107,
+101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 32, 102, 114, 111,
+109, 32, 97, 32, 108, 105, 116, 101, 114, 97, 108, 32, 108, 105, 115,
+116, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 107,
+101, 40, 67, 44, 32, 46, 46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 67,
+35, 35, 95, 102, 114, 111, 109, 95, 110, 40, 99, 95, 109, 97, 107,
+101, 95, 97, 114, 114, 97, 121, 40, 67, 35, 35, 95, 114, 97, 119, 44,
+32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 44, 32, 99, 95,
+115, 105, 122, 101, 111, 102, 40, 40, 67, 35, 35, 95, 114, 97, 119,
+91, 93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 99,
+95, 115, 105, 122, 101, 111, 102, 40, 67, 35, 35, 95, 114, 97, 119,
+41, 41, 10, 10, 47, 47, 32, 112, 117, 116, 32, 109, 117, 108, 116,
+105, 112, 108, 101, 32, 114, 97, 119, 45, 116, 121, 112, 101, 32, 101,
+108, 101, 109, 101, 110, 116, 115, 32, 102, 114, 111, 109, 32, 97, 32,
+108, 105, 116, 101, 114, 97, 108, 32, 108, 105, 115, 116, 32, 105,
+110, 116, 111, 32, 97, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 112, 117, 116, 95,
+105, 116, 101, 109, 115, 40, 67, 44, 32, 99, 110, 116, 44, 32, 46, 46,
+46, 41, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95, 112, 117, 116, 95,
+110, 40, 99, 110, 116, 44, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114,
+114, 97, 121, 40, 67, 35, 35, 95, 114, 97, 119, 44, 32, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 40, 67, 35, 35, 95, 114, 97, 119, 91, 93, 41, 95,
+95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 67, 35, 35, 95, 114, 97, 119, 41, 41, 10, 10, 47,
+47, 32, 100, 114, 111, 112, 32, 109, 117, 108, 116, 105, 112, 108,
+101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 115, 32, 111, 102,
+32, 115, 97, 109, 101, 32, 116, 121, 112, 101, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 100, 114, 111, 112, 40, 67, 44, 32, 46, 46,
+46, 41, 32, 92, 10, 32, 32, 32, 32, 100, 111, 32, 123, 32, 102, 111,
+114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40, 95, 99, 95, 105, 50,
+44, 32, 67, 42, 44, 32, 123, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 125, 41, 41, 32, 67, 35, 35, 95, 100, 114, 111, 112, 40, 42, 95,
+99, 95, 105, 50, 46, 114, 101, 102, 41, 59, 32, 125, 32, 119, 104,
+105, 108, 101, 40, 48, 41, 10, 10, 47, 47, 32, 82, 65, 73, 73, 32,
+115, 99, 111, 112, 101, 115, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 100, 101, 102, 101, 114, 40, 46, 46, 46, 41, 32, 92, 10, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95, 99, 95, 105,
+51, 32, 61, 32, 48, 59, 32, 95, 99, 95, 105, 51, 43, 43, 32, 61, 61,
+32, 48, 59, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 119, 105, 116, 104,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 119, 105, 116, 104, 44, 32, 95, 95,
+86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 119, 105, 116, 104, 95, 50, 40, 105, 110, 105,
+116, 44, 32, 100, 101, 105, 110, 105, 116, 41, 32, 92, 10, 32, 32, 32,
+32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95, 99, 95, 105, 52, 32,
+61, 32, 48, 59, 32, 95, 99, 95, 105, 52, 32, 61, 61, 32, 48, 59, 32,
+41, 32, 102, 111, 114, 32, 40, 105, 110, 105, 116, 59, 32, 95, 99, 95,
+105, 52, 43, 43, 32, 61, 61, 32, 48, 59, 32, 100, 101, 105, 110, 105,
+116, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 119, 105,
+116, 104, 95, 51, 40, 105, 110, 105, 116, 44, 32, 99, 111, 110, 100,
+105, 116, 105, 111, 110, 44, 32, 100, 101, 105, 110, 105, 116, 41, 32,
+92, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95,
+99, 95, 105, 53, 32, 61, 32, 48, 59, 32, 95, 99, 95, 105, 53, 32, 61,
+61, 32, 48, 59, 32, 41, 32, 102, 111, 114, 32, 40, 105, 110, 105, 116,
+59, 32, 95, 99, 95, 105, 53, 43, 43, 32, 61, 61, 32, 48, 32, 38, 38,
+32, 40, 99, 111, 110, 100, 105, 116, 105, 111, 110, 41, 59, 32, 100,
+101, 105, 110, 105, 116, 41, 10, 10, 47, 47, 32, 71, 101, 110, 101,
+114, 97, 108, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 10, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 42,
+32, 99, 95, 115, 97, 102, 101, 95, 109, 101, 109, 99, 112, 121, 40,
+118, 111, 105, 100, 42, 32, 100, 115, 116, 44, 32, 99, 111, 110, 115,
+116, 32, 118, 111, 105, 100, 42, 32, 115, 114, 99, 44, 32, 105, 115,
+105, 122, 101, 32, 115, 105, 122, 101, 41, 10, 32, 32, 32, 32, 123,
+32, 114, 101, 116, 117, 114, 110, 32, 100, 115, 116, 32, 63, 32, 109,
+101, 109, 99, 112, 121, 40, 100, 115, 116, 44, 32, 115, 114, 99, 44,
+32, 40, 115, 105, 122, 101, 95, 116, 41, 115, 105, 122, 101, 41, 32,
+58, 32, 78, 85, 76, 76, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78,
+76, 73, 78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 98, 97,
+115, 101, 104, 97, 115, 104, 95, 110, 40, 99, 111, 110, 115, 116, 32,
+118, 111, 105, 100, 42, 32, 107, 101, 121, 44, 32, 105, 115, 105, 122,
+101, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 115, 105,
+122, 101, 95, 116, 32, 98, 108, 111, 99, 107, 32, 61, 32, 48, 44, 32,
+104, 97, 115, 104, 32, 61, 32, 48, 120, 56, 49, 49, 99, 57, 100, 99,
+53, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110,
+116, 56, 95, 116, 42, 32, 109, 115, 103, 32, 61, 32, 40, 99, 111, 110,
+115, 116, 32, 117, 105, 110, 116, 56, 95, 116, 42, 41, 107, 101, 121,
+59, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 108, 101,
+110, 32, 62, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 108, 111, 99, 107, 44,
+32, 109, 115, 103, 44, 32, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+104, 97, 115, 104, 32, 61, 32, 40, 104, 97, 115, 104, 32, 94, 32, 98,
+108, 111, 99, 107, 41, 32, 42, 32, 40, 115, 105, 122, 101, 95, 116,
+41, 48, 120, 56, 57, 98, 98, 49, 55, 57, 57, 48, 49, 48, 48, 48, 49,
+57, 51, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 109, 115, 103, 32, 43,
+61, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105, 122, 101,
+95, 116, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 101, 110,
+32, 45, 61, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+32, 99, 95, 109, 101, 109, 99, 112, 121, 40, 38, 98, 108, 111, 99,
+107, 44, 32, 109, 115, 103, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32,
+32, 32, 104, 97, 115, 104, 32, 61, 32, 40, 104, 97, 115, 104, 32, 94,
+32, 98, 108, 111, 99, 107, 41, 32, 42, 32, 40, 115, 105, 122, 101, 95,
+116, 41, 48, 120, 98, 48, 51, 52, 48, 102, 52, 53, 48, 49, 48, 48, 48,
+49, 57, 51, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+104, 97, 115, 104, 32, 94, 32, 40, 104, 97, 115, 104, 32, 62, 62, 32,
+51, 41, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69,
+32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 104, 97, 115, 104, 95,
+110, 40, 99, 111, 110, 115, 116, 32, 118, 111, 105, 100, 42, 32, 107,
+101, 121, 44, 32, 105, 115, 105, 122, 101, 32, 108, 101, 110, 41, 32,
+123, 10, 32, 32, 32, 32, 117, 105, 110, 116, 54, 52, 95, 116, 32, 98,
+56, 59, 32, 117, 105, 110, 116, 51, 50, 95, 116, 32, 98, 52, 59, 10,
+32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 108, 101, 110,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32,
+56, 58, 32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 56, 44, 32, 107,
+101, 121, 44, 32, 56, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32,
+40, 115, 105, 122, 101, 95, 116, 41, 40, 98, 56, 32, 42, 32, 48, 120,
+99, 54, 97, 52, 97, 55, 57, 51, 53, 98, 100, 49, 101, 57, 57, 100, 41,
+59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 52, 58,
+32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 52, 44, 32, 107, 101,
+121, 44, 32, 52, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32, 98, 52,
+32, 42, 32, 40, 115, 105, 122, 101, 95, 116, 41, 48, 120, 97, 50, 102,
+102, 101, 98, 50, 102, 48, 49, 48, 48, 48, 49, 57, 51, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 32, 114,
+101, 116, 117, 114, 110, 32, 99, 95, 98, 97, 115, 101, 104, 97, 115,
+104, 95, 110, 40, 107, 101, 121, 44, 32, 108, 101, 110, 41, 59, 10,
+32, 32, 32, 32, 125, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 104, 97, 115,
+104, 95, 115, 116, 114, 40, 99, 111, 110, 115, 116, 32, 99, 104, 97,
+114, 32, 42, 115, 116, 114, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101,
+116, 117, 114, 110, 32, 99, 95, 98, 97, 115, 101, 104, 97, 115, 104,
+95, 110, 40, 115, 116, 114, 44, 32, 99, 95, 115, 116, 114, 108, 101,
+110, 40, 115, 116, 114, 41, 41, 59, 32, 125, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 104, 97, 115, 104, 95, 109, 105, 120,
+40, 46, 46, 46, 41, 32, 47, 42, 32, 110, 111, 110, 45, 99, 111, 109,
+109, 117, 116, 97, 116, 105, 118, 101, 32, 104, 97, 115, 104, 32, 99,
+111, 109, 98, 105, 110, 101, 33, 32, 42, 47, 32, 92, 10, 32, 32, 32,
+32, 95, 99, 104, 97, 115, 104, 95, 109, 105, 120, 40, 99, 95, 109, 97,
+107, 101, 95, 97, 114, 114, 97, 121, 40, 115, 105, 122, 101, 95, 116,
+44, 32, 123, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 125, 41, 44,
+32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 41, 41, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 95, 99, 104, 97, 115,
+104, 95, 109, 105, 120, 40, 115, 105, 122, 101, 95, 116, 32, 104, 91,
+93, 44, 32, 105, 110, 116, 32, 110, 41, 32, 123, 10, 32, 32, 32, 32,
+102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 49, 59, 32,
+105, 32, 60, 32, 110, 59, 32, 43, 43, 105, 41, 32, 104, 91, 48, 93,
+32, 43, 61, 32, 104, 91, 48, 93, 32, 94, 32, 104, 91, 105, 93, 59, 10,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 104, 91, 48, 93, 59,
+10, 125, 10, 10, 47, 47, 32, 103, 101, 110, 101, 114, 105, 99, 32,
+116, 121, 112, 101, 115, 97, 102, 101, 32, 115, 119, 97, 112, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 119, 97, 112, 40, 120,
+112, 44, 32, 121, 112, 41, 32, 100, 111, 32, 123, 32, 92, 10, 32, 32,
+32, 32, 40, 118, 111, 105, 100, 41, 115, 105, 122, 101, 111, 102, 40,
+40, 120, 112, 41, 32, 61, 61, 32, 40, 121, 112, 41, 41, 59, 32, 92,
+10, 32, 32, 32, 32, 99, 104, 97, 114, 32, 95, 116, 118, 91, 115, 105,
+122, 101, 111, 102, 32, 42, 40, 120, 112, 41, 93, 59, 32, 92, 10, 32,
+32, 32, 32, 118, 111, 105, 100, 32, 42, 95, 120, 112, 32, 61, 32, 120,
+112, 44, 32, 42, 95, 121, 112, 32, 61, 32, 121, 112, 59, 32, 92, 10,
+32, 32, 32, 32, 109, 101, 109, 99, 112, 121, 40, 95, 116, 118, 44, 32,
+95, 120, 112, 44, 32, 115, 105, 122, 101, 111, 102, 32, 95, 116, 118,
+41, 59, 32, 92, 10, 32, 32, 32, 32, 109, 101, 109, 99, 112, 121, 40,
+95, 120, 112, 44, 32, 95, 121, 112, 44, 32, 115, 105, 122, 101, 111,
+102, 32, 95, 116, 118, 41, 59, 32, 92, 10, 32, 32, 32, 32, 109, 101,
+109, 99, 112, 121, 40, 95, 121, 112, 44, 32, 95, 116, 118, 44, 32,
+115, 105, 122, 101, 111, 102, 32, 95, 116, 118, 41, 59, 32, 92, 10,
+125, 32, 119, 104, 105, 108, 101, 32, 40, 48, 41, 10, 10, 47, 47, 32,
+103, 101, 116, 32, 110, 101, 120, 116, 32, 112, 111, 119, 101, 114,
+32, 111, 102, 32, 116, 119, 111, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 105, 115, 105, 122, 101, 32, 99, 95, 110, 101, 120, 116,
+95, 112, 111, 119, 50, 40, 105, 115, 105, 122, 101, 32, 110, 41, 32,
+123, 10, 32, 32, 32, 32, 110, 45, 45, 59, 10, 32, 32, 32, 32, 110, 32,
+124, 61, 32, 110, 32, 62, 62, 32, 49, 44, 32, 110, 32, 124, 61, 32,
+110, 32, 62, 62, 32, 50, 59, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32,
+110, 32, 62, 62, 32, 52, 44, 32, 110, 32, 124, 61, 32, 110, 32, 62,
+62, 32, 56, 59, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32, 110, 32, 62,
+62, 32, 49, 54, 59, 10, 32, 32, 32, 32, 35, 105, 102, 32, 73, 78, 84,
+80, 84, 82, 95, 77, 65, 88, 32, 61, 61, 32, 73, 78, 84, 54, 52, 95,
+77, 65, 88, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32, 110, 32, 62, 62,
+32, 51, 50, 59, 10, 32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 32, 43, 32, 49,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 99,
+104, 97, 114, 42, 32, 99, 95, 115, 116, 114, 110, 115, 116, 114, 110,
+40, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 42, 115, 116,
+114, 44, 32, 105, 115, 105, 122, 101, 32, 115, 108, 101, 110, 44, 32,
+99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 42, 110, 101, 101,
+100, 108, 101, 44, 32, 105, 115, 105, 122, 101, 32, 110, 108, 101,
+110, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 110, 108, 101,
+110, 32, 61, 61, 32, 48, 41, 32, 114, 101, 116, 117, 114, 110, 32, 40,
+99, 104, 97, 114, 32, 42, 41, 115, 116, 114, 59, 10, 32, 32, 32, 32,
+105, 102, 32, 40, 110, 108, 101, 110, 32, 62, 32, 115, 108, 101, 110,
+41, 32, 114, 101, 116, 117, 114, 110, 32, 78, 85, 76, 76, 59, 10, 32,
+32, 32, 32, 115, 108, 101, 110, 32, 45, 61, 32, 110, 108, 101, 110,
+59, 10, 32, 32, 32, 32, 100, 111, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 105, 102, 32, 40, 42, 115, 116, 114, 32, 61, 61, 32, 42, 110,
+101, 101, 100, 108, 101, 32, 38, 38, 32, 33, 99, 95, 109, 101, 109,
+99, 109, 112, 40, 115, 116, 114, 44, 32, 110, 101, 101, 100, 108, 101,
+44, 32, 110, 108, 101, 110, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 99, 104, 97,
+114, 32, 42, 41, 115, 116, 114, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 43, 43, 115, 116, 114, 59, 10, 32, 32, 32, 32, 125, 32, 119, 104,
+105, 108, 101, 32, 40, 115, 108, 101, 110, 45, 45, 41, 59, 10, 32, 32,
+32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 85, 76, 76, 59, 10, 125,
+10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95, 67,
+79, 77, 77, 79, 78, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10,
+47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73,
+78, 67, 76, 85, 68, 69, 58, 32, 99, 111, 109, 109, 111, 110, 46, 104,
+10, 47, 47, 32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114,
+101, 103, 101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95,
+104, 101, 97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99,
+108, 117, 100, 101, 32, 60, 115, 116, 100, 108, 105, 98, 46, 104, 62,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 104, 97, 115, 104, 109,
+97, 115, 107, 32, 48, 120, 51, 102, 85, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 100, 105, 115, 116, 109, 97, 115, 107, 32, 48, 120,
+51, 102, 102, 85, 10, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97,
+112, 95, 109, 101, 116, 97, 32, 123, 32, 117, 105, 110, 116, 49, 54,
+95, 116, 32, 104, 97, 115, 104, 120, 58, 54, 44, 32, 100, 105, 115,
+116, 58, 49, 48, 59, 32, 125, 59, 32, 47, 47, 32, 100, 105, 115, 116,
+58, 32, 48, 61, 101, 109, 112, 116, 121, 44, 32, 49, 61, 80, 83, 76,
+32, 48, 44, 32, 50, 61, 80, 83, 76, 32, 49, 44, 32, 46, 46, 46, 10,
+35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95, 72, 77,
+65, 80, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 95, 105, 95, 112, 114, 101, 102, 105,
+120, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 105, 95,
+112, 114, 101, 102, 105, 120, 32, 104, 109, 97, 112, 95, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 95, 105,
+95, 105, 115, 95, 115, 101, 116, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78,
+76, 89, 32, 99, 95, 116, 114, 117, 101, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 105, 95, 83, 69, 84, 95, 79, 78, 76, 89, 32,
+99, 95, 102, 97, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40, 118, 112,
+41, 32, 40, 38, 40, 118, 112, 41, 45, 62, 102, 105, 114, 115, 116, 41,
+10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 32, 99, 95, 102,
+97, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 105, 95, 83, 69, 84, 95, 79, 78, 76, 89, 32, 99, 95, 116, 114,
+117, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 105,
+95, 107, 101, 121, 114, 101, 102, 40, 118, 112, 41, 32, 40, 118, 112,
+41, 10, 35, 101, 110, 100, 105, 102, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 105, 95, 105, 115, 95, 104, 97, 115, 104, 10, 47, 47, 32,
+35, 35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78,
+67, 76, 85, 68, 69, 58, 32, 116, 101, 109, 112, 108, 97, 116, 101, 46,
+104, 10, 47, 47, 32, 73, 87, 89, 85, 32, 112, 114, 97, 103, 109, 97,
+58, 32, 112, 114, 105, 118, 97, 116, 101, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 95, 105, 95, 116, 101, 109, 112, 108, 97, 116, 101, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 116, 101, 109, 112,
+108, 97, 116, 101, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83,
+84, 67, 95, 84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95, 73, 78, 67,
+76, 85, 68, 69, 68, 10, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84,
+67, 95, 84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95, 73, 78, 67, 76,
+85, 68, 69, 68, 10, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 110, 97, 109, 101, 41, 32, 99, 95, 74,
+79, 73, 78, 40, 83, 101, 108, 102, 44, 32, 110, 97, 109, 101, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 99, 95, 68, 69, 70,
+84, 89, 80, 69, 83, 40, 109, 97, 99, 114, 111, 44, 32, 83, 69, 76, 70,
+44, 32, 46, 46, 46, 41, 32, 109, 97, 99, 114, 111, 40, 83, 69, 76, 70,
+44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95, 118, 97, 108, 117,
+101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95,
+107, 101, 121, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 107, 101, 121,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95,
+109, 97, 112, 112, 101, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+109, 97, 112, 112, 101, 100, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 109, 95, 114, 109, 97, 112, 112, 101, 100, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 114, 109, 97, 112, 112, 101, 100, 41,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95, 114,
+97, 119, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 97, 119, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95, 107, 101,
+121, 114, 97, 119, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 107, 101,
+121, 114, 97, 119, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 105, 116, 101, 114, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 117, 108, 116, 41, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95, 110, 111, 100,
+101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 110, 111, 100, 101, 41,
+10, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 79, 80,
+84, 73, 79, 78, 40, 102, 108, 97, 103, 41, 32, 32, 40, 40, 105, 95,
+111, 112, 116, 41, 32, 38, 32, 40, 102, 108, 97, 103, 41, 41, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 99, 108,
+97, 114, 101, 100, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 48, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110, 111, 95,
+97, 116, 111, 109, 105, 99, 32, 32, 32, 32, 32, 40, 49, 60, 60, 49,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 97, 114,
+99, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 50,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110,
+111, 95, 99, 108, 111, 110, 101, 32, 32, 32, 32, 32, 32, 40, 49, 60,
+60, 51, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+110, 111, 95, 104, 97, 115, 104, 32, 32, 32, 32, 32, 32, 32, 40, 49,
+60, 60, 52, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 117, 115, 101, 95, 99, 109, 112, 32, 32, 32, 32, 32, 32, 32, 40,
+49, 60, 60, 53, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 117, 115, 101, 95, 101, 113, 32, 32, 32, 32, 32, 32, 32, 32,
+40, 49, 60, 60, 54, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 32, 32, 32, 32,
+32, 40, 49, 60, 60, 55, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 107, 101, 121, 99, 108, 97, 115, 115, 32, 32, 32, 32,
+32, 32, 40, 49, 60, 60, 56, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 118, 97, 108, 99, 108, 97, 115, 115, 32, 32, 32,
+32, 32, 32, 40, 49, 60, 60, 57, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 107, 101, 121, 112, 114, 111, 32, 32, 32,
+32, 32, 32, 32, 32, 40, 49, 60, 60, 49, 48, 41, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 118, 97, 108, 112, 114, 111, 32,
+32, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 49, 49, 41, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 114, 97, 119, 99, 108, 97, 115, 115, 32, 32,
+32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100,
+93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 99,
+109, 112, 99, 108, 97, 115, 115, 32, 105, 95, 114, 97, 119, 99, 108,
+97, 115, 115, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 95, 97, 114, 99, 98, 111, 120,
+32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100,
+93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 112, 114, 111, 32, 105, 95, 107, 101, 121, 95, 97, 114, 99,
+98, 111, 120, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 95, 115, 116, 114, 32, 32, 47,
+47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+112, 114, 111, 32, 99, 115, 116, 114, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 115, 116, 114, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 118, 97, 108, 95, 97, 114, 99, 98, 111,
+120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+118, 97, 108, 112, 114, 111, 32, 105, 95, 118, 97, 108, 95, 97, 114,
+99, 98, 111, 120, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 118, 97, 108, 95, 115, 116, 114, 32, 32,
+47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97,
+108, 112, 114, 111, 32, 99, 115, 116, 114, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 115, 116, 114, 10,
+35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 84, 32, 38, 38, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 116, 121, 112, 101, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 116, 121, 112, 101, 32, 84, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 116, 121, 112, 101, 32, 38, 38, 32, 99,
+95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95, 116, 121, 112, 101, 41,
+32, 62, 32, 49, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 83,
+101, 108, 102, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 49, 44, 32,
+105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 107, 101, 121, 32, 99, 95, 71, 69, 84, 65, 82,
+71, 40, 50, 44, 32, 105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 35,
+105, 102, 32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95, 116,
+121, 112, 101, 41, 32, 61, 61, 32, 51, 10, 32, 32, 32, 32, 35, 105,
+102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 105, 115,
+95, 109, 97, 112, 10, 32, 32, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 118, 97, 108, 32, 99, 95, 71, 69, 84, 65, 82,
+71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 32,
+32, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 111, 112, 116, 32, 99, 95, 71, 69,
+84, 65, 82, 71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101, 41, 10,
+32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 101, 108,
+105, 102, 32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95, 116,
+121, 112, 101, 41, 32, 61, 61, 32, 52, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 99, 95, 71,
+69, 84, 65, 82, 71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+111, 112, 116, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 52, 44, 32,
+105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 35, 101, 110, 100, 105,
+102, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 83, 101, 108, 102, 32, 38, 38, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 116, 121, 112, 101, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 83, 101, 108, 102, 32, 105, 95, 116, 121, 112,
+101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 83, 101, 108, 102, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 83, 101, 108, 102, 32, 99, 95, 74, 79, 73, 78, 40, 95, 105,
+95, 112, 114, 101, 102, 105, 120, 44, 32, 105, 95, 116, 97, 103, 41,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 99, 95, 79,
+80, 84, 73, 79, 78, 40, 99, 95, 100, 101, 99, 108, 97, 114, 101, 100,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 100,
+101, 99, 108, 97, 114, 101, 100, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 110,
+111, 95, 104, 97, 115, 104, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 110, 111, 95, 104, 97, 115, 104, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79,
+78, 40, 99, 95, 117, 115, 101, 95, 99, 109, 112, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 117, 115, 101, 95, 99, 109,
+112, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95,
+79, 80, 84, 73, 79, 78, 40, 99, 95, 117, 115, 101, 95, 101, 113, 41,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 117, 115,
+101, 95, 101, 113, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102,
+32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 110, 111, 95, 99, 108,
+111, 110, 101, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 105, 95, 105, 115, 95, 97, 114, 99, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110,
+101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95,
+79, 80, 84, 73, 79, 78, 40, 99, 95, 107, 101, 121, 99, 108, 97, 115,
+115, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+107, 101, 121, 99, 108, 97, 115, 115, 32, 105, 95, 107, 101, 121, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84,
+73, 79, 78, 40, 99, 95, 118, 97, 108, 99, 108, 97, 115, 115, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108,
+99, 108, 97, 115, 115, 32, 105, 95, 118, 97, 108, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78,
+40, 99, 95, 99, 109, 112, 99, 108, 97, 115, 115, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97,
+115, 115, 32, 105, 95, 107, 101, 121, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73,
+79, 78, 40, 99, 95, 107, 101, 121, 112, 114, 111, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 112, 114,
+111, 32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 118, 97,
+108, 112, 114, 111, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 118, 97, 108, 112, 114, 111, 32, 105, 95, 118, 97, 108,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 112, 114, 111,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101,
+121, 99, 108, 97, 115, 115, 32, 105, 95, 107, 101, 121, 112, 114, 111,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109,
+112, 99, 108, 97, 115, 115, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95,
+107, 101, 121, 112, 114, 111, 44, 32, 95, 114, 97, 119, 41, 10, 35,
+101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+114, 97, 119, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10,
+32, 32, 35, 105, 102, 32, 33, 40, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 107, 101, 121, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 41, 10,
+32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10, 32,
+32, 35, 101, 110, 100, 105, 102, 10, 35, 101, 108, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 97,
+115, 115, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 47, 47, 32, 83, 112,
+101, 99, 105, 97, 108, 58, 32, 87, 104, 101, 110, 32, 111, 110, 108,
+121, 32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 32, 105, 115,
+32, 100, 101, 102, 105, 110, 101, 100, 44, 32, 97, 108, 115, 111, 32,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97,
+115, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 46,
+10, 32, 32, 47, 47, 32, 68, 111, 32, 110, 111, 116, 32, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32, 104, 101,
+114, 101, 44, 32, 111, 116, 104, 101, 114, 119, 105, 115, 101, 32, 95,
+102, 114, 111, 109, 40, 41, 32, 47, 32, 95, 116, 111, 114, 97, 119,
+40, 41, 32, 105, 115, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32,
+116, 111, 32, 101, 120, 105, 115, 116, 46, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115,
+32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10, 10,
+47, 47, 32, 66, 105, 110, 100, 32, 116, 111, 32, 105, 95, 107, 101,
+121, 32, 34, 99, 108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114,
+115, 34, 58, 32, 95, 99, 108, 111, 110, 101, 44, 32, 95, 100, 114,
+111, 112, 44, 32, 95, 102, 114, 111, 109, 32, 97, 110, 100, 32, 95,
+116, 111, 114, 97, 119, 32, 40, 119, 104, 101, 110, 32, 99, 111, 110,
+100, 105, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 109, 101,
+116, 41, 46, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 10, 32, 32, 35,
+105, 102, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 10, 32, 32, 35,
+101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 111,
+110, 101, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 99, 108,
+111, 110, 101, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101, 121,
+99, 108, 97, 115, 115, 44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32,
+32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+100, 114, 111, 112, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101,
+121, 99, 108, 97, 115, 115, 44, 32, 95, 100, 114, 111, 112, 41, 10,
+32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 102,
+114, 111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 102, 114, 111,
+109, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101, 121, 99, 108,
+97, 115, 115, 44, 32, 95, 102, 114, 111, 109, 41, 10, 32, 32, 35, 101,
+108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+107, 101, 121, 102, 114, 111, 109, 32, 38, 38, 32, 33, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+107, 101, 121, 102, 114, 111, 109, 32, 99, 95, 74, 79, 73, 78, 40,
+105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 44, 32, 95, 99, 108,
+111, 110, 101, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32,
+32, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105,
+95, 107, 101, 121, 116, 111, 114, 97, 119, 32, 38, 38, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10,
+32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 116, 111, 114, 97, 119, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 107, 101, 121, 99, 108, 97, 115, 115, 44, 32, 95, 116, 111, 114,
+97, 119, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 47, 47, 32, 68, 101, 102, 105, 110, 101,
+32, 119, 104, 101, 110, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114,
+32, 104, 97, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+114, 32, 115, 111, 114, 116, 105, 110, 103, 32, 40, 99, 109, 112, 41,
+32, 97, 110, 100, 32, 108, 105, 110, 101, 97, 114, 32, 115, 101, 97,
+114, 99, 104, 32, 40, 101, 113, 41, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112,
+32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99,
+109, 112, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 108, 101, 115, 115, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 32, 124, 124,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117,
+115, 101, 95, 101, 113, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 101, 113, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 47, 47, 32, 66, 105, 110, 100, 32, 116,
+111, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 34, 99,
+108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114, 115, 34, 58, 32,
+95, 99, 109, 112, 44, 32, 95, 101, 113, 32, 97, 110, 100, 32, 95, 104,
+97, 115, 104, 32, 40, 119, 104, 101, 110, 32, 99, 111, 110, 100, 105,
+116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 109, 101, 116, 41, 46,
+10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+99, 109, 112, 99, 108, 97, 115, 115, 10, 32, 32, 35, 105, 102, 32, 33,
+40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 108,
+101, 115, 115, 41, 32, 38, 38, 32, 40, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 32, 124, 124, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 115, 111, 114,
+116, 101, 100, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 105, 95, 99, 109, 112, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 99, 109, 112, 99, 108, 97, 115, 115, 44, 32, 95, 99, 109, 112, 41,
+10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32,
+33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101, 113, 32, 38,
+38, 32, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117, 115,
+101, 95, 101, 113, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 104, 97, 115, 104, 32, 124, 124, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95, 104, 97, 115, 104,
+41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+101, 113, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 99, 109, 112, 99,
+108, 97, 115, 115, 44, 32, 95, 101, 113, 41, 10, 32, 32, 35, 101, 110,
+100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 40, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 104, 97, 115, 104, 32, 124, 124, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 104, 97,
+115, 104, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 104, 97, 115, 104, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 99, 109, 112, 99, 108, 97, 115, 115, 44, 32, 95, 104, 97, 115,
+104, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 35, 101, 110,
+100, 105, 102, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 10, 32, 32, 35, 101, 114, 114,
+111, 114, 32, 34, 78, 111, 32, 105, 95, 107, 101, 121, 32, 100, 101,
+102, 105, 110, 101, 100, 34, 10, 35, 101, 108, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32,
+38, 38, 32, 33, 40, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 99,
+109, 112, 99, 108, 97, 115, 115, 41, 32, 124, 124, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97,
+119, 41, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 73, 102, 32,
+105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 47, 32, 105, 95,
+107, 101, 121, 114, 97, 119, 32, 105, 115, 32, 100, 101, 102, 105,
+110, 101, 100, 44, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119,
+32, 109, 117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 116, 111, 111, 34, 10, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108, 111,
+110, 101, 32, 38, 38, 32, 40, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 94, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 100, 114, 111,
+112, 41, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 66, 111,
+116, 104, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 97,
+110, 100, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 32, 109,
+117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 44,
+32, 105, 102, 32, 97, 110, 121, 32, 40, 117, 110, 108, 101, 115, 115,
+32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 32, 100, 101, 102,
+105, 110, 101, 100, 41, 46, 34, 10, 35, 101, 108, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 102, 114, 111, 109, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 100,
+114, 111, 112, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 105,
+95, 102, 114, 111, 109, 32, 47, 32, 105, 95, 100, 114, 111, 112, 32,
+110, 111, 116, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 46,
+32, 85, 115, 101, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 47,
+105, 95, 107, 101, 121, 100, 114, 111, 112, 34, 10, 35, 101, 108, 105,
+102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101,
+121, 116, 111, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 118, 97, 108, 116, 111, 10, 32, 32, 35, 101, 114, 114,
+111, 114, 32, 105, 95, 107, 101, 121, 116, 111, 32, 47, 32, 105, 95,
+118, 97, 108, 116, 111, 32, 110, 111, 116, 32, 115, 117, 112, 112,
+111, 114, 116, 101, 100, 46, 32, 85, 115, 101, 32, 105, 95, 107, 101,
+121, 116, 111, 114, 97, 119, 32, 47, 32, 105, 95, 118, 97, 108, 116,
+111, 114, 97, 119, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32, 38, 38,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117, 115, 101, 95,
+99, 109, 112, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 32, 32, 35, 101,
+114, 114, 111, 114, 32, 34, 70, 111, 114, 32, 115, 109, 97, 112, 32,
+47, 32, 115, 115, 101, 116, 32, 47, 32, 112, 113, 117, 101, 117, 101,
+44, 32, 105, 95, 99, 109, 112, 32, 111, 114, 32, 105, 95, 108, 101,
+115, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 119, 104, 101, 110, 32, 105, 95, 107, 101, 121,
+114, 97, 119, 32, 105, 115, 32, 100, 101, 102, 105, 110, 101, 100, 46,
+34, 10, 35, 101, 110, 100, 105, 102, 10, 10, 47, 47, 32, 70, 105, 108,
+108, 32, 105, 110, 32, 109, 105, 115, 115, 105, 110, 103, 32, 105, 95,
+101, 113, 44, 32, 105, 95, 108, 101, 115, 115, 44, 32, 105, 95, 99,
+109, 112, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119,
+105, 116, 104, 32, 100, 101, 102, 97, 117, 108, 116, 115, 46, 10, 35,
+105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101,
+113, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+99, 109, 112, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105,
+95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 40, 105, 95, 99, 109, 112,
+40, 120, 44, 32, 121, 41, 41, 32, 61, 61, 32, 48, 10, 35, 101, 108,
+105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101,
+113, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 101,
+113, 40, 120, 44, 32, 121, 41, 32, 42, 120, 32, 61, 61, 32, 42, 121,
+32, 47, 47, 32, 119, 111, 114, 107, 115, 32, 102, 111, 114, 32, 105,
+110, 116, 101, 103, 114, 97, 108, 32, 116, 121, 112, 101, 115, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 32, 38, 38, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 108, 101, 115, 115, 40,
+120, 44, 32, 121, 41, 32, 40, 105, 95, 99, 109, 112, 40, 120, 44, 32,
+121, 41, 41, 32, 60, 32, 48, 10, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 108, 101, 115, 115,
+40, 120, 44, 32, 121, 41, 32, 42, 120, 32, 60, 32, 42, 121, 32, 47,
+47, 32, 119, 111, 114, 107, 115, 32, 102, 111, 114, 32, 105, 110, 116,
+101, 103, 114, 97, 108, 32, 116, 121, 112, 101, 115, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 99, 109, 112, 32, 38, 38, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 40, 120, 44, 32,
+121, 41, 32, 40, 105, 95, 108, 101, 115, 115, 40, 121, 44, 32, 120,
+41, 41, 32, 45, 32, 40, 105, 95, 108, 101, 115, 115, 40, 120, 44, 32,
+121, 41, 41, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32,
+33, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 104, 97, 115,
+104, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+110, 111, 95, 104, 97, 115, 104, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 104, 97, 115, 104, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 104, 97, 115, 104, 10, 35, 101, 110, 100,
+105, 102, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 110,
+111, 95, 101, 109, 112, 108, 97, 99, 101, 10, 10, 35, 105, 102, 110,
+100, 101, 102, 32, 105, 95, 116, 97, 103, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 105, 95, 107, 101,
+121, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 102, 114,
+111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105,
+95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 38, 38, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 102, 114, 111, 109, 32, 105, 95, 107, 101, 121, 99, 108,
+111, 110, 101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 102,
+114, 111, 109, 32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 99,
+108, 111, 110, 101, 10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97,
+99, 101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 114, 97,
+119, 32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 116,
+111, 114, 97, 119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 116, 111, 114, 97, 119, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 107,
+101, 121, 99, 108, 111, 110, 101, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 99,
+95, 100, 101, 102, 97, 117, 108, 116, 95, 99, 108, 111, 110, 101, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32,
+105, 95, 107, 101, 121, 100, 114, 111, 112, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112,
+32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 100, 114, 111, 112,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95, 109, 97, 112,
+32, 47, 47, 32, 45, 45, 45, 45, 32, 112, 114, 111, 99, 101, 115, 115,
+32, 104, 97, 115, 104, 109, 97, 112, 47, 115, 111, 114, 116, 101, 100,
+109, 97, 112, 32, 118, 97, 108, 117, 101, 32, 105, 95, 118, 97, 108,
+44, 32, 46, 46, 46, 32, 45, 45, 45, 45, 10, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 112, 114,
+111, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 99, 108, 97, 115, 115, 32, 105, 95, 118, 97, 108, 112, 114,
+111, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 114, 97, 119, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118,
+97, 108, 112, 114, 111, 44, 32, 95, 114, 97, 119, 41, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 105, 95,
+118, 97, 108, 99, 108, 97, 115, 115, 10, 32, 32, 35, 105, 102, 110,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 105, 95, 118,
+97, 108, 99, 108, 97, 115, 115, 10, 32, 32, 35, 101, 110, 100, 105,
+102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 38, 38,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95,
+99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 99,
+95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115, 115,
+44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32, 32, 35, 101, 110, 100,
+105, 102, 10, 32, 32, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95,
+118, 97, 108, 100, 114, 111, 112, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 32,
+99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115,
+115, 44, 32, 95, 100, 114, 111, 112, 41, 10, 32, 32, 35, 101, 110,
+100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 32, 38,
+38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108,
+114, 97, 119, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 32, 99, 95, 74, 79, 73,
+78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115, 115, 44, 32, 95, 102,
+114, 111, 109, 41, 10, 32, 32, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99,
+108, 97, 115, 115, 44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32, 32,
+35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 116, 111,
+114, 97, 119, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97, 119,
+32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97,
+115, 115, 44, 32, 95, 116, 111, 114, 97, 119, 41, 10, 32, 32, 35, 101,
+110, 100, 105, 102, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 35,
+101, 114, 114, 111, 114, 32, 34, 105, 95, 118, 97, 108, 42, 32, 109,
+117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+102, 111, 114, 32, 109, 97, 112, 115, 34, 10, 35, 101, 108, 105, 102,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 114,
+97, 119, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 116, 111, 114, 97, 119, 10, 32, 32, 35, 101,
+114, 114, 111, 114, 32, 34, 73, 102, 32, 105, 95, 118, 97, 108, 114,
+97, 119, 32, 105, 115, 32, 100, 101, 102, 105, 110, 101, 100, 44, 32,
+105, 95, 118, 97, 108, 116, 111, 114, 97, 119, 32, 109, 117, 115, 116,
+32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 32, 116, 111, 111,
+34, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 32, 38, 38,
+32, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108,
+99, 108, 111, 110, 101, 32, 94, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 41, 10, 32, 32, 35,
+101, 114, 114, 111, 114, 32, 34, 66, 111, 116, 104, 32, 105, 95, 118,
+97, 108, 99, 108, 111, 110, 101, 32, 97, 110, 100, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 32, 109, 117, 115, 116, 32, 98, 101, 32,
+100, 101, 102, 105, 110, 101, 100, 44, 32, 105, 102, 32, 97, 110, 121,
+34, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 102,
+114, 111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 38, 38, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 102, 114, 111, 109, 32, 105, 95, 118, 97, 108, 99, 108, 111,
+110, 101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 99, 108,
+111, 110, 101, 10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97, 99,
+101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100, 101,
+102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 114, 97, 119, 32,
+105, 95, 118, 97, 108, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 116, 111, 114, 97, 119, 32, 99, 95, 100, 101, 102, 97, 117,
+108, 116, 95, 116, 111, 114, 97, 119, 10, 35, 101, 110, 100, 105, 102,
+10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 99,
+108, 111, 110, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 99, 108, 111, 110, 101, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 32, 99, 95, 100,
+101, 102, 97, 117, 108, 116, 95, 100, 114, 111, 112, 10, 35, 101, 110,
+100, 105, 102, 10, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32,
+33, 95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 10, 35, 105, 102,
+110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 105, 95, 107,
+101, 121, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 114, 97, 119,
+32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 35, 101, 110, 100, 105,
+102, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95,
+84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95, 73, 78, 67, 76, 85, 68,
+69, 68, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76,
+69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 116, 101, 109, 112, 108,
+97, 116, 101, 46, 104, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105,
+95, 100, 101, 99, 108, 97, 114, 101, 100, 10, 32, 32, 95, 99, 95, 68,
+69, 70, 84, 89, 80, 69, 83, 40, 100, 101, 99, 108, 97, 114, 101, 95,
+104, 116, 97, 98, 108, 101, 44, 32, 83, 101, 108, 102, 44, 32, 105,
+95, 107, 101, 121, 44, 32, 105, 95, 118, 97, 108, 44, 32, 95, 105, 95,
+77, 65, 80, 95, 79, 78, 76, 89, 44, 32, 95, 105, 95, 83, 69, 84, 95,
+79, 78, 76, 89, 41, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 95,
+105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 115, 116, 114, 117,
+99, 116, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 123, 10, 32, 32,
+32, 32, 95, 109, 95, 107, 101, 121, 32, 102, 105, 114, 115, 116, 59,
+10, 32, 32, 32, 32, 95, 109, 95, 109, 97, 112, 112, 101, 100, 32, 115,
+101, 99, 111, 110, 100, 59, 10, 125, 59, 32, 41, 10, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32,
+95, 109, 95, 107, 101, 121, 114, 97, 119, 59, 10, 116, 121, 112, 101,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 32, 95, 109,
+95, 114, 109, 97, 112, 112, 101, 100, 59, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 95, 105, 95, 83, 69, 84, 95, 79, 78, 76, 89, 40, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 32, 41, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 32, 95, 109, 95, 107, 101, 121, 114,
+97, 119, 32, 102, 105, 114, 115, 116, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 95, 109, 95, 114, 109, 97, 112, 112, 101,
+100, 32, 115, 101, 99, 111, 110, 100, 59, 32, 125, 32, 41, 10, 95,
+109, 95, 114, 97, 119, 59, 10, 10, 83, 84, 67, 95, 65, 80, 73, 32, 83,
+101, 108, 102, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 119, 105, 116, 104, 95, 99, 97, 112, 97,
+99, 105, 116, 121, 41, 40, 105, 115, 105, 122, 101, 32, 99, 97, 112,
+41, 59, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 83, 84, 67, 95,
+65, 80, 73, 32, 83, 101, 108, 102, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 108, 111, 110,
+101, 41, 40, 83, 101, 108, 102, 32, 109, 97, 112, 41, 59, 10, 35, 101,
+110, 100, 105, 102, 10, 83, 84, 67, 95, 65, 80, 73, 32, 118, 111, 105,
+100, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 100, 114, 111, 112, 41, 40, 99, 111, 110, 115,
+116, 32, 83, 101, 108, 102, 42, 32, 99, 115, 101, 108, 102, 41, 59,
+10, 83, 84, 67, 95, 65, 80, 73, 32, 118, 111, 105, 100, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 99, 108, 101, 97, 114, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 41, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32, 95, 66,
+111, 111, 108, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 105, 115, 105,
+122, 101, 32, 99, 97, 112, 97, 99, 105, 116, 121, 41, 59, 10, 83, 84,
+67, 95, 65, 80, 73, 32, 118, 111, 105, 100, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 114,
+97, 115, 101, 95, 101, 110, 116, 114, 121, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117,
+101, 42, 32, 118, 97, 108, 41, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32,
+102, 108, 111, 97, 116, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 109, 97, 120, 95, 108, 111, 97,
+100, 95, 102, 97, 99, 116, 111, 114, 41, 40, 99, 111, 110, 115, 116,
+32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 59, 10, 83, 84,
+67, 95, 65, 80, 73, 32, 105, 115, 105, 122, 101, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 97,
+112, 97, 99, 105, 116, 121, 41, 40, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 109, 97, 112, 41, 59, 10, 115, 116, 97, 116,
+105, 99, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99,
+107, 101, 116, 95, 108, 111, 111, 107, 117, 112, 95, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 107, 101, 121, 114, 97,
+119, 42, 32, 114, 107, 101, 121, 112, 116, 114, 41, 59, 10, 115, 116,
+97, 116, 105, 99, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32,
+32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98,
+117, 99, 107, 101, 116, 95, 105, 110, 115, 101, 114, 116, 95, 41, 40,
+99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108,
+102, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 107, 101, 121,
+114, 97, 119, 42, 32, 114, 107, 101, 121, 112, 116, 114, 41, 59, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 115, 104, 114, 105, 110, 107, 95, 116, 111, 95, 102, 105, 116, 41,
+40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101,
+41, 40, 115, 101, 108, 102, 44, 32, 40, 105, 115, 105, 122, 101, 41,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 41, 59, 32, 125, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 66, 111, 111, 108, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+105, 115, 95, 101, 109, 112, 116, 121, 41, 40, 99, 111, 110, 115, 116,
+32, 83, 101, 108, 102, 42, 32, 109, 97, 112, 41, 32, 123, 32, 114,
+101, 116, 117, 114, 110, 32, 33, 109, 97, 112, 45, 62, 115, 105, 122,
+101, 59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 105,
+115, 105, 122, 101, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 115, 105, 122, 101, 41, 40, 99, 111, 110, 115,
+116, 32, 83, 101, 108, 102, 42, 32, 109, 97, 112, 41, 32, 123, 32,
+114, 101, 116, 117, 114, 110, 32, 40, 105, 115, 105, 122, 101, 41,
+109, 97, 112, 45, 62, 115, 105, 122, 101, 59, 32, 125, 10, 83, 84, 67,
+95, 73, 78, 76, 73, 78, 69, 32, 105, 115, 105, 122, 101, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99,
+107, 101, 116, 95, 99, 111, 117, 110, 116, 41, 40, 83, 101, 108, 102,
+42, 32, 109, 97, 112, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110,
+32, 109, 97, 112, 45, 62, 98, 117, 99, 107, 101, 116, 95, 99, 111,
+117, 110, 116, 59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78,
+69, 32, 95, 66, 111, 111, 108, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 99, 111, 110, 116, 97, 105, 110, 115,
+41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32,
+114, 107, 101, 121, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 115, 101, 108, 102, 45,
+62, 115, 105, 122, 101, 32, 38, 38, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 98, 117, 99, 107, 101, 116, 95, 108, 111, 111, 107, 117, 112,
+95, 41, 40, 115, 101, 108, 102, 44, 32, 38, 114, 107, 101, 121, 41,
+46, 114, 101, 102, 59, 32, 125, 10, 10, 35, 105, 102, 110, 100, 101,
+102, 32, 105, 95, 109, 97, 120, 95, 108, 111, 97, 100, 95, 102, 97,
+99, 116, 111, 114, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 109, 97, 120, 95, 108, 111, 97, 100, 95, 102, 97, 99, 116,
+111, 114, 32, 48, 46, 56, 48, 102, 10, 35, 101, 110, 100, 105, 102,
+10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 114,
+101, 115, 117, 108, 116, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105,
+110, 115, 101, 114, 116, 95, 101, 110, 116, 114, 121, 95, 41, 40, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107,
+101, 121, 114, 97, 119, 32, 114, 107, 101, 121, 41, 32, 123, 10, 32,
+32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62, 115, 105,
+122, 101, 32, 62, 61, 32, 40, 105, 115, 105, 122, 101, 41, 40, 40,
+102, 108, 111, 97, 116, 41, 115, 101, 108, 102, 45, 62, 98, 117, 99,
+107, 101, 116, 95, 99, 111, 117, 110, 116, 32, 42, 32, 40, 105, 95,
+109, 97, 120, 95, 108, 111, 97, 100, 95, 102, 97, 99, 116, 111, 114,
+41, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101,
+41, 40, 115, 101, 108, 102, 44, 32, 40, 105, 115, 105, 122, 101, 41,
+40, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 42, 51, 47, 50,
+32, 43, 32, 50, 41, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 95, 108, 105, 116,
+101, 114, 97, 108, 40, 95, 109, 95, 114, 101, 115, 117, 108, 116, 41,
+123, 48, 125, 59, 10, 10, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115,
+117, 108, 116, 32, 114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 98, 117, 99, 107, 101, 116, 95, 105, 110, 115, 101, 114,
+116, 95, 41, 40, 115, 101, 108, 102, 44, 32, 38, 114, 107, 101, 121,
+41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 45, 62, 115, 105, 122,
+101, 32, 43, 61, 32, 114, 101, 115, 46, 105, 110, 115, 101, 114, 116,
+101, 100, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+114, 101, 115, 59, 10, 125, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 32, 32, 32, 32, 83, 84,
+67, 95, 65, 80, 73, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 95,
+111, 114, 95, 97, 115, 115, 105, 103, 110, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 32,
+107, 101, 121, 44, 32, 95, 109, 95, 109, 97, 112, 112, 101, 100, 32,
+109, 97, 112, 112, 101, 100, 41, 59, 10, 32, 32, 32, 32, 35, 105, 102,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95,
+101, 109, 112, 108, 97, 99, 101, 10, 32, 32, 32, 32, 83, 84, 67, 95,
+65, 80, 73, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 101, 109, 112, 108, 97, 99, 101, 95, 111,
+114, 95, 97, 115, 115, 105, 103, 110, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97,
+119, 32, 114, 107, 101, 121, 44, 32, 95, 109, 95, 114, 109, 97, 112,
+112, 101, 100, 32, 114, 109, 97, 112, 112, 101, 100, 41, 59, 10, 32,
+32, 32, 32, 35, 101, 110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 83,
+84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 99, 111, 110, 115, 116, 32,
+95, 109, 95, 109, 97, 112, 112, 101, 100, 42, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 97, 116, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101,
+108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101,
+121, 114, 97, 119, 32, 114, 107, 101, 121, 41, 32, 123, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32,
+114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98,
+117, 99, 107, 101, 116, 95, 108, 111, 111, 107, 117, 112, 95, 41, 40,
+115, 101, 108, 102, 44, 32, 38, 114, 107, 101, 121, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40,
+114, 101, 115, 46, 114, 101, 102, 41, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 114, 101, 116, 117, 114, 110, 32, 38, 114, 101, 115, 46, 114,
+101, 102, 45, 62, 115, 101, 99, 111, 110, 100, 59, 10, 32, 32, 32, 32,
+125, 10, 10, 32, 32, 32, 32, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69,
+32, 95, 109, 95, 109, 97, 112, 112, 101, 100, 42, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 97, 116, 95, 109, 117, 116, 41, 40, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121,
+114, 97, 119, 32, 114, 107, 101, 121, 41, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 40, 95, 109, 95,
+109, 97, 112, 112, 101, 100, 42, 41, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 97, 116, 41, 40, 115, 101, 108, 102, 44, 32, 114, 107, 101, 121,
+41, 59, 32, 125, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 95,
+105, 95, 105, 115, 95, 109, 97, 112, 10, 10, 35, 105, 102, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108,
+111, 110, 101, 10, 32, 32, 32, 32, 83, 84, 67, 95, 73, 78, 76, 73, 78,
+69, 32, 118, 111, 105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+99, 111, 112, 121, 41, 40, 83, 101, 108, 102, 32, 42, 115, 101, 108,
+102, 44, 32, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32,
+111, 116, 104, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 105, 102, 32, 40, 115, 101, 108, 102, 32, 61, 61, 32, 111, 116,
+104, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111, 112, 41, 40, 115,
+101, 108, 102, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 42, 115,
+101, 108, 102, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99,
+108, 111, 110, 101, 41, 40, 42, 111, 116, 104, 101, 114, 41, 59, 10,
+32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 83, 84, 67, 95, 73, 78,
+76, 73, 78, 69, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 99, 108, 111,
+110, 101, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117, 101,
+32, 95, 118, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+40, 118, 111, 105, 100, 41, 115, 101, 108, 102, 59, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 42, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40,
+38, 95, 118, 97, 108, 41, 32, 61, 32, 105, 95, 107, 101, 121, 99, 108,
+111, 110, 101, 40, 40, 42, 95, 105, 95, 107, 101, 121, 114, 101, 102,
+40, 38, 95, 118, 97, 108, 41, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 95, 118,
+97, 108, 46, 115, 101, 99, 111, 110, 100, 32, 61, 32, 105, 95, 118,
+97, 108, 99, 108, 111, 110, 101, 40, 95, 118, 97, 108, 46, 115, 101,
+99, 111, 110, 100, 41, 59, 32, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+114, 101, 116, 117, 114, 110, 32, 95, 118, 97, 108, 59, 10, 32, 32,
+32, 32, 125, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 33, 105,
+95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 10, 35, 105, 102, 32,
+33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 101,
+109, 112, 108, 97, 99, 101, 10, 32, 32, 32, 32, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 10,
+32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 109, 112,
+108, 97, 99, 101, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108,
+102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32, 114, 107,
+101, 121, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 44, 32,
+95, 109, 95, 114, 109, 97, 112, 112, 101, 100, 32, 114, 109, 97, 112,
+112, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 95, 114, 101, 115, 32,
+61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114,
+116, 95, 101, 110, 116, 114, 121, 95, 41, 40, 115, 101, 108, 102, 44,
+32, 114, 107, 101, 121, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+105, 102, 32, 40, 95, 114, 101, 115, 46, 105, 110, 115, 101, 114, 116,
+101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 42, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40, 95, 114, 101,
+115, 46, 114, 101, 102, 41, 32, 61, 32, 105, 95, 107, 101, 121, 102,
+114, 111, 109, 40, 114, 107, 101, 121, 41, 59, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76,
+89, 40, 32, 95, 114, 101, 115, 46, 114, 101, 102, 45, 62, 115, 101,
+99, 111, 110, 100, 32, 61, 32, 105, 95, 118, 97, 108, 102, 114, 111,
+109, 40, 114, 109, 97, 112, 112, 101, 100, 41, 59, 32, 41, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 114, 101, 115, 59, 10, 32, 32, 32,
+32, 125, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 33, 105, 95,
+110, 111, 95, 101, 109, 112, 108, 97, 99, 101, 10, 10, 83, 84, 67, 95,
+73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 114, 97, 119, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 116, 111, 114, 97,
+119, 41, 40, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 32, 118, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 105, 95, 83, 69, 84, 95, 79, 78, 76,
+89, 40, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 118,
+97, 108, 41, 32, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 99, 95, 108, 105,
+116, 101, 114, 97, 108, 40, 95, 109, 95, 114, 97, 119, 41, 123, 105,
+95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 40, 38, 118, 97, 108,
+45, 62, 102, 105, 114, 115, 116, 41, 41, 44, 32, 105, 95, 118, 97,
+108, 116, 111, 114, 97, 119, 40, 40, 38, 118, 97, 108, 45, 62, 115,
+101, 99, 111, 110, 100, 41, 41, 125, 32, 41, 59, 10, 125, 10, 10, 83,
+84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 100, 114,
+111, 112, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117, 101,
+42, 32, 95, 118, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 40, 118,
+111, 105, 100, 41, 115, 101, 108, 102, 59, 10, 32, 32, 32, 32, 105,
+95, 107, 101, 121, 100, 114, 111, 112, 40, 95, 105, 95, 107, 101, 121,
+114, 101, 102, 40, 95, 118, 97, 108, 41, 41, 59, 10, 32, 32, 32, 32,
+95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 105, 95, 118, 97,
+108, 100, 114, 111, 112, 40, 40, 38, 95, 118, 97, 108, 45, 62, 115,
+101, 99, 111, 110, 100, 41, 41, 59, 32, 41, 10, 125, 10, 10, 83, 84,
+67, 95, 73, 78, 76, 73, 78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 109, 111, 118, 101, 41, 40, 83, 101, 108, 102,
+32, 42, 115, 101, 108, 102, 41, 32, 123, 10, 32, 32, 32, 32, 83, 101,
+108, 102, 32, 109, 32, 61, 32, 42, 115, 101, 108, 102, 59, 10, 32, 32,
+32, 32, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107, 101, 116, 95,
+99, 111, 117, 110, 116, 32, 61, 32, 115, 101, 108, 102, 45, 62, 115,
+105, 122, 101, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 115, 101, 108,
+102, 45, 62, 109, 101, 116, 97, 32, 61, 32, 78, 85, 76, 76, 59, 32,
+115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 32, 61, 32, 78, 85,
+76, 76, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118,
+111, 105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 116, 97, 107,
+101, 41, 40, 83, 101, 108, 102, 32, 42, 115, 101, 108, 102, 44, 32,
+83, 101, 108, 102, 32, 117, 110, 111, 119, 110, 101, 100, 41, 32, 123,
+10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111,
+112, 41, 40, 115, 101, 108, 102, 41, 59, 10, 32, 32, 32, 32, 42, 115,
+101, 108, 102, 32, 61, 32, 117, 110, 111, 119, 110, 101, 100, 59, 10,
+125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95,
+114, 101, 115, 117, 108, 116, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+105, 110, 115, 101, 114, 116, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 32, 95, 107, 101,
+121, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 44, 32, 95,
+109, 95, 109, 97, 112, 112, 101, 100, 32, 95, 109, 97, 112, 112, 101,
+100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115,
+117, 108, 116, 32, 95, 114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 95, 101, 110, 116, 114,
+121, 95, 41, 40, 115, 101, 108, 102, 44, 32, 105, 95, 107, 101, 121,
+116, 111, 114, 97, 119, 40, 40, 38, 95, 107, 101, 121, 41, 41, 41, 59,
+10, 32, 32, 32, 32, 105, 102, 32, 40, 95, 114, 101, 115, 46, 105, 110,
+115, 101, 114, 116, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+123, 32, 42, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40, 95, 114,
+101, 115, 46, 114, 101, 102, 41, 32, 61, 32, 95, 107, 101, 121, 59,
+32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40, 32, 95, 114, 101,
+115, 46, 114, 101, 102, 45, 62, 115, 101, 99, 111, 110, 100, 32, 61,
+32, 95, 109, 97, 112, 112, 101, 100, 59, 32, 41, 125, 10, 32, 32, 32,
+32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 32,
+105, 95, 107, 101, 121, 100, 114, 111, 112, 40, 40, 38, 95, 107, 101,
+121, 41, 41, 59, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78, 76, 89, 40,
+32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 40, 40, 38, 95, 109,
+97, 112, 112, 101, 100, 41, 41, 59, 32, 41, 125, 10, 32, 32, 32, 32,
+114, 101, 116, 117, 114, 110, 32, 95, 114, 101, 115, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 118, 97,
+108, 117, 101, 42, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112, 117,
+115, 104, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 95, 118, 97, 108, 41, 32,
+123, 10, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116,
+32, 95, 114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+105, 110, 115, 101, 114, 116, 95, 101, 110, 116, 114, 121, 95, 41, 40,
+115, 101, 108, 102, 44, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97,
+119, 40, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40, 38, 95, 118,
+97, 108, 41, 41, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 95,
+114, 101, 115, 46, 105, 110, 115, 101, 114, 116, 101, 100, 41, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 42, 95, 114, 101, 115, 46, 114, 101, 102,
+32, 61, 32, 95, 118, 97, 108, 59, 10, 32, 32, 32, 32, 101, 108, 115,
+101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 118, 97, 108, 117, 101, 95, 100, 114, 111, 112, 41, 40, 115,
+101, 108, 102, 44, 32, 38, 95, 118, 97, 108, 41, 59, 10, 32, 32, 32,
+32, 114, 101, 116, 117, 114, 110, 32, 95, 114, 101, 115, 46, 114, 101,
+102, 59, 10, 125, 10, 10, 35, 105, 102, 100, 101, 102, 32, 95, 105,
+95, 105, 115, 95, 109, 97, 112, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 112, 117, 116, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97,
+119, 32, 114, 107, 101, 121, 44, 32, 95, 109, 95, 114, 109, 97, 112,
+112, 101, 100, 32, 114, 109, 97, 112, 112, 101, 100, 41, 32, 123, 10,
+32, 32, 32, 32, 35, 105, 102, 100, 101, 102, 32, 105, 95, 110, 111,
+95, 101, 109, 112, 108, 97, 99, 101, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 114, 101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 105, 110, 115, 101, 114, 116, 95, 111, 114, 95, 97, 115, 115, 105,
+103, 110, 41, 40, 115, 101, 108, 102, 44, 32, 114, 107, 101, 121, 44,
+32, 114, 109, 97, 112, 112, 101, 100, 41, 59, 10, 32, 32, 32, 32, 35,
+101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 109, 112,
+108, 97, 99, 101, 95, 111, 114, 95, 97, 115, 115, 105, 103, 110, 41,
+40, 115, 101, 108, 102, 44, 32, 114, 107, 101, 121, 44, 32, 114, 109,
+97, 112, 112, 101, 100, 41, 59, 10, 32, 32, 32, 32, 35, 101, 110, 100,
+105, 102, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 83, 84,
+67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 112, 117, 116, 95, 110, 41, 40, 83, 101,
+108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116,
+32, 95, 109, 95, 114, 97, 119, 42, 32, 114, 97, 119, 44, 32, 105, 115,
+105, 122, 101, 32, 110, 41, 32, 123, 10, 32, 32, 32, 32, 119, 104,
+105, 108, 101, 32, 40, 110, 45, 45, 41, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95,
+105, 95, 105, 115, 95, 115, 101, 116, 32, 38, 38, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97,
+99, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 41, 40, 115,
+101, 108, 102, 44, 32, 42, 114, 97, 119, 43, 43, 41, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 35, 101, 108, 105, 102, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95, 115, 101, 116, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 101, 109, 112, 108, 97, 99, 101, 41, 40, 115, 101,
+108, 102, 44, 32, 42, 114, 97, 119, 43, 43, 41, 59, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112,
+117, 116, 41, 40, 115, 101, 108, 102, 44, 32, 114, 97, 119, 45, 62,
+102, 105, 114, 115, 116, 44, 32, 114, 97, 119, 45, 62, 115, 101, 99,
+111, 110, 100, 41, 44, 32, 43, 43, 114, 97, 119, 59, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10, 125, 10, 10, 35,
+105, 102, 110, 100, 101, 102, 32, 105, 95, 97, 117, 120, 10, 83, 84,
+67, 95, 73, 78, 76, 73, 78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 105, 110, 105, 116, 41, 40, 118, 111, 105,
+100, 41, 10, 32, 32, 32, 32, 123, 32, 83, 101, 108, 102, 32, 109, 97,
+112, 32, 61, 32, 123, 48, 125, 59, 32, 114, 101, 116, 117, 114, 110,
+32, 109, 97, 112, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+102, 114, 111, 109, 95, 110, 41, 40, 99, 111, 110, 115, 116, 32, 95,
+109, 95, 114, 97, 119, 42, 32, 114, 97, 119, 44, 32, 105, 115, 105,
+122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32, 83, 101, 108, 102,
+32, 99, 120, 32, 61, 32, 123, 48, 125, 59, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 112, 117, 116, 95, 110, 41, 40, 38, 99, 120, 44, 32, 114,
+97, 119, 44, 32, 110, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32,
+99, 120, 59, 32, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 83, 84,
+67, 95, 65, 80, 73, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 98, 101, 103, 105, 110, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41,
+59, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95,
+105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 110,
+100, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 41, 10, 32, 32, 32, 32, 123, 32, 40, 118, 111,
+105, 100, 41, 115, 101, 108, 102, 59, 32, 114, 101, 116, 117, 114,
+110, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 95, 109, 95,
+105, 116, 101, 114, 41, 123, 48, 125, 59, 32, 125, 10, 10, 83, 84, 67,
+95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 110, 101, 120, 116, 41, 40, 95, 109, 95, 105,
+116, 101, 114, 42, 32, 105, 116, 41, 32, 123, 10, 32, 32, 32, 32, 119,
+104, 105, 108, 101, 32, 40, 40, 43, 43, 105, 116, 45, 62, 114, 101,
+102, 44, 32, 40, 43, 43, 105, 116, 45, 62, 95, 109, 114, 101, 102, 41,
+45, 62, 100, 105, 115, 116, 32, 61, 61, 32, 48, 41, 41, 32, 59, 10,
+32, 32, 32, 32, 105, 102, 32, 40, 105, 116, 45, 62, 114, 101, 102, 32,
+61, 61, 32, 105, 116, 45, 62, 95, 101, 110, 100, 41, 32, 105, 116, 45,
+62, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76, 59, 10, 125, 10, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116,
+101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 97, 100, 118, 97,
+110, 99, 101, 41, 40, 95, 109, 95, 105, 116, 101, 114, 32, 105, 116,
+44, 32, 115, 105, 122, 101, 95, 116, 32, 110, 41, 32, 123, 10, 32, 32,
+32, 32, 119, 104, 105, 108, 101, 32, 40, 110, 45, 45, 32, 38, 38, 32,
+105, 116, 46, 114, 101, 102, 41, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 110, 101, 120, 116, 41, 40, 38, 105, 116, 41, 59, 10, 32, 32, 32,
+32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 59, 10, 125, 10, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116,
+101, 114, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 102, 105, 110, 100,
+41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32,
+114, 107, 101, 121, 41, 32, 123, 10, 32, 32, 32, 32, 95, 109, 95, 118,
+97, 108, 117, 101, 42, 32, 114, 101, 102, 59, 10, 32, 32, 32, 32, 105,
+102, 32, 40, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 33,
+61, 32, 48, 32, 38, 38, 32, 40, 114, 101, 102, 32, 61, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116, 95, 108, 111, 111,
+107, 117, 112, 95, 41, 40, 115, 101, 108, 102, 44, 32, 38, 114, 107,
+101, 121, 41, 46, 114, 101, 102, 41, 32, 33, 61, 32, 78, 85, 76, 76,
+41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 95, 109, 95, 105,
+116, 101, 114, 41, 123, 114, 101, 102, 44, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 38, 115, 101, 108, 102,
+45, 62, 116, 97, 98, 108, 101, 91, 115, 101, 108, 102, 45, 62, 98,
+117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 93, 44, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 38,
+115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 91, 114, 101, 102, 32,
+45, 32, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 93, 125,
+59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 101, 110, 100, 41, 40, 115, 101, 108, 102, 41,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 99,
+111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108, 117, 101, 42, 10,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 103, 101, 116, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32, 114, 107, 101, 121,
+41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 63, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116, 95, 108, 111,
+111, 107, 117, 112, 95, 41, 40, 115, 101, 108, 102, 44, 32, 38, 114,
+107, 101, 121, 41, 46, 114, 101, 102, 32, 58, 32, 78, 85, 76, 76, 59,
+10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109,
+95, 118, 97, 108, 117, 101, 42, 10, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 103, 101, 116, 95, 109, 117, 116, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97,
+119, 32, 114, 107, 101, 121, 41, 10, 32, 32, 32, 32, 123, 32, 114,
+101, 116, 117, 114, 110, 32, 40, 95, 109, 95, 118, 97, 108, 117, 101,
+42, 41, 95, 99, 95, 77, 69, 77, 66, 40, 95, 103, 101, 116, 41, 40,
+115, 101, 108, 102, 44, 32, 114, 107, 101, 121, 41, 59, 32, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 105, 110, 116, 10, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 101, 114, 97, 115, 101, 41, 40, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107,
+101, 121, 114, 97, 119, 32, 114, 107, 101, 121, 41, 32, 123, 10, 32,
+32, 32, 32, 95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 114, 101,
+102, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45,
+62, 115, 105, 122, 101, 32, 33, 61, 32, 48, 32, 38, 38, 32, 40, 114,
+101, 102, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99,
+107, 101, 116, 95, 108, 111, 111, 107, 117, 112, 95, 41, 40, 115, 101,
+108, 102, 44, 32, 38, 114, 107, 101, 121, 41, 46, 114, 101, 102, 41,
+32, 33, 61, 32, 78, 85, 76, 76, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 123, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 114, 97, 115,
+101, 95, 101, 110, 116, 114, 121, 41, 40, 115, 101, 108, 102, 44, 32,
+114, 101, 102, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32, 49, 59,
+32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59,
+10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109,
+95, 105, 116, 101, 114, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101,
+114, 97, 115, 101, 95, 97, 116, 41, 40, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 44, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105,
+116, 41, 32, 123, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 101, 114, 97, 115, 101, 95, 101, 110, 116, 114, 121, 41, 40, 115,
+101, 108, 102, 44, 32, 105, 116, 46, 114, 101, 102, 41, 59, 10, 32,
+32, 32, 32, 105, 102, 32, 40, 105, 116, 46, 95, 109, 114, 101, 102,
+45, 62, 100, 105, 115, 116, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 110, 101, 120,
+116, 41, 40, 38, 105, 116, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 105, 116, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 95, 66, 111, 111, 108, 10, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 101, 113, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101,
+108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116,
+32, 83, 101, 108, 102, 42, 32, 111, 116, 104, 101, 114, 41, 32, 123,
+10, 32, 32, 32, 32, 105, 102, 32, 40, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 115, 105, 122, 101, 41, 40, 115, 101, 108, 102, 41, 32, 33, 61,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 105, 122, 101, 41, 40,
+111, 116, 104, 101, 114, 41, 41, 32, 114, 101, 116, 117, 114, 110, 32,
+48, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 95, 109, 95, 105,
+116, 101, 114, 32, 105, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 98, 101, 103, 105, 110, 41, 40, 115, 101, 108, 102, 41, 59, 32,
+105, 46, 114, 101, 102, 59, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+110, 101, 120, 116, 41, 40, 38, 105, 41, 41, 32, 123, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 107, 101,
+121, 114, 97, 119, 32, 95, 114, 97, 119, 32, 61, 32, 105, 95, 107,
+101, 121, 116, 111, 114, 97, 119, 40, 95, 105, 95, 107, 101, 121, 114,
+101, 102, 40, 105, 46, 114, 101, 102, 41, 41, 59, 10, 32, 32, 32, 32,
+32, 32, 32, 32, 105, 102, 32, 40, 33, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 99, 111, 110, 116, 97, 105, 110, 115, 41, 40, 111, 116, 104, 101,
+114, 44, 32, 95, 114, 97, 119, 41, 41, 32, 114, 101, 116, 117, 114,
+110, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 49, 59, 10, 125, 10, 10, 47, 42, 32, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 32, 73, 77, 80, 76, 69, 77, 69, 78,
+84, 65, 84, 73, 79, 78, 32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 32, 42,
+47, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105,
+95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 10, 83, 84, 67,
+95, 68, 69, 70, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 98, 101, 103, 105, 110, 41, 40, 99, 111, 110,
+115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32,
+123, 10, 32, 32, 32, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105,
+116, 32, 61, 32, 123, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108,
+101, 44, 32, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 44,
+32, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 125, 59, 10, 32,
+32, 32, 32, 105, 102, 32, 40, 105, 116, 46, 114, 101, 102, 32, 61, 61,
+32, 78, 85, 76, 76, 41, 32, 114, 101, 116, 117, 114, 110, 32, 105,
+116, 59, 10, 32, 32, 32, 32, 105, 116, 46, 95, 101, 110, 100, 32, 43,
+61, 32, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107, 101, 116, 95,
+99, 111, 117, 110, 116, 59, 10, 32, 32, 32, 32, 119, 104, 105, 108,
+101, 32, 40, 105, 116, 46, 95, 109, 114, 101, 102, 45, 62, 100, 105,
+115, 116, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+43, 43, 105, 116, 46, 114, 101, 102, 44, 32, 43, 43, 105, 116, 46, 95,
+109, 114, 101, 102, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105,
+116, 46, 114, 101, 102, 32, 61, 61, 32, 105, 116, 46, 95, 101, 110,
+100, 41, 32, 105, 116, 46, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76,
+59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 102, 108, 111,
+97, 116, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 109, 97, 120, 95,
+108, 111, 97, 100, 95, 102, 97, 99, 116, 111, 114, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41,
+32, 123, 10, 32, 32, 32, 32, 40, 118, 111, 105, 100, 41, 115, 101,
+108, 102, 59, 32, 114, 101, 116, 117, 114, 110, 32, 40, 102, 108, 111,
+97, 116, 41, 40, 105, 95, 109, 97, 120, 95, 108, 111, 97, 100, 95,
+102, 97, 99, 116, 111, 114, 41, 59, 10, 125, 10, 10, 83, 84, 67, 95,
+68, 69, 70, 32, 105, 115, 105, 122, 101, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 99, 97, 112, 97, 99, 105, 116, 121, 41, 40, 99, 111, 110,
+115, 116, 32, 83, 101, 108, 102, 42, 32, 109, 97, 112, 41, 32, 123,
+10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 105, 115,
+105, 122, 101, 41, 40, 40, 102, 108, 111, 97, 116, 41, 109, 97, 112,
+45, 62, 98, 117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 32,
+42, 32, 40, 105, 95, 109, 97, 120, 95, 108, 111, 97, 100, 95, 102, 97,
+99, 116, 111, 114, 41, 41, 59, 10, 125, 10, 10, 35, 105, 102, 110,
+100, 101, 102, 32, 105, 95, 97, 117, 120, 10, 83, 84, 67, 95, 68, 69,
+70, 32, 83, 101, 108, 102, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+119, 105, 116, 104, 95, 99, 97, 112, 97, 99, 105, 116, 121, 41, 40,
+99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32, 99, 97, 112,
+41, 32, 123, 10, 32, 32, 32, 32, 83, 101, 108, 102, 32, 109, 97, 112,
+32, 61, 32, 123, 48, 125, 59, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40, 38, 109,
+97, 112, 44, 32, 99, 97, 112, 41, 59, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 109, 97, 112, 59, 10, 125, 10, 35, 101, 110,
+100, 105, 102, 10, 10, 115, 116, 97, 116, 105, 99, 32, 118, 111, 105,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 119, 105, 112, 101, 95,
+41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123,
+10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62, 115,
+105, 122, 101, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 32, 100, 32, 61, 32, 115, 101, 108, 102,
+45, 62, 116, 97, 98, 108, 101, 44, 32, 42, 95, 101, 110, 100, 32, 61,
+32, 38, 100, 91, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107, 101,
+116, 95, 99, 111, 117, 110, 116, 93, 59, 10, 32, 32, 32, 32, 115, 116,
+114, 117, 99, 116, 32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 42,
+32, 109, 32, 61, 32, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97,
+59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 59, 32, 100, 32, 33,
+61, 32, 95, 101, 110, 100, 59, 32, 43, 43, 100, 41, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 105, 102, 32, 40, 40, 109, 43, 43, 41, 45, 62,
+100, 105, 115, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101,
+95, 100, 114, 111, 112, 41, 40, 115, 101, 108, 102, 44, 32, 100, 41,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 118, 111, 105,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111, 112, 41,
+40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 99, 115,
+101, 108, 102, 41, 32, 123, 10, 32, 32, 32, 32, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 32, 61, 32, 40, 83, 101, 108, 102, 42, 41, 99,
+115, 101, 108, 102, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115,
+101, 108, 102, 45, 62, 98, 117, 99, 107, 101, 116, 95, 99, 111, 117,
+110, 116, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 119, 105, 112, 101, 95, 41,
+40, 115, 101, 108, 102, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+105, 95, 102, 114, 101, 101, 40, 115, 101, 108, 102, 45, 62, 109, 101,
+116, 97, 44, 32, 40, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107,
+101, 116, 95, 99, 111, 117, 110, 116, 32, 43, 32, 49, 41, 42, 99, 95,
+115, 105, 122, 101, 111, 102, 32, 42, 115, 101, 108, 102, 45, 62, 109,
+101, 116, 97, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 95,
+102, 114, 101, 101, 40, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108,
+101, 44, 32, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107, 101, 116,
+95, 99, 111, 117, 110, 116, 42, 99, 95, 115, 105, 122, 101, 111, 102,
+32, 42, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 41, 59, 10,
+32, 32, 32, 32, 125, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32,
+118, 111, 105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 108,
+101, 97, 114, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102,
+41, 32, 123, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+119, 105, 112, 101, 95, 41, 40, 115, 101, 108, 102, 41, 59, 10, 32,
+32, 32, 32, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 61,
+32, 48, 59, 10, 32, 32, 32, 32, 99, 95, 109, 101, 109, 115, 101, 116,
+40, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 44, 32, 48, 44, 32,
+99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 116, 114, 117, 99, 116,
+32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 41, 42, 115, 101, 108,
+102, 45, 62, 98, 117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116,
+41, 59, 10, 125, 10, 10, 35, 105, 102, 100, 101, 102, 32, 95, 105, 95,
+105, 115, 95, 109, 97, 112, 10, 32, 32, 32, 32, 83, 84, 67, 95, 68,
+69, 70, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 10, 32, 32, 32,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116,
+95, 111, 114, 95, 97, 115, 115, 105, 103, 110, 41, 40, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121,
+32, 95, 107, 101, 121, 44, 32, 95, 109, 95, 109, 97, 112, 112, 101,
+100, 32, 95, 109, 97, 112, 112, 101, 100, 41, 32, 123, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32, 95,
+114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105,
+110, 115, 101, 114, 116, 95, 101, 110, 116, 114, 121, 95, 41, 40, 115,
+101, 108, 102, 44, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119,
+40, 40, 38, 95, 107, 101, 121, 41, 41, 41, 59, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 109, 95, 109, 97, 112, 112, 101, 100, 42, 32, 95, 109,
+112, 32, 61, 32, 95, 114, 101, 115, 46, 114, 101, 102, 32, 63, 32, 38,
+95, 114, 101, 115, 46, 114, 101, 102, 45, 62, 115, 101, 99, 111, 110,
+100, 32, 58, 32, 38, 95, 109, 97, 112, 112, 101, 100, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 95, 114, 101, 115, 46, 105,
+110, 115, 101, 114, 116, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 114, 101, 115, 46, 114, 101, 102, 45, 62, 102,
+105, 114, 115, 116, 32, 61, 32, 95, 107, 101, 121, 59, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 123, 32, 105, 95, 107, 101, 121, 100, 114,
+111, 112, 40, 40, 38, 95, 107, 101, 121, 41, 41, 59, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 40, 95, 109, 112, 41, 59, 32, 125, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 42, 95, 109, 112, 32, 61, 32, 95, 109,
+97, 112, 112, 101, 100, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 114, 101, 115, 59, 10, 32, 32, 32,
+32, 125, 10, 10, 32, 32, 32, 32, 35, 105, 102, 32, 33, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97,
+99, 101, 10, 32, 32, 32, 32, 83, 84, 67, 95, 68, 69, 70, 32, 95, 109,
+95, 114, 101, 115, 117, 108, 116, 10, 32, 32, 32, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 101, 109, 112, 108, 97, 99, 101, 95, 111, 114, 95,
+97, 115, 115, 105, 103, 110, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32,
+114, 107, 101, 121, 44, 32, 95, 109, 95, 114, 109, 97, 112, 112, 101,
+100, 32, 114, 109, 97, 112, 112, 101, 100, 41, 32, 123, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 32,
+95, 114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+105, 110, 115, 101, 114, 116, 95, 101, 110, 116, 114, 121, 95, 41, 40,
+115, 101, 108, 102, 44, 32, 114, 107, 101, 121, 41, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 95, 114, 101, 115, 46, 105,
+110, 115, 101, 114, 116, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 95, 114, 101, 115, 46, 114, 101, 102, 45, 62, 102,
+105, 114, 115, 116, 32, 61, 32, 105, 95, 107, 101, 121, 102, 114, 111,
+109, 40, 114, 107, 101, 121, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 105, 102, 32, 40, 95, 114, 101, 115, 46, 114, 101,
+102, 32, 61, 61, 32, 78, 85, 76, 76, 41, 32, 114, 101, 116, 117, 114,
+110, 32, 95, 114, 101, 115, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 40, 40, 38,
+95, 114, 101, 115, 46, 114, 101, 102, 45, 62, 115, 101, 99, 111, 110,
+100, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 114, 101, 115, 46, 114, 101, 102, 45, 62,
+115, 101, 99, 111, 110, 100, 32, 61, 32, 105, 95, 118, 97, 108, 102,
+114, 111, 109, 40, 114, 109, 97, 112, 112, 101, 100, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 95, 114,
+101, 115, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 35, 101,
+110, 100, 105, 102, 32, 47, 47, 32, 33, 105, 95, 110, 111, 95, 101,
+109, 112, 108, 97, 99, 101, 10, 35, 101, 110, 100, 105, 102, 32, 47,
+47, 32, 95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 10, 115, 116, 97,
+116, 105, 99, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 10, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116, 95, 108,
+111, 111, 107, 117, 112, 95, 41, 40, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115,
+116, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 42, 32, 114, 107,
+101, 121, 112, 116, 114, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+110, 115, 116, 32, 115, 105, 122, 101, 95, 116, 32, 95, 104, 97, 115,
+104, 32, 61, 32, 105, 95, 104, 97, 115, 104, 40, 114, 107, 101, 121,
+112, 116, 114, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+115, 105, 122, 101, 95, 116, 32, 95, 105, 100, 120, 109, 97, 115, 107,
+32, 61, 32, 40, 115, 105, 122, 101, 95, 116, 41, 115, 101, 108, 102,
+45, 62, 98, 117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 32,
+45, 32, 49, 59, 10, 32, 32, 32, 32, 95, 109, 95, 114, 101, 115, 117,
+108, 116, 32, 95, 114, 101, 115, 32, 61, 32, 123, 46, 105, 100, 120,
+61, 95, 104, 97, 115, 104, 32, 38, 32, 95, 105, 100, 120, 109, 97,
+115, 107, 44, 32, 46, 104, 97, 115, 104, 120, 61, 40, 117, 105, 110,
+116, 56, 95, 116, 41, 40, 40, 95, 104, 97, 115, 104, 32, 62, 62, 32,
+50, 52, 41, 32, 38, 32, 95, 104, 97, 115, 104, 109, 97, 115, 107, 41,
+44, 32, 46, 100, 105, 115, 116, 61, 49, 125, 59, 10, 10, 32, 32, 32,
+32, 119, 104, 105, 108, 101, 32, 40, 95, 114, 101, 115, 46, 100, 105,
+115, 116, 32, 60, 61, 32, 115, 101, 108, 102, 45, 62, 109, 101, 116,
+97, 91, 95, 114, 101, 115, 46, 105, 100, 120, 93, 46, 100, 105, 115,
+116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32,
+40, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 91, 95, 114, 101,
+115, 46, 105, 100, 120, 93, 46, 104, 97, 115, 104, 120, 32, 61, 61,
+32, 95, 114, 101, 115, 46, 104, 97, 115, 104, 120, 41, 32, 123, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+116, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 32, 95, 114, 97,
+119, 32, 61, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40,
+95, 105, 95, 107, 101, 121, 114, 101, 102, 40, 38, 115, 101, 108, 102,
+45, 62, 116, 97, 98, 108, 101, 91, 95, 114, 101, 115, 46, 105, 100,
+120, 93, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 105, 102, 32, 40, 105, 95, 101, 113, 40, 40, 38, 95, 114, 97, 119,
+41, 44, 32, 114, 107, 101, 121, 112, 116, 114, 41, 41, 32, 123, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95,
+114, 101, 115, 46, 114, 101, 102, 32, 61, 32, 38, 115, 101, 108, 102,
+45, 62, 116, 97, 98, 108, 101, 91, 95, 114, 101, 115, 46, 105, 100,
+120, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 95, 114, 101, 115, 46, 105, 100, 120,
+32, 61, 32, 40, 95, 114, 101, 115, 46, 105, 100, 120, 32, 43, 32, 49,
+41, 32, 38, 32, 95, 105, 100, 120, 109, 97, 115, 107, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 43, 43, 95, 114, 101, 115, 46, 100, 105, 115,
+116, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 95, 114, 101, 115, 59, 10, 125, 10, 10, 115, 116,
+97, 116, 105, 99, 32, 95, 109, 95, 114, 101, 115, 117, 108, 116, 10,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116, 95,
+105, 110, 115, 101, 114, 116, 95, 41, 40, 99, 111, 110, 115, 116, 32,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 107, 101, 121, 114, 97, 119, 42, 32, 114,
+107, 101, 121, 112, 116, 114, 41, 32, 123, 10, 32, 32, 32, 32, 95,
+109, 95, 114, 101, 115, 117, 108, 116, 32, 114, 101, 115, 32, 61, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116, 95,
+108, 111, 111, 107, 117, 112, 95, 41, 40, 115, 101, 108, 102, 44, 32,
+114, 107, 101, 121, 112, 116, 114, 41, 59, 10, 32, 32, 32, 32, 105,
+102, 32, 40, 114, 101, 115, 46, 114, 101, 102, 41, 32, 47, 47, 32, 98,
+117, 99, 107, 101, 116, 32, 101, 120, 105, 115, 116, 115, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101,
+115, 59, 10, 32, 32, 32, 32, 114, 101, 115, 46, 114, 101, 102, 32, 61,
+32, 38, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 91, 114,
+101, 115, 46, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 114, 101,
+115, 46, 105, 110, 115, 101, 114, 116, 101, 100, 32, 61, 32, 49, 59,
+10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97,
+112, 95, 109, 101, 116, 97, 32, 109, 110, 101, 119, 32, 61, 32, 123,
+46, 104, 97, 115, 104, 120, 61, 40, 117, 105, 110, 116, 49, 54, 95,
+116, 41, 40, 114, 101, 115, 46, 104, 97, 115, 104, 120, 32, 38, 32,
+95, 104, 97, 115, 104, 109, 97, 115, 107, 41, 44, 10, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 46, 100, 105, 115, 116, 61, 40, 117,
+105, 110, 116, 49, 54, 95, 116, 41, 40, 114, 101, 115, 46, 100, 105,
+115, 116, 32, 38, 32, 95, 100, 105, 115, 116, 109, 97, 115, 107, 41,
+125, 59, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116, 32, 104,
+109, 97, 112, 95, 109, 101, 116, 97, 32, 109, 99, 117, 114, 32, 61,
+32, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 91, 114, 101, 115,
+46, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 45,
+62, 109, 101, 116, 97, 91, 114, 101, 115, 46, 105, 100, 120, 93, 32,
+61, 32, 109, 110, 101, 119, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32,
+40, 109, 99, 117, 114, 46, 100, 105, 115, 116, 32, 33, 61, 32, 48, 41,
+32, 123, 32, 47, 47, 32, 99, 111, 108, 108, 105, 115, 105, 111, 110,
+44, 32, 114, 101, 111, 114, 100, 101, 114, 32, 98, 117, 99, 107, 101,
+116, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 105, 122, 101, 95,
+116, 32, 109, 97, 115, 107, 32, 61, 32, 40, 115, 105, 122, 101, 95,
+116, 41, 115, 101, 108, 102, 45, 62, 98, 117, 99, 107, 101, 116, 95,
+99, 111, 117, 110, 116, 32, 45, 32, 49, 59, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 100, 99, 117,
+114, 32, 61, 32, 42, 114, 101, 115, 46, 114, 101, 102, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 115, 46,
+105, 100, 120, 32, 61, 32, 40, 114, 101, 115, 46, 105, 100, 120, 32,
+43, 32, 49, 41, 32, 38, 32, 109, 97, 115, 107, 59, 10, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 43, 43, 109, 99, 117, 114, 46, 100,
+105, 115, 116, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+105, 102, 32, 40, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 91,
+114, 101, 115, 46, 105, 100, 120, 93, 46, 100, 105, 115, 116, 32, 61,
+61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62,
+109, 101, 116, 97, 91, 114, 101, 115, 46, 105, 100, 120, 93, 46, 100,
+105, 115, 116, 32, 60, 32, 109, 99, 117, 114, 46, 100, 105, 115, 116,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 99, 95, 115, 119, 97, 112, 40, 38, 109, 99, 117, 114, 44,
+32, 38, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97, 91, 114, 101,
+115, 46, 105, 100, 120, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 95, 115, 119, 97, 112, 40, 38,
+100, 99, 117, 114, 44, 32, 38, 115, 101, 108, 102, 45, 62, 116, 97,
+98, 108, 101, 91, 114, 101, 115, 46, 105, 100, 120, 93, 41, 59, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101,
+108, 102, 45, 62, 109, 101, 116, 97, 91, 114, 101, 115, 46, 105, 100,
+120, 93, 32, 61, 32, 109, 99, 117, 114, 59, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 115, 101, 108, 102, 45, 62, 116, 97, 98, 108, 101, 91,
+114, 101, 115, 46, 105, 100, 120, 93, 32, 61, 32, 100, 99, 117, 114,
+59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+114, 110, 32, 114, 101, 115, 59, 10, 125, 10, 10, 10, 35, 105, 102,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95,
+99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 83, 84, 67, 95, 68, 69,
+70, 32, 83, 101, 108, 102, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 99, 108, 111, 110, 101, 41, 40, 83, 101, 108, 102, 32,
+109, 97, 112, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105,
+102, 32, 40, 109, 97, 112, 46, 98, 117, 99, 107, 101, 116, 95, 99,
+111, 117, 110, 116, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 95,
+108, 105, 116, 101, 114, 97, 108, 40, 83, 101, 108, 102, 41, 123, 48,
+125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 101, 108, 102, 32,
+111, 117, 116, 32, 61, 32, 109, 97, 112, 44, 32, 42, 115, 101, 108,
+102, 32, 61, 32, 38, 111, 117, 116, 59, 32, 47, 47, 32, 95, 105, 95,
+109, 97, 108, 108, 111, 99, 32, 109, 97, 121, 32, 114, 101, 102, 101,
+114, 32, 115, 101, 108, 102, 32, 118, 105, 97, 32, 105, 95, 97, 117,
+120, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+105, 115, 105, 122, 101, 32, 95, 109, 98, 121, 116, 101, 115, 32, 61,
+32, 40, 109, 97, 112, 46, 98, 117, 99, 107, 101, 116, 95, 99, 111,
+117, 110, 116, 32, 43, 32, 49, 41, 42, 99, 95, 115, 105, 122, 101,
+111, 102, 32, 42, 109, 97, 112, 46, 109, 101, 116, 97, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 111, 117, 116, 46, 116, 97, 98, 108, 101, 32,
+61, 32, 40, 95, 109, 95, 118, 97, 108, 117, 101, 32, 42, 41, 105, 95,
+109, 97, 108, 108, 111, 99, 40, 109, 97, 112, 46, 98, 117, 99, 107,
+101, 116, 95, 99, 111, 117, 110, 116, 42, 99, 95, 115, 105, 122, 101,
+111, 102, 32, 42, 111, 117, 116, 46, 116, 97, 98, 108, 101, 41, 59,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 111, 117, 116, 46, 109, 101, 116,
+97, 32, 61, 32, 40, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97,
+112, 95, 109, 101, 116, 97, 32, 42, 41, 105, 95, 109, 97, 108, 108,
+111, 99, 40, 95, 109, 98, 121, 116, 101, 115, 41, 59, 10, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 111, 117, 116, 46, 116, 97,
+98, 108, 101, 32, 38, 38, 32, 111, 117, 116, 46, 109, 101, 116, 97,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+95, 109, 101, 109, 99, 112, 121, 40, 111, 117, 116, 46, 109, 101, 116,
+97, 44, 32, 109, 97, 112, 46, 109, 101, 116, 97, 44, 32, 95, 109, 98,
+121, 116, 101, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 105, 115, 105, 122, 101, 32, 105,
+32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 109, 97, 112, 46, 98, 117,
+99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 59, 32, 43, 43, 105,
+41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 105, 102, 32, 40, 109, 97, 112, 46, 109, 101, 116, 97, 91, 105,
+93, 46, 100, 105, 115, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 117, 116, 46,
+116, 97, 98, 108, 101, 91, 105, 93, 32, 61, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 99, 108, 111, 110, 101,
+41, 40, 115, 101, 108, 102, 44, 32, 109, 97, 112, 46, 116, 97, 98,
+108, 101, 91, 105, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 117, 116, 59, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40,
+111, 117, 116, 46, 109, 101, 116, 97, 41, 32, 105, 95, 102, 114, 101,
+101, 40, 111, 117, 116, 46, 109, 101, 116, 97, 44, 32, 95, 109, 98,
+121, 116, 101, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 105, 102, 32, 40, 111, 117, 116, 46, 116, 97, 98, 108,
+101, 41, 32, 105, 95, 102, 114, 101, 101, 40, 111, 117, 116, 46, 116,
+97, 98, 108, 101, 44, 32, 109, 97, 112, 46, 98, 117, 99, 107, 101,
+116, 95, 99, 111, 117, 110, 116, 42, 99, 95, 115, 105, 122, 101, 111,
+102, 32, 42, 111, 117, 116, 46, 116, 97, 98, 108, 101, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114,
+110, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 83, 101, 108,
+102, 41, 123, 48, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+10, 32, 32, 32, 32, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 83,
+84, 67, 95, 68, 69, 70, 32, 95, 66, 111, 111, 108, 10, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40, 83,
+101, 108, 102, 42, 32, 95, 115, 101, 108, 102, 44, 32, 99, 111, 110,
+115, 116, 32, 105, 115, 105, 122, 101, 32, 95, 110, 101, 119, 99, 97,
+112, 41, 32, 123, 10, 32, 32, 32, 32, 105, 115, 105, 122, 101, 32, 95,
+110, 101, 119, 98, 117, 99, 107, 115, 32, 61, 32, 40, 105, 115, 105,
+122, 101, 41, 40, 40, 102, 108, 111, 97, 116, 41, 95, 110, 101, 119,
+99, 97, 112, 32, 47, 32, 40, 105, 95, 109, 97, 120, 95, 108, 111, 97,
+100, 95, 102, 97, 99, 116, 111, 114, 41, 41, 32, 43, 32, 52, 59, 10,
+32, 32, 32, 32, 95, 110, 101, 119, 98, 117, 99, 107, 115, 32, 61, 32,
+99, 95, 110, 101, 120, 116, 95, 112, 111, 119, 50, 40, 95, 110, 101,
+119, 98, 117, 99, 107, 115, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102,
+32, 40, 95, 110, 101, 119, 99, 97, 112, 32, 60, 32, 95, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 32, 124, 124, 32, 95, 110, 101, 119,
+98, 117, 99, 107, 115, 32, 61, 61, 32, 95, 115, 101, 108, 102, 45, 62,
+98, 117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 41, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 49, 59,
+10, 32, 32, 32, 32, 83, 101, 108, 102, 32, 109, 97, 112, 32, 61, 32,
+42, 95, 115, 101, 108, 102, 44, 32, 42, 115, 101, 108, 102, 32, 61,
+32, 38, 109, 97, 112, 59, 32, 40, 118, 111, 105, 100, 41, 115, 101,
+108, 102, 59, 10, 32, 32, 32, 32, 109, 97, 112, 46, 116, 97, 98, 108,
+101, 32, 61, 32, 95, 105, 95, 109, 97, 108, 108, 111, 99, 40, 95, 109,
+95, 118, 97, 108, 117, 101, 44, 32, 95, 110, 101, 119, 98, 117, 99,
+107, 115, 41, 59, 10, 32, 32, 32, 32, 109, 97, 112, 46, 109, 101, 116,
+97, 32, 61, 32, 95, 105, 95, 99, 97, 108, 108, 111, 99, 40, 115, 116,
+114, 117, 99, 116, 32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 44,
+32, 95, 110, 101, 119, 98, 117, 99, 107, 115, 32, 43, 32, 49, 41, 59,
+10, 32, 32, 32, 32, 109, 97, 112, 46, 98, 117, 99, 107, 101, 116, 95,
+99, 111, 117, 110, 116, 32, 61, 32, 95, 110, 101, 119, 98, 117, 99,
+107, 115, 59, 10, 10, 32, 32, 32, 32, 95, 66, 111, 111, 108, 32, 111,
+107, 32, 61, 32, 109, 97, 112, 46, 116, 97, 98, 108, 101, 32, 38, 38,
+32, 109, 97, 112, 46, 109, 101, 116, 97, 59, 10, 32, 32, 32, 32, 105,
+102, 32, 40, 111, 107, 41, 32, 123, 32, 32, 47, 47, 32, 82, 101, 104,
+97, 115, 104, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 109, 97, 112,
+46, 109, 101, 116, 97, 91, 95, 110, 101, 119, 98, 117, 99, 107, 115,
+93, 46, 100, 105, 115, 116, 32, 61, 32, 95, 100, 105, 115, 116, 109,
+97, 115, 107, 59, 32, 47, 47, 32, 101, 110, 100, 45, 109, 97, 114,
+107, 32, 102, 111, 114, 32, 105, 116, 101, 114, 10, 32, 32, 32, 32,
+32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 32, 100, 32, 61, 32, 95, 115, 101, 108, 102, 45, 62,
+116, 97, 98, 108, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+111, 110, 115, 116, 32, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97,
+112, 95, 109, 101, 116, 97, 42, 32, 109, 32, 61, 32, 95, 115, 101,
+108, 102, 45, 62, 109, 101, 116, 97, 59, 10, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 105, 115, 105, 122, 101, 32, 105,
+32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 95, 115, 101, 108, 102, 45,
+62, 98, 117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 59, 32,
+43, 43, 105, 44, 32, 43, 43, 100, 41, 32, 105, 102, 32, 40, 109, 91,
+105, 93, 46, 100, 105, 115, 116, 32, 33, 61, 32, 48, 41, 32, 123, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 109, 95, 107, 101,
+121, 114, 97, 119, 32, 114, 32, 61, 32, 105, 95, 107, 101, 121, 116,
+111, 114, 97, 119, 40, 95, 105, 95, 107, 101, 121, 114, 101, 102, 40,
+100, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+42, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 117, 99, 107, 101, 116,
+95, 105, 110, 115, 101, 114, 116, 95, 41, 40, 38, 109, 97, 112, 44,
+32, 38, 114, 41, 46, 114, 101, 102, 32, 61, 32, 42, 100, 59, 32, 47,
+47, 32, 109, 111, 118, 101, 32, 101, 108, 101, 109, 101, 110, 116, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 99, 95, 115, 119, 97, 112, 40, 95, 115, 101, 108, 102, 44, 32, 38,
+109, 97, 112, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+105, 95, 102, 114, 101, 101, 40, 109, 97, 112, 46, 109, 101, 116, 97,
+44, 32, 40, 109, 97, 112, 46, 98, 117, 99, 107, 101, 116, 95, 99, 111,
+117, 110, 116, 32, 43, 32, 40, 105, 110, 116, 41, 40, 109, 97, 112,
+46, 109, 101, 116, 97, 32, 33, 61, 32, 78, 85, 76, 76, 41, 41, 42, 99,
+95, 115, 105, 122, 101, 111, 102, 32, 42, 109, 97, 112, 46, 109, 101,
+116, 97, 41, 59, 10, 32, 32, 32, 32, 105, 95, 102, 114, 101, 101, 40,
+109, 97, 112, 46, 116, 97, 98, 108, 101, 44, 32, 109, 97, 112, 46, 98,
+117, 99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 42, 99, 95, 115,
+105, 122, 101, 111, 102, 32, 42, 109, 97, 112, 46, 116, 97, 98, 108,
+101, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+111, 107, 59, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 118,
+111, 105, 100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 114, 97,
+115, 101, 95, 101, 110, 116, 114, 121, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117, 101,
+42, 32, 95, 118, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 95, 109,
+95, 118, 97, 108, 117, 101, 42, 32, 100, 32, 61, 32, 115, 101, 108,
+102, 45, 62, 116, 97, 98, 108, 101, 59, 10, 32, 32, 32, 32, 115, 116,
+114, 117, 99, 116, 32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 32,
+42, 109, 32, 61, 32, 115, 101, 108, 102, 45, 62, 109, 101, 116, 97,
+59, 10, 32, 32, 32, 32, 115, 105, 122, 101, 95, 116, 32, 105, 32, 61,
+32, 40, 115, 105, 122, 101, 95, 116, 41, 40, 95, 118, 97, 108, 32, 45,
+32, 100, 41, 44, 32, 106, 32, 61, 32, 105, 59, 10, 32, 32, 32, 32,
+115, 105, 122, 101, 95, 116, 32, 109, 97, 115, 107, 32, 61, 32, 40,
+115, 105, 122, 101, 95, 116, 41, 115, 101, 108, 102, 45, 62, 98, 117,
+99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 32, 45, 32, 49, 59, 10,
+10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108,
+117, 101, 95, 100, 114, 111, 112, 41, 40, 115, 101, 108, 102, 44, 32,
+95, 118, 97, 108, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40,
+59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 106, 32, 61,
+32, 40, 106, 32, 43, 32, 49, 41, 32, 38, 32, 109, 97, 115, 107, 59,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 109, 91, 106,
+93, 46, 100, 105, 115, 116, 32, 60, 32, 50, 41, 32, 47, 47, 32, 48,
+32, 61, 62, 32, 101, 109, 112, 116, 121, 44, 32, 49, 32, 61, 62, 32,
+80, 83, 76, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+100, 91, 105, 93, 32, 61, 32, 100, 91, 106, 93, 59, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 109, 91, 105, 93, 32, 61, 32, 109, 91, 106, 93,
+59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 45, 45, 109, 91, 105, 93, 46,
+100, 105, 115, 116, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 32,
+61, 32, 106, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 109, 91,
+105, 93, 46, 100, 105, 115, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32,
+32, 45, 45, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 59, 10,
+125, 10, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 105, 95,
+105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 109, 97, 120, 95, 108, 111, 97, 100, 95, 102,
+97, 99, 116, 111, 114, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105,
+95, 105, 115, 95, 115, 101, 116, 10, 35, 117, 110, 100, 101, 102, 32,
+95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 35, 117, 110, 100, 101,
+102, 32, 95, 105, 95, 105, 115, 95, 104, 97, 115, 104, 10, 35, 117,
+110, 100, 101, 102, 32, 95, 105, 95, 107, 101, 121, 114, 101, 102, 10,
+35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 77, 65, 80, 95, 79, 78,
+76, 89, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 83, 69, 84,
+95, 79, 78, 76, 89, 10, 47, 47, 32, 35, 35, 35, 32, 66, 69, 71, 73,
+78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 108,
+105, 110, 107, 97, 103, 101, 50, 46, 104, 10, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114, 10,
+35, 117, 110, 100, 101, 102, 32, 105, 95, 109, 97, 108, 108, 111, 99,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 99, 97, 108, 108, 111,
+99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 114, 101, 97, 108,
+108, 111, 99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 102, 114,
+101, 101, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 97, 117, 120,
+10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 97, 117, 120, 95,
+100, 101, 102, 10, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 115,
+116, 97, 116, 105, 99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95,
+104, 101, 97, 100, 101, 114, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 105, 109, 112, 111, 114, 116, 10, 10, 35,
+105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 99, 108,
+97, 110, 103, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115, 10,
+32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 111, 112, 10,
+35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95,
+95, 71, 78, 85, 67, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115,
+10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100,
+105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 111, 112, 10, 35,
+101, 110, 100, 105, 102, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68,
+95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 108, 105,
+110, 107, 97, 103, 101, 50, 46, 104, 10, 47, 47, 32, 35, 35, 35, 32,
+66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68,
+69, 58, 32, 116, 101, 109, 112, 108, 97, 116, 101, 50, 46, 104, 10,
+47, 47, 32, 73, 87, 89, 85, 32, 112, 114, 97, 103, 109, 97, 58, 32,
+112, 114, 105, 118, 97, 116, 101, 10, 35, 117, 110, 100, 101, 102, 32,
+84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 97,
+108, 105, 97, 115, 32, 102, 111, 114, 32, 105, 95, 116, 121, 112, 101,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 116, 121, 112, 101, 10,
+35, 117, 110, 100, 101, 102, 32, 105, 95, 99, 108, 97, 115, 115, 10,
+35, 117, 110, 100, 101, 102, 32, 105, 95, 116, 97, 103, 10, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 111, 112, 116, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 99, 97, 112, 97, 99, 105, 116, 121, 10, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 107, 101, 121, 112, 114, 111, 32, 32, 32,
+32, 32, 47, 47, 32, 82, 101, 112, 108, 97, 99, 101, 115, 32, 110, 101,
+120, 116, 32, 116, 119, 111, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 107, 101, 121, 95, 115, 116, 114, 32, 32, 32, 32, 47, 47, 32, 91,
+100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 107, 101, 121, 95, 97, 114, 99, 98, 111,
+120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121,
+99, 108, 97, 115, 115, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95,
+99, 109, 112, 99, 108, 97, 115, 115, 32, 32, 32, 47, 47, 32, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 114, 97, 119, 44, 32,
+97, 110, 100, 32, 98, 105, 110, 100, 32, 105, 95, 99, 109, 112, 44,
+32, 105, 95, 101, 113, 44, 32, 105, 95, 104, 97, 115, 104, 32, 34, 99,
+108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114, 115, 34, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 114, 97, 119, 99, 108, 97, 115,
+115, 32, 32, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116,
+101, 100, 93, 32, 102, 111, 114, 32, 105, 95, 99, 109, 112, 99, 108,
+97, 115, 115, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 107, 101,
+121, 99, 108, 111, 110, 101, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 107, 101, 121, 100, 114, 111, 112, 10, 35, 117, 110, 100, 101,
+102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 10, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97,
+119, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 99, 109, 112, 10,
+35, 117, 110, 100, 101, 102, 32, 105, 95, 108, 101, 115, 115, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 101, 113, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 104, 97, 115, 104, 10, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 118, 97, 108, 10, 35, 117, 110, 100, 101, 102,
+32, 105, 95, 118, 97, 108, 112, 114, 111, 32, 32, 32, 32, 32, 47, 47,
+32, 82, 101, 112, 108, 97, 99, 101, 115, 32, 110, 101, 120, 116, 32,
+116, 119, 111, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 118, 97,
+108, 95, 115, 116, 114, 32, 32, 32, 32, 47, 47, 32, 91, 100, 101, 112,
+114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 117, 110, 100, 101, 102,
+32, 105, 95, 118, 97, 108, 95, 97, 114, 99, 98, 111, 120, 32, 47, 47,
+32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 99, 108, 97, 115,
+115, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 99,
+108, 111, 110, 101, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 118, 97, 108, 114, 97, 119, 10, 35, 117, 110, 100, 101, 102, 32,
+105, 95, 118, 97, 108, 102, 114, 111, 109, 10, 35, 117, 110, 100, 101,
+102, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97, 119, 10, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 117, 115, 101, 95, 101,
+113, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 110, 111, 95, 104,
+97, 115, 104, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 110, 111,
+95, 99, 108, 111, 110, 101, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 110, 111, 95, 101, 109, 112, 108, 97, 99, 101, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 100, 101, 99, 108, 97, 114, 101, 100, 10,
+10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 104, 97, 115, 95,
+99, 109, 112, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 104,
+97, 115, 95, 101, 113, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105,
+95, 112, 114, 101, 102, 105, 120, 10, 35, 117, 110, 100, 101, 102, 32,
+95, 105, 95, 116, 101, 109, 112, 108, 97, 116, 101, 10, 35, 117, 110,
+100, 101, 102, 32, 83, 101, 108, 102, 10, 47, 47, 32, 35, 35, 35, 32,
+69, 78, 68, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58,
+32, 116, 101, 109, 112, 108, 97, 116, 101, 50, 46, 104, 10, 47, 47,
+32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73, 78, 67,
+76, 85, 68, 69, 58, 32, 104, 109, 97, 112, 46, 104, 10, 10, 0, 35,
+105, 102, 110, 100, 101, 102, 32, 95, 95, 83, 84, 68, 78, 79, 82, 69,
+84, 85, 82, 78, 95, 72, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+95, 83, 84, 68, 78, 79, 82, 69, 84, 85, 82, 78, 95, 72, 10, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 110, 111, 114, 101, 116, 117, 114,
+110, 32, 95, 78, 111, 114, 101, 116, 117, 114, 110, 10, 10, 35, 101,
+110, 100, 105, 102, 10, 0, 35, 105, 102, 110, 100, 101, 102, 32, 95,
+95, 83, 84, 68, 65, 76, 73, 71, 78, 95, 72, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 95, 83, 84, 68, 65, 76, 73, 71, 78, 95, 72, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 97, 108, 105, 103, 110, 97,
+115, 32, 95, 65, 108, 105, 103, 110, 97, 115, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 97, 108, 105, 103, 110, 111, 102, 32, 95, 65, 108,
+105, 103, 110, 111, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+95, 97, 108, 105, 103, 110, 97, 115, 95, 105, 115, 95, 100, 101, 102,
+105, 110, 101, 100, 32, 49, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 95, 97, 108, 105, 103, 110, 111, 102, 95, 105, 115, 95, 100, 101,
+102, 105, 110, 101, 100, 32, 49, 10, 10, 35, 101, 110, 100, 105, 102,
+10, 0, 47, 47, 32, 66, 69, 71, 73, 78, 32, 114, 101, 103, 101, 110,
+95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100,
+101, 114, 115, 46, 112, 121, 10, 35, 105, 102, 110, 100, 101, 102, 32,
+95, 95, 100, 121, 105, 98, 105, 99, 99, 95, 105, 110, 116, 101, 114,
+110, 97, 108, 95, 105, 110, 99, 108, 117, 100, 101, 95, 95, 10, 35,
+101, 114, 114, 111, 114, 32, 67, 97, 110, 32, 111, 110, 108, 121, 32,
+98, 101, 32, 105, 110, 99, 108, 117, 100, 101, 100, 32, 98, 121, 32,
+116, 104, 101, 32, 99, 111, 109, 112, 105, 108, 101, 114, 44, 32, 111,
+114, 32, 99, 111, 110, 102, 117, 115, 105, 110, 103, 32, 101, 114,
+114, 111, 114, 115, 32, 119, 105, 108, 108, 32, 114, 101, 115, 117,
+108, 116, 33, 10, 35, 101, 110, 100, 105, 102, 10, 35, 117, 110, 100,
+101, 102, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95,
+95, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115, 105,
+103, 110, 101, 100, 32, 99, 104, 97, 114, 32, 117, 105, 110, 116, 56,
+95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115,
+105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 108, 111, 110,
+103, 32, 117, 105, 110, 116, 54, 52, 95, 116, 59, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32,
+108, 111, 110, 103, 32, 108, 111, 110, 103, 32, 115, 105, 122, 101,
+95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 108, 111, 110,
+103, 32, 108, 111, 110, 103, 32, 105, 110, 116, 54, 52, 95, 116, 59,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 105, 103, 110, 101,
+100, 32, 99, 104, 97, 114, 32, 105, 110, 116, 56, 95, 116, 59, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 115, 105, 103, 110, 101, 100,
+32, 115, 104, 111, 114, 116, 32, 105, 110, 116, 49, 54, 95, 116, 59,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115, 105, 103,
+110, 101, 100, 32, 115, 104, 111, 114, 116, 32, 117, 105, 110, 116,
+49, 54, 95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115,
+105, 103, 110, 101, 100, 32, 105, 110, 116, 32, 105, 110, 116, 51, 50,
+95, 116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 108, 111, 110,
+103, 32, 108, 111, 110, 103, 32, 105, 110, 116, 112, 116, 114, 95,
+116, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 115,
+105, 103, 110, 101, 100, 32, 108, 111, 110, 103, 32, 108, 111, 110,
+103, 32, 117, 105, 110, 116, 112, 116, 114, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 108, 111, 110, 103, 32, 108, 111, 110,
+103, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 110, 115, 105, 103, 110, 101, 100,
+32, 105, 110, 116, 32, 117, 105, 110, 116, 51, 50, 95, 116, 59, 10,
+118, 111, 105, 100, 42, 32, 109, 101, 109, 115, 101, 116, 40, 118,
+111, 105, 100, 42, 32, 100, 101, 115, 116, 44, 32, 105, 110, 116, 32,
+99, 104, 44, 32, 115, 105, 122, 101, 95, 116, 32, 99, 111, 117, 110,
+116, 41, 59, 10, 118, 111, 105, 100, 42, 32, 109, 101, 109, 99, 112,
+121, 40, 118, 111, 105, 100, 42, 32, 100, 101, 115, 116, 44, 32, 99,
+111, 110, 115, 116, 32, 118, 111, 105, 100, 42, 32, 115, 114, 99, 44,
+32, 115, 105, 122, 101, 95, 116, 32, 99, 111, 117, 110, 116, 41, 59,
+10, 105, 110, 116, 32, 109, 101, 109, 99, 109, 112, 40, 99, 111, 110,
+115, 116, 32, 118, 111, 105, 100, 42, 32, 108, 104, 115, 44, 32, 99,
+111, 110, 115, 116, 32, 118, 111, 105, 100, 42, 32, 114, 104, 115, 44,
+32, 115, 105, 122, 101, 95, 116, 32, 99, 111, 117, 110, 116, 41, 59,
+10, 118, 111, 105, 100, 42, 32, 109, 101, 109, 109, 111, 118, 101, 40,
+118, 111, 105, 100, 42, 32, 100, 101, 115, 116, 44, 32, 99, 111, 110,
+115, 116, 32, 118, 111, 105, 100, 42, 32, 115, 114, 99, 44, 32, 115,
+105, 122, 101, 95, 116, 32, 99, 111, 117, 110, 116, 41, 59, 10, 115,
+105, 122, 101, 95, 116, 32, 115, 116, 114, 108, 101, 110, 40, 99, 111,
+110, 115, 116, 32, 99, 104, 97, 114, 42, 32, 115, 116, 114, 41, 59,
+10, 118, 111, 105, 100, 32, 102, 114, 101, 101, 40, 118, 111, 105,
+100, 42, 32, 112, 116, 114, 41, 59, 10, 118, 111, 105, 100, 32, 42,
+109, 97, 108, 108, 111, 99, 40, 115, 105, 122, 101, 95, 116, 32, 115,
+105, 122, 101, 41, 59, 10, 118, 111, 105, 100, 32, 42, 99, 97, 108,
+108, 111, 99, 40, 115, 105, 122, 101, 95, 116, 32, 110, 117, 109, 44,
+32, 115, 105, 122, 101, 95, 116, 32, 115, 105, 122, 101, 41, 59, 10,
+118, 111, 105, 100, 42, 32, 114, 101, 97, 108, 108, 111, 99, 40, 118,
+111, 105, 100, 42, 32, 112, 116, 114, 44, 32, 115, 105, 122, 101, 95,
+116, 32, 110, 101, 119, 95, 115, 105, 122, 101, 41, 59, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 78, 85, 76, 76, 32, 40, 40, 118, 111,
+105, 100, 42, 41, 48, 41, 32, 47, 42, 32, 116, 111, 100, 111, 33, 32,
+42, 47, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 10, 47, 47, 32, 35, 35, 35, 32,
+66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68,
+69, 58, 32, 118, 101, 99, 46, 104, 10, 10, 47, 47, 32, 35, 35, 35, 32,
+66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68,
+69, 58, 32, 108, 105, 110, 107, 97, 103, 101, 46, 104, 10, 35, 117,
+110, 100, 101, 102, 32, 83, 84, 67, 95, 65, 80, 73, 10, 35, 117, 110,
+100, 101, 102, 32, 83, 84, 67, 95, 68, 69, 70, 10, 10, 35, 105, 102,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 115, 116, 97,
+116, 105, 99, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 83, 84, 67, 95, 83, 84, 65, 84, 73, 67, 32, 32, 38, 38, 32, 40,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 104, 101, 97, 100,
+101, 114, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 83,
+84, 67, 95, 72, 69, 65, 68, 69, 82, 32, 32, 124, 124, 32, 92, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 105, 109, 112, 108, 101, 109,
+101, 110, 116, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 83, 84, 67, 95, 73, 77, 80, 76, 69, 77, 69, 78, 84, 41, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 65, 80, 73,
+32, 101, 120, 116, 101, 114, 110, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 83, 84, 67, 95, 68, 69, 70, 10, 35, 101, 108, 115, 101,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 105, 109,
+112, 108, 101, 109, 101, 110, 116, 10, 32, 32, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 95, 95, 71, 78, 85, 67, 95, 95, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 99, 108,
+97, 110, 103, 95, 95, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 95, 73, 78, 84, 69, 76, 95, 76, 76, 86, 77, 95, 67, 79,
+77, 80, 73, 76, 69, 82, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 83, 84, 67, 95, 65, 80, 73, 32, 115, 116, 97, 116, 105,
+99, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 40,
+40, 117, 110, 117, 115, 101, 100, 41, 41, 10, 32, 32, 35, 101, 108,
+115, 101, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+83, 84, 67, 95, 65, 80, 73, 32, 115, 116, 97, 116, 105, 99, 32, 105,
+110, 108, 105, 110, 101, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 68, 69,
+70, 32, 115, 116, 97, 116, 105, 99, 10, 35, 101, 110, 100, 105, 102,
+10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 83, 84,
+67, 95, 73, 77, 80, 76, 69, 77, 69, 78, 84, 32, 124, 124, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 105, 109, 112, 111, 114,
+116, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 105,
+109, 112, 108, 101, 109, 101, 110, 116, 10, 35, 101, 110, 100, 105,
+102, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 108, 108, 111, 99, 97,
+116, 111, 114, 32, 99, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 105, 95, 102, 114, 101, 101, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 109, 97, 108, 108, 111,
+99, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 97, 108, 108, 111, 99,
+97, 116, 111, 114, 44, 32, 95, 109, 97, 108, 108, 111, 99, 41, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 97, 108, 108,
+111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 97, 108, 108, 111,
+99, 97, 116, 111, 114, 44, 32, 95, 99, 97, 108, 108, 111, 99, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 114, 101, 97,
+108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 97, 108,
+108, 111, 99, 97, 116, 111, 114, 44, 32, 95, 114, 101, 97, 108, 108,
+111, 99, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105,
+95, 102, 114, 101, 101, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 97,
+108, 108, 111, 99, 97, 116, 111, 114, 44, 32, 95, 102, 114, 101, 101,
+41, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 95, 95, 99, 108, 97, 110, 103, 95,
+95, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95,
+99, 112, 108, 117, 115, 112, 108, 117, 115, 10, 32, 32, 35, 112, 114,
+97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97, 103,
+110, 111, 115, 116, 105, 99, 32, 112, 117, 115, 104, 10, 32, 32, 35,
+112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105,
+97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110,
+103, 32, 34, 45, 87, 97, 108, 108, 34, 10, 32, 32, 35, 112, 114, 97,
+103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97, 103, 110,
+111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34,
+45, 87, 101, 120, 116, 114, 97, 34, 10, 32, 32, 35, 112, 114, 97, 103,
+109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97, 103, 110, 111,
+115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45,
+87, 112, 101, 100, 97, 110, 116, 105, 99, 34, 10, 32, 32, 35, 112,
+114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97,
+103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110,
+103, 32, 34, 45, 87, 99, 111, 110, 118, 101, 114, 115, 105, 111, 110,
+34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110,
+103, 32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 119, 97,
+114, 110, 105, 110, 103, 32, 34, 45, 87, 119, 114, 105, 116, 101, 45,
+115, 116, 114, 105, 110, 103, 115, 34, 10, 32, 32, 47, 47, 32, 105,
+103, 110, 111, 114, 101, 100, 10, 32, 32, 35, 112, 114, 97, 103, 109,
+97, 32, 99, 108, 97, 110, 103, 32, 100, 105, 97, 103, 110, 111, 115,
+116, 105, 99, 32, 105, 103, 110, 111, 114, 101, 100, 32, 34, 45, 87,
+109, 105, 115, 115, 105, 110, 103, 45, 102, 105, 101, 108, 100, 45,
+105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 114, 115, 34, 10, 35,
+101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95,
+71, 78, 85, 67, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115, 10,
+32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105,
+97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 117, 115, 104, 10, 32,
+32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97,
+103, 110, 111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110,
+103, 32, 34, 45, 87, 97, 108, 108, 34, 10, 32, 32, 35, 112, 114, 97,
+103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110, 111, 115,
+116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87,
+101, 120, 116, 114, 97, 34, 10, 32, 32, 35, 112, 114, 97, 103, 109,
+97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110, 111, 115, 116, 105,
+99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87, 112, 101,
+100, 97, 110, 116, 105, 99, 34, 10, 32, 32, 35, 112, 114, 97, 103,
+109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110, 111, 115, 116,
+105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34, 45, 87, 99,
+111, 110, 118, 101, 114, 115, 105, 111, 110, 34, 10, 32, 32, 35, 112,
+114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103, 110,
+111, 115, 116, 105, 99, 32, 119, 97, 114, 110, 105, 110, 103, 32, 34,
+45, 87, 119, 114, 105, 116, 101, 45, 115, 116, 114, 105, 110, 103,
+115, 34, 10, 32, 32, 47, 47, 32, 105, 103, 110, 111, 114, 101, 100,
+10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100,
+105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110, 111,
+114, 101, 100, 32, 34, 45, 87, 99, 108, 111, 98, 98, 101, 114, 101,
+100, 34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67,
+32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110,
+111, 114, 101, 100, 32, 34, 45, 87, 105, 109, 112, 108, 105, 99, 105,
+116, 45, 102, 97, 108, 108, 116, 104, 114, 111, 117, 103, 104, 61, 51,
+34, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 105, 103, 110,
+111, 114, 101, 100, 32, 34, 45, 87, 115, 116, 114, 105, 110, 103, 111,
+112, 45, 111, 118, 101, 114, 102, 108, 111, 119, 61, 34, 10, 32, 32,
+35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32, 100, 105, 97, 103,
+110, 111, 115, 116, 105, 99, 32, 105, 103, 110, 111, 114, 101, 100,
+32, 34, 45, 87, 109, 105, 115, 115, 105, 110, 103, 45, 102, 105, 101,
+108, 100, 45, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 114,
+115, 34, 10, 35, 101, 110, 100, 105, 102, 10, 47, 47, 32, 35, 35, 35,
+32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69,
+58, 32, 108, 105, 110, 107, 97, 103, 101, 46, 104, 10, 47, 47, 32, 35,
+35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67,
+76, 85, 68, 69, 58, 32, 116, 121, 112, 101, 115, 46, 104, 10, 10, 35,
+105, 102, 100, 101, 102, 32, 105, 95, 97, 117, 120, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 97, 117, 120, 95, 100,
+101, 102, 32, 105, 95, 97, 117, 120, 32, 97, 117, 120, 59, 10, 35,
+101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 10, 35, 101, 110, 100,
+105, 102, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83, 84, 67,
+95, 84, 89, 80, 69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67, 95, 84, 89, 80,
+69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 10, 47, 47,
+32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117,
+100, 101, 32, 60, 115, 116, 100, 105, 110, 116, 46, 104, 62, 10, 47,
+47, 32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117,
+100, 101, 32, 60, 115, 116, 100, 100, 101, 102, 46, 104, 62, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 114, 99, 40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 97, 114, 99, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95,
+118, 101, 99, 40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 115, 116, 97, 99, 107, 40, 67, 44, 32, 75, 69, 89,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 112, 113, 117, 101, 117, 101, 40, 67, 44, 32, 75, 69,
+89, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115, 116, 97, 99,
+107, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 100, 101, 113, 117, 101,
+40, 67, 44, 32, 75, 69, 89, 41, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 113, 117, 101, 117, 101, 40, 67, 44, 32, 75, 69, 89, 41, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95,
+104, 97, 115, 104, 109, 97, 112, 40, 67, 44, 32, 75, 69, 89, 44, 32,
+86, 65, 76, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 116, 97,
+98, 108, 101, 40, 67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 44, 32,
+99, 95, 116, 114, 117, 101, 44, 32, 99, 95, 102, 97, 108, 115, 101,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 104, 97, 115, 104, 115, 101, 116, 40, 67, 44, 32, 75,
+69, 89, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 116, 97, 98,
+108, 101, 40, 67, 44, 32, 99, 115, 101, 116, 44, 32, 75, 69, 89, 44,
+32, 75, 69, 89, 44, 32, 99, 95, 102, 97, 108, 115, 101, 44, 32, 99,
+95, 116, 114, 117, 101, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 115, 111, 114, 116, 101, 100,
+109, 97, 112, 40, 67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 41, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 97, 97, 116, 114, 101, 101, 40,
+67, 44, 32, 75, 69, 89, 44, 32, 86, 65, 76, 44, 32, 99, 95, 116, 114,
+117, 101, 44, 32, 99, 95, 102, 97, 108, 115, 101, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115,
+111, 114, 116, 101, 100, 115, 101, 116, 40, 67, 44, 32, 75, 69, 89,
+41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 97, 116, 114, 101,
+101, 40, 67, 44, 32, 75, 69, 89, 44, 32, 75, 69, 89, 44, 32, 99, 95,
+102, 97, 108, 115, 101, 44, 32, 99, 95, 116, 114, 117, 101, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114,
+101, 95, 104, 109, 97, 112, 40, 46, 46, 46, 41, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 104, 97, 115, 104, 109, 97, 112, 40, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32, 91, 100, 101, 112,
+114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 115, 101, 116, 40,
+46, 46, 46, 41, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104, 97, 115,
+104, 115, 101, 116, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108,
+97, 114, 101, 95, 115, 109, 97, 112, 40, 46, 46, 46, 41, 32, 100, 101,
+99, 108, 97, 114, 101, 95, 115, 111, 114, 116, 101, 100, 109, 97, 112,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32,
+91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 115,
+115, 101, 116, 40, 46, 46, 46, 41, 32, 100, 101, 99, 108, 97, 114,
+101, 95, 115, 111, 114, 116, 101, 100, 115, 101, 116, 40, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 32, 47, 47, 32, 91, 100, 101, 112,
+114, 101, 99, 97, 116, 101, 100, 93, 10, 10, 47, 47, 32, 99, 115, 118,
+105, 101, 119, 32, 58, 32, 110, 111, 110, 45, 110, 117, 108, 108, 32,
+116, 101, 114, 109, 105, 110, 97, 116, 101, 100, 32, 115, 116, 114,
+105, 110, 103, 32, 118, 105, 101, 119, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 99,
+115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 99, 115,
+118, 105, 101, 119, 32, 123, 10, 32, 32, 32, 32, 99, 115, 118, 105,
+101, 119, 95, 118, 97, 108, 117, 101, 42, 32, 98, 117, 102, 59, 10,
+32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 32, 115,
+105, 122, 101, 59, 10, 125, 32, 99, 115, 118, 105, 101, 119, 59, 10,
+10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110,
+32, 123, 10, 32, 32, 32, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97,
+108, 117, 101, 42, 32, 114, 101, 102, 59, 10, 32, 32, 32, 32, 99, 115,
+118, 105, 101, 119, 32, 99, 104, 114, 59, 10, 32, 32, 32, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 118, 105, 101, 119, 32,
+99, 104, 114, 59, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97, 108,
+117, 101, 42, 32, 101, 110, 100, 59, 32, 125, 32, 117, 56, 59, 10,
+125, 32, 99, 115, 118, 105, 101, 119, 95, 105, 116, 101, 114, 59, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 118, 40, 46,
+46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69, 82, 76,
+79, 65, 68, 40, 99, 95, 115, 118, 44, 32, 95, 95, 86, 65, 95, 65, 82,
+71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+115, 118, 95, 49, 40, 108, 105, 116, 101, 114, 97, 108, 41, 32, 99,
+95, 115, 118, 95, 50, 40, 108, 105, 116, 101, 114, 97, 108, 44, 32,
+99, 95, 108, 105, 116, 115, 116, 114, 108, 101, 110, 40, 108, 105,
+116, 101, 114, 97, 108, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 115, 118, 95, 50, 40, 115, 116, 114, 44, 32, 110, 41, 32,
+40, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 99, 115, 118, 105,
+101, 119, 41, 123, 115, 116, 114, 44, 32, 110, 125, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 115, 118, 102, 109, 116, 32, 34,
+37, 46, 42, 115, 34, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+115, 118, 97, 114, 103, 40, 115, 118, 41, 32, 40, 105, 110, 116, 41,
+40, 115, 118, 41, 46, 115, 105, 122, 101, 44, 32, 40, 115, 118, 41,
+46, 98, 117, 102, 32, 47, 47, 32, 112, 114, 105, 110, 116, 102, 40,
+99, 95, 115, 118, 102, 109, 116, 32, 34, 92, 110, 34, 44, 32, 99, 95,
+115, 118, 97, 114, 103, 40, 115, 118, 41, 41, 59, 10, 10, 47, 47, 32,
+122, 115, 118, 105, 101, 119, 32, 58, 32, 122, 101, 114, 111, 45, 116,
+101, 114, 109, 105, 110, 97, 116, 101, 100, 32, 115, 116, 114, 105,
+110, 103, 32, 118, 105, 101, 119, 10, 116, 121, 112, 101, 100, 101,
+102, 32, 99, 115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 32,
+122, 115, 118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 59, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32,
+122, 115, 118, 105, 101, 119, 32, 123, 10, 32, 32, 32, 32, 122, 115,
+118, 105, 101, 119, 95, 118, 97, 108, 117, 101, 42, 32, 115, 116, 114,
+59, 10, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116,
+32, 115, 105, 122, 101, 59, 10, 125, 32, 122, 115, 118, 105, 101, 119,
+59, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111,
+110, 32, 123, 10, 32, 32, 32, 32, 122, 115, 118, 105, 101, 119, 95,
+118, 97, 108, 117, 101, 42, 32, 114, 101, 102, 59, 10, 32, 32, 32, 32,
+99, 115, 118, 105, 101, 119, 32, 99, 104, 114, 59, 10, 125, 32, 122,
+115, 118, 105, 101, 119, 95, 105, 116, 101, 114, 59, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 122, 118, 40, 108, 105, 116, 101,
+114, 97, 108, 41, 32, 40, 99, 95, 108, 105, 116, 101, 114, 97, 108,
+40, 122, 115, 118, 105, 101, 119, 41, 123, 108, 105, 116, 101, 114,
+97, 108, 44, 32, 99, 95, 108, 105, 116, 115, 116, 114, 108, 101, 110,
+40, 108, 105, 116, 101, 114, 97, 108, 41, 125, 41, 10, 10, 47, 47, 32,
+99, 115, 116, 114, 32, 58, 32, 122, 101, 114, 111, 45, 116, 101, 114,
+109, 105, 110, 97, 116, 101, 100, 32, 111, 119, 110, 105, 110, 103,
+32, 115, 116, 114, 105, 110, 103, 32, 40, 115, 104, 111, 114, 116, 32,
+115, 116, 114, 105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122,
+101, 100, 32, 45, 32, 115, 115, 111, 41, 10, 116, 121, 112, 101, 100,
+101, 102, 32, 99, 104, 97, 114, 32, 99, 115, 116, 114, 95, 118, 97,
+108, 117, 101, 59, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 116, 114, 95, 118, 97,
+108, 117, 101, 42, 32, 100, 97, 116, 97, 59, 32, 105, 110, 116, 112,
+116, 114, 95, 116, 32, 115, 105, 122, 101, 44, 32, 99, 97, 112, 59,
+32, 125, 32, 99, 115, 116, 114, 95, 98, 117, 102, 59, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110, 32, 99, 115,
+116, 114, 32, 123, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 123, 32, 117, 105, 110, 116, 112, 116, 114, 95, 116, 32, 115, 105,
+122, 101, 59, 32, 99, 115, 116, 114, 95, 118, 97, 108, 117, 101, 42,
+32, 100, 97, 116, 97, 59, 32, 117, 105, 110, 116, 112, 116, 114, 95,
+116, 32, 110, 99, 97, 112, 59, 32, 125, 32, 108, 111, 110, 59, 10, 32,
+32, 32, 32, 115, 116, 114, 117, 99, 116, 32, 123, 32, 99, 115, 116,
+114, 95, 118, 97, 108, 117, 101, 32, 100, 97, 116, 97, 91, 32, 115,
+105, 122, 101, 111, 102, 40, 99, 115, 116, 114, 95, 98, 117, 102, 41,
+32, 45, 32, 49, 32, 93, 59, 32, 117, 105, 110, 116, 56, 95, 116, 32,
+115, 105, 122, 101, 59, 32, 125, 32, 115, 109, 108, 59, 10, 125, 32,
+99, 115, 116, 114, 59, 10, 10, 116, 121, 112, 101, 100, 101, 102, 32,
+117, 110, 105, 111, 110, 32, 123, 10, 32, 32, 32, 32, 99, 115, 118,
+105, 101, 119, 32, 99, 104, 114, 59, 32, 47, 47, 32, 117, 116, 102,
+56, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 47, 99, 111, 100,
+101, 112, 111, 105, 110, 116, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+116, 32, 99, 115, 116, 114, 95, 118, 97, 108, 117, 101, 42, 32, 114,
+101, 102, 59, 10, 125, 32, 99, 115, 116, 114, 95, 105, 116, 101, 114,
+59, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 116, 114,
+117, 101, 40, 46, 46, 46, 41, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 97,
+108, 115, 101, 40, 46, 46, 46, 41, 10, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 114, 99, 40,
+83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70,
+35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116,
+32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 32, 83, 69, 76, 70,
+35, 35, 95, 99, 116, 114, 108, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32,
+116, 121, 112, 101, 100, 101, 102, 32, 117, 110, 105, 111, 110, 32,
+83, 69, 76, 70, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 103, 101,
+116, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70,
+35, 35, 95, 99, 116, 114, 108, 42, 32, 99, 116, 114, 108, 49, 59, 32,
+92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97, 114,
+99, 50, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 32, 83,
+69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 59, 32, 92, 10, 92, 10,
+116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116,
+32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 40, 40,
+109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69, 76, 70,
+35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 92, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108,
+117, 101, 42, 32, 103, 101, 116, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 99, 116, 114, 108, 42, 32, 99,
+116, 114, 108, 50, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69,
+76, 70, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99,
+108, 97, 114, 101, 95, 98, 111, 120, 40, 83, 69, 76, 70, 44, 32, 86,
+65, 76, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108,
+117, 101, 59, 32, 92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102,
+32, 115, 116, 114, 117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105,
+98, 117, 116, 101, 95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99,
+97, 108, 108, 40, 83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69,
+76, 70, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69,
+76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 103, 101, 116, 59,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 113,
+117, 101, 117, 101, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41, 32,
+92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65,
+76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32,
+92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40,
+83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 32, 42, 99, 98, 117, 102, 59, 32, 92, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102, 102, 95,
+116, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 44, 32, 99,
+97, 112, 109, 97, 115, 107, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 32, 92, 10, 32,
+32, 32, 32, 125, 32, 83, 69, 76, 70, 59, 32, 92, 10, 92, 10, 32, 32,
+32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99,
+116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76,
+70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114, 100, 105, 102,
+102, 95, 116, 32, 112, 111, 115, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 99, 111, 110, 115, 116, 32, 83, 69, 76, 70, 42, 32, 95,
+115, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 35, 35,
+95, 105, 116, 101, 114, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+100, 101, 99, 108, 97, 114, 101, 95, 108, 105, 115, 116, 40, 83, 69,
+76, 70, 44, 32, 86, 65, 76, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69,
+76, 70, 35, 35, 95, 110, 111, 100, 101, 32, 83, 69, 76, 70, 35, 35,
+95, 110, 111, 100, 101, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32,
+123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59, 32, 92, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111,
+100, 101, 32, 42, 99, 111, 110, 115, 116, 32, 42, 95, 108, 97, 115,
+116, 44, 32, 42, 112, 114, 101, 118, 59, 32, 92, 10, 32, 32, 32, 32,
+125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32, 92,
+10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95,
+95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83,
+69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95,
+110, 111, 100, 101, 32, 42, 108, 97, 115, 116, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 104,
+116, 97, 98, 108, 101, 40, 83, 69, 76, 70, 44, 32, 75, 69, 89, 44, 32,
+86, 65, 76, 44, 32, 77, 65, 80, 95, 79, 78, 76, 89, 44, 32, 83, 69,
+84, 95, 79, 78, 76, 89, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 75, 69, 89, 32, 83, 69, 76, 70, 35, 35, 95,
+107, 101, 121, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 109,
+97, 112, 112, 101, 100, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116,
+121, 112, 101, 100, 101, 102, 32, 83, 69, 84, 95, 79, 78, 76, 89, 40,
+32, 83, 69, 76, 70, 35, 35, 95, 107, 101, 121, 32, 41, 32, 92, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 80, 95, 79, 78,
+76, 89, 40, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 32, 41, 32, 92, 10, 32, 32, 32, 32,
+83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 44, 32, 83, 69,
+76, 70, 35, 35, 95, 101, 110, 116, 114, 121, 59, 32, 92, 10, 92, 10,
+32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102,
+59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 105, 122, 101,
+95, 116, 32, 105, 100, 120, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 66, 111, 111, 108, 32, 105, 110, 115, 101, 114, 116, 101,
+100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 117, 105, 110,
+116, 56, 95, 116, 32, 104, 97, 115, 104, 120, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 117, 105, 110, 116, 49, 54, 95, 116, 32, 100,
+105, 115, 116, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76,
+70, 35, 35, 95, 114, 101, 115, 117, 108, 116, 59, 32, 92, 10, 92, 10,
+32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102,
+44, 32, 42, 95, 101, 110, 100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 115, 116, 114, 117, 99, 116, 32, 104, 109, 97, 112, 95, 109,
+101, 116, 97, 32, 42, 95, 109, 114, 101, 102, 59, 32, 92, 10, 32, 32,
+32, 32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59,
+32, 92, 10, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116,
+114, 117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116,
+101, 95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108,
+40, 83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32,
+123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69, 76, 70, 35,
+35, 95, 118, 97, 108, 117, 101, 42, 32, 116, 97, 98, 108, 101, 59, 32,
+92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 104, 109, 97, 112, 95, 109, 101, 116, 97, 42, 32, 109, 101, 116,
+97, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 116, 114,
+100, 105, 102, 102, 95, 116, 32, 115, 105, 122, 101, 44, 32, 98, 117,
+99, 107, 101, 116, 95, 99, 111, 117, 110, 116, 59, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102,
+32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101, 95, 97,
+97, 116, 114, 101, 101, 40, 83, 69, 76, 70, 44, 32, 75, 69, 89, 44,
+32, 86, 65, 76, 44, 32, 77, 65, 80, 95, 79, 78, 76, 89, 44, 32, 83,
+69, 84, 95, 79, 78, 76, 89, 41, 32, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 75, 69, 89, 32, 83, 69, 76, 70, 35, 35,
+95, 107, 101, 121, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 86, 65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 109,
+97, 112, 112, 101, 100, 59, 32, 92, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76,
+70, 35, 35, 95, 110, 111, 100, 101, 32, 83, 69, 76, 70, 35, 35, 95,
+110, 111, 100, 101, 59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116, 121,
+112, 101, 100, 101, 102, 32, 83, 69, 84, 95, 79, 78, 76, 89, 40, 32,
+83, 69, 76, 70, 35, 35, 95, 107, 101, 121, 32, 41, 32, 92, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 80, 95, 79, 78, 76,
+89, 40, 32, 115, 116, 114, 117, 99, 116, 32, 83, 69, 76, 70, 35, 35,
+95, 118, 97, 108, 117, 101, 32, 41, 32, 92, 10, 32, 32, 32, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 44, 32, 83, 69, 76,
+70, 35, 35, 95, 101, 110, 116, 114, 121, 59, 32, 92, 10, 92, 10, 32,
+32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117,
+99, 116, 32, 123, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 83, 69,
+76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 59,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 66, 111, 111, 108, 32,
+105, 110, 115, 101, 114, 116, 101, 100, 59, 32, 92, 10, 32, 32, 32,
+32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 114, 101, 115, 117, 108, 116,
+59, 32, 92, 10, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 115, 116, 114, 117, 99, 116, 32, 123, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117,
+101, 32, 42, 114, 101, 102, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111, 100, 101, 32, 42, 95,
+100, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 110, 116,
+32, 95, 116, 111, 112, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+105, 110, 116, 51, 50, 95, 116, 32, 95, 116, 110, 44, 32, 95, 115,
+116, 91, 51, 54, 93, 59, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69,
+76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32, 92, 10, 92, 10, 116,
+121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99, 116, 32, 95,
+95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95, 40, 40, 109,
+101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69, 76, 70, 35, 35,
+95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 83, 69, 76, 70, 35, 35, 95, 110, 111, 100, 101,
+32, 42, 110, 111, 100, 101, 115, 59, 32, 92, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 105, 110, 116, 51, 50, 95, 116, 32, 114, 111, 111, 116,
+44, 32, 100, 105, 115, 112, 44, 32, 104, 101, 97, 100, 44, 32, 115,
+105, 122, 101, 44, 32, 99, 97, 112, 97, 99, 105, 116, 121, 59, 32, 92,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 105, 95, 97, 117, 120, 95,
+100, 101, 102, 32, 92, 10, 32, 32, 32, 32, 125, 32, 83, 69, 76, 70,
+10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97,
+114, 101, 95, 115, 116, 97, 99, 107, 95, 102, 105, 120, 101, 100, 40,
+83, 69, 76, 70, 44, 32, 86, 65, 76, 44, 32, 67, 65, 80, 41, 32, 92,
+10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86, 65, 76,
+32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59, 32, 92,
+10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116,
+114, 117, 99, 116, 32, 123, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97,
+108, 117, 101, 32, 42, 114, 101, 102, 44, 32, 42, 101, 110, 100, 59,
+32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114, 59, 32,
+92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114, 117, 99,
+116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95, 95,
+40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40, 83, 69,
+76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123, 32, 83,
+69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 100, 97, 116, 97,
+91, 67, 65, 80, 93, 59, 32, 112, 116, 114, 100, 105, 102, 102, 95,
+116, 32, 115, 105, 122, 101, 59, 32, 125, 32, 83, 69, 76, 70, 10, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 100, 101, 99, 108, 97, 114, 101,
+95, 115, 116, 97, 99, 107, 40, 83, 69, 76, 70, 44, 32, 86, 65, 76, 41,
+32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32, 86,
+65, 76, 32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 59,
+32, 92, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102, 32,
+115, 116, 114, 117, 99, 116, 32, 123, 32, 83, 69, 76, 70, 35, 35, 95,
+118, 97, 108, 117, 101, 32, 42, 114, 101, 102, 44, 32, 42, 101, 110,
+100, 59, 32, 125, 32, 83, 69, 76, 70, 35, 35, 95, 105, 116, 101, 114,
+59, 32, 92, 10, 116, 121, 112, 101, 100, 101, 102, 32, 115, 116, 114,
+117, 99, 116, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+95, 95, 40, 40, 109, 101, 116, 104, 111, 100, 99, 97, 108, 108, 40,
+83, 69, 76, 70, 35, 35, 95, 41, 41, 41, 32, 83, 69, 76, 70, 32, 123,
+32, 83, 69, 76, 70, 35, 35, 95, 118, 97, 108, 117, 101, 32, 42, 100,
+97, 116, 97, 59, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116, 32,
+115, 105, 122, 101, 44, 32, 99, 97, 112, 97, 99, 105, 116, 121, 59,
+32, 95, 105, 95, 97, 117, 120, 95, 100, 101, 102, 32, 125, 32, 83, 69,
+76, 70, 10, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84,
+67, 95, 84, 89, 80, 69, 83, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69,
+68, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69,
+95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 116, 121, 112, 101, 115, 46,
+104, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83, 84, 67, 95, 86,
+69, 67, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 83, 84, 67, 95, 86, 69, 67, 95, 72, 95, 73,
+78, 67, 76, 85, 68, 69, 68, 10, 47, 47, 32, 35, 35, 35, 32, 66, 69,
+71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58,
+32, 99, 111, 109, 109, 111, 110, 46, 104, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 83, 84, 67, 95, 67, 79, 77, 77, 79, 78, 95, 72, 95, 73,
+78, 67, 76, 85, 68, 69, 68, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+83, 84, 67, 95, 67, 79, 77, 77, 79, 78, 95, 72, 95, 73, 78, 67, 76,
+85, 68, 69, 68, 10, 10, 35, 105, 102, 100, 101, 102, 32, 95, 77, 83,
+67, 95, 86, 69, 82, 10, 32, 32, 32, 32, 35, 112, 114, 97, 103, 109,
+97, 32, 119, 97, 114, 110, 105, 110, 103, 40, 100, 105, 115, 97, 98,
+108, 101, 58, 32, 52, 49, 49, 54, 32, 52, 57, 57, 54, 41, 32, 47, 47,
+32, 117, 110, 110, 97, 109, 101, 100, 32, 116, 121, 112, 101, 32, 100,
+101, 102, 105, 110, 105, 116, 105, 111, 110, 32, 105, 110, 32, 112,
+97, 114, 101, 110, 116, 104, 101, 115, 101, 115, 10, 35, 101, 110,
+100, 105, 102, 10, 47, 47, 32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66,
+89, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110, 116, 97, 105, 110,
+101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46, 112, 121, 32, 35,
+105, 110, 99, 108, 117, 100, 101, 32, 60, 105, 110, 116, 116, 121,
+112, 101, 115, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67, 76, 85, 68,
+69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110,
+116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46,
+112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60, 115, 116,
+100, 100, 101, 102, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67, 76, 85,
+68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99, 111, 110,
+116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114, 115, 46,
+112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60, 115, 116,
+100, 98, 111, 111, 108, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67, 76,
+85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99, 111,
+110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101, 114,
+115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32, 60,
+115, 116, 114, 105, 110, 103, 46, 104, 62, 10, 47, 47, 32, 69, 88, 67,
+76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103, 101, 110, 95, 99,
+111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101, 97, 100, 101,
+114, 115, 46, 112, 121, 32, 35, 105, 110, 99, 108, 117, 100, 101, 32,
+60, 97, 115, 115, 101, 114, 116, 46, 104, 62, 10, 10, 116, 121, 112,
+101, 100, 101, 102, 32, 112, 116, 114, 100, 105, 102, 102, 95, 116,
+32, 32, 32, 32, 32, 32, 32, 105, 115, 105, 122, 101, 59, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 83, 84, 67, 95, 78, 79, 95, 73, 78, 84,
+95, 68, 69, 70, 83, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 105, 110, 116, 56, 95, 116, 32, 32, 32, 32, 32, 32, 105, 110,
+116, 56, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101, 102,
+32, 117, 105, 110, 116, 56, 95, 116, 32, 32, 32, 32, 32, 117, 105,
+110, 116, 56, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 105, 110, 116, 49, 54, 95, 116, 32, 32, 32, 32, 32, 105, 110,
+116, 49, 54, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101, 100, 101,
+102, 32, 117, 105, 110, 116, 49, 54, 95, 116, 32, 32, 32, 32, 117,
+105, 110, 116, 49, 54, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 105, 110, 116, 51, 50, 95, 116, 32, 32, 32, 32, 32,
+105, 110, 116, 51, 50, 59, 10, 32, 32, 32, 32, 116, 121, 112, 101,
+100, 101, 102, 32, 117, 105, 110, 116, 51, 50, 95, 116, 32, 32, 32,
+32, 117, 105, 110, 116, 51, 50, 59, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 105, 110, 116, 54, 52, 95, 116, 32, 32, 32,
+32, 32, 105, 110, 116, 54, 52, 59, 10, 32, 32, 32, 32, 116, 121, 112,
+101, 100, 101, 102, 32, 117, 105, 110, 116, 54, 52, 95, 116, 32, 32,
+32, 32, 117, 105, 110, 116, 54, 52, 59, 10, 35, 101, 110, 100, 105,
+102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+83, 84, 67, 95, 72, 65, 83, 95, 84, 89, 80, 69, 79, 70, 32, 38, 38,
+32, 40, 95, 77, 83, 67, 95, 70, 85, 76, 76, 95, 86, 69, 82, 32, 62,
+61, 32, 49, 57, 51, 57, 51, 51, 52, 50, 56, 32, 124, 124, 32, 92, 10,
+32, 32, 32, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 71, 78,
+85, 67, 95, 95, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 95, 95, 99, 108, 97, 110, 103, 95, 95, 32, 124, 124, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 95, 95, 84, 73, 78, 89, 67, 95, 95, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 83, 84, 67,
+95, 72, 65, 83, 95, 84, 89, 80, 69, 79, 70, 32, 49, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 95, 71, 78, 85, 67, 95, 95, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 71, 78, 85, 65, 84, 84, 82, 40, 46,
+46, 46, 41, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95,
+95, 40, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10,
+35, 101, 108, 115, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 71, 78, 85, 65, 84, 84, 82, 40, 46, 46, 46, 41, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 83,
+84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 115, 116, 97, 116, 105, 99,
+32, 105, 110, 108, 105, 110, 101, 32, 99, 95, 71, 78, 85, 65, 84, 84,
+82, 40, 117, 110, 117, 115, 101, 100, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 90, 73, 32, 80, 82, 73, 105, 80, 84, 82, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 90, 85, 32, 80, 82, 73, 117,
+80, 84, 82, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 78, 80,
+79, 83, 32, 73, 78, 84, 80, 84, 82, 95, 77, 65, 88, 10, 10, 47, 47,
+32, 77, 97, 99, 114, 111, 32, 111, 118, 101, 114, 108, 111, 97, 100,
+105, 110, 103, 32, 102, 101, 97, 116, 117, 114, 101, 32, 115, 117,
+112, 112, 111, 114, 116, 32, 98, 97, 115, 101, 100, 32, 111, 110, 58,
+32, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 120, 116, 101, 115,
+116, 101, 114, 46, 99, 111, 109, 47, 79, 78, 80, 56, 48, 49, 48, 55,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 77, 65, 67, 82, 79,
+95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 110, 97, 109, 101, 44, 32, 46,
+46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 99, 95, 74, 79, 73, 78, 40,
+99, 95, 74, 79, 73, 78, 48, 40, 110, 97, 109, 101, 44, 95, 41, 44, 99,
+95, 78, 85, 77, 65, 82, 71, 83, 40, 95, 95, 86, 65, 95, 65, 82, 71,
+83, 95, 95, 41, 41, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 74, 79, 73, 78,
+48, 40, 97, 44, 32, 98, 41, 32, 97, 32, 35, 35, 32, 98, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 74, 79, 73, 78, 40, 97, 44, 32,
+98, 41, 32, 99, 95, 74, 79, 73, 78, 48, 40, 97, 44, 32, 98, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 69, 88, 80, 65, 78, 68,
+40, 46, 46, 46, 41, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 78, 85, 77, 65, 82,
+71, 83, 40, 46, 46, 46, 41, 32, 95, 99, 95, 65, 80, 80, 76, 89, 95,
+65, 82, 71, 95, 78, 40, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 44, 32, 95, 99, 95, 82, 83, 69, 81, 95, 78, 41, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 99, 95, 65, 80, 80, 76, 89, 95, 65,
+82, 71, 95, 78, 40, 97, 114, 103, 115, 41, 32, 95, 99, 95, 65, 82, 71,
+95, 78, 32, 97, 114, 103, 115, 32, 32, 47, 47, 32, 119, 114, 97, 112,
+32, 99, 95, 69, 88, 80, 65, 78, 68, 40, 46, 46, 41, 32, 102, 111, 114,
+32, 77, 83, 86, 67, 32, 119, 105, 116, 104, 111, 117, 116, 32, 47,
+115, 116, 100, 58, 99, 49, 49, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 99, 95, 82, 83, 69, 81, 95, 78, 32, 49, 54, 44, 32, 49, 53,
+44, 32, 49, 52, 44, 32, 49, 51, 44, 32, 49, 50, 44, 32, 49, 49, 44,
+32, 49, 48, 44, 32, 57, 44, 32, 56, 44, 32, 55, 44, 32, 54, 44, 32,
+53, 44, 32, 52, 44, 32, 51, 44, 32, 50, 44, 32, 49, 44, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 99, 95, 65, 82, 71, 95, 78, 40, 95,
+49, 44, 95, 50, 44, 95, 51, 44, 95, 52, 44, 95, 53, 44, 95, 54, 44,
+95, 55, 44, 95, 56, 44, 95, 57, 44, 95, 49, 48, 44, 95, 49, 49, 44,
+95, 49, 50, 44, 95, 49, 51, 44, 95, 49, 52, 44, 95, 49, 53, 44, 95,
+49, 54, 44, 78, 44, 46, 46, 46, 41, 32, 78, 10, 10, 47, 47, 32, 83,
+97, 116, 117, 114, 97, 116, 101, 100, 32, 111, 118, 101, 114, 108,
+111, 97, 100, 105, 110, 103, 10, 47, 47, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 102, 111, 111, 40, 46, 46, 46, 41, 32, 102, 111, 111,
+95, 73, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 44, 32, 99,
+95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 51, 41, 44, 32,
+99, 95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 50, 41, 44,
+32, 99, 95, 67, 79, 77, 77, 65, 95, 78, 40, 102, 111, 111, 95, 49, 41,
+44, 41, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 47,
+47, 32, 35, 100, 101, 102, 105, 110, 101, 32, 102, 111, 111, 95, 73,
+40, 97, 44, 98, 44, 99, 44, 32, 110, 44, 32, 46, 46, 46, 41, 32, 99,
+95, 84, 85, 80, 76, 69, 95, 65, 84, 95, 49, 40, 110, 44, 32, 102, 111,
+111, 95, 110, 44, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 84, 85, 80, 76, 69, 95, 65, 84, 95, 49, 40, 120, 44, 121, 44, 46,
+46, 46, 41, 32, 121, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+67, 79, 77, 77, 65, 95, 78, 40, 120, 41, 32, 44, 120, 10, 10, 47, 47,
+32, 83, 101, 108, 101, 99, 116, 32, 97, 114, 103, 44, 32, 101, 46,
+103, 46, 32, 102, 111, 114, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 116, 121, 112, 101, 32, 65, 44, 66, 32, 116, 104, 101, 110,
+32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 50, 44, 32, 105, 95, 116, 121,
+112, 101, 41, 32, 105, 115, 32, 66, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 78, 44, 32, 46, 46, 46,
+41, 32, 99, 95, 65, 82, 71, 95, 35, 35, 78, 40, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 44, 41, 32, 47, 47, 32, 119, 114, 97, 112, 32,
+99, 95, 69, 88, 80, 65, 78, 68, 40, 46, 46, 41, 32, 102, 111, 114, 32,
+77, 83, 86, 67, 32, 119, 105, 116, 104, 111, 117, 116, 32, 47, 115,
+116, 100, 58, 99, 49, 49, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 65, 82, 71, 95, 49, 40, 97, 44, 32, 46, 46, 46, 41, 32, 97,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 50,
+40, 97, 44, 32, 98, 44, 32, 46, 46, 46, 41, 32, 98, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 51, 40, 97, 44, 32,
+98, 44, 32, 99, 44, 32, 46, 46, 46, 41, 32, 99, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 65, 82, 71, 95, 52, 40, 97, 44, 32, 98, 44,
+32, 99, 44, 32, 100, 44, 32, 46, 46, 46, 41, 32, 100, 10, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 105, 95, 109, 97, 108, 108, 111, 99,
+40, 84, 44, 32, 110, 41, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 105,
+95, 109, 97, 108, 108, 111, 99, 40, 40, 110, 41, 42, 99, 95, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 99, 97, 108, 108, 111, 99, 40, 84, 44, 32,
+110, 41, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 105, 95, 99, 97, 108,
+108, 111, 99, 40, 40, 110, 41, 44, 32, 99, 95, 115, 105, 122, 101,
+111, 102, 40, 84, 41, 41, 41, 10, 35, 105, 102, 110, 100, 101, 102,
+32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110, 101, 119,
+40, 84, 44, 32, 46, 46, 46, 41, 32, 32, 32, 40, 40, 84, 42, 41, 99,
+95, 115, 97, 102, 101, 95, 109, 101, 109, 99, 112, 121, 40, 99, 95,
+109, 97, 108, 108, 111, 99, 40, 99, 95, 115, 105, 122, 101, 111, 102,
+40, 84, 41, 41, 44, 32, 40, 40, 84, 91, 93, 41, 123, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 125, 41, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 84, 41, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40,
+84, 41, 32, 32, 32, 32, 40, 84, 41, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114,
+97, 121, 40, 84, 44, 32, 46, 46, 46, 41, 32, 40, 40, 84, 91, 93, 41,
+95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 32, 32, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 107, 101, 95,
+97, 114, 114, 97, 121, 50, 100, 40, 84, 44, 32, 78, 44, 32, 46, 46,
+46, 41, 32, 40, 40, 84, 91, 93, 91, 78, 93, 41, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 10, 35, 101, 108, 115, 101, 10, 47, 47,
+32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114, 101, 103,
+101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95, 104, 101,
+97, 100, 101, 114, 115, 46, 112, 121, 32, 32, 32, 32, 32, 35, 105,
+110, 99, 108, 117, 100, 101, 32, 60, 110, 101, 119, 62, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 110, 101, 119,
+40, 84, 44, 32, 46, 46, 46, 41, 32, 32, 32, 32, 32, 32, 32, 110, 101,
+119, 32, 40, 99, 95, 109, 97, 108, 108, 111, 99, 40, 99, 95, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 41, 41, 32, 84, 40, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 84,
+41, 32, 32, 32, 32, 32, 32, 32, 32, 84, 10, 32, 32, 32, 32, 116, 101,
+109, 112, 108, 97, 116, 101, 60, 116, 121, 112, 101, 110, 97, 109,
+101, 32, 84, 44, 32, 105, 110, 116, 32, 77, 44, 32, 105, 110, 116, 32,
+78, 62, 32, 115, 116, 114, 117, 99, 116, 32, 95, 99, 95, 65, 114, 114,
+97, 121, 32, 123, 32, 84, 32, 100, 97, 116, 97, 91, 77, 93, 91, 78,
+93, 59, 32, 125, 59, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114, 97, 121, 40, 84,
+44, 32, 46, 46, 46, 41, 32, 40, 95, 99, 95, 65, 114, 114, 97, 121, 60,
+84, 44, 32, 49, 44, 32, 115, 105, 122, 101, 111, 102, 40, 40, 84, 91,
+93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105,
+122, 101, 111, 102, 40, 84, 41, 62, 123, 123, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 125, 125, 46, 100, 97, 116, 97, 91, 48, 93, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109,
+97, 107, 101, 95, 97, 114, 114, 97, 121, 50, 100, 40, 84, 44, 32, 78,
+44, 32, 46, 46, 46, 41, 32, 40, 95, 99, 95, 65, 114, 114, 97, 121, 60,
+84, 44, 32, 115, 105, 122, 101, 111, 102, 40, 40, 84, 91, 93, 91, 78,
+93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105,
+122, 101, 111, 102, 40, 84, 91, 78, 93, 41, 44, 32, 78, 62, 123, 95,
+95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 125, 46, 100, 97, 116, 97, 41,
+10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 100, 101, 102, 32,
+83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 10, 32, 32, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 108, 108,
+111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 83, 84, 67, 95, 65, 76, 76,
+79, 67, 65, 84, 79, 82, 44, 32, 95, 109, 97, 108, 108, 111, 99, 41,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99,
+97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40, 83, 84, 67, 95,
+65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32, 95, 99, 97, 108, 108, 111,
+99, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 114, 101, 97, 108, 108, 111, 99, 32, 99, 95, 74, 79, 73, 78, 40,
+83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32, 95, 114,
+101, 97, 108, 108, 111, 99, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 102, 114, 101, 101, 32, 99, 95, 74, 79, 73,
+78, 40, 83, 84, 67, 95, 65, 76, 76, 79, 67, 65, 84, 79, 82, 44, 32,
+95, 102, 114, 101, 101, 41, 10, 35, 101, 108, 115, 101, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 108,
+108, 111, 99, 40, 115, 122, 41, 32, 32, 32, 32, 32, 32, 32, 32, 109,
+97, 108, 108, 111, 99, 40, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 115, 122, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 99, 97, 108, 108, 111, 99, 40, 110, 44, 32, 115,
+122, 41, 32, 32, 32, 32, 32, 99, 97, 108, 108, 111, 99, 40, 99, 95,
+105, 50, 117, 95, 115, 105, 122, 101, 40, 110, 41, 44, 32, 99, 95,
+105, 50, 117, 95, 115, 105, 122, 101, 40, 115, 122, 41, 41, 10, 32,
+32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 101,
+97, 108, 108, 111, 99, 40, 112, 116, 114, 44, 32, 111, 108, 100, 95,
+115, 122, 44, 32, 115, 122, 41, 32, 114, 101, 97, 108, 108, 111, 99,
+40, 112, 116, 114, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 49, 32, 63, 32, 40, 115, 122, 41, 32, 58, 32, 40, 111, 108,
+100, 95, 115, 122, 41, 41, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 102, 114, 101, 101, 40, 112, 116, 114, 44,
+32, 115, 122, 41, 32, 32, 32, 32, 32, 40, 40, 118, 111, 105, 100, 41,
+40, 115, 122, 41, 44, 32, 102, 114, 101, 101, 40, 112, 116, 114, 41,
+41, 10, 35, 101, 110, 100, 105, 102, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 110, 101, 119, 95, 110, 40, 84, 44, 32, 110, 41, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 84, 42, 41, 99, 95,
+99, 97, 108, 108, 111, 99, 40, 110, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 84, 41, 41, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 100, 101, 108, 101, 116, 101, 40, 84, 44, 32, 112,
+116, 114, 41, 32, 32, 32, 32, 32, 32, 32, 32, 100, 111, 32, 123, 32,
+84, 42, 32, 95, 116, 112, 32, 61, 32, 112, 116, 114, 59, 32, 84, 35,
+35, 95, 100, 114, 111, 112, 40, 95, 116, 112, 41, 59, 32, 99, 95, 102,
+114, 101, 101, 40, 95, 116, 112, 44, 32, 99, 95, 115, 105, 122, 101,
+111, 102, 40, 84, 41, 41, 59, 32, 125, 32, 119, 104, 105, 108, 101,
+32, 40, 48, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100,
+101, 108, 101, 116, 101, 95, 110, 40, 84, 44, 32, 112, 116, 114, 44,
+32, 110, 41, 32, 32, 32, 100, 111, 32, 123, 32, 84, 42, 32, 95, 116,
+112, 32, 61, 32, 112, 116, 114, 59, 32, 105, 115, 105, 122, 101, 32,
+95, 110, 32, 61, 32, 110, 44, 32, 95, 109, 32, 61, 32, 95, 110, 59,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 95, 110, 45,
+45, 41, 32, 84, 35, 35, 95, 100, 114, 111, 112, 40, 40, 95, 116, 112,
+32, 43, 32, 95, 110, 41, 41, 59, 32, 92, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 95, 102,
+114, 101, 101, 40, 95, 116, 112, 44, 32, 95, 109, 42, 99, 95, 115,
+105, 122, 101, 111, 102, 40, 84, 41, 41, 59, 32, 125, 32, 119, 104,
+105, 108, 101, 32, 40, 48, 41, 10, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 115, 116, 97, 116, 105, 99, 95, 97, 115, 115, 101,
+114, 116, 40, 101, 120, 112, 114, 41, 32, 32, 32, 40, 118, 111, 105,
+100, 41, 115, 105, 122, 101, 111, 102, 40, 105, 110, 116, 91, 40, 101,
+120, 112, 114, 41, 32, 63, 32, 49, 32, 58, 32, 45, 49, 93, 41, 10, 35,
+105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 83, 84, 67, 95,
+78, 68, 69, 66, 85, 71, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 78, 68, 69, 66, 85, 71, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40,
+101, 120, 112, 114, 41, 32, 32, 32, 32, 32, 32, 40, 118, 111, 105,
+100, 41, 115, 105, 122, 101, 111, 102, 40, 101, 120, 112, 114, 41, 10,
+35, 101, 108, 115, 101, 10, 35, 105, 102, 110, 100, 101, 102, 32, 83,
+84, 67, 95, 65, 83, 83, 69, 82, 84, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 83, 84, 67, 95, 65, 83, 83, 69, 82, 84, 40, 101, 120, 112,
+114, 41, 10, 35, 101, 110, 100, 105, 102, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40,
+101, 120, 112, 114, 41, 32, 32, 32, 32, 32, 32, 83, 84, 67, 95, 65,
+83, 83, 69, 82, 84, 40, 101, 120, 112, 114, 41, 10, 35, 101, 110, 100,
+105, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99, 111,
+110, 116, 97, 105, 110, 101, 114, 95, 111, 102, 40, 112, 44, 32, 67,
+44, 32, 109, 41, 32, 40, 40, 67, 42, 41, 40, 40, 99, 104, 97, 114, 42,
+41, 40, 49, 32, 63, 32, 40, 112, 41, 32, 58, 32, 38, 40, 40, 67, 42,
+41, 48, 41, 45, 62, 109, 41, 32, 45, 32, 111, 102, 102, 115, 101, 116,
+111, 102, 40, 67, 44, 32, 109, 41, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 99, 111, 110, 115, 116, 95, 99, 97, 115, 116,
+40, 84, 112, 44, 32, 112, 41, 32, 32, 32, 32, 32, 40, 40, 84, 112, 41,
+40, 49, 32, 63, 32, 40, 112, 41, 32, 58, 32, 40, 84, 112, 41, 48, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 108, 105, 116,
+115, 116, 114, 108, 101, 110, 40, 108, 105, 116, 101, 114, 97, 108,
+41, 32, 32, 32, 32, 40, 99, 95, 115, 105, 122, 101, 111, 102, 40, 34,
+34, 32, 108, 105, 116, 101, 114, 97, 108, 41, 32, 45, 32, 49, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 99, 111, 117, 110, 116,
+111, 102, 40, 97, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+40, 105, 115, 105, 122, 101, 41, 40, 115, 105, 122, 101, 111, 102, 40,
+97, 41, 47, 115, 105, 122, 101, 111, 102, 32, 48, 91, 97, 93, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 97, 114, 114, 97, 121,
+108, 101, 110, 40, 97, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+99, 95, 99, 111, 117, 110, 116, 111, 102, 40, 97, 41, 10, 10, 47, 47,
+32, 101, 120, 112, 101, 99, 116, 32, 115, 105, 103, 110, 101, 100, 32,
+105, 110, 116, 115, 32, 116, 111, 47, 102, 114, 111, 109, 32, 116,
+104, 101, 115, 101, 32, 40, 117, 115, 101, 32, 119, 105, 116, 104, 32,
+103, 99, 99, 32, 45, 87, 99, 111, 110, 118, 101, 114, 115, 105, 111,
+110, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 105,
+122, 101, 111, 102, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 40, 105, 115, 105, 122, 101, 41, 115, 105, 122, 101,
+111, 102, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 116,
+114, 108, 101, 110, 40, 115, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 40, 105, 115, 105, 122, 101, 41, 115, 116, 114, 108,
+101, 110, 40, 115, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 115, 116, 114, 110, 99, 109, 112, 40, 97, 44, 32, 98, 44, 32, 105,
+108, 101, 110, 41, 32, 32, 32, 115, 116, 114, 110, 99, 109, 112, 40,
+97, 44, 32, 98, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122, 101,
+40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 109, 101, 109, 99, 112, 121, 40, 100, 44, 32, 115, 44, 32,
+105, 108, 101, 110, 41, 32, 32, 32, 32, 109, 101, 109, 99, 112, 121,
+40, 100, 44, 32, 115, 44, 32, 99, 95, 105, 50, 117, 95, 115, 105, 122,
+101, 40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 109, 101, 109, 109, 111, 118, 101, 40, 100, 44, 32,
+115, 44, 32, 105, 108, 101, 110, 41, 32, 32, 32, 109, 101, 109, 109,
+111, 118, 101, 40, 100, 44, 32, 115, 44, 32, 99, 95, 105, 50, 117, 95,
+115, 105, 122, 101, 40, 105, 108, 101, 110, 41, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 109, 101, 109, 115, 101, 116, 40, 100,
+44, 32, 118, 97, 108, 44, 32, 105, 108, 101, 110, 41, 32, 32, 109,
+101, 109, 115, 101, 116, 40, 100, 44, 32, 118, 97, 108, 44, 32, 99,
+95, 105, 50, 117, 95, 115, 105, 122, 101, 40, 105, 108, 101, 110, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 101, 109,
+99, 109, 112, 40, 97, 44, 32, 98, 44, 32, 105, 108, 101, 110, 41, 32,
+32, 32, 32, 109, 101, 109, 99, 109, 112, 40, 97, 44, 32, 98, 44, 32,
+99, 95, 105, 50, 117, 95, 115, 105, 122, 101, 40, 105, 108, 101, 110,
+41, 41, 10, 47, 47, 32, 108, 105, 98, 114, 97, 114, 121, 32, 105, 110,
+116, 101, 114, 110, 97, 108, 44, 32, 98, 117, 116, 32, 109, 97, 121,
+32, 98, 101, 32, 117, 115, 101, 102, 117, 108, 32, 105, 110, 32, 117,
+115, 101, 114, 32, 99, 111, 100, 101, 58, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 117, 50, 105, 95, 115, 105, 122, 101, 40, 117,
+41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 105, 115, 105,
+122, 101, 41, 40, 49, 32, 63, 32, 40, 117, 41, 32, 58, 32, 40, 115,
+105, 122, 101, 95, 116, 41, 49, 41, 32, 47, 47, 32, 119, 97, 114, 110,
+115, 32, 105, 102, 32, 117, 32, 105, 115, 32, 115, 105, 103, 110, 101,
+100, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 105, 50, 117,
+95, 115, 105, 122, 101, 40, 105, 41, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 40, 115, 105, 122, 101, 95, 116, 41, 40, 49, 32, 63, 32,
+40, 105, 41, 32, 58, 32, 45, 49, 41, 32, 32, 32, 32, 32, 32, 32, 47,
+47, 32, 119, 97, 114, 110, 115, 32, 105, 102, 32, 105, 32, 105, 115,
+32, 117, 110, 115, 105, 103, 110, 101, 100, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 117, 108, 101, 115, 115, 40, 97, 44, 32,
+98, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 115, 105,
+122, 101, 95, 116, 41, 40, 97, 41, 32, 60, 32, 40, 115, 105, 122, 101,
+95, 116, 41, 40, 98, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116, 40, 84, 44, 32, 70,
+114, 111, 109, 44, 32, 120, 41, 32, 40, 40, 84, 41, 40, 49, 32, 63,
+32, 40, 120, 41, 32, 58, 32, 40, 70, 114, 111, 109, 41, 123, 48, 125,
+41, 41, 10, 10, 47, 47, 32, 120, 44, 32, 121, 32, 97, 114, 101, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 42, 32, 116, 121, 112, 101, 44,
+32, 119, 104, 105, 99, 104, 32, 100, 101, 102, 97, 117, 108, 116, 115,
+32, 116, 111, 32, 105, 95, 107, 101, 121, 42, 46, 32, 118, 112, 32,
+105, 115, 32, 105, 95, 107, 101, 121, 42, 32, 116, 121, 112, 101, 46,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 101, 109, 99,
+109, 112, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32, 32,
+32, 32, 40, 109, 101, 109, 99, 109, 112, 40, 120, 44, 32, 121, 44, 32,
+115, 105, 122, 101, 111, 102, 32, 42, 40, 120, 41, 41, 32, 61, 61, 32,
+48, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32,
+32, 32, 32, 32, 32, 40, 42, 40, 120, 41, 32, 61, 61, 32, 42, 40, 121,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 108, 101, 115, 115, 40, 120, 44, 32, 121,
+41, 32, 32, 32, 32, 40, 42, 40, 120, 41, 32, 60, 32, 42, 40, 121, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102,
+97, 117, 108, 116, 95, 99, 109, 112, 40, 120, 44, 32, 121, 41, 32, 32,
+32, 32, 32, 40, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 108,
+101, 115, 115, 40, 121, 44, 32, 120, 41, 32, 45, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 108, 101, 115, 115, 40, 120, 44, 32, 121,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 104, 97, 115, 104, 40, 118, 112, 41, 32,
+32, 32, 32, 32, 32, 99, 95, 104, 97, 115, 104, 95, 110, 40, 118, 112,
+44, 32, 115, 105, 122, 101, 111, 102, 32, 42, 40, 118, 112, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102, 97,
+117, 108, 116, 95, 99, 108, 111, 110, 101, 40, 118, 41, 32, 32, 32,
+32, 32, 32, 40, 118, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 100, 101, 102, 97, 117, 108, 116, 95, 116, 111, 114, 97, 119, 40,
+118, 112, 41, 32, 32, 32, 32, 32, 40, 42, 40, 118, 112, 41, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 100, 101, 102, 97, 117,
+108, 116, 95, 100, 114, 111, 112, 40, 118, 112, 41, 32, 32, 32, 32,
+32, 32, 40, 40, 118, 111, 105, 100, 41, 32, 40, 118, 112, 41, 41, 10,
+10, 47, 47, 32, 110, 111, 110, 45, 111, 119, 110, 105, 110, 103, 32,
+99, 104, 97, 114, 32, 112, 111, 105, 110, 116, 101, 114, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 99, 111, 110, 115, 116, 32, 99, 104, 97,
+114, 42, 32, 99, 115, 116, 114, 95, 114, 97, 119, 59, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114, 97, 119, 95,
+99, 109, 112, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32, 32, 32, 115,
+116, 114, 99, 109, 112, 40, 42, 40, 120, 41, 44, 32, 42, 40, 121, 41,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95,
+114, 97, 119, 95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 32, 32, 32,
+32, 32, 32, 40, 99, 115, 116, 114, 95, 114, 97, 119, 95, 99, 109, 112,
+40, 120, 44, 32, 121, 41, 32, 61, 61, 32, 48, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114, 97, 119, 95, 104,
+97, 115, 104, 40, 118, 112, 41, 32, 32, 32, 32, 32, 32, 32, 99, 95,
+104, 97, 115, 104, 95, 115, 116, 114, 40, 42, 40, 118, 112, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 115, 116, 114, 95, 114,
+97, 119, 95, 99, 108, 111, 110, 101, 40, 118, 41, 32, 32, 32, 32, 32,
+32, 32, 40, 118, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+115, 116, 114, 95, 114, 97, 119, 95, 100, 114, 111, 112, 40, 118, 112,
+41, 32, 32, 32, 32, 32, 32, 32, 40, 40, 118, 111, 105, 100, 41, 118,
+112, 41, 10, 10, 47, 47, 32, 67, 111, 110, 116, 114, 111, 108, 32, 98,
+108, 111, 99, 107, 32, 109, 97, 99, 114, 111, 115, 10, 10, 47, 47, 32,
+91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 58, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 105, 110, 105, 116, 40, 46,
+46, 46, 41, 32, 99, 95, 109, 97, 107, 101, 40, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 102, 111, 114, 108, 105, 115, 116, 40, 46, 46, 46, 41, 32, 102,
+111, 114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 102, 111, 114, 105, 116, 101, 109, 115, 40, 46, 46, 46,
+41, 32, 102, 111, 114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40,
+95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104, 40,
+46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 101, 97, 99, 104,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104,
+95, 110, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 101,
+97, 99, 104, 95, 110, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 111,
+114, 101, 97, 99, 104, 95, 107, 118, 40, 46, 46, 46, 41, 32, 102, 111,
+114, 32, 40, 99, 95, 101, 97, 99, 104, 95, 107, 118, 40, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 102, 111, 114, 101, 97, 99, 104, 95, 114, 101,
+118, 101, 114, 115, 101, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32,
+40, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118, 101, 114, 115, 101,
+40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 114, 97, 110, 103,
+101, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32, 40, 99, 95, 114, 97,
+110, 103, 101, 40, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 102, 111, 114, 114,
+97, 110, 103, 101, 51, 50, 40, 46, 46, 46, 41, 32, 102, 111, 114, 32,
+40, 99, 95, 114, 97, 110, 103, 101, 51, 50, 40, 95, 95, 86, 65, 95,
+65, 82, 71, 83, 95, 95, 41, 41, 10, 10, 47, 47, 32, 78, 101, 119, 58,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99, 104,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 101, 97, 99, 104, 44, 32, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 101, 97, 99, 104, 95, 51, 40, 105, 116, 44, 32, 67,
+44, 32, 99, 110, 116, 41, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95,
+105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 67, 35, 35, 95, 98, 101,
+103, 105, 110, 40, 38, 99, 110, 116, 41, 59, 32, 105, 116, 46, 114,
+101, 102, 59, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40, 38, 105,
+116, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 52, 40, 105, 116, 44, 32, 67, 44, 32, 115, 116, 97, 114,
+116, 44, 32, 101, 110, 100, 41, 32, 92, 10, 32, 32, 32, 32, 95, 99,
+95, 101, 97, 99, 104, 40, 105, 116, 44, 32, 67, 44, 32, 115, 116, 97,
+114, 116, 44, 32, 40, 101, 110, 100, 41, 46, 114, 101, 102, 44, 32,
+95, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 110, 40, 105, 116, 44, 32, 67, 44, 32, 99, 110, 116, 44,
+32, 110, 41, 32, 92, 10, 32, 32, 32, 32, 115, 116, 114, 117, 99, 116,
+32, 123, 67, 35, 35, 95, 105, 116, 101, 114, 32, 105, 116, 101, 114,
+59, 32, 67, 35, 35, 95, 118, 97, 108, 117, 101, 42, 32, 114, 101, 102,
+59, 32, 105, 115, 105, 122, 101, 32, 115, 105, 122, 101, 44, 32, 105,
+110, 100, 101, 120, 59, 125, 32, 92, 10, 32, 32, 32, 32, 105, 116, 32,
+61, 32, 123, 46, 105, 116, 101, 114, 61, 67, 35, 35, 95, 98, 101, 103,
+105, 110, 40, 38, 99, 110, 116, 41, 44, 32, 46, 115, 105, 122, 101,
+61, 110, 125, 59, 32, 40, 105, 116, 46, 114, 101, 102, 32, 61, 32,
+105, 116, 46, 105, 116, 101, 114, 46, 114, 101, 102, 41, 32, 38, 38,
+32, 105, 116, 46, 105, 110, 100, 101, 120, 32, 60, 32, 105, 116, 46,
+115, 105, 122, 101, 59, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40,
+38, 105, 116, 46, 105, 116, 101, 114, 41, 44, 32, 43, 43, 105, 116,
+46, 105, 110, 100, 101, 120, 10, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118, 101, 114, 115, 101,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 101, 97, 99, 104, 95, 114, 101, 118,
+101, 114, 115, 101, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99,
+104, 95, 114, 101, 118, 101, 114, 115, 101, 95, 51, 40, 105, 116, 44,
+32, 67, 44, 32, 99, 110, 116, 41, 32, 47, 42, 32, 119, 111, 114, 107,
+115, 32, 102, 111, 114, 32, 115, 116, 97, 99, 107, 44, 32, 118, 101,
+99, 44, 32, 113, 117, 101, 117, 101, 44, 32, 100, 101, 113, 117, 101,
+32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95, 105, 116, 101,
+114, 32, 105, 116, 32, 61, 32, 67, 35, 35, 95, 114, 98, 101, 103, 105,
+110, 40, 38, 99, 110, 116, 41, 59, 32, 105, 116, 46, 114, 101, 102,
+59, 32, 67, 35, 35, 95, 114, 110, 101, 120, 116, 40, 38, 105, 116, 41,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97, 99, 104,
+95, 114, 101, 118, 101, 114, 115, 101, 95, 52, 40, 105, 116, 44, 32,
+67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 92,
+10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 40, 105, 116, 44,
+32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 40, 101, 110, 100, 41,
+46, 114, 101, 102, 44, 32, 95, 114, 41, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 95, 99, 95, 101, 97, 99, 104, 40, 105, 116, 44, 32,
+67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 114, 101,
+102, 44, 32, 114, 101, 118, 41, 32, 47, 42, 32, 112, 114, 105, 118,
+97, 116, 101, 32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95,
+105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 40, 115, 116, 97, 114,
+116, 41, 44, 32, 42, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35,
+105, 116, 32, 61, 32, 99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116,
+40, 67, 35, 35, 95, 105, 116, 101, 114, 42, 44, 32, 67, 35, 35, 95,
+118, 97, 108, 117, 101, 42, 44, 32, 101, 110, 100, 114, 101, 102, 41,
+32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 59, 32, 105, 116, 46,
+114, 101, 102, 32, 33, 61, 32, 40, 67, 35, 35, 95, 118, 97, 108, 117,
+101, 42, 41, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35, 105, 116,
+59, 32, 67, 35, 35, 114, 101, 118, 35, 35, 110, 101, 120, 116, 40, 38,
+105, 116, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+101, 97, 99, 104, 95, 107, 118, 40, 46, 46, 46, 41, 32, 99, 95, 77,
+65, 67, 82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 101,
+97, 99, 104, 95, 107, 118, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101, 97,
+99, 104, 95, 107, 118, 95, 52, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 99, 110, 116, 41, 32, 47, 42, 32, 115, 116,
+114, 117, 99, 116, 117, 114, 101, 100, 32, 98, 105, 110, 100, 105,
+110, 103, 32, 102, 111, 114, 32, 109, 97, 112, 115, 32, 42, 47, 32,
+92, 10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 95, 107, 118,
+40, 107, 101, 121, 44, 32, 118, 97, 108, 44, 32, 67, 44, 32, 67, 35,
+35, 95, 98, 101, 103, 105, 110, 40, 38, 99, 110, 116, 41, 44, 32, 78,
+85, 76, 76, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 101,
+97, 99, 104, 95, 107, 118, 95, 53, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110,
+100, 41, 32, 92, 10, 32, 32, 32, 32, 95, 99, 95, 101, 97, 99, 104, 95,
+107, 118, 40, 107, 101, 121, 44, 32, 118, 97, 108, 44, 32, 67, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 40, 101, 110, 100, 41, 46, 114, 101,
+102, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 99, 95,
+101, 97, 99, 104, 95, 107, 118, 40, 107, 101, 121, 44, 32, 118, 97,
+108, 44, 32, 67, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110,
+100, 114, 101, 102, 41, 32, 47, 42, 32, 112, 114, 105, 118, 97, 116,
+101, 32, 42, 47, 32, 92, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+32, 67, 35, 35, 95, 107, 101, 121, 32, 42, 107, 101, 121, 32, 61, 32,
+40, 99, 111, 110, 115, 116, 32, 67, 35, 35, 95, 107, 101, 121, 42, 41,
+38, 107, 101, 121, 59, 32, 107, 101, 121, 59, 32, 41, 32, 92, 10, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 67, 35, 35, 95, 109, 97, 112, 112,
+101, 100, 32, 42, 118, 97, 108, 59, 32, 107, 101, 121, 59, 32, 107,
+101, 121, 32, 61, 32, 78, 85, 76, 76, 41, 32, 92, 10, 32, 32, 32, 32,
+102, 111, 114, 32, 40, 67, 35, 35, 95, 105, 116, 101, 114, 32, 95,
+105, 116, 95, 35, 35, 107, 101, 121, 32, 61, 32, 115, 116, 97, 114,
+116, 44, 32, 42, 95, 101, 110, 100, 114, 101, 102, 95, 35, 35, 107,
+101, 121, 32, 61, 32, 99, 95, 115, 97, 102, 101, 95, 99, 97, 115, 116,
+40, 67, 35, 35, 95, 105, 116, 101, 114, 42, 44, 32, 67, 35, 35, 95,
+118, 97, 108, 117, 101, 42, 44, 32, 101, 110, 100, 114, 101, 102, 41,
+59, 32, 92, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 105, 116, 95,
+35, 35, 107, 101, 121, 46, 114, 101, 102, 32, 33, 61, 32, 40, 67, 35,
+35, 95, 118, 97, 108, 117, 101, 42, 41, 95, 101, 110, 100, 114, 101,
+102, 95, 35, 35, 107, 101, 121, 32, 38, 38, 32, 40, 107, 101, 121, 32,
+61, 32, 38, 95, 105, 116, 95, 35, 35, 107, 101, 121, 46, 114, 101,
+102, 45, 62, 102, 105, 114, 115, 116, 44, 32, 118, 97, 108, 32, 61,
+32, 38, 95, 105, 116, 95, 35, 35, 107, 101, 121, 46, 114, 101, 102,
+45, 62, 115, 101, 99, 111, 110, 100, 41, 59, 32, 92, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 67, 35, 35, 95, 110, 101, 120, 116, 40, 38,
+95, 105, 116, 95, 35, 35, 107, 101, 121, 41, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 105, 116, 101, 109, 115, 40, 105, 116,
+44, 32, 84, 44, 32, 46, 46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 115,
+116, 114, 117, 99, 116, 32, 123, 84, 42, 32, 114, 101, 102, 59, 32,
+105, 110, 116, 32, 115, 105, 122, 101, 44, 32, 105, 110, 100, 101,
+120, 59, 125, 32, 92, 10, 32, 32, 32, 32, 105, 116, 32, 61, 32, 123,
+46, 114, 101, 102, 61, 99, 95, 109, 97, 107, 101, 95, 97, 114, 114,
+97, 121, 40, 84, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 44, 32, 46, 115, 105, 122, 101, 61, 40, 105, 110, 116, 41, 40,
+115, 105, 122, 101, 111, 102, 40, 40, 84, 91, 93, 41, 95, 95, 86, 65,
+95, 65, 82, 71, 83, 95, 95, 41, 47, 115, 105, 122, 101, 111, 102, 40,
+84, 41, 41, 125, 32, 92, 10, 32, 32, 32, 32, 59, 32, 105, 116, 46,
+105, 110, 100, 101, 120, 32, 60, 32, 105, 116, 46, 115, 105, 122, 101,
+32, 59, 32, 43, 43, 105, 116, 46, 114, 101, 102, 44, 32, 43, 43, 105,
+116, 46, 105, 110, 100, 101, 120, 10, 10, 47, 47, 32, 99, 95, 114, 97,
+110, 103, 101, 44, 32, 99, 95, 114, 97, 110, 103, 101, 51, 50, 58, 32,
+112, 121, 116, 104, 111, 110, 45, 108, 105, 107, 101, 32, 105, 110,
+116, 32, 114, 97, 110, 103, 101, 32, 105, 116, 101, 114, 97, 116, 105,
+111, 110, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 95, 116, 40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67,
+82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 114, 97, 110,
+103, 101, 95, 116, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95,
+41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110,
+103, 101, 95, 116, 95, 51, 40, 84, 44, 32, 105, 44, 32, 115, 116, 111,
+112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40, 84,
+44, 32, 105, 44, 32, 48, 44, 32, 115, 116, 111, 112, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116,
+95, 52, 40, 84, 44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32,
+115, 116, 111, 112, 41, 32, 92, 10, 32, 32, 32, 32, 84, 32, 105, 61,
+115, 116, 97, 114, 116, 44, 32, 95, 99, 95, 101, 110, 100, 95, 35, 35,
+105, 61, 115, 116, 111, 112, 59, 32, 105, 32, 60, 32, 95, 99, 95, 101,
+110, 100, 95, 35, 35, 105, 59, 32, 43, 43, 105, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 53,
+40, 84, 44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116,
+111, 112, 44, 32, 115, 116, 101, 112, 41, 32, 92, 10, 32, 32, 32, 32,
+84, 32, 105, 61, 115, 116, 97, 114, 116, 44, 32, 95, 99, 95, 105, 110,
+99, 95, 35, 35, 105, 61, 115, 116, 101, 112, 44, 32, 95, 99, 95, 101,
+110, 100, 95, 35, 35, 105, 61, 40, 115, 116, 111, 112, 41, 32, 45, 32,
+40, 95, 99, 95, 105, 110, 99, 95, 35, 35, 105, 32, 62, 32, 48, 41, 32,
+92, 10, 32, 32, 32, 32, 59, 32, 40, 95, 99, 95, 105, 110, 99, 95, 35,
+35, 105, 32, 62, 32, 48, 41, 32, 61, 61, 32, 40, 105, 32, 60, 61, 32,
+95, 99, 95, 101, 110, 100, 95, 35, 35, 105, 41, 32, 59, 32, 105, 32,
+43, 61, 32, 95, 99, 95, 105, 110, 99, 95, 35, 35, 105, 10, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 40,
+46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69, 82,
+76, 79, 65, 68, 40, 99, 95, 114, 97, 110, 103, 101, 44, 32, 95, 95,
+86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 49, 40, 115, 116,
+111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40,
+105, 115, 105, 122, 101, 44, 32, 95, 99, 95, 105, 49, 44, 32, 48, 44,
+32, 115, 116, 111, 112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 114, 97, 110, 103, 101, 95, 50, 40, 105, 44, 32, 115, 116,
+111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40,
+105, 115, 105, 122, 101, 44, 32, 105, 44, 32, 48, 44, 32, 115, 116,
+111, 112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114,
+97, 110, 103, 101, 95, 51, 40, 105, 44, 32, 115, 116, 97, 114, 116,
+44, 32, 115, 116, 111, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101,
+95, 116, 95, 52, 40, 105, 115, 105, 122, 101, 44, 32, 105, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 41, 10, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101, 95, 52,
+40, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112,
+44, 32, 115, 116, 101, 112, 41, 32, 99, 95, 114, 97, 110, 103, 101,
+95, 116, 95, 53, 40, 105, 115, 105, 122, 101, 44, 32, 105, 44, 32,
+115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 44, 32, 115, 116,
+101, 112, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95,
+114, 97, 110, 103, 101, 51, 50, 40, 46, 46, 46, 41, 32, 99, 95, 77,
+65, 67, 82, 79, 95, 79, 86, 69, 82, 76, 79, 65, 68, 40, 99, 95, 114,
+97, 110, 103, 101, 51, 50, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83,
+95, 95, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 51, 50, 95, 50, 40, 105, 44, 32, 115, 116, 111, 112,
+41, 32, 99, 95, 114, 97, 110, 103, 101, 95, 116, 95, 52, 40, 105, 110,
+116, 51, 50, 95, 116, 44, 32, 105, 44, 32, 48, 44, 32, 115, 116, 111,
+112, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97,
+110, 103, 101, 51, 50, 95, 51, 40, 105, 44, 32, 115, 116, 97, 114,
+116, 44, 32, 115, 116, 111, 112, 41, 32, 99, 95, 114, 97, 110, 103,
+101, 95, 116, 95, 52, 40, 105, 110, 116, 51, 50, 95, 116, 44, 32, 105,
+44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111, 112, 41, 10,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 114, 97, 110, 103, 101,
+51, 50, 95, 52, 40, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115,
+116, 111, 112, 44, 32, 115, 116, 101, 112, 41, 32, 99, 95, 114, 97,
+110, 103, 101, 95, 116, 95, 53, 40, 105, 110, 116, 51, 50, 95, 116,
+44, 32, 105, 44, 32, 115, 116, 97, 114, 116, 44, 32, 115, 116, 111,
+112, 44, 32, 115, 116, 101, 112, 41, 10, 10, 47, 47, 32, 109, 97, 107,
+101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 32, 102, 114, 111,
+109, 32, 97, 32, 108, 105, 116, 101, 114, 97, 108, 32, 108, 105, 115,
+116, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 109, 97, 107,
+101, 40, 67, 44, 32, 46, 46, 46, 41, 32, 92, 10, 32, 32, 32, 32, 67,
+35, 35, 95, 102, 114, 111, 109, 95, 110, 40, 99, 95, 109, 97, 107,
+101, 95, 97, 114, 114, 97, 121, 40, 67, 35, 35, 95, 114, 97, 119, 44,
+32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 44, 32, 99, 95,
+115, 105, 122, 101, 111, 102, 40, 40, 67, 35, 35, 95, 114, 97, 119,
+91, 93, 41, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 99,
+95, 115, 105, 122, 101, 111, 102, 40, 67, 35, 35, 95, 114, 97, 119,
+41, 41, 10, 10, 47, 47, 32, 112, 117, 116, 32, 109, 117, 108, 116,
+105, 112, 108, 101, 32, 114, 97, 119, 45, 116, 121, 112, 101, 32, 101,
+108, 101, 109, 101, 110, 116, 115, 32, 102, 114, 111, 109, 32, 97, 32,
+108, 105, 116, 101, 114, 97, 108, 32, 108, 105, 115, 116, 32, 105,
+110, 116, 111, 32, 97, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 112, 117, 116, 95,
+105, 116, 101, 109, 115, 40, 67, 44, 32, 99, 110, 116, 44, 32, 46, 46,
+46, 41, 32, 92, 10, 32, 32, 32, 32, 67, 35, 35, 95, 112, 117, 116, 95,
+110, 40, 99, 110, 116, 44, 32, 99, 95, 109, 97, 107, 101, 95, 97, 114,
+114, 97, 121, 40, 67, 35, 35, 95, 114, 97, 119, 44, 32, 95, 95, 86,
+65, 95, 65, 82, 71, 83, 95, 95, 41, 44, 32, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 40, 67, 35, 35, 95, 114, 97, 119, 91, 93, 41, 95,
+95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 47, 99, 95, 115, 105, 122,
+101, 111, 102, 40, 67, 35, 35, 95, 114, 97, 119, 41, 41, 10, 10, 47,
+47, 32, 100, 114, 111, 112, 32, 109, 117, 108, 116, 105, 112, 108,
+101, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114, 115, 32, 111, 102,
+32, 115, 97, 109, 101, 32, 116, 121, 112, 101, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 100, 114, 111, 112, 40, 67, 44, 32, 46, 46,
+46, 41, 32, 92, 10, 32, 32, 32, 32, 100, 111, 32, 123, 32, 102, 111,
+114, 32, 40, 99, 95, 105, 116, 101, 109, 115, 40, 95, 99, 95, 105, 50,
+44, 32, 67, 42, 44, 32, 123, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 125, 41, 41, 32, 67, 35, 35, 95, 100, 114, 111, 112, 40, 42, 95,
+99, 95, 105, 50, 46, 114, 101, 102, 41, 59, 32, 125, 32, 119, 104,
+105, 108, 101, 40, 48, 41, 10, 10, 47, 47, 32, 82, 65, 73, 73, 32,
+115, 99, 111, 112, 101, 115, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 100, 101, 102, 101, 114, 40, 46, 46, 46, 41, 32, 92, 10, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95, 99, 95, 105,
+51, 32, 61, 32, 48, 59, 32, 95, 99, 95, 105, 51, 43, 43, 32, 61, 61,
+32, 48, 59, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10,
+10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 119, 105, 116, 104,
+40, 46, 46, 46, 41, 32, 99, 95, 77, 65, 67, 82, 79, 95, 79, 86, 69,
+82, 76, 79, 65, 68, 40, 99, 95, 119, 105, 116, 104, 44, 32, 95, 95,
+86, 65, 95, 65, 82, 71, 83, 95, 95, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 119, 105, 116, 104, 95, 50, 40, 105, 110, 105,
+116, 44, 32, 100, 101, 105, 110, 105, 116, 41, 32, 92, 10, 32, 32, 32,
+32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95, 99, 95, 105, 52, 32,
+61, 32, 48, 59, 32, 95, 99, 95, 105, 52, 32, 61, 61, 32, 48, 59, 32,
+41, 32, 102, 111, 114, 32, 40, 105, 110, 105, 116, 59, 32, 95, 99, 95,
+105, 52, 43, 43, 32, 61, 61, 32, 48, 59, 32, 100, 101, 105, 110, 105,
+116, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 119, 105,
+116, 104, 95, 51, 40, 105, 110, 105, 116, 44, 32, 99, 111, 110, 100,
+105, 116, 105, 111, 110, 44, 32, 100, 101, 105, 110, 105, 116, 41, 32,
+92, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 95,
+99, 95, 105, 53, 32, 61, 32, 48, 59, 32, 95, 99, 95, 105, 53, 32, 61,
+61, 32, 48, 59, 32, 41, 32, 102, 111, 114, 32, 40, 105, 110, 105, 116,
+59, 32, 95, 99, 95, 105, 53, 43, 43, 32, 61, 61, 32, 48, 32, 38, 38,
+32, 40, 99, 111, 110, 100, 105, 116, 105, 111, 110, 41, 59, 32, 100,
+101, 105, 110, 105, 116, 41, 10, 10, 47, 47, 32, 71, 101, 110, 101,
+114, 97, 108, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 10, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 42,
+32, 99, 95, 115, 97, 102, 101, 95, 109, 101, 109, 99, 112, 121, 40,
+118, 111, 105, 100, 42, 32, 100, 115, 116, 44, 32, 99, 111, 110, 115,
+116, 32, 118, 111, 105, 100, 42, 32, 115, 114, 99, 44, 32, 105, 115,
+105, 122, 101, 32, 115, 105, 122, 101, 41, 10, 32, 32, 32, 32, 123,
+32, 114, 101, 116, 117, 114, 110, 32, 100, 115, 116, 32, 63, 32, 109,
+101, 109, 99, 112, 121, 40, 100, 115, 116, 44, 32, 115, 114, 99, 44,
+32, 40, 115, 105, 122, 101, 95, 116, 41, 115, 105, 122, 101, 41, 32,
+58, 32, 78, 85, 76, 76, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78,
+76, 73, 78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 98, 97,
+115, 101, 104, 97, 115, 104, 95, 110, 40, 99, 111, 110, 115, 116, 32,
+118, 111, 105, 100, 42, 32, 107, 101, 121, 44, 32, 105, 115, 105, 122,
+101, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 115, 105,
+122, 101, 95, 116, 32, 98, 108, 111, 99, 107, 32, 61, 32, 48, 44, 32,
+104, 97, 115, 104, 32, 61, 32, 48, 120, 56, 49, 49, 99, 57, 100, 99,
+53, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110,
+116, 56, 95, 116, 42, 32, 109, 115, 103, 32, 61, 32, 40, 99, 111, 110,
+115, 116, 32, 117, 105, 110, 116, 56, 95, 116, 42, 41, 107, 101, 121,
+59, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 108, 101,
+110, 32, 62, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 108, 111, 99, 107, 44,
+32, 109, 115, 103, 44, 32, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+104, 97, 115, 104, 32, 61, 32, 40, 104, 97, 115, 104, 32, 94, 32, 98,
+108, 111, 99, 107, 41, 32, 42, 32, 40, 115, 105, 122, 101, 95, 116,
+41, 48, 120, 56, 57, 98, 98, 49, 55, 57, 57, 48, 49, 48, 48, 48, 49,
+57, 51, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 109, 115, 103, 32, 43,
+61, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105, 122, 101,
+95, 116, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 101, 110,
+32, 45, 61, 32, 99, 95, 115, 105, 122, 101, 111, 102, 40, 115, 105,
+122, 101, 95, 116, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+32, 99, 95, 109, 101, 109, 99, 112, 121, 40, 38, 98, 108, 111, 99,
+107, 44, 32, 109, 115, 103, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32,
+32, 32, 104, 97, 115, 104, 32, 61, 32, 40, 104, 97, 115, 104, 32, 94,
+32, 98, 108, 111, 99, 107, 41, 32, 42, 32, 40, 115, 105, 122, 101, 95,
+116, 41, 48, 120, 98, 48, 51, 52, 48, 102, 52, 53, 48, 49, 48, 48, 48,
+49, 57, 51, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+104, 97, 115, 104, 32, 94, 32, 40, 104, 97, 115, 104, 32, 62, 62, 32,
+51, 41, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69,
+32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 104, 97, 115, 104, 95,
+110, 40, 99, 111, 110, 115, 116, 32, 118, 111, 105, 100, 42, 32, 107,
+101, 121, 44, 32, 105, 115, 105, 122, 101, 32, 108, 101, 110, 41, 32,
+123, 10, 32, 32, 32, 32, 117, 105, 110, 116, 54, 52, 95, 116, 32, 98,
+56, 59, 32, 117, 105, 110, 116, 51, 50, 95, 116, 32, 98, 52, 59, 10,
+32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 108, 101, 110,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32,
+56, 58, 32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 56, 44, 32, 107,
+101, 121, 44, 32, 56, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32,
+40, 115, 105, 122, 101, 95, 116, 41, 40, 98, 56, 32, 42, 32, 48, 120,
+99, 54, 97, 52, 97, 55, 57, 51, 53, 98, 100, 49, 101, 57, 57, 100, 41,
+59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 52, 58,
+32, 109, 101, 109, 99, 112, 121, 40, 38, 98, 52, 44, 32, 107, 101,
+121, 44, 32, 52, 41, 59, 32, 114, 101, 116, 117, 114, 110, 32, 98, 52,
+32, 42, 32, 40, 115, 105, 122, 101, 95, 116, 41, 48, 120, 97, 50, 102,
+102, 101, 98, 50, 102, 48, 49, 48, 48, 48, 49, 57, 51, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 32, 114,
+101, 116, 117, 114, 110, 32, 99, 95, 98, 97, 115, 101, 104, 97, 115,
+104, 95, 110, 40, 107, 101, 121, 44, 32, 108, 101, 110, 41, 59, 10,
+32, 32, 32, 32, 125, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 99, 95, 104, 97, 115,
+104, 95, 115, 116, 114, 40, 99, 111, 110, 115, 116, 32, 99, 104, 97,
+114, 32, 42, 115, 116, 114, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101,
+116, 117, 114, 110, 32, 99, 95, 98, 97, 115, 101, 104, 97, 115, 104,
+95, 110, 40, 115, 116, 114, 44, 32, 99, 95, 115, 116, 114, 108, 101,
+110, 40, 115, 116, 114, 41, 41, 59, 32, 125, 10, 10, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 104, 97, 115, 104, 95, 109, 105, 120,
+40, 46, 46, 46, 41, 32, 47, 42, 32, 110, 111, 110, 45, 99, 111, 109,
+109, 117, 116, 97, 116, 105, 118, 101, 32, 104, 97, 115, 104, 32, 99,
+111, 109, 98, 105, 110, 101, 33, 32, 42, 47, 32, 92, 10, 32, 32, 32,
+32, 95, 99, 104, 97, 115, 104, 95, 109, 105, 120, 40, 99, 95, 109, 97,
+107, 101, 95, 97, 114, 114, 97, 121, 40, 115, 105, 122, 101, 95, 116,
+44, 32, 123, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95, 95, 125, 41, 44,
+32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 95, 95, 86, 65, 95, 65,
+82, 71, 83, 95, 95, 41, 41, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 115, 105, 122, 101, 95, 116, 32, 95, 99, 104, 97, 115,
+104, 95, 109, 105, 120, 40, 115, 105, 122, 101, 95, 116, 32, 104, 91,
+93, 44, 32, 105, 110, 116, 32, 110, 41, 32, 123, 10, 32, 32, 32, 32,
+102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 49, 59, 32,
+105, 32, 60, 32, 110, 59, 32, 43, 43, 105, 41, 32, 104, 91, 48, 93,
+32, 43, 61, 32, 104, 91, 48, 93, 32, 94, 32, 104, 91, 105, 93, 59, 10,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 104, 91, 48, 93, 59,
+10, 125, 10, 10, 47, 47, 32, 103, 101, 110, 101, 114, 105, 99, 32,
+116, 121, 112, 101, 115, 97, 102, 101, 32, 115, 119, 97, 112, 10, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 115, 119, 97, 112, 40, 120,
+112, 44, 32, 121, 112, 41, 32, 100, 111, 32, 123, 32, 92, 10, 32, 32,
+32, 32, 40, 118, 111, 105, 100, 41, 115, 105, 122, 101, 111, 102, 40,
+40, 120, 112, 41, 32, 61, 61, 32, 40, 121, 112, 41, 41, 59, 32, 92,
+10, 32, 32, 32, 32, 99, 104, 97, 114, 32, 95, 116, 118, 91, 115, 105,
+122, 101, 111, 102, 32, 42, 40, 120, 112, 41, 93, 59, 32, 92, 10, 32,
+32, 32, 32, 118, 111, 105, 100, 32, 42, 95, 120, 112, 32, 61, 32, 120,
+112, 44, 32, 42, 95, 121, 112, 32, 61, 32, 121, 112, 59, 32, 92, 10,
+32, 32, 32, 32, 109, 101, 109, 99, 112, 121, 40, 95, 116, 118, 44, 32,
+95, 120, 112, 44, 32, 115, 105, 122, 101, 111, 102, 32, 95, 116, 118,
+41, 59, 32, 92, 10, 32, 32, 32, 32, 109, 101, 109, 99, 112, 121, 40,
+95, 120, 112, 44, 32, 95, 121, 112, 44, 32, 115, 105, 122, 101, 111,
+102, 32, 95, 116, 118, 41, 59, 32, 92, 10, 32, 32, 32, 32, 109, 101,
+109, 99, 112, 121, 40, 95, 121, 112, 44, 32, 95, 116, 118, 44, 32,
+115, 105, 122, 101, 111, 102, 32, 95, 116, 118, 41, 59, 32, 92, 10,
+125, 32, 119, 104, 105, 108, 101, 32, 40, 48, 41, 10, 10, 47, 47, 32,
+103, 101, 116, 32, 110, 101, 120, 116, 32, 112, 111, 119, 101, 114,
+32, 111, 102, 32, 116, 119, 111, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 105, 115, 105, 122, 101, 32, 99, 95, 110, 101, 120, 116,
+95, 112, 111, 119, 50, 40, 105, 115, 105, 122, 101, 32, 110, 41, 32,
+123, 10, 32, 32, 32, 32, 110, 45, 45, 59, 10, 32, 32, 32, 32, 110, 32,
+124, 61, 32, 110, 32, 62, 62, 32, 49, 44, 32, 110, 32, 124, 61, 32,
+110, 32, 62, 62, 32, 50, 59, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32,
+110, 32, 62, 62, 32, 52, 44, 32, 110, 32, 124, 61, 32, 110, 32, 62,
+62, 32, 56, 59, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32, 110, 32, 62,
+62, 32, 49, 54, 59, 10, 32, 32, 32, 32, 35, 105, 102, 32, 73, 78, 84,
+80, 84, 82, 95, 77, 65, 88, 32, 61, 61, 32, 73, 78, 84, 54, 52, 95,
+77, 65, 88, 10, 32, 32, 32, 32, 110, 32, 124, 61, 32, 110, 32, 62, 62,
+32, 51, 50, 59, 10, 32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 32, 43, 32, 49,
+59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 99,
+104, 97, 114, 42, 32, 99, 95, 115, 116, 114, 110, 115, 116, 114, 110,
+40, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 42, 115, 116,
+114, 44, 32, 105, 115, 105, 122, 101, 32, 115, 108, 101, 110, 44, 32,
+99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 32, 42, 110, 101, 101,
+100, 108, 101, 44, 32, 105, 115, 105, 122, 101, 32, 110, 108, 101,
+110, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 110, 108, 101,
+110, 32, 61, 61, 32, 48, 41, 32, 114, 101, 116, 117, 114, 110, 32, 40,
+99, 104, 97, 114, 32, 42, 41, 115, 116, 114, 59, 10, 32, 32, 32, 32,
+105, 102, 32, 40, 110, 108, 101, 110, 32, 62, 32, 115, 108, 101, 110,
+41, 32, 114, 101, 116, 117, 114, 110, 32, 78, 85, 76, 76, 59, 10, 32,
+32, 32, 32, 115, 108, 101, 110, 32, 45, 61, 32, 110, 108, 101, 110,
+59, 10, 32, 32, 32, 32, 100, 111, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 105, 102, 32, 40, 42, 115, 116, 114, 32, 61, 61, 32, 42, 110,
+101, 101, 100, 108, 101, 32, 38, 38, 32, 33, 99, 95, 109, 101, 109,
+99, 109, 112, 40, 115, 116, 114, 44, 32, 110, 101, 101, 100, 108, 101,
+44, 32, 110, 108, 101, 110, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 99, 104, 97,
+114, 32, 42, 41, 115, 116, 114, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 43, 43, 115, 116, 114, 59, 10, 32, 32, 32, 32, 125, 32, 119, 104,
+105, 108, 101, 32, 40, 115, 108, 101, 110, 45, 45, 41, 59, 10, 32, 32,
+32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 85, 76, 76, 59, 10, 125,
+10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95, 67,
+79, 77, 77, 79, 78, 95, 72, 95, 73, 78, 67, 76, 85, 68, 69, 68, 10,
+47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73,
+78, 67, 76, 85, 68, 69, 58, 32, 99, 111, 109, 109, 111, 110, 46, 104,
+10, 47, 47, 32, 69, 88, 67, 76, 85, 68, 69, 68, 32, 66, 89, 32, 114,
+101, 103, 101, 110, 95, 99, 111, 110, 116, 97, 105, 110, 101, 114, 95,
+104, 101, 97, 100, 101, 114, 115, 46, 112, 121, 32, 35, 105, 110, 99,
+108, 117, 100, 101, 32, 60, 115, 116, 100, 108, 105, 98, 46, 104, 62,
+10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 105, 116, 50, 95,
+112, 116, 114, 40, 105, 116, 49, 44, 32, 105, 116, 50, 41, 32, 40,
+105, 116, 49, 46, 114, 101, 102, 32, 38, 38, 32, 33, 105, 116, 50, 46,
+114, 101, 102, 32, 63, 32, 105, 116, 49, 46, 101, 110, 100, 32, 58,
+32, 105, 116, 50, 46, 114, 101, 102, 41, 10, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 116, 95, 112, 116, 114, 40, 105, 116, 41, 32,
+40, 105, 116, 46, 114, 101, 102, 32, 63, 32, 105, 116, 46, 114, 101,
+102, 32, 58, 32, 105, 116, 46, 101, 110, 100, 41, 10, 35, 101, 110,
+100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95, 86, 69, 67, 95, 72, 95,
+73, 78, 67, 76, 85, 68, 69, 68, 10, 10, 35, 105, 102, 110, 100, 101,
+102, 32, 95, 105, 95, 112, 114, 101, 102, 105, 120, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 112, 114, 101, 102,
+105, 120, 32, 118, 101, 99, 95, 10, 35, 101, 110, 100, 105, 102, 10,
+47, 47, 32, 35, 35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69,
+95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 116, 101, 109, 112, 108, 97,
+116, 101, 46, 104, 10, 47, 47, 32, 73, 87, 89, 85, 32, 112, 114, 97,
+103, 109, 97, 58, 32, 112, 114, 105, 118, 97, 116, 101, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 95, 105, 95, 116, 101, 109, 112, 108, 97,
+116, 101, 10, 35, 100, 101, 102, 105, 110, 101, 32, 95, 105, 95, 116,
+101, 109, 112, 108, 97, 116, 101, 10, 10, 35, 105, 102, 110, 100, 101,
+102, 32, 83, 84, 67, 95, 84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95,
+73, 78, 67, 76, 85, 68, 69, 68, 10, 35, 100, 101, 102, 105, 110, 101,
+32, 83, 84, 67, 95, 84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95, 73,
+78, 67, 76, 85, 68, 69, 68, 10, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 110, 97, 109, 101, 41,
+32, 99, 95, 74, 79, 73, 78, 40, 83, 101, 108, 102, 44, 32, 110, 97,
+109, 101, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+99, 95, 68, 69, 70, 84, 89, 80, 69, 83, 40, 109, 97, 99, 114, 111, 44,
+32, 83, 69, 76, 70, 44, 32, 46, 46, 46, 41, 32, 109, 97, 99, 114, 111,
+40, 83, 69, 76, 70, 44, 32, 95, 95, 86, 65, 95, 65, 82, 71, 83, 95,
+95, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 118,
+97, 108, 117, 101, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 109, 95, 107, 101, 121, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 107, 101, 121, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 95, 109, 95, 109, 97, 112, 112, 101, 100, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 109, 97, 112, 112, 101, 100, 41, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 95, 109, 95, 114, 109, 97, 112, 112, 101,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 109, 97, 112, 112,
+101, 100, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+109, 95, 114, 97, 119, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114,
+97, 119, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+109, 95, 107, 101, 121, 114, 97, 119, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 107, 101, 121, 114, 97, 119, 41, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 105, 116, 101, 114, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 95, 109, 95, 114, 101, 115, 117,
+108, 116, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 117,
+108, 116, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 95,
+109, 95, 110, 111, 100, 101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+110, 111, 100, 101, 41, 10, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 102, 108, 97, 103, 41,
+32, 32, 40, 40, 105, 95, 111, 112, 116, 41, 32, 38, 32, 40, 102, 108,
+97, 103, 41, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99,
+95, 100, 101, 99, 108, 97, 114, 101, 100, 32, 32, 32, 32, 32, 32, 40,
+49, 60, 60, 48, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+99, 95, 110, 111, 95, 97, 116, 111, 109, 105, 99, 32, 32, 32, 32, 32,
+40, 49, 60, 60, 49, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 97, 114, 99, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+40, 49, 60, 60, 50, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 99, 95, 110, 111, 95, 99, 108, 111, 110, 101, 32, 32, 32, 32, 32,
+32, 40, 49, 60, 60, 51, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 99, 95, 110, 111, 95, 104, 97, 115, 104, 32, 32, 32, 32, 32,
+32, 32, 40, 49, 60, 60, 52, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 99, 95, 117, 115, 101, 95, 99, 109, 112, 32, 32, 32, 32,
+32, 32, 32, 40, 49, 60, 60, 53, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 99, 95, 117, 115, 101, 95, 101, 113, 32, 32, 32,
+32, 32, 32, 32, 32, 40, 49, 60, 60, 54, 41, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 99, 95, 99, 109, 112, 99, 108, 97, 115, 115,
+32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 55, 41, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 99, 95, 107, 101, 121, 99, 108, 97, 115,
+115, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 56, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 99, 95, 118, 97, 108, 99, 108, 97,
+115, 115, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 57, 41, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 107, 101, 121, 112, 114,
+111, 32, 32, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 49, 48, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 99, 95, 118, 97, 108,
+112, 114, 111, 32, 32, 32, 32, 32, 32, 32, 32, 40, 49, 60, 60, 49, 49,
+41, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 114, 97, 119, 99, 108, 97,
+115, 115, 32, 32, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97,
+116, 101, 100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 105, 95, 114, 97,
+119, 99, 108, 97, 115, 115, 10, 35, 101, 108, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 95, 97, 114, 99,
+98, 111, 120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97,
+116, 101, 100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 107, 101, 121, 112, 114, 111, 32, 105, 95, 107, 101, 121, 95,
+97, 114, 99, 98, 111, 120, 10, 35, 101, 108, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 95, 115, 116,
+114, 32, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116,
+101, 100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105,
+95, 107, 101, 121, 112, 114, 111, 32, 99, 115, 116, 114, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 115,
+116, 114, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 95, 97, 114,
+99, 98, 111, 120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97,
+116, 101, 100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 118, 97, 108, 112, 114, 111, 32, 105, 95, 118, 97, 108, 95,
+97, 114, 99, 98, 111, 120, 10, 35, 101, 108, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 95, 115, 116, 114,
+32, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+118, 97, 108, 112, 114, 111, 32, 99, 115, 116, 114, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 115, 116,
+114, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 84, 32, 38, 38, 32, 33, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 116, 121, 112, 101, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 116, 121, 112, 101, 32,
+84, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 116, 121, 112, 101, 32, 38, 38,
+32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95, 116, 121, 112,
+101, 41, 32, 62, 32, 49, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 83, 101, 108, 102, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 49, 44,
+32, 105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 107, 101, 121, 32, 99, 95, 71, 69, 84, 65,
+82, 71, 40, 50, 44, 32, 105, 95, 116, 121, 112, 101, 41, 10, 32, 32,
+35, 105, 102, 32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95,
+116, 121, 112, 101, 41, 32, 61, 61, 32, 51, 10, 32, 32, 32, 32, 35,
+105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 105,
+115, 95, 109, 97, 112, 10, 32, 32, 32, 32, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 99, 95, 71, 69, 84, 65,
+82, 71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101, 41, 10, 32, 32,
+32, 32, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 111, 112, 116, 32, 99, 95, 71,
+69, 84, 65, 82, 71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101, 41,
+10, 32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 101,
+108, 105, 102, 32, 99, 95, 78, 85, 77, 65, 82, 71, 83, 40, 105, 95,
+116, 121, 112, 101, 41, 32, 61, 61, 32, 52, 10, 32, 32, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 99, 95,
+71, 69, 84, 65, 82, 71, 40, 51, 44, 32, 105, 95, 116, 121, 112, 101,
+41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+111, 112, 116, 32, 99, 95, 71, 69, 84, 65, 82, 71, 40, 52, 44, 32,
+105, 95, 116, 121, 112, 101, 41, 10, 32, 32, 35, 101, 110, 100, 105,
+102, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 83, 101, 108, 102, 32, 38, 38, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 116, 121, 112, 101, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 83, 101, 108, 102, 32, 105, 95, 116, 121, 112,
+101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 83, 101, 108, 102, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 83, 101, 108, 102, 32, 99, 95, 74, 79, 73, 78, 40, 95, 105,
+95, 112, 114, 101, 102, 105, 120, 44, 32, 105, 95, 116, 97, 103, 41,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 99, 95, 79,
+80, 84, 73, 79, 78, 40, 99, 95, 100, 101, 99, 108, 97, 114, 101, 100,
+41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 100,
+101, 99, 108, 97, 114, 101, 100, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 110,
+111, 95, 104, 97, 115, 104, 41, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 110, 111, 95, 104, 97, 115, 104, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79,
+78, 40, 99, 95, 117, 115, 101, 95, 99, 109, 112, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 117, 115, 101, 95, 99, 109,
+112, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95,
+79, 80, 84, 73, 79, 78, 40, 99, 95, 117, 115, 101, 95, 101, 113, 41,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 117, 115,
+101, 95, 101, 113, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102,
+32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 110, 111, 95, 99, 108,
+111, 110, 101, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 105, 95, 105, 115, 95, 97, 114, 99, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110,
+101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95,
+79, 80, 84, 73, 79, 78, 40, 99, 95, 107, 101, 121, 99, 108, 97, 115,
+115, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+107, 101, 121, 99, 108, 97, 115, 115, 32, 105, 95, 107, 101, 121, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84,
+73, 79, 78, 40, 99, 95, 118, 97, 108, 99, 108, 97, 115, 115, 41, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108,
+99, 108, 97, 115, 115, 32, 105, 95, 118, 97, 108, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78,
+40, 99, 95, 99, 109, 112, 99, 108, 97, 115, 115, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97,
+115, 115, 32, 105, 95, 107, 101, 121, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 99, 95, 79, 80, 84, 73,
+79, 78, 40, 99, 95, 107, 101, 121, 112, 114, 111, 41, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 112, 114,
+111, 32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 32, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 118, 97,
+108, 112, 114, 111, 41, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 118, 97, 108, 112, 114, 111, 32, 105, 95, 118, 97, 108,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 112, 114, 111,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101,
+121, 99, 108, 97, 115, 115, 32, 105, 95, 107, 101, 121, 112, 114, 111,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109,
+112, 99, 108, 97, 115, 115, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95,
+107, 101, 121, 112, 114, 111, 44, 32, 95, 114, 97, 119, 41, 10, 35,
+101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+114, 97, 119, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10,
+32, 32, 35, 105, 102, 32, 33, 40, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 107, 101, 121, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 41, 10,
+32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 10, 32,
+32, 35, 101, 110, 100, 105, 102, 10, 35, 101, 108, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 97,
+115, 115, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 47, 47, 32, 83, 112,
+101, 99, 105, 97, 108, 58, 32, 87, 104, 101, 110, 32, 111, 110, 108,
+121, 32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 32, 105, 115,
+32, 100, 101, 102, 105, 110, 101, 100, 44, 32, 97, 108, 115, 111, 32,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97,
+115, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 46,
+10, 32, 32, 47, 47, 32, 68, 111, 32, 110, 111, 116, 32, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32, 104, 101,
+114, 101, 44, 32, 111, 116, 104, 101, 114, 119, 105, 115, 101, 32, 95,
+102, 114, 111, 109, 40, 41, 32, 47, 32, 95, 116, 111, 114, 97, 119,
+40, 41, 32, 105, 115, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32,
+116, 111, 32, 101, 120, 105, 115, 116, 46, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115,
+32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10, 10,
+47, 47, 32, 66, 105, 110, 100, 32, 116, 111, 32, 105, 95, 107, 101,
+121, 32, 34, 99, 108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114,
+115, 34, 58, 32, 95, 99, 108, 111, 110, 101, 44, 32, 95, 100, 114,
+111, 112, 44, 32, 95, 102, 114, 111, 109, 32, 97, 110, 100, 32, 95,
+116, 111, 114, 97, 119, 32, 40, 119, 104, 101, 110, 32, 99, 111, 110,
+100, 105, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 109, 101,
+116, 41, 46, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 10, 32, 32, 35,
+105, 102, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+32, 105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 10, 32, 32, 35,
+101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 99, 108, 111,
+110, 101, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 99, 108,
+111, 110, 101, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101, 121,
+99, 108, 97, 115, 115, 44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32,
+32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 10, 32, 32,
+32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121,
+100, 114, 111, 112, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101,
+121, 99, 108, 97, 115, 115, 44, 32, 95, 100, 114, 111, 112, 41, 10,
+32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 102,
+114, 111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 102, 114, 111,
+109, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 107, 101, 121, 99, 108,
+97, 115, 115, 44, 32, 95, 102, 114, 111, 109, 41, 10, 32, 32, 35, 101,
+108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+107, 101, 121, 102, 114, 111, 109, 32, 38, 38, 32, 33, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101,
+10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+107, 101, 121, 102, 114, 111, 109, 32, 99, 95, 74, 79, 73, 78, 40,
+105, 95, 107, 101, 121, 99, 108, 97, 115, 115, 44, 32, 95, 99, 108,
+111, 110, 101, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32,
+32, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105,
+95, 107, 101, 121, 116, 111, 114, 97, 119, 32, 38, 38, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10,
+32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 116, 111, 114, 97, 119, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 107, 101, 121, 99, 108, 97, 115, 115, 44, 32, 95, 116, 111, 114,
+97, 119, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 47, 47, 32, 68, 101, 102, 105, 110, 101,
+32, 119, 104, 101, 110, 32, 99, 111, 110, 116, 97, 105, 110, 101, 114,
+32, 104, 97, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+114, 32, 115, 111, 114, 116, 105, 110, 103, 32, 40, 99, 109, 112, 41,
+32, 97, 110, 100, 32, 108, 105, 110, 101, 97, 114, 32, 115, 101, 97,
+114, 99, 104, 32, 40, 101, 113, 41, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112,
+32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99,
+109, 112, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 108, 101, 115, 115, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 35, 101,
+110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 32, 124, 124,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117,
+115, 101, 95, 101, 113, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 101, 113, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 47, 47, 32, 66, 105, 110, 100, 32, 116,
+111, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 34, 99,
+108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114, 115, 34, 58, 32,
+95, 99, 109, 112, 44, 32, 95, 101, 113, 32, 97, 110, 100, 32, 95, 104,
+97, 115, 104, 32, 40, 119, 104, 101, 110, 32, 99, 111, 110, 100, 105,
+116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 109, 101, 116, 41, 46,
+10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+99, 109, 112, 99, 108, 97, 115, 115, 10, 32, 32, 35, 105, 102, 32, 33,
+40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 108,
+101, 115, 115, 41, 32, 38, 38, 32, 40, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 117, 115, 101, 95, 99, 109, 112, 32, 124, 124, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 115, 111, 114,
+116, 101, 100, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 105, 95, 99, 109, 112, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 99, 109, 112, 99, 108, 97, 115, 115, 44, 32, 95, 99, 109, 112, 41,
+10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32,
+33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101, 113, 32, 38,
+38, 32, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117, 115,
+101, 95, 101, 113, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 104, 97, 115, 104, 32, 124, 124, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95, 104, 97, 115, 104,
+41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95,
+101, 113, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 99, 109, 112, 99,
+108, 97, 115, 115, 44, 32, 95, 101, 113, 41, 10, 32, 32, 35, 101, 110,
+100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 40, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 104, 97, 115, 104, 32, 124, 124, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 104, 97,
+115, 104, 41, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 104, 97, 115, 104, 32, 99, 95, 74, 79, 73, 78, 40, 105,
+95, 99, 109, 112, 99, 108, 97, 115, 115, 44, 32, 95, 104, 97, 115,
+104, 41, 10, 32, 32, 35, 101, 110, 100, 105, 102, 10, 35, 101, 110,
+100, 105, 102, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 107, 101, 121, 10, 32, 32, 35, 101, 114, 114,
+111, 114, 32, 34, 78, 111, 32, 105, 95, 107, 101, 121, 32, 100, 101,
+102, 105, 110, 101, 100, 34, 10, 35, 101, 108, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32,
+38, 38, 32, 33, 40, 99, 95, 79, 80, 84, 73, 79, 78, 40, 99, 95, 99,
+109, 112, 99, 108, 97, 115, 115, 41, 32, 124, 124, 32, 100, 101, 102,
+105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97,
+119, 41, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 73, 102, 32,
+105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 47, 32, 105, 95,
+107, 101, 121, 114, 97, 119, 32, 105, 115, 32, 100, 101, 102, 105,
+110, 101, 100, 44, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119,
+32, 109, 117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 116, 111, 111, 34, 10, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108, 111,
+110, 101, 32, 38, 38, 32, 40, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 94, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 100, 114, 111,
+112, 41, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 66, 111,
+116, 104, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 97,
+110, 100, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 32, 109,
+117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 44,
+32, 105, 102, 32, 97, 110, 121, 32, 40, 117, 110, 108, 101, 115, 115,
+32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 32, 100, 101, 102,
+105, 110, 101, 100, 41, 46, 34, 10, 35, 101, 108, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 102, 114, 111, 109, 32,
+124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 100,
+114, 111, 112, 10, 32, 32, 35, 101, 114, 114, 111, 114, 32, 34, 105,
+95, 102, 114, 111, 109, 32, 47, 32, 105, 95, 100, 114, 111, 112, 32,
+110, 111, 116, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 46,
+32, 85, 115, 101, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 47,
+105, 95, 107, 101, 121, 100, 114, 111, 112, 34, 10, 35, 101, 108, 105,
+102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101,
+121, 116, 111, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 118, 97, 108, 116, 111, 10, 32, 32, 35, 101, 114, 114,
+111, 114, 32, 105, 95, 107, 101, 121, 116, 111, 32, 47, 32, 105, 95,
+118, 97, 108, 116, 111, 32, 110, 111, 116, 32, 115, 117, 112, 112,
+111, 114, 116, 101, 100, 46, 32, 85, 115, 101, 32, 105, 95, 107, 101,
+121, 116, 111, 114, 97, 119, 32, 47, 32, 105, 95, 118, 97, 108, 116,
+111, 114, 97, 119, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32, 38, 38,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 117, 115, 101, 95,
+99, 109, 112, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100,
+32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 32, 32, 35, 101,
+114, 114, 111, 114, 32, 34, 70, 111, 114, 32, 115, 109, 97, 112, 32,
+47, 32, 115, 115, 101, 116, 32, 47, 32, 112, 113, 117, 101, 117, 101,
+44, 32, 105, 95, 99, 109, 112, 32, 111, 114, 32, 105, 95, 108, 101,
+115, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 119, 104, 101, 110, 32, 105, 95, 107, 101, 121,
+114, 97, 119, 32, 105, 115, 32, 100, 101, 102, 105, 110, 101, 100, 46,
+34, 10, 35, 101, 110, 100, 105, 102, 10, 10, 47, 47, 32, 70, 105, 108,
+108, 32, 105, 110, 32, 109, 105, 115, 115, 105, 110, 103, 32, 105, 95,
+101, 113, 44, 32, 105, 95, 108, 101, 115, 115, 44, 32, 105, 95, 99,
+109, 112, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119,
+105, 116, 104, 32, 100, 101, 102, 97, 117, 108, 116, 115, 46, 10, 35,
+105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101,
+113, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+99, 109, 112, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105,
+95, 101, 113, 40, 120, 44, 32, 121, 41, 32, 40, 105, 95, 99, 109, 112,
+40, 120, 44, 32, 121, 41, 41, 32, 61, 61, 32, 48, 10, 35, 101, 108,
+105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 101,
+113, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 101,
+113, 40, 120, 44, 32, 121, 41, 32, 42, 120, 32, 61, 61, 32, 42, 121,
+32, 47, 47, 32, 119, 111, 114, 107, 115, 32, 102, 111, 114, 32, 105,
+110, 116, 101, 103, 114, 97, 108, 32, 116, 121, 112, 101, 115, 10, 35,
+101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 32, 38, 38, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 99, 109, 112, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 108, 101, 115, 115, 40,
+120, 44, 32, 121, 41, 32, 40, 105, 95, 99, 109, 112, 40, 120, 44, 32,
+121, 41, 41, 32, 60, 32, 48, 10, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 108, 101, 115, 115,
+40, 120, 44, 32, 121, 41, 32, 42, 120, 32, 60, 32, 42, 121, 32, 47,
+47, 32, 119, 111, 114, 107, 115, 32, 102, 111, 114, 32, 105, 110, 116,
+101, 103, 114, 97, 108, 32, 116, 121, 112, 101, 115, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 99, 109, 112, 32, 38, 38, 32, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 108, 101, 115, 115, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 99, 109, 112, 40, 120, 44, 32,
+121, 41, 32, 40, 105, 95, 108, 101, 115, 115, 40, 121, 44, 32, 120,
+41, 41, 32, 45, 32, 40, 105, 95, 108, 101, 115, 115, 40, 120, 44, 32,
+121, 41, 41, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32,
+33, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 104, 97, 115,
+104, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95,
+110, 111, 95, 104, 97, 115, 104, 41, 10, 32, 32, 35, 100, 101, 102,
+105, 110, 101, 32, 105, 95, 104, 97, 115, 104, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 104, 97, 115, 104, 10, 35, 101, 110, 100,
+105, 102, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 110,
+111, 95, 101, 109, 112, 108, 97, 99, 101, 10, 10, 35, 105, 102, 110,
+100, 101, 102, 32, 105, 95, 116, 97, 103, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 116, 97, 103, 32, 105, 95, 107, 101,
+121, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 102, 114,
+111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105,
+95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 38, 38, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 107, 101, 121, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107,
+101, 121, 102, 114, 111, 109, 32, 105, 95, 107, 101, 121, 99, 108,
+111, 110, 101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 102,
+114, 111, 109, 32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 99,
+108, 111, 110, 101, 10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97,
+99, 101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 114, 97,
+119, 32, 105, 95, 107, 101, 121, 10, 35, 101, 110, 100, 105, 102, 10,
+35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 116,
+111, 114, 97, 119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 116, 111, 114, 97, 119, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 107,
+101, 121, 99, 108, 111, 110, 101, 10, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 32, 99,
+95, 100, 101, 102, 97, 117, 108, 116, 95, 99, 108, 111, 110, 101, 10,
+35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32,
+105, 95, 107, 101, 121, 100, 114, 111, 112, 10, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112,
+32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 100, 114, 111, 112,
+10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 100, 101,
+102, 105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95, 109, 97, 112,
+32, 47, 47, 32, 45, 45, 45, 45, 32, 112, 114, 111, 99, 101, 115, 115,
+32, 104, 97, 115, 104, 109, 97, 112, 47, 115, 111, 114, 116, 101, 100,
+109, 97, 112, 32, 118, 97, 108, 117, 101, 32, 105, 95, 118, 97, 108,
+44, 32, 46, 46, 46, 32, 45, 45, 45, 45, 10, 10, 35, 105, 102, 32, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 112, 114,
+111, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 99, 108, 97, 115, 115, 32, 105, 95, 118, 97, 108, 112, 114,
+111, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 114, 97, 119, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118,
+97, 108, 112, 114, 111, 44, 32, 95, 114, 97, 119, 41, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 105, 95,
+118, 97, 108, 99, 108, 97, 115, 115, 10, 32, 32, 35, 105, 102, 110,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 105, 95, 118,
+97, 108, 99, 108, 97, 115, 115, 10, 32, 32, 35, 101, 110, 100, 105,
+102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 38, 38,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95,
+99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105,
+110, 101, 32, 105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 99,
+95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115, 115,
+44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32, 32, 35, 101, 110, 100,
+105, 102, 10, 32, 32, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95,
+118, 97, 108, 100, 114, 111, 112, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 32,
+99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115,
+115, 44, 32, 95, 100, 114, 111, 112, 41, 10, 32, 32, 35, 101, 110,
+100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 32, 38,
+38, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108,
+114, 97, 119, 10, 32, 32, 32, 32, 35, 100, 101, 102, 105, 110, 101,
+32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 32, 99, 95, 74, 79, 73,
+78, 40, 105, 95, 118, 97, 108, 99, 108, 97, 115, 115, 44, 32, 95, 102,
+114, 111, 109, 41, 10, 32, 32, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 32, 32, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99,
+108, 97, 115, 115, 44, 32, 95, 99, 108, 111, 110, 101, 41, 10, 32, 32,
+35, 101, 110, 100, 105, 102, 10, 32, 32, 35, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 116, 111,
+114, 97, 119, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 32, 32, 35, 100, 101,
+102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97, 119,
+32, 99, 95, 74, 79, 73, 78, 40, 105, 95, 118, 97, 108, 99, 108, 97,
+115, 115, 44, 32, 95, 116, 111, 114, 97, 119, 41, 10, 32, 32, 35, 101,
+110, 100, 105, 102, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 35,
+101, 114, 114, 111, 114, 32, 34, 105, 95, 118, 97, 108, 42, 32, 109,
+117, 115, 116, 32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+102, 111, 114, 32, 109, 97, 112, 115, 34, 10, 35, 101, 108, 105, 102,
+32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 114,
+97, 119, 32, 38, 38, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 116, 111, 114, 97, 119, 10, 32, 32, 35, 101,
+114, 114, 111, 114, 32, 34, 73, 102, 32, 105, 95, 118, 97, 108, 114,
+97, 119, 32, 105, 115, 32, 100, 101, 102, 105, 110, 101, 100, 44, 32,
+105, 95, 118, 97, 108, 116, 111, 114, 97, 119, 32, 109, 117, 115, 116,
+32, 98, 101, 32, 100, 101, 102, 105, 110, 101, 100, 32, 116, 111, 111,
+34, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 32, 38, 38,
+32, 40, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108,
+99, 108, 111, 110, 101, 32, 94, 32, 100, 101, 102, 105, 110, 101, 100,
+32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 41, 10, 32, 32, 35,
+101, 114, 114, 111, 114, 32, 34, 66, 111, 116, 104, 32, 105, 95, 118,
+97, 108, 99, 108, 111, 110, 101, 32, 97, 110, 100, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 32, 109, 117, 115, 116, 32, 98, 101, 32,
+100, 101, 102, 105, 110, 101, 100, 44, 32, 105, 102, 32, 97, 110, 121,
+34, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 102,
+114, 111, 109, 32, 38, 38, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 38, 38, 32, 33,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 118, 97, 108, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 102, 114, 111, 109, 32, 105, 95, 118, 97, 108, 99, 108, 111,
+110, 101, 10, 35, 101, 108, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 102, 114,
+111, 109, 32, 99, 95, 100, 101, 102, 97, 117, 108, 116, 95, 99, 108,
+111, 110, 101, 10, 35, 101, 108, 115, 101, 10, 32, 32, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97, 99,
+101, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100, 101,
+102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 114, 97, 119, 32,
+105, 95, 118, 97, 108, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105,
+102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97,
+119, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 118,
+97, 108, 116, 111, 114, 97, 119, 32, 99, 95, 100, 101, 102, 97, 117,
+108, 116, 95, 116, 111, 114, 97, 119, 10, 35, 101, 110, 100, 105, 102,
+10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 99,
+108, 111, 110, 101, 10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32,
+105, 95, 118, 97, 108, 99, 108, 111, 110, 101, 32, 99, 95, 100, 101,
+102, 97, 117, 108, 116, 95, 99, 108, 111, 110, 101, 10, 35, 101, 110,
+100, 105, 102, 10, 35, 105, 102, 110, 100, 101, 102, 32, 105, 95, 118,
+97, 108, 100, 114, 111, 112, 10, 32, 32, 35, 100, 101, 102, 105, 110,
+101, 32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 32, 99, 95, 100,
+101, 102, 97, 117, 108, 116, 95, 100, 114, 111, 112, 10, 35, 101, 110,
+100, 105, 102, 10, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32,
+33, 95, 105, 95, 105, 115, 95, 109, 97, 112, 10, 10, 35, 105, 102,
+110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 32, 32, 35, 100,
+101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 32, 105, 95, 107,
+101, 121, 10, 35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 110, 100,
+101, 102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 118, 97, 108, 114, 97, 119,
+32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 35, 101, 110, 100, 105,
+102, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 83, 84, 67, 95,
+84, 69, 77, 80, 76, 65, 84, 69, 95, 72, 95, 73, 78, 67, 76, 85, 68,
+69, 68, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76,
+69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 116, 101, 109, 112, 108,
+97, 116, 101, 46, 104, 10, 10, 35, 105, 102, 110, 100, 101, 102, 32,
+105, 95, 100, 101, 99, 108, 97, 114, 101, 100, 10, 32, 32, 32, 95, 99,
+95, 68, 69, 70, 84, 89, 80, 69, 83, 40, 100, 101, 99, 108, 97, 114,
+101, 95, 118, 101, 99, 44, 32, 83, 101, 108, 102, 44, 32, 105, 95,
+107, 101, 121, 41, 59, 10, 35, 101, 110, 100, 105, 102, 10, 116, 121,
+112, 101, 100, 101, 102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 32,
+95, 109, 95, 114, 97, 119, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32,
+118, 111, 105, 100, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111, 112, 41, 40, 99,
+111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 99, 115, 101, 108,
+102, 41, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32, 118, 111, 105, 100,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 99, 108, 101, 97, 114, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 41, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32,
+95, 66, 111, 111, 108, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101,
+41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 105,
+115, 105, 122, 101, 32, 99, 97, 112, 41, 59, 10, 83, 84, 67, 95, 65,
+80, 73, 32, 95, 66, 111, 111, 108, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 105,
+122, 101, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 105, 115, 105, 122, 101, 32, 115, 105, 122, 101, 44, 32, 95, 109,
+95, 118, 97, 108, 117, 101, 32, 110, 117, 108, 108, 41, 59, 10, 83,
+84, 67, 95, 65, 80, 73, 32, 95, 109, 95, 105, 116, 101, 114, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101,
+114, 97, 115, 101, 95, 110, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32, 105, 100, 120, 44,
+32, 105, 115, 105, 122, 101, 32, 110, 41, 59, 10, 83, 84, 67, 95, 65,
+80, 73, 32, 95, 109, 95, 105, 116, 101, 114, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101,
+114, 116, 95, 117, 110, 105, 110, 105, 116, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32, 105,
+100, 120, 44, 32, 105, 115, 105, 122, 101, 32, 110, 41, 59, 10, 35,
+105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 104,
+97, 115, 95, 101, 113, 10, 83, 84, 67, 95, 65, 80, 73, 32, 95, 109,
+95, 105, 116, 101, 114, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 102, 105, 110, 100, 95, 105, 110, 41, 40,
+99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108,
+102, 44, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 49, 44,
+32, 95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 50, 44, 32, 95,
+109, 95, 114, 97, 119, 32, 114, 97, 119, 41, 59, 10, 35, 101, 110,
+100, 105, 102, 32, 47, 47, 32, 95, 105, 95, 104, 97, 115, 95, 101,
+113, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111,
+105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117,
+101, 95, 100, 114, 111, 112, 41, 40, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118,
+97, 108, 117, 101, 42, 32, 118, 97, 108, 41, 10, 32, 32, 32, 32, 123,
+32, 40, 118, 111, 105, 100, 41, 115, 101, 108, 102, 59, 32, 105, 95,
+107, 101, 121, 100, 114, 111, 112, 40, 118, 97, 108, 41, 59, 32, 125,
+10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 83, 101, 108, 102,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 109, 111, 118, 101, 41, 40,
+83, 101, 108, 102, 32, 42, 115, 101, 108, 102, 41, 32, 123, 10, 32,
+32, 32, 32, 83, 101, 108, 102, 32, 109, 32, 61, 32, 42, 115, 101, 108,
+102, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 45, 62, 99, 97, 112,
+97, 99, 105, 116, 121, 32, 61, 32, 115, 101, 108, 102, 45, 62, 115,
+105, 122, 101, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 32, 61, 32, 78, 85, 76, 76, 59, 10, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 116, 97, 107, 101, 41, 40, 83,
+101, 108, 102, 32, 42, 115, 101, 108, 102, 44, 32, 83, 101, 108, 102,
+32, 117, 110, 111, 119, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111, 112, 41, 40,
+115, 101, 108, 102, 41, 59, 10, 32, 32, 32, 32, 42, 115, 101, 108,
+102, 32, 61, 32, 117, 110, 111, 119, 110, 101, 100, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 118, 97,
+108, 117, 101, 42, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112, 117,
+115, 104, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 118, 97, 108, 117, 101,
+41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 32, 61, 61, 32, 115, 101, 108, 102, 45,
+62, 99, 97, 112, 97, 99, 105, 116, 121, 41, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 105, 102, 32, 40, 33, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+114, 101, 115, 101, 114, 118, 101, 41, 40, 115, 101, 108, 102, 44, 32,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 42, 50, 32, 43, 32,
+52, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 78, 85, 76, 76, 59, 10, 32, 32, 32, 32,
+95, 109, 95, 118, 97, 108, 117, 101, 32, 42, 118, 32, 61, 32, 115,
+101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 43, 43, 59, 10, 32, 32, 32, 32, 42,
+118, 32, 61, 32, 118, 97, 108, 117, 101, 59, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 118, 59, 10, 125, 10, 10, 83, 84, 67, 95,
+73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 112, 117, 116, 95, 110, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 95,
+109, 95, 114, 97, 119, 42, 32, 114, 97, 119, 44, 32, 105, 115, 105,
+122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32, 119, 104, 105,
+108, 101, 32, 40, 110, 45, 45, 41, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 112, 117, 115, 104, 41, 40, 115, 101, 108, 102, 44, 32, 105, 95,
+107, 101, 121, 102, 114, 111, 109, 40, 40, 42, 114, 97, 119, 41, 41,
+41, 44, 32, 43, 43, 114, 97, 119, 59, 32, 125, 10, 10, 35, 105, 102,
+32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95,
+101, 109, 112, 108, 97, 99, 101, 10, 83, 84, 67, 95, 65, 80, 73, 32,
+95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 101, 109, 112, 108, 97, 99, 101, 95, 110, 41, 40, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32,
+105, 100, 120, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114,
+97, 119, 32, 114, 97, 119, 91, 93, 44, 32, 105, 115, 105, 122, 101,
+32, 110, 41, 59, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32,
+95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 101, 109, 112, 108, 97, 99, 101, 41, 40, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 114, 97, 119,
+32, 114, 97, 119, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101, 116, 117,
+114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112, 117, 115, 104,
+41, 40, 115, 101, 108, 102, 44, 32, 105, 95, 107, 101, 121, 102, 114,
+111, 109, 40, 114, 97, 119, 41, 41, 59, 32, 125, 10, 10, 83, 84, 67,
+95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 118, 97, 108, 117, 101,
+42, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 109, 112, 108, 97,
+99, 101, 95, 98, 97, 99, 107, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 44, 32, 95, 109, 95, 114, 97, 119, 32, 114, 97, 119,
+41, 10, 32, 32, 32, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 112, 117, 115, 104, 41, 40, 115, 101,
+108, 102, 44, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 40, 114,
+97, 119, 41, 41, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 101, 109, 112, 108, 97, 99, 101, 95, 97, 116, 41, 40,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95,
+105, 116, 101, 114, 32, 105, 116, 44, 32, 95, 109, 95, 114, 97, 119,
+32, 114, 97, 119, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101, 116, 117,
+114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 109, 112, 108,
+97, 99, 101, 95, 110, 41, 40, 115, 101, 108, 102, 44, 32, 95, 105,
+116, 95, 112, 116, 114, 40, 105, 116, 41, 32, 45, 32, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 44, 32, 38, 114, 97, 119, 44, 32, 49,
+41, 59, 32, 125, 10, 35, 101, 110, 100, 105, 102, 32, 47, 47, 32, 33,
+105, 95, 110, 111, 95, 101, 109, 112, 108, 97, 99, 101, 10, 10, 35,
+105, 102, 32, 33, 100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 110,
+111, 95, 99, 108, 111, 110, 101, 10, 83, 84, 67, 95, 65, 80, 73, 32,
+118, 111, 105, 100, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 111, 112, 121, 41, 40, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115,
+116, 32, 83, 101, 108, 102, 42, 32, 111, 116, 104, 101, 114, 41, 59,
+10, 83, 84, 67, 95, 65, 80, 73, 32, 95, 109, 95, 105, 116, 101, 114,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 99, 111, 112, 121, 95, 116, 111, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32, 105, 100,
+120, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 32, 97, 114, 114, 91, 93, 44, 32, 105, 115, 105, 122, 101,
+32, 110, 41, 59, 10, 83, 84, 67, 95, 65, 80, 73, 32, 83, 101, 108,
+102, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 99, 108, 111, 110, 101, 41, 40, 83, 101, 108, 102,
+32, 118, 101, 99, 41, 59, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69,
+32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 99, 108, 111,
+110, 101, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117, 101,
+32, 118, 97, 108, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+123, 32, 40, 118, 111, 105, 100, 41, 115, 101, 108, 102, 59, 32, 114,
+101, 116, 117, 114, 110, 32, 105, 95, 107, 101, 121, 99, 108, 111,
+110, 101, 40, 118, 97, 108, 41, 59, 32, 125, 10, 35, 101, 110, 100,
+105, 102, 32, 47, 47, 32, 33, 105, 95, 110, 111, 95, 99, 108, 111,
+110, 101, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 105,
+115, 105, 122, 101, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 115, 105, 122, 101, 41, 40, 99, 111, 110, 115,
+116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123,
+32, 114, 101, 116, 117, 114, 110, 32, 115, 101, 108, 102, 45, 62, 115,
+105, 122, 101, 59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78,
+69, 32, 105, 115, 105, 122, 101, 32, 32, 32, 32, 32, 32, 32, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 99, 97, 112, 97, 99, 105, 116, 121,
+41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 115,
+101, 108, 102, 45, 62, 99, 97, 112, 97, 99, 105, 116, 121, 59, 32,
+125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 66, 111, 111,
+108, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 105, 115, 95, 101, 109, 112, 116, 121, 41, 40, 99, 111, 110,
+115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32,
+123, 32, 114, 101, 116, 117, 114, 110, 32, 33, 115, 101, 108, 102, 45,
+62, 115, 105, 122, 101, 59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76,
+73, 78, 69, 32, 95, 109, 95, 114, 97, 119, 32, 32, 32, 32, 32, 32, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 118, 97, 108, 117, 101, 95, 116,
+111, 114, 97, 119, 41, 40, 99, 111, 110, 115, 116, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 32, 118, 97, 108, 41, 32, 123, 32, 114,
+101, 116, 117, 114, 110, 32, 105, 95, 107, 101, 121, 116, 111, 114,
+97, 119, 40, 118, 97, 108, 41, 59, 32, 125, 10, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118,
+97, 108, 117, 101, 42, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+102, 114, 111, 110, 116, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101,
+108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123, 32, 114, 101, 116,
+117, 114, 110, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 59,
+32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 102, 114, 111, 110, 116, 95, 109, 117,
+116, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32,
+123, 32, 114, 101, 116, 117, 114, 110, 32, 115, 101, 108, 102, 45, 62,
+100, 97, 116, 97, 59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78,
+69, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108, 117,
+101, 42, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 97, 99, 107,
+41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 38,
+115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 91, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 32, 45, 32, 49, 93, 59, 32, 125, 10, 83,
+84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 98, 97, 99, 107, 95, 109, 117, 116, 41, 40, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 41, 32, 123, 32, 114, 101, 116, 117,
+114, 110, 32, 38, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 91,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 45, 32, 49, 93,
+59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118,
+111, 105, 100, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 112, 111, 112, 41, 40, 83, 101, 108, 102, 42, 32, 115,
+101, 108, 102, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+32, 99, 95, 97, 115, 115, 101, 114, 116, 40, 115, 101, 108, 102, 45,
+62, 115, 105, 122, 101, 41, 59, 32, 95, 109, 95, 118, 97, 108, 117,
+101, 42, 32, 112, 32, 61, 32, 38, 115, 101, 108, 102, 45, 62, 100, 97,
+116, 97, 91, 45, 45, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101,
+93, 59, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 40, 112, 41,
+59, 32, 125, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109,
+95, 118, 97, 108, 117, 101, 32, 32, 32, 32, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 112, 117, 108, 108, 41, 40, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 123, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 41, 59, 32, 114, 101, 116, 117, 114,
+110, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 91, 45, 45,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 93, 59, 32, 125, 10,
+83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112,
+117, 115, 104, 95, 98, 97, 99, 107, 41, 40, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 44, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32,
+118, 97, 108, 117, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 112, 117, 115, 104, 41, 40, 115, 101, 108, 102, 44,
+32, 118, 97, 108, 117, 101, 41, 59, 32, 125, 10, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112, 111, 112, 95, 98,
+97, 99, 107, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102,
+41, 32, 123, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 112, 111, 112,
+41, 40, 115, 101, 108, 102, 41, 59, 32, 125, 10, 10, 35, 105, 102,
+110, 100, 101, 102, 32, 105, 95, 97, 117, 120, 10, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 105, 110, 105, 116, 41, 40, 118, 111, 105, 100, 41, 10,
+32, 32, 32, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 99, 95,
+108, 105, 116, 101, 114, 97, 108, 40, 83, 101, 108, 102, 41, 123, 48,
+125, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32,
+83, 101, 108, 102, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 119, 105,
+116, 104, 95, 115, 105, 122, 101, 41, 40, 99, 111, 110, 115, 116, 32,
+105, 115, 105, 122, 101, 32, 115, 105, 122, 101, 44, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32,
+32, 32, 32, 83, 101, 108, 102, 32, 99, 120, 32, 61, 32, 123, 48, 125,
+59, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101,
+115, 105, 122, 101, 41, 40, 38, 99, 120, 44, 32, 115, 105, 122, 101,
+44, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 99, 120, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73,
+78, 76, 73, 78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 119, 105, 116, 104, 95, 99, 97, 112, 97, 99, 105, 116,
+121, 41, 40, 99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32,
+99, 97, 112, 41, 32, 123, 10, 32, 32, 32, 32, 83, 101, 108, 102, 32,
+99, 120, 32, 61, 32, 123, 48, 125, 59, 10, 32, 32, 32, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40, 38,
+99, 120, 44, 32, 99, 97, 112, 41, 59, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 99, 120, 59, 10, 125, 10, 10, 83, 84, 67, 95,
+73, 78, 76, 73, 78, 69, 32, 83, 101, 108, 102, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 102, 114, 111, 109, 95, 110, 41, 40, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 114, 97, 119, 42, 32, 114, 97, 119, 44, 32,
+105, 115, 105, 122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32, 83,
+101, 108, 102, 32, 99, 120, 32, 61, 32, 123, 48, 125, 59, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 112, 117, 116, 95, 110, 41, 40, 38, 99,
+120, 44, 32, 114, 97, 119, 44, 32, 110, 41, 59, 32, 114, 101, 116,
+117, 114, 110, 32, 99, 120, 59, 32, 125, 10, 35, 101, 110, 100, 105,
+102, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111,
+105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 104, 114, 105,
+110, 107, 95, 116, 111, 95, 102, 105, 116, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 41, 32, 123, 10, 32, 32, 32, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40,
+115, 101, 108, 102, 44, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115,
+105, 122, 101, 41, 40, 115, 101, 108, 102, 41, 41, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116,
+101, 114, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101,
+114, 116, 95, 110, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108,
+102, 44, 32, 99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32,
+105, 100, 120, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118,
+97, 108, 117, 101, 32, 97, 114, 114, 91, 93, 44, 32, 99, 111, 110,
+115, 116, 32, 105, 115, 105, 122, 101, 32, 110, 41, 32, 123, 10, 32,
+32, 32, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 32, 61, 32,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 95,
+117, 110, 105, 110, 105, 116, 41, 40, 115, 101, 108, 102, 44, 32, 105,
+100, 120, 44, 32, 110, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40,
+105, 116, 46, 114, 101, 102, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+99, 95, 109, 101, 109, 99, 112, 121, 40, 105, 116, 46, 114, 101, 102,
+44, 32, 97, 114, 114, 44, 32, 110, 42, 99, 95, 115, 105, 122, 101,
+111, 102, 32, 42, 97, 114, 114, 41, 59, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 105, 116, 59, 10, 125, 10, 10, 83, 84, 67, 95,
+73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 95, 97,
+116, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32,
+95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 44, 32, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 118, 97, 108,
+117, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114,
+110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114,
+116, 95, 110, 41, 40, 115, 101, 108, 102, 44, 32, 95, 105, 116, 95,
+112, 116, 114, 40, 105, 116, 41, 32, 45, 32, 115, 101, 108, 102, 45,
+62, 100, 97, 116, 97, 44, 32, 38, 118, 97, 108, 117, 101, 44, 32, 49,
+41, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32,
+95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 101, 114, 97, 115, 101, 95, 97, 116, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 105, 116, 101, 114,
+32, 105, 116, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 114, 97, 115,
+101, 95, 110, 41, 40, 115, 101, 108, 102, 44, 32, 105, 116, 46, 114,
+101, 102, 32, 45, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97,
+44, 32, 49, 41, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 101, 114, 97, 115, 101, 95, 114, 97, 110, 103, 101,
+41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 95,
+109, 95, 105, 116, 101, 114, 32, 105, 49, 44, 32, 95, 109, 95, 105,
+116, 101, 114, 32, 105, 50, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 114,
+97, 115, 101, 95, 110, 41, 40, 115, 101, 108, 102, 44, 32, 105, 49,
+46, 114, 101, 102, 32, 45, 32, 115, 101, 108, 102, 45, 62, 100, 97,
+116, 97, 44, 32, 95, 105, 116, 50, 95, 112, 116, 114, 40, 105, 49, 44,
+32, 105, 50, 41, 32, 45, 32, 105, 49, 46, 114, 101, 102, 41, 59, 10,
+125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 97, 116, 41, 40, 99, 111, 110, 115, 116, 32,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110,
+115, 116, 32, 105, 115, 105, 122, 101, 32, 105, 100, 120, 41, 32, 123,
+10, 32, 32, 32, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40, 99, 95,
+117, 108, 101, 115, 115, 40, 105, 100, 120, 44, 32, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 41, 41, 59, 32, 114, 101, 116, 117,
+114, 110, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43,
+32, 105, 100, 120, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76,
+73, 78, 69, 32, 95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 95, 99,
+95, 77, 69, 77, 66, 40, 95, 97, 116, 95, 109, 117, 116, 41, 40, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115,
+116, 32, 105, 115, 105, 122, 101, 32, 105, 100, 120, 41, 32, 123, 10,
+32, 32, 32, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40, 99, 95, 117,
+108, 101, 115, 115, 40, 105, 100, 120, 44, 32, 115, 101, 108, 102, 45,
+62, 115, 105, 122, 101, 41, 41, 59, 32, 114, 101, 116, 117, 114, 110,
+32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 105,
+100, 120, 59, 10, 125, 10, 10, 47, 47, 32, 105, 116, 101, 114, 97,
+116, 105, 111, 110, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69,
+32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 98, 101, 103, 105, 110, 41, 40, 99, 111, 110, 115, 116, 32,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123, 10, 32,
+32, 32, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 32, 61, 32,
+123, 40, 95, 109, 95, 118, 97, 108, 117, 101, 42, 41, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 44, 32, 40, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 41, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 125,
+59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62,
+115, 105, 122, 101, 41, 32, 105, 116, 46, 101, 110, 100, 32, 43, 61,
+32, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 59, 10, 32, 32,
+32, 32, 101, 108, 115, 101, 32, 105, 116, 46, 114, 101, 102, 32, 61,
+32, 78, 85, 76, 76, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114,
+110, 32, 105, 116, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76,
+73, 78, 69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 114, 98, 101, 103, 105, 110, 41, 40, 99, 111, 110,
+115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32,
+123, 10, 32, 32, 32, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105,
+116, 32, 61, 32, 123, 40, 95, 109, 95, 118, 97, 108, 117, 101, 42, 41,
+115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 44, 32, 40, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 41, 115, 101, 108, 102, 45, 62, 100, 97,
+116, 97, 125, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 41, 32, 123, 32, 105, 116, 46, 114,
+101, 102, 32, 43, 61, 32, 115, 101, 108, 102, 45, 62, 115, 105, 122,
+101, 32, 45, 32, 49, 59, 32, 105, 116, 46, 101, 110, 100, 32, 45, 61,
+32, 49, 59, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 32, 105,
+116, 46, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76, 59, 10, 32, 32,
+32, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116,
+101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 110, 100, 41,
+40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101,
+108, 102, 41, 10, 32, 32, 32, 32, 123, 32, 40, 118, 111, 105, 100, 41,
+115, 101, 108, 102, 59, 32, 95, 109, 95, 105, 116, 101, 114, 32, 105,
+116, 32, 61, 32, 123, 48, 125, 59, 32, 114, 101, 116, 117, 114, 110,
+32, 105, 116, 59, 32, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78,
+69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 114, 101, 110, 100, 41, 40, 99, 111, 110, 115, 116, 32,
+83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 10, 32, 32, 32, 32,
+123, 32, 40, 118, 111, 105, 100, 41, 115, 101, 108, 102, 59, 32, 95,
+109, 95, 105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 123, 48, 125,
+59, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 59, 32, 125, 10,
+10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 110, 101, 120, 116, 41, 40,
+95, 109, 95, 105, 116, 101, 114, 42, 32, 105, 116, 41, 10, 32, 32, 32,
+32, 123, 32, 105, 102, 32, 40, 43, 43, 105, 116, 45, 62, 114, 101,
+102, 32, 61, 61, 32, 105, 116, 45, 62, 101, 110, 100, 41, 32, 105,
+116, 45, 62, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76, 59, 32, 125,
+10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 110, 101, 120, 116,
+41, 40, 95, 109, 95, 105, 116, 101, 114, 42, 32, 105, 116, 41, 10, 32,
+32, 32, 32, 123, 32, 105, 102, 32, 40, 45, 45, 105, 116, 45, 62, 114,
+101, 102, 32, 61, 61, 32, 105, 116, 45, 62, 101, 110, 100, 41, 32,
+105, 116, 45, 62, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76, 59, 32,
+125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 95, 109, 95,
+105, 116, 101, 114, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 97, 100,
+118, 97, 110, 99, 101, 41, 40, 95, 109, 95, 105, 116, 101, 114, 32,
+105, 116, 44, 32, 115, 105, 122, 101, 95, 116, 32, 110, 41, 32, 123,
+10, 32, 32, 32, 32, 105, 102, 32, 40, 40, 105, 116, 46, 114, 101, 102,
+32, 43, 61, 32, 110, 41, 32, 62, 61, 32, 105, 116, 46, 101, 110, 100,
+41, 32, 105, 116, 46, 114, 101, 102, 32, 61, 32, 78, 85, 76, 76, 59,
+10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 59,
+10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73, 78, 69, 32, 105, 115,
+105, 122, 101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 100,
+101, 120, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 95, 109, 95, 105, 116, 101, 114, 32,
+105, 116, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101, 116, 117, 114,
+110, 32, 40, 105, 116, 46, 114, 101, 102, 32, 45, 32, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 41, 59, 32, 125, 10, 10, 83, 84, 67,
+95, 73, 78, 76, 73, 78, 69, 32, 118, 111, 105, 100, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 97, 100, 106, 117, 115, 116, 95, 101, 110,
+100, 95, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 105, 115, 105, 122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 43, 61, 32, 110,
+59, 32, 125, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 83, 84, 67, 95,
+73, 78, 76, 73, 78, 69, 32, 95, 109, 95, 105, 116, 101, 114, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 102, 105, 110, 100, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 95, 109, 95, 114, 97, 119, 32, 114, 97, 119, 41, 32, 123, 10, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 102, 105, 110, 100, 95, 105, 110, 41, 40, 115, 101, 108,
+102, 44, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 101, 103, 105,
+110, 41, 40, 115, 101, 108, 102, 41, 44, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 101, 110, 100, 41, 40, 115, 101, 108, 102, 41, 44, 32,
+114, 97, 119, 41, 59, 10, 125, 10, 10, 83, 84, 67, 95, 73, 78, 76, 73,
+78, 69, 32, 95, 66, 111, 111, 108, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 101, 113, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 111, 116, 104, 101, 114, 41, 32, 123, 10, 32,
+32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62, 115, 105,
+122, 101, 32, 33, 61, 32, 111, 116, 104, 101, 114, 45, 62, 115, 105,
+122, 101, 41, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 32,
+32, 32, 32, 102, 111, 114, 32, 40, 105, 115, 105, 122, 101, 32, 105,
+32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 115, 101, 108, 102, 45, 62,
+115, 105, 122, 101, 59, 32, 43, 43, 105, 41, 32, 123, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97,
+119, 32, 95, 114, 120, 32, 61, 32, 105, 95, 107, 101, 121, 116, 111,
+114, 97, 119, 40, 40, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97,
+43, 105, 41, 41, 44, 32, 95, 114, 121, 32, 61, 32, 105, 95, 107, 101,
+121, 116, 111, 114, 97, 119, 40, 40, 111, 116, 104, 101, 114, 45, 62,
+100, 97, 116, 97, 43, 105, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 105, 102, 32, 40, 33, 40, 105, 95, 101, 113, 40, 40, 38, 95, 114,
+120, 41, 44, 32, 40, 38, 95, 114, 121, 41, 41, 41, 41, 32, 114, 101,
+116, 117, 114, 110, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32,
+32, 32, 114, 101, 116, 117, 114, 110, 32, 49, 59, 10, 125, 10, 35,
+101, 110, 100, 105, 102, 32, 47, 47, 32, 95, 105, 95, 104, 97, 115,
+95, 101, 113, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 47, 47, 32,
+35, 35, 35, 32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78,
+67, 76, 85, 68, 69, 58, 32, 115, 111, 114, 116, 95, 112, 114, 118, 46,
+104, 10, 10, 47, 47, 32, 73, 87, 89, 85, 32, 112, 114, 97, 103, 109,
+97, 58, 32, 112, 114, 105, 118, 97, 116, 101, 10, 35, 105, 102, 100,
+101, 102, 32, 95, 105, 95, 105, 115, 95, 108, 105, 115, 116, 10, 32,
+32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 116, 40, 115,
+101, 108, 102, 44, 32, 105, 100, 120, 41, 32, 40, 38, 40, 40, 95, 109,
+95, 118, 97, 108, 117, 101, 32, 42, 41, 40, 115, 101, 108, 102, 41,
+45, 62, 108, 97, 115, 116, 41, 91, 105, 100, 120, 93, 41, 10, 32, 32,
+35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 116, 95, 109, 117,
+116, 32, 105, 95, 97, 116, 10, 35, 101, 108, 105, 102, 32, 33, 100,
+101, 102, 105, 110, 101, 100, 32, 105, 95, 97, 116, 10, 32, 32, 35,
+100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 116, 40, 115, 101, 108,
+102, 44, 32, 105, 100, 120, 41, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 97, 116, 41, 40, 115, 101, 108, 102, 44, 32, 105, 100, 120, 41,
+10, 32, 32, 35, 100, 101, 102, 105, 110, 101, 32, 105, 95, 97, 116,
+95, 109, 117, 116, 40, 115, 101, 108, 102, 44, 32, 105, 100, 120, 41,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 97, 116, 95, 109, 117, 116,
+41, 40, 115, 101, 108, 102, 44, 32, 105, 100, 120, 41, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 83, 84, 67, 95, 65, 80, 73, 32, 118, 111,
+105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 111, 114, 116,
+95, 108, 111, 119, 104, 105, 103, 104, 41, 40, 83, 101, 108, 102, 42,
+32, 115, 101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32, 108, 111,
+44, 32, 105, 115, 105, 122, 101, 32, 104, 105, 41, 59, 10, 10, 35,
+105, 102, 100, 101, 102, 32, 95, 105, 95, 105, 115, 95, 97, 114, 114,
+97, 121, 10, 83, 84, 67, 95, 65, 80, 73, 32, 105, 115, 105, 122, 101,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111, 119, 101, 114, 95,
+98, 111, 117, 110, 100, 95, 114, 97, 110, 103, 101, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97, 119, 32, 114,
+97, 119, 44, 32, 105, 115, 105, 122, 101, 32, 115, 116, 97, 114, 116,
+44, 32, 105, 115, 105, 122, 101, 32, 101, 110, 100, 41, 59, 10, 83,
+84, 67, 95, 65, 80, 73, 32, 105, 115, 105, 122, 101, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 98, 105, 110, 97, 114, 121, 95, 115, 101, 97,
+114, 99, 104, 95, 114, 97, 110, 103, 101, 41, 40, 99, 111, 110, 115,
+116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99,
+111, 110, 115, 116, 32, 95, 109, 95, 114, 97, 119, 32, 114, 97, 119,
+44, 32, 105, 115, 105, 122, 101, 32, 115, 116, 97, 114, 116, 44, 32,
+105, 115, 105, 122, 101, 32, 101, 110, 100, 41, 59, 10, 10, 115, 116,
+97, 116, 105, 99, 32, 105, 110, 108, 105, 110, 101, 32, 118, 111, 105,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 111, 114, 116, 41,
+40, 83, 101, 108, 102, 42, 32, 97, 114, 114, 44, 32, 105, 115, 105,
+122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 115, 111, 114, 116, 95, 108, 111, 119, 104, 105,
+103, 104, 41, 40, 97, 114, 114, 44, 32, 48, 44, 32, 110, 32, 45, 32,
+49, 41, 59, 32, 125, 10, 10, 115, 116, 97, 116, 105, 99, 32, 105, 110,
+108, 105, 110, 101, 32, 105, 115, 105, 122, 101, 32, 47, 47, 32, 99,
+95, 78, 80, 79, 83, 32, 61, 32, 110, 111, 116, 32, 102, 111, 117, 110,
+100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111, 119, 101, 114,
+95, 98, 111, 117, 110, 100, 41, 40, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 97, 114, 114, 44, 32, 99, 111, 110, 115, 116,
+32, 95, 109, 95, 114, 97, 119, 32, 114, 97, 119, 44, 32, 105, 115,
+105, 122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32, 114, 101,
+116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111,
+119, 101, 114, 95, 98, 111, 117, 110, 100, 95, 114, 97, 110, 103, 101,
+41, 40, 97, 114, 114, 44, 32, 114, 97, 119, 44, 32, 48, 44, 32, 110,
+41, 59, 32, 125, 10, 10, 115, 116, 97, 116, 105, 99, 32, 105, 110,
+108, 105, 110, 101, 32, 105, 115, 105, 122, 101, 32, 47, 47, 32, 99,
+95, 78, 80, 79, 83, 32, 61, 32, 110, 111, 116, 32, 102, 111, 117, 110,
+100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98, 105, 110, 97, 114,
+121, 95, 115, 101, 97, 114, 99, 104, 41, 40, 99, 111, 110, 115, 116,
+32, 83, 101, 108, 102, 42, 32, 97, 114, 114, 44, 32, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 114, 97, 119, 32, 114, 97, 119, 44, 32,
+105, 115, 105, 122, 101, 32, 110, 41, 10, 32, 32, 32, 32, 123, 32,
+114, 101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95,
+98, 105, 110, 97, 114, 121, 95, 115, 101, 97, 114, 99, 104, 95, 114,
+97, 110, 103, 101, 41, 40, 97, 114, 114, 44, 32, 114, 97, 119, 44, 32,
+48, 44, 32, 110, 41, 59, 32, 125, 10, 10, 35, 101, 108, 105, 102, 32,
+33, 100, 101, 102, 105, 110, 101, 100, 32, 95, 105, 95, 105, 115, 95,
+108, 105, 115, 116, 10, 83, 84, 67, 95, 65, 80, 73, 32, 105, 115, 105,
+122, 101, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111, 119, 101,
+114, 95, 98, 111, 117, 110, 100, 95, 114, 97, 110, 103, 101, 41, 40,
+99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108,
+102, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97, 119,
+32, 114, 97, 119, 44, 32, 105, 115, 105, 122, 101, 32, 115, 116, 97,
+114, 116, 44, 32, 105, 115, 105, 122, 101, 32, 101, 110, 100, 41, 59,
+10, 83, 84, 67, 95, 65, 80, 73, 32, 105, 115, 105, 122, 101, 32, 95,
+99, 95, 77, 69, 77, 66, 40, 95, 98, 105, 110, 97, 114, 121, 95, 115,
+101, 97, 114, 99, 104, 95, 114, 97, 110, 103, 101, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97, 119, 32, 114,
+97, 119, 44, 32, 105, 115, 105, 122, 101, 32, 115, 116, 97, 114, 116,
+44, 32, 105, 115, 105, 122, 101, 32, 101, 110, 100, 41, 59, 10, 10,
+115, 116, 97, 116, 105, 99, 32, 105, 110, 108, 105, 110, 101, 32, 118,
+111, 105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 111, 114,
+116, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 10,
+32, 32, 32, 32, 123, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 111,
+114, 116, 95, 108, 111, 119, 104, 105, 103, 104, 41, 40, 115, 101,
+108, 102, 44, 32, 48, 44, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115,
+105, 122, 101, 41, 40, 115, 101, 108, 102, 41, 32, 45, 32, 49, 41, 59,
+32, 125, 10, 10, 115, 116, 97, 116, 105, 99, 32, 105, 110, 108, 105,
+110, 101, 32, 105, 115, 105, 122, 101, 32, 47, 47, 32, 99, 95, 78, 80,
+79, 83, 32, 61, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 10,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111, 119, 101, 114, 95, 98,
+111, 117, 110, 100, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32,
+95, 109, 95, 114, 97, 119, 32, 114, 97, 119, 41, 10, 32, 32, 32, 32,
+123, 32, 114, 101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66,
+40, 95, 108, 111, 119, 101, 114, 95, 98, 111, 117, 110, 100, 95, 114,
+97, 110, 103, 101, 41, 40, 115, 101, 108, 102, 44, 32, 114, 97, 119,
+44, 32, 48, 44, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 105, 122,
+101, 41, 40, 115, 101, 108, 102, 41, 41, 59, 32, 125, 10, 10, 115,
+116, 97, 116, 105, 99, 32, 105, 110, 108, 105, 110, 101, 32, 105, 115,
+105, 122, 101, 32, 47, 47, 32, 99, 95, 78, 80, 79, 83, 32, 61, 32,
+110, 111, 116, 32, 102, 111, 117, 110, 100, 10, 95, 99, 95, 77, 69,
+77, 66, 40, 95, 98, 105, 110, 97, 114, 121, 95, 115, 101, 97, 114, 99,
+104, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95,
+114, 97, 119, 32, 114, 97, 119, 41, 10, 32, 32, 32, 32, 123, 32, 114,
+101, 116, 117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98,
+105, 110, 97, 114, 121, 95, 115, 101, 97, 114, 99, 104, 95, 114, 97,
+110, 103, 101, 41, 40, 115, 101, 108, 102, 44, 32, 114, 97, 119, 44,
+32, 48, 44, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 105, 122,
+101, 41, 40, 115, 101, 108, 102, 41, 41, 59, 32, 125, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 47, 42, 32, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 32, 73, 77, 80, 76, 69, 77, 69, 78, 84, 65, 84, 73, 79, 78,
+32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 32, 42, 47, 10, 35, 105, 102, 32,
+100, 101, 102, 105, 110, 101, 100, 32, 105, 95, 105, 109, 112, 108,
+101, 109, 101, 110, 116, 10, 10, 115, 116, 97, 116, 105, 99, 32, 118,
+111, 105, 100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115,
+101, 114, 116, 115, 111, 114, 116, 95, 108, 111, 119, 104, 105, 103,
+104, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44, 32,
+105, 115, 105, 122, 101, 32, 108, 111, 44, 32, 105, 115, 105, 122,
+101, 32, 104, 105, 41, 32, 123, 10, 32, 32, 32, 32, 102, 111, 114, 32,
+40, 105, 115, 105, 122, 101, 32, 106, 32, 61, 32, 108, 111, 44, 32,
+105, 32, 61, 32, 108, 111, 32, 43, 32, 49, 59, 32, 105, 32, 60, 61,
+32, 104, 105, 59, 32, 106, 32, 61, 32, 105, 44, 32, 43, 43, 105, 41,
+32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 109, 95, 118, 97,
+108, 117, 101, 32, 120, 32, 61, 32, 42, 105, 95, 97, 116, 40, 115,
+101, 108, 102, 44, 32, 105, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 95, 109, 95, 114, 97, 119, 32, 114, 120, 32, 61, 32, 105, 95, 107,
+101, 121, 116, 111, 114, 97, 119, 40, 40, 38, 120, 41, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 106, 32,
+62, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 95, 109, 95, 114, 97, 119, 32, 114, 121, 32, 61, 32, 105,
+95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 105, 95, 97, 116, 40,
+115, 101, 108, 102, 44, 32, 106, 41, 41, 59, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 40, 105, 95, 108,
+101, 115, 115, 40, 40, 38, 114, 120, 41, 44, 32, 40, 38, 114, 121, 41,
+41, 41, 41, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 42, 105, 95, 97, 116, 95, 109, 117, 116, 40,
+115, 101, 108, 102, 44, 32, 106, 32, 43, 32, 49, 41, 32, 61, 32, 42,
+105, 95, 97, 116, 40, 115, 101, 108, 102, 44, 32, 106, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 45, 106, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+42, 105, 95, 97, 116, 95, 109, 117, 116, 40, 115, 101, 108, 102, 44,
+32, 106, 32, 43, 32, 49, 41, 32, 61, 32, 120, 59, 10, 32, 32, 32, 32,
+125, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 118, 111, 105,
+100, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 115, 111, 114, 116, 95,
+108, 111, 119, 104, 105, 103, 104, 41, 40, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 44, 32, 105, 115, 105, 122, 101, 32, 108, 111, 44,
+32, 105, 115, 105, 122, 101, 32, 104, 105, 41, 32, 123, 10, 32, 32,
+32, 32, 105, 115, 105, 122, 101, 32, 105, 32, 61, 32, 108, 111, 44,
+32, 106, 59, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 108,
+111, 32, 60, 32, 104, 105, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 95, 109, 95, 114, 97, 119, 32, 112, 105, 118, 111, 116, 32,
+61, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 105, 95,
+97, 116, 40, 115, 101, 108, 102, 44, 32, 40, 105, 115, 105, 122, 101,
+41, 40, 108, 111, 32, 43, 32, 40, 104, 105, 32, 45, 32, 108, 111, 41,
+42, 55, 76, 76, 47, 49, 54, 41, 41, 41, 44, 32, 114, 120, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 106, 32, 61, 32, 104, 105, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 100, 111, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 100, 111, 32, 123, 32, 114, 120, 32, 61, 32,
+105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 105, 95, 97, 116,
+40, 115, 101, 108, 102, 44, 32, 105, 41, 41, 59, 32, 125, 32, 119,
+104, 105, 108, 101, 32, 40, 40, 105, 95, 108, 101, 115, 115, 40, 40,
+38, 114, 120, 41, 44, 32, 40, 38, 112, 105, 118, 111, 116, 41, 41, 41,
+32, 38, 38, 32, 43, 43, 105, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 100, 111, 32, 123, 32, 114, 120, 32, 61, 32, 105,
+95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 105, 95, 97, 116, 40,
+115, 101, 108, 102, 44, 32, 106, 41, 41, 59, 32, 125, 32, 119, 104,
+105, 108, 101, 32, 40, 40, 105, 95, 108, 101, 115, 115, 40, 40, 38,
+112, 105, 118, 111, 116, 41, 44, 32, 40, 38, 114, 120, 41, 41, 41, 32,
+38, 38, 32, 45, 45, 106, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 105, 102, 32, 40, 105, 32, 62, 32, 106, 41, 32, 98,
+114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 99, 95, 115, 119, 97, 112, 40, 105, 95, 97, 116, 95, 109, 117,
+116, 40, 115, 101, 108, 102, 44, 32, 105, 41, 44, 32, 105, 95, 97,
+116, 95, 109, 117, 116, 40, 115, 101, 108, 102, 44, 32, 106, 41, 41,
+59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 43, 43, 105,
+59, 32, 45, 45, 106, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 32,
+119, 104, 105, 108, 101, 32, 40, 105, 32, 60, 61, 32, 106, 41, 59, 10,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 106, 32, 45, 32,
+108, 111, 32, 62, 32, 104, 105, 32, 45, 32, 105, 41, 32, 123, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 95, 115, 119, 97, 112,
+40, 38, 108, 111, 44, 32, 38, 105, 41, 59, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 99, 95, 115, 119, 97, 112, 40, 38, 104, 105,
+44, 32, 38, 106, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 106, 32, 45, 32,
+108, 111, 32, 62, 32, 54, 52, 41, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 115, 111, 114, 116, 95, 108, 111, 119, 104, 105, 103, 104, 41, 40,
+115, 101, 108, 102, 44, 32, 108, 111, 44, 32, 106, 41, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 106,
+32, 62, 32, 108, 111, 41, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105,
+110, 115, 101, 114, 116, 115, 111, 114, 116, 95, 108, 111, 119, 104,
+105, 103, 104, 41, 40, 115, 101, 108, 102, 44, 32, 108, 111, 44, 32,
+106, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 32, 61, 32,
+105, 59, 10, 32, 32, 32, 32, 125, 10, 125, 10, 10, 35, 105, 102, 110,
+100, 101, 102, 32, 95, 105, 95, 105, 115, 95, 108, 105, 115, 116, 10,
+83, 84, 67, 95, 68, 69, 70, 32, 105, 115, 105, 122, 101, 32, 47, 47,
+32, 99, 95, 78, 80, 79, 83, 32, 61, 32, 110, 111, 116, 32, 102, 111,
+117, 110, 100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 108, 111, 119,
+101, 114, 95, 98, 111, 117, 110, 100, 95, 114, 97, 110, 103, 101, 41,
+40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101,
+108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97,
+119, 32, 114, 97, 119, 44, 32, 105, 115, 105, 122, 101, 32, 115, 116,
+97, 114, 116, 44, 32, 105, 115, 105, 122, 101, 32, 101, 110, 100, 41,
+32, 123, 10, 32, 32, 32, 32, 105, 115, 105, 122, 101, 32, 99, 111,
+117, 110, 116, 32, 61, 32, 101, 110, 100, 32, 45, 32, 115, 116, 97,
+114, 116, 44, 32, 115, 116, 101, 112, 32, 61, 32, 99, 111, 117, 110,
+116, 47, 50, 59, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40,
+99, 111, 117, 110, 116, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97,
+119, 32, 114, 120, 32, 61, 32, 105, 95, 107, 101, 121, 116, 111, 114,
+97, 119, 40, 105, 95, 97, 116, 40, 115, 101, 108, 102, 44, 32, 115,
+116, 97, 114, 116, 32, 43, 32, 115, 116, 101, 112, 41, 41, 59, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 105, 95, 108, 101, 115,
+115, 40, 40, 38, 114, 120, 41, 44, 32, 40, 38, 114, 97, 119, 41, 41,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115,
+116, 97, 114, 116, 32, 43, 61, 32, 115, 116, 101, 112, 32, 43, 32, 49,
+59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 117,
+110, 116, 32, 45, 61, 32, 115, 116, 101, 112, 32, 43, 32, 49, 59, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 101, 112,
+32, 61, 32, 99, 111, 117, 110, 116, 42, 55, 47, 56, 59, 10, 32, 32,
+32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 117, 110, 116,
+32, 61, 32, 115, 116, 101, 112, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 115, 116, 101, 112, 32, 61, 32, 99, 111, 117, 110,
+116, 47, 56, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+115, 116, 97, 114, 116, 32, 61, 61, 32, 101, 110, 100, 32, 63, 32, 99,
+95, 78, 80, 79, 83, 32, 58, 32, 115, 116, 97, 114, 116, 59, 10, 125,
+10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 105, 115, 105, 122, 101, 32,
+47, 47, 32, 99, 95, 78, 80, 79, 83, 32, 61, 32, 110, 111, 116, 32,
+102, 111, 117, 110, 100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 98,
+105, 110, 97, 114, 121, 95, 115, 101, 97, 114, 99, 104, 95, 114, 97,
+110, 103, 101, 41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 95,
+109, 95, 114, 97, 119, 32, 114, 97, 119, 44, 32, 105, 115, 105, 122,
+101, 32, 115, 116, 97, 114, 116, 44, 32, 105, 115, 105, 122, 101, 32,
+101, 110, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 115, 105, 122,
+101, 32, 114, 101, 115, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40,
+95, 108, 111, 119, 101, 114, 95, 98, 111, 117, 110, 100, 95, 114, 97,
+110, 103, 101, 41, 40, 115, 101, 108, 102, 44, 32, 114, 97, 119, 44,
+32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 32, 32,
+32, 32, 105, 102, 32, 40, 114, 101, 115, 32, 33, 61, 32, 99, 95, 78,
+80, 79, 83, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+110, 115, 116, 32, 95, 109, 95, 114, 97, 119, 32, 114, 120, 32, 61,
+32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40, 105, 95, 97,
+116, 40, 115, 101, 108, 102, 44, 32, 114, 101, 115, 41, 41, 59, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 105, 95, 108, 101,
+115, 115, 40, 40, 38, 114, 97, 119, 41, 44, 32, 40, 38, 114, 120, 41,
+41, 41, 32, 114, 101, 115, 32, 61, 32, 99, 95, 78, 80, 79, 83, 59, 10,
+32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+32, 114, 101, 115, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 32,
+47, 47, 32, 33, 95, 105, 95, 105, 115, 95, 108, 105, 115, 116, 10, 35,
+101, 110, 100, 105, 102, 32, 47, 47, 32, 73, 77, 80, 76, 69, 77, 69,
+78, 84, 65, 84, 73, 79, 78, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 97, 116, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 97, 116,
+95, 109, 117, 116, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70,
+73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 115, 111, 114,
+116, 95, 112, 114, 118, 46, 104, 10, 35, 101, 110, 100, 105, 102, 32,
+47, 47, 32, 95, 105, 95, 104, 97, 115, 95, 99, 109, 112, 10, 10, 47,
+42, 32, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 32, 73, 77, 80, 76, 69,
+77, 69, 78, 84, 65, 84, 73, 79, 78, 32, 45, 45, 45, 45, 45, 45, 45,
+45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+45, 32, 42, 47, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 105, 95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 10,
+83, 84, 67, 95, 68, 69, 70, 32, 118, 111, 105, 100, 10, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 99, 111, 112, 121, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 83,
+101, 108, 102, 42, 32, 111, 116, 104, 101, 114, 41, 32, 123, 10, 32,
+32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 32, 61, 61, 32, 111,
+116, 104, 101, 114, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32,
+32, 32, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 108, 101, 97, 114,
+41, 40, 115, 101, 108, 102, 41, 59, 10, 32, 32, 32, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118, 101, 41, 40,
+115, 101, 108, 102, 44, 32, 111, 116, 104, 101, 114, 45, 62, 115, 105,
+122, 101, 41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 45, 62, 115,
+105, 122, 101, 32, 61, 32, 111, 116, 104, 101, 114, 45, 62, 115, 105,
+122, 101, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 99, 95, 114,
+97, 110, 103, 101, 40, 105, 44, 32, 111, 116, 104, 101, 114, 45, 62,
+115, 105, 122, 101, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115,
+101, 108, 102, 45, 62, 100, 97, 116, 97, 91, 105, 93, 32, 61, 32, 105,
+95, 107, 101, 121, 99, 108, 111, 110, 101, 40, 40, 111, 116, 104, 101,
+114, 45, 62, 100, 97, 116, 97, 91, 105, 93, 41, 41, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 68, 69, 70, 32, 83, 101, 108, 102, 10, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 99, 108, 111, 110, 101, 41, 40, 83, 101, 108,
+102, 32, 118, 101, 99, 41, 32, 123, 10, 32, 32, 32, 32, 83, 101, 108,
+102, 32, 111, 117, 116, 32, 61, 32, 118, 101, 99, 44, 32, 42, 115,
+101, 108, 102, 32, 61, 32, 38, 111, 117, 116, 59, 32, 40, 118, 111,
+105, 100, 41, 115, 101, 108, 102, 59, 10, 32, 32, 32, 32, 111, 117,
+116, 46, 100, 97, 116, 97, 32, 61, 32, 78, 85, 76, 76, 59, 32, 111,
+117, 116, 46, 115, 105, 122, 101, 32, 61, 32, 111, 117, 116, 46, 99,
+97, 112, 97, 99, 105, 116, 121, 32, 61, 32, 48, 59, 10, 32, 32, 32,
+32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114, 118,
+101, 41, 40, 38, 111, 117, 116, 44, 32, 118, 101, 99, 46, 115, 105,
+122, 101, 41, 59, 10, 32, 32, 32, 32, 111, 117, 116, 46, 115, 105,
+122, 101, 32, 61, 32, 118, 101, 99, 46, 115, 105, 122, 101, 59, 10,
+32, 32, 32, 32, 102, 111, 114, 32, 40, 99, 95, 114, 97, 110, 103, 101,
+40, 105, 44, 32, 118, 101, 99, 46, 115, 105, 122, 101, 41, 41, 10, 32,
+32, 32, 32, 32, 32, 32, 32, 111, 117, 116, 46, 100, 97, 116, 97, 91,
+105, 93, 32, 61, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110, 101,
+40, 118, 101, 99, 46, 100, 97, 116, 97, 91, 105, 93, 41, 59, 10, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 117, 116, 59, 10,
+125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 118, 111, 105, 100, 10,
+95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 108, 101, 97, 114, 41, 40, 83,
+101, 108, 102, 42, 32, 115, 101, 108, 102, 41, 32, 123, 10, 32, 32,
+32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 45, 62, 115, 105, 122,
+101, 32, 61, 61, 32, 48, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10,
+32, 32, 32, 32, 95, 109, 95, 118, 97, 108, 117, 101, 32, 42, 112, 32,
+61, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 115,
+101, 108, 102, 45, 62, 115, 105, 122, 101, 59, 10, 32, 32, 32, 32,
+119, 104, 105, 108, 101, 32, 40, 112, 45, 45, 32, 33, 61, 32, 115,
+101, 108, 102, 45, 62, 100, 97, 116, 97, 41, 32, 123, 32, 105, 95,
+107, 101, 121, 100, 114, 111, 112, 40, 112, 41, 59, 32, 125, 10, 32,
+32, 32, 32, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 61,
+32, 48, 59, 10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 118, 111,
+105, 100, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 100, 114, 111, 112,
+41, 40, 99, 111, 110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 99,
+115, 101, 108, 102, 41, 32, 123, 10, 32, 32, 32, 32, 83, 101, 108,
+102, 42, 32, 115, 101, 108, 102, 32, 61, 32, 40, 83, 101, 108, 102,
+42, 41, 99, 115, 101, 108, 102, 59, 10, 32, 32, 32, 32, 105, 102, 32,
+40, 115, 101, 108, 102, 45, 62, 99, 97, 112, 97, 99, 105, 116, 121,
+32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101,
+116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 99, 108, 101, 97, 114, 41, 40, 115, 101, 108, 102, 41, 59,
+10, 32, 32, 32, 32, 105, 95, 102, 114, 101, 101, 40, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 44, 32, 115, 101, 108, 102, 45, 62, 99,
+97, 112, 97, 99, 105, 116, 121, 42, 99, 95, 115, 105, 122, 101, 111,
+102, 40, 42, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 41, 41, 59,
+10, 125, 10, 10, 83, 84, 67, 95, 68, 69, 70, 32, 95, 66, 111, 111,
+108, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101, 114,
+118, 101, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32, 99, 97,
+112, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 112,
+32, 62, 32, 115, 101, 108, 102, 45, 62, 99, 97, 112, 97, 99, 105, 116,
+121, 32, 124, 124, 32, 40, 99, 97, 112, 32, 38, 38, 32, 99, 97, 112,
+32, 61, 61, 32, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 41,
+41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 95, 109, 95, 118, 97,
+108, 117, 101, 42, 32, 100, 32, 61, 32, 40, 95, 109, 95, 118, 97, 108,
+117, 101, 42, 41, 105, 95, 114, 101, 97, 108, 108, 111, 99, 40, 115,
+101, 108, 102, 45, 62, 100, 97, 116, 97, 44, 32, 115, 101, 108, 102,
+45, 62, 99, 97, 112, 97, 99, 105, 116, 121, 42, 99, 95, 115, 105, 122,
+101, 111, 102, 32, 42, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 99, 97, 112, 42, 99, 95, 115, 105, 122, 101, 111, 102, 32, 42,
+100, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40,
+100, 32, 61, 61, 32, 78, 85, 76, 76, 41, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 45, 62, 100, 97,
+116, 97, 32, 61, 32, 100, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115,
+101, 108, 102, 45, 62, 99, 97, 112, 97, 99, 105, 116, 121, 32, 61, 32,
+99, 97, 112, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116,
+97, 32, 33, 61, 32, 78, 85, 76, 76, 59, 10, 125, 10, 10, 83, 84, 67,
+95, 68, 69, 70, 32, 95, 66, 111, 111, 108, 10, 95, 99, 95, 77, 69, 77,
+66, 40, 95, 114, 101, 115, 105, 122, 101, 41, 40, 83, 101, 108, 102,
+42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+115, 105, 122, 101, 32, 108, 101, 110, 44, 32, 95, 109, 95, 118, 97,
+108, 117, 101, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32,
+32, 105, 102, 32, 40, 33, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114,
+101, 115, 101, 114, 118, 101, 41, 40, 115, 101, 108, 102, 44, 32, 108,
+101, 110, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 48, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+32, 105, 115, 105, 122, 101, 32, 110, 32, 61, 32, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32,
+40, 105, 115, 105, 122, 101, 32, 105, 32, 61, 32, 108, 101, 110, 59,
+32, 105, 32, 60, 32, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32,
+32, 32, 32, 32, 123, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112,
+40, 40, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 105,
+41, 41, 59, 32, 125, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105,
+115, 105, 122, 101, 32, 105, 32, 61, 32, 110, 59, 32, 105, 32, 60, 32,
+108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 115, 101, 108, 102, 45, 62, 100, 97, 116, 97, 91, 105, 93, 32,
+61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 115, 101, 108,
+102, 45, 62, 115, 105, 122, 101, 32, 61, 32, 108, 101, 110, 59, 10,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 49, 59, 10, 125, 10,
+10, 83, 84, 67, 95, 68, 69, 70, 32, 95, 109, 95, 105, 116, 101, 114,
+10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116,
+95, 117, 110, 105, 110, 105, 116, 41, 40, 83, 101, 108, 102, 42, 32,
+115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116, 32, 105, 115, 105,
+122, 101, 32, 105, 100, 120, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+115, 105, 122, 101, 32, 110, 41, 32, 123, 10, 32, 32, 32, 32, 105,
+102, 32, 40, 115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 43,
+32, 110, 32, 62, 61, 32, 115, 101, 108, 102, 45, 62, 99, 97, 112, 97,
+99, 105, 116, 121, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102,
+32, 40, 33, 95, 99, 95, 77, 69, 77, 66, 40, 95, 114, 101, 115, 101,
+114, 118, 101, 41, 40, 115, 101, 108, 102, 44, 32, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 42, 51, 47, 50, 32, 43, 32, 110, 41, 41,
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 110, 100,
+41, 40, 115, 101, 108, 102, 41, 59, 10, 10, 32, 32, 32, 32, 95, 109,
+95, 118, 97, 108, 117, 101, 32, 42, 112, 111, 115, 32, 61, 32, 115,
+101, 108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 105, 100, 120,
+59, 10, 32, 32, 32, 32, 99, 95, 109, 101, 109, 109, 111, 118, 101, 40,
+112, 111, 115, 32, 43, 32, 110, 44, 32, 112, 111, 115, 44, 32, 40,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 45, 32, 105, 100,
+120, 41, 42, 99, 95, 115, 105, 122, 101, 111, 102, 32, 42, 112, 111,
+115, 41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 45, 62, 115, 105,
+122, 101, 32, 43, 61, 32, 110, 59, 10, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 95,
+109, 95, 105, 116, 101, 114, 41, 123, 112, 111, 115, 44, 32, 115, 101,
+108, 102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 125, 59, 10, 125, 10, 10, 83, 84, 67, 95,
+68, 69, 70, 32, 95, 109, 95, 105, 116, 101, 114, 10, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 101, 114, 97, 115, 101, 95, 110, 41, 40, 83, 101,
+108, 102, 42, 32, 115, 101, 108, 102, 44, 32, 99, 111, 110, 115, 116,
+32, 105, 115, 105, 122, 101, 32, 105, 100, 120, 44, 32, 99, 111, 110,
+115, 116, 32, 105, 115, 105, 122, 101, 32, 108, 101, 110, 41, 32, 123,
+10, 32, 32, 32, 32, 99, 95, 97, 115, 115, 101, 114, 116, 40, 105, 100,
+120, 32, 43, 32, 108, 101, 110, 32, 60, 61, 32, 115, 101, 108, 102,
+45, 62, 115, 105, 122, 101, 41, 59, 10, 32, 32, 32, 32, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 32, 100, 32, 61, 32, 115, 101, 108, 102,
+45, 62, 100, 97, 116, 97, 32, 43, 32, 105, 100, 120, 44, 32, 42, 112,
+32, 61, 32, 100, 44, 32, 42, 101, 110, 100, 32, 61, 32, 115, 101, 108,
+102, 45, 62, 100, 97, 116, 97, 32, 43, 32, 115, 101, 108, 102, 45, 62,
+115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40,
+105, 115, 105, 122, 101, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60,
+32, 108, 101, 110, 59, 32, 43, 43, 105, 44, 32, 43, 43, 112, 41, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 123, 32, 105, 95, 107, 101, 121, 100,
+114, 111, 112, 40, 112, 41, 59, 32, 125, 10, 32, 32, 32, 32, 109, 101,
+109, 109, 111, 118, 101, 40, 100, 44, 32, 112, 44, 32, 40, 115, 105,
+122, 101, 95, 116, 41, 40, 101, 110, 100, 32, 45, 32, 112, 41, 42,
+115, 105, 122, 101, 111, 102, 32, 42, 100, 41, 59, 10, 32, 32, 32, 32,
+115, 101, 108, 102, 45, 62, 115, 105, 122, 101, 32, 45, 61, 32, 108,
+101, 110, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+99, 95, 108, 105, 116, 101, 114, 97, 108, 40, 95, 109, 95, 105, 116,
+101, 114, 41, 123, 112, 32, 61, 61, 32, 101, 110, 100, 32, 63, 32, 78,
+85, 76, 76, 32, 58, 32, 100, 44, 32, 101, 110, 100, 32, 45, 32, 108,
+101, 110, 125, 59, 10, 125, 10, 10, 35, 105, 102, 32, 33, 100, 101,
+102, 105, 110, 101, 100, 32, 105, 95, 110, 111, 95, 99, 108, 111, 110,
+101, 10, 83, 84, 67, 95, 68, 69, 70, 32, 95, 109, 95, 105, 116, 101,
+114, 10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 99, 111, 112, 121, 95,
+116, 111, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32, 105, 100,
+120, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 118, 97, 108,
+117, 101, 32, 97, 114, 114, 91, 93, 44, 32, 99, 111, 110, 115, 116,
+32, 105, 115, 105, 122, 101, 32, 110, 41, 32, 123, 10, 32, 32, 32, 32,
+95, 109, 95, 105, 116, 101, 114, 32, 105, 116, 32, 61, 32, 95, 99, 95,
+77, 69, 77, 66, 40, 95, 105, 110, 115, 101, 114, 116, 95, 117, 110,
+105, 110, 105, 116, 41, 40, 115, 101, 108, 102, 44, 32, 105, 100, 120,
+44, 32, 110, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105, 116,
+46, 114, 101, 102, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 111,
+114, 32, 40, 95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 112, 32, 61,
+32, 105, 116, 46, 114, 101, 102, 44, 32, 42, 113, 32, 61, 32, 112, 32,
+43, 32, 110, 59, 32, 112, 32, 33, 61, 32, 113, 59, 32, 43, 43, 97,
+114, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
+112, 43, 43, 32, 61, 32, 105, 95, 107, 101, 121, 99, 108, 111, 110,
+101, 40, 40, 42, 97, 114, 114, 41, 41, 59, 10, 32, 32, 32, 32, 114,
+101, 116, 117, 114, 110, 32, 105, 116, 59, 10, 125, 10, 35, 101, 110,
+100, 105, 102, 32, 47, 47, 32, 33, 105, 95, 110, 111, 95, 99, 108,
+111, 110, 101, 10, 10, 35, 105, 102, 32, 33, 100, 101, 102, 105, 110,
+101, 100, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97, 99, 101,
+10, 83, 84, 67, 95, 68, 69, 70, 32, 95, 109, 95, 105, 116, 101, 114,
+10, 95, 99, 95, 77, 69, 77, 66, 40, 95, 101, 109, 112, 108, 97, 99,
+101, 95, 110, 41, 40, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102,
+44, 32, 99, 111, 110, 115, 116, 32, 105, 115, 105, 122, 101, 32, 105,
+100, 120, 44, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97,
+119, 32, 114, 97, 119, 91, 93, 44, 32, 105, 115, 105, 122, 101, 32,
+110, 41, 32, 123, 10, 32, 32, 32, 32, 95, 109, 95, 105, 116, 101, 114,
+32, 105, 116, 32, 61, 32, 95, 99, 95, 77, 69, 77, 66, 40, 95, 105,
+110, 115, 101, 114, 116, 95, 117, 110, 105, 110, 105, 116, 41, 40,
+115, 101, 108, 102, 44, 32, 105, 100, 120, 44, 32, 110, 41, 59, 10,
+32, 32, 32, 32, 105, 102, 32, 40, 105, 116, 46, 114, 101, 102, 41, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 95, 109, 95,
+118, 97, 108, 117, 101, 42, 32, 112, 32, 61, 32, 105, 116, 46, 114,
+101, 102, 59, 32, 110, 45, 45, 59, 32, 43, 43, 114, 97, 119, 44, 32,
+43, 43, 112, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+42, 112, 32, 61, 32, 105, 95, 107, 101, 121, 102, 114, 111, 109, 40,
+40, 42, 114, 97, 119, 41, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116,
+117, 114, 110, 32, 105, 116, 59, 10, 125, 10, 35, 101, 110, 100, 105,
+102, 32, 47, 47, 32, 33, 105, 95, 110, 111, 95, 101, 109, 112, 108,
+97, 99, 101, 10, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101,
+100, 32, 95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 83, 84, 67, 95,
+68, 69, 70, 32, 95, 109, 95, 105, 116, 101, 114, 10, 95, 99, 95, 77,
+69, 77, 66, 40, 95, 102, 105, 110, 100, 95, 105, 110, 41, 40, 99, 111,
+110, 115, 116, 32, 83, 101, 108, 102, 42, 32, 115, 101, 108, 102, 44,
+32, 95, 109, 95, 105, 116, 101, 114, 32, 105, 49, 44, 32, 95, 109, 95,
+105, 116, 101, 114, 32, 105, 50, 44, 32, 95, 109, 95, 114, 97, 119,
+32, 114, 97, 119, 41, 32, 123, 10, 32, 32, 32, 32, 40, 118, 111, 105,
+100, 41, 115, 101, 108, 102, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+115, 116, 32, 95, 109, 95, 118, 97, 108, 117, 101, 42, 32, 112, 50,
+32, 61, 32, 95, 105, 116, 50, 95, 112, 116, 114, 40, 105, 49, 44, 32,
+105, 50, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 59, 32,
+105, 49, 46, 114, 101, 102, 32, 33, 61, 32, 112, 50, 59, 32, 43, 43,
+105, 49, 46, 114, 101, 102, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+32, 32, 99, 111, 110, 115, 116, 32, 95, 109, 95, 114, 97, 119, 32,
+114, 32, 61, 32, 105, 95, 107, 101, 121, 116, 111, 114, 97, 119, 40,
+105, 49, 46, 114, 101, 102, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+32, 105, 102, 32, 40, 105, 95, 101, 113, 40, 40, 38, 114, 97, 119, 41,
+44, 32, 40, 38, 114, 41, 41, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 105, 49, 59, 10, 32,
+32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 50, 46, 114, 101, 102, 32,
+61, 32, 78, 85, 76, 76, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+114, 110, 32, 105, 50, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102,
+32, 47, 47, 32, 32, 95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 35,
+101, 110, 100, 105, 102, 32, 47, 47, 32, 105, 95, 105, 109, 112, 108,
+101, 109, 101, 110, 116, 10, 47, 47, 32, 35, 35, 35, 32, 66, 69, 71,
+73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32,
+108, 105, 110, 107, 97, 103, 101, 50, 46, 104, 10, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 97, 108, 108, 111, 99, 97, 116, 111, 114,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 109, 97, 108, 108, 111,
+99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 99, 97, 108, 108,
+111, 99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 114, 101, 97,
+108, 108, 111, 99, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 102,
+114, 101, 101, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 97, 117,
+120, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95, 97, 117, 120,
+95, 100, 101, 102, 10, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95,
+115, 116, 97, 116, 105, 99, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 104, 101, 97, 100, 101, 114, 10, 35, 117, 110, 100, 101, 102, 32,
+105, 95, 105, 109, 112, 108, 101, 109, 101, 110, 116, 10, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 105, 109, 112, 111, 114, 116, 10, 10,
+35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32, 95, 95, 99,
+108, 97, 110, 103, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102, 105,
+110, 101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117, 115,
+10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 99, 108, 97, 110, 103,
+32, 100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 111, 112,
+10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 32,
+95, 95, 71, 78, 85, 67, 95, 95, 32, 38, 38, 32, 33, 100, 101, 102,
+105, 110, 101, 100, 32, 95, 95, 99, 112, 108, 117, 115, 112, 108, 117,
+115, 10, 32, 32, 35, 112, 114, 97, 103, 109, 97, 32, 71, 67, 67, 32,
+100, 105, 97, 103, 110, 111, 115, 116, 105, 99, 32, 112, 111, 112, 10,
+35, 101, 110, 100, 105, 102, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78,
+68, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 108,
+105, 110, 107, 97, 103, 101, 50, 46, 104, 10, 47, 47, 32, 35, 35, 35,
+32, 66, 69, 71, 73, 78, 95, 70, 73, 76, 69, 95, 73, 78, 67, 76, 85,
+68, 69, 58, 32, 116, 101, 109, 112, 108, 97, 116, 101, 50, 46, 104,
+10, 47, 47, 32, 73, 87, 89, 85, 32, 112, 114, 97, 103, 109, 97, 58,
+32, 112, 114, 105, 118, 97, 116, 101, 10, 35, 117, 110, 100, 101, 102,
+32, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32,
+97, 108, 105, 97, 115, 32, 102, 111, 114, 32, 105, 95, 116, 121, 112,
+101, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 116, 121, 112, 101,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 99, 108, 97, 115, 115,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 116, 97, 103, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 111, 112, 116, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 99, 97, 112, 97, 99, 105, 116, 121, 10,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 112, 114, 111,
+32, 32, 32, 32, 32, 47, 47, 32, 82, 101, 112, 108, 97, 99, 101, 115,
+32, 110, 101, 120, 116, 32, 116, 119, 111, 10, 35, 117, 110, 100, 101,
+102, 32, 105, 95, 107, 101, 121, 95, 115, 116, 114, 32, 32, 32, 32,
+47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 95, 97,
+114, 99, 98, 111, 120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101,
+99, 97, 116, 101, 100, 93, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 107, 101, 121, 99, 108, 97, 115, 115, 10, 35, 117, 110, 100, 101,
+102, 32, 105, 95, 99, 109, 112, 99, 108, 97, 115, 115, 32, 32, 32, 47,
+47, 32, 100, 101, 102, 105, 110, 101, 32, 105, 95, 107, 101, 121, 114,
+97, 119, 44, 32, 97, 110, 100, 32, 98, 105, 110, 100, 32, 105, 95, 99,
+109, 112, 44, 32, 105, 95, 101, 113, 44, 32, 105, 95, 104, 97, 115,
+104, 32, 34, 99, 108, 97, 115, 115, 32, 109, 101, 109, 98, 101, 114,
+115, 34, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 114, 97, 119,
+99, 108, 97, 115, 115, 32, 32, 32, 47, 47, 32, 91, 100, 101, 112, 114,
+101, 99, 97, 116, 101, 100, 93, 32, 102, 111, 114, 32, 105, 95, 99,
+109, 112, 99, 108, 97, 115, 115, 10, 35, 117, 110, 100, 101, 102, 32,
+105, 95, 107, 101, 121, 99, 108, 111, 110, 101, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 107, 101, 121, 100, 114, 111, 112, 10, 35, 117,
+110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 114, 97, 119, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 102, 114, 111,
+109, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 107, 101, 121, 116,
+111, 114, 97, 119, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 99,
+109, 112, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 108, 101, 115,
+115, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 101, 113, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 104, 97, 115, 104, 10, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 112, 114, 111, 32, 32, 32,
+32, 32, 47, 47, 32, 82, 101, 112, 108, 97, 99, 101, 115, 32, 110, 101,
+120, 116, 32, 116, 119, 111, 10, 35, 117, 110, 100, 101, 102, 32, 105,
+95, 118, 97, 108, 95, 115, 116, 114, 32, 32, 32, 32, 47, 47, 32, 91,
+100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 93, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 95, 97, 114, 99, 98, 111,
+120, 32, 47, 47, 32, 91, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 93, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108,
+99, 108, 97, 115, 115, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95,
+118, 97, 108, 99, 108, 111, 110, 101, 10, 35, 117, 110, 100, 101, 102,
+32, 105, 95, 118, 97, 108, 100, 114, 111, 112, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 118, 97, 108, 114, 97, 119, 10, 35, 117, 110,
+100, 101, 102, 32, 105, 95, 118, 97, 108, 102, 114, 111, 109, 10, 35,
+117, 110, 100, 101, 102, 32, 105, 95, 118, 97, 108, 116, 111, 114, 97,
+119, 10, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 117, 115, 101,
+95, 99, 109, 112, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 117,
+115, 101, 95, 101, 113, 10, 35, 117, 110, 100, 101, 102, 32, 105, 95,
+110, 111, 95, 104, 97, 115, 104, 10, 35, 117, 110, 100, 101, 102, 32,
+105, 95, 110, 111, 95, 99, 108, 111, 110, 101, 10, 35, 117, 110, 100,
+101, 102, 32, 105, 95, 110, 111, 95, 101, 109, 112, 108, 97, 99, 101,
+10, 35, 117, 110, 100, 101, 102, 32, 105, 95, 100, 101, 99, 108, 97,
+114, 101, 100, 10, 10, 35, 117, 110, 100, 101, 102, 32, 95, 105, 95,
+104, 97, 115, 95, 99, 109, 112, 10, 35, 117, 110, 100, 101, 102, 32,
+95, 105, 95, 104, 97, 115, 95, 101, 113, 10, 35, 117, 110, 100, 101,
+102, 32, 95, 105, 95, 112, 114, 101, 102, 105, 120, 10, 35, 117, 110,
+100, 101, 102, 32, 95, 105, 95, 116, 101, 109, 112, 108, 97, 116, 101,
+10, 35, 117, 110, 100, 101, 102, 32, 83, 101, 108, 102, 10, 47, 47,
+32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69, 95, 73, 78, 67,
+76, 85, 68, 69, 58, 32, 116, 101, 109, 112, 108, 97, 116, 101, 50, 46,
+104, 10, 47, 47, 32, 35, 35, 35, 32, 69, 78, 68, 95, 70, 73, 76, 69,
+95, 73, 78, 67, 76, 85, 68, 69, 58, 32, 118, 101, 99, 46, 104, 10, 10,
+0};
@@ -0,0 +1,472 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+
+static const char* override_name;
+static const char* override_contents;
+static char changed_header[128];
+
+static bool load_with_override(const char* filename, char** contents, size_t* size) {
+  if (override_name && strcmp(filename, override_name) == 0) {
+    *size = strlen(override_contents);
+    *contents = malloc(*size);
+    memcpy(*contents, override_contents, *size);
+    return true;
+  }
+  return get_file_by_name(filename, contents, size);
+}
+
+// Builds value.c in a new context with the same cache, as a later process
+// would, and returns how many files were loaded from the cache * 1000 + value().
+int from_cache(int variant) {
+  override_name = NULL;
+  if (variant == 1) {
+    // Different for each run, so that it's never in the cache to start with.
+    if (!changed_header[0]) {
+      snprintf(changed_header, sizeof(changed_header), "#define SCALE 4\n// %lld %p\n",
+               (long long)time(NULL), (void*)&variant);
+    }
+    override_name = "value.h";
+    override_contents = changed_header;
+  } else if (variant == 2) {
+    override_name = "value.c";
+    override_contents = "#include \"value.h\"\n#include <stddef.h>\nstatic int table[(size_t)3] = {1, 2, 3};\nint* entry = &table[1];\nconst char* greeting = \"hi\";\nstatic int twice(int x) {\n  return x * 2;\n}\nint value(void) {\n  return twice(SCALE * 6) + *entry + (greeting[1] == 'i');\n}";
+  } else if (variant == 3) {
+    // value.c's "value.h" wasn't found next to it when it was saved, but now
+    // is, and shadows the one that's loaded by name.
+    FILE* fp = fopen("./value.h", "wb");
+    fputs("#define SCALE 5\n", fp);
+    fclose(fp);
+  } else if (variant == 4) {
+    override_name = "value.c";
+    override_contents = "int value(void) {\n  return sizeof(__DATE__) + sizeof(__TIME__);\n}\n";
+  }
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"value.c", "value.h", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = load_with_override,
+      .cache_dir = "update_cache.tmp",
+      .profile_branches = variant == 5,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -1;
+  if (dyibicc_update(ctx, NULL, NULL)) {
+    DyibiccStats stats;
+    dyibicc_get_stats(ctx, &stats);
+    int (*value)(void) = (int (*)(void))dyibicc_find_export(ctx, "value");
+    result = (int)stats.files_from_cache * 1000 + value();
+  }
+  dyibicc_free(ctx);
+  if (variant == 3)
+    remove("./value.h");
+  return result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("from_cache", name) == 0) return (void*)from_cache;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x30,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(72);
+    memcpy(*contents, initial_0, 72);
+    *size = 72;
+    return true;
+  }
+
+  if (strcmp("value.c", filename) == 0) {
+    static char initial_1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x76,0x61,0x6c,0x75,0x65,0x2e,0x68,0x22,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x64,0x65,0x66,0x2e,0x68,0x3e,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x61,0x62,0x6c,0x65,0x5b,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x33,0x5d,0x20,0x3d,0x20,0x7b,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x7d,0x3b,0xa,0x69,0x6e,0x74,0x2a,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x26,0x74,0x61,0x62,0x6c,0x65,0x5b,0x31,0x5d,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x53,0x43,0x41,0x4c,0x45,0x20,0x2a,0x20,0x35,0x29,0x20,0x2b,0x20,0x2a,0x65,0x6e,0x74,0x72,0x79,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(256);
+    memcpy(*contents, initial_1, 256);
+    *size = 256;
+    return true;
+  }
+
+  if (strcmp("value.h", filename) == 0) {
+    static char initial_2[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x43,0x41,0x4c,0x45,0x20,0x33,0xa,'\0'};
+    *contents = malloc(16);
+    memcpy(*contents, initial_2, 16);
+    *size = 16;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", "value.c", "value.h", NULL
+  };
+
+
+#if defined(_WIN32)
+  _mkdir("update_cache.tmp");
+#else
+  mkdir("update_cache.tmp", 0755);
+#endif
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .cache_dir = "update_cache.tmp",
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x30,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x76,0x61,0x6c,0x75,0x65,0x2e,0x68,0x22,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x64,0x65,0x66,0x2e,0x68,0x3e,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x61,0x62,0x6c,0x65,0x5b,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x33,0x5d,0x20,0x3d,0x20,0x7b,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x7d,0x3b,0xa,0x69,0x6e,0x74,0x2a,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x26,0x74,0x61,0x62,0x6c,0x65,0x5b,0x31,0x5d,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x53,0x43,0x41,0x4c,0x45,0x20,0x2a,0x20,0x35,0x29,0x20,0x2b,0x20,0x2a,0x65,0x6e,0x74,0x72,0x79,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("value.c", contents_step1);
+  if (!dyibicc_update(ctx, "value.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step2[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x43,0x41,0x4c,0x45,0x20,0x33,0xa,'\0'};
+  set_updated_contents("value.h", contents_step2);
+  if (!dyibicc_update(ctx, "value.h", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 2033) {
+      printf("update_cache.py:126: got %d, but expected %d\n", result, 2033);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:126: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step4[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x31,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step4);
+  if (!dyibicc_update(ctx, "main.c", contents_step4)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 43) {
+      printf("update_cache.py:132: got %d, but expected %d\n", result, 43);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:132: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 2043) {
+      printf("update_cache.py:135: got %d, but expected %d\n", result, 2043);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:135: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step7[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x32,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step7);
+  if (!dyibicc_update(ctx, "main.c", contents_step7)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step8[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x76,0x61,0x6c,0x75,0x65,0x2e,0x68,0x22,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x64,0x65,0x66,0x2e,0x68,0x3e,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x61,0x62,0x6c,0x65,0x5b,0x28,0x73,0x69,0x7a,0x65,0x5f,0x74,0x29,0x33,0x5d,0x20,0x3d,0x20,0x7b,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x7d,0x3b,0xa,0x69,0x6e,0x74,0x2a,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x26,0x74,0x61,0x62,0x6c,0x65,0x5b,0x31,0x5d,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x53,0x43,0x41,0x4c,0x45,0x20,0x2a,0x20,0x36,0x29,0x20,0x2b,0x20,0x2a,0x65,0x6e,0x74,0x72,0x79,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("value.c", contents_step8);
+  if (!dyibicc_update(ctx, "value.c", contents_step8)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 2039) {
+      printf("update_cache.py:142: got %d, but expected %d\n", result, 2039);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:142: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step10[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x33,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step10);
+  if (!dyibicc_update(ctx, "main.c", contents_step10)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1063) {
+      printf("update_cache.py:147: got %d, but expected %d\n", result, 1063);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:147: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step12[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x34,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step12);
+  if (!dyibicc_update(ctx, "main.c", contents_step12)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1021) {
+      printf("update_cache.py:152: got %d, but expected %d\n", result, 1021);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:152: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1021) {
+      printf("update_cache.py:153: got %d, but expected %d\n", result, 1021);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:153: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step15[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x30,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step15);
+  if (!dyibicc_update(ctx, "main.c", contents_step15)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1039) {
+      printf("update_cache.py:160: got %d, but expected %d\n", result, 1039);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:160: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step17[] = {0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x69,0x6e,0x74,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x63,0x61,0x63,0x68,0x65,0x28,0x35,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step17);
+  if (!dyibicc_update(ctx, "main.c", contents_step17)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 39) {
+      printf("update_cache.py:163: got %d, but expected %d\n", result, 39);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_cache.py:163: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
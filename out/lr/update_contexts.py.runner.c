@@ -0,0 +1,261 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Each tenant's context has a file of the same name, with its own contents.
+typedef struct Tenant {
+  const char* source;
+  int result;
+} Tenant;
+
+static Tenant tenants[] = {
+    {"int counter = 10; int bump(void) { return ++counter; }\n", 0},
+    {"int counter = 20; int bump(void) { return counter += 2; }\n", 0},
+};
+
+static bool load_tenant_file(Tenant* t, const char* path, char** contents, size_t* size) {
+  if (strcmp(path, "tenant.c") == 0) {
+    *size = strlen(t->source);
+    *contents = malloc(*size);
+    memcpy(*contents, t->source, *size);
+    return true;
+  }
+  return false;
+}
+
+static bool load_tenant0(const char* path, char** contents, size_t* size) {
+  return load_tenant_file(&tenants[0], path, contents, size);
+}
+
+static bool load_tenant1(const char* path, char** contents, size_t* size) {
+  return load_tenant_file(&tenants[1], path, contents, size);
+}
+
+static void run_tenant(Tenant* t) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"tenant.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = t == &tenants[0] ? load_tenant0 : load_tenant1,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  for (int i = 0; i < 50; ++i) {
+    if (!dyibicc_update(ctx, NULL, NULL)) {
+      t->result = -1;
+      break;
+    }
+    int (*bump)(void) = (int (*)(void))dyibicc_find_export(ctx, "bump");
+    t->result = bump();
+  }
+  dyibicc_free(ctx);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI tenant_thread(LPVOID arg) {
+  run_tenant(arg);
+  return 0;
+}
+#else
+static void* tenant_thread(void* arg) {
+  run_tenant(arg);
+  return NULL;
+}
+#endif
+
+// Builds and rebuilds two more contexts concurrently on other threads while
+// the test's own context is in the middle of running code.
+int run_tenants(void) {
+#if defined(_WIN32)
+  HANDLE threads[2];
+  for (int i = 0; i < 2; ++i)
+    threads[i] = CreateThread(NULL, 0, tenant_thread, &tenants[i], 0, NULL);
+  WaitForMultipleObjects(2, threads, TRUE, INFINITE);
+  for (int i = 0; i < 2; ++i)
+    CloseHandle(threads[i]);
+#else
+  pthread_t threads[2];
+  for (int i = 0; i < 2; ++i)
+    pthread_create(&threads[i], NULL, tenant_thread, &tenants[i]);
+  for (int i = 0; i < 2; ++i)
+    pthread_join(threads[i], NULL);
+#endif
+  // Data persists across updates, so each tenant's counter has been bumped by
+  // every update.
+  return tenants[0].result * 100 + tenants[1].result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("run_tenants", name) == 0) return (void*)run_tenants;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x5f,0x74,0x65,0x6e,0x61,0x6e,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x35,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x75,0x6e,0x5f,0x74,0x65,0x6e,0x61,0x6e,0x74,0x73,0x28,0x29,0x20,0x2b,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x2b,0x2b,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(95);
+    memcpy(*contents, initial_0, 95);
+    *size = 95;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x5f,0x74,0x65,0x6e,0x61,0x6e,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x35,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x75,0x6e,0x5f,0x74,0x65,0x6e,0x61,0x6e,0x74,0x73,0x28,0x29,0x20,0x2b,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x2b,0x2b,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 6125) {
+      printf("update_contexts.py:111: got %d, but expected %d\n", result, 6125);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_contexts.py:111: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x5f,0x74,0x65,0x6e,0x61,0x6e,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x35,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x2b,0x2b,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 6) {
+      printf("update_contexts.py:117: got %d, but expected %d\n", result, 6);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_contexts.py:117: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,205 @@
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+struct jit_code_entry {
+  struct jit_code_entry* next_entry;
+  struct jit_code_entry* prev_entry;
+  const char* symfile_addr;
+  uint64_t symfile_size;
+};
+
+struct jit_descriptor {
+  uint32_t version;
+  uint32_t action_flag;
+  struct jit_code_entry* relevant_entry;
+  struct jit_code_entry* first_entry;
+};
+
+extern struct jit_descriptor __jit_debug_descriptor;
+#endif
+
+// Returns 10 for each debug object registered with gdb that's an ELF file
+// with a symbol for twice(), and 1 for any others. Halved by twice().
+int count_debug_objects(void) {
+  int result = 0;
+#if defined(__linux__)
+  for (struct jit_code_entry* e = __jit_debug_descriptor.first_entry; e; e = e->next_entry) {
+    int has_twice = 0;
+    for (uint64_t i = 0; i + 6 <= e->symfile_size && !has_twice; ++i) {
+      has_twice = memcmp(e->symfile_addr + i, "twice", 6) == 0;
+    }
+    result += memcmp(e->symfile_addr, "\x7f" "ELF", 4) == 0 && has_twice ? 10 : 1;
+  }
+#endif
+  return result / 2;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("count_debug_objects", name) == 0) return (void*)count_debug_objects;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(126);
+    memcpy(*contents, initial_0, 126);
+    *size = 126;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .generate_debug_symbols = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 10) {
+      printf("update_gdbjit.py:60: got %d, but expected %d\n", result, 10);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_gdbjit.py:60: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x32,0x20,0x2a,0x20,0x78,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x64,0x65,0x62,0x75,0x67,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x28,0x29,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 20) {
+      printf("update_gdbjit.py:66: got %d, but expected %d\n", result, 20);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_gdbjit.py:66: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
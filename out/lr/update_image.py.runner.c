@@ -0,0 +1,248 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+void* get_host_helper_func(const char* name);
+extern DyibiccContext* test_context;
+
+static char value_updated[] = "int counter; int value(void) { return counter + 7; }";
+
+// Writes a copy of the image without the last byte of its code area, and
+// returns whether loading it into a new context with |env_data| is refused.
+static bool truncated_image_refused(DyibiccEnviromentData* env_data) {
+  FILE* fp = fopen("update_image.tmp", "rb");
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  rewind(fp);
+  char* data = malloc(size);
+  fread(data, 1, size, fp);
+  fclose(fp);
+  fp = fopen("update_image.tmp.truncated", "wb");
+  fwrite(data, 1, size - 1, fp);
+  fclose(fp);
+  free(data);
+
+  DyibiccContext* ctx = dyibicc_set_environment(env_data);
+  bool refused = !dyibicc_load_image(ctx, "update_image.tmp.truncated");
+  dyibicc_free(ctx);
+  return refused;
+}
+
+// Saves test_context to an image and starts a new context from it, as a later
+// process would. Returns value() * 100 + value() after updating value.c in the
+// new context, or a negative number if something failed.
+int from_image(void) {
+  if (!dyibicc_save_image(test_context, "update_image.tmp"))
+    return -1;
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"main.c", "value.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+  };
+  if (!truncated_image_refused(&env_data))
+    return -4;
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -2;
+  if (dyibicc_load_image(ctx, "update_image.tmp")) {
+    int (*value)(void) = (int (*)(void))dyibicc_find_export(ctx, "value");
+    result = value() * 100;
+    if (dyibicc_update(ctx, "value.c", value_updated)) {
+      value = (int (*)(void))dyibicc_find_export(ctx, "value");
+      result += value();
+    } else {
+      result = -3;
+    }
+  }
+  dyibicc_free(ctx);
+  return result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("from_image", name) == 0) return (void*)from_image;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(92);
+    memcpy(*contents, initial_0, 92);
+    *size = 92;
+    return true;
+  }
+
+  if (strcmp("value.c", filename) == 0) {
+    static char initial_1[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x61,0x62,0x6c,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x7d,0x3b,0xa,0x69,0x6e,0x74,0x2a,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x26,0x74,0x61,0x62,0x6c,0x65,0x5b,0x31,0x5d,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x31,0x30,0x3b,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2b,0x2b,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x2a,0x20,0x31,0x30,0x30,0x20,0x2b,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x2a,0x65,0x6e,0x74,0x72,0x79,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(232);
+    memcpy(*contents, initial_1, 232);
+    *size = 232;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", "value.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x61,0x62,0x6c,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x7d,0x3b,0xa,0x69,0x6e,0x74,0x2a,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x26,0x74,0x61,0x62,0x6c,0x65,0x5b,0x31,0x5d,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x31,0x30,0x3b,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2b,0x2b,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x20,0x2a,0x20,0x31,0x30,0x30,0x20,0x2b,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x2a,0x65,0x6e,0x74,0x72,0x79,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("value.c", contents_step1);
+  if (!dyibicc_update(ctx, "value.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 110518) {
+      printf("update_image.py:100: got %d, but expected %d\n", result, 110518);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_image.py:100: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step3[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0x20,0x28,0x76,0x6f,0x69,0x64,0x29,0x5f,0x52,0x65,0x66,0x6c,0x65,0x63,0x74,0x54,0x79,0x70,0x65,0x4f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x69,0x6d,0x61,0x67,0x65,0x28,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step3);
+  if (!dyibicc_update(ctx, "main.c", contents_step3)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != -1) {
+      printf("update_image.py:105: got %d, but expected %d\n", result, -1);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_image.py:105: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
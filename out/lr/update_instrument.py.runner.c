@@ -0,0 +1,210 @@
+
+#include <string.h>
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+static int enters;
+static int exits;
+static int depth;
+
+void hook_enter(void* function, void* call_site) {
+  if (function && call_site)
+    ++enters;
+  ++depth;
+}
+
+void hook_exit(void* function, void* call_site) {
+  // Clobbers xmm0, which holds half()'s result.
+  volatile double d = 1.5;
+  d *= 3;
+  if (function && call_site && depth > 0)
+    ++exits;
+  --depth;
+}
+
+// Returns 100 for each call of an instrumented function so far, 10 for each
+// return, and 1 if add() was counted with its cycles, then starts counting
+// again.
+int check_instrument(void) {
+  int result = enters * 100 + exits * 10;
+  DyibiccInstrumentCounters counters[8];
+  size_t n = dyibicc_get_instrument_counters(test_context, counters, 8);
+  for (size_t i = 0; i < n && i < 8; ++i) {
+    if (strcmp(counters[i].name, "add") == 0 && counters[i].calls == 5 &&
+        counters[i].cycles > 0)
+      result += 1;
+  }
+  enters = exits = 0;
+  return result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("check_instrument", name) == 0) return (void*)check_instrument;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x29,0x29,0x20,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x20,0x2b,0x20,0x62,0x3b,0xa,0x7d,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x29,0x29,0x3b,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2f,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x35,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x61,0x64,0x64,0x28,0x69,0x2c,0x20,0x31,0x29,0x20,0x2b,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x68,0x61,0x6c,0x66,0x28,0x38,0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(371);
+    memcpy(*contents, initial_0, 371);
+    *size = 371;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .instrument_enter = hook_enter,
+      .instrument_exit = hook_exit,
+      .instrument_cycles = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x29,0x29,0x20,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x20,0x2b,0x20,0x62,0x3b,0xa,0x7d,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x29,0x29,0x3b,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2f,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x35,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x61,0x64,0x64,0x28,0x69,0x2c,0x20,0x31,0x29,0x20,0x2b,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x68,0x61,0x6c,0x66,0x28,0x38,0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 685) {
+      printf("update_instrument.py:75: got %d, but expected %d\n", result, 685);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_instrument.py:75: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x20,0x2b,0x20,0x62,0x3b,0xa,0x7d,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x29,0x29,0x3b,0xa,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x68,0x61,0x6c,0x66,0x28,0x64,0x6f,0x75,0x62,0x6c,0x65,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2f,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x35,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x61,0x64,0x64,0x28,0x69,0x2c,0x20,0x31,0x29,0x20,0x2b,0x20,0x70,0x6c,0x61,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x68,0x61,0x6c,0x66,0x28,0x38,0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x69,0x6e,0x73,0x74,0x72,0x75,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 134) {
+      printf("update_instrument.py:80: got %d, but expected %d\n", result, 134);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_instrument.py:80: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,161 @@
+
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+#if !defined(_WIN32)
+// The registers run out at |g|, so |x| goes on the stack at a 16 byte aligned
+// offset with a hole before it, and |h| after it.
+long host_stack_int128(long a, long b, long c, long d, long e, long f, long g, __int128 x,
+                       long h) {
+  return (long)(x >> 64) * 1000 + (long)x * 10 + h + (a + b + c + d + e + f + g) * 0;
+}
+
+// Calls the compiled function of the same shape the other way round.
+long call_jit_stack_int128(void) {
+  long (*fn)(long, long, long, long, long, long, long, __int128, long) =
+      (long (*)(long, long, long, long, long, long, long, __int128, long))dyibicc_find_export(
+          test_context, "jit_stack_int128");
+  return fn(1, 2, 3, 4, 5, 6, 7, ((__int128)5 << 64) | 6, 4);
+}
+#endif
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("host_stack_int128", name) == 0) return (void*)host_stack_int128;
+  if (strcmp("call_jit_stack_int128", name) == 0) return (void*)call_jit_stack_int128;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x6c,0x6f,0x6e,0x67,0x20,0x68,0x6f,0x73,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x62,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x64,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x65,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x67,0x2c,0x20,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x20,0x78,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x29,0x3b,0xa,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x6c,0x6f,0x6e,0x67,0x20,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x62,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x64,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x65,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x67,0x2c,0x20,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x20,0x78,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x29,0x28,0x78,0x20,0x3e,0x3e,0x20,0x36,0x34,0x29,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x20,0x2b,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x29,0x78,0x20,0x2a,0x20,0x31,0x30,0x20,0x2b,0x20,0x68,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x6f,0x73,0x74,0x20,0x3d,0x20,0x68,0x6f,0x73,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x2c,0x20,0x34,0x2c,0x20,0x35,0x2c,0x20,0x36,0x2c,0x20,0x37,0x2c,0x20,0x28,0x28,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x29,0x33,0x20,0x3c,0x3c,0x20,0x36,0x34,0x29,0x20,0x7c,0x20,0x32,0x2c,0x20,0x39,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x68,0x6f,0x73,0x74,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x30,0x20,0x2b,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(483);
+    memcpy(*contents, initial_0, 483);
+    *size = 483;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x6c,0x6f,0x6e,0x67,0x20,0x68,0x6f,0x73,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x62,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x64,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x65,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x67,0x2c,0x20,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x20,0x78,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x29,0x3b,0xa,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x6c,0x6f,0x6e,0x67,0x20,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x6c,0x6f,0x6e,0x67,0x20,0x61,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x62,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x63,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x64,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x65,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x66,0x2c,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x67,0x2c,0x20,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x20,0x78,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x29,0x28,0x78,0x20,0x3e,0x3e,0x20,0x36,0x34,0x29,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x20,0x2b,0x20,0x28,0x6c,0x6f,0x6e,0x67,0x29,0x78,0x20,0x2a,0x20,0x31,0x30,0x20,0x2b,0x20,0x68,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x68,0x6f,0x73,0x74,0x20,0x3d,0x20,0x68,0x6f,0x73,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x2c,0x20,0x34,0x2c,0x20,0x35,0x2c,0x20,0x36,0x2c,0x20,0x37,0x2c,0x20,0x28,0x28,0x5f,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x29,0x33,0x20,0x3c,0x3c,0x20,0x36,0x34,0x29,0x20,0x7c,0x20,0x32,0x2c,0x20,0x39,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x68,0x6f,0x73,0x74,0x20,0x2a,0x20,0x31,0x30,0x30,0x30,0x30,0x20,0x2b,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6a,0x69,0x74,0x5f,0x73,0x74,0x61,0x63,0x6b,0x5f,0x69,0x6e,0x74,0x31,0x32,0x38,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 30295064) {
+      printf("update_int128_abi.py:51: got %d, but expected %d\n", result, 30295064);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_int128_abi.py:51: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,2 @@
+int lib_value(void);
+int main(void) { return lib_value(); }
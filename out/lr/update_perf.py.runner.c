@@ -0,0 +1,230 @@
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+// Returns 100 for each line for twice() in the perf map, 10 for each load of
+// it in the jitdump, 1000 for each load of its out of line code, and 2 if the
+// jitdump has any line info. Halved by twice().
+int check_perf(void) {
+  int result = 0;
+  bool has_lines = false;
+#if defined(__linux__)
+  char path[256];
+  char line[256];
+  snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+  FILE* fp = fopen(path, "r");
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* name = strrchr(line, ' ');
+    if (name && strcmp(name, " twice\n") == 0)
+      result += 100;
+  }
+  if (fp)
+    fclose(fp);
+
+  snprintf(path, sizeof(path), "update_perf_jit/jit-%d.dump", (int)getpid());
+  fp = fopen(path, "rb");
+  uint32_t header[10];
+  if (fp && fread(header, sizeof(header), 1, fp) == 1 && header[0] == 0x4A695444) {
+    uint32_t record[4];
+    while (fread(record, sizeof(record), 1, fp) == 1) {
+      char body[4096];
+      size_t size = record[1] - sizeof(record);
+      if (size > sizeof(body) || fread(body, size, 1, fp) != 1)
+        break;
+      // The name follows pid, tid, vma, code_addr, code_size, code_index.
+      if (record[0] == 0 && strcmp(body + 40, "twice") == 0)
+        result += 10;
+      if (record[0] == 0 && strcmp(body + 40, "twice.cold") == 0)
+        result += 1000;
+      if (record[0] == 2)
+        has_lines = true;
+    }
+  }
+  if (fp)
+    fclose(fp);
+#endif
+  if (has_lines)
+    result += 2;
+  return result / 2;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("check_perf", name) == 0) return (void*)check_perf;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x5f,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x5f,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x78,0x20,0x3c,0x20,0x30,0x2c,0x20,0x30,0x29,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(156);
+    memcpy(*contents, initial_0, 156);
+    *size = 156;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+#if defined(_WIN32)
+  _mkdir("update_perf_jit");
+#else
+  mkdir("update_perf_jit", 0755);
+#endif
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .perf_map = true,
+      .jitdump_dir = "update_perf_jit",
+      .generate_debug_symbols = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x5f,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x5f,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x78,0x20,0x3c,0x20,0x30,0x2c,0x20,0x30,0x29,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1112) {
+      printf("update_perf.py:83: got %d, but expected %d\n", result, 1112);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_perf.py:83: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x5f,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x5f,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x78,0x20,0x3c,0x20,0x30,0x2c,0x20,0x30,0x29,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x32,0x20,0x2a,0x20,0x78,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x77,0x69,0x63,0x65,0x28,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x65,0x72,0x66,0x28,0x29,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 2222) {
+      printf("update_perf.py:88: got %d, but expected %d\n", result, 2222);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_perf.py:88: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,247 @@
+
+#include <stdio.h>
+#include <string.h>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+#include "libdyibicc.h"
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+void* get_host_helper_func(const char* name);
+extern DyibiccContext* test_context;
+
+// Returns how many times classify()'s out of line code was written to the perf
+// map, or -1 where there's no perf map (and nothing is moved out of line).
+static int count_cold_classify(void) {
+#if defined(__linux__)
+  char path[64];
+  char line[256];
+  snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+  FILE* fp = fopen(path, "r");
+  int count = 0;
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* name = strrchr(line, ' ');
+    if (name && strcmp(name, " classify.cold\n") == 0)
+      ++count;
+  }
+  if (fp)
+    fclose(fp);
+  return count;
+#else
+  return -1;
+#endif
+}
+
+// Dumps the profile and checks classify()'s counts: the two branches of the
+// if, then each case, for however many times run() has been called. Then
+// compiles the same code in a new context with the profile loaded, and checks
+// that it gets the same |result|, and that the never taken `return -1` was
+// moved out of line. Returns |result| plus 100000 if the counts were right,
+// 10000 if the result was, and 1000000 if the layout was.
+int check_profile(int result) {
+  static const char* expected_counts[] = {"\t0 100 34 33 33\n", "\t0 200 68 66 66\n"};
+  static int runs;
+  if (!dyibicc_dump_profile(test_context, "update_profile.tmp"))
+    return -1;
+
+  int counts_ok = 0;
+  FILE* fp = fopen("update_profile.tmp", "r");
+  char line[256];
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* counts = strstr(line, "\tclassify\t");
+    if (counts && strstr(counts, expected_counts[runs]))
+      counts_ok = 1;
+  }
+  if (fp)
+    fclose(fp);
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"main.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .perf_map = true,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int same = 0;
+  int cold_before = count_cold_classify();
+  if (dyibicc_load_profile(ctx, "update_profile.tmp") && dyibicc_update(ctx, NULL, NULL)) {
+    int (*run)(void) = (int (*)(void))dyibicc_find_export(ctx, "run");
+    same = run() == result;
+  }
+  int cold_after = count_cold_classify();
+  int layout_ok = cold_after == -1 || cold_after == cold_before + 1;
+  dyibicc_free(ctx);
+  ++runs;
+  return result + layout_ok * 1000000 + counts_ok * 100000 + same * 10000;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("check_profile", name) == 0) return (void*)check_profile;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x20,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x28,0x78,0x20,0x25,0x20,0x33,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x30,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x31,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x72,0x75,0x6e,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(353);
+    memcpy(*contents, initial_0, 353);
+    *size = 353;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .profile_branches = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x20,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x28,0x78,0x20,0x25,0x20,0x33,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x30,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x31,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x72,0x75,0x6e,0x28,0x29,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1111099) {
+      printf("update_profile.py:117: got %d, but expected %d\n", result, 1111099);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_profile.py:117: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x20,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x28,0x78,0x20,0x25,0x20,0x33,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x30,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x31,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x3b,0xa,0x20,0x20,0x7d,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x72,0x75,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x63,0x6c,0x61,0x73,0x73,0x69,0x66,0x79,0x28,0x69,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x28,0x72,0x75,0x6e,0x28,0x29,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1111099) {
+      printf("update_profile.py:123: got %d, but expected %d\n", result, 1111099);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_profile.py:123: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,246 @@
+
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+static size_t retired_bytes(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return stats.retired_bytes;
+}
+
+static int (*old_value)(void);
+static int run;
+
+// Stands in for a worker thread that's still running the old code during an
+// update.
+int check(int (*value)(void)) {
+  switch (run++) {
+    case 0:
+      dyibicc_enter(test_context);
+      old_value = value;
+      return value();
+    case 1: {
+      // The old code for value() has been retired, but not freed.
+      int result = old_value() * 10 + value() + (retired_bytes() > 0 ? 100 : 0);
+      dyibicc_thread_quiescent(test_context);
+      dyibicc_leave(test_context);
+      return result;
+    }
+    default:
+      return retired_bytes() == 0 ? value() : -1;
+  }
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("check", name) == 0) return (void*)check;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x69,0x6e,0x74,0x20,0x28,0x2a,0x76,0x61,0x6c,0x75,0x65,0x29,0x28,0x76,0x6f,0x69,0x64,0x29,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x76,0x61,0x6c,0x75,0x65,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(90);
+    memcpy(*contents, initial_0, 90);
+    *size = 90;
+    return true;
+  }
+
+  if (strcmp("value.c", filename) == 0) {
+    static char initial_1[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(32);
+    memcpy(*contents, initial_1, 32);
+    *size = 32;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", "value.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x69,0x6e,0x74,0x20,0x28,0x2a,0x76,0x61,0x6c,0x75,0x65,0x29,0x28,0x76,0x6f,0x69,0x64,0x29,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x76,0x61,0x6c,0x75,0x65,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("value.c", contents_step1);
+  if (!dyibicc_update(ctx, "value.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1) {
+      printf("update_reclaim.py:57: got %d, but expected %d\n", result, 1);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_reclaim.py:57: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step3[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x32,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("value.c", contents_step3);
+  if (!dyibicc_update(ctx, "value.c", contents_step3)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 112) {
+      printf("update_reclaim.py:61: got %d, but expected %d\n", result, 112);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_reclaim.py:61: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step5[] = {0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x33,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("value.c", contents_step5);
+  if (!dyibicc_update(ctx, "value.c", contents_step5)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 3) {
+      printf("update_reclaim.py:66: got %d, but expected %d\n", result, 3);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_reclaim.py:66: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,211 @@
+
+#include "libdyibicc.h"
+#include <stdlib.h>
+#include <string.h>
+
+extern DyibiccContext* test_context;
+
+static int nested_results;
+
+// Called by the inner context's update, where neither a new context nor an
+// update of the test's own one is allowed.
+static bool load_and_nest(const char* path, char** contents, size_t* size) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {NULL};
+  DyibiccEnviromentData env_data = {.include_paths = include_paths, .files = files};
+  if (dyibicc_set_environment(&env_data) == NULL)
+    nested_results += 1;
+  if (!dyibicc_update(test_context, NULL, NULL))
+    nested_results += 10;
+  if (strcmp(path, "inner.c") != 0)
+    return false;
+  const char* source = "int inner(void) { return 7; }\n";
+  *size = strlen(source);
+  *contents = malloc(*size);
+  memcpy(*contents, source, *size);
+  return true;
+}
+
+int build_inner(void) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"inner.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = load_and_nest,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -1;
+  if (dyibicc_update(ctx, NULL, NULL))
+    result = ((int (*)(void))dyibicc_find_export(ctx, "inner"))();
+  dyibicc_free(ctx);
+  return nested_results * 100 + result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("build_inner", name) == 0) return (void*)build_inner;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x62,0x75,0x69,0x6c,0x64,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x75,0x69,0x6c,0x64,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(66);
+    memcpy(*contents, initial_0, 66);
+    *size = 66;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x62,0x75,0x69,0x6c,0x64,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x75,0x69,0x6c,0x64,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1107) {
+      printf("update_reentrant.py:61: got %d, but expected %d\n", result, 1107);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_reentrant.py:61: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x62,0x75,0x69,0x6c,0x64,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x33,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 3) {
+      printf("update_reentrant.py:66: got %d, but expected %d\n", result, 3);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_reentrant.py:66: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
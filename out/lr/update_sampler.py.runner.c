@@ -0,0 +1,208 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+int cpu_ms(void) {
+  return (int)(clock() * 1000 / CLOCKS_PER_SEC);
+}
+
+int profile_start(void) {
+  dyibicc_profiler_start(1000);
+  return 0;
+}
+
+static int profile_contains(DyibiccProfilerFormat format, const char* text) {
+  char line[256];
+  int found = 0;
+  if (!dyibicc_profiler_write("update_sampler.prof", format))
+    return 0;
+  FILE* fp = fopen("update_sampler.prof", "r");
+  while (fp && fgets(line, sizeof(line), fp)) {
+    if (strstr(line, text))
+      found = 1;
+  }
+  if (fp)
+    fclose(fp);
+  return found;
+}
+
+// Returns 1 if spin() is in the flat profile, 10 if main() calling spin() is
+// in the collapsed stacks, and 100 if lines in main.c are in the line profile.
+int profile_check(void) {
+  dyibicc_profiler_stop();
+  return profile_contains(DYIBICC_PROFILER_FLAT, "  spin\n") +
+         10 * profile_contains(DYIBICC_PROFILER_COLLAPSED, "main;spin ") +
+         100 * profile_contains(DYIBICC_PROFILER_LINES, "main.c:");
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("profile_start", name) == 0) return (void*)profile_start;
+  if (strcmp("profile_check", name) == 0) return (void*)profile_check;
+  if (strcmp("cpu_ms", name) == 0) return (void*)cpu_ms;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x70,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3d,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x20,0x2d,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3c,0x20,0x32,0x30,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x26,0x20,0x30,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x73,0x70,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(317);
+    memcpy(*contents, initial_0, 317);
+    *size = 317;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .generate_debug_symbols = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x70,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3d,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x20,0x2d,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3c,0x20,0x32,0x30,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x26,0x20,0x30,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x73,0x70,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 111) {
+      printf("update_sampler.py:74: got %d, but expected %d\n", result, 111);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_sampler.py:74: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x70,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3d,0x20,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x63,0x70,0x75,0x5f,0x6d,0x73,0x28,0x29,0x20,0x2d,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x3c,0x20,0x32,0x30,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x7d,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x26,0x20,0x30,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x73,0x74,0x61,0x72,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x73,0x70,0x69,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x20,0x2b,0x20,0x70,0x72,0x6f,0x66,0x69,0x6c,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 111) {
+      printf("update_sampler.py:79: got %d, but expected %d\n", result, 111);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_sampler.py:79: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,218 @@
+#include <math.h>
+typedef struct TestVec2 { float x; float y; } TestVec2;
+typedef struct TestCam { TestVec2 offset; TestVec2 target; float rotation; float zoom; } TestCam;
+
+#ifndef DEG2RAD
+    #define DEG2RAD (PI/180.0f)
+#endif
+#ifndef PI
+    #define PI 3.14159265358979323846f
+#endif
+
+typedef struct TestVec3 {
+    float x;                // Vector x component
+    float y;                // Vector y component
+    float z;                // Vector z component
+} TestVec3;
+
+typedef struct TestMat {
+    float m0, m4, m8, m12;  // Matrix first row (4 components)
+    float m1, m5, m9, m13;  // Matrix second row (4 components)
+    float m2, m6, m10, m14; // Matrix third row (4 components)
+    float m3, m7, m11, m15; // Matrix fourth row (4 components)
+} TestMat;
+
+TestMat MatrixMultiply(TestMat left, TestMat right)
+{
+    TestMat result = { 0 };
+
+    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+    result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+    result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+    result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+    result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+
+    return result;
+}
+
+TestMat GetCameraMatrix2D(TestCam camera)
+{
+    (void)camera;
+    TestMat matTransform = { 0 };
+    matTransform = MatrixMultiply(matTransform, matTransform);
+    return matTransform;
+}
+
+TestVec3 TestVec3Transform(TestVec3 v, TestMat mat)
+{
+    TestVec3 result = { 0 };
+
+    float x = v.x;
+    float y = v.y;
+    float z = v.z;
+
+    result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+    result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+    result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+
+    return result;
+}
+
+TestVec2 GetScreenToWorld2D(TestCam camera)
+{
+    TestMat x = GetCameraMatrix2D(camera);
+
+    return (TestVec2){ x.m0, x.m1 };
+}
+
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("GetScreenToWorld2D", name) == 0) return (void*)GetScreenToWorld2D;
+  if (strcmp("abort", name) == 0) return (void*)abort;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x74,0x65,0x73,0x74,0x2e,0x68,0x22,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0xa,0xa,0x74,0x79,0x70,0x65,0x64,0x65,0x66,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x7b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0xa,0x7d,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x3b,0xa,0xa,0x74,0x79,0x70,0x65,0x64,0x65,0x66,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x7b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x6f,0x6f,0x6d,0x3b,0xa,0x7d,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x3b,0xa,0xa,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x47,0x65,0x74,0x53,0x63,0x72,0x65,0x65,0x6e,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x32,0x44,0x28,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x29,0x3b,0xa,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x63,0x61,0x6d,0x20,0x3d,0x20,0x7b,0x28,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x29,0x7b,0x30,0x2e,0x66,0x2c,0x20,0x30,0x2e,0x66,0x7d,0x2c,0x20,0x28,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x29,0x7b,0x30,0x2e,0x66,0x2c,0x20,0x30,0x2e,0x66,0x7d,0x2c,0x20,0x30,0x2e,0x66,0x2c,0x20,0x31,0x2e,0x66,0x7d,0x3b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x77,0x20,0x3d,0x20,0x47,0x65,0x74,0x53,0x63,0x72,0x65,0x65,0x6e,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x32,0x44,0x28,0x63,0x61,0x6d,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x77,0x2e,0x78,0x20,0x21,0x3d,0x20,0x30,0x2e,0x66,0x20,0x7c,0x7c,0x20,0x77,0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x2e,0x66,0x29,0x20,0x61,0x62,0x6f,0x72,0x74,0x28,0x29,0x3b,0xa,0xa,0x20,0x20,0x2f,0x2f,0x20,0x54,0x68,0x69,0x73,0x20,0x74,0x65,0x73,0x74,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x72,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x65,0x73,0x74,0x20,0x66,0x6f,0x72,0x20,0x6e,0x6f,0x6e,0x2d,0x73,0x74,0x61,0x63,0x6b,0x20,0x61,0x6c,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x74,0x68,0x61,0x74,0x20,0x77,0x61,0x73,0xa,0x20,0x20,0x2f,0x2f,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x68,0x61,0x70,0x70,0x65,0x6e,0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x57,0x69,0x6e,0x64,0x6f,0x77,0x73,0x20,0x2f,0x4f,0x78,0x20,0x62,0x75,0x69,0x6c,0x64,0x73,0x2e,0x20,0x49,0x74,0x27,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x20,0x67,0x72,0x65,0x61,0x74,0x20,0x74,0x65,0x73,0x74,0x2c,0x20,0x62,0x75,0x74,0xa,0x20,0x20,0x2f,0x2f,0x20,0x77,0x65,0x20,0x68,0x6f,0x70,0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x69,0x74,0x27,0x6c,0x6c,0x20,0x63,0x72,0x61,0x73,0x68,0x20,0x69,0x66,0x20,0x74,0x68,0x65,0x20,0x62,0x75,0x67,0x20,0x6d,0x61,0x6e,0x69,0x66,0x65,0x73,0x74,0x73,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0xa,0xa,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x4f,0x4b,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(655);
+    memcpy(*contents, initial_0, 655);
+    *size = 655;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    "../../test", NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x74,0x65,0x73,0x74,0x2e,0x68,0x22,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0xa,0xa,0x74,0x79,0x70,0x65,0x64,0x65,0x66,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x7b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0xa,0x7d,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x3b,0xa,0xa,0x74,0x79,0x70,0x65,0x64,0x65,0x66,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x7b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0xa,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x6f,0x6f,0x6d,0x3b,0xa,0x7d,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x3b,0xa,0xa,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x47,0x65,0x74,0x53,0x63,0x72,0x65,0x65,0x6e,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x32,0x44,0x28,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x29,0x3b,0xa,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x43,0x61,0x6d,0x20,0x63,0x61,0x6d,0x20,0x3d,0x20,0x7b,0x28,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x29,0x7b,0x30,0x2e,0x66,0x2c,0x20,0x30,0x2e,0x66,0x7d,0x2c,0x20,0x28,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x29,0x7b,0x30,0x2e,0x66,0x2c,0x20,0x30,0x2e,0x66,0x7d,0x2c,0x20,0x30,0x2e,0x66,0x2c,0x20,0x31,0x2e,0x66,0x7d,0x3b,0xa,0x20,0x20,0x54,0x65,0x73,0x74,0x56,0x65,0x63,0x32,0x20,0x77,0x20,0x3d,0x20,0x47,0x65,0x74,0x53,0x63,0x72,0x65,0x65,0x6e,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x32,0x44,0x28,0x63,0x61,0x6d,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x77,0x2e,0x78,0x20,0x21,0x3d,0x20,0x30,0x2e,0x66,0x20,0x7c,0x7c,0x20,0x77,0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x2e,0x66,0x29,0x20,0x61,0x62,0x6f,0x72,0x74,0x28,0x29,0x3b,0xa,0xa,0x20,0x20,0x2f,0x2f,0x20,0x54,0x68,0x69,0x73,0x20,0x74,0x65,0x73,0x74,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x72,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x65,0x73,0x74,0x20,0x66,0x6f,0x72,0x20,0x6e,0x6f,0x6e,0x2d,0x73,0x74,0x61,0x63,0x6b,0x20,0x61,0x6c,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x74,0x68,0x61,0x74,0x20,0x77,0x61,0x73,0xa,0x20,0x20,0x2f,0x2f,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x68,0x61,0x70,0x70,0x65,0x6e,0x69,0x6e,0x67,0x20,0x69,0x6e,0x20,0x57,0x69,0x6e,0x64,0x6f,0x77,0x73,0x20,0x2f,0x4f,0x78,0x20,0x62,0x75,0x69,0x6c,0x64,0x73,0x2e,0x20,0x49,0x74,0x27,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x20,0x67,0x72,0x65,0x61,0x74,0x20,0x74,0x65,0x73,0x74,0x2c,0x20,0x62,0x75,0x74,0xa,0x20,0x20,0x2f,0x2f,0x20,0x77,0x65,0x20,0x68,0x6f,0x70,0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x69,0x74,0x27,0x6c,0x6c,0x20,0x63,0x72,0x61,0x73,0x68,0x20,0x69,0x66,0x20,0x74,0x68,0x65,0x20,0x62,0x75,0x67,0x20,0x6d,0x61,0x6e,0x69,0x66,0x65,0x73,0x74,0x73,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0xa,0xa,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x4f,0x4b,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 0) {
+      printf("update_structabi.py:127: got %d, but expected %d\n", result, 0);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_structabi.py:127: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,150 @@
+#include <stdio.h>
+
+struct B {
+    int x;
+    int y;
+    int z;
+};
+
+void test_f(struct B b) {
+  printf("%d %d %d\n", b.x, b.y, b.z);
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("test_f", name) == 0) return (void*)test_f;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0xa,0xa,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x79,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x7a,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x65,0x78,0x74,0x65,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x65,0x73,0x74,0x5f,0x66,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x62,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x54,0x68,0x69,0x73,0x20,0x77,0x61,0x73,0x20,0x63,0x61,0x75,0x73,0x69,0x6e,0x67,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x75,0x6e,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x64,0x75,0x65,0x20,0x74,0x6f,0x20,0x68,0x6f,0x77,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x6f,0x70,0x79,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0xa,0x2f,0x2f,0x20,0x69,0x6d,0x70,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x65,0x64,0x20,0x69,0x6e,0x20,0x63,0x6f,0x64,0x65,0x67,0x65,0x6e,0x2e,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x62,0x20,0x3d,0x20,0x7b,0x31,0x30,0x2c,0x20,0x32,0x30,0x2c,0x20,0x33,0x30,0x7d,0x3b,0xa,0x20,0x20,0x74,0x65,0x73,0x74,0x5f,0x66,0x28,0x62,0x29,0x3b,0xa,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x4f,0x4b,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(288);
+    memcpy(*contents, initial_0, 288);
+    *size = 288;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    "../../test", NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0xa,0xa,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x79,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x7a,0x3b,0xa,0x7d,0x3b,0xa,0xa,0x65,0x78,0x74,0x65,0x72,0x6e,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x65,0x73,0x74,0x5f,0x66,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x62,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x54,0x68,0x69,0x73,0x20,0x77,0x61,0x73,0x20,0x63,0x61,0x75,0x73,0x69,0x6e,0x67,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x75,0x6e,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x64,0x75,0x65,0x20,0x74,0x6f,0x20,0x68,0x6f,0x77,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x6f,0x70,0x79,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0xa,0x2f,0x2f,0x20,0x69,0x6d,0x70,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x65,0x64,0x20,0x69,0x6e,0x20,0x63,0x6f,0x64,0x65,0x67,0x65,0x6e,0x2e,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x42,0x20,0x62,0x20,0x3d,0x20,0x7b,0x31,0x30,0x2c,0x20,0x32,0x30,0x2c,0x20,0x33,0x30,0x7d,0x3b,0xa,0x20,0x20,0x74,0x65,0x73,0x74,0x5f,0x66,0x28,0x62,0x29,0x3b,0xa,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x4f,0x4b,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 0) {
+      printf("update_structabi2.py:49: got %d, but expected %d\n", result, 0);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_structabi2.py:49: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,215 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("part1.c", filename) == 0) {
+    static char initial_0[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x31,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x31,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(83);
+    memcpy(*contents, initial_0, 83);
+    *size = 83;
+    return true;
+  }
+
+  if (strcmp("part2.c", filename) == 0) {
+    static char initial_1[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x32,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(83);
+    memcpy(*contents, initial_1, 83);
+    *size = 83;
+    return true;
+  }
+
+  if (strcmp("part3.c", filename) == 0) {
+    static char initial_2[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x33,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x33,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(83);
+    memcpy(*contents, initial_2, 83);
+    *size = 83;
+    return true;
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_3[] = {0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(108);
+    memcpy(*contents, initial_3, 108);
+    *size = 108;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "part1.c", "part2.c", "part3.c", "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .num_compile_threads = 3,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x31,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x31,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("part1.c", contents_step0);
+  if (!dyibicc_update(ctx, "part1.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x32,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x32,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("part2.c", contents_step1);
+  if (!dyibicc_update(ctx, "part2.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step2[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x33,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x33,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("part3.c", contents_step2);
+  if (!dyibicc_update(ctx, "part3.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step3[] = {0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x61,0x72,0x74,0x31,0x28,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x33,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step3);
+  if (!dyibicc_update(ctx, "main.c", contents_step3)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 36) {
+      printf("update_threads.py:28: got %d, but expected %d\n", result, 36);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_threads.py:28: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step5[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x6e,0x61,0x6d,0x65,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x70,0x61,0x72,0x74,0x32,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x32,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x6e,0x61,0x6d,0x65,0x29,0x20,0x2a,0x20,0x32,0x30,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("part2.c", contents_step5);
+  if (!dyibicc_update(ctx, "part2.c", contents_step5)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 144) {
+      printf("update_threads.py:32: got %d, but expected %d\n", result, 144);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_threads.py:32: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,208 @@
+
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#define sleep_ms(ms) Sleep(ms)
+#else
+#include <unistd.h>
+#define sleep_ms(ms) usleep((ms) * 1000)
+#endif
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Waits for the two functions that should have been promoted to be compiled
+// again, and returns which ones were: 100 for add(), 10 for sum(), and 1 for
+// anything else.
+int tiers(void) {
+  DyibiccStats stats;
+  for (int i = 0; i < 5000; ++i) {
+    dyibicc_get_stats(test_context, &stats);
+    if (stats.functions_promoted >= 2)
+      break;
+    sleep_ms(1);
+  }
+
+  DyibiccFunctionCounters counters[8];
+  size_t n = dyibicc_get_function_counters(test_context, counters, 8);
+  int result = 0;
+  for (size_t i = 0; i < n && i < 8; ++i) {
+    if (!counters[i].promoted)
+      continue;
+    if (strcmp(counters[i].name, "add") == 0)
+      result += counters[i].calls >= 1000 ? 100 : -1000;
+    else if (strcmp(counters[i].name, "sum") == 0)
+      result += counters[i].backedges >= 10000 ? 10 : -1000;
+    else
+      result += 1;
+  }
+  return result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("tiers", name) == 0) return (void*)tiers;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x69,0x6e,0x74,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x20,0x2b,0x20,0x62,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x73,0x75,0x6d,0x28,0x69,0x6e,0x74,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6e,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x35,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x61,0x64,0x64,0x28,0x74,0x2c,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x21,0x3d,0x20,0x31,0x35,0x30,0x30,0x20,0x7c,0x7c,0x20,0x73,0x75,0x6d,0x28,0x32,0x30,0x30,0x30,0x30,0x29,0x20,0x21,0x3d,0x20,0x31,0x39,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x65,0x64,0x20,0x6f,0x6e,0x63,0x65,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x64,0x2c,0x20,0x69,0x2e,0x65,0x2e,0x20,0x74,0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x75,0x62,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x77,0x20,0x63,0x6f,0x64,0x65,0x2e,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x29,0x20,0x2b,0x20,0x61,0x64,0x64,0x28,0x32,0x2c,0x20,0x33,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(384);
+    memcpy(*contents, initial_0, 384);
+    *size = 384;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .tiered_compilation = true,
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x69,0x6e,0x74,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x20,0x2b,0x20,0x62,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x73,0x75,0x6d,0x28,0x69,0x6e,0x74,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6e,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x35,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x61,0x64,0x64,0x28,0x74,0x2c,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x21,0x3d,0x20,0x31,0x35,0x30,0x30,0x20,0x7c,0x7c,0x20,0x73,0x75,0x6d,0x28,0x32,0x30,0x30,0x30,0x30,0x29,0x20,0x21,0x3d,0x20,0x31,0x39,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x65,0x64,0x20,0x6f,0x6e,0x63,0x65,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x64,0x2c,0x20,0x69,0x2e,0x65,0x2e,0x20,0x74,0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x75,0x62,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x77,0x20,0x63,0x6f,0x64,0x65,0x2e,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x29,0x20,0x2b,0x20,0x61,0x64,0x64,0x28,0x32,0x2c,0x20,0x33,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step0);
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 115) {
+      printf("update_tiered.py:78: got %d, but expected %d\n", result, 115);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_tiered.py:78: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step2[] = {0x69,0x6e,0x74,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x61,0x64,0x64,0x28,0x69,0x6e,0x74,0x20,0x61,0x2c,0x20,0x69,0x6e,0x74,0x20,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x20,0x2b,0x20,0x61,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x73,0x75,0x6d,0x28,0x69,0x6e,0x74,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6e,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x2b,0x3d,0x20,0x69,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x31,0x35,0x30,0x30,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xa,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x61,0x64,0x64,0x28,0x74,0x2c,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x21,0x3d,0x20,0x31,0x35,0x30,0x30,0x20,0x7c,0x7c,0x20,0x73,0x75,0x6d,0x28,0x32,0x30,0x30,0x30,0x30,0x29,0x20,0x21,0x3d,0x20,0x31,0x39,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x29,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x65,0x64,0x20,0x6f,0x6e,0x63,0x65,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,0x64,0x2c,0x20,0x69,0x2e,0x65,0x2e,0x20,0x74,0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x75,0x62,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x77,0x20,0x63,0x6f,0x64,0x65,0x2e,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x69,0x65,0x72,0x73,0x28,0x29,0x20,0x2b,0x20,0x61,0x64,0x64,0x28,0x32,0x2c,0x20,0x33,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step2);
+  if (!dyibicc_update(ctx, "main.c", contents_step2)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 115) {
+      printf("update_tiered.py:83: got %d, but expected %d\n", result, 115);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_tiered.py:83: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,233 @@
+
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Returns 10 if the most recent update copied a header's tokens rather than
+// tokenizing it again.
+int headers_reused(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return stats.headers_reused > 0 ? 10 : 0;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("headers_reused", name) == 0) return (void*)headers_reused;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("shared.h", filename) == 0) {
+    static char initial_0[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x31,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,'\0'};
+    *contents = malloc(53);
+    memcpy(*contents, initial_0, 53);
+    *size = 53;
+    return true;
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x68,0x61,0x72,0x65,0x64,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x2b,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x29,0x20,0x2b,0x20,0x78,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(150);
+    memcpy(*contents, initial_1, 150);
+    *size = 150;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "shared.h", "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x31,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,'\0'};
+  set_updated_contents("shared.h", contents_step0);
+  if (!dyibicc_update(ctx, "shared.h", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x68,0x61,0x72,0x65,0x64,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x2b,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x29,0x20,0x2b,0x20,0x78,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step1);
+  if (!dyibicc_update(ctx, "main.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 111) {
+      printf("update_token_cache.py:36: got %d, but expected %d\n", result, 111);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_token_cache.py:36: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step3[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x32,0xa,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x5d,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,'\0'};
+  set_updated_contents("shared.h", contents_step3);
+  if (!dyibicc_update(ctx, "shared.h", contents_step3)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step4[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x68,0x61,0x72,0x65,0x64,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x31,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x2b,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x29,0x20,0x2b,0x20,0x78,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step4);
+  if (!dyibicc_update(ctx, "main.c", contents_step4)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 103) {
+      printf("update_token_cache.py:42: got %d, but expected %d\n", result, 103);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_token_cache.py:42: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step6[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x68,0x61,0x72,0x65,0x64,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x32,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x56,0x41,0x4c,0x55,0x45,0x20,0x2b,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x5f,0x72,0x65,0x75,0x73,0x65,0x64,0x28,0x29,0x20,0x2b,0x20,0x28,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x29,0x20,0x2b,0x20,0x78,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step6);
+  if (!dyibicc_update(ctx, "main.c", contents_step6)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 114) {
+      printf("update_token_cache.py:46: got %d, but expected %d\n", result, 114);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_token_cache.py:46: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
@@ -0,0 +1,214 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int trace_has(const char* text, const char* contents) {
+  return strstr(contents, text) != NULL;
+}
+
+// Returns 1 if the trace from the most recent update has the header, 10 for
+// the container, 100 for parsing scaled(), and 1000 for the link.
+int check_trace(void) {
+  FILE* fp = fopen("update_trace.json", "rb");
+  if (!fp)
+    return 0;
+  char* contents = calloc(1, 1 << 20);
+  fread(contents, 1, (1 << 20) - 1, fp);
+  fclose(fp);
+  int result = 0;
+  if (trace_has("\"name\":\"include\",\"args\":{\"detail\":\"scale.h\"}", contents))
+    result += 1;
+  if (trace_has("\"name\":\"container\",\"args\":{\"detail\":\"type:vec,arg:int\"}", contents))
+    result += 10;
+  if (trace_has("\"name\":\"parse function\",\"args\":{\"detail\":\"scaled\"}", contents))
+    result += 100;
+  if (trace_has("\"name\":\"link\"", contents) && contents[0] == '{')
+    result += 1000;
+  free(contents);
+  return result;
+}
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  if (strcmp("check_trace", name) == 0) return (void*)check_trace;
+  return NULL;
+
+}
+
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
+  if (strcmp("scale.h", filename) == 0) {
+    static char initial_0[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x43,0x41,0x4c,0x45,0x20,0x32,0xa,'\0'};
+    *contents = malloc(16);
+    memcpy(*contents, initial_0, 16);
+    *size = 16;
+    return true;
+  }
+
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x63,0x61,0x6c,0x65,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x24,0x76,0x65,0x63,0x28,0x69,0x6e,0x74,0x29,0x20,0x76,0x20,0x3d,0x20,0x7b,0x30,0x7d,0x3b,0xa,0x20,0x20,0x76,0x2e,0x2e,0x70,0x75,0x73,0x68,0x5f,0x62,0x61,0x63,0x6b,0x28,0x78,0x20,0x2a,0x20,0x53,0x43,0x41,0x4c,0x45,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2a,0x76,0x2e,0x2e,0x62,0x61,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x31,0x29,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(188);
+    memcpy(*contents, initial_1, 188);
+    *size = 188;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "scale.h", "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+      .time_trace_path = "update_trace.json",
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x43,0x41,0x4c,0x45,0x20,0x32,0xa,'\0'};
+  set_updated_contents("scale.h", contents_step0);
+  if (!dyibicc_update(ctx, "scale.h", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step1[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x63,0x61,0x6c,0x65,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x24,0x76,0x65,0x63,0x28,0x69,0x6e,0x74,0x29,0x20,0x76,0x20,0x3d,0x20,0x7b,0x30,0x7d,0x3b,0xa,0x20,0x20,0x76,0x2e,0x2e,0x70,0x75,0x73,0x68,0x5f,0x62,0x61,0x63,0x6b,0x28,0x78,0x20,0x2a,0x20,0x53,0x43,0x41,0x4c,0x45,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2a,0x76,0x2e,0x2e,0x62,0x61,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x31,0x29,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x29,0x3b,0xa,0x7d,0xa,'\0'};
+  set_updated_contents("main.c", contents_step1);
+  if (!dyibicc_update(ctx, "main.c", contents_step1)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1113) {
+      printf("update_trace.py:59: got %d, but expected %d\n", result, 1113);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_trace.py:59: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  static char contents_step3[] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x73,0x63,0x61,0x6c,0x65,0x2e,0x68,0x22,0xa,0x69,0x6e,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x76,0x6f,0x69,0x64,0x29,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x69,0x6e,0x74,0x20,0x78,0x29,0x20,0x7b,0xa,0x20,0x20,0x24,0x76,0x65,0x63,0x28,0x69,0x6e,0x74,0x29,0x20,0x76,0x20,0x3d,0x20,0x7b,0x30,0x7d,0x3b,0xa,0x20,0x20,0x76,0x2e,0x2e,0x70,0x75,0x73,0x68,0x5f,0x62,0x61,0x63,0x6b,0x28,0x78,0x20,0x2a,0x20,0x53,0x43,0x41,0x4c,0x45,0x29,0x3b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2a,0x76,0x2e,0x2e,0x62,0x61,0x63,0x6b,0x28,0x29,0x3b,0xa,0x7d,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x28,0x32,0x29,0x20,0x2b,0x20,0x63,0x68,0x65,0x63,0x6b,0x5f,0x74,0x72,0x61,0x63,0x65,0x28,0x29,0x3b,0xa,0x7d,'\0'};
+  set_updated_contents("main.c", contents_step3);
+  if (!dyibicc_update(ctx, "main.c", contents_step3)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 1115) {
+      printf("update_trace.py:65: got %d, but expected %d\n", result, 1115);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_trace.py:65: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
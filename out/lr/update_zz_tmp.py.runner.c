@@ -0,0 +1,109 @@
+
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#endif
+
+void* get_host_helper_func(const char* name) {
+  (void)name;
+  return NULL;
+
+}
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  if (strcmp("main.c", filename) == 0) {
+    static char initial_0[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+    *contents = malloc(94);
+    memcpy(*contents, initial_0, 94);
+    *size = 94;
+    return true;
+  }
+
+
+
+  // Otherwise, fallback to normal file loading (for includes, etc.)
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  rewind(fp);
+  *contents = malloc(*size);
+  fread(*contents, 1, *size, fp);
+  fclose(fp);
+  return true;
+}
+
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
+int main(void) {
+  char* include_paths[] = {
+    NULL
+  };
+  char* input_paths[] = {
+    "main.c", NULL
+  };
+
+
+  DyibiccEnviromentData env_data = {
+      .include_paths = (const char**)include_paths,
+      .files = (const char**)input_paths,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .output_function = NULL,
+      .use_ansi_codes = false,
+
+  };
+
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
+
+  int final_result = 0;
+
+  if (!dyibicc_update(ctx, NULL, NULL)) {
+    printf("initial update failed\n");
+    final_result = 255;
+    goto fail;
+  }
+
+
+  static char contents_step0[] = {0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x2a,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x20,0x3d,0x20,0x22,0x68,0x69,0x22,0x3b,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x6f,0x69,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x72,0x65,0x65,0x74,0x69,0x6e,0x67,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x69,0x27,0x20,0x3f,0x20,0x31,0x30,0x30,0x20,0x3a,0x20,0x30,0x3b,0xa,0x7d,0xa,'\0'};
+  if (!dyibicc_update(ctx, "main.c", contents_step0)) {
+    final_result = 255;
+    goto fail;
+  }
+
+
+  {
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  if (entry_point) {
+    int myargc = 1;
+    char* myargv[] = {"prog", NULL};
+    int result = ((int (*)(int, char**))entry_point)(myargc, myargv);
+    if (result != 100) {
+      printf("update_zz_tmp.py:9: got %d, but expected %d\n", result, 100);
+      final_result = 253;
+      goto fail;
+    } else {
+      printf("update_zz_tmp.py:9: OK (%d)\n", result);
+    }
+  } else {
+    printf("no entry point found\n");
+    final_result = 254;
+    goto fail;
+  }
+  }
+
+
+  printf("OK\n");
+fail:
+  dyibicc_free(ctx);
+  return final_result;
+}
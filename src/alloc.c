@@ -4,6 +4,7 @@
 #include <windows.h>
 #include "dyn_basic_pdb.h"
 #else
+#include <pthread.h>
 #include <sys/mman.h>
 #endif
 
@@ -24,40 +25,42 @@ void __asan_unpoison_memory_region(void const volatile* addr, size_t size);
 #define ASAN_UNPOISON_MEMORY_REGION(addr, size) ((void)(addr), (void)(size))
 #endif
 
-IMPLSTATIC UserContext* user_context;
-IMPLSTATIC jmp_buf toplevel_update_jmpbuf;
-IMPLSTATIC CompilerState compiler_state;
-IMPLSTATIC LinkerState linker_state;
+IMPLSTATIC THREAD_LOCAL UserContext* user_context;
+IMPLSTATIC THREAD_LOCAL jmp_buf toplevel_update_jmpbuf;
+IMPLSTATIC THREAD_LOCAL CompilerState compiler_state;
 
-typedef struct HeapData {
-  char* base;
-  char* alloc_pointer;
-  size_t size;
-} HeapData;
-
-static HeapData heap[NUM_BUMP_HEAPS] = {
-    {NULL, NULL, 1024 << 20},  // AL_Compile
-    {NULL, NULL, 128 << 20},   // AL_Temp
-    {NULL, NULL, 128 << 20},   // AL_Link
-    {NULL, NULL, 64 << 20},    // AL_UserContext
+static const size_t heap_sizes[NUM_BUMP_HEAPS] = {
+    1024 << 20,  // AL_Compile
+    128 << 20,   // AL_Temp
+    128 << 20,   // AL_Link
+    64 << 20,    // AL_UserContext
 };
 
+// AL_Compile and AL_Temp are per thread, as files are compiled in parallel.
+// AL_Link and AL_UserContext belong to the current context.
+static THREAD_LOCAL HeapData thread_heap[AL_Link];
+
+static HeapData* get_heap(AllocLifetime lifetime) {
+  return lifetime < AL_Link ? &thread_heap[lifetime] : &user_context->heaps[lifetime - AL_Link];
+}
+
 IMPLSTATIC void alloc_init(AllocLifetime lifetime) {
   assert(lifetime < NUM_BUMP_HEAPS);
-  HeapData* hd = &heap[lifetime];
+  HeapData* hd = get_heap(lifetime);
 
+  hd->size = heap_sizes[lifetime];
   hd->alloc_pointer = hd->base = allocate_writable_memory(hd->size);
   ASAN_POISON_MEMORY_REGION(hd->base, hd->size);
   if (lifetime == AL_Compile) {
     memset(&compiler_state, 0, sizeof(compiler_state));
   } else if (lifetime == AL_Link) {
-    memset(&linker_state, 0, sizeof(linker_state));
+    memset(&user_context->linker_state, 0, sizeof(user_context->linker_state));
   }
 }
 
 IMPLSTATIC void alloc_reset(AllocLifetime lifetime) {
   assert(lifetime < NUM_BUMP_HEAPS);
-  HeapData* hd = &heap[lifetime];
+  HeapData* hd = get_heap(lifetime);
   // We allow double resets because we may longjmp out during error handling,
   // and don't know which heaps are initialized at that point.
   if (hd->base) {
@@ -68,13 +71,59 @@ IMPLSTATIC void alloc_reset(AllocLifetime lifetime) {
   }
 }
 
+// Moves the thread's compiler_state and AL_Compile heap aside, leaving them as
+// if reset, so that something can be compiled in the middle of another compile
+// on the same thread, e.g. a lazy function called from a host callback during
+// an update. alloc_restore_compile() puts them back.
+IMPLSTATIC SavedCompile* alloc_save_compile(void) {
+  SavedCompile* saved = malloc(sizeof(SavedCompile));
+  saved->state = compiler_state;
+  saved->heap = thread_heap[AL_Compile];
+  thread_heap[AL_Compile] = (HeapData){0};
+  return saved;
+}
+
+IMPLSTATIC void alloc_restore_compile(SavedCompile* saved) {
+  compiler_state = saved->state;
+  thread_heap[AL_Compile] = saved->heap;
+  free(saved);
+}
+
+// Hands over the heap's memory to the caller, who's then responsible for
+// releasing it with free_executable_memory(), leaving the heap as if it had
+// been reset. Used to keep a parse around for lazy_compilation.
+IMPLSTATIC HeapData alloc_detach(AllocLifetime lifetime) {
+  assert(lifetime < NUM_BUMP_HEAPS);
+  HeapData* hd = get_heap(lifetime);
+  HeapData ret = *hd;
+#if !X64WIN
+  // Most of the reservation is never touched, so give the rest of it back.
+  size_t used = align_to_u(ret.alloc_pointer - ret.base, get_page_size());
+  if (used < ret.size) {
+    ASAN_UNPOISON_MEMORY_REGION(ret.base + used, ret.size - used);
+    munmap(ret.base + used, ret.size - used);
+    ret.size = used;
+  }
+#endif
+  hd->alloc_pointer = NULL;
+  hd->base = NULL;
+  return ret;
+}
+
+// Bytes allocated from the heap since it was initialized, 0 if it isn't.
+IMPLSTATIC size_t alloc_used(AllocLifetime lifetime) {
+  assert(lifetime < NUM_BUMP_HEAPS);
+  HeapData* hd = get_heap(lifetime);
+  return hd->base ? (size_t)(hd->alloc_pointer - hd->base) : 0;
+}
+
 IMPLSTATIC void* bumpcalloc(size_t num, size_t size, AllocLifetime lifetime) {
   if (lifetime == AL_Manual) {
     return calloc(num, size);
   }
 
   size_t toalloc = align_to_u(num * size, 8);
-  HeapData* hd = &heap[lifetime];
+  HeapData* hd = get_heap(lifetime);
   char* ret = hd->alloc_pointer;
   hd->alloc_pointer += toalloc;
   if (hd->alloc_pointer > hd->base + hd->size) {
@@ -148,15 +197,15 @@ IMPLSTATIC void* allocate_writable_memory(size_t size) {
 
 // Sets a RX permission on the given memory, which must be page-aligned. Returns
 // 0 on success. On failure, prints out the error and returns -1.
-IMPLSTATIC bool make_memory_readwrite(void* m, size_t size) {
+IMPLSTATIC bool make_memory_executable(void* m, size_t size) {
 #if X64WIN
   DWORD old_protect;
-  if (!VirtualProtect(m, size, PAGE_READWRITE, &old_protect)) {
+  if (!VirtualProtect(m, size, PAGE_EXECUTE_READ, &old_protect)) {
     error("VirtualProtect %p %zu failed: 0x%x\n", m, size, GetLastError());
   }
   return true;
 #else
-  if (mprotect(m, size, PROT_READ | PROT_WRITE) == -1) {
+  if (mprotect(m, size, PROT_READ | PROT_EXEC) == -1) {
     perror("mprotect");
     return false;
   }
@@ -164,22 +213,26 @@ IMPLSTATIC bool make_memory_readwrite(void* m, size_t size) {
 #endif
 }
 
-// Sets a RX permission on the given memory, which must be page-aligned. Returns
-// 0 on success. On failure, prints out the error and returns -1.
-IMPLSTATIC bool make_memory_executable(void* m, size_t size) {
-#if X64WIN
-  DWORD old_protect;
-  if (!VirtualProtect(m, size, PAGE_EXECUTE_READ, &old_protect)) {
-    error("VirtualProtect %p %zu failed: 0x%x\n", m, size, GetLastError());
+// Returns |size| bytes of |fp| from |offset| in RW memory that can then be
+// treated the same as that from allocate_writable_memory(). Where possible, and
+// |offset| is on a page boundary, the file is mapped rather than read, so that
+// pages are only loaded as they're touched. Returns NULL on failure.
+IMPLSTATIC void* map_file_memory(FILE* fp, size_t offset, size_t size) {
+#if !X64WIN
+  if (offset % get_page_size() == 0) {
+    void* ptr = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(fp), (off_t)offset);
+    if (ptr != (void*)-1) {
+      ASAN_UNPOISON_MEMORY_REGION(ptr, size);
+      return ptr;
+    }
   }
-  return true;
-#else
-  if (mprotect(m, size, PROT_READ | PROT_EXEC) == -1) {
-    perror("mprotect");
-    return false;
-  }
-  return true;
 #endif
+  char* ptr = allocate_writable_memory(size);
+  if (ptr && (fseek(fp, (long)offset, SEEK_SET) != 0 || fread(ptr, 1, size, fp) != size)) {
+    free_executable_memory(ptr, size);
+    return NULL;
+  }
+  return ptr;
 }
 
 IMPLSTATIC void free_executable_memory(void* p, size_t size) {
@@ -190,7 +243,278 @@ IMPLSTATIC void free_executable_memory(void* p, size_t size) {
   }
   ASAN_POISON_MEMORY_REGION(p, size);
 #else
+  unregister_jit_code(p);
   munmap(p, size);
   ASAN_POISON_MEMORY_REGION(p, size);
 #endif
 }
+
+IMPLSTATIC uint64_t atomic_load_u64(uint64_t* p) {
+#if X64WIN
+  return (uint64_t)InterlockedOr64((volatile LONG64*)p, 0);
+#else
+  return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+#endif
+}
+
+IMPLSTATIC void atomic_store_u64(uint64_t* p, uint64_t value) {
+#if X64WIN
+  InterlockedExchange64((volatile LONG64*)p, (LONG64)value);
+#else
+  __atomic_store_n(p, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static void retire(void* p, size_t size, bool is_executable) {
+  RetiredMemory* r = calloc(1, sizeof(RetiredMemory));
+  r->p = p;
+  r->size = size;
+  r->is_executable = is_executable;
+  r->epoch = atomic_load_u64(&user_context->epoch);
+  // Files compiling on other threads may be retiring things too.
+#if X64WIN
+  RetiredMemory* head;
+  do {
+    head = user_context->retired;
+    r->next = head;
+  } while (InterlockedCompareExchangePointer((PVOID volatile*)&user_context->retired, r, head) !=
+           head);
+#else
+  r->next = __atomic_load_n(&user_context->retired, __ATOMIC_SEQ_CST);
+  while (!__atomic_compare_exchange_n(&user_context->retired, &r->next, r, false, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_SEQ_CST)) {
+  }
+#endif
+}
+
+IMPLSTATIC void retire_executable_memory(void* p, size_t size) {
+  retire(p, size, true);
+}
+
+IMPLSTATIC void retire_aligned(void* p, size_t size) {
+  retire(p, size, false);
+}
+
+// Called after an update is linked, i.e. once nothing new can reach what was
+// retired during it.
+IMPLSTATIC void publish_epoch(UserContext* ctx) {
+  atomic_store_u64(&ctx->epoch, ctx->epoch + 1);
+}
+
+// Frees retired memory that no thread can still be using: anything retired in
+// an epoch before the oldest one that an entered thread has observed. If |all|
+// is set, everything is freed regardless (when the context is being freed).
+IMPLSTATIC void reclaim_retired(UserContext* ctx, bool all) {
+  uint64_t oldest = UINT64_MAX;
+#if X64WIN
+  ThreadRecord* threads = *(ThreadRecord* volatile*)&ctx->threads;
+#else
+  ThreadRecord* threads = __atomic_load_n(&ctx->threads, __ATOMIC_SEQ_CST);
+#endif
+  for (ThreadRecord* t = threads; t; t = t->next) {
+    uint64_t epoch = atomic_load_u64(&t->epoch);
+    if (epoch && epoch < oldest)
+      oldest = epoch;
+  }
+
+  // retire() may be pushing onto the list from other threads, so take the
+  // whole thing, and then put back whatever is kept.
+#if X64WIN
+  RetiredMemory* r =
+      (RetiredMemory*)InterlockedExchangePointer((PVOID volatile*)&ctx->retired, NULL);
+#else
+  RetiredMemory* r = __atomic_exchange_n(&ctx->retired, NULL, __ATOMIC_SEQ_CST);
+#endif
+  RetiredMemory* kept = NULL;
+  RetiredMemory* kept_tail = NULL;
+  while (r) {
+    RetiredMemory* next = r->next;
+    if (all || r->epoch < oldest) {
+      if (r->is_executable)
+        free_executable_memory(r->p, r->size);
+      else
+        aligned_free(r->p);
+      free(r);
+    } else {
+      r->next = kept;
+      kept = r;
+      if (!kept_tail)
+        kept_tail = r;
+    }
+    r = next;
+  }
+
+  if (kept) {
+#if X64WIN
+    RetiredMemory* head;
+    do {
+      head = ctx->retired;
+      kept_tail->next = head;
+    } while (InterlockedCompareExchangePointer((PVOID volatile*)&ctx->retired, kept, head) !=
+             head);
+#else
+    kept_tail->next = __atomic_load_n(&ctx->retired, __ATOMIC_SEQ_CST);
+    while (!__atomic_compare_exchange_n(&ctx->retired, &kept_tail->next, kept, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+    }
+#endif
+  }
+
+  if (all) {
+    ThreadRecord* t = threads;
+    while (t) {
+      ThreadRecord* next = t->next;
+      free(t);
+      t = next;
+    }
+    ctx->threads = NULL;
+  }
+}
+
+// Only its address is used, to identify the thread.
+static THREAD_LOCAL char thread_record_owner;
+
+// Records are only added (lock-free, from any thread), and are freed with the
+// context. A thread may use several contexts, so its record is found by
+// searching the context's list, which holds one per thread that's used it.
+static ThreadRecord* get_thread_record(UserContext* ctx) {
+#if X64WIN
+  ThreadRecord* t = *(ThreadRecord* volatile*)&ctx->threads;
+#else
+  ThreadRecord* t = __atomic_load_n(&ctx->threads, __ATOMIC_SEQ_CST);
+#endif
+  for (; t; t = t->next) {
+    if (t->owner == &thread_record_owner)
+      return t;
+  }
+
+  t = calloc(1, sizeof(ThreadRecord));
+  t->owner = &thread_record_owner;
+#if X64WIN
+  ThreadRecord* head;
+  do {
+    head = ctx->threads;
+    t->next = head;
+  } while (InterlockedCompareExchangePointer((PVOID volatile*)&ctx->threads, t, head) != head);
+#else
+  t->next = __atomic_load_n(&ctx->threads, __ATOMIC_SEQ_CST);
+  while (!__atomic_compare_exchange_n(&ctx->threads, &t->next, t, false, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_SEQ_CST)) {
+  }
+#endif
+  return t;
+}
+
+IMPLSTATIC void thread_quiescent(UserContext* ctx) {
+  ThreadRecord* t = get_thread_record(ctx);
+  // Re-check in case an update was published between reading the epoch and
+  // announcing it, so that a stale epoch isn't recorded after the reclaimer
+  // has already looked at this thread.
+  uint64_t epoch;
+  do {
+    epoch = atomic_load_u64(&ctx->epoch);
+    atomic_store_u64(&t->epoch, epoch);
+  } while (atomic_load_u64(&ctx->epoch) != epoch);
+}
+
+IMPLSTATIC void thread_enter(UserContext* ctx) {
+  thread_quiescent(ctx);
+}
+
+IMPLSTATIC void thread_leave(UserContext* ctx) {
+  atomic_store_u64(&get_thread_record(ctx)->epoch, 0);
+}
+
+IMPLSTATIC void* mutex_create(void) {
+#if X64WIN
+  SRWLOCK* m = calloc(1, sizeof(SRWLOCK));
+  InitializeSRWLock(m);
+#else
+  pthread_mutex_t* m = calloc(1, sizeof(pthread_mutex_t));
+  pthread_mutex_init(m, NULL);
+#endif
+  return m;
+}
+
+IMPLSTATIC void mutex_destroy(void* m) {
+#if !X64WIN
+  pthread_mutex_destroy(m);
+#endif
+  free(m);
+}
+
+IMPLSTATIC void mutex_lock(void* m) {
+#if X64WIN
+  AcquireSRWLockExclusive(m);
+#else
+  pthread_mutex_lock(m);
+#endif
+}
+
+IMPLSTATIC void mutex_unlock(void* m) {
+#if X64WIN
+  ReleaseSRWLockExclusive(m);
+#else
+  pthread_mutex_unlock(m);
+#endif
+}
+
+typedef struct ThreadStart {
+  ThreadFn fn;
+  void* arg;
+#if X64WIN
+  HANDLE handle;
+#else
+  pthread_t handle;
+#endif
+} ThreadStart;
+
+#if X64WIN
+static DWORD WINAPI thread_main(LPVOID param) {
+  ThreadStart* ts = param;
+  ts->fn(ts->arg);
+  return 0;
+}
+#else
+static void* thread_main(void* param) {
+  ThreadStart* ts = param;
+  ts->fn(ts->arg);
+  return NULL;
+}
+#endif
+
+// Returns NULL if the thread couldn't be created.
+IMPLSTATIC Thread* thread_start(ThreadFn fn, void* arg) {
+  ThreadStart* ts = calloc(1, sizeof(ThreadStart));
+  ts->fn = fn;
+  ts->arg = arg;
+#if X64WIN
+  ts->handle = CreateThread(NULL, 0, thread_main, ts, 0, NULL);
+  if (!ts->handle) {
+#else
+  if (pthread_create(&ts->handle, NULL, thread_main, ts) != 0) {
+#endif
+    free(ts);
+    return NULL;
+  }
+  return (Thread*)ts;
+}
+
+IMPLSTATIC void thread_join(Thread* thread) {
+  ThreadStart* ts = (ThreadStart*)thread;
+#if X64WIN
+  WaitForSingleObject(ts->handle, INFINITE);
+  CloseHandle(ts->handle);
+#else
+  pthread_join(ts->handle, NULL);
+#endif
+  free(ts);
+}
+
+IMPLSTATIC uint64_t atomic_fetch_add_u64(uint64_t* p, uint64_t value) {
+#if X64WIN
+  return (uint64_t)InterlockedExchangeAdd64((volatile LONG64*)p, (LONG64)value);
+#else
+  return __atomic_fetch_add(p, value, __ATOMIC_SEQ_CST);
+#endif
+}
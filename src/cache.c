@@ -0,0 +1,535 @@
+#include "dyibicc.h"
+
+#if X64WIN
+#include <process.h>
+#include <windows.h>
+#endif
+
+#define C(x) compiler_state.cache__##x
+
+// The code and data that each file compiles to can be saved in cache_dir, so
+// that a later process can load them rather than compiling the file again.
+//
+// An entry is named by a hash of the compiler build, the options that affect
+// code generation, and the file's name and contents. It also lists each file
+// that was #included along with a hash of its contents, and each path where an
+// #include was looked for but not found, and it's only used if those are all
+// unchanged, i.e. the same headers would be found. (The compiler's own headers
+// and predefined macros are part of the compiler build.) Files that expand
+// __DATE__ or __TIME__ aren't saved.
+//
+// Code only refers to functions and data through symbol slots (see
+// get_symbol_slot()), so loading an entry is mostly a matter of copying the
+// code and pointing those references at this process's slots. The file is
+// then linked as if it had just been compiled.
+
+#define CACHE_MAGIC 0x3245484341435944ULL  // "DYCACHE2"
+
+static const char cache_compiler_build[] = __DATE__ " " __TIME__;
+
+typedef struct CacheWriter {
+  char* data;
+  size_t len;
+  size_t capacity;
+} CacheWriter;
+
+static void put_bytes(CacheWriter* w, const void* p, size_t n) {
+  if (w->len + n > w->capacity) {
+    w->capacity = MAX(w->capacity * 2, w->len + n);
+    w->data = realloc(w->data, w->capacity);
+  }
+  memcpy(w->data + w->len, p, n);
+  w->len += n;
+}
+
+static void put_u64(CacheWriter* w, uint64_t v) {
+  put_bytes(w, &v, sizeof(v));
+}
+
+static void put_str(CacheWriter* w, char* s) {
+  size_t n = strlen(s);
+  put_u64(w, n);
+  put_bytes(w, s, n);
+}
+
+// Reads past the end return 0s and set |failed|.
+typedef struct CacheReader {
+  char* p;
+  char* end;
+  bool failed;
+} CacheReader;
+
+static char* get_bytes(CacheReader* r, size_t n) {
+  if (r->failed || (size_t)(r->end - r->p) < n) {
+    r->failed = true;
+    return NULL;
+  }
+  char* ret = r->p;
+  r->p += n;
+  return ret;
+}
+
+static uint64_t get_u64(CacheReader* r) {
+  uint64_t v = 0;
+  char* p = get_bytes(r, sizeof(v));
+  if (p)
+    memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static char* get_str(CacheReader* r) {
+  size_t n = get_u64(r);
+  char* p = get_bytes(r, n);
+  return p ? bumpstrndup(p, n, AL_Compile) : "";
+}
+
+static uint64_t hash_str(uint64_t hash, char* s) {
+  return hash_bytes(hash, s, strlen(s) + 1);
+}
+
+IMPLSTATIC uint64_t cache_key(char* source_name, char* contents) {
+  UserContext* uc = user_context;
+  uint64_t hash = 0xcbf29ce484222325;
+  hash = hash_str(hash, (char*)cache_compiler_build);
+  hash = hash_bytes(hash, &uc->code_alignment, sizeof(uc->code_alignment));
+  // Code saved without instrumentation mustn't be used where it's wanted.
+  bool instrumented = uc->instrument_enter || uc->instrument_exit || uc->instrument_cycles;
+  hash = hash_bytes(hash, &instrumented, sizeof(instrumented));
+  for (size_t i = 0; i < uc->num_include_paths; ++i) {
+    hash = hash_str(hash, uc->include_paths[i]);
+  }
+  hash = hash_str(hash, source_name);
+  hash = hash_str(hash, contents);
+  // 0 means no key.
+  return hash ? hash : 1;
+}
+
+static char* entry_path(uint64_t key) {
+  return format(AL_Compile, "%s/%016llx.dyc", user_context->cache_dir, (unsigned long long)key);
+}
+
+static bool dependencies_unchanged(CacheReader* r) {
+  uint64_t num_deps = get_u64(r);
+  for (uint64_t i = 0; i < num_deps && !r->failed; ++i) {
+    char* path = get_str(r);
+    uint64_t hash = get_u64(r);
+    char* contents = read_file_wrap_user(path, AL_Compile);
+    if (!contents || hash_bytes(0xcbf29ce484222325, contents, strlen(contents)) != hash)
+      return false;
+  }
+  // A header that's been added earlier in the search would be found instead.
+  uint64_t num_misses = get_u64(r);
+  for (uint64_t i = 0; i < num_misses && !r->failed; ++i) {
+    if (file_exists(get_str(r)))
+      return false;
+  }
+  return !r->failed;
+}
+
+static void load_data(CacheReader* r, size_t file_index) {
+  FileLinkData* fld = &user_context->files[file_index];
+  free_data_objects(fld);
+
+  uint64_t num_data = get_u64(r);
+  fld->data_objects = calloc(r->failed ? 1 : num_data + 1, sizeof(DataObject));
+  for (uint64_t i = 0; i < num_data && !r->failed; ++i) {
+    DataObject* obj = &fld->data_objects[fld->num_data_objects++];
+    obj->name = strdup(get_str(r));
+    obj->is_static = get_u64(r);
+    obj->is_rodata = get_u64(r);
+    obj->size = (int)get_u64(r);
+    obj->align = (int)get_u64(r);
+    if (get_u64(r)) {
+      char* init_data = get_bytes(r, obj->size);
+      if (!init_data)
+        break;
+      obj->init_data = malloc(obj->size);
+      memcpy(obj->init_data, init_data, obj->size);
+    }
+    uint64_t num_relocs = get_u64(r);
+    obj->relocs = calloc(r->failed ? 1 : num_relocs + 1, sizeof(DataReloc));
+    for (uint64_t j = 0; j < num_relocs && !r->failed; ++j) {
+      DataReloc* dr = &obj->relocs[obj->num_relocs++];
+      dr->offset = (int)get_u64(r);
+      dr->name = strdup(get_str(r));
+      dr->addend = (int)get_u64(r);
+    }
+  }
+
+  // Nothing in the data points into the code, see is_relocatable().
+  install_data_objects(file_index, NULL);
+}
+
+// Reads the file's code and its records. If |image| is set, each chunk is
+// mapped from it at an offset from |code_area|, otherwise it's inline.
+static void load_code(CacheReader* r, size_t file_index, FILE* image, size_t code_area) {
+  int num_chunks = (int)get_u64(r);
+  CodeChunk* chunks = calloc(r->failed ? 1 : num_chunks + 1, sizeof(CodeChunk));
+  for (int i = 0; i < num_chunks && !r->failed; ++i) {
+    CodeChunk* chunk = &chunks[i];
+    chunk->code_size = get_u64(r);
+    chunk->size = align_to_u(chunk->code_size, get_page_size());
+    if (image) {
+      uint64_t offset = get_u64(r);
+      if (r->failed)
+        break;
+      chunk->base_address = map_file_memory(image, code_area + offset, chunk->size);
+      if (!chunk->base_address)
+        r->failed = true;
+    } else {
+      char* code = get_bytes(r, chunk->code_size);
+      if (!code)
+        break;
+      chunk->base_address = allocate_writable_memory(chunk->size);
+      memcpy(chunk->base_address, code, chunk->code_size);
+    }
+  }
+
+  int num_functions = (int)get_u64(r);
+  FunctionCode* functions = calloc(r->failed ? 1 : num_functions + 1, sizeof(FunctionCode));
+  for (int i = 0; i < num_functions && !r->failed; ++i) {
+    FunctionCode* fc = &functions[i];
+    fc->name = strdup(get_str(r));
+    fc->hash = get_u64(r);
+    fc->is_static = get_u64(r);
+    uint64_t chunk_index = get_u64(r);
+    uint64_t offset = get_u64(r);
+    fc->size = get_u64(r);
+    int num_refs = (int)get_u64(r);
+    if (r->failed || chunk_index >= (uint64_t)num_chunks)
+      break;
+
+    char* base_address = chunks[chunk_index].base_address;
+    fc->address = base_address + offset;
+    fc->slots = calloc(num_refs + 1, sizeof(SymbolSlot*));
+    fc->slot_refs = calloc(num_refs + 1, sizeof(char*));
+    for (int j = 0; j < num_refs && !r->failed; ++j) {
+      uint64_t ref_offset = get_u64(r);
+      char* name = get_str(r);
+      if (r->failed)
+        break;
+      SymbolSlot* slot = get_symbol_slot(file_index, name);
+      char* ref = base_address + ref_offset;
+      memcpy(ref, &slot, sizeof(slot));
+      fc->slot_refs[fc->num_slot_refs++] = ref;
+
+      bool seen = false;
+      for (int k = 0; k < fc->num_slots && !seen; ++k) {
+        seen = fc->slots[k] == slot;
+      }
+      if (!seen)
+        fc->slots[fc->num_slots++] = slot;
+    }
+  }
+
+  replace_function_code(&user_context->files[file_index], functions, num_functions, chunks,
+                        num_chunks);
+  free(chunks);
+}
+
+// Loads the code and data for file |file_index| from the entry for |key|, if
+// there's a valid one. Returns false if the file needs to be compiled.
+IMPLSTATIC bool cache_load(size_t file_index, uint64_t key) {
+  FILE* fp = fopen(entry_path(key), "rb");
+  if (!fp)
+    return false;
+  fseek(fp, 0, SEEK_END);
+  size_t size = ftell(fp);
+  rewind(fp);
+  char* buf = malloc(size);
+  bool read_ok = fread(buf, 1, size, fp) == size;
+  fclose(fp);
+
+  // The payload is checked in full before anything is installed, so that a
+  // damaged entry can't leave the file half loaded.
+  CacheReader r = {buf, buf + (read_ok ? size : 0), false};
+  bool ok = get_u64(&r) == CACHE_MAGIC && get_u64(&r) == key;
+  uint64_t payload_hash = get_u64(&r);
+  ok = ok && !r.failed && hash_bytes(0xcbf29ce484222325, r.p, r.end - r.p) == payload_hash &&
+       dependencies_unchanged(&r);
+  if (ok) {
+    load_data(&r, file_index);
+    load_code(&r, file_index, NULL, 0);
+    if (r.failed)
+      ABORT("damaged cache entry");
+
+    UserContext* uc = user_context;
+    mutex_lock(uc->compile_mutex);
+    ++uc->stats.files_from_cache;
+    mutex_unlock(uc->compile_mutex);
+  }
+  free(buf);
+  return ok;
+}
+
+static void store_data(CacheWriter* w, FileLinkData* fld) {
+  put_u64(w, fld->num_data_objects);
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    put_str(w, obj->name);
+    put_u64(w, obj->is_static);
+    put_u64(w, obj->is_rodata);
+    put_u64(w, obj->size);
+    put_u64(w, obj->align);
+    put_u64(w, obj->init_data != NULL);
+    if (obj->init_data)
+      put_bytes(w, obj->init_data, obj->size);
+    put_u64(w, obj->num_relocs);
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      put_u64(w, obj->relocs[j].offset);
+      put_str(w, obj->relocs[j].name);
+      put_u64(w, (uint64_t)(int64_t)obj->relocs[j].addend);
+    }
+  }
+}
+
+// Writes the file's code and its records. If |code| is set, each chunk is
+// written there on a page boundary (so that it can be mapped by load_code())
+// and only its offset goes in |w|.
+static void store_code(CacheWriter* w, FileLinkData* fld, CacheWriter* code) {
+  put_u64(w, fld->num_chunks);
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    CodeChunk* chunk = &fld->chunks[i];
+    put_u64(w, chunk->code_size);
+    if (code) {
+      put_u64(w, code->len);
+      put_bytes(code, chunk->base_address, chunk->code_size);
+      size_t padded = align_to_u(code->len, get_page_size());
+      while (code->len < padded) {
+        put_bytes(code, "", 1);
+      }
+    } else {
+      put_bytes(w, chunk->base_address, chunk->code_size);
+    }
+  }
+
+  put_u64(w, fld->num_functions);
+  for (int i = 0; i < fld->num_functions; ++i) {
+    FunctionCode* fc = &fld->functions[i];
+    int chunk_index = 0;
+    while (fc->address < fld->chunks[chunk_index].base_address ||
+           fc->address >= fld->chunks[chunk_index].base_address + fld->chunks[chunk_index].size) {
+      ++chunk_index;
+    }
+    char* base_address = fld->chunks[chunk_index].base_address;
+
+    put_str(w, fc->name);
+    put_u64(w, fc->hash);
+    put_u64(w, fc->is_static);
+    put_u64(w, chunk_index);
+    put_u64(w, fc->address - base_address);
+    put_u64(w, fc->size);
+    put_u64(w, fc->num_slot_refs);
+    for (int j = 0; j < fc->num_slot_refs; ++j) {
+      // The code holds the address of the slot, which knows its name.
+      SymbolSlot* slot;
+      memcpy(&slot, fc->slot_refs[j], sizeof(slot));
+      put_u64(w, fc->slot_refs[j] - base_address);
+      put_str(w, slot->name);
+    }
+  }
+}
+
+// Whether the file's code and data can be moved to another process, i.e. they
+// only refer to other things by name.
+static bool is_relocatable(FileLinkData* fld) {
+  // Lazy functions' stubs point into this process's copy of the parse.
+  if (fld->lazy)
+    return false;
+  for (int i = 0; i < fld->num_functions; ++i) {
+    // Profile counts are written to this process's copy of them.
+    if (fld->functions[i].is_process_specific || fld->functions[i].profile_counts)
+      return false;
+  }
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    for (int j = 0; j < fld->data_objects[i].num_relocs; ++j) {
+      // Points into this process's copy of the code.
+      if (!fld->data_objects[i].relocs[j].name)
+        return false;
+    }
+  }
+  return true;
+}
+
+// Saves what file |file_index| was just compiled to as the entry for |key|.
+// Failures are ignored, as the file will just be compiled again next time.
+IMPLSTATIC void cache_store(size_t file_index, uint64_t key) {
+  FileLinkData* fld = &user_context->files[file_index];
+  if (C(uncacheable) || !is_relocatable(fld))
+    return;
+
+  CacheWriter w = {0};
+  put_u64(&w, CACHE_MAGIC);
+  put_u64(&w, key);
+  put_u64(&w, 0);  // Payload hash, filled in below.
+
+  // Every file other than the main one (which is part of the key) that came
+  // from load_file_contents.
+  FilePtrArray* files = &compiler_state.tokenize__all_tokenized_files;
+  HashMap seen = {0};
+  uint64_t num_deps = 0;
+  for (int i = 0; i < files->len; ++i) {
+    if (files->data[i]->contents_hash && !hashmap_get(&seen, files->data[i]->name)) {
+      hashmap_put(&seen, files->data[i]->name, files->data[i]);
+      ++num_deps;
+    }
+  }
+  put_u64(&w, num_deps);
+  for (int i = 0; i < files->len; ++i) {
+    File* file = files->data[i];
+    if (file->contents_hash && hashmap_get(&seen, file->name) == file) {
+      put_str(&w, file->name);
+      put_u64(&w, file->contents_hash);
+    }
+  }
+
+  // Where #includes were looked for and not found, as a header added at one of
+  // them would be found instead.
+  StringArray* misses = &compiler_state.preprocess__include_misses;
+  HashMap seen_misses = {0};
+  uint64_t num_misses = 0;
+  for (int i = 0; i < misses->len; ++i) {
+    if (!hashmap_get(&seen_misses, misses->data[i])) {
+      hashmap_put(&seen_misses, misses->data[i], misses->data[i]);
+      ++num_misses;
+    }
+  }
+  put_u64(&w, num_misses);
+  for (int i = 0; i < misses->len; ++i) {
+    if (hashmap_get(&seen_misses, misses->data[i]) == misses->data[i])
+      put_str(&w, misses->data[i]);
+  }
+
+  store_data(&w, fld);
+  store_code(&w, fld, NULL);
+
+  uint64_t payload_hash = hash_bytes(0xcbf29ce484222325, w.data + 24, w.len - 24);
+  memcpy(w.data + 16, &payload_hash, sizeof(payload_hash));
+
+  // Written under another name and then renamed, so that another process
+  // never sees a partial entry.
+  char* path = entry_path(key);
+#if X64WIN
+  int pid = _getpid();
+#else
+  int pid = getpid();
+#endif
+  char* tmp_path = format(AL_Compile, "%s.%d.%p.tmp", path, pid, (void*)&compiler_state);
+  FILE* fp = fopen(tmp_path, "wb");
+  if (fp) {
+    bool write_ok = fwrite(w.data, 1, w.len, fp) == w.len;
+    if (fclose(fp) == 0 && write_ok) {
+#if X64WIN
+      write_ok = MoveFileExA(tmp_path, path, MOVEFILE_REPLACE_EXISTING);
+#else
+      write_ok = rename(tmp_path, path) == 0;
+#endif
+    }
+    if (!write_ok)
+      remove(tmp_path);
+  }
+  free(w.data);
+}
+
+// An image holds the code and data of every file in a context, so that another
+// process with the same files can start from it rather than compiling them.
+// It's laid out as:
+//
+//   magic, metadata size, metadata hash, code size
+//   metadata: compiler build, file names, then each file's data and code
+//             records
+//   code chunks, each on a page boundary
+//
+// The chunks are mapped directly from the file when it's loaded, and only the
+// references to symbol slots in them need to be written. Data is saved as it
+// was initialized, not with its current values. Only the metadata is hashed,
+// as reading all of the code to check it would undo the mapping's savings.
+
+#define IMAGE_MAGIC 0x3345474d49594944ULL  // "DYIMAGE3"
+
+// Saves all of the context's files to |path|. Returns false if any of them
+// isn't relocatable, or the file can't be written.
+IMPLSTATIC bool image_save(char* path) {
+  UserContext* uc = user_context;
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    if (!is_relocatable(&uc->files[i]))
+      return false;
+  }
+
+  CacheWriter w = {0};
+  CacheWriter code = {0};
+  put_str(&w, (char*)cache_compiler_build);
+  put_u64(&w, uc->num_files);
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    put_str(&w, uc->files[i].source_name);
+  }
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    store_data(&w, &uc->files[i]);
+    store_code(&w, &uc->files[i], &code);
+  }
+
+  uint64_t header[4] = {IMAGE_MAGIC, w.len, hash_bytes(0xcbf29ce484222325, w.data, w.len),
+                        code.len};
+  size_t code_area = align_to_u(sizeof(header) + w.len, get_page_size());
+
+  bool ok = false;
+  FILE* fp = fopen(path, "wb");
+  if (fp) {
+    ok = fwrite(header, 1, sizeof(header), fp) == sizeof(header) &&
+         fwrite(w.data, 1, w.len, fp) == w.len;
+    for (size_t pos = sizeof(header) + w.len; ok && pos < code_area; ++pos) {
+      ok = fputc(0, fp) != EOF;
+    }
+    ok = ok && fwrite(code.data, 1, code.len, fp) == code.len;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok)
+      remove(path);
+  }
+  free(w.data);
+  free(code.data);
+  return ok;
+}
+
+// Loads the code and data for all of the context's files from the image at
+// |path|, to be linked as if they'd just been compiled. Returns false if it
+// can't be read, or wasn't saved by this build for the same files.
+IMPLSTATIC bool image_load(char* path) {
+  UserContext* uc = user_context;
+  FILE* fp = fopen(path, "rb");
+  if (!fp)
+    return false;
+
+  uint64_t header[4];
+  char* buf = NULL;
+  bool ok = fread(header, 1, sizeof(header), fp) == sizeof(header) && header[0] == IMAGE_MAGIC;
+  if (ok) {
+    buf = malloc(header[1]);
+    ok = buf && fread(buf, 1, header[1], fp) == header[1] &&
+         hash_bytes(0xcbf29ce484222325, buf, header[1]) == header[2];
+  }
+  size_t code_area = ok ? align_to_u(sizeof(header) + header[1], get_page_size()) : 0;
+
+  // The code is mapped from the file, so a truncated image would fault when
+  // it's run. Its contents aren't checked though, see above.
+  if (ok)
+    ok = fseek(fp, 0, SEEK_END) == 0 && ftell(fp) >= (long)(code_area + header[3]);
+
+  CacheReader r = {buf, buf + (ok ? header[1] : 0), false};
+  ok = ok && strcmp(get_str(&r), cache_compiler_build) == 0 && get_u64(&r) == uc->num_files;
+  for (size_t i = 0; i < uc->num_files && ok; ++i) {
+    ok = strcmp(get_str(&r), uc->files[i].source_name) == 0;
+  }
+
+  if (ok) {
+    for (size_t i = 0; i < uc->num_files; ++i) {
+      load_data(&r, i);
+      load_code(&r, i, fp, code_area);
+      register_loaded_code(i);
+    }
+    if (r.failed)
+      ABORT("damaged image");
+  }
+  free(buf);
+  fclose(fp);
+  return ok;
+}
@@ -18,7 +18,7 @@
 #include "dyn_basic_pdb.h"
 
 ///| .arch x64
-///| .section code, pdata
+///| .section code, cold, pdata
 ///| .actionlist dynasm_actions
 ///| .globals dynasm_globals
 ///| .if WIN
@@ -27,12 +27,14 @@
 
 #define Dst &C(dynasm)
 
+#define REG_AX 0
 #define REG_DI 7
 #define REG_SI 6
 #define REG_DX 2
 #define REG_CX 1
 #define REG_R8 8
 #define REG_R9 9
+#define REG_R10 10
 
 // Used with Rq(), Rd(), Rw(), Rb()
 #if X64WIN
@@ -71,7 +73,12 @@ static int dasmargreg[] = {REG_DI, REG_SI, REG_DX, REG_CX, REG_R8, REG_R9};
 static void gen_expr(Node* node);
 static void gen_stmt(Node* node);
 
-#if X64WIN
+// Whether the line that each statement's code came from is recorded, for
+// debug symbols, and for jitdump.
+static bool wants_line_info(void) {
+  return user_context->generate_debug_symbols || user_context->jitdump_dir;
+}
+
 static void record_line_syminfo(int file_no, int line_no, int pclabel) {
   // If file and line haven't changed, then we're working through parts of a
   // single statement; just ignore.
@@ -87,7 +94,6 @@ static void record_line_syminfo(int file_no, int line_no, int pclabel) {
   // printf("%s:%d:label %d\n", compiler_state.tokenize__all_tokenized_files.data[file_no]->name,
   // line_no, pclabel);
 }
-#endif
 
 IMPLSTATIC int codegen_pclabel(void) {
   int ret = C(numlabels);
@@ -117,6 +123,44 @@ static void popf(int reg) {
   C(depth)--;
 }
 
+// Loads the address of the function or global |name| into |reg| from its
+// slot, and records the reference so the linker knows to fill the slot.
+static void load_symbol_address(int reg, char* name) {
+  SymbolSlot* slot = get_symbol_slot(C(file_index), name);
+  strarray_push(&C(symbol_refs), name, AL_Compile);
+  ///| mov64 Rq(reg), (uintptr_t)slot
+  // Marks the end of the slot's address in the code, so it can be repointed
+  // when the code is loaded into another process.
+  int label = codegen_pclabel();
+  ///|=>label:
+  intarray_push(&C(symbol_ref_labels), label, AL_Compile);
+  ///| mov Rq(reg), [Rq(reg)]
+}
+
+#if !X64WIN
+// 128-bit integers are held in rdx:rax, and pushed so that the low half is at
+// the top of the stack, matching their in-memory layout.
+static void push128(void) {
+  ///| push rdx
+  ///| push rax
+  C(depth) += 2;
+}
+
+// Calls a compiler runtime helper (see link.c) for operations that don't have
+// a reasonable inline expansion, e.g. 128-bit division.
+static void call_runtime_helper(char* name) {
+  bool realign = C(depth) % 2 == 1;
+  if (realign) {
+    ///| sub rsp, 8
+  }
+  load_symbol_address(REG_R10, name);
+  ///| call r10
+  if (realign) {
+    ///| add rsp, 8
+  }
+}
+#endif
+
 // Load a value from where %rax is pointing to.
 static void load(Type* ty) {
   switch (ty->kind) {
@@ -142,6 +186,10 @@ static void load(Type* ty) {
     case TY_LDOUBLE:
       ///| fld tword [rax]
       return;
+    case TY_INT128:
+      ///| mov rdx, [rax+8]
+      ///| mov rax, [rax]
+      return;
 #endif
   }
 
@@ -191,6 +239,10 @@ static void store(Type* ty) {
     case TY_LDOUBLE:
       ///| fstp tword [RUTIL]
       return;
+    case TY_INT128:
+      ///| mov [RUTIL], rax
+      ///| mov [RUTIL+8], rdx
+      return;
 #endif
   }
 
@@ -237,36 +289,23 @@ static void gen_addr(Node* node) {
 
       // Function
       if (node->ty->kind == TY_FUNC) {
+#if X64WIN
         if (node->var->is_definition) {
           ///| lea rax, [=>node->var->dasm_entry_label]
         } else {
-          int fixup_location = codegen_pclabel();
-          strintarray_push(&C(fixups), (StringInt){node->var->name, fixup_location}, AL_Compile);
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4310)  // dynasm casts the top and bottom of the 64bit arg
-#endif
-          ///|=>fixup_location:
-          ///| mov64 rax, 0xc0dec0dec0dec0de
-#ifdef _MSC_VER
-#pragma warning(pop)
+#else
+        // Functions in the same file also go through slots, so that the
+        // code for a function can be reused by a later update even if the
+        // functions it refers to were recompiled elsewhere (see codegen()).
+        {
 #endif
+          load_symbol_address(REG_AX, node->var->name);
         }
         return;
       }
 
       // Global variable
-      int fixup_location = codegen_pclabel();
-      strintarray_push(&C(fixups), (StringInt){node->var->name, fixup_location}, AL_Compile);
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4310)  // dynasm casts the top and bottom of the 64bit arg
-#endif
-      ///|=>fixup_location:
-      ///| mov64 rax, 0xda7ada7ada7ada7a
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+      load_symbol_address(REG_AX, node->var->name);
       return;
     case ND_DEREF:
       gen_expr(node->lhs);
@@ -316,6 +355,9 @@ static void cmp_zero(Type* ty) {
       ///| fucomip st0
       ///| fstp st0
       return;
+    case TY_INT128:
+      ///| or rax, rdx
+      return;
 #endif
   }
 
@@ -599,6 +641,56 @@ static DynasmCastFunc dynasm_cast_table[][11] = {
 
 // clang-format on
 
+#if !X64WIN
+// Casts to and from __int128 go via the 64 bit types in the table above, and
+// then either extend into or discard rdx. Floating point conversions are done
+// through double by runtime helpers.
+static void cast_int128(Type* from, Type* to) {
+  if (from->kind == TY_INT128 && to->kind == TY_INT128)
+    return;
+
+  if (to->kind == TY_INT128) {
+    if (is_flonum(from)) {
+      if (from->kind == TY_FLOAT)
+        f32f64();
+      else if (from->kind == TY_LDOUBLE)
+        f80f64();
+      call_runtime_helper(to->is_unsigned ? "__dyibicc_fixunsdfti" : "__dyibicc_fixdfti");
+      return;
+    }
+
+    int t1 = get_type_id(from);
+    int t2 = from->is_unsigned ? U64 : I64;
+    if (dynasm_cast_table[t1][t2]) {
+      dynasm_cast_table[t1][t2]();
+    }
+    if (from->is_unsigned) {
+      ///| xor edx, edx
+    } else {
+      ///| cqo
+    }
+    return;
+  }
+
+  if (is_flonum(to)) {
+    ///| mov rdi, rax
+    ///| mov rsi, rdx
+    call_runtime_helper(from->is_unsigned ? "__dyibicc_floatuntidf" : "__dyibicc_floattidf");
+    if (to->kind == TY_FLOAT)
+      f64f32();
+    else if (to->kind == TY_LDOUBLE)
+      f64f80();
+    return;
+  }
+
+  int t1 = from->is_unsigned ? U64 : I64;
+  int t2 = get_type_id(to);
+  if (dynasm_cast_table[t1][t2]) {
+    dynasm_cast_table[t1][t2]();
+  }
+}
+#endif
+
 // This can't be "cast()" when amalgamated because parse has a cast() as well.
 static void cg_cast(Type* from, Type* to) {
   if (to->kind == TY_VOID)
@@ -611,6 +703,13 @@ static void cg_cast(Type* from, Type* to) {
     return;
   }
 
+#if !X64WIN
+  if (from->kind == TY_INT128 || to->kind == TY_INT128) {
+    cast_int128(from, to);
+    return;
+  }
+#endif
+
   int t1 = get_type_id(from);
   int t2 = get_type_id(to);
   if (dynasm_cast_table[t1][t2]) {
@@ -851,11 +950,38 @@ static int push_args_win(Node* node, int* by_ref_copies_size) {
 
 #else
 
+// Whether an argument can be evaluated directly into its argument register.
+// This is only the case for expressions whose code uses nothing but rax and
+// xmm0 (variables, constants, member loads, etc.), so that evaluating one can't
+// clobber another argument register that's already been loaded.
+static bool is_simple_arg(Node* node) {
+  switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return true;
+    case ND_MEMBER:
+    case ND_DEREF:
+    case ND_ADDR:
+      return is_simple_arg(node->lhs);
+    case ND_CAST: {
+      Type* from = node->lhs->ty;
+      Type* to = node->ty;
+      return (is_integer(from) || from->kind == TY_PTR) && from->size <= 8 &&
+             (is_integer(to) || to->kind == TY_PTR) && to->size <= 8 &&
+             is_simple_arg(node->lhs);
+    }
+  }
+  return false;
+}
+
 static void push_args2_sysv(Node* args, bool first_pass) {
   if (!args)
     return;
   push_args2_sysv(args->next, first_pass);
 
+  if (args->eval_into_reg)
+    return;
+
   // Push all the by-stack first, then on the second pass, push all the things
   // that will be popped back into registers by the actual call.
   if ((first_pass && !args->pass_by_stack) || (!first_pass && args->pass_by_stack))
@@ -877,6 +1003,14 @@ static void push_args2_sysv(Node* args, bool first_pass) {
       ///| fstp tword [rsp]
       C(depth) += 2;
       break;
+    case TY_INT128:
+      push128();
+      // Pushed right to left, so the hole below it comes after.
+      if (args->stack_pad) {
+        ///| sub rsp, 8
+        C(depth)++;
+      }
+      break;
     default:
       push();
       break;
@@ -900,7 +1034,8 @@ static void push_args2_sysv(Node* args, bool first_pass) {
 //   argument to the stack in the right-to-left order.
 //
 // - Each argument passed on the stack takes 8 bytes, and the end of
-//   the argument area must be aligned to a 16 byte boundary.
+//   the argument area must be aligned to a 16 byte boundary. An
+//   __int128 on the stack is itself aligned to 16.
 //
 // - If a function is variadic, set the number of floating-point type
 //   arguments to RAX.
@@ -939,20 +1074,38 @@ static int push_args_sysv(Node* node) {
         break;
       case TY_FLOAT:
       case TY_DOUBLE:
-        if (fp++ >= SYSV_FP_MAX) {
+        if (fp >= SYSV_FP_MAX) {
           arg->pass_by_stack = true;
           stack++;
+        } else if (is_simple_arg(arg)) {
+          arg->eval_into_reg = true;
+          arg->eval_reg = fp;
         }
+        fp++;
         break;
       case TY_LDOUBLE:
         arg->pass_by_stack = true;
         stack += 2;
         break;
+      case TY_INT128:
+        // Passed in a pair of registers, or entirely on the stack.
+        if (gp + 2 <= SYSV_GP_MAX) {
+          gp += 2;
+        } else {
+          arg->pass_by_stack = true;
+          arg->stack_pad = stack % 2 == 1;
+          stack += arg->stack_pad + 2;
+        }
+        break;
       default:
-        if (gp++ >= SYSV_GP_MAX) {
+        if (gp >= SYSV_GP_MAX) {
           arg->pass_by_stack = true;
           stack++;
+        } else if (is_simple_arg(arg)) {
+          arg->eval_into_reg = true;
+          arg->eval_reg = gp;
         }
+        gp++;
     }
   }
 
@@ -975,6 +1128,27 @@ static int push_args_sysv(Node* node) {
   return stack;
 }
 
+// Evaluate the arguments flagged by push_args_sysv() directly into their
+// registers. This is done right-to-left, so the argument destined for xmm0 (the
+// only register other than rax that they might use) is evaluated last.
+static void eval_reg_args_sysv(Node* args) {
+  if (!args)
+    return;
+  eval_reg_args_sysv(args->next);
+
+  if (!args->eval_into_reg)
+    return;
+
+  gen_expr(args);
+  if (is_flonum(args->ty)) {
+    if (args->eval_reg != 0) {
+      ///| movaps xmm(args->eval_reg), xmm0
+    }
+  } else {
+    ///| mov Rq(dasmargreg[args->eval_reg]), rax
+  }
+}
+
 static void copy_ret_buffer(Obj* var) {
   Type* ty = var->ty;
   int gp = 0, fp = 0;
@@ -1101,7 +1275,399 @@ static void builtin_alloca(void) {
   ///| mov [rbp+C(current_fn)->alloca_bottom->offset], rax
 }
 
+#if !X64WIN
+// Binary operators where the lhs is an __int128. Operations are done on
+// register pairs with carries between the halves, lhs in rdx:rax and rhs in
+// rsi:rdi.
+static void gen_binary_int128(Node* node) {
+  if (node->kind == ND_SHL || node->kind == ND_SHR) {
+    // The rhs of a shift isn't converted to the type of the lhs, and only the
+    // low byte of the count is relevant in any case.
+    gen_expr(node->rhs);
+    push();
+    gen_expr(node->lhs);
+    pop(REG_CX);
+
+    if (node->kind == ND_SHL) {
+      ///| shld rdx, rax, cl
+      ///| shl rax, cl
+      ///| test cl, 64
+      ///| je >1
+      ///| mov rdx, rax
+      ///| xor eax, eax
+      ///|1:
+    } else if (node->lhs->ty->is_unsigned) {
+      ///| shrd rax, rdx, cl
+      ///| shr rdx, cl
+      ///| test cl, 64
+      ///| je >1
+      ///| mov rax, rdx
+      ///| xor edx, edx
+      ///|1:
+    } else {
+      ///| shrd rax, rdx, cl
+      ///| sar rdx, cl
+      ///| test cl, 64
+      ///| je >1
+      ///| mov rax, rdx
+      ///| sar rdx, 63
+      ///|1:
+    }
+    return;
+  }
+
+  gen_expr(node->rhs);
+  push128();
+  gen_expr(node->lhs);
+  pop(REG_DI);
+  pop(REG_SI);
+
+  switch (node->kind) {
+    case ND_ADD:
+      ///| add rax, rdi
+      ///| adc rdx, rsi
+      return;
+    case ND_SUB:
+      ///| sub rax, rdi
+      ///| sbb rdx, rsi
+      return;
+    case ND_MUL:
+      // (ah:al * bh:bl) mod 2^128 = al*bl + ((ah*bl + al*bh) << 64)
+      ///| mov r8, rax
+      ///| mov r9, rdx
+      ///| imul r9, rdi
+      ///| imul rsi, r8
+      ///| add r9, rsi
+      ///| mul rdi
+      ///| add rdx, r9
+      return;
+    case ND_DIV:
+    case ND_MOD: {
+      // Runtime helpers take the dividend in rsi:rdi and the divisor in
+      // rcx:rdx, as normal SysV __int128 arguments.
+      ///| mov rcx, rsi
+      ///| mov r8, rdi
+      ///| mov rdi, rax
+      ///| mov rsi, rdx
+      ///| mov rdx, r8
+      bool is_unsigned = node->ty->is_unsigned;
+      if (node->kind == ND_DIV) {
+        call_runtime_helper(is_unsigned ? "__dyibicc_udivti3" : "__dyibicc_divti3");
+      } else {
+        call_runtime_helper(is_unsigned ? "__dyibicc_umodti3" : "__dyibicc_modti3");
+      }
+      return;
+    }
+    case ND_BITAND:
+      ///| and rax, rdi
+      ///| and rdx, rsi
+      return;
+    case ND_BITOR:
+      ///| or rax, rdi
+      ///| or rdx, rsi
+      return;
+    case ND_BITXOR:
+      ///| xor rax, rdi
+      ///| xor rdx, rsi
+      return;
+    case ND_EQ:
+    case ND_NE:
+      ///| xor rax, rdi
+      ///| xor rdx, rsi
+      ///| or rax, rdx
+      if (node->kind == ND_EQ) {
+        ///| sete al
+      } else {
+        ///| setne al
+      }
+      ///| movzx rax, al
+      return;
+    case ND_LT:
+      // Flags of lhs - rhs via a borrow chain.
+      ///| cmp rax, rdi
+      ///| sbb rdx, rsi
+      if (node->lhs->ty->is_unsigned) {
+        ///| setb al
+      } else {
+        ///| setl al
+      }
+      ///| movzx rax, al
+      return;
+    case ND_LE:
+      // lhs <= rhs is !(rhs < lhs), so compute rhs - lhs instead.
+      ///| cmp rdi, rax
+      ///| sbb rsi, rdx
+      if (node->lhs->ty->is_unsigned) {
+        ///| setae al
+      } else {
+        ///| setge al
+      }
+      ///| movzx rax, al
+      return;
+  }
+
+  error_tok(node->tok, "invalid expression");
+}
+#endif
+
 // Generate code for a given node.
+// Function entries and loop headers are aligned so that they start on a fresh
+// fetch block. DynASM pads with single byte nops, which are all executed when
+// the code before falls through, so the padding is marked with a label on each
+// side and written over with longer nops by fill_align_padding() once encoded.
+static void align_code(void) {
+  int start = codegen_pclabel();
+  int end = codegen_pclabel();
+  ///|=>start:
+  if (user_context->code_alignment == 32) {
+    ///| .align 32
+  } else {
+    ///| .align 16
+  }
+  ///|=>end:
+  intarray_push(&C(align_labels), start, AL_Compile);
+  intarray_push(&C(align_labels), end, AL_Compile);
+}
+
+// The recommended nop forms for each length, 0F 1F /0 with growing operands.
+static const unsigned char multi_byte_nops[9][9] = {
+    {0x90},
+    {0x66, 0x90},
+    {0x0f, 0x1f, 0x00},
+    {0x0f, 0x1f, 0x40, 0x00},
+    {0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+static void fill_align_padding(char* base) {
+  for (int i = 0; i < C(align_labels).len; i += 2) {
+    char* p = base + dasm_getpclabel(&C(dynasm), C(align_labels).data[i]);
+    char* end = base + dasm_getpclabel(&C(dynasm), C(align_labels).data[i + 1]);
+    while (p < end) {
+      int len = MIN((int)(end - p), 9);
+      memcpy(p, multi_byte_nops[len - 1], len);
+      p += len;
+    }
+  }
+}
+
+#if !X64WIN
+// Calls |fn| with r11 as its argument, preserving the argument registers and
+// rax (which holds the number of vector registers used by a varargs call), and
+// leaves its result in r11. The stack is realigned, so this can go before a
+// function's prologue or at a statement within its body.
+static void emit_call_preserving_args(void* fn) {
+  ///| push rbp
+  ///| mov rbp, rsp
+  ///| push rdi
+  ///| push rsi
+  ///| push rdx
+  ///| push rcx
+  ///| push r8
+  ///| push r9
+  ///| push rax
+  ///| and rsp, -16
+  ///| sub rsp, 64
+  for (int i = 0; i < 8; ++i) {
+    ///| movsd qword [rsp+i*8], xmm(i)
+  }
+  ///| mov rdi, r11
+  ///| mov64 rax, (uintptr_t)fn
+  ///| call rax
+  ///| mov r11, rax
+  for (int i = 0; i < 8; ++i) {
+    ///| movsd xmm(i), qword [rsp+i*8]
+  }
+  ///| lea rsp, [rbp-56]
+  ///| pop rax
+  ///| pop r9
+  ///| pop r8
+  ///| pop rcx
+  ///| pop rdx
+  ///| pop rsi
+  ///| pop rdi
+  ///| pop rbp
+}
+
+// Calls or loop iterations after which a function is promoted out of tier 0.
+#define TIER_UP_CALLS 1000
+#define TIER_UP_BACKEDGES 10000
+
+// In tier 0 code, counts an entry or a loop back-edge in |counter|, and
+// requests that the function be promoted when it reaches |threshold|. The
+// counts aren't atomic, as they only have to be roughly right.
+static void emit_tier0_count(uint64_t* counter, int threshold) {
+  int lskip = codegen_pclabel();
+  ///| mov64 r11, (uintptr_t)counter
+  ///| add qword [r11], 1
+  ///| cmp qword [r11], threshold
+  ///| jne =>lskip
+  ///| mov64 r11, (uintptr_t)C(tier0_function)
+  emit_call_preserving_args((void*)request_promotion);
+  ///|=>lskip:
+}
+
+// Whether |fn| calls the instrument hooks or counts cycles, see
+// instrument_functions.
+static bool is_instrumented(Obj* fn) {
+  UserContext* uc = user_context;
+  return (uc->instrument_functions || fn->is_instrumented) &&
+         (uc->instrument_enter || uc->instrument_exit || uc->instrument_cycles);
+}
+
+// Reads the time stamp counter into rax, clobbering rdx.
+static void emit_rdtsc(void) {
+  ///| rdtsc
+  ///| shl rdx, 32
+  ///| or rax, rdx
+}
+
+// Calls |hook| with the current function's address and the address it was
+// called from. The stack must be aligned.
+static void emit_instrument_hook(void* hook) {
+  ///| lea rdi, [=>C(current_fn)->dasm_entry_label]
+  ///| mov rsi, [rbp+8]
+  ///| mov64 rax, (uintptr_t)hook
+  ///| call rax
+}
+
+// Goes after the prologue of an instrumented function, once the arguments have
+// been stored, so they don't need preserving.
+static void emit_instrument_enter(Obj* fn) {
+  if (user_context->instrument_enter)
+    emit_instrument_hook(user_context->instrument_enter);
+  if (fn->instrument_counts) {
+    ///| mov64 r11, (uintptr_t)fn->instrument_counts
+    ///| add qword [r11], 1
+    emit_rdtsc();
+    ///| mov [rbp+fn->instrument_tsc_offset], rax
+  }
+}
+
+// Goes at the return label of an instrumented function, preserving the return
+// value.
+static void emit_instrument_exit(Obj* fn) {
+  // The epilogue restores rsp from rbp, so it can be realigned here freely.
+  ///| and rsp, -16
+  ///| sub rsp, 32
+  ///| mov [rsp], rax
+  ///| mov [rsp+8], rdx
+  ///| movsd qword [rsp+16], xmm0
+  ///| movsd qword [rsp+24], xmm1
+  if (fn->instrument_counts) {
+    emit_rdtsc();
+    ///| sub rax, [rbp+fn->instrument_tsc_offset]
+    ///| mov64 r11, (uintptr_t)fn->instrument_counts
+    ///| add [r11+8], rax
+  }
+  if (user_context->instrument_exit)
+    emit_instrument_hook(user_context->instrument_exit);
+  ///| mov rax, [rsp]
+  ///| mov rdx, [rsp+8]
+  ///| movsd xmm0, qword [rsp+16]
+  ///| movsd xmm1, qword [rsp+24]
+}
+#endif
+
+// With profile_branches, adds one to the current function's count at |index|.
+static void emit_profile_count(int index) {
+  uint64_t* counts = C(current_fn)->profile_counts;
+  if (!counts || index < 0)
+    return;
+  ///| mov64 r11, (uintptr_t)&counts[index]
+  ///| add qword [r11], 1
+}
+
+// Whether there's a loaded profile that applies to |node|, and if so, its
+// |offset|th count.
+static bool has_profile(Node* node) {
+  return C(profile) && node->profile_site;
+}
+
+static uint64_t profile_count(Node* node, int offset) {
+  return has_profile(node) ? C(profile)->counts[node->profile_site - 1 + offset] : 0;
+}
+
+// Whether |node| ends in a call to a function that doesn't return, so it can be
+// assumed to be an error path.
+static bool is_noreturn(Node* node) {
+  switch (node->kind) {
+    case ND_FUNCALL:
+      return node->func_ty->is_noreturn;
+    case ND_CAST:
+    case ND_EXPR_STMT:
+      return is_noreturn(node->lhs);
+    case ND_COMMA:
+      return is_noreturn(node->lhs) || is_noreturn(node->rhs);
+    case ND_BLOCK:
+      for (Node* n = node->body; n; n = n->next) {
+        if (is_noreturn(n))
+          return true;
+      }
+      return false;
+  }
+  return false;
+}
+
+// For an ND_IF or ND_COND, returns the branch that should be moved to the
+// .cold section at the end of the code segment, if any. A branch is cold if
+// the profile says it was never taken while the other was, if the condition is
+// hinted with __builtin_expect(), or if it ends in a noreturn call (e.g.
+// abort() or an assert failure).
+static Node* cold_branch(Node* node) {
+#if X64WIN
+  // Code has to stay within the range of its function's unwind info.
+  (void)node;
+  return NULL;
+#else
+  if (C(in_cold_section))
+    return NULL;
+
+  uint64_t then_count = profile_count(node, 0);
+  uint64_t els_count = profile_count(node, 1);
+  if (then_count + els_count > 0) {
+    if (then_count == 0)
+      return node->then;
+    if (node->els && els_count == 0)
+      return node->els;
+    return NULL;
+  }
+
+  if (node->cond->branch_hint < 0)
+    return node->then;
+  if (!node->els)
+    return is_noreturn(node->then) ? node->then : NULL;
+  if (node->cond->branch_hint > 0)
+    return node->els;
+
+  bool then_cold = is_noreturn(node->then);
+  bool els_cold = is_noreturn(node->els);
+  if (then_cold != els_cold)
+    return then_cold ? node->then : node->els;
+  return NULL;
+#endif
+}
+
+// Emits |node| into the .cold section at |lcold|, jumping back to |lret| when
+// done. |profile_index| is the branch's count, if any.
+static void gen_cold(Node* node, bool is_expr, int lcold, int lret, int profile_index) {
+  ///| .cold
+  C(in_cold_section) = true;
+  ///|=>lcold:
+  emit_profile_count(profile_index);
+  if (is_expr) {
+    gen_expr(node);
+  } else {
+    gen_stmt(node);
+  }
+  ///| jmp =>lret
+  C(in_cold_section) = false;
+  ///| .code
+}
+
 static void gen_expr(Node* node) {
   switch (node->kind) {
     case ND_NULL_EXPR:
@@ -1149,6 +1715,11 @@ static void gen_expr(Node* node) {
       } else {
         ///| mov rax, node->val
       }
+#if !X64WIN
+      if (node->ty->kind == TY_INT128) {
+        ///| cqo
+      }
+#endif
       return;
     }
     case ND_NEG:
@@ -1171,6 +1742,11 @@ static void gen_expr(Node* node) {
         case TY_LDOUBLE:
           ///| fchs
           return;
+        case TY_INT128:
+          ///| neg rax
+          ///| adc rdx, 0
+          ///| neg rdx
+          return;
 #endif
       }
 
@@ -1276,6 +1852,20 @@ static void gen_expr(Node* node) {
       int lend = codegen_pclabel();
       gen_expr(node->cond);
       cmp_zero(node->cond->ty);
+      Node* cold = cold_branch(node);
+      if (cold) {
+        // lelse is the start of the cold branch, placed out of line.
+        if (cold == node->then) {
+          ///| jne =>lelse
+          gen_expr(node->els);
+        } else {
+          ///| je =>lelse
+          gen_expr(node->then);
+        }
+        ///|=>lend:
+        gen_cold(cold, true, lelse, lend, -1);
+        return;
+      }
       ///| je =>lelse
       gen_expr(node->then);
       ///| jmp =>lend
@@ -1293,6 +1883,11 @@ static void gen_expr(Node* node) {
     case ND_BITNOT:
       gen_expr(node->lhs);
       ///| not rax
+#if !X64WIN
+      if (node->ty->kind == TY_INT128) {
+        ///| not rdx
+      }
+#endif
       return;
     case ND_LOGAND: {
       int lfalse = codegen_pclabel();
@@ -1437,6 +2032,9 @@ static void gen_expr(Node* node) {
 
       int stack_args = push_args_sysv(node);
       gen_expr(node->lhs);
+      ///| mov r10, rax
+
+      eval_reg_args_sysv(node->args);
 
       int gp = 0, fp = 0;
 
@@ -1476,19 +2074,33 @@ static void gen_expr(Node* node) {
             break;
           case TY_FLOAT:
           case TY_DOUBLE:
-            if (fp < SYSV_FP_MAX)
-              popf(fp++);
+            if (fp < SYSV_FP_MAX) {
+              if (arg->eval_into_reg) {
+                fp++;
+              } else {
+                popf(fp++);
+              }
+            }
             break;
           case TY_LDOUBLE:
             break;
+          case TY_INT128:
+            if (gp + 2 <= SYSV_GP_MAX) {
+              pop(dasmargreg[gp++]);
+              pop(dasmargreg[gp++]);
+            }
+            break;
           default:
             if (gp < SYSV_GP_MAX) {
-              pop(dasmargreg[gp++]);
+              if (arg->eval_into_reg) {
+                gp++;
+              } else {
+                pop(dasmargreg[gp++]);
+              }
             }
         }
       }
 
-      ///| mov r10, rax
       ///| mov rax, fp
       ///| call r10
       ///| add rsp, stack_args*8
@@ -1533,6 +2145,8 @@ static void gen_expr(Node* node) {
       ///| lea rax, [=>node->pc_label]
       return;
     case ND_REFLECT_TYPE_PTR:
+      // The type only exists in this process.
+      C(current_fn)->is_process_specific = true;
       ///| mov64 rax, node->reflect_ty;
       return;
     case ND_CAS:
@@ -1753,6 +2367,9 @@ static void gen_expr(Node* node) {
 
       error_tok(node->tok, "invalid expression");
     }
+    case TY_INT128:
+      gen_binary_int128(node);
+      return;
 #endif
   }
 
@@ -1893,22 +2510,55 @@ static void gen_expr(Node* node) {
 }
 
 static void gen_stmt(Node* node) {
-#if X64WIN
-  if (user_context->generate_debug_symbols) {
+  if (wants_line_info()) {
     record_line_syminfo(node->tok->file->file_no, node->tok->line_no, codegen_pclabel());
   }
-#endif
 
   switch (node->kind) {
     case ND_IF: {
       int lelse = codegen_pclabel();
       int lend = codegen_pclabel();
+      // Counts of the then and else branches, see profile_branches.
+      int then_index = node->profile_site - 1;
+      int els_index = then_index < 0 ? -1 : then_index + 1;
       gen_expr(node->cond);
       cmp_zero(node->cond->ty);
+      Node* cold = cold_branch(node);
+      if (cold) {
+        // lelse is the start of the cold branch, placed out of line.
+        if (cold == node->then) {
+          ///| jne =>lelse
+          emit_profile_count(els_index);
+          if (node->els)
+            gen_stmt(node->els);
+        } else {
+          ///| je =>lelse
+          emit_profile_count(then_index);
+          gen_stmt(node->then);
+        }
+        ///|=>lend:
+        gen_cold(cold, false, lelse, lend, cold == node->then ? then_index : els_index);
+        return;
+      }
+      if (node->els && profile_count(node, 1) > profile_count(node, 0)) {
+        // The else branch is taken more often, so it's the one to fall through
+        // to, and lelse is the then branch instead.
+        ///| jne =>lelse
+        emit_profile_count(els_index);
+        gen_stmt(node->els);
+        ///| jmp =>lend
+        ///|=>lelse:
+        emit_profile_count(then_index);
+        gen_stmt(node->then);
+        ///|=>lend:
+        return;
+      }
       ///| je =>lelse
+      emit_profile_count(then_index);
       gen_stmt(node->then);
       ///| jmp =>lend
       ///|=>lelse:
+      emit_profile_count(els_index);
       if (node->els)
         gen_stmt(node->els);
       ///|=>lend:
@@ -1918,6 +2568,9 @@ static void gen_stmt(Node* node) {
       if (node->init)
         gen_stmt(node->init);
       int lbegin = codegen_pclabel();
+      // Loops that the profile says never went round aren't worth padding.
+      if (!C(in_cold_section) && !(has_profile(node) && profile_count(node, 0) == 0))
+        align_code();
       ///|=>lbegin:
       if (node->cond) {
         gen_expr(node->cond);
@@ -1926,6 +2579,11 @@ static void gen_stmt(Node* node) {
       }
       gen_stmt(node->then);
       ///|=>node->cont_pc_label:
+      emit_profile_count(node->profile_site - 1);
+#if !X64WIN
+      if (C(tier0_function))
+        emit_tier0_count(&C(tier0_function)->backedges, TIER_UP_BACKEDGES);
+#endif
       if (node->inc)
         gen_expr(node->inc);
       ///| jmp =>lbegin
@@ -1934,21 +2592,69 @@ static void gen_stmt(Node* node) {
     }
     case ND_DO: {
       int lbegin = codegen_pclabel();
+      if (!C(in_cold_section) && !(has_profile(node) && profile_count(node, 0) == 0))
+        align_code();
       ///|=>lbegin:
       gen_stmt(node->then);
       ///|=>node->cont_pc_label:
+      emit_profile_count(node->profile_site - 1);
+#if !X64WIN
+      if (C(tier0_function))
+        emit_tier0_count(&C(tier0_function)->backedges, TIER_UP_BACKEDGES);
+#endif
       gen_expr(node->cond);
       cmp_zero(node->cond->ty);
       ///| jne =>lbegin
       ///|=>node->brk_pc_label:
       return;
     }
-    case ND_SWITCH:
+    case ND_SWITCH: {
       gen_expr(node->cond);
 
+      // The most common cases are compared first, if there's a profile.
+      int num_cases = 0;
+      for (Node* n = node->case_next; n; n = n->case_next) {
+        ++num_cases;
+      }
+      Node** cases = bumpcalloc(num_cases, sizeof(Node*), AL_Compile);
+      num_cases = 0;
       for (Node* n = node->case_next; n; n = n->case_next) {
+        int i = num_cases++;
+        for (; i > 0 && profile_count(cases[i - 1], 0) < profile_count(n, 0); --i) {
+          cases[i] = cases[i - 1];
+        }
+        cases[i] = n;
+      }
+
+      for (int i = 0; i < num_cases; ++i) {
+        Node* n = cases[i];
         bool is_long = node->cond->ty->size == 8;
 
+#if !X64WIN
+        // Case values are ints, converted to the __int128, so the upper half
+        // has to be their sign too.
+        if (node->cond->ty->kind == TY_INT128) {
+          int lnext = codegen_pclabel();
+          int hi = n->begin < 0 ? -1 : 0;
+          if (n->begin == n->end) {
+            ///| cmp rax, n->begin
+            ///| jne =>lnext
+            ///| cmp rdx, hi
+            ///| je =>n->pc_label
+          } else {
+            ///| mov RUTIL, rax
+            ///| mov r11, rdx
+            ///| sub RUTIL, n->begin
+            ///| sbb r11, hi
+            ///| jne =>lnext
+            ///| cmp RUTIL, n->end - n->begin
+            ///| jbe =>n->pc_label
+          }
+          ///|=>lnext:
+          continue;
+        }
+#endif
+
         if (n->begin == n->end) {
           if (is_long) {
             ///| cmp rax, n->begin
@@ -1980,8 +2686,10 @@ static void gen_stmt(Node* node) {
       gen_stmt(node->then);
       ///|=>node->brk_pc_label:
       return;
+    }
     case ND_CASE:
       ///|=>node->pc_label:
+      emit_profile_count(node->profile_site - 1);
       gen_stmt(node->lhs);
       return;
     case ND_BLOCK:
@@ -2034,6 +2742,55 @@ static void gen_stmt(Node* node) {
   error_tok(node->tok, "invalid statement");
 }
 
+// AMD64 System V ABI has a special alignment rule for an array of
+// length at least 16 bytes. We need to align such array to at least
+// 16-byte boundaries. See p.14 of
+// https://github.com/hjl-tools/x86-psABI/wiki/x86-64-psABI-draft.pdf.
+// The same is used on Windows for simplicity.
+static int lvar_slot_bottom(Obj* var, int bottom) {
+  int align =
+      (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
+  bottom += var->ty->size;
+  return (int)align_to_s(bottom, align);
+}
+
+// Assign offsets to the locals declared directly in |sc| starting below
+// |bottom|, and then to those in nested scopes. Sibling scopes can't be live at
+// the same time, so each child starts at the same bottom and they overlap.
+// Returns the deepest bottom used by |sc| and its children.
+static int assign_scope_lvar_offsets(Obj* fn, Scope* sc, int bottom) {
+  for (Obj* var = fn->locals; var; var = var->next) {
+    if (var->offset || var->scope != sc)
+      continue;
+    bottom = lvar_slot_bottom(var, bottom);
+    var->offset = -bottom;
+  }
+
+  int deepest = bottom;
+  for (Scope* child = sc->children; child; child = child->sibling) {
+    int child_bottom = assign_scope_lvar_offsets(fn, child, bottom);
+    deepest = MAX(deepest, child_bottom);
+  }
+  return deepest;
+}
+
+// Assign offsets to all locals not already placed (i.e. not stack parameters),
+// and record the frame size in stats along with what it would have been
+// without slot sharing.
+static int assign_local_offsets(Obj* fn, int bottom) {
+  int unshared = bottom;
+  for (Obj* var = fn->locals; var; var = var->next) {
+    if (!var->offset)
+      unshared = lvar_slot_bottom(var, unshared);
+  }
+
+  bottom = assign_scope_lvar_offsets(fn, fn->scope, bottom);
+
+  C(stats).frame_bytes += align_to_s(bottom, 16);
+  C(stats).frame_bytes_unshared += align_to_s(unshared, 16);
+  return bottom;
+}
+
 #if X64WIN
 
 // Assign offsets to local variables.
@@ -2121,19 +2878,7 @@ static void assign_lvar_offsets(Obj* prog) {
     }
 
     // Assign offsets to local variables.
-    for (Obj* var = fn->locals; var; var = var->next) {
-      if (var->offset) {
-        continue;
-      }
-
-      int align =
-          (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
-
-      bottom += var->ty->size;
-      bottom = (int)align_to_s(bottom, align);
-      var->offset = -bottom;
-      // outaf("local %s at -0x%x\n", var->name, -var->offset);
-    }
+    bottom = assign_local_offsets(fn, bottom);
 
     fn->stack_size = (int)align_to_s(bottom, 16);
   }
@@ -2186,31 +2931,30 @@ static void assign_lvar_offsets(Obj* prog) {
           break;
         case TY_LDOUBLE:
           break;
+        case TY_INT128:
+          if (gp + 2 <= SYSV_GP_MAX) {
+            gp += 2;
+            continue;
+          }
+          break;
         default:
           if (gp++ < SYSV_GP_MAX)
             continue;
       }
 
-      top = align_to_s(top, 8);
+      // rbp+16 is 16 byte aligned, as the caller's rsp was.
+      top = align_to_s(top, ty->kind == TY_INT128 ? 16 : 8);
       var->offset = top;
       top += var->ty->size;
     }
 
     // Assign offsets to pass-by-register parameters and local variables.
-    for (Obj* var = fn->locals; var; var = var->next) {
-      if (var->offset)
-        continue;
-
-      // AMD64 System V ABI has a special alignment rule for an array of
-      // length at least 16 bytes. We need to align such array to at least
-      // 16-byte boundaries. See p.14 of
-      // https://github.com/hjl-tools/x86-psABI/wiki/x86-64-psABI-draft.pdf.
-      int align =
-          (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
-
-      bottom += var->ty->size;
-      bottom = align_to_s(bottom, align);
-      var->offset = -bottom;
+    if (fn->is_definition && fn->is_live) {
+      bottom = assign_local_offsets(fn, bottom);
+      if (user_context->instrument_cycles && is_instrumented(fn)) {
+        bottom = align_to_s(bottom, 8) + 8;
+        fn->instrument_tsc_offset = -bottom;
+      }
     }
 
     fn->stack_size = align_to_s(bottom, 16);
@@ -2233,107 +2977,165 @@ static void linkfixup_push(FileLinkData* fld, char* target, char* fixup, int add
   fld->fixups[fld->flen++] = (LinkFixup){fixup, strdup(target), addend};
 }
 
-static void emit_data(Obj* prog) {
-  for (Obj* var = prog; var; var = var->next) {
-    // outaf("var->name %s %d %d %d %d\n", var->name, var->is_function, var->is_definition,
-    // var->is_static, var->is_tentative);
-    if (var->is_function)
-      continue;
+static int data_object_alignment(Obj* var) {
+  return (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
+}
 
-    if (!var->is_definition) {
-      continue;
+// Allocates data object |name| in global_data[idx], and returns it to be
+// initialized. Returns NULL if it's writable and already exists, in which case
+// it keeps its current contents. Global data is shared between files, so this
+// must be called with compile_mutex held.
+static char* create_data_object(size_t idx, char* name, bool is_rodata, int size, int align) {
+  // - rodata, always free existing entry in either static/extern
+  // global_data, and then recreate and reinitialize
+  //
+  // - if writeable data has an entry, it shouldn't be recreated. the
+  // dyo version doesn't reprocess kTypeInitializerDataRelocation or
+  // kTypeInitializerCodeRelocation; that's possibly a bug, but it'll
+  // need some testing to get a case where it comes up.
+  //
+  // TODO: if it changes from static to extern, is it the same
+  // variable? currently they're separate, so a switch causes a
+  // reinit, a leak, and some confusion.
+  //
+  // can't easily make a large single data segment allocation for all
+  // data because 1) the rodata change size link-over-link (put in
+  // codeseg?); 2) wdata don't move or reinit, but new ones get added
+  // as code evolves and we can't blow away or move the old ones.
+  //
+  // for now, just continue with individual regular aligned_allocate
+  // for all data objects and maintain their addresses here.
+
+  UserContext* uc = user_context;
+  // bool was_freed = false;
+  void* prev = hashmap_get(&uc->global_data[idx], name);
+  if (prev) {
+    if (is_rodata) {
+      retire_aligned(prev, size);
+      // was_freed = true;
+    } else {
+      // data already created and initialized, don't reinit.
+      return NULL;
     }
+  }
 
-    int align =
-        (var->ty->kind == TY_ARRAY && var->ty->size >= 16) ? MAX(16, var->align) : var->align;
+  void* global_data = aligned_allocate(size, align);
+  memset(global_data, 0, size);
 
-    // - rodata, always free existing entry in either static/extern
-    // global_data, and then recreate and reinitialize
-    //
-    // - if writeable data has an entry, it shouldn't be recreated. the
-    // dyo version doesn't reprocess kTypeInitializerDataRelocation or
-    // kTypeInitializerCodeRelocation; that's possibly a bug, but it'll
-    // need some testing to get a case where it comes up.
-    //
-    // TODO: if it changes from static to extern, is it the same
-    // variable? currently they're separate, so a switch causes a
-    // reinit, a leak, and some confusion.
-    //
-    // can't easily make a large single data segment allocation for all
-    // data because 1) the rodata change size link-over-link (put in
-    // codeseg?); 2) wdata don't move or reinit, but new ones get added
-    // as code evolves and we can't blow away or move the old ones.
-    //
-    // for now, just continue with individual regular aligned_allocate
-    // for all data objects and maintain their addresses here.
-
-    UserContext* uc = user_context;
-    // bool was_freed = false;
-    size_t idx = var->is_static ? C(file_index) : uc->num_files;
-    void* prev = hashmap_get(&user_context->global_data[idx], var->name);
-    if (prev) {
-      if (var->is_rodata) {
-        aligned_free(prev);
-        // was_freed = true;
-      } else {
-        // data already created and initialized, don't reinit.
-        continue;
+  // TODO: Is this wrong (or above)? If writable |x| in one file
+  // already existed and |x| in another is added, then it'll be
+  // silently ignored. If it's rodata it'll be silently replaced here
+  // by getting thrown away above and then recreated.
+  // Need to figure out where/how to have a duplicate symbol check.
+#if 0
+    if (!was_freed) {
+      void* prev = hashmap_get(&uc->global_data[idx], strings.data[name_index]);
+      if (prev) {
+        outaf("duplicated symbol: %s\n", strings.data[name_index]);
+        goto fail;
       }
     }
+#endif
+  // TODO: intern
+  hashmap_put(&uc->global_data[idx], strdup(name), global_data);
+  return global_data;
+}
 
-    void* global_data = aligned_allocate(var->ty->size, align);
-    memset(global_data, 0, var->ty->size);
+IMPLSTATIC void free_data_objects(FileLinkData* fld) {
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    free(obj->name);
+    free(obj->init_data);
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      free(obj->relocs[j].name);
+    }
+    free(obj->relocs);
+  }
+  free(fld->data_objects);
+  fld->data_objects = NULL;
+  fld->num_data_objects = 0;
+}
 
-    // TODO: Is this wrong (or above)? If writable |x| in one file
-    // already existed and |x| in another is added, then it'll be
-    // silently ignored. If it's rodata it'll be silently replaced here
-    // by getting thrown away above and then recreated.
-    // Need to figure out where/how to have a duplicate symbol check.
-#if 0
-      if (!was_freed) {
-        void* prev = hashmap_get(&uc->global_data[idx], strings.data[name_index]);
-        if (prev) {
-          outaf("duplicated symbol: %s\n", strings.data[name_index]);
-          goto fail;
-        }
-      }
-#endif
-    // TODO: intern
-    hashmap_put(&uc->global_data[idx], strdup(var->name), global_data);
+// Records the data objects defined by |prog|, replacing those from the file's
+// previous compile.
+static void update_data_objects(Obj* prog, FileLinkData* fld) {
+  free_data_objects(fld);
 
-    char* fillp = global_data;
-    FileLinkData* fld = &uc->files[C(file_index)];
+  int num_data_objects = 0;
+  for (Obj* var = prog; var; var = var->next) {
+    if (!var->is_function && var->is_definition)
+      ++num_data_objects;
+  }
+  fld->data_objects = calloc(num_data_objects + 1, sizeof(DataObject));
 
-    // .data or .tdata
-    if (var->init_data) {
-      Relocation* rel = var->rel;
-      int pos = 0;
-      while (pos < var->ty->size) {
-        if (rel && rel->offset == pos) {
-          assert(!(rel->string_label && rel->internal_code_label));  // Shouldn't be both.
-          assert(rel->string_label ||
-                 rel->internal_code_label);  // But should be at least one if we're here.
-
-          if (rel->string_label) {
-            linkfixup_push(fld, *rel->string_label, fillp, rel->addend);
-          } else {
-            int offset = dasm_getpclabel(&C(dynasm), *rel->internal_code_label);
-            *((uintptr_t*)fillp) = (uintptr_t)(fld->codeseg_base_address + offset + rel->addend);
-          }
+  for (Obj* var = prog; var; var = var->next) {
+    if (var->is_function || !var->is_definition)
+      continue;
 
-          rel = rel->next;
-          pos += 8;
-          fillp += 8;
-        } else {
-          *fillp++ = var->init_data[pos++];
-        }
-      }
+    DataObject* obj = &fld->data_objects[fld->num_data_objects++];
+    obj->name = strdup(var->name);
+    obj->is_static = var->is_static;
+    obj->is_rodata = var->is_rodata;
+    obj->size = var->ty->size;
+    obj->align = data_object_alignment(var);
 
+    // If no init_data, it's .bss and only needs to be cleared.
+    if (!var->init_data)
       continue;
+    obj->init_data = malloc(obj->size);
+    memcpy(obj->init_data, var->init_data, obj->size);
+
+    int num_relocs = 0;
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      ++num_relocs;
+    }
+    obj->relocs = calloc(num_relocs + 1, sizeof(DataReloc));
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      assert(!(rel->string_label && rel->internal_code_label));  // Shouldn't be both.
+      assert(rel->string_label ||
+             rel->internal_code_label);  // But should be at least one if we're here.
+
+      DataReloc* dr = &obj->relocs[obj->num_relocs++];
+      dr->offset = rel->offset;
+      dr->addend = (int)rel->addend;
+      if (rel->string_label)
+        dr->name = strdup(*rel->string_label);
+      else
+        dr->code_offset = dasm_getpclabel(&C(dynasm), *rel->internal_code_label);
     }
+  }
+}
 
-    // If no init_data, then already allocated and cleared (.bss).
+// Creates the file's data objects, and the fixups for the pointers in their
+// initializers. |codeseg_base_address| is where the code that was emitted
+// along with them starts, for any that point into it.
+IMPLSTATIC void install_data_objects(size_t file_index, char* codeseg_base_address) {
+  UserContext* uc = user_context;
+  FileLinkData* fld = &uc->files[file_index];
+  free_link_fixups(fld);
+
+  // Global data is shared with other files being compiled at the same time.
+  mutex_lock(uc->compile_mutex);
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    size_t idx = obj->is_static ? file_index : uc->num_files;
+    char* fillp = create_data_object(idx, obj->name, obj->is_rodata, obj->size, obj->align);
+    if (!fillp || !obj->init_data)
+      continue;
+
+    // .data or .tdata
+    memcpy(fillp, obj->init_data, obj->size);
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      DataReloc* dr = &obj->relocs[j];
+      if (dr->name) {
+        linkfixup_push(fld, dr->name, fillp + dr->offset, dr->addend);
+      } else {
+        uintptr_t address = (uintptr_t)(codeseg_base_address + dr->code_offset + dr->addend);
+        memcpy(fillp + dr->offset, &address, sizeof(address));
+      }
+    }
   }
+  mutex_unlock(uc->compile_mutex);
 }
 
 static void store_fp(int r, int offset, int sz) {
@@ -2376,217 +3178,192 @@ static void store_gp(int r, int offset, int sz) {
 extern int __chkstk(void);
 #endif  // X64WIN
 
-static void emit_text(Obj* prog) {
-  // Preallocate the dasm labels so they can be used in functions out of order.
-  for (Obj* fn = prog; fn; fn = fn->next) {
-    if (!fn->is_function || !fn->is_definition || !fn->is_live)
-      continue;
-
-    fn->dasm_return_label = codegen_pclabel();
-    fn->dasm_entry_label = codegen_pclabel();
-    fn->dasm_end_of_function_label = codegen_pclabel();
-    fn->dasm_unwind_info_label = codegen_pclabel();
-  }
+static void emit_function(Obj* fn) {
+  fn->symbol_refs_begin = C(symbol_refs).len;
+  fn->file_line_label_data = (IntIntIntArray){0};
 
-  ///| .code
+  align_code();
+  ///|=>fn->dasm_entry_label:
 
-  for (Obj* fn = prog; fn; fn = fn->next) {
-    if (!fn->is_function || !fn->is_definition || !fn->is_live)
-      continue;
+#if !X64WIN
+  if (C(tier0_function))
+    emit_tier0_count(&C(tier0_function)->calls, TIER_UP_CALLS);
+#endif
 
-    ///|=>fn->dasm_entry_label:
+  fn->dasm_cold_label = codegen_pclabel();
+  ///| .cold
+  ///|=>fn->dasm_cold_label:
+  ///| .code
 
-    C(current_fn) = fn;
+  C(current_fn) = fn;
+  C(profile) = find_profile(C(file_index), fn);
+  if (user_context->profile_branches && fn->num_profile_sites && !fn->profile_counts) {
+    fn->profile_counts = aligned_allocate(fn->num_profile_sites * sizeof(uint64_t), 8);
+    memset(fn->profile_counts, 0, fn->num_profile_sites * sizeof(uint64_t));
+  }
+#if !X64WIN
+  if (is_instrumented(fn)) {
+    // The hooks and counts are referred to by their addresses in this process.
+    fn->is_process_specific = true;
+    if (user_context->instrument_cycles && !fn->instrument_counts) {
+      fn->instrument_counts = aligned_allocate(2 * sizeof(uint64_t), 8);
+      memset(fn->instrument_counts, 0, 2 * sizeof(uint64_t));
+    }
+  }
+#endif
 
-#if X64WIN
+  if (wants_line_info())
     record_line_syminfo(fn->ty->name->file->file_no, fn->ty->name->line_no, codegen_pclabel());
-#endif
 
-    // outaf("---- %s\n", fn->name);
+  // outaf("---- %s\n", fn->name);
 
-    // Prologue
-    ///| push rbp
-    ///| mov rbp, rsp
+  // Prologue
+  fn->dasm_prologue_label = codegen_pclabel();
+  ///|=>fn->dasm_prologue_label:
+  ///| push rbp
+  ///| mov rbp, rsp
 
 #if X64WIN
-    // Stack probe on Windows if necessary. The MSDN reference for __chkstk says
-    // it's only necessary beyond 8k for x64, but cl does it at 4k.
-    if (fn->stack_size >= 4096) {
-      ///| mov rax, fn->stack_size
-      int fixup_location = codegen_pclabel();
-      strintarray_push(&C(fixups), (StringInt){"__chkstk", fixup_location}, AL_Compile);
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4310)  // dynasm casts the top and bottom of the 64bit arg
-#endif
-      ///|=>fixup_location:
-      ///| mov64 r10, 0xc0dec0dec0dec0de
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-      ///| call r10
-      ///| sub rsp, rax
-
-      // TODO: pdata emission
-    } else
+  // Stack probe on Windows if necessary. The MSDN reference for __chkstk says
+  // it's only necessary beyond 8k for x64, but cl does it at 4k.
+  if (fn->stack_size >= 4096) {
+    ///| mov rax, fn->stack_size
+    load_symbol_address(REG_R10, "__chkstk");
+    ///| call r10
+    ///| sub rsp, rax
+
+    // TODO: pdata emission
+  } else
 #endif
 
-    {
-      ///| sub rsp, fn->stack_size
+  {
+    ///| sub rsp, fn->stack_size
 
-      // TODO: add a label here to assert that the prolog size is as expected
+    // TODO: add a label here to assert that the prolog size is as expected
 
 #if X64WIN
-      // RtlAddFunctionTable() requires these to be at an offset with the same
-      // base as the function offsets, so we need to emit these into the main
-      // codeseg allocation, rather than just allocating them separately, since
-      // we can't easily guarantee a <4G offset to them otherwise.
-
-      // Unfortunately, we can't build another section with this as dynasm
-      // doesn't seem to allow resolving these offsets, so this is done later
-      //| .dword =>fn->dasm_entry_label
-      //| .dword =>fn->dasm_end_of_function_label
-      //| .dword =>fn->dasm_unwind_info_label
-
-      // TODO: probably info about rdi pushed for memsets.
-
-      // https://learn.microsoft.com/en-us/cpp/build/exception-handling-x64?view=msvc-170
-      enum {
-        UWOP_PUSH_NONVOL = 0,
-        UWOP_ALLOC_LARGE = 1,
-        UWOP_ALLOC_SMALL = 2,
-        UWOP_SET_FPREG = 3,
-      };
-
-      // These are the UNWIND_INFO structure that is referenced by the third
-      // element of RUNTIME_FUNCTION.
-      ///| .pdata
-      // This takes care of cases where CountOfCodes is odd.
-      ///| .align 4
-      ///|=>fn->dasm_unwind_info_label:
-      ///| .byte 1  /* Version:3 (1) and Flags:5 (0) */
-      bool small_stack = fn->stack_size / 8 - 1 <= 15;
-      if (small_stack) {
-        // We just happen to "know" this is the form used for small stack sizes.
-        // xxxxxxxxxxxx0000 55                   push        rbp
-        // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
-        // xxxxxxxxxxxx0004 48 83 EC 10          sub         rsp,10h
-        // xxxxxxxxxxxx0009 ...
-        ///| .byte 8  /* SizeOfProlog */
-        ///| .byte 3  /* CountOfCodes */
-      } else {
-        // And this one for larger reservations.
-        // xxxxxxxxxxxx0000 55                   push        rbp
-        // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
-        // xxxxxxxxxxxx0004 48 81 EC B0 01 00 00 sub         rsp,1B0h
-        // xxxxxxxxxxxx000b ...
-        ///| .byte 11  /* SizeOfProlog */
-        ///| .byte 4  /* CountOfCodes */
-      }
-      ///| .byte 5  /* FrameRegister:4 (RBP) | FrameOffset:4: 0 offset */
-
-      if (small_stack) {
-        ///| .byte 8  /* CodeOffset */
-        ///| .byte UWOP_ALLOC_SMALL | (((unsigned char)((fn->stack_size / 8) - 1)) << 4)
-      } else {
-        ///| .byte 11  /* CodeOffset */
-        assert(fn->stack_size / 8 <= 65535 && "todo; not UWOP_ALLOC_LARGE 0-style");
-        ///| .byte UWOP_ALLOC_LARGE
-        ///| .word fn->stack_size / 8
-      }
-      ///| .byte 4  /* CodeOffset */
-      ///| .byte UWOP_SET_FPREG
-      ///| .byte 1  /* CodeOffset */
-      ///| .byte UWOP_PUSH_NONVOL | (5 /* RBP */ << 4)
+    // RtlAddFunctionTable() requires these to be at an offset with the same
+    // base as the function offsets, so we need to emit these into the main
+    // codeseg allocation, rather than just allocating them separately, since
+    // we can't easily guarantee a <4G offset to them otherwise.
+
+    // Unfortunately, we can't build another section with this as dynasm
+    // doesn't seem to allow resolving these offsets, so this is done later
+    //| .dword =>fn->dasm_entry_label
+    //| .dword =>fn->dasm_end_of_function_label
+    //| .dword =>fn->dasm_unwind_info_label
+
+    // TODO: probably info about rdi pushed for memsets.
+
+    // https://learn.microsoft.com/en-us/cpp/build/exception-handling-x64?view=msvc-170
+    enum {
+      UWOP_PUSH_NONVOL = 0,
+      UWOP_ALLOC_LARGE = 1,
+      UWOP_ALLOC_SMALL = 2,
+      UWOP_SET_FPREG = 3,
+    };
 
-      ///| .code
-#endif
+    // These are the UNWIND_INFO structure that is referenced by the third
+    // element of RUNTIME_FUNCTION.
+    ///| .pdata
+    // This takes care of cases where CountOfCodes is odd.
+    ///| .align 4
+    ///|=>fn->dasm_unwind_info_label:
+    ///| .byte 1  /* Version:3 (1) and Flags:5 (0) */
+    bool small_stack = fn->stack_size / 8 - 1 <= 15;
+    if (small_stack) {
+      // We just happen to "know" this is the form used for small stack sizes.
+      // xxxxxxxxxxxx0000 55                   push        rbp
+      // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
+      // xxxxxxxxxxxx0004 48 83 EC 10          sub         rsp,10h
+      // xxxxxxxxxxxx0009 ...
+      ///| .byte 8  /* SizeOfProlog */
+      ///| .byte 3  /* CountOfCodes */
+    } else {
+      // And this one for larger reservations.
+      // xxxxxxxxxxxx0000 55                   push        rbp
+      // xxxxxxxxxxxx0001 48 89 E5             mov         rbp,rsp
+      // xxxxxxxxxxxx0004 48 81 EC B0 01 00 00 sub         rsp,1B0h
+      // xxxxxxxxxxxx000b ...
+      ///| .byte 11  /* SizeOfProlog */
+      ///| .byte 4  /* CountOfCodes */
+    }
+    ///| .byte 5  /* FrameRegister:4 (RBP) | FrameOffset:4: 0 offset */
+
+    if (small_stack) {
+      ///| .byte 8  /* CodeOffset */
+      ///| .byte UWOP_ALLOC_SMALL | (((unsigned char)((fn->stack_size / 8) - 1)) << 4)
+    } else {
+      ///| .byte 11  /* CodeOffset */
+      assert(fn->stack_size / 8 <= 65535 && "todo; not UWOP_ALLOC_LARGE 0-style");
+      ///| .byte UWOP_ALLOC_LARGE
+      ///| .word fn->stack_size / 8
     }
+    ///| .byte 4  /* CodeOffset */
+    ///| .byte UWOP_SET_FPREG
+    ///| .byte 1  /* CodeOffset */
+    ///| .byte UWOP_PUSH_NONVOL | (5 /* RBP */ << 4)
+
+    ///| .code
+#endif
+  }
 
-    ///| mov [rbp+fn->alloca_bottom->offset], rsp
+  ///| mov [rbp+fn->alloca_bottom->offset], rsp
 
 #if !X64WIN
-    // Save arg registers if function is variadic
-    if (fn->va_area) {
-      int gp = 0, fp = 0;
-      for (Obj* var = fn->params; var; var = var->next) {
-        if (is_flonum(var->ty))
-          fp++;
-        else
-          gp++;
-      }
-
-      int off = fn->va_area->offset;
-
-      // va_elem
-      ///| mov dword [rbp+off], gp*8            // gp_offset
-      ///| mov dword [rbp+off+4], fp * 8 + 48   // fp_offset
-      ///| mov [rbp+off+8], rbp                 // overflow_arg_area
-      ///| add qword [rbp+off+8], 16
-      ///| mov [rbp+off+16], rbp                // reg_save_area
-      ///| add qword [rbp+off+16], off+24
-
-      // __reg_save_area__
-      ///| mov [rbp + off + 24], rdi
-      ///| mov [rbp + off + 32], rsi
-      ///| mov [rbp + off + 40], rdx
-      ///| mov [rbp + off + 48], rcx
-      ///| mov [rbp + off + 56], r8
-      ///| mov [rbp + off + 64], r9
-      ///| movsd qword [rbp + off + 72], xmm0
-      ///| movsd qword [rbp + off + 80], xmm1
-      ///| movsd qword [rbp + off + 88], xmm2
-      ///| movsd qword [rbp + off + 96], xmm3
-      ///| movsd qword [rbp + off + 104], xmm4
-      ///| movsd qword [rbp + off + 112], xmm5
-      ///| movsd qword [rbp + off + 120], xmm6
-      ///| movsd qword [rbp + off + 128], xmm7
+  // Save arg registers if function is variadic
+  if (fn->va_area) {
+    int gp = 0, fp = 0;
+    for (Obj* var = fn->params; var; var = var->next) {
+      if (is_flonum(var->ty))
+        fp++;
+      else if (var->ty->kind == TY_INT128)
+        gp += 2;
+      else
+        gp++;
     }
+
+    int off = fn->va_area->offset;
+
+    // va_elem
+    ///| mov dword [rbp+off], gp*8            // gp_offset
+    ///| mov dword [rbp+off+4], fp * 8 + 48   // fp_offset
+    ///| mov [rbp+off+8], rbp                 // overflow_arg_area
+    ///| add qword [rbp+off+8], 16
+    ///| mov [rbp+off+16], rbp                // reg_save_area
+    ///| add qword [rbp+off+16], off+24
+
+    // __reg_save_area__
+    ///| mov [rbp + off + 24], rdi
+    ///| mov [rbp + off + 32], rsi
+    ///| mov [rbp + off + 40], rdx
+    ///| mov [rbp + off + 48], rcx
+    ///| mov [rbp + off + 56], r8
+    ///| mov [rbp + off + 64], r9
+    ///| movsd qword [rbp + off + 72], xmm0
+    ///| movsd qword [rbp + off + 80], xmm1
+    ///| movsd qword [rbp + off + 88], xmm2
+    ///| movsd qword [rbp + off + 96], xmm3
+    ///| movsd qword [rbp + off + 104], xmm4
+    ///| movsd qword [rbp + off + 112], xmm5
+    ///| movsd qword [rbp + off + 120], xmm6
+    ///| movsd qword [rbp + off + 128], xmm7
+  }
 #endif
 
 #if X64WIN
-    // If variadic, we have to store all registers; floats will have been
-    // duplicated into the integer registers.
-    if (fn->ty->is_variadic) {
-      ///| mov [rbp + 16], CARG1
-      ///| mov [rbp + 24], CARG2
-      ///| mov [rbp + 32], CARG3
-      ///| mov [rbp + 40], CARG4
-    } else {
-      // Save passed-by-register arguments to the stack
-      int reg = 0;
-      for (Obj* var = fn->params; var; var = var->next) {
-        if (var->offset >= 16 + PARAMETER_SAVE_SIZE)
-          continue;
-
-        Type* ty = var->ty;
-
-        switch (ty->kind) {
-          case TY_STRUCT:
-          case TY_UNION:
-            // It's either small and so passed in a register, or isn't and then
-            // we're instead storing the pointer to the larger struct.
-            if (type_passed_in_register(ty)) {
-              store_gp(reg++, var->offset, ty->size);
-            } else {
-              store_gp(reg++, var->offset, 8);
-            }
-            break;
-          case TY_FLOAT:
-          case TY_DOUBLE:
-            store_fp(reg++, var->offset, ty->size);
-            break;
-          default:
-            store_gp(reg++, var->offset, ty->size);
-            break;
-        }
-      }
-    }
-#else
+  // If variadic, we have to store all registers; floats will have been
+  // duplicated into the integer registers.
+  if (fn->ty->is_variadic) {
+    ///| mov [rbp + 16], CARG1
+    ///| mov [rbp + 24], CARG2
+    ///| mov [rbp + 32], CARG3
+    ///| mov [rbp + 40], CARG4
+  } else {
     // Save passed-by-register arguments to the stack
-    int gp = 0, fp = 0;
+    int reg = 0;
     for (Obj* var = fn->params; var; var = var->next) {
-      if (var->offset > 0)
+      if (var->offset >= 16 + PARAMETER_SAVE_SIZE)
         continue;
 
       Type* ty = var->ty;
@@ -2594,68 +3371,196 @@ static void emit_text(Obj* prog) {
       switch (ty->kind) {
         case TY_STRUCT:
         case TY_UNION:
-          assert(ty->size <= 16);
-          if (has_flonum(ty, 0, 8, 0))
-            store_fp(fp++, var->offset, MIN(8, ty->size));
-          else
-            store_gp(gp++, var->offset, MIN(8, ty->size));
-
-          if (ty->size > 8) {
-            if (has_flonum(ty, 8, 16, 0))
-              store_fp(fp++, var->offset + 8, ty->size - 8);
-            else
-              store_gp(gp++, var->offset + 8, ty->size - 8);
+          // It's either small and so passed in a register, or isn't and then
+          // we're instead storing the pointer to the larger struct.
+          if (type_passed_in_register(ty)) {
+            store_gp(reg++, var->offset, ty->size);
+          } else {
+            store_gp(reg++, var->offset, 8);
           }
           break;
         case TY_FLOAT:
         case TY_DOUBLE:
-          store_fp(fp++, var->offset, ty->size);
+          store_fp(reg++, var->offset, ty->size);
           break;
         default:
-          store_gp(gp++, var->offset, ty->size);
+          store_gp(reg++, var->offset, ty->size);
+          break;
       }
     }
-#endif
+  }
+#else
+  // Save passed-by-register arguments to the stack
+  int gp = 0, fp = 0;
+  for (Obj* var = fn->params; var; var = var->next) {
+    if (var->offset > 0)
+      continue;
 
-    // Emit code
-    gen_stmt(fn->body);
-    assert(C(depth) == 0);
+    Type* ty = var->ty;
 
-    // [https://www.sigbus.info/n1570#5.1.2.2.3p1] The C spec defines
-    // a special rule for the main function. Reaching the end of the
-    // main function is equivalent to returning 0, even though the
-    // behavior is undefined for the other functions.
-    if (strcmp(fn->name, "main") == 0) {
-      ///| mov rax, 0
+    switch (ty->kind) {
+      case TY_STRUCT:
+      case TY_UNION:
+        assert(ty->size <= 16);
+        if (has_flonum(ty, 0, 8, 0))
+          store_fp(fp++, var->offset, MIN(8, ty->size));
+        else
+          store_gp(gp++, var->offset, MIN(8, ty->size));
+
+        if (ty->size > 8) {
+          if (has_flonum(ty, 8, 16, 0))
+            store_fp(fp++, var->offset + 8, ty->size - 8);
+          else
+            store_gp(gp++, var->offset + 8, ty->size - 8);
+        }
+        break;
+      case TY_FLOAT:
+      case TY_DOUBLE:
+        store_fp(fp++, var->offset, ty->size);
+        break;
+      case TY_INT128:
+        store_gp(gp++, var->offset, 8);
+        store_gp(gp++, var->offset + 8, 8);
+        break;
+      default:
+        store_gp(gp++, var->offset, ty->size);
     }
+  }
+#endif
+
+#if !X64WIN
+  if (is_instrumented(fn))
+    emit_instrument_enter(fn);
+#endif
+
+  // Emit code
+  gen_stmt(fn->body);
+  assert(C(depth) == 0);
+
+  // [https://www.sigbus.info/n1570#5.1.2.2.3p1] The C spec defines
+  // a special rule for the main function. Reaching the end of the
+  // main function is equivalent to returning 0, even though the
+  // behavior is undefined for the other functions.
+  if (strcmp(fn->name, "main") == 0) {
+    ///| mov rax, 0
+  }
 
-    // Epilogue
-    ///|=>fn->dasm_return_label:
+  // Epilogue
+  ///|=>fn->dasm_return_label:
+#if !X64WIN
+  if (is_instrumented(fn))
+    emit_instrument_exit(fn);
+#endif
 #if X64WIN
-    // https://learn.microsoft.com/en-us/cpp/build/prolog-and-epilog?view=msvc-170#epilog-code
-    // says this the required form to recognize an epilog.
-    ///| lea rsp, [rbp]
+  // https://learn.microsoft.com/en-us/cpp/build/prolog-and-epilog?view=msvc-170#epilog-code
+  // says this the required form to recognize an epilog.
+  ///| lea rsp, [rbp]
 #else
-    ///| mov rsp, rbp
+  ///| mov rsp, rbp
 #endif
-    ///| pop rbp
-    ///| ret
+  ///| pop rbp
+  fn->dasm_epilogue_ret_label = codegen_pclabel();
+  ///|=>fn->dasm_epilogue_ret_label:
+  ///| ret
+
+  ///|=>fn->dasm_end_of_function_label:
+  fn->dasm_end_of_cold_label = codegen_pclabel();
+  ///| .cold
+  ///|=>fn->dasm_end_of_cold_label:
+  ///| .code
+
+  fn->symbol_refs_end = C(symbol_refs).len;
+}
+
+#if !X64WIN
+// The code that lazy functions' stubs initially jump to, with the address of
+// the function's LazyFunction in r11. Compiles the function, and then
+// continues into it with the argument registers as they were.
+static void emit_lazy_thunk(void) {
+  C(lazy_thunk_label) = codegen_pclabel();
+  align_code();
+  ///|=>C(lazy_thunk_label):
+  emit_call_preserving_args((void*)compile_lazy_function);
+  ///| jmp r11
+}
+
+// Emits a stub in place of |fn|'s code, that jumps through its LazyFunction's
+// target.
+static void emit_lazy_stub(Obj* fn) {
+  LazyFunction* lf = bumpcalloc(1, sizeof(LazyFunction), AL_Compile);
+  lf->fn = fn;
+  lf->file = C(lazy_file);
+  lf->next = C(lazy_file)->functions;
+  C(lazy_file)->functions = lf;
+  fn->lazy = lf;
+
+  fn->symbol_refs_begin = fn->symbol_refs_end = C(symbol_refs).len;
+  align_code();
+  ///|=>fn->dasm_entry_label:
+  ///| mov64 r11, (uintptr_t)lf
+  ///| jmp qword [r11]
+  ///|=>fn->dasm_end_of_function_label:
+}
+
+// In lazy_compilation (or tiered_compilation) mode, starts the LazyFile that the file's functions will
+// be compiled from.
+static void start_lazy_file(Obj* prog) {
+  if (!user_context->lazy_compilation && !user_context->tiered_compilation)
+    return;
 
-    ///|=>fn->dasm_end_of_function_label:
+  bool any = false;
+  for (Obj* var = prog; var; var = var->next) {
+    // Labels taken as values in data initializers have to be in the code
+    // emitted along with the data.
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      if (rel->internal_code_label)
+        return;
+    }
+    if (var->is_function && var->is_definition && var->is_live && !var->reused_code)
+      any = true;
   }
+  if (!any)
+    return;
+
+  C(lazy_file) = bumpcalloc(1, sizeof(LazyFile), AL_Compile);
+  C(lazy_file)->ctx = user_context;
+  C(lazy_file)->file_index = C(file_index);
+  C(lazy_file)->files = compiler_state.tokenize__all_tokenized_files;
 }
+#endif
+
+static void emit_text(Obj* prog) {
+  // Preallocate the dasm labels so they can be used in functions out of order.
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live || fn->reused_code)
+      continue;
 
-static void fill_out_text_exports(Obj* prog, char* codeseg_base_address) {
-  // per-file from any previous need to be cleared out for this round.
-  hashmap_clear_manual_key_owned_value_unowned(&user_context->exports[C(file_index)]);
+    fn->dasm_return_label = codegen_pclabel();
+    fn->dasm_entry_label = codegen_pclabel();
+    fn->dasm_end_of_function_label = codegen_pclabel();
+    fn->dasm_unwind_info_label = codegen_pclabel();
+  }
+
+  ///| .code
+
+#if !X64WIN
+  if (C(lazy_file))
+    emit_lazy_thunk();
+#endif
 
   for (Obj* fn = prog; fn; fn = fn->next) {
-    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+    if (!fn->is_function || !fn->is_definition || !fn->is_live || fn->reused_code)
       continue;
 
-    int offset = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
-    size_t idx = fn->is_static ? C(file_index) : user_context->num_files;
-    hashmap_put(&user_context->exports[idx], strdup(fn->name), codeseg_base_address + offset);
+#if !X64WIN
+    if (C(lazy_file)) {
+      emit_lazy_stub(fn);
+      continue;
+    }
+#endif
+    double trace_start = trace_begin();
+    emit_function(fn);
+    trace_end(trace_start, "emit function", fn->name);
   }
 }
 
@@ -2669,19 +3574,305 @@ IMPLSTATIC void free_link_fixups(FileLinkData* fld) {
   fld->fcap = 0;
 }
 
-static void fill_out_fixups(FileLinkData* fld) {
-  for (int i = 0; i < C(fixups).len; ++i) {
-    int offset = dasm_getpclabel(&C(dynasm), C(fixups).data[i].i);
-    // +2 is a hack taking advantage of the fact that import fixups are always
-    // of the form `mov64 rax, <ADDR>` which is encoded as:
-    //   48 B8 <8 byte address>
-    // so skip over the mov64 prefix and point directly at the address to be
-    // slapped into place.
-    offset += 2;
+static void free_function_code_record(FunctionCode* fc) {
+  free(fc->name);
+  free(fc->slots);
+  free(fc->slot_refs);
+  if (fc->profile_counts)
+    aligned_free(fc->profile_counts);
+  if (fc->instrument_counts)
+    aligned_free(fc->instrument_counts);
+}
+
+IMPLSTATIC void free_function_code(FileLinkData* fld) {
+  for (int i = 0; i < fld->num_functions; ++i) {
+    free_function_code_record(&fld->functions[i]);
+  }
+  free(fld->functions);
+  fld->functions = NULL;
+  fld->num_functions = 0;
+
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    free_executable_memory(fld->chunks[i].base_address, fld->chunks[i].size);
+  }
+  free(fld->chunks);
+  fld->chunks = NULL;
+  fld->num_chunks = 0;
+
+  free_lazy_file(fld->lazy);
+  fld->lazy = NULL;
+}
+
+static bool chunk_contains(CodeChunk* chunk, char* address) {
+  return address >= chunk->base_address && address < chunk->base_address + chunk->size;
+}
+
+// Marks the functions whose code from the previous update can be used as is,
+// i.e. those with the same name and code_hash (and lines, if there's line
+// info) as before. Everything else in
+// the file is referenced through symbol slots, so that code doesn't depend
+// on where the rest of the file ends up.
+static void find_reusable_code(Obj* prog, FileLinkData* fld) {
+#if X64WIN
+  // Functions refer to each other by label and the unwind tables are built for
+  // a single code segment, so everything is compiled each time.
+  (void)prog;
+  (void)fld;
+#else
+  // Labels taken as values in data initializers are only known while the code
+  // that contains them is being emitted.
+  for (Obj* var = prog; var; var = var->next) {
+    for (Relocation* rel = var->rel; rel; rel = rel->next) {
+      if (rel->internal_code_label)
+        return;
+    }
+  }
+
+  HashMap previous = {0};
+  for (int i = 0; i < fld->num_functions; ++i) {
+    hashmap_put(&previous, fld->functions[i].name, &fld->functions[i]);
+  }
+
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    // Stubs for lazy functions go with the file's previous LazyFile. The line
+    // info registered for the code stays as it was, so it's only reused if
+    // the function's lines are too.
+    FunctionCode* fc = hashmap_get(&previous, fn->name);
+    if (fc && fc->hash == fn->code_hash && !fc->lazy &&
+        (!wants_line_info() || fc->line_hash == fn->line_hash))
+      fn->reused_code = fc;
+  }
+
+  // If only a little of an old chunk is still in use, recompile what's left in
+  // it instead, so that the chunk can be released rather than accumulating
+  // mostly dead code over many updates.
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    CodeChunk* chunk = &fld->chunks[i];
+    size_t used = 0;
+    for (Obj* fn = prog; fn; fn = fn->next) {
+      if (fn->is_function && fn->reused_code && chunk_contains(chunk, fn->reused_code->address))
+        used += fn->reused_code->size;
+    }
+    if (used * 4 >= chunk->code_size)
+      continue;
+    for (Obj* fn = prog; fn; fn = fn->next) {
+      if (fn->is_function && fn->reused_code && chunk_contains(chunk, fn->reused_code->address))
+        fn->reused_code = NULL;
+    }
+  }
+#endif
+}
+
+// Called with lazy_mutex and compile_mutex held when the file's function
+// records are replaced. Threads may still be running in the stubs and compiled code, so
+// it's all released once they're done with it.
+static void retire_lazy_file(LazyFile* lazy) {
+  HeapData heap = lazy->heap;
+  lazy->is_retired = true;
+  LazyFunction** prev = &lazy->ctx->promotion_queue;
+  while (*prev) {
+    if ((*prev)->file == lazy)
+      *prev = (*prev)->next_promotion;
+    else
+      prev = &(*prev)->next_promotion;
+  }
+  for (LazyFunction* lf = lazy->functions; lf; lf = lf->next) {
+    if (lf->code.size)
+      retire_executable_memory(lf->code.base_address, lf->code.size);
+  }
+  retire_executable_memory(heap.base, heap.size);
+}
+
+IMPLSTATIC void free_lazy_file(LazyFile* lazy) {
+  if (!lazy)
+    return;
+  HeapData heap = lazy->heap;
+  for (LazyFunction* lf = lazy->functions; lf; lf = lf->next) {
+    if (lf->code.size)
+      free_executable_memory(lf->code.base_address, lf->code.size);
+  }
+  free_executable_memory(heap.base, heap.size);
+}
+// Replaces the file's function records with |functions|, and its chunks with
+// those of its current ones and |new_chunks| that hold code for any of them.
+// Records and chunks that are no longer needed are freed.
+IMPLSTATIC void replace_function_code(FileLinkData* fld,
+                                      FunctionCode* functions,
+                                      int num_functions,
+                                      CodeChunk* new_chunks,
+                                      int num_new_chunks) {
+  mutex_lock(user_context->lazy_mutex);
+  mutex_lock(user_context->compile_mutex);
+  if (fld->lazy) {
+    retire_lazy_file(fld->lazy);
+    fld->lazy = NULL;
+  }
+  mutex_unlock(user_context->compile_mutex);
+  mutex_unlock(user_context->lazy_mutex);
+
+  for (int i = 0; i < fld->num_functions; ++i) {
+    // Other threads may still be running the old code, which writes these.
+    FunctionCode* fc = &fld->functions[i];
+    if (fc->profile_counts)
+      retire_aligned(fc->profile_counts, fc->num_profile_counts * sizeof(uint64_t));
+    fc->profile_counts = NULL;
+    if (fc->instrument_counts)
+      retire_aligned(fc->instrument_counts, 2 * sizeof(uint64_t));
+    fc->instrument_counts = NULL;
+    free_function_code_record(fc);
+  }
+  free(fld->functions);
+  fld->functions = functions;
+  fld->num_functions = num_functions;
+
+  mutex_lock(user_context->compile_mutex);
+  for (int i = 0; i < fld->num_used_slots; ++i) {
+    fld->used_slots[i]->in_use = false;
+  }
+  fld->num_used_slots = 0;
+  for (int i = 0; i < num_functions; ++i) {
+    for (int j = 0; j < functions[i].num_slots; ++j) {
+      use_symbol_slot(fld, functions[i].slots[j]);
+    }
+  }
+  fld->link_all_slots = true;
+  mutex_unlock(user_context->compile_mutex);
+
+  CodeChunk* chunks = calloc(fld->num_chunks + num_new_chunks + 1, sizeof(CodeChunk));
+  int num_chunks = 0;
+  for (int i = 0; i < fld->num_chunks + num_new_chunks; ++i) {
+    CodeChunk* c = i < fld->num_chunks ? &fld->chunks[i] : &new_chunks[i - fld->num_chunks];
+    if (!c->base_address)
+      continue;
+    bool in_use = false;
+    for (int j = 0; j < num_functions && !in_use; ++j) {
+      in_use = chunk_contains(c, functions[j].address);
+    }
+    if (in_use) {
+      chunks[num_chunks++] = *c;
+    } else {
+      // Other threads may still be running the old code.
+      retire_executable_memory(c->base_address, c->size);
+    }
+  }
+  free(fld->chunks);
+  fld->chunks = chunks;
+  fld->num_chunks = num_chunks;
+
+  // The exports are replaced when this is linked.
+  fld->exports_pending = true;
+}
+
+// Describes the code emitted for |fn|, which is only a lazy stub if
+// |is_stub|.
+static JitCode jit_code(Obj* fn, char* base_address, FilePtrArray* files, bool is_stub) {
+  int entry = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+  int end = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label);
+  JitCode code = {fn->name, base_address + entry, end - entry, -1, -1, NULL, 0, NULL, 0};
+  if (!is_stub) {
+    code.frame_offset = dasm_getpclabel(&C(dynasm), fn->dasm_prologue_label) - entry;
+    code.ret_offset = dasm_getpclabel(&C(dynasm), fn->dasm_epilogue_ret_label) - entry;
+    int cold = dasm_getpclabel(&C(dynasm), fn->dasm_cold_label);
+    code.cold_address = base_address + cold;
+    code.cold_size = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_cold_label) - cold;
+  }
+  if (fn->file_line_label_data.len > 0) {
+    code.lines = bumpcalloc(fn->file_line_label_data.len, sizeof(JitLine), AL_Compile);
+    for (int i = 0; i < fn->file_line_label_data.len; ++i) {
+      IntIntInt* fll = &fn->file_line_label_data.data[i];
+      int offset = dasm_getpclabel(&C(dynasm), fll->c);
+      // Lines of cold code are out of the function's range.
+      if (offset < entry || offset >= end)
+        continue;
+      code.lines[code.num_lines++] =
+          (JitLine){base_address + offset, files->data[fll->a]->name, fll->b};
+    }
+  }
+  return code;
+}
+
+// Tells the unwinder, perf, and debuggers about the code that was just emitted
+// into |chunk|.
+static void record_jit_code(Obj* prog, FileLinkData* fld, CodeChunk* chunk) {
+  int num_code = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live && !fn->reused_code)
+      ++num_code;
+  }
+  JitCode* code = bumpcalloc(num_code, sizeof(JitCode), AL_Compile);
+  int n = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live && !fn->reused_code)
+      code[n++] = jit_code(fn, chunk->base_address, &compiler_state.tokenize__all_tokenized_files,
+                           C(lazy_file) != NULL);
+  }
+  if (n > 0) {
+    perf_record_code(code, n);
+    register_jit_code(code, n, chunk->base_address, chunk->code_size, fld->source_name);
+  }
+}
+
+// Makes records for the functions that were just emitted into |chunk|, and
+// carries over those for reused functions.
+static void update_function_code(Obj* prog, FileLinkData* fld, CodeChunk* chunk) {
+  int num_functions = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (fn->is_function && fn->is_definition && fn->is_live)
+      ++num_functions;
+  }
+
+  FunctionCode* functions = calloc(num_functions, sizeof(FunctionCode));
+  int n = 0;
+  for (Obj* fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition || !fn->is_live)
+      continue;
+
+    FunctionCode* fc = &functions[n++];
+    if (fn->reused_code) {
+      // Take ownership of the previous record's allocations.
+      *fc = *fn->reused_code;
+      *fn->reused_code = (FunctionCode){0};
+      ++C(stats).functions_reused;
+      continue;
+    }
 
-    char* fixup = fld->codeseg_base_address + offset;
-    linkfixup_push(fld, C(fixups).data[i].str, fixup, /*addend=*/0);
+    int entry = dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+    fc->name = strdup(fn->name);
+    fc->lazy = fn->lazy;
+    fc->hash = fn->code_hash;
+    fc->line_hash = fn->line_hash;
+    fc->is_static = fn->is_static;
+    fc->is_process_specific = fn->is_process_specific;
+    fc->profile_counts = fn->profile_counts;
+    fc->num_profile_counts = fn->profile_counts ? fn->num_profile_sites : 0;
+    fc->instrument_counts = fn->instrument_counts;
+    fc->address = chunk->base_address + entry;
+    fc->size = dasm_getpclabel(&C(dynasm), fn->dasm_end_of_function_label) - entry;
+    fc->slots = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(SymbolSlot*));
+    for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+      SymbolSlot* slot = get_symbol_slot(C(file_index), C(symbol_refs).data[i]);
+      bool seen = false;
+      for (int j = 0; j < fc->num_slots && !seen; ++j) {
+        seen = fc->slots[j] == slot;
+      }
+      if (!seen)
+        fc->slots[fc->num_slots++] = slot;
+    }
+    fc->slot_refs = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(char*));
+    for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+      int end = dasm_getpclabel(&C(dynasm), C(symbol_ref_labels).data[i]);
+      fc->slot_refs[fc->num_slot_refs++] = chunk->base_address + end - sizeof(void*);
+    }
+    if (fc->lazy)
+      ++C(stats).functions_deferred;
+    else
+      ++C(stats).functions_compiled;
   }
+
+  replace_function_code(fld, functions, num_functions, chunk, 1);
 }
 
 #if X64WIN
@@ -2788,7 +3979,13 @@ IMPLSTATIC void codegen(Obj* prog, size_t file_index) {
   ///|=>start_of_pdata:
   ///| .code
 
+  FileLinkData* fld = &user_context->files[C(file_index)];
+
   assign_lvar_offsets(prog);
+  find_reusable_code(prog, fld);
+#if !X64WIN
+  start_lazy_file(prog);
+#endif
   emit_text(prog);
 
   ///| .pdata
@@ -2799,53 +3996,81 @@ IMPLSTATIC void codegen(Obj* prog, size_t file_index) {
   size_t code_size;
   dasm_link(&C(dynasm), &code_size);
 
-  FileLinkData* fld = &user_context->files[C(file_index)];
-  if (fld->codeseg_base_address) {
-    free_executable_memory(fld->codeseg_base_address, fld->codeseg_size);
-  }
-  // VirtualAlloc and mmap don't accept 0.
-  if (code_size == 0)
-    code_size = 1;
-  unsigned int page_sized = (unsigned int)align_to_u(code_size, get_page_size());
-
-  fld->codeseg_size = page_sized;
+  // Everything that was emitted this time goes in a new chunk. There's nothing
+  // to allocate if all the functions were reused.
+  CodeChunk chunk = {NULL, 0, code_size};
+  if (code_size > 0) {
+    chunk.size = align_to_u(code_size, get_page_size());
 #if X64WIN
-  if (user_context->generate_debug_symbols) {
-    user_context->dbp_ctx = dbp_create(fld->codeseg_size, get_temp_pdb_filename(AL_Compile));
-    fld->codeseg_base_address = dbp_get_image_base(user_context->dbp_ctx);
-  } else {
-    fld->codeseg_base_address = allocate_writable_memory(page_sized);
-  }
+    if (user_context->generate_debug_symbols) {
+      user_context->dbp_ctx = dbp_create(chunk.size, get_temp_pdb_filename(AL_Compile));
+      chunk.base_address = dbp_get_image_base(user_context->dbp_ctx);
+    } else {
+      chunk.base_address = allocate_writable_memory(chunk.size);
+    }
 #else
-  fld->codeseg_base_address = allocate_writable_memory(page_sized);
+    chunk.base_address = allocate_writable_memory(chunk.size);
 #endif
-  // outaf("code_size: %zu, page_sized: %zu\n", code_size, page_sized);
-
-  fill_out_text_exports(prog, fld->codeseg_base_address);
+  }
+  // outaf("code_size: %zu, page_sized: %zu\n", code_size, chunk.size);
 
-  free_link_fixups(fld);
-  emit_data(prog);  // This needs to point into code for fixups, so has to go late-ish.
-  fill_out_fixups(fld);
+  // This needs to point into code for fixups, so has to go late-ish.
+  update_data_objects(prog, fld);
+  C(stats).code_bytes = code_size;
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    C(stats).data_bytes += fld->data_objects[i].size;
+  }
+  install_data_objects(C(file_index), chunk.base_address);
 
-  dasm_encode(&C(dynasm), fld->codeseg_base_address);
+  if (chunk.base_address) {
+    dasm_encode(&C(dynasm), chunk.base_address);
+    fill_align_padding(chunk.base_address);
 
 #if 0
-  FILE* f = fopen("code.raw", "wb");
-  fwrite(fld->codeseg_base_address, code_size, 1, f);
-  fclose(f);
-  system("ndisasm -b64 code.raw");
+    FILE* f = fopen("code.raw", "wb");
+    fwrite(chunk.base_address, code_size, 1, f);
+    fclose(f);
+    system("ndisasm -b64 code.raw");
 #endif
 
-  int check_result = dasm_checkstep(&C(dynasm), 0);
-  if (check_result != DASM_S_OK) {
-    outaf("check_result: 0x%08x\n", check_result);
-    ABORT("dasm_checkstep failed");
+    int check_result = dasm_checkstep(&C(dynasm), 0);
+    if (check_result != DASM_S_OK) {
+      outaf("check_result: 0x%08x\n", check_result);
+      ABORT("dasm_checkstep failed");
+    }
   }
 
-  emit_symbols_and_exception_function_table(prog, fld->codeseg_base_address,
+  emit_symbols_and_exception_function_table(prog, chunk.base_address,
                                             dasm_getpclabel(&C(dynasm), start_of_pdata),
                                             dasm_getpclabel(&C(dynasm), end_of_pdata));
 
+  // Before update_function_code(), which takes the reused functions' records.
+  record_jit_code(prog, fld, &chunk);
+
+  update_function_code(prog, fld, &chunk);
+
+#if !X64WIN
+  if (C(lazy_file)) {
+    char* thunk = chunk.base_address + dasm_getpclabel(&C(dynasm), C(lazy_thunk_label));
+    for (LazyFunction* lf = C(lazy_file)->functions; lf; lf = lf->next) {
+      lf->target = thunk;
+    }
+    C(lazy_file)->numlabels = C(numlabels);
+    fld->lazy = C(lazy_file);
+  }
+#endif
+
+  mutex_lock(user_context->compile_mutex);
+  DyibiccStats* stats = &user_context->stats;
+  stats->frame_bytes += C(stats).frame_bytes;
+  stats->frame_bytes_unshared += C(stats).frame_bytes_unshared;
+  stats->functions_compiled += C(stats).functions_compiled;
+  stats->functions_reused += C(stats).functions_reused;
+  stats->functions_deferred += C(stats).functions_deferred;
+  stats->code_bytes += C(stats).code_bytes;
+  stats->data_bytes += C(stats).data_bytes;
+  mutex_unlock(user_context->compile_mutex);
+
   codegen_free();
 }
 
@@ -2855,3 +4080,180 @@ IMPLSTATIC void codegen_free(void) {
     dasm_free(&C(dynasm));
   }
 }
+
+#if !X64WIN
+// Generates code for |lf| from the parse that was kept for it, at |tier|, and
+// points its stub at it. Called with lazy_mutex held, as emitting code writes
+// to the parse. The thread may be part way through compiling something else
+// (the stub was called from a host callback during an update), so its compiler
+// state is put back afterwards.
+static char* compile_lazy_code(LazyFunction* lf, int tier) {
+  LazyFile* lazy = lf->file;
+  SavedCompile* saved = alloc_save_compile();
+
+  jmp_buf prev_jmpbuf;
+  memcpy(prev_jmpbuf, toplevel_update_jmpbuf, sizeof(jmp_buf));
+  if (setjmp(toplevel_update_jmpbuf) != 0) {
+    // The function has already been called, so there's nothing to go back to.
+    // The error's been reported through the context's output_function.
+    memcpy(toplevel_update_jmpbuf, prev_jmpbuf, sizeof(jmp_buf));
+    fprintf(stderr, "dyibicc: failed to compile lazy function %s\n", lf->fn->name);
+    abort();
+  }
+
+  alloc_init(AL_Compile);
+  C(file_index) = lazy->file_index;
+  C(numlabels) = lazy->numlabels;
+  if (user_context->tiered_compilation && tier == 0)
+    C(tier0_function) = lf;
+  dasm_init(&C(dynasm), DASM_MAXSECTION);
+  dasm_growpc(&C(dynasm), C(numlabels));
+  void* globals[dynasm_globals_MAX + 1];
+  dasm_setupglobal(&C(dynasm), globals, dynasm_globals_MAX + 1);
+  dasm_setup(&C(dynasm), dynasm_actions);
+
+  ///| .code
+  Obj* fn = lf->fn;
+  emit_function(fn);
+
+  size_t code_size;
+  dasm_link(&C(dynasm), &code_size);
+  CodeChunk chunk = {NULL, align_to_u(code_size, get_page_size()), code_size};
+  chunk.base_address = allocate_writable_memory(chunk.size);
+  dasm_encode(&C(dynasm), chunk.base_address);
+  fill_align_padding(chunk.base_address);
+  if (!make_memory_executable(chunk.base_address, chunk.size))
+    ABORT("failed to make lazy function executable");
+  chunk.is_executable = true;
+  JitCode code = jit_code(fn, chunk.base_address, &lazy->files, false);
+  perf_record_code(&code, 1);
+  register_jit_code(&code, 1, chunk.base_address, chunk.code_size,
+                    user_context->files[lazy->file_index].source_name);
+
+  int num_slots = 0;
+  SymbolSlot** slots = calloc(fn->symbol_refs_end - fn->symbol_refs_begin, sizeof(SymbolSlot*));
+  for (int i = fn->symbol_refs_begin; i < fn->symbol_refs_end; ++i) {
+    SymbolSlot* slot = get_symbol_slot(C(file_index), C(symbol_refs).data[i]);
+    bool seen = false;
+    for (int j = 0; j < num_slots && !seen; ++j) {
+      seen = slots[j] == slot;
+    }
+    if (!seen)
+      slots[num_slots++] = slot;
+  }
+
+  mutex_lock(user_context->compile_mutex);
+  if (!link_slots(C(file_index), slots, num_slots))
+    ABORT("failed to link lazy function");
+  // Threads may still be running the previous tier's code.
+  if (lf->code.size)
+    retire_executable_memory(lf->code.base_address, lf->code.size);
+  lf->code = chunk;
+  lf->tier = tier;
+  if (lazy->is_retired) {
+    // A later update already replaced the file, but the old code can still be
+    // running, so keep this until the stub's own code is released.
+    retire_executable_memory(chunk.base_address, chunk.size);
+    lf->code.size = 0;
+  } else {
+    // The slots go with the stub's record so that later links update them.
+    FileLinkData* fld = &user_context->files[C(file_index)];
+    for (int i = 0; i < fld->num_functions; ++i) {
+      FunctionCode* fc = &fld->functions[i];
+      if (fc->lazy != lf)
+        continue;
+      if (!fc->profile_counts && fn->profile_counts) {
+        fc->profile_counts = fn->profile_counts;
+        fc->num_profile_counts = fn->num_profile_sites;
+      }
+      if (!fc->instrument_counts && fn->instrument_counts)
+        fc->instrument_counts = fn->instrument_counts;
+      fc->slots = realloc(fc->slots, (fc->num_slots + num_slots) * sizeof(SymbolSlot*));
+      for (int j = 0; j < num_slots; ++j) {
+        bool seen = false;
+        for (int k = 0; k < fc->num_slots && !seen; ++k) {
+          seen = fc->slots[k] == slots[j];
+        }
+        if (!seen)
+          fc->slots[fc->num_slots++] = slots[j];
+        use_symbol_slot(fld, slots[j]);
+      }
+    }
+    if (tier == 0)
+      ++user_context->stats.functions_compiled;
+    else
+      ++user_context->stats.functions_promoted;
+  }
+  free(slots);
+  char* target = chunk.base_address + dasm_getpclabel(&C(dynasm), fn->dasm_entry_label);
+  __atomic_store_n(&lf->target, target, __ATOMIC_RELEASE);
+  mutex_unlock(user_context->compile_mutex);
+
+  codegen_free();
+  alloc_reset(AL_Compile);
+  alloc_restore_compile(saved);
+  memcpy(toplevel_update_jmpbuf, prev_jmpbuf, sizeof(jmp_buf));
+  return target;
+}
+
+// Called from the thunk the first time one of the stubs emitted for
+// lazy_compilation is, on whichever thread that happens to be. Returns the
+// address of the function's code, which later calls then jump to directly.
+IMPLSTATIC char* compile_lazy_function(LazyFunction* lf) {
+  UserContext* prev = user_context;
+  user_context = lf->file->ctx;
+
+  mutex_lock(user_context->lazy_mutex);
+  char* target = __atomic_load_n(&lf->target, __ATOMIC_ACQUIRE);
+  if (!lf->code.base_address)
+    target = compile_lazy_code(lf, 0);
+  mutex_unlock(user_context->lazy_mutex);
+
+  user_context = prev;
+  return target;
+}
+
+static void promotion_worker(void* arg) {
+  UserContext* ctx = arg;
+  user_context = ctx;
+  mutex_lock(ctx->lazy_mutex);
+  while (ctx->promotion_queue) {
+    LazyFunction* lf = ctx->promotion_queue;
+    ctx->promotion_queue = lf->next_promotion;
+    compile_lazy_code(lf, 1);
+  }
+  ctx->promoting = false;
+  mutex_unlock(ctx->lazy_mutex);
+}
+
+// Called from tier 0 code when one of its counts reaches its threshold. Queues
+// the function to be compiled again without counts, starting a thread to do
+// that if there isn't one already working through the queue.
+IMPLSTATIC void request_promotion(LazyFunction* lf) {
+  UserContext* ctx = lf->file->ctx;
+  mutex_lock(ctx->lazy_mutex);
+  if (!lf->promotion_requested && !lf->file->is_retired) {
+    lf->promotion_requested = true;
+    lf->next_promotion = ctx->promotion_queue;
+    ctx->promotion_queue = lf;
+    if (!ctx->promoting) {
+      // The previous thread has already finished with the queue.
+      if (ctx->promotion_thread)
+        thread_join(ctx->promotion_thread);
+      ctx->promotion_thread = thread_start(promotion_worker, ctx);
+      ctx->promoting = ctx->promotion_thread != NULL;
+    }
+  }
+  mutex_unlock(ctx->lazy_mutex);
+}
+#endif
+
+// Waits for any functions queued by request_promotion() to be compiled.
+IMPLSTATIC void finish_promotions(UserContext* ctx) {
+  mutex_lock(ctx->lazy_mutex);
+  Thread* thread = ctx->promotion_thread;
+  ctx->promotion_thread = NULL;
+  mutex_unlock(ctx->lazy_mutex);
+  if (thread)
+    thread_join(thread);
+}
@@ -54,12 +54,14 @@
 
 #ifdef _MSC_VER
 #define NORETURN __declspec(noreturn)
+#define THREAD_LOCAL __declspec(thread)
 #define strdup _strdup
 #include <io.h>
 #define isatty _isatty
 #define fileno _fileno
 #else
 #define NORETURN _Noreturn
+#define THREAD_LOCAL _Thread_local
 #include <unistd.h>
 #endif
 
@@ -82,6 +84,7 @@ typedef struct Hideset Hideset;
 typedef struct Token Token;
 typedef struct HashMap HashMap;
 typedef struct UserContext UserContext;
+typedef struct AsyncUpdate AsyncUpdate;
 typedef struct DbpContext DbpContext;
 typedef struct DbpFunctionSymbol DbpFunctionSymbol;
 
@@ -97,8 +100,16 @@ typedef enum AllocLifetime {
   AL_Manual = NUM_BUMP_HEAPS,
 } AllocLifetime;
 
+typedef struct HeapData {
+  char* base;
+  char* alloc_pointer;
+  size_t size;
+} HeapData;
+
 IMPLSTATIC void alloc_init(AllocLifetime lifetime);
 IMPLSTATIC void alloc_reset(AllocLifetime lifetime);
+IMPLSTATIC HeapData alloc_detach(AllocLifetime lifetime);
+IMPLSTATIC size_t alloc_used(AllocLifetime lifetime);
 
 IMPLSTATIC void* bumpcalloc(size_t num, size_t size, AllocLifetime lifetime);
 IMPLSTATIC void* bumplamerealloc(void* old,
@@ -110,9 +121,50 @@ IMPLSTATIC void alloc_free(void* p, AllocLifetime lifetime);  // AL_Manual only.
 IMPLSTATIC void* aligned_allocate(size_t size, size_t alignment);
 IMPLSTATIC void aligned_free(void* p);
 IMPLSTATIC void* allocate_writable_memory(size_t size);
-IMPLSTATIC bool make_memory_readwrite(void* m, size_t size);
 IMPLSTATIC bool make_memory_executable(void* m, size_t size);
 IMPLSTATIC void free_executable_memory(void* p, size_t size);
+IMPLSTATIC void* map_file_memory(FILE* fp, size_t offset, size_t size);
+
+// Memory replaced by an update that other threads may still be using. It's
+// freed by reclaim_retired() once they've all moved past it.
+typedef struct RetiredMemory RetiredMemory;
+struct RetiredMemory {
+  RetiredMemory* next;
+  void* p;
+  size_t size;
+  bool is_executable;  // From allocate_writable_memory(), otherwise aligned_allocate().
+  uint64_t epoch;      // The epoch in which it was last reachable.
+};
+
+// Each thread that has called dyibicc_enter() on a context has one of these.
+typedef struct ThreadRecord ThreadRecord;
+struct ThreadRecord {
+  ThreadRecord* next;
+  void* owner;     // Unique to the thread the record belongs to.
+  uint64_t epoch;  // The epoch last observed, or 0 when not entered.
+};
+
+IMPLSTATIC uint64_t atomic_load_u64(uint64_t* p);
+IMPLSTATIC void atomic_store_u64(uint64_t* p, uint64_t value);
+IMPLSTATIC uint64_t atomic_fetch_add_u64(uint64_t* p, uint64_t value);
+
+IMPLSTATIC void* mutex_create(void);
+IMPLSTATIC void mutex_destroy(void* m);
+IMPLSTATIC void mutex_lock(void* m);
+IMPLSTATIC void mutex_unlock(void* m);
+
+typedef struct Thread Thread;
+typedef void (*ThreadFn)(void* arg);
+IMPLSTATIC Thread* thread_start(ThreadFn fn, void* arg);
+IMPLSTATIC void thread_join(Thread* thread);
+
+IMPLSTATIC void retire_executable_memory(void* p, size_t size);
+IMPLSTATIC void retire_aligned(void* p, size_t size);
+IMPLSTATIC void reclaim_retired(UserContext* ctx, bool all);
+IMPLSTATIC void thread_enter(UserContext* ctx);
+IMPLSTATIC void thread_quiescent(UserContext* ctx);
+IMPLSTATIC void thread_leave(UserContext* ctx);
+IMPLSTATIC void publish_epoch(UserContext* ctx);
 
 //
 // util.c
@@ -126,17 +178,6 @@ typedef struct {
   int len;
 } StringArray;
 
-typedef struct StringInt {
-  char* str;
-  int i;
-} StringInt;
-
-typedef struct StringIntArray {
-  StringInt* data;
-  int capacity;
-  int len;
-} StringIntArray;
-
 typedef struct FilePtrArray {
   File** data;
   int capacity;
@@ -149,6 +190,12 @@ typedef struct TokenPtrArray {
   int len;
 } TokenPtrArray;
 
+typedef struct IntArray {
+  int* data;
+  int capacity;
+  int len;
+} IntArray;
+
 typedef struct IntIntInt {
   int a;
   int b;
@@ -167,13 +214,14 @@ IMPLSTATIC char* dirname(char* s);
 IMPLSTATIC uint64_t align_to_u(uint64_t n, uint64_t align);
 IMPLSTATIC int64_t align_to_s(int64_t n, int64_t align);
 IMPLSTATIC unsigned int get_page_size(void);
+IMPLSTATIC int get_num_cpus(void);
+IMPLSTATIC double get_seconds(void);
+IMPLSTATIC uint64_t hash_bytes(uint64_t hash, const void* p, size_t len);
 IMPLSTATIC void strarray_push(StringArray* arr, char* s, AllocLifetime lifetime);
-IMPLSTATIC void strintarray_push(StringIntArray* arr, StringInt item, AllocLifetime lifetime);
 IMPLSTATIC void fileptrarray_push(FilePtrArray* arr, File* item, AllocLifetime lifetime);
 IMPLSTATIC void tokenptrarray_push(TokenPtrArray* arr, Token* item, AllocLifetime lifetime);
-#if X64WIN
+IMPLSTATIC void intarray_push(IntArray* arr, int item, AllocLifetime lifetime);
 IMPLSTATIC void intintintarray_push(IntIntIntArray* arr, IntIntInt item, AllocLifetime lifetime);
-#endif
 IMPLSTATIC char* format(AllocLifetime lifetime, char* fmt, ...)
     __attribute__((format(printf, 2, 3)));
 IMPLSTATIC char* read_file_wrap_user(char* path, AllocLifetime lifetime);
@@ -210,6 +258,11 @@ struct File {
   char* contents;
   int file_no;  // Index into tokenize__all_tokenized_files.
 
+  // Hash of the contents as returned by load_file_contents, before they were
+  // modified by tokenizing. Only set if there's a cache_dir, or for headers
+  // (see tokenize_header()).
+  uint64_t contents_hash;
+
   // For #line directive
   char* display_name;
   int line_delta;
@@ -246,6 +299,25 @@ IMPLSTATIC Token* tokenize_string_literal(Token* tok, Type* basety);
 IMPLSTATIC Token* tokenize(File* file);
 IMPLSTATIC Token* tokenize_file(char* filename);
 IMPLSTATIC Token* tokenize_filecontents(char* path, char* contents);
+IMPLSTATIC Token* tokenize_header(char* path, char* builtin_contents);
+IMPLSTATIC void free_token_cache(UserContext* ctx, bool all);
+
+// A header's tokens as tokenize() produced them, kept in the context so that
+// later includes of it can copy them rather than tokenizing it again. |loc|
+// and |str| point into |contents| and |strs|, and |next|, |file| and
+// |filename| aren't set.
+typedef struct TokenCacheEntry TokenCacheEntry;
+struct TokenCacheEntry {
+  TokenCacheEntry* next_retired;
+  uint64_t contents_hash;  // As for File.
+  char* contents;          // After canonicalize_newline() etc.
+  size_t contents_size;
+  char* strs;  // The contents of each string literal, 8 byte aligned.
+  size_t strs_size;
+  Type* str_types;  // The type of each string literal.
+  Token* tokens;
+  int num_tokens;
+};
 
 #define unreachable() error_internal(__FILE__, __LINE__, "unreachable")
 #define ABORT(msg) error_internal(__FILE__, __LINE__, msg)
@@ -255,6 +327,7 @@ IMPLSTATIC Token* tokenize_filecontents(char* path, char* contents);
 //
 
 IMPLSTATIC char* search_include_paths(char* filename);
+IMPLSTATIC bool file_exists(char* path);
 IMPLSTATIC void init_macros(void);
 IMPLSTATIC void define_macro(char* name, char* buf);
 IMPLSTATIC void undef_macro(char* name);
@@ -265,6 +338,10 @@ IMPLSTATIC Token* add_container_instantiations(Token* tok);
 // parse.c
 //
 
+typedef struct Scope Scope;
+typedef struct FunctionCode FunctionCode;
+typedef struct LazyFunction LazyFunction;
+
 // Variable or function
 typedef struct Obj Obj;
 struct Obj {
@@ -280,6 +357,7 @@ struct Obj {
 
   // Local variable
   int offset;
+  Scope* scope;  // Block scope of a local, or the outermost (parameter) scope of a function
 
   // Global variable or function
   bool is_function;
@@ -289,9 +367,11 @@ struct Obj {
   int dasm_return_label;
   int dasm_end_of_function_label;
   int dasm_unwind_info_label;
-#if X64WIN
-  IntIntIntArray file_line_label_data;
-#endif
+  int dasm_prologue_label;
+  int dasm_epilogue_ret_label;
+  int dasm_cold_label;  // Where its code in .cold begins, and then ends.
+  int dasm_end_of_cold_label;
+  IntIntIntArray file_line_label_data;  // Only if codegen wants_line_info().
 
   // Global variable
   bool is_tentative;
@@ -309,6 +389,21 @@ struct Obj {
   Obj* alloca_bottom;
   int stack_size;
 
+  // Hash of the function body and everything outside of function bodies in
+  // the file, so that unchanged code from a previous update can be reused.
+  uint64_t code_hash;
+  uint64_t line_hash;  // Of the body's line numbers, for code with line info.
+  FunctionCode* reused_code;
+  LazyFunction* lazy;  // Only a stub is emitted, see lazy_compilation.
+  int symbol_refs_begin;  // Range of codegen symbol_refs emitted for this function.
+  int symbol_refs_end;
+  bool is_process_specific;  // See FunctionCode.
+  int num_profile_sites;      // Counts for each Node.profile_site.
+  uint64_t* profile_counts;   // Written by the code, with profile_branches.
+  bool is_instrumented;       // Has __attribute__((instrument)).
+  int instrument_tsc_offset;  // Of the rdtsc at entry, with instrument_cycles.
+  uint64_t* instrument_counts;  // Written by the code, with instrument_cycles.
+
   // Static inline function
   bool is_live;  // No code is emitted for "static inline" functions if no one is referencing them.
   bool is_root;
@@ -413,9 +508,20 @@ struct Node {
   bool pass_by_stack;
 #if X64WIN
   int pass_by_reference;  // Offset to copy of large struct.
+#else
+  bool eval_into_reg;  // Evaluated directly into GP or XMM register |eval_reg|.
+  int eval_reg;
+  bool stack_pad;  // Preceded by an 8 byte hole on the stack, to align it to 16.
 #endif
   Obj* ret_buffer;
 
+  // __builtin_expect() hint: 1 if expected true, -1 if expected false.
+  int branch_hint;
+
+  // "if", "case" or loop: 1 + the index of its first count in the function's
+  // profile, see profile_branches. An "if" has two, for each branch.
+  int profile_site;
+
   // Goto or labeled statement, or labels-as-values
   char* label;
   int pc_label;
@@ -480,6 +586,7 @@ typedef enum {
   TY_VLA,  // variable-length array
   TY_STRUCT,
   TY_UNION,
+  TY_INT128,  // [GNU] __int128, SysV only.
 } TypeKind;
 
 struct Type {
@@ -521,6 +628,8 @@ struct Type {
   Type* return_ty;
   Type* params;
   bool is_variadic;
+  bool is_noreturn;
+  bool is_instrumented;
   Type* next;
 };
 
@@ -553,6 +662,11 @@ IMPLEXTERN Type* ty_ushort;
 IMPLEXTERN Type* ty_uint;
 IMPLEXTERN Type* ty_ulong;
 
+#if !X64WIN
+IMPLEXTERN Type* ty_int128;
+IMPLEXTERN Type* ty_uint128;
+#endif
+
 IMPLEXTERN Type* ty_float;
 IMPLEXTERN Type* ty_double;
 IMPLEXTERN Type* ty_ldouble;
@@ -585,6 +699,8 @@ IMPLSTATIC void codegen_init(void);
 IMPLSTATIC void codegen(Obj* prog, size_t file_index);
 IMPLSTATIC void codegen_free(void);
 IMPLSTATIC int codegen_pclabel(void);
+IMPLSTATIC char* compile_lazy_function(LazyFunction* lf);
+IMPLSTATIC void request_promotion(LazyFunction* lf);
 #if X64WIN
 IMPLSTATIC bool type_passed_in_register(Type* ty);
 #endif
@@ -630,6 +746,99 @@ IMPLSTATIC void hashmap_clear_manual_key_owned_value_unowned(HashMap* map);
 //
 IMPLSTATIC bool link_all_files(void);
 
+//
+// cache.c
+//
+IMPLSTATIC uint64_t cache_key(char* source_name, char* contents);
+IMPLSTATIC bool cache_load(size_t file_index, uint64_t key);
+IMPLSTATIC void cache_store(size_t file_index, uint64_t key);
+IMPLSTATIC bool image_save(char* path);
+IMPLSTATIC bool image_load(char* path);
+
+//
+// object.c
+//
+typedef struct JitLine {
+  char* address;
+  char* filename;
+  int line_no;
+} JitLine;
+
+// Describes a function's code as it's compiled, for tools outside of the
+// process, see register_jit_code() and perf.c.
+typedef struct JitCode {
+  char* name;
+  char* address;
+  size_t size;
+  int frame_offset;  // Of the `push rbp; mov rbp, rsp`, or -1 if there's no frame.
+  int ret_offset;    // Of the final `ret`, once the frame's gone, if there's a frame.
+  char* cold_address;  // Out of line code that runs in the frame, if |cold_size|.
+  size_t cold_size;
+  JitLine* lines;  // Only if codegen wants_line_info(), and may be NULL.
+  int num_lines;
+} JitCode;
+
+IMPLSTATIC bool write_object_file(size_t file_index, char* path);
+IMPLSTATIC void register_jit_code(JitCode* code,
+                                  int num_code,
+                                  char* base_address,
+                                  size_t code_size,
+                                  char* source_name);
+IMPLSTATIC void unregister_jit_code(char* base_address);
+IMPLSTATIC bool find_jit_code(char* pc, char** name, char** filename, int* line_no);
+IMPLSTATIC void register_loaded_code(size_t file_index);
+
+//
+// perf.c
+//
+IMPLSTATIC void perf_record_code(JitCode* code, int num_code);
+
+//
+// trace.c
+//
+typedef struct TraceEvent {
+  char* name;
+  char* detail;  // NULL if none.
+  double start;  // get_seconds().
+  double duration;
+  int tid;
+} TraceEvent;
+
+// An include that's being preprocessed, see trace_include_begin().
+typedef struct TraceInclude {
+  File* file;
+  File* includer;
+  char* path;
+  double start;
+} TraceInclude;
+
+#define TRACE_MAX_INCLUDE_DEPTH 64
+
+IMPLSTATIC void trace_init(void);
+IMPLSTATIC double trace_begin(void);
+IMPLSTATIC void trace_end(double start, char* name, char* detail);
+IMPLSTATIC void trace_include_begin(double start, char* path, File* file, File* includer);
+IMPLSTATIC void trace_include_reached(Token* tok);
+IMPLSTATIC int trace_include_depth(void);
+IMPLSTATIC void trace_include_end(int depth);
+IMPLSTATIC void trace_flush(void);
+IMPLSTATIC void trace_record(double start, char* name);
+IMPLSTATIC void trace_reset(UserContext* ctx);
+IMPLSTATIC void trace_write(UserContext* ctx);
+
+//
+// profile.c
+//
+typedef struct ProfileEntry {
+  uint64_t hash;  // The function's code_hash when it was counted.
+  int num_counts;
+  uint64_t counts[];
+} ProfileEntry;
+
+IMPLSTATIC ProfileEntry* find_profile(size_t file_index, Obj* fn);
+IMPLSTATIC bool profile_dump(char* path);
+IMPLSTATIC bool profile_load(char* path);
+
 //
 // Entire compiler state in one struct and linker in a second for clearing, esp.
 // after longjmp. There should be no globals outside of these structures.
@@ -637,11 +846,14 @@ IMPLSTATIC bool link_all_files(void);
 
 typedef struct CondIncl CondIncl;
 
-typedef struct Scope Scope;
 // Represents a block scope.
 struct Scope {
   Scope* next;
 
+  // Nested scopes, so that locals in sibling scopes can share stack slots.
+  Scope* children;
+  Scope* sibling;
+
   // C has two block scopes; one is for variables/typedefs and
   // the other is for struct/union/enum tags.
   HashMap vars;
@@ -660,17 +872,202 @@ typedef struct LinkFixup {
   int addend;
 } LinkFixup;
 
+// A pointer in a data object's initializer, to |name|, or if that's NULL, to
+// |code_offset| in the code emitted by the same compile.
+typedef struct DataReloc {
+  int offset;
+  char* name;
+  int code_offset;
+  int addend;
+} DataReloc;
+
+// A data object defined by a file, recorded so that it can be created again
+// without the file being compiled, e.g. when loaded from the cache.
+typedef struct DataObject {
+  char* name;
+  bool is_static;
+  bool is_rodata;
+  int size;
+  int align;
+  char* init_data;  // NULL if zero initialized.
+  DataReloc* relocs;
+  int num_relocs;
+} DataObject;
+
+// Generated code never refers to another function or global directly, but
+// instead loads its address from a slot. Relinking then only has to update
+// the slots, rather than patching code. There's one slot for each name
+// referenced from each file, as static names resolve differently per file.
+typedef struct SymbolSlot {
+  void* address;  // Must be first, it's what generated code loads.
+  char* name;
+  bool in_use;  // In its file's |used_slots|.
+} SymbolSlot;
+
+// Slots are allocated in blocks that never move, since their addresses are
+// embedded in code.
+#define SYMBOL_SLOT_BLOCK_SIZE 256
+typedef struct SymbolSlotBlock SymbolSlotBlock;
+struct SymbolSlotBlock {
+  SymbolSlotBlock* next;
+  int used;
+  SymbolSlot slots[SYMBOL_SLOT_BLOCK_SIZE];
+};
+
+// A block of executable memory holding code for some of a file's functions.
+typedef struct CodeChunk {
+  char* base_address;
+  size_t size;       // Size of the allocation.
+  size_t code_size;  // Bytes of code originally emitted into it.
+  bool is_executable;
+} CodeChunk;
+
+// Machine code for a function from a previous update. If the function's
+// code_hash is unchanged in a later update, the code is left in place and
+// only relinked, rather than being emitted again.
+struct FunctionCode {
+  char* name;
+  uint64_t hash;
+  uint64_t line_hash;  // 0 if not known, e.g. the code was loaded from the cache.
+  bool is_static;
+  char* address;
+  size_t size;
+
+  // Slots referenced by the function's code (including any out of line in
+  // .cold), without duplicates.
+  SymbolSlot** slots;
+  int num_slots;
+
+  // The addresses in the code where each slot reference is loaded from, for
+  // repointing them when the code is saved and loaded elsewhere.
+  char** slot_refs;
+  int num_slot_refs;
+
+  // The code embeds some other address that only exists in this process
+  // (currently, a reflection type), so it can't be saved.
+  bool is_process_specific;
+
+  // With profile_branches, counts for each profile_site, which the code adds
+  // to as it runs. aligned_allocate()d.
+  uint64_t* profile_counts;
+  int num_profile_counts;
+
+  // With instrument_cycles, the calls to the function and the cycles spent in
+  // it, which the code adds to. aligned_allocate()d.
+  uint64_t* instrument_counts;
+
+  // If set, |address| is only a stub, and the function is compiled when it's
+  // first called.
+  LazyFunction* lazy;
+};
+
+// In lazy_compilation mode, a file's functions are parsed but only stubs are
+// emitted for them. A stub jumps through |target|, which is initially a thunk
+// that calls compile_lazy_function() and is then the function's code.
+typedef struct LazyFile LazyFile;
+//
+// With tiered_compilation, the first code compiled for a function is tier 0,
+// which counts calls and loop back-edges. When either count reaches a
+// threshold, the function is compiled again without them on a background
+// thread, and |target| is repointed at that.
+struct LazyFunction {
+  char* target;  // Must be first, it's what the stub jumps through.
+  Obj* fn;
+  LazyFile* file;
+  CodeChunk code;  // Once compiled.
+  LazyFunction* next;
+
+  uint64_t calls;  // Counted by tier 0 code.
+  uint64_t backedges;
+  int tier;
+  bool promotion_requested;
+  LazyFunction* next_promotion;
+};
+
+// What's needed to compile a file's lazy functions, i.e. the AL_Compile heap
+// that it was parsed into (which this is also in), kept until the file is
+// compiled again.
+struct LazyFile {
+  UserContext* ctx;
+  size_t file_index;
+  HeapData heap;
+  int numlabels;      // Labels allocated by parsing and emitting the file.
+  FilePtrArray files;  // The file's tokenize__all_tokenized_files.
+  LazyFunction* functions;
+  bool is_retired;  // A later compile of the file replaced its functions.
+};
+
+// A page of trampolines for stable_function_addresses, followed by a page
+// holding the address that each one jumps to.
+typedef struct StableEntryBlock StableEntryBlock;
+struct StableEntryBlock {
+  StableEntryBlock* next;
+  char* base_address;
+  char** names;  // Function name for each entry, owned by stable_entries.
+  int used;
+};
+
 typedef struct FileLinkData {
   char* source_name;
-  char* codeseg_base_address;  // Just the address, not a string.
-  size_t codeseg_size;
 
+  // All chunks that still contain code for a function in |functions|. The
+  // code compiled by a given update is all in one chunk, but functions that
+  // were unchanged remain in the chunks of earlier updates.
+  CodeChunk* chunks;
+  int num_chunks;
+
+  FunctionCode* functions;
+  int num_functions;
+  bool exports_pending;  // |functions| changed since exports were last filled out.
+  LazyFile* lazy;        // For those of |functions| that are lazy.
+
+  // Names referenced by code in this file to their SymbolSlot. AL_Manual.
+  HashMap slots;
+
+  // Those of |slots| referenced by |functions|, without duplicates, which are
+  // what a link fills in. Only the ones whose name was redefined need it,
+  // unless |functions| were replaced since the file was last linked.
+  SymbolSlot** used_slots;
+  int num_used_slots;
+  int used_slots_cap;
+  bool link_all_slots;
+
+  // Data objects defined by the file when it was last compiled.
+  DataObject* data_objects;
+  int num_data_objects;
+
+  // Fixups in data, i.e. pointers in initializers.
   LinkFixup* fixups;
   int flen;
   int fcap;
+
+  // If the file was compiled by the most recent update, what that took.
+  // |stats.name| is NULL otherwise.
+  DyibiccFileStats stats;
 } FileLinkData;
 
 IMPLSTATIC void free_link_fixups(FileLinkData* fld);
+IMPLSTATIC void free_function_code(FileLinkData* fld);
+IMPLSTATIC void replace_function_code(FileLinkData* fld,
+                                      FunctionCode* functions,
+                                      int num_functions,
+                                      CodeChunk* new_chunks,
+                                      int num_new_chunks);
+IMPLSTATIC void free_lazy_file(LazyFile* lazy);
+IMPLSTATIC void finish_promotions(UserContext* ctx);
+IMPLSTATIC void free_data_objects(FileLinkData* fld);
+IMPLSTATIC void install_data_objects(size_t file_index, char* codeseg_base_address);
+IMPLSTATIC SymbolSlot* get_symbol_slot(size_t file_index, char* name);
+IMPLSTATIC void use_symbol_slot(FileLinkData* fld, SymbolSlot* slot);
+IMPLSTATIC bool link_slots(size_t file_index, SymbolSlot** slots, int num_slots);
+IMPLSTATIC void free_symbol_slots(UserContext* ctx);
+IMPLSTATIC char* get_stable_entry(char* name);
+IMPLSTATIC void free_stable_entries(UserContext* ctx);
+
+typedef struct LinkerState {
+  // link.c
+  HashMap link__runtime_function_map;
+} LinkerState;
 
 struct UserContext {
   DyibiccLoadFileContents load_file_contents;
@@ -678,6 +1075,19 @@ struct UserContext {
   DyibiccOutputFn output_function;
   bool use_ansi_codes;
   bool generate_debug_symbols;
+  bool stable_function_addresses;
+  bool lazy_compilation;
+  bool tiered_compilation;
+  bool profile_branches;
+  bool perf_map;
+  bool instrument_functions;
+  void* instrument_enter;  // NULL if not called, see instrument_functions.
+  void* instrument_exit;
+  bool instrument_cycles;
+  int code_alignment;
+  char* cache_dir;    // NULL if compiled code isn't being cached.
+  char* jitdump_dir;  // NULL if there's no jitdump.
+  char* time_trace_path;  // NULL if updates aren't traced.
 
   size_t num_include_paths;
   char** include_paths;
@@ -695,6 +1105,63 @@ struct UserContext {
 
   HashMap reflect_types;
 
+  // Loaded by dyibicc_load_profile(), ProfileEntry by file and function name.
+  // AL_Manual.
+  HashMap profile;
+
+  SymbolSlotBlock* slot_blocks;
+
+  // Non-static names defined by files whose code was replaced since the last
+  // successful link, i.e. the slots that other files have to fill in again.
+  // AL_Manual, values unused.
+  HashMap redefined_names;
+
+  // Trampolines for stable_function_addresses, by function name. AL_Manual.
+  HashMap stable_entries;
+  StableEntryBlock* stable_entry_blocks;
+
+  // Epoch-based reclamation of code and data replaced by an update. |epoch|
+  // starts at 1 and is advanced after each update is linked.
+  uint64_t epoch;
+  ThreadRecord* threads;
+  RetiredMemory* retired;
+
+  AsyncUpdate* async;  // Set from dyibicc_update_async() until dyibicc_commit().
+
+  // Number of threads to compile files on, and a lock for the state shared
+  // between them while they do.
+  int num_compile_threads;
+  void* compile_mutex;
+
+  // Held while compiling a lazy function, which happens on whichever thread
+  // first calls it, and for the queue of those waiting to be promoted out of
+  // tier 0. |promotion_thread| works through the queue while |promoting|.
+  void* lazy_mutex;
+  LazyFunction* promotion_queue;
+  Thread* promotion_thread;
+  bool promoting;
+
+  DyibiccStats stats;
+  size_t temp_heap_peak;  // From creating the context.
+
+  // TokenCacheEntry by header path, see tokenize_header(). Entries that are
+  // replaced are kept on |token_cache_retired| until the next update, as
+  // another thread may still be copying from them. Guarded by compile_mutex.
+  // AL_Manual.
+  HashMap token_cache;
+  TokenCacheEntry* token_cache_retired;
+
+  // Spans recorded by the update in progress, for time_trace_path.
+  // Guarded by compile_mutex.
+  TraceEvent* trace_events;
+  int num_trace_events;
+  int cap_trace_events;
+
+  // The AL_Link and AL_UserContext heaps, and the state that lives in them.
+  // AL_Compile and AL_Temp are per thread instead.
+  HeapData heaps[NUM_BUMP_HEAPS - AL_Link];
+  LinkerState linker_state;
+
 #if X64WIN
   char* function_table_data;
   DbpContext* dbp_ctx;
@@ -710,6 +1177,8 @@ typedef struct CompilerState {
   bool tokenize__has_space;      // True if the current position follows a space character
   HashMap tokenize__keyword_map;
   FilePtrArray tokenize__all_tokenized_files;
+  size_t tokenize__num_tokens;
+  size_t tokenize__num_headers_reused;
 
   // preprocess.c
   HashMap preprocess__macros;
@@ -721,6 +1190,7 @@ typedef struct CompilerState {
 
   int preprocess__include_next_idx;
   HashMap preprocess__include_path_cache;
+  StringArray preprocess__include_misses;  // Paths where an #include wasn't found.
   HashMap preprocess__include_guards;
   int preprocess__counter_macro_i;
 
@@ -739,8 +1209,14 @@ typedef struct CompilerState {
                                 // statement. Otherwise, NULL.
   Obj* parse__builtin_alloca;
   int parse__unique_name_id;
+  char* parse__unique_name_prefix;  // Names within a function body are numbered per function.
+  int parse__fn_unique_name_id;
+  int parse__fn_profile_sites;
+  Token* parse__last_fn_body;
+  uint64_t parse__env_hash;  // Hash of all tokens outside of function bodies.
   HashMap parse__typename_map;
   bool parse__evaluating_pp_const;
+  size_t parse__num_nodes;
 
   // codegen.in.c
   int codegen__depth;
@@ -748,18 +1224,42 @@ typedef struct CompilerState {
   dasm_State* codegen__dynasm;
   Obj* codegen__current_fn;
   int codegen__numlabels;
-  StringIntArray codegen__fixups;
+  bool codegen__in_cold_section;
+  StringArray codegen__symbol_refs;
+  IntArray codegen__symbol_ref_labels;  // Label after each of |symbol_refs|.
+  IntArray codegen__align_labels;  // Before and after each align_code() padding.
+  DyibiccStats codegen__stats;  // Added to the UserContext's once the file is done.
+  LazyFile* codegen__lazy_file;   // If the file has lazy functions.
+  int codegen__lazy_thunk_label;
+  LazyFunction* codegen__tier0_function;  // If counts are being emitted.
+  ProfileEntry* codegen__profile;         // For the function being emitted.
 
   // main.c
   char* main__base_file;
+
+  // cache.c
+  bool cache__uncacheable;  // The output depends on more than the source, e.g. __DATE__.
+
+  // trace.c
+  bool trace__enabled;  // If time_trace_path is set, and this isn't a lazy compile.
+  TraceEvent* trace__events;
+  int trace__num_events;
+  int trace__cap_events;
+  TraceInclude trace__includes[TRACE_MAX_INCLUDE_DEPTH];
+  int trace__include_depth;
 } CompilerState;
 
-typedef struct LinkerState {
-  // link.c
-  HashMap link__runtime_function_map;
-} LinkerState;
+// Files are compiled in parallel, so each thread has its own compiler state.
+// |user_context| is the context that the thread is currently working on; it's
+// bound by each API entry point, so several contexts can be used at once.
+IMPLEXTERN THREAD_LOCAL UserContext* user_context;
+IMPLEXTERN THREAD_LOCAL jmp_buf toplevel_update_jmpbuf;
+IMPLEXTERN THREAD_LOCAL CompilerState compiler_state;
+
+typedef struct SavedCompile {
+  CompilerState state;
+  HeapData heap;  // AL_Compile's.
+} SavedCompile;
 
-IMPLEXTERN UserContext* user_context;
-IMPLEXTERN jmp_buf toplevel_update_jmpbuf;
-IMPLEXTERN CompilerState compiler_state;
-IMPLEXTERN LinkerState linker_state;
+IMPLSTATIC SavedCompile* alloc_save_compile(void);
+IMPLSTATIC void alloc_restore_compile(SavedCompile* saved);
@@ -1,7 +1,7 @@
 #include "dyibicc.h"
 
 static void usage(int status) {
-  printf("dyibicc [-e symbolname] [-I <path>] [-c] [-g] <file0> [<file1>...]\n");
+  printf("dyibicc [-e symbolname] [-I <path>] [-c [-o <file.o>]] [-g] <file0> [<file1>...]\n");
   exit(status);
 }
 
@@ -9,6 +9,7 @@ static bool take_arg(char* arg) {
   char* x[] = {
       "-I",
       "-e",
+      "-o",
   };
 
   for (size_t i = 0; i < sizeof(x) / sizeof(*x); i++)
@@ -38,6 +39,7 @@ static void parse_args(int argc,
                        char** argv,
                        char** entry_point_override,
                        bool* compile_only,
+                       char** output_path,
                        bool* debug_symbols,
                        StringArray* include_paths,
                        StringArray* input_paths) {
@@ -48,7 +50,7 @@ static void parse_args(int argc,
 
   for (int i = 1; i < argc; i++) {
     if (!strncmp(argv[i], "-I", 2)) {
-      strarray_push(include_paths, argv[i] + 2, AL_Link);
+      strarray_push(include_paths, argv[i] + 2, AL_Compile);
       continue;
     }
 
@@ -62,6 +64,16 @@ static void parse_args(int argc,
       continue;
     }
 
+    if (!strcmp(argv[i], "-o")) {
+      *output_path = argv[++i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-o", 2)) {
+      *output_path = argv[i] + 2;
+      continue;
+    }
+
     if (!strncmp(argv[i], "-g", 2)) {
       *debug_symbols = true;
       continue;
@@ -75,13 +87,25 @@ static void parse_args(int argc,
       usage(1);
     }
 
-    strarray_push(input_paths, argv[i], AL_Link);
+    strarray_push(input_paths, argv[i], AL_Compile);
   }
 
   if (input_paths->len == 0) {
     printf("no input files\n");
     usage(1);
   }
+
+  if (*output_path && (!*compile_only || input_paths->len != 1)) {
+    printf("-o requires -c and a single input file\n");
+    usage(1);
+  }
+}
+
+// When writing an object file nothing is run, and symbols from outside it are
+// left for the system linker, so they only need to resolve to something.
+static void* placeholder_function_address(const char* name) {
+  (void)name;
+  return (void*)&placeholder_function_address;
 }
 
 #if X64WIN
@@ -94,23 +118,27 @@ int main(int argc, char** argv) {
   SetConsoleMode(GetStdHandle(-11), 7);
 #endif
 
-  alloc_init(AL_Link);
+  // There's no context yet to own AL_Link, so the arguments are collected in
+  // this thread's AL_Compile heap, which is unused until the first update.
+  alloc_init(AL_Compile);
 
   StringArray include_paths = {0};
   StringArray input_paths = {0};
   char* entry_point_override = "main";
   bool compile_only = false;
+  char* output_path = NULL;
   bool debug_symbols = false;
-  parse_args(argc, argv, &entry_point_override, &compile_only, &debug_symbols, &include_paths,
-             &input_paths);
-  strarray_push(&include_paths, NULL, AL_Link);
-  strarray_push(&input_paths, NULL, AL_Link);
+  parse_args(argc, argv, &entry_point_override, &compile_only, &output_path, &debug_symbols,
+             &include_paths, &input_paths);
+  strarray_push(&include_paths, NULL, AL_Compile);
+  strarray_push(&input_paths, NULL, AL_Compile);
+  char* first_input_path = input_paths.data[0];
 
   DyibiccEnviromentData env_data = {
       .include_paths = (const char**)include_paths.data,
       .files = (const char**)input_paths.data,
       .load_file_contents = read_file,
-      .get_function_address = NULL,
+      .get_function_address = output_path ? placeholder_function_address : NULL,
       .output_function = NULL,
       .use_ansi_codes = isatty(fileno(stdout)),
       .generate_debug_symbols = debug_symbols,
@@ -118,11 +146,18 @@ int main(int argc, char** argv) {
 
   DyibiccContext* ctx = dyibicc_set_environment(&env_data);
 
-  alloc_reset(AL_Link);
+  alloc_reset(AL_Compile);
 
   int result = 0;
 
-  if (dyibicc_update(ctx, NULL, NULL)) {
+  if (output_path) {
+    if (!dyibicc_update(ctx, NULL, NULL)) {
+      result = 255;
+    } else if (!dyibicc_write_object(ctx, first_input_path, output_path)) {
+      printf("couldn't write %s\n", output_path);
+      result = 1;
+    }
+  } else if (dyibicc_update(ctx, NULL, NULL)) {
     void* entry_point = dyibicc_find_export(ctx, entry_point_override);
     if (entry_point) {
       if (compile_only) {
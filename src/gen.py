@@ -14,14 +14,20 @@ ROOT_DIR = os.path.normpath(
 FILELIST = [
     'type.c',
     'alloc.c',
+    'cache.c',
     'entry.c',
     'fuzz_entry.c',
     'hashmap.c',
     'link.c',
     'main.c',
+    'object.c',
     'parse.c',
+    'perf.c',
     'preprocess.c',
+    'profile.c',
+    'sampler.c',
     'tokenize.c',
+    'trace.c',
     'unicode.c',
     'util.c',
 ]
@@ -16,6 +16,9 @@ typedef void* (*DyibiccFunctionLookupFn)(const char* name);
 // *contents ownership is taken and will be free()d.
 typedef bool (*DyibiccLoadFileContents)(const char* filename, char** contents, size_t* size);
 
+// Called by instrumented functions, see instrument_functions.
+typedef void (*DyibiccInstrumentFn)(void* function, void* call_site);
+
 typedef struct DyibiccEnviromentData {
   // NULL-terminated list of user include paths to search.
   const char** include_paths;
@@ -46,20 +49,101 @@ typedef struct DyibiccEnviromentData {
   // vectored through this function.
   DyibiccOutputFn output_function;
 
+  // If set, an existing directory where the code compiled for each file is
+  // saved. When a file is compiled again (typically by a later process), and
+  // neither it, nor anything it includes, nor the compiler has changed since,
+  // the saved code is loaded instead and only needs linking. Files that use
+  // reflection aren't saved. Not implemented on Windows.
+  const char* cache_dir;
+
   // Are simple ANSI colours supported by |output_function|.
   bool use_ansi_codes;
 
-  // Should debug symbols (pdb) be generated. Only implemented on Windows.
+  // Should debug symbols be generated. On Windows, as a pdb. On Linux, the
+  // code is registered with gdb's JIT interface as it's compiled, with line
+  // info and unwind tables.
   bool generate_debug_symbols;
 
-  bool padding[6];  // Avoid C4820 padding warning on MSVC /Wall.
+  // If set, the address of each non-static function is permanent: it's a
+  // trampoline that dyibicc_update() repoints at the function's latest code.
+  // Addresses from dyibicc_find_export() and pointers to functions taken by
+  // compiled code can then be held across updates. Calling a function that
+  // was removed by an update aborts.
+  bool stable_function_addresses;
+
+  // If set, functions are parsed by dyibicc_update() as usual, but only
+  // compiled when they're first called, by the thread that calls them. Their
+  // addresses are stubs that jump to the code once it's compiled. Files
+  // compiled this way aren't saved in |cache_dir|, and can't be saved as an
+  // image or an object. Not implemented on Windows.
+  bool lazy_compilation;
+
+  // If set, implies lazy_compilation, and the code first compiled for a
+  // function also counts its calls and loop iterations. Functions that are
+  // called often or loop a lot are then compiled again without the counting
+  // on a background thread, and calls switch to that code once it's ready
+  // (those already running carry on in the counting code). See
+  // dyibicc_get_function_counters(). Not implemented on Windows.
+  bool tiered_compilation;
+
+  // If set, code counts how often each branch of an if, each case of a
+  // switch, and each loop is run, for dyibicc_dump_profile(). This code
+  // isn't saved in |cache_dir|, and can't be saved as an image or an object.
+  bool profile_branches;
+
+  // If set, a line for each function is appended to /tmp/perf-<pid>.map as
+  // it's compiled (or loaded), so that Linux perf can name the code in its
+  // samples. Only implemented on Linux.
+  bool perf_map;
+
+  // If set, an existing directory where jit-<pid>.dump is written, describing
+  // each function's code and source lines as it's compiled (or loaded) for
+  // `perf inject --jit`. Record with `perf record -k mono` to use it. Only
+  // implemented on Linux.
+  const char* jitdump_dir;
+
+  // If set, every function is instrumented, otherwise only those declared with
+  // __attribute__((instrument)). Instrumented functions call |instrument_enter|
+  // once their frame is set up, and |instrument_exit| just before they return,
+  // with their own address and the address they were called from, as gcc's
+  // -finstrument-functions does. Either may be NULL. Leaving a function by
+  // longjmp() skips |instrument_exit|. Instrumented code isn't saved in
+  // |cache_dir|, and can't be saved as an image or an object. Not implemented
+  // on Windows.
+  bool instrument_functions;
+  DyibiccInstrumentFn instrument_enter;
+  DyibiccInstrumentFn instrument_exit;
+
+  // If set, instrumented functions also count their calls and the cycles
+  // (by rdtsc) spent in them, inline, see dyibicc_get_instrument_counters().
+  bool instrument_cycles;
+
+  // If set, each update writes a Chrome trace_event JSON file here (replacing
+  // the last one), with spans for compiling each file and its phases, each
+  // #include, container instantiation, and function parsed or emitted, and
+  // the link. It can be opened in Perfetto or chrome://tracing.
+  const char* time_trace_path;
+
+  // Alignment in bytes of function entries and loop headers, either 16 or 32.
+  // 0 selects the default of 16.
+  int code_alignment;
+
+  // Maximum number of threads used to compile files in parallel when more than
+  // one needs to be compiled. 0 selects 1, and a negative value the number of
+  // CPUs. If more than one, |load_file_contents| and |output_function| may be
+  // called from several threads at once.
+  int num_compile_threads;
 } DyibiccEnviromentData;
 
 typedef struct DyibiccContext DyibiccContext;
 
-// Sets up the environment for the compiler. There can currently only be a
-// single active DyibiccContext, despite the implication that there could be
-// multiple. See notes in the structure about how it should be filled out.
+// Sets up the environment for the compiler. See notes in the structure about
+// how it should be filled out. Any number of contexts can be active at once,
+// and each may be updated on a different thread concurrently with the others,
+// but calls for any one context must not overlap (other than as noted for
+// dyibicc_update_async()). The compiler's working state is per thread though,
+// so a host callback can't create, update, or load into any context from
+// inside an update on the same thread; those calls fail if it tries.
 DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data);
 
 // Called once on initialization with a file == NULL and contents == NULL, and
@@ -67,10 +151,227 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data);
 // should be recompiled/relinked.
 bool dyibicc_update(DyibiccContext* context, char* file, char* contents);
 
+// Starts the same work as dyibicc_update() on a background thread, except for
+// linking. Returns false if another is already in progress. |contents| must
+// remain valid until dyibicc_commit().
+//
+// Until dyibicc_commit() is called, previously compiled code keeps running
+// unaffected, and dyibicc_find_export() continues to return it. Other than
+// those, only dyibicc_update_ready() and the functions for running code on
+// other threads (dyibicc_enter(), etc.) may be called in the meantime.
+// Compiler errors are reported through |output_function| on the background
+// thread.
+bool dyibicc_update_async(DyibiccContext* context, char* file, char* contents);
+
+// Returns true once the background compile started by dyibicc_update_async()
+// has finished, i.e. when dyibicc_commit() won't block.
+bool dyibicc_update_ready(DyibiccContext* context);
+
+// Waits for the compile started by dyibicc_update_async(), and if it was
+// successful, links it so that it's what runs from then on. Should be called
+// at a point where the calling thread isn't running compiled code. Returns the
+// same result that dyibicc_update() would have.
+bool dyibicc_commit(DyibiccContext* context);
+
 // After a successful call to dyibicc_update(), retrieve the address of a
 // non-static function to call it. The returned function address cannot be
-// cached across dyibicc_update() calls.
+// cached across dyibicc_update() calls, unless stable_function_addresses was
+// set in DyibiccEnviromentData.
 void* dyibicc_find_export(DyibiccContext* context, char* name);
 
+typedef struct DyibiccStats {
+  // Total stack frame size of all functions compiled by the most recent
+  // dyibicc_update(), and the size it would have been if locals in disjoint
+  // block scopes were not sharing stack slots.
+  size_t frame_bytes;
+  size_t frame_bytes_unshared;
+
+  // Number of functions whose code was emitted by the most recent
+  // dyibicc_update() (or since then, for lazy_compilation), and the number
+  // whose code was unchanged from the previous update and so was kept as is.
+  size_t functions_compiled;
+  size_t functions_reused;
+
+  // Number of functions that only had a stub emitted by the most recent
+  // dyibicc_update(), see lazy_compilation.
+  size_t functions_deferred;
+
+  // Number of functions compiled again without counts since the most recent
+  // dyibicc_update(), see tiered_compilation.
+  size_t functions_promoted;
+
+  // Number of files whose code was loaded from |cache_dir| rather than being
+  // compiled.
+  size_t files_from_cache;
+
+  // Code and data replaced by earlier updates that hasn't been freed yet,
+  // because a thread may still be using it (see dyibicc_enter()).
+  size_t retired_bytes;
+
+  // Seconds spent in each phase by the most recent update, summed over the
+  // files it compiled. Files are compiled on several threads at once, so
+  // these can add up to more than |update_seconds|, the time from the start
+  // of compiling to the end of linking. Files that are #included are
+  // tokenized as they're preprocessed.
+  double tokenize_seconds;
+  double preprocess_seconds;
+  double containers_seconds;  // Instantiating #include <_/...> containers.
+  double parse_seconds;
+  double codegen_seconds;
+  double link_seconds;
+  double update_seconds;
+
+  // Produced by the most recent update: tokens read (including from
+  // headers), AST nodes, and bytes of code and of data.
+  size_t tokens;
+  size_t nodes;
+  size_t code_bytes;
+  size_t data_bytes;
+
+  // Number of #includes in the most recent update whose tokens were copied
+  // from an earlier tokenizing of the header, as its contents were unchanged.
+  // Headers are kept tokenized for the life of the context.
+  size_t headers_reused;
+
+  // Slots and pointers in data filled in by the most recent link.
+  size_t fixups_linked;
+
+  // The most bytes in use at once in each of the compiler's heaps: for the
+  // file that used the most while being compiled by the most recent update,
+  // by the most recent link, while the context was created, and for the life
+  // of the context so far.
+  size_t compile_heap_peak;
+  size_t link_heap_peak;
+  size_t temp_heap_peak;
+  size_t user_context_heap_peak;
+} DyibiccStats;
+
+// Retrieve statistics about the most recent call to dyibicc_update().
+void dyibicc_get_stats(DyibiccContext* context, DyibiccStats* stats);
+
+typedef struct DyibiccFileStats {
+  const char* name;
+  bool from_cache;  // Loaded from |cache_dir|, so only the heap is counted.
+  double tokenize_seconds;
+  double preprocess_seconds;
+  double containers_seconds;
+  double parse_seconds;
+  double codegen_seconds;
+  size_t tokens;
+  size_t nodes;
+  size_t code_bytes;
+  size_t data_bytes;
+  size_t compile_heap_peak;
+} DyibiccFileStats;
+
+// Fills in up to |max_files| of |stats| for the files compiled by the most
+// recent update, as for DyibiccStats, and returns how many there are.
+size_t dyibicc_get_file_stats(DyibiccContext* context,
+                              DyibiccFileStats* stats,
+                              size_t max_files);
+
+typedef struct DyibiccFunctionCounters {
+  const char* name;  // Valid until the next update.
+  unsigned long long calls;
+  unsigned long long backedges;  // Loop iterations.
+  bool promoted;  // Compiled again without counting, or queued to be.
+} DyibiccFunctionCounters;
+
+// With tiered_compilation, fills in up to |max_counters| of |counters| for the
+// functions that have been called since they were last compiled by an update,
+// and returns how many of those there are. Counting stops once a function is
+// promoted, so the counts are approximate.
+size_t dyibicc_get_function_counters(DyibiccContext* context,
+                                     DyibiccFunctionCounters* counters,
+                                     size_t max_counters);
+
+typedef struct DyibiccInstrumentCounters {
+  const char* name;  // Valid until the next update.
+  unsigned long long calls;
+  unsigned long long cycles;  // Including callees, and recursive calls again.
+} DyibiccInstrumentCounters;
+
+// With instrument_cycles, fills in up to |max_counters| of |counters| for the
+// instrumented functions that have been called since they were last compiled,
+// and returns how many of those there are. The counts aren't atomic, so are
+// approximate if a function runs on several threads at once.
+size_t dyibicc_get_instrument_counters(DyibiccContext* context,
+                                       DyibiccInstrumentCounters* counters,
+                                       size_t max_counters);
+
+// Threads other than the one calling dyibicc_update() may keep running
+// compiled code during an update, as long as they call dyibicc_enter() before
+// first running it, dyibicc_leave() when they're done with it, and
+// dyibicc_thread_quiescent() regularly in between, at points where they're not
+// executing compiled code or holding any address into it that they got before
+// the call (e.g. once per frame). Code and read-only data replaced by an update
+// are then only freed once every entered thread has passed through a
+// quiescent point or left. Threads that never call dyibicc_enter() aren't
+// waited for, and must not run compiled code during an update.
+void dyibicc_enter(DyibiccContext* context);
+void dyibicc_thread_quiescent(DyibiccContext* context);
+void dyibicc_leave(DyibiccContext* context);
+
+// Saves the code and data of every file in the context to |path|, as of the
+// most recent update. Data is saved with its initial values. Returns false if
+// it couldn't be written, or some code can't be moved to another process
+// (currently, if it uses _ReflectTypeOf or takes the address of a label in a
+// data initializer). Not supported on Windows.
+bool dyibicc_save_image(DyibiccContext* context, const char* path);
+
+// Can be used instead of the first dyibicc_update() of a new context, to load
+// and link the code saved by dyibicc_save_image() in a context with the same
+// |files|, rather than compiling them. Returns false if |path| can't be read,
+// or it wasn't saved by this build of dyibicc for the same files, in which
+// case dyibicc_update() should be used. The code is mapped from the file
+// rather than read, so to keep loading quick it's only checked that the file is
+// long enough to hold it: code that was altered in place is run as it is.
+bool dyibicc_load_image(DyibiccContext* context, const char* path);
+
+// Writes the code and data of |file| (one of |files|) as of the most recent
+// update to |path| as an ELF64 relocatable object, so that it can be linked
+// into a program without dyibicc. Data has its initial values. Returns false
+// if it couldn't be written, or some code can't be moved out of the process
+// (as for dyibicc_save_image()). Not supported on Windows.
+bool dyibicc_write_object(DyibiccContext* context, const char* file, const char* path);
+
+// Writes the counts recorded by code compiled with profile_branches to |path|.
+// Returns false if it couldn't be written.
+bool dyibicc_dump_profile(DyibiccContext* context, const char* path);
+
+// Loads counts written by dyibicc_dump_profile(), possibly by an earlier
+// process, to guide how functions are laid out when they're next compiled:
+// branches that were never taken are moved out of line, the more common
+// branch of an if falls through, and switch cases are tested most common
+// first. Counts for a function are ignored once it's edited. |cache_dir| isn't
+// used once a profile is loaded. Returns false if |path| couldn't be read.
+bool dyibicc_load_profile(DyibiccContext* context, const char* path);
+
+typedef enum DyibiccProfilerFormat {
+  // Per function: samples in it, and samples with it anywhere on the stack.
+  DYIBICC_PROFILER_FLAT,
+  // Per source line: samples in it.
+  DYIBICC_PROFILER_LINES,
+  // A line per distinct stack, "outer;...;leaf count", as consumed by
+  // flamegraph.pl and speedscope.
+  DYIBICC_PROFILER_COLLAPSED,
+} DyibiccProfilerFormat;
+
+// Starts sampling where the process is |hz| times per second of CPU time, with
+// SIGPROF, discarding samples from before. The profiler is per process rather
+// than per context, and takes over SIGPROF until it's stopped. Returns false
+// if it's already running, or on platforms other than Linux.
+bool dyibicc_profiler_start(int hz);
+
+// Stops sampling, and restores the previous SIGPROF handler.
+void dyibicc_profiler_stop(void);
+
+// Writes the samples so far to |path|. Samples are attributed to compiled
+// functions (anything else is "[native]"), and to lines if the code was
+// compiled with generate_debug_symbols or jitdump_dir. Code that's been
+// replaced or freed since it was sampled is also "[native]". Returns false if
+// it couldn't be written.
+bool dyibicc_profiler_write(const char* path, DyibiccProfilerFormat format);
+
 // Free all memory associated with the compiler context.
 void dyibicc_free(DyibiccContext* context);
@@ -13,7 +13,7 @@
 #include <unistd.h>
 #endif
 
-#define L(x) linker_state.link__##x
+#define L(x) user_context->linker_state.link__##x
 
 #if X64WIN
 static void Unimplemented(void) {
@@ -319,6 +319,56 @@ static void* get_standard_runtime_function(char* name) {
 }
 #endif
 
+#if !X64WIN
+// Out-of-line helpers that codegen calls for __int128 operations that are too
+// long to expand inline. They're named distinctly from libgcc's __divti3, etc.
+// because the host compiler may well implement these very functions by calling
+// those.
+static __int128 rt_divti3(__int128 a, __int128 b) {
+  return a / b;
+}
+static unsigned __int128 rt_udivti3(unsigned __int128 a, unsigned __int128 b) {
+  return a / b;
+}
+static __int128 rt_modti3(__int128 a, __int128 b) {
+  return a % b;
+}
+static unsigned __int128 rt_umodti3(unsigned __int128 a, unsigned __int128 b) {
+  return a % b;
+}
+static double rt_floattidf(__int128 a) {
+  return (double)a;
+}
+static double rt_floatuntidf(unsigned __int128 a) {
+  return (double)a;
+}
+static __int128 rt_fixdfti(double a) {
+  return (__int128)a;
+}
+static unsigned __int128 rt_fixunsdfti(double a) {
+  return (unsigned __int128)a;
+}
+
+static void* get_compiler_runtime_function(char* name) {
+  if (strncmp(name, "__dyibicc_", 10) != 0)
+    return NULL;
+  name += 10;
+#define X(func) \
+  if (strcmp(name, #func) == 0) \
+    return (void*)rt_##func;
+  X(divti3);
+  X(udivti3);
+  X(modti3);
+  X(umodti3);
+  X(floattidf);
+  X(floatuntidf);
+  X(fixdfti);
+  X(fixunsdfti);
+#undef X
+  return NULL;
+}
+#endif
+
 static void* symbol_lookup(char* name) {
   if (user_context->get_function_address) {
     void* f = user_context->get_function_address(name);
@@ -327,6 +377,13 @@ static void* symbol_lookup(char* name) {
     }
   }
 
+#if !X64WIN
+  void* rt = get_compiler_runtime_function(name);
+  if (rt) {
+    return rt;
+  }
+#endif
+
 #if X64WIN
   void* f = get_standard_runtime_function(name);
   if (f) {
@@ -338,53 +395,272 @@ static void* symbol_lookup(char* name) {
 #endif
 }
 
-IMPLSTATIC bool link_all_files(void) {
-  UserContext* uc = user_context;
+IMPLSTATIC SymbolSlot* get_symbol_slot(size_t file_index, char* name) {
+  FileLinkData* fld = &user_context->files[file_index];
 
-  if (uc->num_files == 0)
-    return false;
+  // Other files may be being compiled at the same time, and lazy functions of
+  // this one.
+  mutex_lock(user_context->compile_mutex);
+  SymbolSlot* slot = hashmap_get(&fld->slots, name);
+  if (!slot) {
+    SymbolSlotBlock* block = user_context->slot_blocks;
+    if (!block || block->used == SYMBOL_SLOT_BLOCK_SIZE) {
+      block = calloc(1, sizeof(SymbolSlotBlock));
+      block->next = user_context->slot_blocks;
+      user_context->slot_blocks = block;
+    }
+    slot = &block->slots[block->used++];
+    slot->name = strdup(name);
+    hashmap_put(&fld->slots, slot->name, slot);
+  }
+  mutex_unlock(user_context->compile_mutex);
+  return slot;
+}
 
-  // Process fixups.
-  for (size_t i = 0; i < uc->num_files; ++i) {
-    FileLinkData* fld = &uc->files[i];
+// Adds |slot| to the file's |used_slots| if it isn't already there. Must be
+// called with compile_mutex held.
+IMPLSTATIC void use_symbol_slot(FileLinkData* fld, SymbolSlot* slot) {
+  if (slot->in_use)
+    return;
+  if (fld->num_used_slots == fld->used_slots_cap) {
+    fld->used_slots_cap = fld->used_slots_cap ? fld->used_slots_cap * 2 : 16;
+    fld->used_slots = realloc(fld->used_slots, fld->used_slots_cap * sizeof(SymbolSlot*));
+  }
+  fld->used_slots[fld->num_used_slots++] = slot;
+  slot->in_use = true;
+}
 
-    if (!make_memory_readwrite(fld->codeseg_base_address, fld->codeseg_size)) {
-      outaf("failed to make %p size %zu readwrite\n", fld->codeseg_base_address, fld->codeseg_size);
-      return false;
+IMPLSTATIC void free_symbol_slots(UserContext* ctx) {
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    // Keys are the slots' names.
+    hashmap_clear_manual_key_owned_value_unowned(&ctx->files[i].slots);
+    free(ctx->files[i].used_slots);
+    ctx->files[i].used_slots = NULL;
+    ctx->files[i].num_used_slots = 0;
+    ctx->files[i].used_slots_cap = 0;
+  }
+  hashmap_clear_manual_key_owned_value_unowned(&ctx->redefined_names);
+  SymbolSlotBlock* block = ctx->slot_blocks;
+  while (block) {
+    SymbolSlotBlock* next = block->next;
+    free(block);
+    block = next;
+  }
+  ctx->slot_blocks = NULL;
+}
+
+// Called from user code, so there's no current context to report through.
+static void removed_function_called(void) {
+  fprintf(stderr, "dyibicc: called a function that was removed by dyibicc_update()\n");
+  abort();
+}
+
+// Each trampoline is an 8 byte `jmp [rip+disp32]` in the first page of a
+// block, jumping through the address at the same offset in the second page.
+// That way, all displacements are the same, and the code page never has to be
+// made writable to repoint an entry.
+#define STABLE_ENTRY_SIZE 8
+
+static void set_stable_entry_target(char* entry, void* address) {
+  void** target = (void**)(entry + get_page_size());
+  if (!address)
+    address = (void*)removed_function_called;
+#if X64WIN
+  InterlockedExchangePointer(target, address);
+#else
+  __atomic_store_n(target, address, __ATOMIC_RELEASE);
+#endif
+}
+
+IMPLSTATIC char* get_stable_entry(char* name) {
+  UserContext* uc = user_context;
+  char* entry = hashmap_get(&uc->stable_entries, name);
+  if (entry)
+    return entry;
+
+  unsigned int page_size = get_page_size();
+  StableEntryBlock* block = uc->stable_entry_blocks;
+  if (!block || block->used == (int)(page_size / STABLE_ENTRY_SIZE)) {
+    block = calloc(1, sizeof(StableEntryBlock));
+    block->names = calloc(page_size / STABLE_ENTRY_SIZE, sizeof(char*));
+    block->base_address = allocate_writable_memory(page_size * 2);
+    int32_t disp = (int32_t)page_size - 6;
+    for (unsigned int i = 0; i < page_size; i += STABLE_ENTRY_SIZE) {
+      unsigned char* p = (unsigned char*)block->base_address + i;
+      p[0] = 0xff;  // jmp qword [rip+disp]
+      p[1] = 0x25;
+      memcpy(&p[2], &disp, sizeof(disp));
+      p[6] = 0xcc;
+      p[7] = 0xcc;
     }
+    if (!make_memory_executable(block->base_address, page_size))
+      ABORT("failed to make trampolines executable");
+    block->next = uc->stable_entry_blocks;
+    uc->stable_entry_blocks = block;
+  }
 
-    for (int j = 0; j < fld->flen; ++j) {
-      void* fixup_address = fld->fixups[j].at;
-      char* name = fld->fixups[j].name;
-      int addend = fld->fixups[j].addend;
+  entry = block->base_address + block->used * STABLE_ENTRY_SIZE;
+  block->names[block->used++] = strdup(name);
+  set_stable_entry_target(entry, hashmap_get(&uc->exports[uc->num_files], name));
+  hashmap_put(&uc->stable_entries, block->names[block->used - 1], entry);
+  return entry;
+}
 
-      void* target_address = hashmap_get(&uc->global_data[i], name);
+IMPLSTATIC void free_stable_entries(UserContext* ctx) {
+  hashmap_clear_manual_key_owned_value_unowned(&ctx->stable_entries);
+  StableEntryBlock* block = ctx->stable_entry_blocks;
+  while (block) {
+    StableEntryBlock* next = block->next;
+    free_executable_memory(block->base_address, get_page_size() * 2);
+    free(block->names);
+    free(block);
+    block = next;
+  }
+  ctx->stable_entry_blocks = NULL;
+}
+
+// Once everything's linked, point all trampolines at the current code for
+// their function.
+static void update_stable_entries(void) {
+  UserContext* uc = user_context;
+  for (StableEntryBlock* block = uc->stable_entry_blocks; block; block = block->next) {
+    for (int i = 0; i < block->used; ++i) {
+      set_stable_entry_target(block->base_address + i * STABLE_ENTRY_SIZE,
+                              hashmap_get(&uc->exports[uc->num_files], block->names[i]));
+    }
+  }
+}
+
+static void* resolve_symbol(size_t file_index, char* name) {
+  UserContext* uc = user_context;
+  void* target_address = hashmap_get(&uc->global_data[file_index], name);
+  if (!target_address) {
+    target_address = hashmap_get(&uc->exports[file_index], name);
+    if (!target_address) {
+      target_address = hashmap_get(&uc->global_data[uc->num_files], name);
       if (!target_address) {
-        target_address = hashmap_get(&uc->exports[i], name);
+        target_address = hashmap_get(&uc->exports[uc->num_files], name);
+        if (target_address && uc->stable_function_addresses) {
+          target_address = get_stable_entry(name);
+        }
         if (!target_address) {
-          target_address = hashmap_get(&uc->global_data[uc->num_files], name);
+          target_address = symbol_lookup(name);
           if (!target_address) {
-            target_address = hashmap_get(&uc->exports[uc->num_files], name);
-            if (!target_address) {
-              target_address = symbol_lookup(name);
-              if (!target_address) {
-                outaf("undefined symbol: %s\n", name);
-                return false;
-              }
-            }
+            outaf("undefined symbol: %s\n", name);
           }
         }
       }
-
-      *((uintptr_t*)fixup_address) = (uintptr_t)target_address + addend;
     }
+  }
+  return target_address;
+}
 
-    if (!make_memory_executable(fld->codeseg_base_address, fld->codeseg_size)) {
-      outaf("failed to make %p size %zu executable\n", fld->codeseg_base_address,
-            fld->codeseg_size);
+// Fills in the slots used by code that was compiled after its file was
+// linked, i.e. a lazy function. Must be called with compile_mutex held.
+IMPLSTATIC bool link_slots(size_t file_index, SymbolSlot** slots, int num_slots) {
+  for (int i = 0; i < num_slots; ++i) {
+    void* target = resolve_symbol(file_index, slots[i]->name);
+    if (!target)
       return false;
+    if (slots[i]->address != target)
+      slots[i]->address = target;
+  }
+  return true;
+}
+
+static void add_redefined_name(char* name) {
+  UserContext* uc = user_context;
+  if (!hashmap_get(&uc->redefined_names, name))
+    hashmap_put(&uc->redefined_names, strdup(name), uc);
+}
+
+// Replaces the exports of files that were compiled since the last link. This
+// is deferred until here so that dyibicc_find_export() keeps returning the
+// old code until then. Their non-static names are recorded as redefined.
+static void fill_out_exports(void) {
+  UserContext* uc = user_context;
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    FileLinkData* fld = &uc->files[i];
+    if (!fld->exports_pending)
+      continue;
+
+    // per-file from any previous need to be cleared out for this round.
+    hashmap_clear_manual_key_owned_value_unowned(&uc->exports[i]);
+
+    for (int j = 0; j < fld->num_functions; ++j) {
+      FunctionCode* fc = &fld->functions[j];
+      size_t idx = fc->is_static ? i : uc->num_files;
+      hashmap_put(&uc->exports[idx], strdup(fc->name), fc->address);
+      if (!fc->is_static)
+        add_redefined_name(fc->name);
     }
+    // Read-only data is reallocated each time, and new data may have been
+    // added.
+    for (int j = 0; j < fld->num_data_objects; ++j) {
+      if (!fld->data_objects[j].is_static)
+        add_redefined_name(fld->data_objects[j].name);
+    }
+    fld->exports_pending = false;
   }
+}
+
+IMPLSTATIC bool link_all_files(void) {
+  UserContext* uc = user_context;
+
+  if (uc->num_files == 0)
+    return false;
+
+  fill_out_exports();
+
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    FileLinkData* fld = &uc->files[i];
+
+    // Fill the slots used by code. Code itself is never written once it's
+    // executable, only slots for symbols that moved change. In a file that
+    // wasn't compiled, those are the ones that some other file redefined.
+    bool all = fld->link_all_slots;
+    for (int j = 0; j < fld->num_used_slots; ++j) {
+      SymbolSlot* slot = fld->used_slots[j];
+      if (!all && !hashmap_get(&uc->redefined_names, slot->name))
+        continue;
+      void* target_address = resolve_symbol(i, slot->name);
+      if (!target_address)
+        return false;
+      if (slot->address != target_address)
+        slot->address = target_address;
+      ++uc->stats.fixups_linked;
+    }
+
+    // Process fixups in data.
+    for (int j = 0; j < fld->flen; ++j) {
+      if (!all && !hashmap_get(&uc->redefined_names, fld->fixups[j].name))
+        continue;
+      void* target_address = resolve_symbol(i, fld->fixups[j].name);
+      if (!target_address)
+        return false;
+      *((uintptr_t*)fld->fixups[j].at) = (uintptr_t)target_address + fld->fixups[j].addend;
+      ++uc->stats.fixups_linked;
+    }
+    fld->link_all_slots = false;
+
+    // Newly emitted code only has to be made executable the first time.
+    for (int j = 0; j < fld->num_chunks; ++j) {
+      CodeChunk* chunk = &fld->chunks[j];
+      if (chunk->is_executable)
+        continue;
+      if (!make_memory_executable(chunk->base_address, chunk->size)) {
+        outaf("failed to make %p size %zu executable\n", chunk->base_address, chunk->size);
+        return false;
+      }
+      chunk->is_executable = true;
+    }
+  }
+
+  // Kept until a link succeeds, so that a failed one is retried in full.
+  hashmap_clear_manual_key_owned_value_unowned(&uc->redefined_names);
+
+  if (uc->stable_function_addresses)
+    update_stable_entries();
 
   return true;
 }
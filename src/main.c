@@ -5,7 +5,7 @@
 #endif
 
 #define C(x) compiler_state.main__##x
-#define L(x) linker_state.main__##x
+#define L(x) user_context->linker_state.main__##x
 
 #if 0  // for -E call after preprocess().
 static void print_tokens(Token* tok) {
@@ -42,16 +42,54 @@ static bool default_load_file_fn(const char* path, char** contents, size_t* size
   return true;
 }
 
+// Makes |ctx| the context that the calling thread is working on, returning the
+// previous one so that it can be restored on the way out, e.g. when a host
+// callback looks up an export in another context.
+static UserContext* bind_context(UserContext* ctx) {
+  UserContext* prev = user_context;
+  user_context = ctx;
+  return prev;
+}
+
+// Set while the thread is in a call that uses compiler_state, the AL_Compile
+// and AL_Temp heaps, or toplevel_update_jmpbuf, all of which are per thread
+// rather than per context.
+static THREAD_LOCAL bool in_compiler_call;
+
+// Returns false, having reported it through the current context, if the thread
+// is already in such a call, i.e. |name| was called from a host callback.
+static bool begin_compiler_call(char* name) {
+  if (in_compiler_call) {
+    outaf("%s: can't be called from a callback during another update on the same thread\n",
+          name);
+    return false;
+  }
+  in_compiler_call = true;
+  return true;
+}
+
+static void end_compiler_call(void) {
+  in_compiler_call = false;
+}
+
 DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
+  if (!begin_compiler_call("dyibicc_set_environment"))
+    return NULL;
+
   // Set this up with a temporary value early, mostly so we can ABORT() below
   // with output if necessary.
   UserContext tmp_user_context = {0};
   tmp_user_context.output_function = default_output_fn;
   tmp_user_context.load_file_contents = default_load_file_fn;
-  user_context = &tmp_user_context;
+  UserContext* prev = bind_context(&tmp_user_context);
 
   alloc_init(AL_Temp);
 
+  if (env_data->code_alignment != 0 && env_data->code_alignment != 16 &&
+      env_data->code_alignment != 32) {
+    ABORT("code_alignment must be 0, 16, or 32");
+  }
+
   // Clone env_data into allocated ctx
 
   size_t total_include_paths_len = 0;
@@ -121,6 +159,11 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
     ++num_files;
   }
 
+  size_t cache_dir_len = env_data->cache_dir ? strlen(env_data->cache_dir) + 1 : 0;
+  size_t jitdump_dir_len = env_data->jitdump_dir ? strlen(env_data->jitdump_dir) + 1 : 0;
+  size_t time_trace_path_len =
+      env_data->time_trace_path ? strlen(env_data->time_trace_path) + 1 : 0;
+
   size_t total_size =
       sizeof(UserContext) +                       // base structure
       (num_include_paths * sizeof(char*)) +       // array in base structure
@@ -128,7 +171,10 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
       (total_include_paths_len * sizeof(char)) +  // pointed to by include_paths
       (total_source_files_len * sizeof(char)) +   // pointed to by FileLinkData.source_name
       ((num_files + 1) * sizeof(HashMap)) +       // +1 beyond num_files for fully global dataseg
-      ((num_files + 1) * sizeof(HashMap))         // +1 beyond num_files for fully global exports
+      ((num_files + 1) * sizeof(HashMap)) +       // +1 beyond num_files for fully global exports
+      (cache_dir_len * sizeof(char)) +            // pointed to by cache_dir
+      (jitdump_dir_len * sizeof(char)) +          // pointed to by jitdump_dir
+      (time_trace_path_len * sizeof(char))        // pointed to by time_trace_path
       ;
 
   UserContext* data = calloc(1, total_size);
@@ -144,6 +190,38 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
   }
   data->use_ansi_codes = env_data->use_ansi_codes;
   data->generate_debug_symbols = env_data->generate_debug_symbols;
+  data->stable_function_addresses = env_data->stable_function_addresses;
+  data->code_alignment = env_data->code_alignment ? env_data->code_alignment : 16;
+  data->num_compile_threads = env_data->num_compile_threads;
+  if (data->num_compile_threads == 0)
+    data->num_compile_threads = 1;
+  else if (data->num_compile_threads < 0)
+    data->num_compile_threads = get_num_cpus();
+#if X64WIN
+  // The function table and debug symbols are per context rather than per file,
+  // so codegen can't run on several threads at once.
+  data->num_compile_threads = 1;
+#endif
+  data->lazy_compilation = env_data->lazy_compilation;
+  data->tiered_compilation = env_data->tiered_compilation;
+  data->profile_branches = env_data->profile_branches;
+  data->perf_map = env_data->perf_map;
+  data->instrument_functions = env_data->instrument_functions;
+  data->instrument_enter = (void*)env_data->instrument_enter;
+  data->instrument_exit = (void*)env_data->instrument_exit;
+  data->instrument_cycles = env_data->instrument_cycles;
+#if X64WIN
+  // Unwind info is emitted along with each file's code.
+  data->lazy_compilation = false;
+  data->tiered_compilation = false;
+  data->instrument_functions = false;
+  data->instrument_enter = NULL;
+  data->instrument_exit = NULL;
+  data->instrument_cycles = false;
+#endif
+  data->compile_mutex = mutex_create();
+  data->lazy_mutex = mutex_create();
+  data->epoch = 1;
 
   char* d = (char*)(&data[1]);
 
@@ -181,6 +259,29 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
     d += strlen(*p) + 1;
   }
 
+  if (env_data->cache_dir) {
+#if !X64WIN
+    // Unwind tables aren't saved, so there's no cache on Windows.
+    data->cache_dir = d;
+#endif
+    strcpy(d, env_data->cache_dir);
+    d += cache_dir_len;
+  }
+
+  if (env_data->jitdump_dir) {
+#if defined(__linux__)
+    data->jitdump_dir = d;
+#endif
+    strcpy(d, env_data->jitdump_dir);
+    d += jitdump_dir_len;
+  }
+
+  if (env_data->time_trace_path) {
+    data->time_trace_path = d;
+    strcpy(d, env_data->time_trace_path);
+    d += time_trace_path_len;
+  }
+
   // These maps store an arbitrary number of symbols, and they must persist
   // beyond AL_Link (to be saved for relink updates) so they must be manually
   // managed.
@@ -188,6 +289,13 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
     data->global_data[j].alloc_lifetime = AL_Manual;
     data->exports[j].alloc_lifetime = AL_Manual;
   }
+  for (size_t j = 0; j < num_files; ++j) {
+    data->files[j].slots.alloc_lifetime = AL_Manual;
+  }
+  data->stable_entries.alloc_lifetime = AL_Manual;
+  data->redefined_names.alloc_lifetime = AL_Manual;
+  data->profile.alloc_lifetime = AL_Manual;
+  data->token_cache.alloc_lifetime = AL_Manual;
   data->reflect_types.alloc_lifetime = AL_UserContext;
 
   if ((size_t)(d - (char*)data) != total_size) {
@@ -195,96 +303,538 @@ DyibiccContext* dyibicc_set_environment(DyibiccEnviromentData* env_data) {
   }
 
   user_context = data;
+  data->temp_heap_peak = alloc_used(AL_Temp);
   alloc_reset(AL_Temp);
   alloc_init(AL_UserContext);
+  user_context = prev;
+  end_compiler_call();
   return (DyibiccContext*)data;
 }
 
-void dyibicc_free(DyibiccContext* context) {
-  UserContext* ctx = (UserContext*)context;
-  assert(ctx == user_context && "only one context currently supported");
-  for (size_t i = 0; i < ctx->num_files + 1; ++i) {
-    hashmap_clear_manual_key_owned_value_owned_aligned(&ctx->global_data[i]);
-    hashmap_clear_manual_key_owned_value_unowned(&ctx->exports[i]);
-  }
-  alloc_reset(AL_UserContext);
+// Returns the seconds since *|since|, and sets it to now.
+static double lap(double* since) {
+  double now = get_seconds();
+  double elapsed = now - *since;
+  *since = now;
+  return elapsed;
+}
 
-  for (size_t i = 0; i < ctx->num_files; ++i) {
-    free_link_fixups(&ctx->files[i]);
-  }
-#if X64WIN
-  unregister_and_free_function_table_data(ctx);
-#endif
-  free(ctx);
-  user_context = NULL;
+// Records what compiling file |i| took, and adds it to the update's stats.
+static void record_file_stats(UserContext* ctx, size_t i, DyibiccFileStats* fs) {
+  fs->name = ctx->files[i].source_name;
+  fs->tokens = compiler_state.tokenize__num_tokens;
+  fs->nodes = compiler_state.parse__num_nodes;
+  fs->code_bytes = compiler_state.codegen__stats.code_bytes;
+  fs->data_bytes = compiler_state.codegen__stats.data_bytes;
+  fs->compile_heap_peak = alloc_used(AL_Compile);
+  ctx->files[i].stats = *fs;
+
+  // Code and data bytes were added by codegen().
+  mutex_lock(ctx->compile_mutex);
+  DyibiccStats* stats = &ctx->stats;
+  stats->tokenize_seconds += fs->tokenize_seconds;
+  stats->preprocess_seconds += fs->preprocess_seconds;
+  stats->containers_seconds += fs->containers_seconds;
+  stats->parse_seconds += fs->parse_seconds;
+  stats->codegen_seconds += fs->codegen_seconds;
+  stats->tokens += fs->tokens;
+  stats->nodes += fs->nodes;
+  stats->headers_reused += compiler_state.tokenize__num_headers_reused;
+  stats->compile_heap_peak = MAX(stats->compile_heap_peak, fs->compile_heap_peak);
+  mutex_unlock(ctx->compile_mutex);
 }
 
-bool dyibicc_update(DyibiccContext* context, char* filename, char* contents) {
+// Tokenizes, preprocesses, parses, and generates code for file |i|, leaving it
+// ready to be linked. Returns false if there was an error.
+static bool compile_file(UserContext* ctx, size_t i, char* filename, char* contents) {
   if (setjmp(toplevel_update_jmpbuf) != 0) {
     codegen_free();
     alloc_reset(AL_Compile);
     alloc_reset(AL_Temp);
-    alloc_reset(AL_Link);
     memset(&compiler_state, 0, sizeof(compiler_state));
-    memset(&linker_state, 0, sizeof(linker_state));
     return false;
   }
 
-  UserContext* ctx = (UserContext*)context;
+  FileLinkData* dld = &ctx->files[i];
+  DyibiccFileStats fs = {0};
+
+  alloc_init(AL_Compile);
+  trace_init();
+  double file_start = trace_begin();
+
+  // Cache entries are keyed on the file's contents, so those are needed first.
+  // They don't depend on a profile though, so aren't used with one, nor where
+  // the code would need to be different (and so isn't saved), e.g. with
+  // counters for profile_branches, or as stubs for lazy_compilation.
+  uint64_t key = 0;
+  if (ctx->cache_dir && ctx->profile.used == 0 && !ctx->profile_branches &&
+      !ctx->lazy_compilation && !ctx->tiered_compilation) {
+    if (!filename) {
+      contents = read_file_wrap_user(dld->source_name, AL_Compile);
+      if (contents)
+        filename = dld->source_name;
+    }
+    if (filename) {
+      key = cache_key(dld->source_name, contents);
+      if (cache_load(i, key)) {
+        register_loaded_code(i);
+        fs.from_cache = true;
+        record_file_stats(ctx, i, &fs);
+        trace_end(file_start, "load from cache", dld->source_name);
+        trace_flush();
+        alloc_reset(AL_Compile);
+        return true;
+      }
+    }
+  }
+
+  double t = get_seconds();
+  double phase_start = trace_begin();
+  init_macros();
+  C(base_file) = dld->source_name;
+  Token* tok;
+  if (filename) {
+    tok = tokenize_filecontents(filename, contents);
+  } else {
+    tok = tokenize_file(C(base_file));
+  }
+  if (!tok)
+    error("%s: %s", C(base_file), strerror(errno));
+  fs.tokenize_seconds = lap(&t);
+  trace_end(phase_start, "tokenize", NULL);
+
+  phase_start = trace_begin();
+  tok = preprocess(tok);
+  fs.preprocess_seconds = lap(&t);
+  trace_end(phase_start, "preprocess", NULL);
+
+  tok = add_container_instantiations(tok);
+  fs.containers_seconds = lap(&t);
+
+  codegen_init();  // Initializes dynasm so that parse() can assign labels.
+
+  phase_start = trace_begin();
+  Obj* prog = parse(tok);
+  fs.parse_seconds = lap(&t);
+  trace_end(phase_start, "parse", NULL);
+
+  phase_start = trace_begin();
+  codegen(prog, i);
+  fs.codegen_seconds = lap(&t);
+  trace_end(phase_start, "codegen", NULL);
+  if (key)
+    cache_store(i, key);
+  record_file_stats(ctx, i, &fs);
+  trace_end(file_start, "compile", dld->source_name);
+  trace_flush();
+
+  // Lazy functions are compiled later from the parse, so it's kept along with
+  // the file's code.
+  LazyFile* lazy = compiler_state.codegen__lazy_file;
+  if (lazy)
+    lazy->heap = alloc_detach(AL_Compile);
+  else
+    alloc_reset(AL_Compile);
+  return true;
+}
+
+typedef struct CompileQueue {
+  UserContext* ctx;
+  uint64_t next_file;
+  uint64_t failed;
+} CompileQueue;
+
+static void compile_worker(void* arg) {
+  CompileQueue* q = arg;
+  user_context = q->ctx;
+  in_compiler_call = true;  // Already set if this is the calling thread.
+  while (!atomic_load_u64(&q->failed)) {
+    uint64_t i = atomic_fetch_add_u64(&q->next_file, 1);
+    if (i >= q->ctx->num_files)
+      break;
+    if (!compile_file(q->ctx, i, NULL, NULL))
+      atomic_store_u64(&q->failed, 1);
+  }
+}
+
+// Compiles |filename| from |contents|, or all files if it's NULL, in which
+// case they're spread across up to num_compile_threads threads. Returns false
+// if there was an error.
+static bool compile_files(UserContext* ctx, char* filename, char* contents, bool* compiled_any) {
+  memset(&ctx->stats, 0, sizeof(ctx->stats));
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    ctx->files[i].stats = (DyibiccFileStats){0};
+  }
+  trace_reset(ctx);
+  free_token_cache(ctx, false);
+  double start = get_seconds();
+
+  if (filename) {
+    for (size_t i = 0; i < ctx->num_files; ++i) {
+      // If a specific update is provided, we only compile that one.
+      if (strcmp(ctx->files[i].source_name, filename) == 0) {
+        *compiled_any = true;
+        bool result = compile_file(ctx, i, filename, contents);
+        ctx->stats.update_seconds = get_seconds() - start;
+        return result;
+      }
+    }
+    return true;
+  }
+
+  CompileQueue queue = {ctx, 0, 0};
+  int num_threads = (int)MIN((size_t)ctx->num_compile_threads, ctx->num_files);
+  Thread** threads = calloc(num_threads, sizeof(Thread*));
+  // This thread is one of the workers too. If a thread can't be started, the
+  // others just pick up its share.
+  for (int i = 1; i < num_threads; ++i) {
+    threads[i] = thread_start(compile_worker, &queue);
+  }
+  compile_worker(&queue);
+  for (int i = 1; i < num_threads; ++i) {
+    if (threads[i])
+      thread_join(threads[i]);
+  }
+  free(threads);
+
+  ctx->stats.update_seconds = get_seconds() - start;
+  *compiled_any = ctx->num_files > 0;
+  return !queue.failed;
+}
+
+// Links what compile_files() produced, so that it's what runs from now on.
+static bool link_files(UserContext* ctx, bool compiled_any) {
   bool link_result = true;
+  if (compiled_any) {
+    double start = get_seconds();
+    alloc_init(AL_Link);
+
+    // Lazy functions may be being compiled and linked on other threads.
+    mutex_lock(ctx->compile_mutex);
+    link_result = link_all_files();
+    mutex_unlock(ctx->compile_mutex);
+
+    ctx->stats.link_heap_peak = alloc_used(AL_Link);
+    alloc_reset(AL_Link);
+    ctx->stats.link_seconds = get_seconds() - start;
+    trace_record(start, "link");
+    ctx->stats.update_seconds += ctx->stats.link_seconds;
+  }
+
+  publish_epoch(ctx);
+  reclaim_retired(ctx, false);
+
+  return link_result;
+}
+
+bool dyibicc_update(DyibiccContext* context, char* filename, char* contents) {
+  UserContext* ctx = (UserContext*)context;
 
-  assert(ctx == user_context && "only one context currently supported");
+  assert(!ctx->async && "dyibicc_update_async() in progress");
 
+  if (!begin_compiler_call("dyibicc_update"))
+    return false;
+  UserContext* prev = bind_context(ctx);
   bool compiled_any = false;
-  {
-    for (size_t i = 0; i < ctx->num_files; ++i) {
-      FileLinkData* dld = &ctx->files[i];
+  bool result =
+      compile_files(ctx, filename, contents, &compiled_any) && link_files(ctx, compiled_any);
+  trace_write(ctx);
+  user_context = prev;
+  end_compiler_call();
+  return result;
+}
 
-      if (filename && strcmp(dld->source_name, filename) != 0) {
-        // If a specific update is provided, we only compile that one.
-        continue;
-      }
+struct AsyncUpdate {
+  UserContext* ctx;
+  char* filename;
+  char* contents;
+  bool compile_result;
+  bool compiled_any;
+  uint64_t done;
+  Thread* thread;
+};
+
+static void async_compile_thread(void* arg) {
+  AsyncUpdate* au = arg;
+  user_context = au->ctx;
+  in_compiler_call = true;
+  au->compile_result = compile_files(au->ctx, au->filename, au->contents, &au->compiled_any);
+  atomic_store_u64(&au->done, 1);
+}
 
-      {
-        alloc_init(AL_Compile);
+bool dyibicc_update_async(DyibiccContext* context, char* filename, char* contents) {
+  UserContext* ctx = (UserContext*)context;
 
-        init_macros();
-        C(base_file) = dld->source_name;
-        Token* tok;
-        if (filename) {
-          tok = tokenize_filecontents(filename, contents);
-        } else {
-          tok = tokenize_file(C(base_file));
-        }
-        if (!tok)
-          error("%s: %s", C(base_file), strerror(errno));
-        tok = preprocess(tok);
-        tok = add_container_instantiations(tok);
+  if (ctx->async)
+    return false;
 
-        codegen_init();  // Initializes dynasm so that parse() can assign labels.
+  AsyncUpdate* au = calloc(1, sizeof(AsyncUpdate));
+  au->ctx = ctx;
+  au->filename = filename;
+  au->contents = contents;
+  au->thread = thread_start(async_compile_thread, au);
+  if (!au->thread) {
+    free(au);
+    return false;
+  }
+  ctx->async = au;
+  return true;
+}
 
-        Obj* prog = parse(tok);
-        codegen(prog, i);
+bool dyibicc_update_ready(DyibiccContext* context) {
+  UserContext* ctx = (UserContext*)context;
+  return !ctx->async || atomic_load_u64(&ctx->async->done);
+}
 
-        compiled_any = true;
+// Waits for the background compile to finish, returning whether it succeeded.
+static bool finish_async(UserContext* ctx, bool* compiled_any) {
+  AsyncUpdate* au = ctx->async;
+  thread_join(au->thread);
+  ctx->async = NULL;
 
-        alloc_reset(AL_Compile);
-      }
-    }
+  bool compile_result = au->compile_result;
+  *compiled_any = au->compiled_any;
+  free(au);
+  return compile_result;
+}
 
-    if (compiled_any) {
-      alloc_init(AL_Link);
+bool dyibicc_commit(DyibiccContext* context) {
+  UserContext* ctx = (UserContext*)context;
+  if (!ctx->async || !begin_compiler_call("dyibicc_commit"))
+    return false;
 
-      link_result = link_all_files();
+  UserContext* prev = bind_context(ctx);
+  bool compiled_any = false;
+  bool result = finish_async(ctx, &compiled_any) && link_files(ctx, compiled_any);
+  trace_write(ctx);
+  user_context = prev;
+  end_compiler_call();
+  return result;
+}
 
-      alloc_reset(AL_Link);
+bool dyibicc_save_image(DyibiccContext* context, const char* path) {
+#if X64WIN
+  // As for the cache, unwind tables aren't saved.
+  (void)context;
+  (void)path;
+  return false;
+#else
+  UserContext* ctx = (UserContext*)context;
+  UserContext* prev = bind_context(ctx);
+  bool result = image_save((char*)path);
+  user_context = prev;
+  return result;
+#endif
+}
+
+bool dyibicc_load_image(DyibiccContext* context, const char* path) {
+#if X64WIN
+  (void)context;
+  (void)path;
+  return false;
+#else
+  UserContext* ctx = (UserContext*)context;
+  if (!begin_compiler_call("dyibicc_load_image"))
+    return false;
+  UserContext* prev = bind_context(ctx);
+  bool result = false;
+  if (setjmp(toplevel_update_jmpbuf) == 0) {
+    alloc_init(AL_Compile);
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+    result = image_load((char*)path);
+  }
+  alloc_reset(AL_Compile);
+  result = result && link_files(ctx, true);
+  user_context = prev;
+  end_compiler_call();
+  return result;
+#endif
+}
+
+bool dyibicc_write_object(DyibiccContext* context, const char* file, const char* path) {
+#if X64WIN
+  // Only ELF is written.
+  (void)context;
+  (void)file;
+  (void)path;
+  return false;
+#else
+  UserContext* ctx = (UserContext*)context;
+  if (!begin_compiler_call("dyibicc_write_object"))
+    return false;
+  UserContext* prev = bind_context(ctx);
+  bool result = false;
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    if (strcmp(ctx->files[i].source_name, file) == 0) {
+      alloc_init(AL_Compile);
+      result = write_object_file(i, (char*)path);
+      alloc_reset(AL_Compile);
+      break;
     }
   }
+  user_context = prev;
+  end_compiler_call();
+  return result;
+#endif
+}
 
-  return link_result;
+bool dyibicc_dump_profile(DyibiccContext* context, const char* path) {
+  UserContext* ctx = (UserContext*)context;
+  UserContext* prev = bind_context(ctx);
+  bool result = profile_dump((char*)path);
+  user_context = prev;
+  return result;
+}
+
+bool dyibicc_load_profile(DyibiccContext* context, const char* path) {
+  UserContext* ctx = (UserContext*)context;
+  if (!begin_compiler_call("dyibicc_load_profile"))
+    return false;
+  UserContext* prev = bind_context(ctx);
+  alloc_init(AL_Compile);
+  bool result = profile_load((char*)path);
+  alloc_reset(AL_Compile);
+  user_context = prev;
+  end_compiler_call();
+  return result;
+}
+
+void dyibicc_free(DyibiccContext* context) {
+  UserContext* ctx = (UserContext*)context;
+  UserContext* prev = bind_context(ctx);
+  if (ctx->async) {
+    bool compiled_any;
+    finish_async(ctx, &compiled_any);
+  }
+  finish_promotions(ctx);
+  for (size_t i = 0; i < ctx->num_files + 1; ++i) {
+    hashmap_clear_manual_key_owned_value_owned_aligned(&ctx->global_data[i]);
+    hashmap_clear_manual_key_owned_value_unowned(&ctx->exports[i]);
+  }
+  alloc_reset(AL_UserContext);
+
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    free_link_fixups(&ctx->files[i]);
+    free_data_objects(&ctx->files[i]);
+    free_function_code(&ctx->files[i]);
+  }
+  free_symbol_slots(ctx);
+  hashmap_clear_manual_key_owned_value_owned_aligned(&ctx->profile);
+  mutex_destroy(ctx->compile_mutex);
+  mutex_destroy(ctx->lazy_mutex);
+  free_stable_entries(ctx);
+  trace_reset(ctx);
+  free_token_cache(ctx, true);
+  reclaim_retired(ctx, true);
+#if X64WIN
+  unregister_and_free_function_table_data(ctx);
+#endif
+  free(ctx);
+  user_context = prev == ctx ? NULL : prev;
 }
 
 void* dyibicc_find_export(DyibiccContext* context, char* name) {
   UserContext* ctx = (UserContext*)context;
-  return hashmap_get(&ctx->exports[ctx->num_files], name);
+  void* result = hashmap_get(&ctx->exports[ctx->num_files], name);
+  if (ctx->stable_function_addresses && result) {
+    UserContext* prev = bind_context(ctx);
+    mutex_lock(ctx->compile_mutex);
+    result = get_stable_entry(name);
+    mutex_unlock(ctx->compile_mutex);
+    user_context = prev;
+  }
+  return result;
+}
+
+void dyibicc_get_stats(DyibiccContext* context, DyibiccStats* stats) {
+  UserContext* ctx = (UserContext*)context;
+  *stats = ctx->stats;
+  for (RetiredMemory* r = ctx->retired; r; r = r->next) {
+    stats->retired_bytes += r->size;
+  }
+  stats->temp_heap_peak = ctx->temp_heap_peak;
+  // Nothing is freed from it until the context is.
+  UserContext* prev = bind_context(ctx);
+  stats->user_context_heap_peak = alloc_used(AL_UserContext);
+  user_context = prev;
+}
+
+size_t dyibicc_get_file_stats(DyibiccContext* context,
+                              DyibiccFileStats* stats,
+                              size_t max_files) {
+  UserContext* ctx = (UserContext*)context;
+  size_t n = 0;
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    if (!ctx->files[i].stats.name)
+      continue;
+    if (n < max_files)
+      stats[n] = ctx->files[i].stats;
+    ++n;
+  }
+  return n;
+}
+
+size_t dyibicc_get_function_counters(DyibiccContext* context,
+                                     DyibiccFunctionCounters* counters,
+                                     size_t max_counters) {
+  UserContext* ctx = (UserContext*)context;
+  size_t n = 0;
+  mutex_lock(ctx->lazy_mutex);
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    FileLinkData* fld = &ctx->files[i];
+    for (int j = 0; j < fld->num_functions; ++j) {
+      LazyFunction* lf = fld->functions[j].lazy;
+      if (!ctx->tiered_compilation || !lf || !lf->code.base_address)
+        continue;
+      if (n < max_counters) {
+        counters[n] = (DyibiccFunctionCounters){
+            .name = fld->functions[j].name,
+            .calls = lf->calls,
+            .backedges = lf->backedges,
+            .promoted = lf->promotion_requested,
+        };
+      }
+      ++n;
+    }
+  }
+  mutex_unlock(ctx->lazy_mutex);
+  return n;
+}
+
+size_t dyibicc_get_instrument_counters(DyibiccContext* context,
+                                       DyibiccInstrumentCounters* counters,
+                                       size_t max_counters) {
+  UserContext* ctx = (UserContext*)context;
+  size_t n = 0;
+  mutex_lock(ctx->lazy_mutex);
+  for (size_t i = 0; i < ctx->num_files; ++i) {
+    FileLinkData* fld = &ctx->files[i];
+    for (int j = 0; j < fld->num_functions; ++j) {
+      uint64_t* counts = fld->functions[j].instrument_counts;
+      if (!counts || counts[0] == 0)
+        continue;
+      if (n < max_counters) {
+        counters[n] = (DyibiccInstrumentCounters){
+            .name = fld->functions[j].name,
+            .calls = counts[0],
+            .cycles = counts[1],
+        };
+      }
+      ++n;
+    }
+  }
+  mutex_unlock(ctx->lazy_mutex);
+  return n;
+}
+
+void dyibicc_enter(DyibiccContext* context) {
+  thread_enter((UserContext*)context);
+}
+
+void dyibicc_thread_quiescent(DyibiccContext* context) {
+  thread_quiescent((UserContext*)context);
+}
+
+void dyibicc_leave(DyibiccContext* context) {
+  thread_leave((UserContext*)context);
 }
@@ -0,0 +1,1080 @@
+#include "dyibicc.h"
+
+// Writes what a file was compiled to as an ELF64 relocatable object, so that
+// code developed with updates can be linked into a program normally.
+//
+// Code refers to everything through symbol slots (see get_symbol_slot()),
+// loading each slot's address with a mov64. In the object, the slots are a
+// table at the end of .data with an R_X86_64_64 relocation for each, and each
+// mov64 is rewritten to a lea of its slot with an R_X86_64_PC32 relocation, so
+// that the code itself doesn't need any load-time relocations.
+
+enum {
+  ELF_SHT_PROGBITS = 1,
+  ELF_SHT_SYMTAB = 2,
+  ELF_SHT_STRTAB = 3,
+  ELF_SHT_RELA = 4,
+  ELF_SHT_NOBITS = 8,
+
+  ELF_SHF_WRITE = 1,
+  ELF_SHF_ALLOC = 2,
+  ELF_SHF_EXECINSTR = 4,
+  ELF_SHF_INFO_LINK = 0x40,
+
+  ELF_STB_LOCAL = 0,
+  ELF_STB_GLOBAL = 1,
+  ELF_STT_NOTYPE = 0,
+  ELF_STT_OBJECT = 1,
+  ELF_STT_FUNC = 2,
+  ELF_STT_SECTION = 3,
+
+  ELF_R_X86_64_64 = 1,
+  ELF_R_X86_64_PC32 = 2,
+};
+
+typedef struct ElfHeader {
+  unsigned char ident[16];
+  uint16_t type;
+  uint16_t machine;
+  uint32_t version;
+  uint64_t entry;
+  uint64_t phoff;
+  uint64_t shoff;
+  uint32_t flags;
+  uint16_t ehsize;
+  uint16_t phentsize;
+  uint16_t phnum;
+  uint16_t shentsize;
+  uint16_t shnum;
+  uint16_t shstrndx;
+} ElfHeader;
+
+typedef struct ElfSectionHeader {
+  uint32_t name;
+  uint32_t type;
+  uint64_t flags;
+  uint64_t addr;
+  uint64_t offset;
+  uint64_t size;
+  uint32_t link;
+  uint32_t info;
+  uint64_t addralign;
+  uint64_t entsize;
+} ElfSectionHeader;
+
+typedef struct ElfSymbol {
+  uint32_t name;
+  unsigned char info;
+  unsigned char other;
+  uint16_t shndx;
+  uint64_t value;
+  uint64_t size;
+} ElfSymbol;
+
+typedef struct ElfRela {
+  uint64_t offset;
+  uint64_t info;
+  int64_t addend;
+} ElfRela;
+
+typedef struct Buffer {
+  char* data;
+  size_t len;
+  size_t capacity;
+} Buffer;
+
+static size_t buffer_append(Buffer* b, const void* p, size_t n) {
+  if (b->len + n > b->capacity) {
+    b->capacity = MAX(b->capacity * 2, b->len + n);
+    b->data = realloc(b->data, b->capacity);
+  }
+  if (p)
+    memcpy(b->data + b->len, p, n);
+  else
+    memset(b->data + b->len, 0, n);
+  b->len += n;
+  return b->len - n;
+}
+
+static void buffer_align(Buffer* b, size_t align) {
+  buffer_append(b, NULL, align_to_u(b->len, align) - b->len);
+}
+
+static uint32_t add_string(Buffer* strtab, char* s) {
+  return (uint32_t)buffer_append(strtab, s, strlen(s) + 1);
+}
+
+// The sections that have contents, in the order of their section headers and
+// section symbols. Read-only data that has relocations goes in .data.rel.ro.
+typedef enum {
+  SEC_TEXT = 1,
+  SEC_DATA,
+  SEC_BSS,
+  SEC_RODATA,
+  SEC_RELRO,
+  SEC_RELA_TEXT,
+  SEC_RELA_DATA,
+  SEC_RELA_RELRO,
+  SEC_SYMTAB,
+  SEC_STRTAB,
+  SEC_SHSTRTAB,
+  SEC_NOTE_GNU_STACK,
+  NUM_SECTIONS,
+} SectionIndex;
+
+typedef struct ObjectWriter {
+  Buffer sections[NUM_SECTIONS];  // .bss only uses |len|.
+  int alignments[NUM_SECTIONS];
+  Buffer symbols;  // ElfSymbol
+  Buffer strtab;
+  HashMap symbol_indices;  // Name to index + 1.
+} ObjectWriter;
+
+static void add_symbol(ObjectWriter* w, char* name, int bind, int type, int shndx, size_t value,
+                       size_t size) {
+  ElfSymbol sym = {add_string(&w->strtab, name), (unsigned char)((bind << 4) | type), 0,
+                   (uint16_t)shndx, value, size};
+  size_t index = buffer_append(&w->symbols, &sym, sizeof(sym)) / sizeof(sym);
+  hashmap_put(&w->symbol_indices, name, (void*)(index + 1));
+}
+
+static void add_relocation(ObjectWriter* w, SectionIndex rela, size_t offset, size_t symbol,
+                           int type, int64_t addend) {
+  ElfRela r = {offset, ((uint64_t)symbol << 32) | (uint64_t)type, addend};
+  buffer_append(&w->sections[rela], &r, sizeof(r));
+}
+
+// The index of the symbol for |name|, which is added as undefined if it
+// wasn't defined by the file.
+static size_t symbol_index(ObjectWriter* w, char* name) {
+  size_t index = (size_t)hashmap_get(&w->symbol_indices, name);
+  if (index)
+    return index - 1;
+
+  // Compiler runtime helpers (see link.c) are libgcc's functions of the same
+  // name, less the prefix.
+  char* elf_name = name;
+  if (strncmp(name, "__dyibicc_", 10) == 0)
+    elf_name = format(AL_Compile, "__%s", name + 10);
+  add_symbol(w, elf_name, ELF_STB_GLOBAL, ELF_STT_NOTYPE, 0, 0, 0);
+  index = w->symbols.len / sizeof(ElfSymbol) - 1;
+  hashmap_put(&w->symbol_indices, name, (void*)(index + 1));
+  return index;
+}
+
+static SectionIndex data_section(DataObject* obj) {
+  if (!obj->init_data)
+    return obj->is_rodata ? SEC_RODATA : SEC_BSS;
+  if (!obj->is_rodata)
+    return SEC_DATA;
+  return obj->num_relocs ? SEC_RELRO : SEC_RODATA;
+}
+
+// Rewrites the 10 byte `mov64 reg, imm64` whose immediate is at |ref| as
+// `lea reg, [rip+disp32]` followed by a 3 byte nop, and returns the offset of
+// the displacement from |ref|. Returns -1 if it's not the expected mov64.
+static int rewrite_slot_load(unsigned char* ref) {
+  unsigned char* mov = ref - 2;
+  if ((mov[0] & 0xfe) != 0x48 || (mov[1] & 0xf8) != 0xb8)
+    return -1;
+  // The register is in the opcode for mov, and in ModRM.reg for lea, so the
+  // REX.B bit moves to REX.R.
+  unsigned char rex = (unsigned char)(0x48 | ((mov[0] & 1) << 2));
+  unsigned char modrm = (unsigned char)(0x05 | ((mov[1] & 7) << 3));
+  unsigned char lea[10] = {rex, 0x8d, modrm, 0, 0, 0, 0, 0x0f, 0x1f, 0x00};
+  memcpy(mov, lea, sizeof(lea));
+  return 1;
+}
+
+static bool write_elf(ObjectWriter* w, char* path) {
+  static const struct {
+    char* name;
+    uint32_t type;
+    uint64_t flags;
+    uint32_t link;
+    uint32_t info;
+    uint64_t entsize;
+  } headers[NUM_SECTIONS] = {
+      [SEC_TEXT] = {".text", ELF_SHT_PROGBITS, ELF_SHF_ALLOC | ELF_SHF_EXECINSTR},
+      [SEC_DATA] = {".data", ELF_SHT_PROGBITS, ELF_SHF_ALLOC | ELF_SHF_WRITE},
+      [SEC_BSS] = {".bss", ELF_SHT_NOBITS, ELF_SHF_ALLOC | ELF_SHF_WRITE},
+      [SEC_RODATA] = {".rodata", ELF_SHT_PROGBITS, ELF_SHF_ALLOC},
+      [SEC_RELRO] = {".data.rel.ro", ELF_SHT_PROGBITS, ELF_SHF_ALLOC | ELF_SHF_WRITE},
+      [SEC_RELA_TEXT] = {".rela.text", ELF_SHT_RELA, ELF_SHF_INFO_LINK, SEC_SYMTAB, SEC_TEXT,
+                         sizeof(ElfRela)},
+      [SEC_RELA_DATA] = {".rela.data", ELF_SHT_RELA, ELF_SHF_INFO_LINK, SEC_SYMTAB, SEC_DATA,
+                         sizeof(ElfRela)},
+      [SEC_RELA_RELRO] = {".rela.data.rel.ro", ELF_SHT_RELA, ELF_SHF_INFO_LINK, SEC_SYMTAB,
+                          SEC_RELRO, sizeof(ElfRela)},
+      [SEC_SYMTAB] = {".symtab", ELF_SHT_SYMTAB, 0, SEC_STRTAB, 0, sizeof(ElfSymbol)},
+      [SEC_STRTAB] = {".strtab", ELF_SHT_STRTAB},
+      [SEC_SHSTRTAB] = {".shstrtab", ELF_SHT_STRTAB},
+      // Otherwise the linker assumes the stack needs to be executable.
+      [SEC_NOTE_GNU_STACK] = {".note.GNU-stack", ELF_SHT_PROGBITS},
+  };
+
+  ElfSectionHeader shdrs[NUM_SECTIONS] = {0};
+  Buffer* shstrtab = &w->sections[SEC_SHSTRTAB];
+  buffer_append(shstrtab, NULL, 1);
+  for (int i = 1; i < NUM_SECTIONS; ++i) {
+    shdrs[i].name = add_string(shstrtab, headers[i].name);
+  }
+  w->sections[SEC_SYMTAB] = w->symbols;
+  w->alignments[SEC_SYMTAB] = 8;
+  w->sections[SEC_STRTAB] = w->strtab;
+
+  Buffer out = {0};
+  buffer_append(&out, NULL, sizeof(ElfHeader));
+  for (int i = 1; i < NUM_SECTIONS; ++i) {
+    int align = MAX(w->alignments[i], 1);
+    if (headers[i].type == ELF_SHT_RELA)
+      align = 8;
+    buffer_align(&out, align);
+    shdrs[i].type = headers[i].type;
+    shdrs[i].flags = headers[i].flags;
+    shdrs[i].offset = out.len;
+    shdrs[i].size = w->sections[i].len;
+    shdrs[i].link = headers[i].link;
+    shdrs[i].info = headers[i].info;
+    shdrs[i].addralign = align;
+    shdrs[i].entsize = headers[i].entsize;
+    if (headers[i].type != ELF_SHT_NOBITS)
+      buffer_append(&out, w->sections[i].data, w->sections[i].len);
+  }
+
+  // Local symbols are all first, see write_object_file().
+  ElfSymbol* syms = (ElfSymbol*)w->symbols.data;
+  uint32_t first_global = 0;
+  while (first_global < w->symbols.len / sizeof(ElfSymbol) &&
+         (syms[first_global].info >> 4) == ELF_STB_LOCAL) {
+    ++first_global;
+  }
+  shdrs[SEC_SYMTAB].info = first_global;
+
+  buffer_align(&out, 8);
+  size_t shoff = buffer_append(&out, shdrs, sizeof(shdrs));
+
+  ElfHeader* eh = (ElfHeader*)out.data;
+  memcpy(eh->ident, "\x7f" "ELF\x02\x01\x01", 7);
+  eh->type = 1;      // ET_REL
+  eh->machine = 62;  // EM_X86_64
+  eh->version = 1;
+  eh->shoff = shoff;
+  eh->ehsize = sizeof(ElfHeader);
+  eh->shentsize = sizeof(ElfSectionHeader);
+  eh->shnum = NUM_SECTIONS;
+  eh->shstrndx = SEC_SHSTRTAB;
+
+  bool ok = false;
+  FILE* fp = fopen(path, "wb");
+  if (fp) {
+    ok = fwrite(out.data, 1, out.len, fp) == out.len;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok)
+      remove(path);
+  }
+  free(out.data);
+  return ok;
+}
+
+// Writes the code and data of file |file_index|, as of its most recent update,
+// to |path| as an object file. Data has its initial values. Returns false if
+// the file has code that can't be moved out of this process (including lazy
+// functions' stubs), or if |path| can't be written.
+IMPLSTATIC bool write_object_file(size_t file_index, char* path) {
+  FileLinkData* fld = &user_context->files[file_index];
+  if (fld->lazy)
+    return false;
+  for (int i = 0; i < fld->num_functions; ++i) {
+    if (fld->functions[i].is_process_specific || fld->functions[i].profile_counts)
+      return false;
+  }
+
+  ObjectWriter w = {0};
+  buffer_append(&w.strtab, NULL, 1);
+  for (int i = SEC_TEXT; i <= SEC_RELRO; ++i) {
+    w.alignments[i] = 1;
+  }
+
+  // Each chunk is copied as is, as code within it may be relative to the
+  // chunk's alignment.
+  size_t* chunk_offsets = calloc(fld->num_chunks + 1, sizeof(size_t));
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    buffer_align(&w.sections[SEC_TEXT], 64);
+    chunk_offsets[i] = buffer_append(&w.sections[SEC_TEXT], fld->chunks[i].base_address,
+                                     fld->chunks[i].code_size);
+  }
+  w.alignments[SEC_TEXT] = 64;
+
+  size_t* data_offsets = calloc(fld->num_data_objects + 1, sizeof(size_t));
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    SectionIndex sec = data_section(obj);
+    buffer_align(&w.sections[sec], obj->align);
+    data_offsets[i] = buffer_append(&w.sections[sec], obj->init_data, obj->size);
+    w.alignments[sec] = MAX(w.alignments[sec], obj->align);
+  }
+
+  // Section symbols, then the file's own symbols, statics first as all local
+  // symbols have to precede global ones.
+  buffer_append(&w.symbols, NULL, sizeof(ElfSymbol));
+  for (int i = SEC_TEXT; i <= SEC_RELRO; ++i) {
+    ElfSymbol sym = {0, ELF_STT_SECTION, 0, (uint16_t)i, 0, 0};
+    buffer_append(&w.symbols, &sym, sizeof(sym));
+  }
+  for (int pass = 0; pass < 2; ++pass) {
+    bool want_static = pass == 0;
+    int bind = want_static ? ELF_STB_LOCAL : ELF_STB_GLOBAL;
+    for (int i = 0; i < fld->num_functions; ++i) {
+      FunctionCode* fc = &fld->functions[i];
+      if (fc->is_static != want_static)
+        continue;
+      int chunk = 0;
+      while (fc->address < fld->chunks[chunk].base_address ||
+             fc->address >= fld->chunks[chunk].base_address + fld->chunks[chunk].size) {
+        ++chunk;
+      }
+      add_symbol(&w, fc->name, bind, ELF_STT_FUNC, SEC_TEXT,
+                 chunk_offsets[chunk] + (fc->address - fld->chunks[chunk].base_address), fc->size);
+    }
+    for (int i = 0; i < fld->num_data_objects; ++i) {
+      DataObject* obj = &fld->data_objects[i];
+      if (obj->is_static != want_static)
+        continue;
+      add_symbol(&w, obj->name, bind, ELF_STT_OBJECT, data_section(obj), data_offsets[i],
+                 obj->size);
+    }
+  }
+
+  bool ok = true;
+
+  // Pointers in data initializers.
+  for (int i = 0; i < fld->num_data_objects; ++i) {
+    DataObject* obj = &fld->data_objects[i];
+    SectionIndex rela = data_section(obj) == SEC_DATA ? SEC_RELA_DATA : SEC_RELA_RELRO;
+    for (int j = 0; j < obj->num_relocs; ++j) {
+      DataReloc* dr = &obj->relocs[j];
+      size_t offset = data_offsets[i] + dr->offset;
+      if (dr->name) {
+        add_relocation(&w, rela, offset, symbol_index(&w, dr->name), ELF_R_X86_64_64, dr->addend);
+      } else if (fld->num_chunks == 1) {
+        // A label in the code emitted with the data.
+        add_relocation(&w, rela, offset, SEC_TEXT, ELF_R_X86_64_64,
+                       (int64_t)chunk_offsets[0] + dr->code_offset + dr->addend);
+      } else {
+        ok = false;
+      }
+    }
+  }
+
+  // The slot table, and the references to it from the code.
+  HashMap slot_offsets = {0};
+  unsigned char* text = (unsigned char*)w.sections[SEC_TEXT].data;
+  buffer_align(&w.sections[SEC_DATA], 8);
+  w.alignments[SEC_DATA] = MAX(w.alignments[SEC_DATA], 8);
+  for (int i = 0; i < fld->num_functions && ok; ++i) {
+    FunctionCode* fc = &fld->functions[i];
+    int chunk = 0;
+    while (fc->address < fld->chunks[chunk].base_address ||
+           fc->address >= fld->chunks[chunk].base_address + fld->chunks[chunk].size) {
+      ++chunk;
+    }
+    for (int j = 0; j < fc->num_slot_refs && ok; ++j) {
+      // The code holds the address of the slot, which knows its name.
+      SymbolSlot* slot;
+      memcpy(&slot, fc->slot_refs[j], sizeof(slot));
+      size_t slot_offset = (size_t)hashmap_get(&slot_offsets, slot->name);
+      if (!slot_offset) {
+        slot_offset = buffer_append(&w.sections[SEC_DATA], NULL, sizeof(void*)) + 1;
+        hashmap_put(&slot_offsets, slot->name, (void*)slot_offset);
+        add_relocation(&w, SEC_RELA_DATA, slot_offset - 1, symbol_index(&w, slot->name),
+                       ELF_R_X86_64_64, 0);
+      }
+
+      size_t ref = chunk_offsets[chunk] + (fc->slot_refs[j] - fld->chunks[chunk].base_address);
+      int disp = rewrite_slot_load(text + ref);
+      if (disp < 0) {
+        ok = false;
+        break;
+      }
+      add_relocation(&w, SEC_RELA_TEXT, ref + disp, SEC_DATA, ELF_R_X86_64_PC32,
+                     (int64_t)(slot_offset - 1) - 4);
+    }
+  }
+
+  ok = ok && write_elf(&w, path);
+
+  for (int i = 0; i < NUM_SECTIONS; ++i) {
+    if (i != SEC_SYMTAB && i != SEC_STRTAB)
+      free(w.sections[i].data);
+  }
+  free(w.symbols.data);
+  free(w.strtab.data);
+  free(chunk_offsets);
+  free(data_offsets);
+  return ok;
+}
+
+// For code that wasn't compiled by this process, but loaded from the cache or an
+// image, as register_jit_code() and perf_record_code() for each chunk. There's
+// no line info for it. Only code that's never lazy or tiered can be saved, so
+// each function's frame is set up at its entry.
+IMPLSTATIC void register_loaded_code(size_t file_index) {
+  FileLinkData* fld = &user_context->files[file_index];
+  JitCode* code = bumpcalloc(fld->num_functions + 1, sizeof(JitCode), AL_Compile);
+  for (int i = 0; i < fld->num_chunks; ++i) {
+    CodeChunk* chunk = &fld->chunks[i];
+    int n = 0;
+    for (int j = 0; j < fld->num_functions; ++j) {
+      FunctionCode* fc = &fld->functions[j];
+      if (fc->address >= chunk->base_address && fc->address < chunk->base_address + chunk->size)
+        code[n++] = (JitCode){fc->name, fc->address, fc->size, 0, -1, NULL, 0, NULL, 0};
+    }
+    if (n > 0) {
+      perf_record_code(code, n);
+      register_jit_code(code, n, chunk->base_address, chunk->code_size, fld->source_name);
+    }
+  }
+}
+
+// Describing compiled code to the rest of the process. After each file or
+// lazy function is compiled, its unwind info is registered with the unwinder
+// (__register_frame()), and with generate_debug_symbols, a debug object is
+// registered through gdb's JIT interface (see "JIT Compilation Interface" in
+// gdb's manual). The debug object is a small ELF object with a symbol for each
+// function, its lines in .debug_line, and .eh_frame so that debuggers can
+// unwind through it. It has no code itself, .text only says where it is.
+
+#if defined(__linux__)
+
+#include <pthread.h>
+
+enum {
+  DW_TAG_compile_unit = 0x11,
+  DW_CHILDREN_no = 0,
+  DW_AT_name = 0x03,
+  DW_AT_stmt_list = 0x10,
+  DW_AT_low_pc = 0x11,
+  DW_AT_high_pc = 0x12,
+  DW_FORM_addr = 0x01,
+  DW_FORM_data4 = 0x06,
+  DW_FORM_string = 0x08,
+
+  DW_LNS_copy = 1,
+  DW_LNS_advance_pc = 2,
+  DW_LNS_advance_line = 3,
+  DW_LNS_set_file = 4,
+  DW_LNE_end_sequence = 1,
+  DW_LNE_set_address = 2,
+
+  DW_CFA_nop = 0x00,
+  DW_CFA_advance_loc1 = 0x02,
+  DW_CFA_advance_loc2 = 0x03,
+  DW_CFA_advance_loc4 = 0x04,
+  DW_CFA_def_cfa = 0x0c,
+  DW_CFA_def_cfa_register = 0x0d,
+  DW_CFA_def_cfa_offset = 0x0e,
+  DW_CFA_advance_loc = 0x40,
+  DW_CFA_offset = 0x80,
+  DW_CFA_restore = 0xc0,
+
+  DW_EH_PE_absptr = 0x00,
+  DW_EH_PE_udata4 = 0x03,
+  DW_EH_PE_textrel = 0x20,
+
+  DWARF_REG_RBP = 6,
+  DWARF_REG_RSP = 7,
+  DWARF_REG_RA = 16,
+
+  ELF_SHN_ABS = 0xfff1,
+  ELF_STT_FILE = 4,
+};
+
+static void dwarf_u8(Buffer* b, uint8_t v) {
+  buffer_append(b, &v, sizeof(v));
+}
+
+static void dwarf_u16(Buffer* b, uint16_t v) {
+  buffer_append(b, &v, sizeof(v));
+}
+
+static void dwarf_u32(Buffer* b, uint32_t v) {
+  buffer_append(b, &v, sizeof(v));
+}
+
+static void dwarf_u64(Buffer* b, uint64_t v) {
+  buffer_append(b, &v, sizeof(v));
+}
+
+static void dwarf_uleb(Buffer* b, uint64_t v) {
+  do {
+    uint8_t byte = v & 0x7f;
+    v >>= 7;
+    dwarf_u8(b, (uint8_t)(byte | (v ? 0x80 : 0)));
+  } while (v);
+}
+
+static void dwarf_sleb(Buffer* b, int64_t v) {
+  for (;;) {
+    uint8_t byte = v & 0x7f;
+    v >>= 7;
+    if ((v == 0 && !(byte & 0x40)) || (v == -1 && (byte & 0x40))) {
+      dwarf_u8(b, byte);
+      return;
+    }
+    dwarf_u8(b, byte | 0x80);
+  }
+}
+
+static void dwarf_string(Buffer* b, char* s) {
+  buffer_append(b, s, strlen(s) + 1);
+}
+
+// Fills in the length of the CIE or FDE at |start| once it's complete, after
+// padding it out to 8 bytes.
+static void finish_cfi_record(Buffer* b, size_t start) {
+  while ((b->len - start) % 8)
+    dwarf_u8(b, DW_CFA_nop);
+  uint32_t len = (uint32_t)(b->len - start - 4);
+  memcpy(b->data + start, &len, sizeof(len));
+}
+
+static void put_cfa_advance(Buffer* b, uint32_t delta) {
+  if (delta == 0)
+    return;
+  if (delta < 0x40) {
+    dwarf_u8(b, (uint8_t)(DW_CFA_advance_loc | delta));
+  } else if (delta <= 0xff) {
+    dwarf_u8(b, DW_CFA_advance_loc1);
+    dwarf_u8(b, (uint8_t)delta);
+  } else if (delta <= 0xffff) {
+    dwarf_u8(b, DW_CFA_advance_loc2);
+    dwarf_u16(b, (uint16_t)delta);
+  } else {
+    dwarf_u8(b, DW_CFA_advance_loc4);
+    dwarf_u32(b, delta);
+  }
+}
+
+// Starts an FDE for |size| bytes at |address|, returning where it starts for
+// finish_cfi_record().
+static size_t put_fde_header(Buffer* b,
+                             size_t cie,
+                             char* address,
+                             size_t size,
+                             char* text_base,
+                             bool absolute) {
+  size_t fde = b->len;
+  dwarf_u32(b, 0);                         // Length.
+  dwarf_u32(b, (uint32_t)(b->len - cie));  // CIE pointer.
+  if (absolute) {
+    dwarf_u64(b, (uint64_t)address);
+    dwarf_u64(b, size);
+  } else {
+    dwarf_u32(b, (uint32_t)(address - text_base));
+    dwarf_u32(b, (uint32_t)size);
+  }
+  dwarf_uleb(b, 0);  // Augmentation data length.
+  return fde;
+}
+
+// A CIE, and FDEs for each of |code|, which all have the same frame layout:
+// nothing until the `push rbp; mov rbp, rsp` at frame_offset, and then the CFA
+// is relative to rbp until the final ret. Code in .cold is all within the
+// frame. Addresses are absolute, or relative to |text_base|.
+static void put_eh_frame(Buffer* b, JitCode* code, int num_code, char* text_base, bool absolute) {
+  size_t cie = b->len;
+  dwarf_u32(b, 0);  // Length.
+  dwarf_u32(b, 0);  // CIE id.
+  dwarf_u8(b, 1);   // Version.
+  dwarf_string(b, "zR");
+  dwarf_uleb(b, 1);   // Code alignment.
+  dwarf_sleb(b, -8);  // Data alignment.
+  dwarf_uleb(b, DWARF_REG_RA);
+  dwarf_uleb(b, 1);  // Augmentation data length.
+  dwarf_u8(b, absolute ? DW_EH_PE_absptr : (DW_EH_PE_textrel | DW_EH_PE_udata4));
+  dwarf_u8(b, DW_CFA_def_cfa);
+  dwarf_uleb(b, DWARF_REG_RSP);
+  dwarf_uleb(b, 8);
+  dwarf_u8(b, DW_CFA_offset | DWARF_REG_RA);
+  dwarf_uleb(b, 1);
+  finish_cfi_record(b, cie);
+
+  for (int i = 0; i < num_code; ++i) {
+    JitCode* jc = &code[i];
+    size_t fde = put_fde_header(b, cie, jc->address, jc->size, text_base, absolute);
+    if (jc->frame_offset >= 0) {
+      put_cfa_advance(b, jc->frame_offset + 1);
+      dwarf_u8(b, DW_CFA_def_cfa_offset);
+      dwarf_uleb(b, 16);
+      dwarf_u8(b, DW_CFA_offset | DWARF_REG_RBP);
+      dwarf_uleb(b, 2);
+      put_cfa_advance(b, 3);
+      dwarf_u8(b, DW_CFA_def_cfa_register);
+      dwarf_uleb(b, DWARF_REG_RBP);
+      if (jc->ret_offset >= 0) {
+        put_cfa_advance(b, jc->ret_offset - (jc->frame_offset + 4));
+        dwarf_u8(b, DW_CFA_def_cfa);
+        dwarf_uleb(b, DWARF_REG_RSP);
+        dwarf_uleb(b, 8);
+        dwarf_u8(b, DW_CFA_restore | DWARF_REG_RBP);
+      }
+    }
+    finish_cfi_record(b, fde);
+
+    if (jc->cold_size > 0) {
+      fde = put_fde_header(b, cie, jc->cold_address, jc->cold_size, text_base, absolute);
+      dwarf_u8(b, DW_CFA_def_cfa);
+      dwarf_uleb(b, DWARF_REG_RBP);
+      dwarf_uleb(b, 16);
+      dwarf_u8(b, DW_CFA_offset | DWARF_REG_RBP);
+      dwarf_uleb(b, 2);
+      finish_cfi_record(b, fde);
+    }
+  }
+  dwarf_u32(b, 0);  // Terminator.
+}
+
+// A DWARF 2 line table with a sequence for each of |code|.
+static void put_debug_line(Buffer* b, JitCode* code, int num_code) {
+  StringArray files = {0};
+  for (int i = 0; i < num_code; ++i) {
+    for (int j = 0; j < code[i].num_lines; ++j) {
+      bool seen = false;
+      for (int k = 0; k < files.len && !seen; ++k) {
+        seen = strcmp(files.data[k], code[i].lines[j].filename) == 0;
+      }
+      if (!seen)
+        strarray_push(&files, code[i].lines[j].filename, AL_Compile);
+    }
+  }
+
+  static const uint8_t standard_opcode_lengths[12] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+  dwarf_u32(b, 0);  // Length.
+  dwarf_u16(b, 2);  // Version.
+  size_t header_length = b->len;
+  dwarf_u32(b, 0);
+  dwarf_u8(b, 1);                                    // Minimum instruction length.
+  dwarf_u8(b, 1);                                    // default_is_stmt.
+  dwarf_u8(b, (uint8_t)-5);                          // line_base.
+  dwarf_u8(b, 14);                                   // line_range.
+  dwarf_u8(b, sizeof(standard_opcode_lengths) + 1);  // opcode_base.
+  buffer_append(b, standard_opcode_lengths, sizeof(standard_opcode_lengths));
+  dwarf_u8(b, 0);  // No include directories.
+  for (int i = 0; i < files.len; ++i) {
+    dwarf_string(b, files.data[i]);
+    dwarf_uleb(b, 0);  // Directory.
+    dwarf_uleb(b, 0);  // Modification time.
+    dwarf_uleb(b, 0);  // Length.
+  }
+  dwarf_u8(b, 0);
+  uint32_t len = (uint32_t)(b->len - header_length - 4);
+  memcpy(b->data + header_length, &len, sizeof(len));
+
+  for (int i = 0; i < num_code; ++i) {
+    JitCode* jc = &code[i];
+    if (jc->num_lines == 0)
+      continue;
+    dwarf_u8(b, 0);
+    dwarf_uleb(b, 9);
+    dwarf_u8(b, DW_LNE_set_address);
+    dwarf_u64(b, (uint64_t)jc->address);
+    char* address = jc->address;
+    int file = 1;
+    int line = 1;
+    for (int j = 0; j < jc->num_lines; ++j) {
+      JitLine* jl = &jc->lines[j];
+      if (jl->address < address)
+        continue;
+      int jl_file = 1;
+      while (strcmp(files.data[jl_file - 1], jl->filename) != 0)
+        ++jl_file;
+      if (jl_file != file) {
+        dwarf_u8(b, DW_LNS_set_file);
+        dwarf_uleb(b, jl_file);
+        file = jl_file;
+      }
+      dwarf_u8(b, DW_LNS_advance_pc);
+      dwarf_uleb(b, jl->address - address);
+      dwarf_u8(b, DW_LNS_advance_line);
+      dwarf_sleb(b, jl->line_no - line);
+      dwarf_u8(b, DW_LNS_copy);
+      address = jl->address;
+      line = jl->line_no;
+    }
+    dwarf_u8(b, DW_LNS_advance_pc);
+    dwarf_uleb(b, jc->address + jc->size - address);
+    dwarf_u8(b, 0);
+    dwarf_uleb(b, 1);
+    dwarf_u8(b, DW_LNE_end_sequence);
+  }
+
+  len = (uint32_t)(b->len - 4);
+  memcpy(b->data, &len, sizeof(len));
+}
+
+// A compile unit covering all the code, which is what refers to the lines.
+static void put_debug_info(Buffer* info,
+                           Buffer* abbrev,
+                           char* source_name,
+                           char* base_address,
+                           size_t code_size) {
+  dwarf_uleb(abbrev, 1);
+  dwarf_uleb(abbrev, DW_TAG_compile_unit);
+  dwarf_u8(abbrev, DW_CHILDREN_no);
+  dwarf_uleb(abbrev, DW_AT_name);
+  dwarf_uleb(abbrev, DW_FORM_string);
+  dwarf_uleb(abbrev, DW_AT_low_pc);
+  dwarf_uleb(abbrev, DW_FORM_addr);
+  dwarf_uleb(abbrev, DW_AT_high_pc);
+  dwarf_uleb(abbrev, DW_FORM_addr);
+  dwarf_uleb(abbrev, DW_AT_stmt_list);
+  dwarf_uleb(abbrev, DW_FORM_data4);
+  dwarf_u16(abbrev, 0);
+  dwarf_u8(abbrev, 0);
+
+  dwarf_u32(info, 0);  // Length.
+  dwarf_u16(info, 2);  // Version.
+  dwarf_u32(info, 0);  // Abbreviations offset.
+  dwarf_u8(info, 8);   // Address size.
+  dwarf_uleb(info, 1);
+  dwarf_string(info, source_name);
+  dwarf_u64(info, (uint64_t)base_address);
+  dwarf_u64(info, (uint64_t)(base_address + code_size));
+  dwarf_u32(info, 0);  // Offset of the line table.
+  uint32_t len = (uint32_t)(info->len - 4);
+  memcpy(info->data, &len, sizeof(len));
+}
+
+typedef enum {
+  DBG_TEXT = 1,
+  DBG_EH_FRAME,
+  DBG_DEBUG_INFO,
+  DBG_DEBUG_ABBREV,
+  DBG_DEBUG_LINE,
+  DBG_SYMTAB,
+  DBG_STRTAB,
+  DBG_SHSTRTAB,
+  NUM_DEBUG_SECTIONS,
+} DebugSectionIndex;
+
+static Buffer build_debug_object(JitCode* code,
+                                 int num_code,
+                                 char* base_address,
+                                 size_t code_size,
+                                 char* source_name) {
+  static const struct {
+    char* name;
+    uint32_t type;
+    uint64_t flags;
+    uint32_t link;
+    uint64_t entsize;
+  } headers[NUM_DEBUG_SECTIONS] = {
+      [DBG_TEXT] = {".text", ELF_SHT_NOBITS, ELF_SHF_ALLOC | ELF_SHF_EXECINSTR},
+      [DBG_EH_FRAME] = {".eh_frame", ELF_SHT_PROGBITS, ELF_SHF_ALLOC},
+      [DBG_DEBUG_INFO] = {".debug_info", ELF_SHT_PROGBITS},
+      [DBG_DEBUG_ABBREV] = {".debug_abbrev", ELF_SHT_PROGBITS},
+      [DBG_DEBUG_LINE] = {".debug_line", ELF_SHT_PROGBITS},
+      [DBG_SYMTAB] = {".symtab", ELF_SHT_SYMTAB, 0, DBG_STRTAB, sizeof(ElfSymbol)},
+      [DBG_STRTAB] = {".strtab", ELF_SHT_STRTAB},
+      [DBG_SHSTRTAB] = {".shstrtab", ELF_SHT_STRTAB},
+  };
+
+  Buffer sections[NUM_DEBUG_SECTIONS] = {0};
+  put_eh_frame(&sections[DBG_EH_FRAME], code, num_code, base_address, false);
+  put_debug_info(&sections[DBG_DEBUG_INFO], &sections[DBG_DEBUG_ABBREV], source_name,
+                 base_address, code_size);
+  put_debug_line(&sections[DBG_DEBUG_LINE], code, num_code);
+
+  Buffer* strtab = &sections[DBG_STRTAB];
+  Buffer* symtab = &sections[DBG_SYMTAB];
+  dwarf_u8(strtab, 0);
+  buffer_append(symtab, NULL, sizeof(ElfSymbol));
+  ElfSymbol file = {add_string(strtab, source_name), ELF_STT_FILE, 0, ELF_SHN_ABS, 0, 0};
+  buffer_append(symtab, &file, sizeof(file));
+  for (int i = 0; i < num_code; ++i) {
+    ElfSymbol sym = {add_string(strtab, code[i].name), (ELF_STB_GLOBAL << 4) | ELF_STT_FUNC, 0,
+                     DBG_TEXT, (uint64_t)(code[i].address - base_address), code[i].size};
+    buffer_append(symtab, &sym, sizeof(sym));
+    if (code[i].cold_size > 0) {
+      sym.name = add_string(strtab, format(AL_Compile, "%s.cold", code[i].name));
+      sym.value = (uint64_t)(code[i].cold_address - base_address);
+      sym.size = code[i].cold_size;
+      buffer_append(symtab, &sym, sizeof(sym));
+    }
+  }
+
+  ElfSectionHeader shdrs[NUM_DEBUG_SECTIONS] = {0};
+  dwarf_u8(&sections[DBG_SHSTRTAB], 0);
+  Buffer out = {0};
+  buffer_append(&out, NULL, sizeof(ElfHeader));
+  for (int i = 1; i < NUM_DEBUG_SECTIONS; ++i) {
+    shdrs[i].name = add_string(&sections[DBG_SHSTRTAB], headers[i].name);
+  }
+  for (int i = 1; i < NUM_DEBUG_SECTIONS; ++i) {
+    buffer_align(&out, 8);
+    shdrs[i].type = headers[i].type;
+    shdrs[i].flags = headers[i].flags;
+    shdrs[i].offset = out.len;
+    shdrs[i].size = sections[i].len;
+    shdrs[i].link = headers[i].link;
+    shdrs[i].addralign = i == DBG_TEXT ? 16 : 1;
+    shdrs[i].entsize = headers[i].entsize;
+    buffer_append(&out, sections[i].data, sections[i].len);
+    free(sections[i].data);
+  }
+  shdrs[DBG_TEXT].addr = (uint64_t)base_address;
+  shdrs[DBG_TEXT].size = code_size;
+  shdrs[DBG_SYMTAB].info = 2;  // The first global, after the null and file symbols.
+
+  buffer_align(&out, 8);
+  size_t shoff = buffer_append(&out, shdrs, sizeof(shdrs));
+
+  ElfHeader* eh = (ElfHeader*)out.data;
+  memcpy(eh->ident, "\x7f" "ELF\x02\x01\x01", 7);
+  eh->type = 1;      // ET_REL
+  eh->machine = 62;  // EM_X86_64
+  eh->version = 1;
+  eh->shoff = shoff;
+  eh->ehsize = sizeof(ElfHeader);
+  eh->shentsize = sizeof(ElfSectionHeader);
+  eh->shnum = NUM_DEBUG_SECTIONS;
+  eh->shstrndx = DBG_SHSTRTAB;
+  return out;
+}
+
+// The layout of these, and the names of the descriptor and the function that
+// gdb puts a breakpoint on, are fixed by gdb. They're weak so that there's
+// still only one of each if another JIT in the process also defines them.
+typedef enum {
+  JIT_NOACTION = 0,
+  JIT_REGISTER_FN,
+  JIT_UNREGISTER_FN,
+} JitActions;
+
+struct jit_code_entry {
+  struct jit_code_entry* next_entry;
+  struct jit_code_entry* prev_entry;
+  const char* symfile_addr;
+  uint64_t symfile_size;
+};
+
+struct jit_descriptor {
+  uint32_t version;
+  uint32_t action_flag;
+  struct jit_code_entry* relevant_entry;
+  struct jit_code_entry* first_entry;
+};
+
+void __jit_debug_register_code(void);
+extern struct jit_descriptor __jit_debug_descriptor;
+
+__attribute__((weak, noinline)) void __jit_debug_register_code(void) {
+  __asm__ volatile("");
+}
+
+__attribute__((weak)) struct jit_descriptor __jit_debug_descriptor = {1, JIT_NOACTION, NULL, NULL};
+
+void __register_frame(void* begin);
+void __deregister_frame(void* begin);
+
+// What was registered for a chunk of code, until it's freed. The gdb entries
+// are listed here too, as others' may be in the descriptor's list.
+typedef struct RegisteredCode RegisteredCode;
+struct RegisteredCode {
+  char* base_address;
+  size_t code_size;
+  JitCode* code;  // A copy of what was registered, for find_jit_code().
+  int num_code;
+  char* eh_frame;  // Registered with __register_frame().
+  bool has_debug_object;
+  struct jit_code_entry entry;  // If |has_debug_object|.
+  RegisteredCode* next;
+};
+
+static pthread_mutex_t registered_code_mutex = PTHREAD_MUTEX_INITIALIZER;
+static RegisteredCode* registered_code;
+
+// Copies |code| into a single allocation, including its names and lines: the
+// JitCodes, then all the JitLines, then the strings.
+static JitCode* copy_jit_code(JitCode* code, int num_code) {
+  size_t num_lines = 0;
+  size_t strings_size = 0;
+  for (int i = 0; i < num_code; ++i) {
+    num_lines += code[i].num_lines;
+    strings_size += strlen(code[i].name) + 1;
+    for (int j = 0; j < code[i].num_lines; ++j) {
+      if (j == 0 || code[i].lines[j].filename != code[i].lines[j - 1].filename)
+        strings_size += strlen(code[i].lines[j].filename) + 1;
+    }
+  }
+
+  JitCode* copy = malloc(num_code * sizeof(JitCode) + num_lines * sizeof(JitLine) + strings_size);
+  JitLine* lines = (JitLine*)&copy[num_code];
+  char* p = (char*)&lines[num_lines];
+  for (int i = 0; i < num_code; ++i) {
+    copy[i] = code[i];
+    copy[i].lines = lines;
+    lines += code[i].num_lines;
+    for (int j = 0; j < code[i].num_lines; ++j) {
+      copy[i].lines[j] = code[i].lines[j];
+      if (j == 0 || code[i].lines[j].filename != code[i].lines[j - 1].filename) {
+        copy[i].lines[j].filename = strcpy(p, code[i].lines[j].filename);
+        p += strlen(p) + 1;
+      } else {
+        copy[i].lines[j].filename = copy[i].lines[j - 1].filename;
+      }
+    }
+    copy[i].name = strcpy(p, code[i].name);
+    p += strlen(p) + 1;
+  }
+  return copy;
+}
+
+// Looks up the function whose code (including its .cold code) contains |pc|,
+// and the line that |pc| is in, if lines were recorded for it. The strings
+// are copied to AL_Compile, as the code may be freed at any time. Returns
+// false if |pc| isn't in any registered code.
+IMPLSTATIC bool find_jit_code(char* pc, char** name, char** filename, int* line_no) {
+  bool found = false;
+  pthread_mutex_lock(&registered_code_mutex);
+  for (RegisteredCode* rc = registered_code; rc && !found; rc = rc->next) {
+    if (pc < rc->base_address || pc >= rc->base_address + rc->code_size)
+      continue;
+    for (int i = 0; i < rc->num_code && !found; ++i) {
+      JitCode* jc = &rc->code[i];
+      bool in_cold = pc >= jc->cold_address && pc < jc->cold_address + jc->cold_size;
+      if (!in_cold && (pc < jc->address || pc >= jc->address + jc->size))
+        continue;
+      found = true;
+      *name = bumpstrdup(jc->name, AL_Compile);
+      *filename = NULL;
+      *line_no = 0;
+      char* line_address = NULL;
+      for (int j = 0; j < jc->num_lines; ++j) {
+        JitLine* jl = &jc->lines[j];
+        if (jl->address <= pc && jl->address >= line_address) {
+          line_address = jl->address;
+          *filename = jl->filename;
+          *line_no = jl->line_no;
+        }
+      }
+      if (*filename)
+        *filename = bumpstrdup(*filename, AL_Compile);
+    }
+  }
+  pthread_mutex_unlock(&registered_code_mutex);
+  return found;
+}
+
+// Registers unwind info for |code|, all of which is in the |code_size| bytes
+// at |base_address|, so that backtrace() and the like can walk through it.
+// Also registers a debug object with gdb, if generate_debug_symbols. Both last
+// until the memory is freed by free_executable_memory().
+//
+// Code before a function's frame_offset that calls out (tier 0's promotion
+// requests) isn't described, as it's only run once per function.
+IMPLSTATIC void register_jit_code(JitCode* code,
+                                  int num_code,
+                                  char* base_address,
+                                  size_t code_size,
+                                  char* source_name) {
+  RegisteredCode* rc = calloc(1, sizeof(RegisteredCode));
+  rc->base_address = base_address;
+  rc->code_size = code_size;
+  rc->code = copy_jit_code(code, num_code);
+  rc->num_code = num_code;
+
+  // libgcc's __register_frame() takes a whole .eh_frame section, up to its
+  // terminator, with absolute addresses.
+  Buffer eh_frame = {0};
+  put_eh_frame(&eh_frame, code, num_code, base_address, true);
+  rc->eh_frame = eh_frame.data;
+
+  if (user_context->generate_debug_symbols) {
+    Buffer object = build_debug_object(code, num_code, base_address, code_size, source_name);
+    rc->has_debug_object = true;
+    rc->entry.symfile_addr = object.data;
+    rc->entry.symfile_size = object.len;
+  }
+
+  pthread_mutex_lock(&registered_code_mutex);
+  __register_frame(rc->eh_frame);
+  rc->next = registered_code;
+  __atomic_store_n(&registered_code, rc, __ATOMIC_SEQ_CST);
+  if (rc->has_debug_object) {
+    struct jit_code_entry* entry = &rc->entry;
+    entry->next_entry = __jit_debug_descriptor.first_entry;
+    if (entry->next_entry)
+      entry->next_entry->prev_entry = entry;
+    __jit_debug_descriptor.first_entry = entry;
+    __jit_debug_descriptor.relevant_entry = entry;
+    __jit_debug_descriptor.action_flag = JIT_REGISTER_FN;
+    __jit_debug_register_code();
+  }
+  pthread_mutex_unlock(&registered_code_mutex);
+}
+
+IMPLSTATIC void unregister_jit_code(char* base_address) {
+  // Most freed memory was never registered.
+  if (!__atomic_load_n(&registered_code, __ATOMIC_SEQ_CST))
+    return;
+
+  pthread_mutex_lock(&registered_code_mutex);
+  RegisteredCode** prev = &registered_code;
+  while (*prev && (*prev)->base_address != base_address)
+    prev = &(*prev)->next;
+  RegisteredCode* rc = *prev;
+  if (rc) {
+    *prev = rc->next;
+    __deregister_frame(rc->eh_frame);
+    if (rc->has_debug_object) {
+      struct jit_code_entry* entry = &rc->entry;
+      if (entry->prev_entry)
+        entry->prev_entry->next_entry = entry->next_entry;
+      else
+        __jit_debug_descriptor.first_entry = entry->next_entry;
+      if (entry->next_entry)
+        entry->next_entry->prev_entry = entry->prev_entry;
+      __jit_debug_descriptor.relevant_entry = entry;
+      __jit_debug_descriptor.action_flag = JIT_UNREGISTER_FN;
+      __jit_debug_register_code();
+      free((void*)entry->symfile_addr);
+    }
+  }
+  pthread_mutex_unlock(&registered_code_mutex);
+
+  if (rc) {
+    free(rc->code);
+    free(rc->eh_frame);
+    free(rc);
+  }
+}
+
+#else  // !__linux__
+
+IMPLSTATIC void register_jit_code(JitCode* code,
+                                  int num_code,
+                                  char* base_address,
+                                  size_t code_size,
+                                  char* source_name) {
+  (void)code;
+  (void)num_code;
+  (void)base_address;
+  (void)code_size;
+  (void)source_name;
+}
+
+IMPLSTATIC void unregister_jit_code(char* base_address) {
+  (void)base_address;
+}
+
+IMPLSTATIC bool find_jit_code(char* pc, char** name, char** filename, int* line_no) {
+  (void)pc;
+  (void)name;
+  (void)filename;
+  (void)line_no;
+  return false;
+}
+
+#endif
@@ -38,6 +38,8 @@ typedef struct {
   bool is_extern;
   bool is_inline;
   bool is_tls;
+  bool is_noreturn;
+  bool is_instrumented;
   int align;
 } VarAttr;
 
@@ -93,6 +95,11 @@ static Node* expr_stmt(Token** rest, Token* tok);
 static Node* expr(Token** rest, Token* tok);
 static int64_t eval(Node* node);
 static int64_t eval2(Node* node, char*** label, int** pclabel);
+static bool eval_bool(Node* node);
+#if !X64WIN
+static __int128 eval128(Node* node);
+static int64_t eval128_compare(Node* node);
+#endif
 static int64_t eval_rval(Node* node, char*** label, int** pclabel);
 static int64_t const_expr(Token** rest, Token* tok);
 static bool is_const_expr(Node* node);
@@ -131,6 +138,8 @@ static int align_down(int n, int align) {
 static void enter_scope(void) {
   Scope* sc = bumpcalloc(1, sizeof(Scope), AL_Compile);
   sc->next = C(scope);
+  sc->sibling = C(scope)->children;
+  C(scope)->children = sc;
   C(scope) = sc;
 }
 
@@ -159,6 +168,7 @@ static Type* find_tag(Token* tok) {
 
 static Node* new_node(NodeKind kind, Token* tok) {
   Node* node = bumpcalloc(1, sizeof(Node), AL_Compile);
+  ++C(num_nodes);
   node->kind = kind;
   node->tok = tok;
   return node;
@@ -219,6 +229,7 @@ IMPLSTATIC Node* new_cast(Node* expr, Type* ty) {
   add_type(expr);
 
   Node* node = bumpcalloc(1, sizeof(Node), AL_Compile);
+  ++C(num_nodes);
   node->kind = ND_CAST;
   node->tok = expr->tok;
   node->lhs = expr;
@@ -288,6 +299,7 @@ static Obj* new_var(char* name, Type* ty) {
 static Obj* new_lvar(char* name, Type* ty) {
   Obj* var = new_var(name, ty);
   var->is_local = true;
+  var->scope = C(scope);
   var->next = C(locals);
   C(locals) = var;
   return var;
@@ -303,9 +315,40 @@ static Obj* new_gvar(char* name, Type* ty) {
 }
 
 static char* new_unique_name(void) {
+  // Within a function these are numbered independently, so that an unchanged
+  // function gets the same names even if others in the file were edited.
+  if (C(unique_name_prefix))
+    return format(AL_Compile, "L..%s..%d", C(unique_name_prefix), C(fn_unique_name_id)++);
   return format(AL_Compile, "L..%d", C(unique_name_id)++);
 }
 
+// Reserves |n| counts in the current function's profile, see profile_branches.
+// Returns 1 + the index of the first.
+static int new_profile_site(int n) {
+  int site = C(fn_profile_sites) + 1;
+  C(fn_profile_sites) += n;
+  return site;
+}
+
+// FNV-1a of the kind and text of the tokens in [begin, end).
+static uint64_t hash_tokens(uint64_t hash, Token* begin, Token* end) {
+  for (Token* tok = begin; tok != end; tok = tok->next) {
+    hash = (hash ^ (uint64_t)tok->kind) * 0x100000001b3;
+    for (int i = 0; i < tok->len; i++)
+      hash = (hash ^ (unsigned char)tok->loc[i]) * 0x100000001b3;
+  }
+  return hash;
+}
+
+// FNV-1a of the line numbers of the tokens in [begin, end), which only matter
+// for the code's line info, so aren't part of hash_tokens().
+static uint64_t hash_token_lines(Token* begin, Token* end) {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (Token* tok = begin; tok != end; tok = tok->next)
+    hash = (hash ^ (uint64_t)tok->line_no) * 0x100000001b3;
+  return hash;
+}
+
 static Obj* new_anon_gvar(Type* ty) {
   return new_gvar(new_unique_name(), ty);
 }
@@ -336,30 +379,45 @@ static void push_tag_scope(Token* tok, Type* ty) {
   hashmap_put2(&C(scope)->tags, tok->loc, tok->len, ty);
 }
 
-static bool skip_function_attributes(Token** rest, Token* tok) {
+// Skips function attributes, other than noting if one of them is `noreturn`
+// or `instrument`, in which case *is_noreturn or *is_instrumented is set (if
+// non-NULL).
+static bool skip_function_attributes(Token** rest,
+                                     Token* tok,
+                                     bool* is_noreturn,
+                                     bool* is_instrumented) {
   bool got_one = false;
   while (consume(&tok, tok, "__attribute__")) {
     got_one = true;
     tok = skip(tok, "(");
     tok = skip(tok, "(");
-    tok = tok->next;  // Skip the attribute name.
-    if (equal(tok, "(")) {
-      // If it's function-like, ignore all the details, but balance parens.
-      tok = skip(tok, "(");
-      int count = 1;
-      while (tok) {
-        if (consume(&tok, tok, "(")) {
-          ++count;
-          continue;
-        }
-        if (consume(&tok, tok, ")")) {
-          --count;
-          if (count == 0) {
-            break;
+    // A comma separated list, e.g. __attribute__((cold, noreturn)).
+    for (bool first = true; !equal(tok, ")"); first = false) {
+      if (!first)
+        tok = skip(tok, ",");
+      if (is_noreturn && (equal(tok, "noreturn") || equal(tok, "__noreturn__")))
+        *is_noreturn = true;
+      if (is_instrumented && (equal(tok, "instrument") || equal(tok, "__instrument__")))
+        *is_instrumented = true;
+      tok = tok->next;  // Skip the attribute name.
+      if (equal(tok, "(")) {
+        // If it's function-like, ignore all the details, but balance parens.
+        tok = skip(tok, "(");
+        int count = 1;
+        while (tok) {
+          if (consume(&tok, tok, "(")) {
+            ++count;
+            continue;
           }
-          continue;
+          if (consume(&tok, tok, ")")) {
+            --count;
+            if (count == 0) {
+              break;
+            }
+            continue;
+          }
+          tok = tok->next;
         }
-        tok = tok->next;
       }
     }
     tok = skip(tok, ")");
@@ -370,7 +428,7 @@ static bool skip_function_attributes(Token** rest, Token* tok) {
   return got_one;
 }
 
-// declspec = ("void" | "_Bool" | "char" | "short" | "int" | "long"
+// declspec = ("void" | "_Bool" | "char" | "short" | "int" | "long" | "__int128"
 //             | "typedef" | "static" | "extern" | "inline"
 //             | "_Thread_local" | "__thread"
 //             | "signed" | "unsigned"
@@ -404,6 +462,8 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr) {
     LONG = 1 << 10,
 #if X64WIN
     INT64 = 1 << 12,
+#else
+    INT128 = 1 << 12,
 #endif
     FLOAT = 1 << 14,
     DOUBLE = 1 << 16,
@@ -448,11 +508,18 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr) {
     if (consume(&tok, tok, "const") || consume(&tok, tok, "volatile") ||
         consume(&tok, tok, "auto") || consume(&tok, tok, "register") ||
         consume(&tok, tok, "restrict") || consume(&tok, tok, "__restrict") ||
-        consume(&tok, tok, "__restrict__") || consume(&tok, tok, "_Noreturn")) {
+        consume(&tok, tok, "__restrict__")) {
       continue;
     }
 
-    if (skip_function_attributes(&tok, tok)) {
+    if (consume(&tok, tok, "_Noreturn")) {
+      if (attr)
+        attr->is_noreturn = true;
+      continue;
+    }
+
+    if (skip_function_attributes(&tok, tok, attr ? &attr->is_noreturn : NULL,
+                                 attr ? &attr->is_instrumented : NULL)) {
       continue;
     }
 
@@ -519,6 +586,9 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr) {
 #if X64WIN
     else if (equal(tok, "__int64"))
       counter += INT64;
+#else
+    else if (equal(tok, "__int128"))
+      counter += INT128;
 #endif
     else if (equal(tok, "float"))
       counter += FLOAT;
@@ -611,6 +681,13 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr) {
       case UNSIGNED + LONG + LONG + INT:
         ty = ty_ulong;
         break;
+      case INT128:
+      case SIGNED + INT128:
+        ty = ty_int128;
+        break;
+      case UNSIGNED + INT128:
+        ty = ty_uint128;
+        break;
 #endif
       case FLOAT:
         ty = ty_float;
@@ -641,9 +718,15 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr) {
 // param       = declspec declarator
 static Type* func_params(Token** rest, Token* tok, Type* ty) {
   if (equal(tok, "void") && equal(tok->next, ")")) {
-    bool skipped_func_attrib = skip_function_attributes(&tok, tok->next->next);
+    bool is_noreturn = false;
+    bool is_instrumented = false;
+    bool skipped_func_attrib =
+        skip_function_attributes(&tok, tok->next->next, &is_noreturn, &is_instrumented);
     *rest = skipped_func_attrib ? tok : tok->next->next;
-    return func_type(ty);
+    ty = func_type(ty);
+    ty->is_noreturn = is_noreturn;
+    ty->is_instrumented = is_instrumented;
+    return ty;
   }
 
   Type head = {0};
@@ -687,11 +770,16 @@ static Type* func_params(Token** rest, Token* tok, Type* ty) {
   if (cur == &head)
     is_variadic = true;
 
-  bool skipped_func_attrib = skip_function_attributes(&tok, tok->next);
+  bool is_noreturn = false;
+  bool is_instrumented = false;
+  bool skipped_func_attrib =
+      skip_function_attributes(&tok, tok->next, &is_noreturn, &is_instrumented);
 
   ty = func_type(ty);
   ty->params = head.next;
   ty->is_variadic = is_variadic;
+  ty->is_noreturn = is_noreturn;
+  ty->is_instrumented = is_instrumented;
   *rest = skipped_func_attrib ? tok : tok->next;
   return ty;
 }
@@ -892,7 +980,12 @@ static Node* compute_vla_size(Type* ty, Token* tok) {
   else
     base_sz = new_num(ty->base->size, tok);
 
+  // The type can outlive the block (e.g. a typedef, whose size is computed
+  // where it's first used), so the size goes in the function's outermost
+  // scope, where no sibling block's locals can share its slot.
   ty->vla_size = new_lvar("", ty_ulong);
+  if (C(current_fn))
+    ty->vla_size->scope = C(current_fn)->scope;
   Node* expr = new_binary(ND_ASSIGN, new_var_node(ty->vla_size, tok),
                           new_binary(ND_MUL, ty->vla_len, base_sz, tok), tok);
   return new_binary(ND_COMMA, node, expr, tok);
@@ -1475,7 +1568,7 @@ static uint64_t read_buf(char* buf, int sz) {
     return *(uint16_t*)buf;
   if (sz == 4)
     return *(uint32_t*)buf;
-  if (sz == 8)
+  if (sz == 8 || sz == 16)
     return *(uint64_t*)buf;
   unreachable();
 }
@@ -1544,6 +1637,14 @@ static Relocation* write_gvar_data(Relocation* cur,
     return cur;
   }
 
+#if !X64WIN
+  if (ty->kind == TY_INT128) {
+    __int128 val = eval128(init->expr);
+    memcpy(buf + offset, &val, sizeof(val));
+    return cur;
+  }
+#endif
+
   char** label = NULL;
   int* pc_label = NULL;
   uint64_t val = eval2(init->expr, &label, &pc_label);
@@ -1615,6 +1716,8 @@ static bool is_typename(Token* tok) {
       "__attribute__",
 #if X64WIN
       "__int64",
+#else
+      "__int128",
 #endif
     };
 
@@ -1676,6 +1779,7 @@ static Node* stmt(Token** rest, Token* tok) {
 
   if (equal(tok, "if")) {
     Node* node = new_node(ND_IF, tok);
+    node->profile_site = new_profile_site(2);
     tok = skip(tok->next, "(");
     node->cond = expr(&tok, tok);
     tok = skip(tok, ")");
@@ -1712,6 +1816,7 @@ static Node* stmt(Token** rest, Token* tok) {
       error_tok(tok, "stray case");
 
     Node* node = new_node(ND_CASE, tok);
+    node->profile_site = new_profile_site(1);
     int begin = (int)const_expr(&tok, tok->next);
     int end;
 
@@ -1740,6 +1845,7 @@ static Node* stmt(Token** rest, Token* tok) {
       error_tok(tok, "stray default");
 
     Node* node = new_node(ND_CASE, tok);
+    node->profile_site = new_profile_site(1);
     tok = skip(tok->next, ":");
     node->label = new_unique_name();
     node->pc_label = codegen_pclabel();
@@ -1750,6 +1856,7 @@ static Node* stmt(Token** rest, Token* tok) {
 
   if (equal(tok, "for")) {
     Node* node = new_node(ND_FOR, tok);
+    node->profile_site = new_profile_site(1);
     tok = skip(tok->next, "(");
 
     enter_scope();
@@ -1786,6 +1893,7 @@ static Node* stmt(Token** rest, Token* tok) {
 
   if (equal(tok, "while")) {
     Node* node = new_node(ND_FOR, tok);
+    node->profile_site = new_profile_site(1);
     tok = skip(tok->next, "(");
     node->cond = expr(&tok, tok);
     tok = skip(tok, ")");
@@ -1804,6 +1912,7 @@ static Node* stmt(Token** rest, Token* tok) {
 
   if (equal(tok, "do")) {
     Node* node = new_node(ND_DO, tok);
+    node->profile_site = new_profile_site(1);
 
     int brk_pc = C(brk_pc_label);
     int cont_pc = C(cont_pc_label);
@@ -1943,6 +2052,95 @@ static Node* expr(Token** rest, Token* tok) {
   return node;
 }
 
+#if !X64WIN
+// Evaluates a constant expression of type __int128, or one that's converted to
+// it, to all 128 bits. Anything narrower is evaluated by eval() and extended.
+static __int128 eval128(Node* node) {
+  add_type(node);
+
+  if (is_flonum(node->ty))
+    return (__int128)eval_double(node);
+  if (node->ty->kind != TY_INT128) {
+    int64_t val = eval(node);
+    return node->ty->is_unsigned ? (__int128)(uint64_t)val : (__int128)val;
+  }
+
+  bool is_unsigned = node->ty->is_unsigned;
+  switch (node->kind) {
+    case ND_ADD:
+      return (unsigned __int128)eval128(node->lhs) + (unsigned __int128)eval128(node->rhs);
+    case ND_SUB:
+      return (unsigned __int128)eval128(node->lhs) - (unsigned __int128)eval128(node->rhs);
+    case ND_MUL:
+      return (unsigned __int128)eval128(node->lhs) * (unsigned __int128)eval128(node->rhs);
+    case ND_DIV:
+    case ND_MOD: {
+      __int128 lhs = eval128(node->lhs);
+      __int128 rhs = eval128(node->rhs);
+      if (rhs == 0)
+        error_tok(node->tok, "division by zero");
+      if (is_unsigned) {
+        return node->kind == ND_DIV ? (unsigned __int128)lhs / (unsigned __int128)rhs
+                                    : (unsigned __int128)lhs % (unsigned __int128)rhs;
+      }
+      return node->kind == ND_DIV ? lhs / rhs : lhs % rhs;
+    }
+    case ND_NEG:
+      return -(unsigned __int128)eval128(node->lhs);
+    case ND_BITAND:
+      return eval128(node->lhs) & eval128(node->rhs);
+    case ND_BITOR:
+      return eval128(node->lhs) | eval128(node->rhs);
+    case ND_BITXOR:
+      return eval128(node->lhs) ^ eval128(node->rhs);
+    case ND_BITNOT:
+      return ~eval128(node->lhs);
+    case ND_SHL:
+      return (unsigned __int128)eval128(node->lhs) << (eval(node->rhs) & 127);
+    case ND_SHR:
+      if (is_unsigned)
+        return (unsigned __int128)eval128(node->lhs) >> (eval(node->rhs) & 127);
+      return eval128(node->lhs) >> (eval(node->rhs) & 127);
+    case ND_COND:
+      return eval_bool(node->cond) ? eval128(node->then) : eval128(node->els);
+    case ND_COMMA:
+      return eval128(node->rhs);
+    case ND_CAST:
+      return eval128(node->lhs);
+    case ND_NUM:
+      return is_unsigned ? (__int128)(uint64_t)node->val : (__int128)node->val;
+  }
+
+  error_tok(node->tok, "not a compile-time constant");
+}
+
+static int64_t eval128_compare(Node* node) {
+  __int128 lhs = eval128(node->lhs);
+  __int128 rhs = eval128(node->rhs);
+  bool is_unsigned = node->lhs->ty->is_unsigned;
+  switch (node->kind) {
+    case ND_EQ:
+      return lhs == rhs;
+    case ND_NE:
+      return lhs != rhs;
+    case ND_LT:
+      return is_unsigned ? (unsigned __int128)lhs < (unsigned __int128)rhs : lhs < rhs;
+    case ND_LE:
+      return is_unsigned ? (unsigned __int128)lhs <= (unsigned __int128)rhs : lhs <= rhs;
+  }
+  unreachable();
+}
+#endif
+
+static bool eval_bool(Node* node) {
+#if !X64WIN
+  add_type(node);
+  if (node->ty->kind == TY_INT128)
+    return eval128(node) != 0;
+#endif
+  return eval(node) != 0;
+}
+
 static int64_t eval(Node* node) {
   return eval2(node, NULL, NULL);
 }
@@ -1959,6 +2157,16 @@ static int64_t eval2(Node* node, char*** label, int** pclabel) {
   if (is_flonum(node->ty))
     return (int64_t)eval_double(node);
 
+#if !X64WIN
+  // Conversions to 64 bits or less truncate, and comparisons of __int128s
+  // give an int, so only their operands need all 128 bits.
+  if (node->ty->kind == TY_INT128)
+    return (int64_t)eval128(node);
+  if ((node->kind == ND_EQ || node->kind == ND_NE || node->kind == ND_LT || node->kind == ND_LE) &&
+      node->lhs->ty->kind == TY_INT128)
+    return eval128_compare(node);
+#endif
+
   switch (node->kind) {
     case ND_ADD:
       return eval2(node->lhs, label, pclabel) + eval(node->rhs);
@@ -2009,18 +2217,18 @@ static int64_t eval2(Node* node, char*** label, int** pclabel) {
         return (int64_t)((uint64_t)eval(node->lhs) <= (uint64_t)eval(node->rhs));
       return (int64_t)(eval(node->lhs) <= eval(node->rhs));
     case ND_COND:
-      return eval(node->cond) ? eval2(node->then, label, pclabel)
+      return eval_bool(node->cond) ? eval2(node->then, label, pclabel)
                               : eval2(node->els, label, pclabel);
     case ND_COMMA:
       return eval2(node->rhs, label, pclabel);
     case ND_NOT:
-      return !eval(node->lhs);
+      return !eval_bool(node->lhs);
     case ND_BITNOT:
       return ~eval(node->lhs);
     case ND_LOGAND:
-      return eval(node->lhs) && eval(node->rhs);
+      return eval_bool(node->lhs) && eval_bool(node->rhs);
     case ND_LOGOR:
-      return eval(node->lhs) || eval(node->rhs);
+      return eval_bool(node->lhs) || eval_bool(node->rhs);
     case ND_CAST: {
       int64_t val = eval2(node->lhs, label, pclabel);
       if (is_integer(node->ty)) {
@@ -3224,6 +3432,8 @@ static char* get_reflect_builtin_mangled_name(Type* ty) {
       return ty->is_unsigned ? "j" : "i";
     case TY_LONG:
       return ty->is_unsigned ? "m" : "l";
+    case TY_INT128:
+      return ty->is_unsigned ? "o" : "n";
     case TY_FLOAT:
       return "f";
     case TY_DOUBLE:
@@ -3255,6 +3465,8 @@ static char* get_reflect_builtin_user_name_impl(Type* ty) {
 #else
     case TY_LONG:
       return ty->is_unsigned ? "unsigned long" : "long";
+    case TY_INT128:
+      return ty->is_unsigned ? "unsigned __int128" : "__int128";
 #endif
     case TY_FLOAT:
       return "float";
@@ -3272,7 +3484,7 @@ static char* get_reflect_builtin_user_name_impl(Type* ty) {
 // Returns mangled name for the given type, string is either rodata or
 // AL_Compile.
 static char* build_reflect_mangled_name(Type* ty) {
-  if (ty->kind <= TY_LDOUBLE) {
+  if (ty->kind <= TY_LDOUBLE || ty->kind == TY_INT128) {
     return get_reflect_builtin_mangled_name(ty);
   }
 
@@ -3307,7 +3519,7 @@ static char* build_reflect_mangled_name(Type* ty) {
 }
 
 static char* build_reflect_user_name_left(Type* ty) {
-  if (ty->kind <= TY_LDOUBLE) {
+  if (ty->kind <= TY_LDOUBLE || ty->kind == TY_INT128) {
     return get_reflect_builtin_user_name_impl(ty);
   }
 
@@ -3394,7 +3606,7 @@ static _ReflectType* get_reflect_type(Type* ty) {
   // 'typedesc' branch.
 
   _ReflectType rtype = build_reflect_base_fields(ty);
-  if (ty->kind <= TY_LDOUBLE) {
+  if (ty->kind <= TY_LDOUBLE || ty->kind == TY_INT128) {
     rtype.name = get_reflect_builtin_user_name_impl(ty);
   } else if (ty->kind == TY_PTR) {
     rtype.name = bumpstrdup(build_reflect_user_name(ty), AL_UserContext);
@@ -3464,6 +3676,7 @@ static _ReflectType* get_reflect_type(Type* ty) {
 //         | "_Generic" generic-selection
 //         | "__builtin_types_compatible_p" "(" type-name, type-name, ")"
 //         | "__builtin_reg_class" "(" type-name ")"
+//         | "__builtin_expect" "(" assign "," const-expr ")"
 //         | ident
 //         | str
 //         | num
@@ -3512,7 +3725,11 @@ static Node* primary(Token** rest, Token* tok) {
       ty = node->ty;
     }
     *rest = skip(tok, ")");
-    Node* ret = new_reflect_type_ptr(get_reflect_type(ty), tok);
+    // The reflection types are shared by all files.
+    mutex_lock(user_context->compile_mutex);
+    _ReflectType* rtype = get_reflect_type(ty);
+    mutex_unlock(user_context->compile_mutex);
+    Node* ret = new_reflect_type_ptr(rtype, tok);
     ret->ty = pointer_to(ty_void);
     return ret;
   }
@@ -3561,6 +3778,15 @@ static Node* primary(Token** rest, Token* tok) {
     return new_num(2, start);
   }
 
+  if (equal(tok, "__builtin_expect")) {
+    tok = skip(tok->next, "(");
+    Node* node = new_cast(assign(&tok, tok), ty_long);
+    tok = skip(tok, ",");
+    node->branch_hint = const_expr(&tok, tok) ? 1 : -1;
+    *rest = skip(tok, ")");
+    return node;
+  }
+
   if (equal(tok, "__builtin_compare_and_swap")) {
     Node* node = new_node(ND_CAS, tok);
     tok = skip(tok->next, "(");
@@ -3723,9 +3949,12 @@ static void mark_live(Obj* var) {
 }
 
 static Token* function(Token* tok, Type* basety, VarAttr* attr) {
+  double trace_start = trace_begin();
   Type* ty = declarator(&tok, tok, basety);
   if (!ty->name)
     error_tok(ty->name_pos, "function name omitted");
+  if (attr->is_noreturn)
+    ty->is_noreturn = true;
   char* name_str = get_ident(ty->name);
 
   Obj* fn = find_func(name_str);
@@ -3747,13 +3976,21 @@ static Token* function(Token* tok, Type* basety, VarAttr* attr) {
   }
 
   fn->is_root = !(fn->is_static && fn->is_inline);
+  // Any declaration can ask for instrumentation.
+  if (attr->is_instrumented || ty->is_instrumented)
+    fn->is_instrumented = true;
 
+  C(last_fn_body) = NULL;
   if (consume(&tok, tok, ";"))
     return tok;
 
   C(current_fn) = fn;
   C(locals) = NULL;
+  C(unique_name_prefix) = fn->name;
+  C(fn_unique_name_id) = 0;
+  C(fn_profile_sites) = 0;
   enter_scope();
+  fn->scope = C(scope);
   create_param_lvars(ty->params);
 
   // A buffer for a struct/union return value is passed
@@ -3777,6 +4014,7 @@ static Token* function(Token* tok, Type* basety, VarAttr* attr) {
 #endif
   fn->alloca_bottom = new_lvar("__alloca_size__", pointer_to(ty_char));
 
+  Token* body = tok;
   tok = skip(tok, "{");
 
   // [https://www.sigbus.info/n1570#6.4.2.2p1] "__func__" is
@@ -3793,6 +4031,13 @@ static Token* function(Token* tok, Type* basety, VarAttr* attr) {
   fn->locals = C(locals);
   leave_scope();
   resolve_goto_labels();
+
+  fn->code_hash = hash_tokens(0xcbf29ce484222325, body, tok);
+  fn->line_hash = hash_token_lines(body, tok);
+  fn->num_profile_sites = C(fn_profile_sites);
+  C(last_fn_body) = body;
+  C(unique_name_prefix) = NULL;
+  trace_end(trace_start, "parse function", fn->name);
   return tok;
 }
 
@@ -3917,25 +4162,39 @@ IMPLSTATIC Obj* parse(Token* tok) {
 
   tok = add_builtin_types(tok);
 
+  C(env_hash) = 0xcbf29ce484222325;
+
   while (tok->kind != TK_EOF) {
     // outaf("%s:%d\n", tok->filename, tok->line_no);
+    Token* start = tok;
     VarAttr attr = {0};
     Type* basety = declspec(&tok, tok, &attr);
 
     // Typedef
     if (attr.is_typedef) {
       tok = parse_typedef(tok, basety);
+      C(env_hash) = hash_tokens(C(env_hash), start, tok);
       continue;
     }
 
     // Function
     if (is_function(tok)) {
       tok = function(tok, basety, &attr);
+      // The body is hashed separately into the function's code_hash.
+      C(env_hash) = hash_tokens(C(env_hash), start, C(last_fn_body) ? C(last_fn_body) : tok);
       continue;
     }
 
     // Global variable
     tok = global_variable(tok, basety, &attr);
+    C(env_hash) = hash_tokens(C(env_hash), start, tok);
+  }
+
+  // A function's code can depend on any declaration in the file, so its hash
+  // covers all of them too.
+  for (Obj* var = C(globals); var; var = var->next) {
+    if (var->is_function && var->is_definition)
+      var->code_hash = (var->code_hash ^ C(env_hash)) * 0x100000001b3;
   }
 
   for (Obj* var = C(globals); var; var = var->next)
@@ -0,0 +1,185 @@
+#include "dyibicc.h"
+
+// Telling Linux perf about compiled code, so that samples in it are attributed
+// to functions (and lines) rather than to anonymous memory. Two ways:
+//
+// - perf_map appends "<address> <size> <name>" lines to /tmp/perf-<pid>.map,
+//   which perf report reads as is.
+// - jitdump_dir writes <dir>/jit-<pid>.dump in the format documented in the
+//   kernel's tools/perf/Documentation/jitdump-specification.txt, which
+//   `perf inject --jit` turns into ELF images, including the code bytes and
+//   line info. Requires `perf record -k mono`.
+//
+// Both are per process rather than per context, so that several contexts can
+// have them on at once.
+
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#define JITDUMP_MAGIC 0x4A695444
+#define JITDUMP_VERSION 1
+#define JITDUMP_ELF_MACH_X86_64 62
+
+enum {
+  JIT_CODE_LOAD = 0,
+  JIT_CODE_DEBUG_INFO = 2,
+};
+
+typedef struct JitdumpHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t total_size;
+  uint32_t elf_mach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+} JitdumpHeader;
+
+typedef struct JitdumpRecordHeader {
+  uint32_t id;
+  uint32_t total_size;
+  uint64_t timestamp;
+} JitdumpRecordHeader;
+
+static pthread_mutex_t perf_mutex = PTHREAD_MUTEX_INITIALIZER;
+static FILE* jitdump_file;
+static uint64_t jitdump_code_index;
+
+static uint64_t jitdump_timestamp(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void write_perf_map(JitCode* code, int num_code) {
+  char path[64];
+  snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+  FILE* fp = fopen(path, "a");
+  if (!fp)
+    return;
+  for (int i = 0; i < num_code; ++i) {
+    fprintf(fp, "%lx %zx %s\n", (unsigned long)code[i].address, code[i].size, code[i].name);
+    if (code[i].cold_size > 0) {
+      fprintf(fp, "%lx %zx %s.cold\n", (unsigned long)code[i].cold_address, code[i].cold_size,
+              code[i].name);
+    }
+  }
+  fclose(fp);
+}
+
+// Opened once for the life of the process, as perf finds the file by its
+// (executable) mapping, and expects a single header.
+static FILE* open_jitdump(char* dir) {
+  if (jitdump_file)
+    return jitdump_file;
+
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/jit-%d.dump", dir, (int)getpid());
+  FILE* fp = fopen(path, "w+");
+  if (!fp)
+    return NULL;
+  JitdumpHeader header = {
+      .magic = JITDUMP_MAGIC,
+      .version = JITDUMP_VERSION,
+      .total_size = sizeof(JitdumpHeader),
+      .elf_mach = JITDUMP_ELF_MACH_X86_64,
+      .pid = (uint32_t)getpid(),
+      .timestamp = jitdump_timestamp(),
+  };
+  fwrite(&header, sizeof(header), 1, fp);
+  fflush(fp);
+
+  // Only so that this mapping shows up in the perf.data, it's never used.
+  void* marker = mmap(NULL, get_page_size(), PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(fp), 0);
+  if (marker == MAP_FAILED) {
+    fclose(fp);
+    return NULL;
+  }
+  jitdump_file = fp;
+  return fp;
+}
+
+static void write_jitdump_debug_info(FILE* fp, JitCode* code) {
+  size_t total_size = sizeof(JitdumpRecordHeader) + 2 * sizeof(uint64_t);
+  for (int i = 0; i < code->num_lines; ++i) {
+    total_size += sizeof(uint64_t) + 2 * sizeof(uint32_t) + strlen(code->lines[i].filename) + 1;
+  }
+  JitdumpRecordHeader rh = {
+      .id = JIT_CODE_DEBUG_INFO,
+      .total_size = (uint32_t)total_size,
+      .timestamp = jitdump_timestamp(),
+  };
+  uint64_t code_addr = (uint64_t)code->address;
+  uint64_t nr_entry = code->num_lines;
+  fwrite(&rh, sizeof(rh), 1, fp);
+  fwrite(&code_addr, sizeof(code_addr), 1, fp);
+  fwrite(&nr_entry, sizeof(nr_entry), 1, fp);
+  for (int i = 0; i < code->num_lines; ++i) {
+    uint64_t addr = (uint64_t)code->lines[i].address;
+    uint32_t line_and_discrim[2] = {(uint32_t)code->lines[i].line_no, 0};
+    fwrite(&addr, sizeof(addr), 1, fp);
+    fwrite(line_and_discrim, sizeof(line_and_discrim), 1, fp);
+    fwrite(code->lines[i].filename, 1, strlen(code->lines[i].filename) + 1, fp);
+  }
+}
+
+static void write_jitdump_load(FILE* fp, char* name, char* address, size_t size) {
+  size_t name_size = strlen(name) + 1;
+  JitdumpRecordHeader rh = {
+      .id = JIT_CODE_LOAD,
+      .total_size = (uint32_t)(sizeof(rh) + 2 * sizeof(uint32_t) + 4 * sizeof(uint64_t) +
+                               name_size + size),
+      .timestamp = jitdump_timestamp(),
+  };
+  uint32_t ids[2] = {(uint32_t)getpid(), (uint32_t)syscall(SYS_gettid)};
+  uint64_t addrs[4] = {(uint64_t)address, (uint64_t)address, size, jitdump_code_index++};
+  fwrite(&rh, sizeof(rh), 1, fp);
+  fwrite(ids, sizeof(ids), 1, fp);
+  fwrite(addrs, sizeof(addrs), 1, fp);
+  fwrite(name, 1, name_size, fp);
+  fwrite(address, 1, size, fp);
+}
+
+IMPLSTATIC void perf_record_code(JitCode* code, int num_code) {
+  UserContext* uc = user_context;
+  if (num_code == 0 || (!uc->perf_map && !uc->jitdump_dir))
+    return;
+
+  pthread_mutex_lock(&perf_mutex);
+
+  if (uc->perf_map)
+    write_perf_map(code, num_code);
+
+  FILE* fp = uc->jitdump_dir ? open_jitdump(uc->jitdump_dir) : NULL;
+  if (fp) {
+    for (int i = 0; i < num_code; ++i) {
+      // perf wants the line info for code before the code itself.
+      if (code[i].num_lines > 0)
+        write_jitdump_debug_info(fp, &code[i]);
+      write_jitdump_load(fp, code[i].name, code[i].address, code[i].size);
+      // The out of line code is loaded as a function of its own, as in the
+      // perf map.
+      if (code[i].cold_size > 0) {
+        char cold_name[256];
+        snprintf(cold_name, sizeof(cold_name), "%s.cold", code[i].name);
+        write_jitdump_load(fp, cold_name, code[i].cold_address, code[i].cold_size);
+      }
+    }
+    fflush(fp);
+  }
+
+  pthread_mutex_unlock(&perf_mutex);
+}
+
+#else  // !__linux__
+
+IMPLSTATIC void perf_record_code(JitCode* code, int num_code) {
+  (void)code;
+  (void)num_code;
+}
+
+#endif
@@ -668,7 +668,7 @@ static bool file_exists_in_builtins(char* path) {
   return hashmap_get(&C(builtin_includes_map), path) != NULL;
 }
 
-static bool file_exists(char* path) {
+IMPLSTATIC bool file_exists(char* path) {
   struct stat st;
 
   if (file_exists_in_builtins(path))
@@ -677,6 +677,15 @@ static bool file_exists(char* path) {
   return !stat(path, &st);
 }
 
+// Looks for an #include at |path|. Misses are recorded for the cache, as a file
+// added there later would be included instead.
+static bool include_exists(char* path) {
+  if (file_exists(path))
+    return true;
+  strarray_push(&C(include_misses), path, AL_Compile);
+  return false;
+}
+
 // If tok is a macro, expand it and return true.
 // Otherwise, do nothing and return false.
 static bool expand_macro(Token** rest, Token* tok) {
@@ -753,7 +762,7 @@ IMPLSTATIC char* search_include_paths(char* filename) {
   // Search a file from the include paths.
   for (int i = 0; i < (int)user_context->num_include_paths; i++) {
     char* path = format(AL_Compile, "%s/%s", user_context->include_paths[i], filename);
-    if (!file_exists(path))
+    if (!include_exists(path))
       continue;
     hashmap_put(&C(include_path_cache), filename, path);
     C(include_next_idx) = i + 1;
@@ -766,7 +775,7 @@ static char* search_include_next(char* filename) {
   for (; C(include_next_idx) < (int)user_context->num_include_paths; C(include_next_idx)++) {
     char* path =
         format(AL_Compile, "%s/%s", user_context->include_paths[C(include_next_idx)], filename);
-    if (file_exists(path))
+    if (include_exists(path))
       return path;
   }
   return NULL;
@@ -864,15 +873,11 @@ static Token* include_file(Token* tok, char* path, Token* filename_tok) {
   if (guard_name && hashmap_get(&C(macros), guard_name))
     return tok;
 
-  Token* tok2;
-  char* builtin_include_contents = hashmap_get(&C(builtin_includes_map), path);
-  if (builtin_include_contents) {
-    tok2 = tokenize_filecontents(path, builtin_include_contents);
-  } else {
-    tok2 = tokenize_file(path);
-  }
+  double trace_start = trace_begin();
+  Token* tok2 = tokenize_header(path, hashmap_get(&C(builtin_includes_map), path));
   if (!tok2)
     error_tok(filename_tok, "%s: cannot open file: %s", path, strerror(errno));
+  trace_include_begin(trace_start, path, tok2->file, filename_tok->file);
 
   guard_name = detect_include_guard(tok2);
   if (guard_name)
@@ -907,6 +912,9 @@ static Token* preprocess2(Token* tok) {
   Token* cur = &head;
 
   while (tok->kind != TK_EOF) {
+    if (compiler_state.trace__include_depth)
+      trace_include_reached(tok);
+
     // If it is a macro, expand it.
     if (expand_macro(&tok, tok)) {
       continue;
@@ -931,7 +939,7 @@ static Token* preprocess2(Token* tok) {
       if (filename[0] != '/' && is_dquote) {
         char* path = format(AL_Compile, "%s/%s", dirname(bumpstrdup(start->file->name, AL_Compile)),
                             filename);
-        if (file_exists(path)) {
+        if (include_exists(path)) {
           tok = include_file(tok, path, start->next->next);
           continue;
         }
@@ -1112,20 +1120,27 @@ static Token* counter_macro(Macro* m, Token* tmpl) {
 // "Fri Jul 24 01:32:50 2020"
 static Token* timestamp_macro(Macro* m, Token* tmpl) {
   (void)m;
+  compiler_state.cache__uncacheable = true;
   return new_str_token("Mon May 02 01:23:45 1977", tmpl);
 }
 
-static Token* base_file_macro(Macro* m, Token* tmpl) {
+// Like __TIMESTAMP__, these aren't derived from the source, so a file that uses
+// them isn't cached.
+static Token* date_macro(Macro* m, Token* tmpl) {
   (void)m;
-  return new_str_token(compiler_state.main__base_file, tmpl);
+  compiler_state.cache__uncacheable = true;
+  return new_str_token("May 02 1977", tmpl);
 }
 
-static char* format_date(void) {
-  return "\"May 02 1977\"";
+static Token* time_macro(Macro* m, Token* tmpl) {
+  (void)m;
+  compiler_state.cache__uncacheable = true;
+  return new_str_token("01:23:45", tmpl);
 }
 
-static char* format_time(void) {
-  return "\"01:23:45\"";
+static Token* base_file_macro(Macro* m, Token* tmpl) {
+  (void)m;
+  return new_str_token(compiler_state.main__base_file, tmpl);
 }
 
 static void append_to_container_tokens(Token* to_add) {
@@ -1171,6 +1186,7 @@ static Token* container_vec_setup(Macro* m, Token* tok) {
 
   char* key = format(AL_Compile, "type:vec,arg:%s", key_as_ident);
   if (!hashmap_get(&C(container_included), key)) {
+    double trace_start = trace_begin();
     append_to_container_tokens(preprocess(
         tokenize(new_file(tok->file->name, format(AL_Compile,
                                                   "#define __dyibicc_internal_include__ 1\n"
@@ -1179,6 +1195,7 @@ static Token* container_vec_setup(Macro* m, Token* tok) {
                                                   "#include <_vec.h>\n"
                                                   "#undef __dyibicc_internal_include__\n",
                                                   key_as_arg, key_as_ident)))));
+    trace_end(trace_start, "container", key);
 
     hashmap_put(&C(container_included), key, (void*)1);
   }
@@ -1200,6 +1217,7 @@ static Token* container_map_setup(Macro* m, Token* tok) {
   char* key = format(AL_Compile, "type:map,arg:%s,arg:%s", key_as_ident, val_as_ident);
 
   if (!hashmap_get(&C(container_included), key)) {
+    double trace_start = trace_begin();
     append_to_container_tokens(preprocess(tokenize(
         new_file(tok->file->name, format(AL_Compile,
                                          "#define __dyibicc_internal_include__ 1\n"
@@ -1209,6 +1227,7 @@ static Token* container_map_setup(Macro* m, Token* tok) {
                                          "#include <_map.h>\n"
                                          "#undef __dyibicc_internal_include__\n",
                                          key_as_arg, val_as_arg, key_as_ident, val_as_ident)))));
+    trace_end(trace_start, "container", key);
 
     hashmap_put(&C(container_included), key, (void*)1);
   }
@@ -1296,6 +1315,7 @@ IMPLSTATIC void init_macros(void) {
 #elif defined(__APPLE__)
   define_macro("__SIZEOF_LONG__", "8");
   define_macro("__SIZEOF_LONG_DOUBLE__", "16");
+  define_macro("__SIZEOF_INT128__", "16");
   define_macro("__APPLE__", "1");
   define_macro("__MACH__", "1");
   define_macro("__GNUC__", "4");
@@ -1311,6 +1331,7 @@ IMPLSTATIC void init_macros(void) {
 #else
   define_macro("__SIZEOF_LONG__", "8");
   define_macro("__SIZEOF_LONG_DOUBLE__", "16");
+  define_macro("__SIZEOF_INT128__", "16");
   define_macro("__ELF__", "1");
   define_macro("linux", "1");
   define_macro("unix", "1");
@@ -1325,14 +1346,13 @@ IMPLSTATIC void init_macros(void) {
   add_builtin("__LINE__", line_macro);
   add_builtin("__COUNTER__", counter_macro);
   add_builtin("__TIMESTAMP__", timestamp_macro);
+  add_builtin("__DATE__", date_macro);
+  add_builtin("__TIME__", time_macro);
   add_builtin("__BASE_FILE__", base_file_macro);
 
   define_function_macro("_Pragma(_)\n", NULL);
   define_function_macro("$vec(T)", container_vec_setup);
   define_function_macro("$map(K,V)", container_map_setup);
-
-  define_macro("__DATE__", format_date());
-  define_macro("__TIME__", format_time());
 }
 
 typedef enum {
@@ -1427,7 +1447,9 @@ static void join_adjacent_string_literals(Token* tok) {
 
 // Entry point function of the preprocessor.
 IMPLSTATIC Token* preprocess(Token* tok) {
+  int trace_depth = trace_include_depth();
   tok = preprocess2(tok);
+  trace_include_end(trace_depth);
   if (C(cond_incl))
     error_tok(C(cond_incl)->tok, "unterminated conditional directive");
   convert_pp_tokens(tok);
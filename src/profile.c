@@ -0,0 +1,109 @@
+#include "dyibicc.h"
+
+// Saving and loading the counts recorded by code compiled with
+// profile_branches, which codegen then uses to lay out branches and switches
+// when the functions are compiled again.
+//
+// A profile is a text file, a header line followed by a line per function:
+//
+//   <source file> TAB <function> TAB <code_hash in hex> TAB <count> ...
+//
+// with the counts separated by spaces. Counts for a function are only used if
+// its code_hash is still the same, as they're indexed by Node.profile_site.
+
+#define PROFILE_HEADER "dyibicc profile 1\n"
+
+static char* profile_key(size_t file_index, char* name) {
+  return format(AL_Compile, "%s\t%s", user_context->files[file_index].source_name, name);
+}
+
+// Returns the loaded counts for |fn| in file |file_index|, if there are some
+// that still apply to it.
+IMPLSTATIC ProfileEntry* find_profile(size_t file_index, Obj* fn) {
+  if (user_context->profile.used == 0 || fn->num_profile_sites == 0)
+    return NULL;
+  ProfileEntry* entry = hashmap_get(&user_context->profile, profile_key(file_index, fn->name));
+  if (!entry || entry->hash != fn->code_hash || entry->num_counts != fn->num_profile_sites)
+    return NULL;
+  return entry;
+}
+
+IMPLSTATIC bool profile_dump(char* path) {
+  FILE* fp = fopen(path, "w");
+  if (!fp)
+    return false;
+
+  UserContext* uc = user_context;
+  fputs(PROFILE_HEADER, fp);
+  for (size_t i = 0; i < uc->num_files; ++i) {
+    FileLinkData* fld = &uc->files[i];
+    for (int j = 0; j < fld->num_functions; ++j) {
+      FunctionCode* fc = &fld->functions[j];
+      if (!fc->profile_counts)
+        continue;
+      fprintf(fp, "%s\t%s\t%016llx\t", fld->source_name, fc->name, (unsigned long long)fc->hash);
+      for (int k = 0; k < fc->num_profile_counts; ++k) {
+        fprintf(fp, k == 0 ? "%llu" : " %llu", (unsigned long long)fc->profile_counts[k]);
+      }
+      fputc('\n', fp);
+    }
+  }
+  return fclose(fp) == 0;
+}
+
+// Replaces the entries for the functions in |path|, leaving any others that
+// were loaded before as they were. Returns false if it can't be read or isn't
+// a profile, in which case nothing is changed.
+IMPLSTATIC bool profile_load(char* path) {
+  FILE* fp = fopen(path, "rb");
+  if (!fp)
+    return false;
+  fseek(fp, 0, SEEK_END);
+  size_t size = ftell(fp);
+  rewind(fp);
+  char* buf = bumpcalloc(1, size + 1, AL_Compile);
+  bool read_ok = fread(buf, 1, size, fp) == size;
+  fclose(fp);
+  if (!read_ok || strncmp(buf, PROFILE_HEADER, strlen(PROFILE_HEADER)) != 0)
+    return false;
+
+  char* p = buf + strlen(PROFILE_HEADER);
+  while (*p) {
+    char* eol = strchr(p, '\n');
+    char* next = eol ? eol + 1 : p + strlen(p);
+    if (eol)
+      *eol = '\0';
+
+    char* file = p;
+    char* name = strchr(file, '\t');
+    char* hash = name ? strchr(name + 1, '\t') : NULL;
+    char* counts = hash ? strchr(hash + 1, '\t') : NULL;
+    if (counts) {
+      *name++ = '\0';
+      *hash++ = '\0';
+      *counts++ = '\0';
+
+      int num_counts = 0;
+      for (char* c = counts; *c; ++c) {
+        num_counts += c == counts || c[-1] == ' ';
+      }
+      ProfileEntry* entry =
+          aligned_allocate(sizeof(ProfileEntry) + num_counts * sizeof(uint64_t), 8);
+      entry->hash = strtoull(hash, NULL, 16);
+      entry->num_counts = num_counts;
+      char* c = counts;
+      for (int i = 0; i < num_counts; ++i) {
+        entry->counts[i] = strtoull(c, &c, 10);
+      }
+
+      char* key = format(AL_Compile, "%s\t%s", file, name);
+      ProfileEntry* old = hashmap_get(&user_context->profile, key);
+      if (old)
+        aligned_free(old);
+      hashmap_put(&user_context->profile, strdup(key), entry);
+    }
+
+    p = next;
+  }
+  return true;
+}
@@ -0,0 +1,294 @@
+#include "dyibicc.h"
+
+// A sampling profiler for compiled code, see dyibicc_profiler_start(). SIGPROF
+// is delivered to whichever thread is running when the process has used
+// another 1/hz of CPU time, and the handler records where that thread was:
+// the interrupted pc, and the return addresses found by following the rbp
+// chain, which compiled code always maintains. The samples are only resolved
+// to functions and lines when they're written, see find_jit_code().
+//
+// As signals are per process, so is the profiler, and it covers all contexts.
+
+#if defined(__linux__)
+
+#include <signal.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+#define SAMPLER_MAX_SAMPLES (1 << 16)
+#define SAMPLER_MAX_DEPTH 32
+
+// A frame larger than this ends the walk, as the rbp being followed probably
+// isn't a frame pointer at all.
+#define SAMPLER_MAX_FRAME_SIZE (1 << 20)
+
+// Indices into mcontext_t's gregs, as REG_RBP etc. in <sys/ucontext.h>, which
+// are only declared with _GNU_SOURCE.
+enum {
+  GREG_RBP = 10,
+  GREG_RSP = 15,
+  GREG_RIP = 16,
+};
+
+typedef struct Sample {
+  int depth;  // Set last, so 0 if the sample's incomplete.
+  char* frames[SAMPLER_MAX_DEPTH];  // The pc, then return addresses.
+} Sample;
+
+static struct {
+  bool running;
+  Sample* samples;
+  uint32_t num_samples;  // May be more than SAMPLER_MAX_SAMPLES, if some were dropped.
+  struct sigaction prev_action;
+} sampler;
+
+static void sigprof_handler(int sig, siginfo_t* info, void* ucontext) {
+  (void)sig;
+  (void)info;
+  int saved_errno = errno;
+
+  uint32_t index = __atomic_fetch_add(&sampler.num_samples, 1, __ATOMIC_RELAXED);
+  if (index < SAMPLER_MAX_SAMPLES) {
+    // gregs is the first member, but is only named that with _GNU_SOURCE.
+    greg_t* gregs = (greg_t*)&((ucontext_t*)ucontext)->uc_mcontext;
+    Sample* sample = &sampler.samples[index];
+    sample->frames[0] = (char*)gregs[GREG_RIP];
+    int depth = 1;
+    uintptr_t prev = (uintptr_t)gregs[GREG_RSP];
+    uintptr_t fp = (uintptr_t)gregs[GREG_RBP];
+    while (depth < SAMPLER_MAX_DEPTH && fp >= prev && fp - prev < SAMPLER_MAX_FRAME_SIZE &&
+           fp % 8 == 0) {
+      char* ret = ((char**)fp)[1];
+      if (!ret)
+        break;
+      sample->frames[depth++] = ret;
+      prev = fp + 16;
+      fp = ((uintptr_t*)fp)[0];
+    }
+    __atomic_store_n(&sample->depth, depth, __ATOMIC_RELEASE);
+  }
+
+  errno = saved_errno;
+}
+
+static bool set_timer(int hz) {
+  struct itimerval timer = {0};
+  if (hz > 0) {
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 1000000 / hz;
+    timer.it_value = timer.it_interval;
+  }
+  return setitimer(ITIMER_PROF, &timer, NULL) == 0;
+}
+
+bool dyibicc_profiler_start(int hz) {
+  if (sampler.running || hz <= 0 || hz > 1000000)
+    return false;
+
+  if (!sampler.samples)
+    sampler.samples = calloc(SAMPLER_MAX_SAMPLES, sizeof(Sample));
+  else
+    memset(sampler.samples, 0, SAMPLER_MAX_SAMPLES * sizeof(Sample));
+  __atomic_store_n(&sampler.num_samples, 0, __ATOMIC_SEQ_CST);
+
+  struct sigaction action = {0};
+  action.sa_sigaction = sigprof_handler;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, &sampler.prev_action) != 0)
+    return false;
+  if (!set_timer(hz)) {
+    sigaction(SIGPROF, &sampler.prev_action, NULL);
+    return false;
+  }
+  sampler.running = true;
+  return true;
+}
+
+void dyibicc_profiler_stop(void) {
+  if (!sampler.running)
+    return;
+  set_timer(0);
+  sigaction(SIGPROF, &sampler.prev_action, NULL);
+  sampler.running = false;
+}
+
+// What a frame's address resolved to.
+typedef struct SampledCode {
+  char* name;
+  char* filename;  // NULL if the line isn't known.
+  int line_no;
+  bool is_compiled;
+} SampledCode;
+
+// Counts for a function, or a line.
+typedef struct SampleCount {
+  char* key;
+  char* name;
+  int self;
+  int total;
+  int counted_in;  // The last sample that added to |total|.
+} SampleCount;
+
+static SampledCode* resolve_frame(HashMap* resolved, char** frame, bool is_return_address) {
+  SampledCode* code = hashmap_get2(resolved, (char*)frame, sizeof(*frame));
+  if (code)
+    return code;
+
+  code = bumpcalloc(1, sizeof(SampledCode), AL_Compile);
+  // A return address is after the call, which might be the start of another
+  // line.
+  char* pc = is_return_address ? *frame - 1 : *frame;
+  code->is_compiled = find_jit_code(pc, &code->name, &code->filename, &code->line_no);
+  if (!code->is_compiled)
+    code->name = "[native]";
+  hashmap_put2(resolved, (char*)frame, sizeof(*frame), code);
+  return code;
+}
+
+static SampleCount* get_count(HashMap* counts, char* key, char* name) {
+  SampleCount* count = hashmap_get(counts, key);
+  if (!count) {
+    count = bumpcalloc(1, sizeof(SampleCount), AL_Compile);
+    count->key = key;
+    count->name = name;
+    count->counted_in = -1;
+    hashmap_put(counts, key, count);
+  }
+  return count;
+}
+
+static int compare_counts(const void* a, const void* b) {
+  const SampleCount* x = *(const SampleCount**)a;
+  const SampleCount* y = *(const SampleCount**)b;
+  if (x->self != y->self)
+    return y->self - x->self;
+  if (x->total != y->total)
+    return y->total - x->total;
+  return strcmp(x->key, y->key);
+}
+
+static SampleCount** sorted_counts(HashMap* counts, int* num_counts) {
+  SampleCount** sorted = bumpcalloc(counts->used + 1, sizeof(SampleCount*), AL_Compile);
+  int n = 0;
+  for (int i = 0; i < counts->capacity; ++i) {
+    HashEntry* ent = &counts->buckets[i];
+    if (ent->key && ent->key != (char*)-1)
+      sorted[n++] = ent->val;
+  }
+  qsort(sorted, n, sizeof(SampleCount*), compare_counts);
+  *num_counts = n;
+  return sorted;
+}
+
+static bool write_samples(FILE* fp, DyibiccProfilerFormat kind) {
+  HashMap resolved = {.alloc_lifetime = AL_Compile};
+  HashMap counts = {.alloc_lifetime = AL_Compile};
+
+  uint32_t num_samples = MIN(__atomic_load_n(&sampler.num_samples, __ATOMIC_SEQ_CST),
+                             (uint32_t)SAMPLER_MAX_SAMPLES);
+  int total = 0;
+  for (uint32_t i = 0; i < num_samples; ++i) {
+    Sample* sample = &sampler.samples[i];
+    int depth = __atomic_load_n(&sample->depth, __ATOMIC_ACQUIRE);
+    if (depth == 0)
+      continue;
+    ++total;
+
+    // Past the leaf, only compiled frames are kept, as anything else can't be
+    // relied on to maintain rbp.
+    SampledCode* stack[SAMPLER_MAX_DEPTH];
+    int n = 0;
+    for (int j = 0; j < depth; ++j) {
+      SampledCode* code = resolve_frame(&resolved, &sample->frames[j], j > 0);
+      if (j > 0 && !code->is_compiled)
+        break;
+      stack[n++] = code;
+    }
+
+    switch (kind) {
+      case DYIBICC_PROFILER_FLAT:
+        for (int j = 0; j < n; ++j) {
+          SampleCount* count = get_count(&counts, stack[j]->name, stack[j]->name);
+          if (j == 0)
+            ++count->self;
+          // Recursive functions are only counted once per sample.
+          if (count->counted_in != (int)i) {
+            ++count->total;
+            count->counted_in = (int)i;
+          }
+        }
+        break;
+      case DYIBICC_PROFILER_LINES: {
+        char* key = stack[0]->filename ? format(AL_Compile, "%s:%d", stack[0]->filename,
+                                                stack[0]->line_no)
+                                       : stack[0]->name;
+        ++get_count(&counts, key, stack[0]->name)->self;
+        break;
+      }
+      case DYIBICC_PROFILER_COLLAPSED: {
+        // Outermost first.
+        char* key = stack[n - 1]->name;
+        for (int j = n - 2; j >= 0; --j) {
+          key = format(AL_Compile, "%s;%s", key, stack[j]->name);
+        }
+        ++get_count(&counts, key, NULL)->self;
+        break;
+      }
+    }
+  }
+
+  int num_counts;
+  SampleCount** sorted = sorted_counts(&counts, &num_counts);
+  if (kind != DYIBICC_PROFILER_COLLAPSED) {
+    uint32_t dropped = __atomic_load_n(&sampler.num_samples, __ATOMIC_SEQ_CST) - num_samples;
+    fprintf(fp, "# %d samples, %u dropped\n", total, dropped);
+  }
+  for (int i = 0; i < num_counts; ++i) {
+    SampleCount* count = sorted[i];
+    double self_percent = total ? 100.0 * count->self / total : 0;
+    switch (kind) {
+      case DYIBICC_PROFILER_FLAT:
+        fprintf(fp, "%8d %6.2f%% %8d %6.2f%%  %s\n", count->self, self_percent, count->total,
+                total ? 100.0 * count->total / total : 0, count->name);
+        break;
+      case DYIBICC_PROFILER_LINES:
+        fprintf(fp, "%8d %6.2f%%  %s  %s\n", count->self, self_percent, count->key, count->name);
+        break;
+      case DYIBICC_PROFILER_COLLAPSED:
+        fprintf(fp, "%s %d\n", count->key, count->self);
+        break;
+    }
+  }
+  return true;
+}
+
+bool dyibicc_profiler_write(const char* path, DyibiccProfilerFormat format) {
+  if (!sampler.samples)
+    return false;
+  FILE* fp = fopen(path, "w");
+  if (!fp)
+    return false;
+
+  alloc_init(AL_Compile);
+  bool ok = write_samples(fp, format);
+  alloc_reset(AL_Compile);
+  return fclose(fp) == 0 && ok;
+}
+
+#else  // !__linux__
+
+bool dyibicc_profiler_start(int hz) {
+  (void)hz;
+  return false;
+}
+
+void dyibicc_profiler_stop(void) {}
+
+bool dyibicc_profiler_write(const char* path, DyibiccProfilerFormat format) {
+  (void)path;
+  (void)format;
+  return false;
+}
+
+#endif
@@ -30,6 +30,7 @@ IMPLSTATIC bool consume(Token** rest, Token* tok, char* str) {
 // Create a new token.
 static Token* new_token(TokenKind kind, char* start, char* end) {
   Token* tok = bumpcalloc(1, sizeof(Token), AL_Compile);
+  ++C(num_tokens);
   tok->kind = kind;
   tok->loc = start;
   tok->len = (int)(end - start);
@@ -742,5 +743,154 @@ Token* tokenize_file(char* path) {
   char* p = read_file_wrap_user(path, AL_Compile);
   if (!p)
     return NULL;
-  return tokenize_filecontents(path, p);
+  uint64_t contents_hash = 0;
+  if (user_context->cache_dir)
+    contents_hash = hash_bytes(0xcbf29ce484222325, p, strlen(p));
+  Token* tok = tokenize_filecontents(path, p);
+  C(all_tokenized_files).data[C(all_tokenized_files).len - 1]->contents_hash = contents_hash;
+  return tok;
+}
+
+// Headers are kept tokenized in the context, by path, so that one included by
+// many files, or by each update, is only tokenized again when its contents
+// change. Each include gets a copy of the tokens in AL_Compile, as the
+// preprocessor and parser modify them, and the copy doesn't point into the
+// entry so that the entry can be replaced while a lazy_compilation parse is
+// still holding on to tokens from it.
+
+// Makes an entry for |tok|, which was just tokenized from |file|.
+static TokenCacheEntry* new_token_cache_entry(File* file, Token* tok, uint64_t contents_hash) {
+  TokenCacheEntry* entry = calloc(1, sizeof(TokenCacheEntry));
+  entry->contents_hash = contents_hash;
+  entry->contents_size = strlen(file->contents) + 1;
+  entry->contents = malloc(entry->contents_size);
+  memcpy(entry->contents, file->contents, entry->contents_size);
+
+  int num_strs = 0;
+  for (Token* t = tok; t; t = t->next) {
+    ++entry->num_tokens;
+    if (t->kind == TK_STR) {
+      entry->strs_size += align_to_u(t->ty->size, 8);
+      ++num_strs;
+    }
+  }
+  entry->tokens = calloc(entry->num_tokens, sizeof(Token));
+  entry->strs = malloc(entry->strs_size);
+  entry->str_types = calloc(num_strs, sizeof(Type));
+
+  char* str = entry->strs;
+  Type* str_ty = entry->str_types;
+  Token* cached = entry->tokens;
+  for (Token* t = tok; t; t = t->next, ++cached) {
+    *cached = *t;
+    cached->next = NULL;
+    cached->file = NULL;
+    cached->filename = NULL;
+    cached->loc = entry->contents + (t->loc - file->contents);
+    if (t->kind == TK_STR) {
+      memcpy(str, t->str, t->ty->size);
+      cached->str = str;
+      str += align_to_u(t->ty->size, 8);
+      *str_ty = *t->ty;
+      cached->ty = str_ty++;
+    }
+  }
+  return entry;
+}
+
+static Token* copy_cached_tokens(TokenCacheEntry* entry, char* path) {
+  char* contents = bumpcalloc(1, entry->contents_size, AL_Compile);
+  memcpy(contents, entry->contents, entry->contents_size);
+  char* strs = bumpcalloc(1, entry->strs_size, AL_Compile);
+  memcpy(strs, entry->strs, entry->strs_size);
+
+  File* file = new_file(path, contents);
+  file->file_no = C(all_tokenized_files).len;
+  fileptrarray_push(&C(all_tokenized_files), file, AL_Compile);
+
+  Token* toks = bumpcalloc(entry->num_tokens, sizeof(Token), AL_Compile);
+  for (int i = 0; i < entry->num_tokens; ++i) {
+    Token* cached = &entry->tokens[i];
+    Token* t = &toks[i];
+    *t = *cached;
+    t->next = i + 1 < entry->num_tokens ? &toks[i + 1] : NULL;
+    t->file = file;
+    t->filename = file->display_name;
+    t->loc = contents + (cached->loc - entry->contents);
+    if (t->kind == TK_STR) {
+      t->str = strs + (cached->str - entry->strs);
+      t->ty = array_of(cached->ty->base, cached->ty->array_len, NULL);
+    }
+  }
+  C(num_tokens) += entry->num_tokens;
+  ++C(num_headers_reused);
+  return toks;
+}
+
+// Tokenizes the header at |path|, or |builtin_contents| if it's one of the
+// compiler's own. Returns NULL if it can't be loaded.
+IMPLSTATIC Token* tokenize_header(char* path, char* builtin_contents) {
+  char* p = builtin_contents ? builtin_contents : read_file_wrap_user(path, AL_Compile);
+  if (!p)
+    return NULL;
+  uint64_t contents_hash = hash_bytes(0xcbf29ce484222325, p, strlen(p));
+
+  UserContext* ctx = user_context;
+  mutex_lock(ctx->compile_mutex);
+  TokenCacheEntry* entry = hashmap_get(&ctx->token_cache, path);
+  mutex_unlock(ctx->compile_mutex);
+  Token* tok;
+  if (entry && entry->contents_hash == contents_hash) {
+    tok = copy_cached_tokens(entry, path);
+  } else {
+    tok = tokenize_filecontents(path, p);
+    entry = new_token_cache_entry(tok->file, tok, contents_hash);
+    mutex_lock(ctx->compile_mutex);
+    TokenCacheEntry* prev = hashmap_get(&ctx->token_cache, path);
+    if (prev) {
+      prev->next_retired = ctx->token_cache_retired;
+      ctx->token_cache_retired = prev;
+    }
+    hashmap_put(&ctx->token_cache, strdup(path), entry);
+    mutex_unlock(ctx->compile_mutex);
+  }
+
+  // The compiler's own headers aren't dependencies of a cache_dir entry, as
+  // they're part of the compiler build that its key includes.
+  if (!builtin_contents)
+    tok->file->contents_hash = contents_hash;
+  return tok;
+}
+
+static void free_token_cache_entry(TokenCacheEntry* entry) {
+  free(entry->contents);
+  free(entry->strs);
+  free(entry->str_types);
+  free(entry->tokens);
+  free(entry);
+}
+
+// Frees the entries replaced since the last call, which must be between
+// updates, or all of them if the context's being freed.
+IMPLSTATIC void free_token_cache(UserContext* ctx, bool all) {
+  while (ctx->token_cache_retired) {
+    TokenCacheEntry* entry = ctx->token_cache_retired;
+    ctx->token_cache_retired = entry->next_retired;
+    free_token_cache_entry(entry);
+  }
+  if (!all)
+    return;
+
+  HashMap* map = &ctx->token_cache;
+  for (int i = 0; i < map->capacity; i++) {
+    HashEntry* ent = &map->buckets[i];
+    if (ent->key && ent->key != (char*)-1) {
+      alloc_free(ent->key, map->alloc_lifetime);
+      free_token_cache_entry(ent->val);
+    }
+  }
+  alloc_free(map->buckets, map->alloc_lifetime);
+  map->buckets = NULL;
+  map->used = 0;
+  map->capacity = 0;
 }
@@ -0,0 +1,196 @@
+#include "dyibicc.h"
+
+// Chrome trace_event output for updates, see time_trace_path. Each compiling
+// thread collects spans into AL_Compile as it works on a file, and hands them
+// to the context once the file's done. They're written out as "complete"
+// events at the end of the update, when nesting is implied by the times.
+//
+// An #include only tokenizes the file and splices its tokens in, so its span
+// is ended when the preprocessor reaches a token from the file that included
+// it (or from above that), see trace_include_reached().
+
+#define C(x) compiler_state.trace__##x
+
+static uint64_t trace_next_tid;
+static THREAD_LOCAL int trace_tid;
+
+IMPLSTATIC void trace_init(void) {
+  C(enabled) = user_context->time_trace_path != NULL;
+}
+
+// Returns the start time for a span to pass to trace_end(), or 0 if the
+// current compile isn't being traced.
+IMPLSTATIC double trace_begin(void) {
+  return C(enabled) ? get_seconds() : 0;
+}
+
+static int get_trace_tid(void) {
+  if (!trace_tid)
+    trace_tid = (int)atomic_fetch_add_u64(&trace_next_tid, 1) + 1;
+  return trace_tid;
+}
+
+IMPLSTATIC void trace_end(double start, char* name, char* detail) {
+  if (!C(enabled))
+    return;
+  if (C(num_events) == C(cap_events)) {
+    int cap = C(cap_events) ? C(cap_events) * 2 : 256;
+    C(events) = bumplamerealloc(C(events), C(cap_events) * sizeof(TraceEvent),
+                                cap * sizeof(TraceEvent), AL_Compile);
+    C(cap_events) = cap;
+  }
+  C(events)[C(num_events)++] = (TraceEvent){
+      .name = name,
+      .detail = detail,
+      .start = start,
+      .duration = get_seconds() - start,
+      .tid = get_trace_tid(),
+  };
+}
+
+// Called once |path| has been tokenized as |file| for an #include in
+// |includer|.
+IMPLSTATIC void trace_include_begin(double start, char* path, File* file, File* includer) {
+  if (!C(enabled) || C(include_depth) == TRACE_MAX_INCLUDE_DEPTH)
+    return;
+  C(includes)[C(include_depth)++] = (TraceInclude){file, includer, path, start};
+}
+
+static void end_includes_from(int depth) {
+  while (C(include_depth) > depth) {
+    TraceInclude* inc = &C(includes)[--C(include_depth)];
+    trace_end(inc->start, "include", inc->path);
+  }
+}
+
+// Called for each token as it's preprocessed. Tokens from macro expansions are
+// ignored, as they're from wherever the macro was defined.
+IMPLSTATIC void trace_include_reached(Token* tok) {
+  if (!C(include_depth) || tok->origin)
+    return;
+  for (int i = C(include_depth) - 1; i >= 0; --i) {
+    if (C(includes)[i].file == tok->file) {
+      end_includes_from(i + 1);
+      return;
+    }
+    if (C(includes)[i].includer == tok->file) {
+      end_includes_from(i);
+      return;
+    }
+  }
+}
+
+// preprocess() can be nested for container instantiations, so only ends the
+// includes that it began.
+IMPLSTATIC int trace_include_depth(void) {
+  return C(include_depth);
+}
+
+IMPLSTATIC void trace_include_end(int depth) {
+  if (C(enabled))
+    end_includes_from(depth);
+}
+
+// Adds |num_events| of |events| to the context's, which must be locked.
+static void add_to_context(UserContext* ctx, TraceEvent* events, int num_events) {
+  if (ctx->num_trace_events + num_events > ctx->cap_trace_events) {
+    ctx->cap_trace_events = MAX(ctx->cap_trace_events * 2, ctx->num_trace_events + num_events);
+    ctx->trace_events = realloc(ctx->trace_events, ctx->cap_trace_events * sizeof(TraceEvent));
+  }
+  for (int i = 0; i < num_events; ++i) {
+    TraceEvent* ev = &ctx->trace_events[ctx->num_trace_events++];
+    *ev = events[i];
+    ev->name = strdup(ev->name);
+    ev->detail = ev->detail ? strdup(ev->detail) : NULL;
+  }
+}
+
+// Moves the current file's spans to the context, and stops tracing until the
+// next file's trace_init().
+IMPLSTATIC void trace_flush(void) {
+  if (!C(enabled))
+    return;
+  UserContext* ctx = user_context;
+  mutex_lock(ctx->compile_mutex);
+  add_to_context(ctx, C(events), C(num_events));
+  mutex_unlock(ctx->compile_mutex);
+  C(enabled) = false;
+  C(events) = NULL;
+  C(num_events) = 0;
+  C(cap_events) = 0;
+}
+
+// Records a span for work that isn't part of compiling a file, i.e. linking.
+IMPLSTATIC void trace_record(double start, char* name) {
+  UserContext* ctx = user_context;
+  if (!ctx->time_trace_path)
+    return;
+  TraceEvent ev = {name, NULL, start, get_seconds() - start, get_trace_tid()};
+  mutex_lock(ctx->compile_mutex);
+  add_to_context(ctx, &ev, 1);
+  mutex_unlock(ctx->compile_mutex);
+}
+
+IMPLSTATIC void trace_reset(UserContext* ctx) {
+  for (int i = 0; i < ctx->num_trace_events; ++i) {
+    free(ctx->trace_events[i].name);
+    free(ctx->trace_events[i].detail);
+  }
+  free(ctx->trace_events);
+  ctx->trace_events = NULL;
+  ctx->num_trace_events = 0;
+  ctx->cap_trace_events = 0;
+}
+
+static void write_json_string(FILE* fp, char* s) {
+  fputc('"', fp);
+  for (; *s; ++s) {
+    unsigned char c = (unsigned char)*s;
+    if (c == '"' || c == '\\')
+      fprintf(fp, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(fp, "\\u%04x", c);
+    else
+      fputc(c, fp);
+  }
+  fputc('"', fp);
+}
+
+static int compare_trace_events(const void* a, const void* b) {
+  const TraceEvent* x = a;
+  const TraceEvent* y = b;
+  if (x->start != y->start)
+    return x->start < y->start ? -1 : 1;
+  // Enclosing spans first.
+  if (x->duration != y->duration)
+    return x->duration > y->duration ? -1 : 1;
+  return 0;
+}
+
+// Writes the update's spans to time_trace_path, with times in microseconds
+// from the first of them, and then discards them.
+IMPLSTATIC void trace_write(UserContext* ctx) {
+  if (!ctx->time_trace_path)
+    return;
+  FILE* fp = fopen(ctx->time_trace_path, "w");
+  if (fp) {
+    qsort(ctx->trace_events, ctx->num_trace_events, sizeof(TraceEvent), compare_trace_events);
+    double origin = ctx->num_trace_events ? ctx->trace_events[0].start : 0;
+    fprintf(fp, "{\"traceEvents\":[\n");
+    for (int i = 0; i < ctx->num_trace_events; ++i) {
+      TraceEvent* ev = &ctx->trace_events[i];
+      fprintf(fp, "{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":", ev->tid,
+              (ev->start - origin) * 1e6, ev->duration * 1e6);
+      write_json_string(fp, ev->name);
+      if (ev->detail) {
+        fprintf(fp, ",\"args\":{\"detail\":");
+        write_json_string(fp, ev->detail);
+        fputc('}', fp);
+      }
+      fprintf(fp, i + 1 < ctx->num_trace_events ? "},\n" : "}\n");
+    }
+    fprintf(fp, "],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(fp);
+  }
+  trace_reset(ctx);
+}
@@ -13,6 +13,11 @@ IMPLSTATIC Type* ty_ushort = &(Type){TY_SHORT, 2, 2, true};
 IMPLSTATIC Type* ty_uint = &(Type){TY_INT, 4, 4, true};
 IMPLSTATIC Type* ty_ulong = &(Type){TY_LONG, 8, 8, true};
 
+#if !X64WIN
+IMPLSTATIC Type* ty_int128 = &(Type){TY_INT128, 16, 16};
+IMPLSTATIC Type* ty_uint128 = &(Type){TY_INT128, 16, 16, true};
+#endif
+
 IMPLSTATIC Type* ty_float = &(Type){TY_FLOAT, 4, 4};
 IMPLSTATIC Type* ty_double = &(Type){TY_DOUBLE, 8, 8};
 #if X64WIN
@@ -32,7 +37,7 @@ static Type* new_type(TypeKind kind, int size, int align) {
 IMPLSTATIC bool is_integer(Type* ty) {
   TypeKind k = ty->kind;
   return k == TY_BOOL || k == TY_CHAR || k == TY_SHORT || k == TY_INT || k == TY_LONG ||
-         k == TY_ENUM;
+         k == TY_ENUM || k == TY_INT128;
 }
 
 IMPLSTATIC bool is_flonum(Type* ty) {
@@ -65,6 +70,7 @@ IMPLSTATIC bool is_compatible(Type* t1, Type* t2) {
     case TY_SHORT:
     case TY_INT:
     case TY_LONG:
+    case TY_INT128:
       return t1->is_unsigned == t2->is_unsigned;
     case TY_FLOAT:
     case TY_DOUBLE:
@@ -65,6 +65,39 @@ IMPLSTATIC unsigned int get_page_size(void) {
 #endif
 }
 
+IMPLSTATIC int get_num_cpus(void) {
+#if X64WIN
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  return (int)system_info.dwNumberOfProcessors;
+#else
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int)n : 1;
+#endif
+}
+
+// Seconds since an arbitrary point, for measuring intervals.
+IMPLSTATIC double get_seconds(void) {
+#if X64WIN
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+// FNV-1a, continuing from |hash| (0xcbf29ce484222325 to start).
+IMPLSTATIC uint64_t hash_bytes(uint64_t hash, const void* p, size_t len) {
+  const unsigned char* b = p;
+  for (size_t i = 0; i < len; i++)
+    hash = (hash ^ b[i]) * 0x100000001b3;
+  return hash;
+}
+
 IMPLSTATIC void strarray_push(StringArray* arr, char* s, AllocLifetime lifetime) {
   if (!arr->data) {
     arr->data = bumpcalloc(8, sizeof(char*), lifetime);
@@ -82,32 +115,32 @@ IMPLSTATIC void strarray_push(StringArray* arr, char* s, AllocLifetime lifetime)
   arr->data[arr->len++] = s;
 }
 
-IMPLSTATIC void strintarray_push(StringIntArray* arr, StringInt item, AllocLifetime lifetime) {
+IMPLSTATIC void fileptrarray_push(FilePtrArray* arr, File* item, AllocLifetime lifetime) {
   if (!arr->data) {
-    arr->data = bumpcalloc(8, sizeof(StringInt), lifetime);
+    arr->data = bumpcalloc(8, sizeof(File*), lifetime);
     arr->capacity = 8;
   }
 
   if (arr->capacity == arr->len) {
-    arr->data = bumplamerealloc(arr->data, sizeof(StringInt) * arr->capacity,
-                                sizeof(StringInt) * arr->capacity * 2, lifetime);
+    arr->data = bumplamerealloc(arr->data, sizeof(File*) * arr->capacity,
+                                sizeof(File*) * arr->capacity * 2, lifetime);
     arr->capacity *= 2;
     for (int i = arr->len; i < arr->capacity; i++)
-      arr->data[i] = (StringInt){NULL, -1};
+      arr->data[i] = NULL;
   }
 
   arr->data[arr->len++] = item;
 }
 
-IMPLSTATIC void fileptrarray_push(FilePtrArray* arr, File* item, AllocLifetime lifetime) {
+IMPLSTATIC void tokenptrarray_push(TokenPtrArray* arr, Token* item, AllocLifetime lifetime) {
   if (!arr->data) {
-    arr->data = bumpcalloc(8, sizeof(File*), lifetime);
+    arr->data = bumpcalloc(8, sizeof(Token*), lifetime);
     arr->capacity = 8;
   }
 
   if (arr->capacity == arr->len) {
-    arr->data = bumplamerealloc(arr->data, sizeof(File*) * arr->capacity,
-                                sizeof(File*) * arr->capacity * 2, lifetime);
+    arr->data = bumplamerealloc(arr->data, sizeof(Token*) * arr->capacity,
+                                sizeof(Token*) * arr->capacity * 2, lifetime);
     arr->capacity *= 2;
     for (int i = arr->len; i < arr->capacity; i++)
       arr->data[i] = NULL;
@@ -116,24 +149,21 @@ IMPLSTATIC void fileptrarray_push(FilePtrArray* arr, File* item, AllocLifetime l
   arr->data[arr->len++] = item;
 }
 
-IMPLSTATIC void tokenptrarray_push(TokenPtrArray* arr, Token* item, AllocLifetime lifetime) {
+IMPLSTATIC void intarray_push(IntArray* arr, int item, AllocLifetime lifetime) {
   if (!arr->data) {
-    arr->data = bumpcalloc(8, sizeof(Token*), lifetime);
+    arr->data = bumpcalloc(8, sizeof(int), lifetime);
     arr->capacity = 8;
   }
 
   if (arr->capacity == arr->len) {
-    arr->data = bumplamerealloc(arr->data, sizeof(Token*) * arr->capacity,
-                                sizeof(Token*) * arr->capacity * 2, lifetime);
+    arr->data = bumplamerealloc(arr->data, sizeof(int) * arr->capacity,
+                                sizeof(int) * arr->capacity * 2, lifetime);
     arr->capacity *= 2;
-    for (int i = arr->len; i < arr->capacity; i++)
-      arr->data[i] = NULL;
   }
 
   arr->data[arr->len++] = item;
 }
 
-#if X64WIN
 IMPLSTATIC void intintintarray_push(IntIntIntArray* arr, IntIntInt item, AllocLifetime lifetime) {
   if (!arr->data) {
     arr->data = bumpcalloc(8, sizeof(IntIntInt), lifetime);
@@ -150,7 +180,6 @@ IMPLSTATIC void intintintarray_push(IntIntIntArray* arr, IntIntInt item, AllocLi
 
   arr->data[arr->len++] = item;
 }
-#endif
 
 // Returns the contents of a given file. Doesn't support '-' for reading from
 // stdin.
@@ -0,0 +1,94 @@
+#include "test.h"
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+static _Noreturn void die(void) {
+  exit(1);
+}
+
+__attribute__((noreturn)) static void die2(void) {
+  exit(2);
+}
+
+static void die3(void) __attribute__((noreturn));
+static void die3(void) {
+  exit(3);
+}
+
+// Any name in the list can be noreturn.
+static void die4(void) __attribute__((cold, noreturn));
+static void die4(void) {
+  exit(4);
+}
+
+static int checked_double(int x) {
+  if (x < 0)
+    die();
+  if (x == 999)
+    die4();
+  if (x < 1000)
+    ;
+  else
+    die3();
+  return x * 2;
+}
+
+static int either(int x) {
+  int r = 0;
+  if (x > 100) {
+    r = -1;
+    die2();
+  } else {
+    r = x + 1;
+  }
+  return r;
+}
+
+static int sum_with_rare(int n) {
+  int total = 0;
+  for (int i = 0; i < n; i++) {
+    if (unlikely(i % 7 == 6)) {
+      // Taken occasionally; returns to the loop from the cold section.
+      total += 100;
+      if (unlikely(i == 13))
+        total += 1000;
+      continue;
+    }
+    total += i;
+  }
+  return total;
+}
+
+static int pick(int x) {
+  return likely(x) ? x * 3 : (x == 0 ? 5 : (die3(), 0));
+}
+
+// Function entries are aligned with multi-byte nops, so the padding before one
+// never has two single-byte nops in a row.
+static int nop_pairs_before(void* fn) {
+  unsigned char* entry = fn;
+  int pairs = 0;
+  for (int i = 1; i < 16; i++)
+    pairs += entry[-i] == 0x90 && entry[-i - 1] == 0x90;
+  return pairs;
+}
+
+int main() {
+  ASSERT(0, __builtin_expect(0, 1));
+  ASSERT(7, __builtin_expect(7, 7));
+  ASSERT(8, sizeof(__builtin_expect(1, 0)));
+
+  ASSERT(6, checked_double(3));
+  ASSERT(11, either(10));
+  ASSERT(0 + 1 + 2 + 3 + 4 + 5 + 100 + 7 + 8 + 9 + 10 + 11 + 12 + 1100 + 14, sum_with_rare(15));
+  ASSERT(9, pick(3));
+  ASSERT(5, pick(0));
+  ASSERT(4, ({ int x = 3; do { if (unlikely(x == 99)) x = 0; else x++; } while (x < 3); x; }));
+
+  ASSERT(0, nop_pairs_before(either) + nop_pairs_before(sum_with_rare) + nop_pairs_before(pick) +
+                nop_pairs_before(nop_pairs_before));
+
+  printf("OK\n");
+  return 0;
+}
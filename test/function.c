@@ -241,6 +241,15 @@ long double to_ldouble(int x) {
   return x;
 }
 
+typedef struct { int x; double d; } MixedArgs;
+
+double mixed_args(int a, double b, char c, float d, long e, double f, int *g, short h) {
+  return a + b + c + d + e + f + *g + h;
+}
+
+int mixed_ten(void) { return 10; }
+double mixed_half(void) { return 0.5; }
+
 int main() {
   ASSERT(3, ret3());
   ASSERT(8, add2(3, 5));
@@ -431,5 +440,10 @@ int main() {
   ASSERT(1, to_ldouble(5.0) == 5.0);
   ASSERT(0, to_ldouble(5.0) == 5.2);
 
+  ASSERT(1, ({ MixedArgs m = {3, 0.25}; int n = 100; MixedArgs* p = &m;
+               mixed_args(p->x, m.d, 2, 1.5f, n, mixed_half(), &n, mixed_ten()) == 3 + 0.25 + 2 + 1.5 + 100 + 0.5 + 100 + 10; }));
+  ASSERT(1, ({ MixedArgs m = {3, 0.25}; long n = 100;
+               mixed_args(mixed_ten(), mixed_half(), m.x, m.d, (int)n, 2.0, &m.x, (short)n) == 10 + 0.5 + 3 + 0.25 + 100 + 2.0 + 3 + 100; }));
+
   printf("OK\n");
 }
@@ -0,0 +1,131 @@
+#include "test.h"
+#include <stddef.h>
+
+#ifdef __SIZEOF_INT128__
+
+typedef unsigned __int128 u128;
+
+static u128 mul64x64(unsigned long a, unsigned long b) {
+  return (u128)a * b;
+}
+
+static __int128 pass_through(int a, __int128 x, int b) {
+  return x + a + b;
+}
+
+static __int128 stack_spill(long a, long b, long c, long d, long e, __int128 x) {
+  return x - a - b - c - d - e;
+}
+
+// wyhash-style folded multiply.
+static unsigned long wymix(unsigned long a, unsigned long b) {
+  u128 r = (u128)a * b;
+  return (unsigned long)r ^ (unsigned long)(r >> 64);
+}
+
+typedef struct {
+  char c;
+  __int128 x;
+} S;
+
+u128 g = 12345;
+u128 g_ulong_max = 0xffffffffffffffffUL;
+u128 g_shifted = (u128)1 << 64;
+__int128 g_negative = -((__int128)3 << 70);
+u128 g_folded = ((u128)0xff << 120) / 0x10 + (0 ? 1 : (u128)1 << 64 > 5);
+
+static int sw(__int128 x) {
+  switch (x) {
+    case 1:
+      return 1;
+    case -1:
+      return 2;
+    case 10 ... 20:
+      return 3;
+    case -5 ... -2:
+      return 4;
+  }
+  return 0;
+}
+
+int main() {
+  ASSERT(16, sizeof(__int128));
+  ASSERT(16, sizeof(unsigned __int128));
+  ASSERT(16, _Alignof(__int128));
+  ASSERT(16, offsetof(S, x));
+  ASSERT(32, sizeof(S));
+
+  ASSERT(1, ({ __int128 x = -1; x < 0; }));
+  ASSERT(0, ({ u128 x = -1; x < 0; }));
+  ASSERT(1, ({ u128 x = -1; (unsigned long)(x >> 64) == 0xffffffffffffffffUL; }));
+  ASSERT(1, ({ u128 x = 1; x <<= 64; (unsigned long)(x >> 64) == 1 && (unsigned long)x == 0; }));
+  ASSERT(1, ({ u128 x = 1; x <<= 127; (long)(x >> 120) == 128; }));
+  ASSERT(1, ({ __int128 x = 1; x <<= 127; (long)(x >> 120) == -128; }));
+  ASSERT(3, ({ u128 x = 3; x <<= 70; (int)(x >> 70); }));
+
+  ASSERT(1, ({ u128 r = mul64x64(0xffffffffffffffffUL, 0xffffffffffffffffUL);
+               (unsigned long)(r >> 64) == 0xfffffffffffffffeUL && (unsigned long)r == 1; }));
+  ASSERT(1, ({ u128 a = ((u128)3 << 64) + 5; u128 b = ((u128)7 << 64) + 11;
+               u128 c = a * b; (unsigned long)(c >> 64) == 3 * 11 + 5 * 7 && (unsigned long)c == 55; }));
+
+  ASSERT(1, ({ u128 a = 0xffffffffffffffffUL; a = a + 1; (unsigned long)(a >> 64) == 1 && (unsigned long)a == 0; }));
+  ASSERT(1, ({ u128 a = (u128)1 << 64; a = a - 1; (unsigned long)(a >> 64) == 0 && (unsigned long)a == 0xffffffffffffffffUL; }));
+  ASSERT(-5, ({ __int128 a = 5; (int)-a; }));
+  ASSERT(1, ({ __int128 a = (__int128)1 << 64; a = -a; (long)(a >> 64) == -1 && (unsigned long)a == 0; }));
+  ASSERT(1, ({ u128 a = 0; ~a == (u128)-1; }));
+
+  ASSERT(1, ({ __int128 a = -7; __int128 b = 2; a / b == -3 && a % b == -1; }));
+  ASSERT(1, ({ u128 a = (u128)1 << 100; u128 b = (u128)1 << 36; a / b == (u128)1 << 64; }));
+  ASSERT(3, ({ u128 a = ((u128)1 << 100) + 3; (int)(a % ((u128)1 << 64)); }));
+
+  ASSERT(1, ({ __int128 a = -1; __int128 b = 1; a < b; }));
+  ASSERT(0, ({ u128 a = -1; u128 b = 1; a < b; }));
+  ASSERT(1, ({ u128 a = (u128)1 << 64; u128 b = 0xffffffffffffffffUL; b < a && b <= a && !(a <= b); }));
+  ASSERT(1, ({ __int128 a = (__int128)5 << 64; __int128 b = (__int128)5 << 64; a == b && a <= b && !(a != b); }));
+  ASSERT(1, ({ __int128 a = (__int128)5 << 64; a != 5; }));
+
+  ASSERT(1, ({ u128 a = (u128)0xf0 << 64; u128 b = (u128)0x3c << 64; (a & b) == (u128)0x30 << 64 && (a | b) == (u128)0xfc << 64 && (a ^ b) == (u128)0xcc << 64; }));
+
+  ASSERT(1, ({ u128 x = (u128)1 << 64; x ? 1 : 0; }));
+  ASSERT(1, ({ u128 x = (u128)1 << 64; (_Bool)x; }));
+  ASSERT(0, ({ u128 x = 0; !!x; }));
+  ASSERT(1, ({ u128 x = (u128)1 << 64; int r = 0; if (x) r = 1; r; }));
+
+  ASSERT(1, ({ __int128 x = (__int128)1 << 80; double d = x; d == 1208925819614629174706176.0; }));
+  ASSERT(1, ({ double d = -1208925819614629174706176.0; __int128 x = d; x == -((__int128)1 << 80); }));
+  ASSERT(1, ({ float f = 3.0f; u128 x = f; x == 3; }));
+
+  ASSERT(1, ({ pass_through(1, (__int128)1 << 64, 2) == ((__int128)1 << 64) + 3; }));
+  ASSERT(1, ({ stack_spill(1, 2, 3, 4, 5, (__int128)1 << 64) == ((__int128)1 << 64) - 15; }));
+  ASSERT(1, wymix(0x9E3779B97F4A7C15UL, 0xD1B54A32D192ED03UL) ==
+                (0x9E3779B97F4A7C15UL * 0xD1B54A32D192ED03UL ^ 0x819B5574F29E4C7CUL));
+
+  ASSERT(1, ({ S s; s.x = (__int128)-2; s.x * 3 == -6; }));
+  ASSERT(1, ({ g *= g; g == 152399025; }));
+  ASSERT(1, (unsigned long)(g_ulong_max >> 64) == 0 && (unsigned long)g_ulong_max == 0xffffffffffffffffUL);
+  ASSERT(1, (unsigned long)(g_shifted >> 64) == 1 && (unsigned long)g_shifted == 0);
+  ASSERT(1, g_negative == -((__int128)3 << 70));
+  ASSERT(1, g_folded == ((u128)0xff << 116) + 1);
+  ASSERT(1, sw(1));
+  ASSERT(0, sw(((__int128)1 << 64) | 1));
+  ASSERT(2, sw(-1));
+  ASSERT(0, sw((u128)-1 >> 1));
+  ASSERT(3, sw(15));
+  ASSERT(0, sw(((__int128)1 << 64) | 15));
+  ASSERT(4, sw(-3));
+  ASSERT(0, sw(-((__int128)1 << 64) - 3));
+  ASSERT(1, ({ __int128 x = 10; x++; ++x; x--; x == 11; }));
+  ASSERT(1, ({ __int128 arr[3] = {1, 2, 3}; __int128 i = 2; arr[i] == 3; }));
+
+  printf("OK\n");
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("OK\n");
+  return 0;
+}
+
+#endif
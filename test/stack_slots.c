@@ -0,0 +1,64 @@
+#include "test.h"
+
+static char* addr_of_sibling_locals(char** second) {
+  char* first;
+  {
+    char a[64];
+    a[0] = 1;
+    first = a;
+  }
+  {
+    char b[64];
+    b[0] = 2;
+    *second = b;
+  }
+  return first;
+}
+
+static int nested_values_survive(void) {
+  int total = 0;
+  for (int i = 0; i < 4; ++i) {
+    int outer = i * 10;
+    {
+      int x = outer + 1;
+      total += x;
+    }
+    {
+      int y = outer + 2;
+      {
+        int z = y * 2;
+        total += z;
+      }
+      total += y;
+    }
+    total += outer;
+  }
+  return total;
+}
+
+// T's size is computed by the first declaration that uses it, in the first
+// block, but still read once that block is gone, after a sibling that reuses
+// its slots.
+static int vla_typedef_size_outlives_block(int n) {
+  typedef char T[n];
+  {
+    T a;
+    a[0] = 0;
+  }
+  {
+    long x = 1000, y = 1000, z = 1000, w = 1000;
+    x += y + z + w;
+  }
+  return sizeof(T);
+}
+
+int main() {
+  ASSERT(1, ({ char* second; char* first = addr_of_sibling_locals(&second); first == second; }));
+  ASSERT(328, nested_values_survive());
+  ASSERT(3, ({ int a = 1; { int b = 2; a += b; } { int c = 0; a += c; } a; }));
+  ASSERT(5, vla_typedef_size_outlives_block(5));
+  ASSERT(1, ({ int* p; int* q; { int x = 5; p = &x; { int y = 6; q = &y; } } p != q; }));
+
+  printf("OK\n");
+  return 0;
+}
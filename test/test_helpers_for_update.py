@@ -6,13 +6,45 @@ _MAIN_TEMPLATE = r'''
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 void* get_host_helper_func(const char* name) {
   (void)name;
 %(helper_lookups)s
 }
 
+// The contents most recently passed to dyibicc_update() for each file, so that
+// files #including an updated header see its new contents.
+static const char* updated_names[64];
+static const char* updated_contents[64];
+static int num_updated;
+
+static void set_updated_contents(const char* filename, const char* contents) {
+  int i = 0;
+  while (i < num_updated && strcmp(updated_names[i], filename) != 0)
+    ++i;
+  if (i == num_updated)
+    updated_names[num_updated++] = filename;
+  updated_contents[i] = contents;
+}
+
 static bool get_file_by_name(const char* filename, char** contents, size_t* size) {
+  for (int i = 0; i < num_updated; ++i) {
+    if (strcmp(updated_names[i], filename) == 0) {
+      *size = strlen(updated_contents[i]);
+      *contents = malloc(*size);
+      memcpy(*contents, updated_contents[i], *size);
+      return true;
+    }
+  }
+
 %(initial_file_contents)s
 
   // Otherwise, fallback to normal file loading (for includes, etc.)
@@ -30,6 +62,9 @@ static bool get_file_by_name(const char* filename, char** contents, size_t* size
   return true;
 }
 
+// Available to code added with add_to_host().
+DyibiccContext* test_context;
+
 int main(void) {
   char* include_paths[] = {
     %(include_paths)s
@@ -38,6 +73,7 @@ int main(void) {
     %(input_paths)s
   };
 
+%(setup)s
   DyibiccEnviromentData env_data = {
       .include_paths = (const char**)include_paths,
       .files = (const char**)input_paths,
@@ -45,10 +81,11 @@ int main(void) {
       .get_function_address = get_host_helper_func,
       .output_function = NULL,
       .use_ansi_codes = false,
-      .generate_debug_symbols = false,
+%(env_options)s
   };
 
   DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  test_context = ctx;
 
   int final_result = 0;
 
@@ -69,12 +106,39 @@ fail:
 
 _UPDATE_FILE_TEMPLATE = r'''
   static char contents_step%(step)d[] = %(contents)s;
+  set_updated_contents("%(filename)s", contents_step%(step)d);
   if (!dyibicc_update(ctx, "%(filename)s", contents_step%(step)d)) {
     final_result = 255;
     goto fail;
   }
 '''
 
+_UPDATE_FILE_ASYNC_TEMPLATE = r'''
+  static char contents_step%(step)d[] = %(contents)s;
+  set_updated_contents("%(filename)s", contents_step%(step)d);
+  if (!dyibicc_update_async(ctx, "%(filename)s", contents_step%(step)d)) {
+    final_result = 255;
+    goto fail;
+  }
+'''
+
+_COMMIT_TEMPLATE = r'''
+  while (!dyibicc_update_ready(ctx)) {
+  }
+  if (dyibicc_commit(ctx) != %(expect_ok)s) {
+    final_result = 255;
+    goto fail;
+  }
+'''
+
+_MKDIR_TEMPLATE = r'''
+#if defined(_WIN32)
+  _mkdir("%(path)s");
+#else
+  mkdir("%(path)s", 0755);
+#endif
+'''
+
 _CALL_ENTRY_TEMPLATE = r'''
   {
   void* entry_point = dyibicc_find_export(ctx, "main");
@@ -98,6 +162,34 @@ _CALL_ENTRY_TEMPLATE = r'''
 '''
 
 
+# Runs main() in a child process, which must abort. Not checked on Windows.
+_CALL_ENTRY_ABORTS_TEMPLATE = r'''
+  {
+#if defined(_WIN32)
+  printf("%(exp_file)s:%(exp_line)d: skipped\n");
+#else
+  void* entry_point = dyibicc_find_export(ctx, "main");
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    char* myargv[] = {"prog", NULL};
+    alarm(10);
+    ((int (*)(int, char**))entry_point)(1, myargv);
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (!entry_point || !WIFSIGNALED(status) || WTERMSIG(status) != SIGABRT) {
+    printf("%(exp_file)s:%(exp_line)d: expected main() to abort, got status %%d\n", status);
+    final_result = 253;
+    goto fail;
+  }
+  printf("%(exp_file)s:%(exp_line)d: OK (aborted)\n");
+#endif
+  }
+'''
+
+
 _steps = []
 _current = {}
 _is_dirty = {}
@@ -105,6 +197,8 @@ _include_paths = []
 _initial_file_contents = {}
 _extra_host = []
 _host_helper_funcs = []
+_env_options = []
+_setup = []
 
 
 def _string_as_c_array(s):
@@ -123,6 +217,61 @@ def add_host_helper_func(*funcnames):
     _host_helper_funcs.extend(funcnames)
 
 
+def stable_function_addresses():
+    _env_options.append('      .stable_function_addresses = true,')
+
+
+def lazy_compilation():
+    _env_options.append('      .lazy_compilation = true,')
+
+
+def tiered_compilation():
+    _env_options.append('      .tiered_compilation = true,')
+
+
+def profile_branches():
+    _env_options.append('      .profile_branches = true,')
+
+
+def instrument_functions():
+    _env_options.append('      .instrument_functions = true,')
+
+
+def instrument_hooks(enter, exit):
+    _env_options.append('      .instrument_enter = %s,' % enter)
+    _env_options.append('      .instrument_exit = %s,' % exit)
+
+
+def instrument_cycles():
+    _env_options.append('      .instrument_cycles = true,')
+
+
+def generate_debug_symbols():
+    _env_options.append('      .generate_debug_symbols = true,')
+
+
+def num_compile_threads(n):
+    _env_options.append('      .num_compile_threads = %d,' % n)
+
+
+def perf_map():
+    _env_options.append('      .perf_map = true,')
+
+
+def jitdump_dir(path):
+    _env_options.append('      .jitdump_dir = "%s",' % path)
+    _setup.append(_MKDIR_TEMPLATE % {'path': path})
+
+
+def time_trace_path(path):
+    _env_options.append('      .time_trace_path = "%s",' % path)
+
+
+def cache_dir(path):
+    _env_options.append('      .cache_dir = "%s",' % path)
+    _setup.append(_MKDIR_TEMPLATE % {'path': path})
+
+
 def initial(file_to_contents):
     global _steps
     global _current
@@ -150,6 +299,26 @@ def update_ok():
             _is_dirty[f] = False
 
 
+def update_async():
+    global _steps
+    dirty = [f for f, d in _is_dirty.items() if d]
+    assert len(dirty) == 1, 'update_async() compiles a single file'
+    f = dirty[0]
+    _steps.append(_UPDATE_FILE_ASYNC_TEMPLATE % {
+        'filename': f,
+        'contents': '{' + _string_as_c_array(_current[f]) + '}',
+        'step': len(_steps)})
+    _is_dirty[f] = False
+
+
+def commit_ok():
+    _steps.append(_COMMIT_TEMPLATE % {'expect_ok': 'true'})
+
+
+def commit_fail():
+    _steps.append(_COMMIT_TEMPLATE % {'expect_ok': 'false'})
+
+
 def expect(rv):
     import inspect
     previous_frame = inspect.currentframe().f_back
@@ -162,6 +331,17 @@ def expect(rv):
         'exp_line': line_number})
 
 
+def expect_abort():
+    import inspect
+    previous_frame = inspect.currentframe().f_back
+    (filename, line_number, _, _, _) = inspect.getframeinfo(previous_frame)
+    filename = os.path.split(filename)[1]
+    global _steps
+    _steps.append(_CALL_ENTRY_ABORTS_TEMPLATE % {
+        'exp_file': filename,
+        'exp_line': line_number})
+
+
 def sub(filename, line, find, replace_with):
     global _current
     cur = _current[filename]
@@ -201,5 +381,7 @@ def done():
                 'initial_file_contents': initials,
                 'helper_lookups': helper_lookups,
                 'include_paths': ', '.join(incs),
+                'env_options': '\n'.join(_env_options),
+                'setup': '\n'.join(_setup),
                 'input_paths': ', '.join(files),
                 'steps': '\n'.join(_steps)})
@@ -0,0 +1,39 @@
+from test_helpers_for_update import *
+
+MAIN = '''\
+extern int other(void);
+int main(void) {
+  return other();
+}
+'''
+
+OTHER = '''\
+int other(void) {
+  return 100;
+}
+'''
+
+initial({'main.c': MAIN, 'other.c': OTHER})
+update_ok()
+expect(100)
+
+# The old code keeps running, possibly while the background compile is still
+# going, until the commit.
+sub('other.c', 2, '100', '99')
+update_async()
+expect(100)
+commit_ok()
+expect(99)
+
+# A failed compile leaves the old code in place.
+sub('other.c', 2, '99;', '98')
+update_async()
+expect(99)
+commit_fail()
+expect(99)
+
+sub('other.c', 2, '98', '97;')
+update_ok()
+expect(97)
+
+done()
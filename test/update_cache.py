@@ -0,0 +1,165 @@
+from test_helpers_for_update import *
+
+CACHE_DIR = 'update_cache.tmp'
+
+MAIN = '''\
+int from_cache(int variant);
+int main(void) {
+  return from_cache(0);
+}
+'''
+
+VALUE_H = '''\
+#define SCALE 3
+'''
+
+VALUE = '''\
+#include "value.h"
+#include <stddef.h>
+static int table[(size_t)3] = {1, 2, 3};
+int* entry = &table[1];
+const char* greeting = "hi";
+static int twice(int x) {
+  return x * 2;
+}
+int value(void) {
+  return twice(SCALE * 5) + *entry + (greeting[1] == 'i');
+}
+'''
+
+# What value.c is changed to by sub() below, in which twice() is unchanged.
+VALUE_UPDATED = '\n'.join(VALUE.splitlines()).replace('SCALE * 5', 'SCALE * 6')
+
+VALUE_DATED = '''\
+int value(void) {
+  return sizeof(__DATE__) + sizeof(__TIME__);
+}
+'''
+
+
+def c_string(s):
+    return '"' + s.replace('"', '\\"').replace('\n', '\\n') + '"'
+
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+
+static const char* override_name;
+static const char* override_contents;
+static char changed_header[128];
+
+static bool load_with_override(const char* filename, char** contents, size_t* size) {
+  if (override_name && strcmp(filename, override_name) == 0) {
+    *size = strlen(override_contents);
+    *contents = malloc(*size);
+    memcpy(*contents, override_contents, *size);
+    return true;
+  }
+  return get_file_by_name(filename, contents, size);
+}
+
+// Builds value.c in a new context with the same cache, as a later process
+// would, and returns how many files were loaded from the cache * 1000 + value().
+int from_cache(int variant) {
+  override_name = NULL;
+  if (variant == 1) {
+    // Different for each run, so that it's never in the cache to start with.
+    if (!changed_header[0]) {
+      snprintf(changed_header, sizeof(changed_header), "#define SCALE 4\n// %%lld %%p\n",
+               (long long)time(NULL), (void*)&variant);
+    }
+    override_name = "value.h";
+    override_contents = changed_header;
+  } else if (variant == 2) {
+    override_name = "value.c";
+    override_contents = %(value_updated)s;
+  } else if (variant == 3) {
+    // value.c's "value.h" wasn't found next to it when it was saved, but now
+    // is, and shadows the one that's loaded by name.
+    FILE* fp = fopen("./value.h", "wb");
+    fputs("#define SCALE 5\n", fp);
+    fclose(fp);
+  } else if (variant == 4) {
+    override_name = "value.c";
+    override_contents = %(value_dated)s;
+  }
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"value.c", "value.h", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = load_with_override,
+      .cache_dir = "%(cache_dir)s",
+      .profile_branches = variant == 5,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -1;
+  if (dyibicc_update(ctx, NULL, NULL)) {
+    DyibiccStats stats;
+    dyibicc_get_stats(ctx, &stats);
+    int (*value)(void) = (int (*)(void))dyibicc_find_export(ctx, "value");
+    result = (int)stats.files_from_cache * 1000 + value();
+  }
+  dyibicc_free(ctx);
+  if (variant == 3)
+    remove("./value.h");
+  return result;
+}
+''' % {'value_updated': c_string(VALUE_UPDATED), 'value_dated': c_string(VALUE_DATED),
+       'cache_dir': CACHE_DIR}
+
+add_to_host(HOST)
+add_host_helper_func("from_cache")
+cache_dir(CACHE_DIR)
+
+# Both value.c and value.h were saved by this context's initial update. The
+# compiler's own <stddef.h> isn't a dependency, as it's part of the key.
+initial({'main.c': MAIN, 'value.c': VALUE, 'value.h': VALUE_H})
+update_ok()
+expect(2033)
+
+# A different value.h has a different entry, and value.c's includes no longer
+# match, so both are compiled (and saved).
+sub('main.c', 3, '0', '1')
+update_ok()
+expect(43)
+
+# Now they're found.
+expect(2043)
+
+# The updated value.c is saved with twice() still in the code from the first
+# update.
+sub('value.c', 10, 'SCALE * 5', 'SCALE * 6')
+sub('main.c', 3, '1', '2')
+update_ok()
+expect(2039)
+
+# Only value.h is loaded, as value.c now finds the other one.
+sub('main.c', 3, '2', '3')
+update_ok()
+expect(1063)
+
+# A file that uses __DATE__ or __TIME__ is never saved, only value.h is loaded.
+sub('main.c', 3, '3', '4')
+update_ok()
+expect(1021)
+expect(1021)
+
+# Entries saved without profile counters aren't used by a context that wants
+# them, so a plain pass loads value.h (value.c was last saved next to the
+# shadowing one), and a profile_branches pass nothing.
+sub('main.c', 3, '4', '0')
+update_ok()
+expect(1039)
+sub('main.c', 3, '0', '5')
+update_ok()
+expect(39)
+
+done()
@@ -0,0 +1,119 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Each tenant's context has a file of the same name, with its own contents.
+typedef struct Tenant {
+  const char* source;
+  int result;
+} Tenant;
+
+static Tenant tenants[] = {
+    {"int counter = 10; int bump(void) { return ++counter; }\n", 0},
+    {"int counter = 20; int bump(void) { return counter += 2; }\n", 0},
+};
+
+static bool load_tenant_file(Tenant* t, const char* path, char** contents, size_t* size) {
+  if (strcmp(path, "tenant.c") == 0) {
+    *size = strlen(t->source);
+    *contents = malloc(*size);
+    memcpy(*contents, t->source, *size);
+    return true;
+  }
+  return false;
+}
+
+static bool load_tenant0(const char* path, char** contents, size_t* size) {
+  return load_tenant_file(&tenants[0], path, contents, size);
+}
+
+static bool load_tenant1(const char* path, char** contents, size_t* size) {
+  return load_tenant_file(&tenants[1], path, contents, size);
+}
+
+static void run_tenant(Tenant* t) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"tenant.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = t == &tenants[0] ? load_tenant0 : load_tenant1,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  for (int i = 0; i < 50; ++i) {
+    if (!dyibicc_update(ctx, NULL, NULL)) {
+      t->result = -1;
+      break;
+    }
+    int (*bump)(void) = (int (*)(void))dyibicc_find_export(ctx, "bump");
+    t->result = bump();
+  }
+  dyibicc_free(ctx);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI tenant_thread(LPVOID arg) {
+  run_tenant(arg);
+  return 0;
+}
+#else
+static void* tenant_thread(void* arg) {
+  run_tenant(arg);
+  return NULL;
+}
+#endif
+
+// Builds and rebuilds two more contexts concurrently on other threads while
+// the test's own context is in the middle of running code.
+int run_tenants(void) {
+#if defined(_WIN32)
+  HANDLE threads[2];
+  for (int i = 0; i < 2; ++i)
+    threads[i] = CreateThread(NULL, 0, tenant_thread, &tenants[i], 0, NULL);
+  WaitForMultipleObjects(2, threads, TRUE, INFINITE);
+  for (int i = 0; i < 2; ++i)
+    CloseHandle(threads[i]);
+#else
+  pthread_t threads[2];
+  for (int i = 0; i < 2; ++i)
+    pthread_create(&threads[i], NULL, tenant_thread, &tenants[i]);
+  for (int i = 0; i < 2; ++i)
+    pthread_join(threads[i], NULL);
+#endif
+  // Data persists across updates, so each tenant's counter has been bumped by
+  // every update.
+  return tenants[0].result * 100 + tenants[1].result;
+}
+'''
+
+MAIN = '''\
+int run_tenants(void);
+int counter = 5;
+int main(void) {
+  return run_tenants() + counter++;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("run_tenants")
+
+initial({'main.c': MAIN})
+update_ok()
+expect(6125)
+
+# The test's context is still usable, and its counter wasn't touched by the
+# others'.
+sub('main.c', 4, 'run_tenants() + ', '')
+update_ok()
+expect(6)
+
+done()
@@ -0,0 +1,68 @@
+from test_helpers_for_update import *
+
+IS_LINUX = sys.platform.startswith('linux')
+
+MAIN = '''\
+int count_debug_objects(void);
+int twice(int x) {
+  return x * 2;
+}
+int main(void) {
+  return twice(count_debug_objects());
+}
+'''
+
+HOST = r'''
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+struct jit_code_entry {
+  struct jit_code_entry* next_entry;
+  struct jit_code_entry* prev_entry;
+  const char* symfile_addr;
+  uint64_t symfile_size;
+};
+
+struct jit_descriptor {
+  uint32_t version;
+  uint32_t action_flag;
+  struct jit_code_entry* relevant_entry;
+  struct jit_code_entry* first_entry;
+};
+
+extern struct jit_descriptor __jit_debug_descriptor;
+#endif
+
+// Returns 10 for each debug object registered with gdb that's an ELF file
+// with a symbol for twice(), and 1 for any others. Halved by twice().
+int count_debug_objects(void) {
+  int result = 0;
+#if defined(__linux__)
+  for (struct jit_code_entry* e = __jit_debug_descriptor.first_entry; e; e = e->next_entry) {
+    int has_twice = 0;
+    for (uint64_t i = 0; i + 6 <= e->symfile_size && !has_twice; ++i) {
+      has_twice = memcmp(e->symfile_addr + i, "twice", 6) == 0;
+    }
+    result += memcmp(e->symfile_addr, "\x7f" "ELF", 4) == 0 && has_twice ? 10 : 1;
+  }
+#endif
+  return result / 2;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("count_debug_objects")
+generate_debug_symbols()
+
+initial({'main.c': MAIN})
+update_ok()
+expect(10 if IS_LINUX else 0)
+
+# Only twice() is compiled again, so there's a second object for it, and
+# main()'s is kept as main() still runs from it.
+sub('main.c', 3, 'x * 2', '2 * x')
+update_ok()
+expect(20 if IS_LINUX else 0)
+
+done()
@@ -0,0 +1,107 @@
+from test_helpers_for_update import *
+
+IMAGE_PATH = 'update_image.tmp'
+
+MAIN = '''\
+int value(void);
+int from_image(void);
+int main(void) {
+  value();
+  return from_image();
+}
+'''
+
+VALUE = '''\
+static int table[] = {1, 2, 3};
+int* entry = &table[1];
+const char* greeting = "hi";
+int counter = 10;
+static int twice(int x) {
+  return x * 2;
+}
+int value(void) {
+  return ++counter * 100 + twice(*entry) + (greeting[1] == 'i');
+}
+'''
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+void* get_host_helper_func(const char* name);
+extern DyibiccContext* test_context;
+
+static char value_updated[] = "int counter; int value(void) { return counter + 7; }";
+
+// Writes a copy of the image without the last byte of its code area, and
+// returns whether loading it into a new context with |env_data| is refused.
+static bool truncated_image_refused(DyibiccEnviromentData* env_data) {
+  FILE* fp = fopen("%(image_path)s", "rb");
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  rewind(fp);
+  char* data = malloc(size);
+  fread(data, 1, size, fp);
+  fclose(fp);
+  fp = fopen("%(image_path)s.truncated", "wb");
+  fwrite(data, 1, size - 1, fp);
+  fclose(fp);
+  free(data);
+
+  DyibiccContext* ctx = dyibicc_set_environment(env_data);
+  bool refused = !dyibicc_load_image(ctx, "%(image_path)s.truncated");
+  dyibicc_free(ctx);
+  return refused;
+}
+
+// Saves test_context to an image and starts a new context from it, as a later
+// process would. Returns value() * 100 + value() after updating value.c in the
+// new context, or a negative number if something failed.
+int from_image(void) {
+  if (!dyibicc_save_image(test_context, "%(image_path)s"))
+    return -1;
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"main.c", "value.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+  };
+  if (!truncated_image_refused(&env_data))
+    return -4;
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -2;
+  if (dyibicc_load_image(ctx, "%(image_path)s")) {
+    int (*value)(void) = (int (*)(void))dyibicc_find_export(ctx, "value");
+    result = value() * 100;
+    if (dyibicc_update(ctx, "value.c", value_updated)) {
+      value = (int (*)(void))dyibicc_find_export(ctx, "value");
+      result += value();
+    } else {
+      result = -3;
+    }
+  }
+  dyibicc_free(ctx);
+  return result;
+}
+''' % {'image_path': IMAGE_PATH}
+
+add_to_host(HOST)
+add_host_helper_func("from_image")
+
+# The loaded counter starts from its initial value rather than the 11 it has
+# in this context, and keeps 11 from its own first call across the update.
+initial({'main.c': MAIN, 'value.c': VALUE})
+update_ok()
+expect(110500 + 18)
+
+# Reflected types only exist in this process, so it can't be saved.
+sub('main.c', 4, 'value();', 'value(); (void)_ReflectTypeOf(int);')
+update_ok()
+expect(-1)
+
+done()
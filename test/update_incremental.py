@@ -0,0 +1,58 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+static void* last_address;
+
+int same_address(void* p) {
+  int result = p == last_address;
+  last_address = p;
+  return result;
+}
+'''
+
+SRC = '''\
+int same_address(void* p);
+enum { SCALE = 3 };
+static int twice(int x) {
+  return x * 2;
+}
+int stable(void) {
+  return 5;
+}
+int value(void) {
+  return twice(1) + stable();
+}
+int main(void) {
+  return same_address((void*)stable) * 100 + value() * SCALE;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("same_address")
+
+initial({'main.c': SRC})
+update_ok()
+expect(21)
+
+# Only value() changed, so stable() keeps its code and address, and value()
+# still calls into the unchanged twice().
+sub('main.c', 10, 'twice(1)', 'twice(2)')
+update_ok()
+expect(127)
+
+# Editing stable() itself gives it new code.
+sub('main.c', 7, '5', '6')
+update_ok()
+expect(30)
+
+sub('main.c', 7, '6', '7')
+update_ok()
+expect(33)
+
+# A change outside of any function body can affect all of them, even if their
+# own text is the same.
+sub('main.c', 2, '3', '4')
+update_ok()
+expect(44)
+
+done()
@@ -0,0 +1,82 @@
+from test_helpers_for_update import *
+
+IS_INSTRUMENTED = sys.platform != 'win32'
+
+HOST = r'''
+#include <string.h>
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+static int enters;
+static int exits;
+static int depth;
+
+void hook_enter(void* function, void* call_site) {
+  if (function && call_site)
+    ++enters;
+  ++depth;
+}
+
+void hook_exit(void* function, void* call_site) {
+  // Clobbers xmm0, which holds half()'s result.
+  volatile double d = 1.5;
+  d *= 3;
+  if (function && call_site && depth > 0)
+    ++exits;
+  --depth;
+}
+
+// Returns 100 for each call of an instrumented function so far, 10 for each
+// return, and 1 if add() was counted with its cycles, then starts counting
+// again.
+int check_instrument(void) {
+  int result = enters * 100 + exits * 10;
+  DyibiccInstrumentCounters counters[8];
+  size_t n = dyibicc_get_instrument_counters(test_context, counters, 8);
+  for (size_t i = 0; i < n && i < 8; ++i) {
+    if (strcmp(counters[i].name, "add") == 0 && counters[i].calls == 5 &&
+        counters[i].cycles > 0)
+      result += 1;
+  }
+  enters = exits = 0;
+  return result;
+}
+'''
+
+MAIN = '''\
+int check_instrument(void);
+__attribute__((instrument)) int add(int a, int b) {
+  return a + b;
+}
+double half(double x) __attribute__((instrument));
+double half(double x) {
+  return x / 2;
+}
+int plain(void) {
+  return 1;
+}
+int main(void) {
+  int x = 0;
+  for (int i = 0; i < 5; ++i)
+    x += add(i, 1) + plain();
+  x += (int)half(8.0);
+  return x + check_instrument();
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("check_instrument")
+instrument_hooks('hook_enter', 'hook_exit')
+instrument_cycles()
+
+initial({'main.c': MAIN})
+update_ok()
+expect(685 if IS_INSTRUMENTED else 24)
+
+# add() is no longer instrumented, and has no counters.
+sub('main.c', 2, '__attribute__((instrument)) ', '')
+update_ok()
+expect(134 if IS_INSTRUMENTED else 24)
+
+done()
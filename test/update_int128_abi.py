@@ -0,0 +1,56 @@
+from test_helpers_for_update import *
+
+# __int128 is SysV only.
+HAS_INT128 = sys.platform != 'win32'
+
+HOST = r'''
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+#if !defined(_WIN32)
+// The registers run out at |g|, so |x| goes on the stack at a 16 byte aligned
+// offset with a hole before it, and |h| after it.
+long host_stack_int128(long a, long b, long c, long d, long e, long f, long g, __int128 x,
+                       long h) {
+  return (long)(x >> 64) * 1000 + (long)x * 10 + h + (a + b + c + d + e + f + g) * 0;
+}
+
+// Calls the compiled function of the same shape the other way round.
+long call_jit_stack_int128(void) {
+  long (*fn)(long, long, long, long, long, long, long, __int128, long) =
+      (long (*)(long, long, long, long, long, long, long, __int128, long))dyibicc_find_export(
+          test_context, "jit_stack_int128");
+  return fn(1, 2, 3, 4, 5, 6, 7, ((__int128)5 << 64) | 6, 4);
+}
+#endif
+'''
+
+MAIN = '''\
+long host_stack_int128(long a, long b, long c, long d, long e, long f, long g, __int128 x,
+                       long h);
+long call_jit_stack_int128(void);
+long jit_stack_int128(long a, long b, long c, long d, long e, long f, long g, __int128 x,
+                      long h) {
+  return (long)(x >> 64) * 1000 + (long)x * 10 + h;
+}
+int main(void) {
+  long host = host_stack_int128(1, 2, 3, 4, 5, 6, 7, ((__int128)3 << 64) | 2, 9);
+  return host * 10000 + call_jit_stack_int128();
+}
+'''
+
+if HAS_INT128:
+    add_to_host(HOST)
+    add_host_helper_func("host_stack_int128", "call_jit_stack_int128")
+
+    # Both the caller's and the callee's side agree with the host compiler on
+    # where |x| and |h| are.
+    initial({'main.c': MAIN})
+    update_ok()
+    expect(30290000 + 5064)
+else:
+    initial({'main.c': 'int main(void) { return 0; }\n'})
+    expect(0)
+
+done()
@@ -0,0 +1,57 @@
+from test_helpers_for_update import *
+
+# Everything is compiled up front on Windows.
+IS_LAZY = sys.platform != 'win32'
+
+HOST = r'''
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Returns how many functions have been compiled so far, and how many only had
+// a stub emitted.
+int compiled(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return (int)(stats.functions_compiled * 10 + stats.functions_deferred);
+}
+'''
+
+MAIN = '''\
+int compiled(void);
+double scale(int a, double b, int c, double d, double e, double f, double g, double h, double i);
+int main(void) {
+  int before = compiled();
+  int r = (int)scale(1, 2.0, 3, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0);
+  return before * 1000 + r * 10 + (compiled() - before) / 10;
+}
+'''
+
+OTHER = '''\
+static int counter = 3;
+static int bump(int x) {
+  return x + ++counter;
+}
+double scale(int a, double b, int c, double d, double e, double f, double g, double h, double i) {
+  return bump(a) + b + c + d + e + f + g + h + i;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("compiled")
+lazy_compilation()
+
+# When main() calls compiled() it's the only function that has been, and
+# other.c only has stubs. scale() and bump() are then compiled on their first
+# calls, with the arguments passed through.
+initial({'main.c': MAIN, 'other.c': OTHER})
+update_ok()
+expect(12 * 1000 + 49 * 10 + 2 if IS_LAZY else 20 * 1000 + 49 * 10)
+
+# The old parse of other.c is dropped and the new one is used from then on,
+# with counter carried over as usual.
+sub('other.c', 6, 'bump(a)', 'bump(a) * 2')
+update_ok()
+expect(2 * 1000 + 56 * 10 + 2 if IS_LAZY else 20 * 1000 + 56 * 10)
+
+done()
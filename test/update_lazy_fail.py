@@ -0,0 +1,28 @@
+from test_helpers_for_update import *
+
+# Everything is compiled up front on Windows, so the update itself would fail.
+IS_LAZY = sys.platform != 'win32'
+
+MAIN = '''\
+int missing(void);
+int unused(void) {
+  return missing();
+}
+int main(void) {
+  return unused();
+}
+'''
+
+lazy_compilation()
+
+if IS_LAZY:
+    # unused() only has a stub, so the update links, but compiling it on its
+    # first call can't, and there's nothing to return to.
+    initial({'main.c': MAIN})
+    update_ok()
+    expect_abort()
+else:
+    initial({'main.c': 'int main(void) { return 0; }\n'})
+    expect(0)
+
+done()
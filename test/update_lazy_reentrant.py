@@ -0,0 +1,75 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int (*jit_value)(void);
+
+// Called part way through preprocessing inner.c, when jit_value() is still
+// only a stub, so it's compiled on this thread in the middle of that.
+static bool load_calling_jit(const char* path, char** contents, size_t* size) {
+  static char header[64];
+  const char* source;
+  if (strcmp(path, "inner.c") == 0) {
+    source = "#define BASE 40\n#include \"inner.h\"\nint inner(void) { return BASE + EXTRA; }\n";
+  } else if (strstr(path, "inner.h")) {
+    snprintf(header, sizeof(header), "#define EXTRA %d\n", jit_value());
+    source = header;
+  } else {
+    return false;
+  }
+  *size = strlen(source);
+  *contents = malloc(*size);
+  memcpy(*contents, source, *size);
+  return true;
+}
+
+int build_inner(int (*fn)(void)) {
+  jit_value = fn;
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"inner.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = load_calling_jit,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -1;
+  if (dyibicc_update(ctx, NULL, NULL))
+    result = ((int (*)(void))dyibicc_find_export(ctx, "inner"))();
+  dyibicc_free(ctx);
+  return result;
+}
+'''
+
+MAIN = '''\
+int build_inner(int (*fn)(void));
+int lazy_value(void);
+int main(void) {
+  return build_inner(lazy_value);
+}
+'''
+
+OTHER = '''\
+static int three(void) {
+  return 3;
+}
+int lazy_value(void) {
+  return three() * 2;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("build_inner")
+lazy_compilation()
+
+# The inner update's macros and heap are still there once lazy_value() has
+# been compiled.
+initial({'main.c': MAIN, 'other.c': OTHER})
+update_ok()
+expect(46)
+
+done()
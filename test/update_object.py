@@ -0,0 +1,71 @@
+from test_helpers_for_update import *
+
+IS_ELF = sys.platform.startswith('linux')
+
+OBJECT_PATH = 'update_object.tmp'
+
+MAIN = '''\
+int from_object(void);
+int main(void) {
+  return from_object();
+}
+'''
+
+LIB = '''\
+#include <string.h>
+static int table[] = {1, 2, 3};
+int* entry = &table[1];
+const char* greeting = "hello";
+int counter = 10;
+static int twice(int x) {
+  return x * 2;
+}
+int lib_value(void) {
+  return ++counter + twice(*entry) + (int)strlen(greeting);
+}
+'''
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+extern DyibiccContext* test_context;
+
+// Writes lib.c as an object, links it into a program that returns
+// lib_value(), and returns what that program exits with, or a negative number
+// if something failed.
+int from_object(void) {
+#if defined(__linux__)
+  if (!dyibicc_write_object(test_context, "lib.c", "%(path)s.o"))
+    return -1;
+  FILE* fp = fopen("%(path)s.c", "wb");
+  if (!fp)
+    return -2;
+  fputs("int lib_value(void);\nint main(void) { return lib_value(); }\n", fp);
+  fclose(fp);
+  if (system("cc -o %(path)s.exe %(path)s.c %(path)s.o") != 0)
+    return -3;
+  int status = system("./%(path)s.exe");
+  return status >= 0 ? (status >> 8) & 0xff : -4;
+#else
+  // Only ELF is written.
+  return dyibicc_write_object(test_context, "lib.c", "%(path)s.o") ? -5 : -1;
+#endif
+}
+'''
+
+add_to_host(HOST % {'path': OBJECT_PATH})
+add_host_helper_func("from_object")
+
+# Data starts from its initial value in the program.
+initial({'main.c': MAIN, 'lib.c': LIB})
+update_ok()
+expect(20 if IS_ELF else -1)
+
+# twice() is reused from the first update, so the code comes from two chunks.
+sub('lib.c', 10, '++counter', 'counter')
+update_ok()
+expect(19 if IS_ELF else -1)
+
+done()
@@ -0,0 +1,90 @@
+from test_helpers_for_update import *
+
+IS_LINUX = sys.platform.startswith('linux')
+JITDUMP_DIR = 'update_perf_jit'
+
+MAIN = '''\
+int check_perf(void);
+int twice(int x) {
+  if (__builtin_expect(x < 0, 0))
+    return 0;
+  return x * 2;
+}
+int main(void) {
+  return twice(check_perf());
+}
+'''
+
+HOST = r'''
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+// Returns 100 for each line for twice() in the perf map, 10 for each load of
+// it in the jitdump, 1000 for each load of its out of line code, and 2 if the
+// jitdump has any line info. Halved by twice().
+int check_perf(void) {
+  int result = 0;
+  bool has_lines = false;
+#if defined(__linux__)
+  char path[256];
+  char line[256];
+  snprintf(path, sizeof(path), "/tmp/perf-%%d.map", (int)getpid());
+  FILE* fp = fopen(path, "r");
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* name = strrchr(line, ' ');
+    if (name && strcmp(name, " twice\n") == 0)
+      result += 100;
+  }
+  if (fp)
+    fclose(fp);
+
+  snprintf(path, sizeof(path), "%(jitdump_dir)s/jit-%%d.dump", (int)getpid());
+  fp = fopen(path, "rb");
+  uint32_t header[10];
+  if (fp && fread(header, sizeof(header), 1, fp) == 1 && header[0] == 0x4A695444) {
+    uint32_t record[4];
+    while (fread(record, sizeof(record), 1, fp) == 1) {
+      char body[4096];
+      size_t size = record[1] - sizeof(record);
+      if (size > sizeof(body) || fread(body, size, 1, fp) != 1)
+        break;
+      // The name follows pid, tid, vma, code_addr, code_size, code_index.
+      if (record[0] == 0 && strcmp(body + 40, "twice") == 0)
+        result += 10;
+      if (record[0] == 0 && strcmp(body + 40, "twice.cold") == 0)
+        result += 1000;
+      if (record[0] == 2)
+        has_lines = true;
+    }
+  }
+  if (fp)
+    fclose(fp);
+#endif
+  if (has_lines)
+    result += 2;
+  return result / 2;
+}
+''' % {'jitdump_dir': JITDUMP_DIR}
+
+add_to_host(HOST)
+add_host_helper_func("check_perf")
+perf_map()
+jitdump_dir(JITDUMP_DIR)
+generate_debug_symbols()
+
+# twice()'s early return is out of line, in .cold.
+initial({'main.c': MAIN})
+update_ok()
+expect(1112 if IS_LINUX else 0)
+
+# twice() is compiled again, and its new code added.
+sub('main.c', 5, 'x * 2', '2 * x')
+update_ok()
+expect(2222 if IS_LINUX else 0)
+
+done()
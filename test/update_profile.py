@@ -0,0 +1,125 @@
+from test_helpers_for_update import *
+
+PROFILE_PATH = 'update_profile.tmp'
+
+MAIN = '''\
+int check_profile(int result);
+int classify(int x) {
+  if (x < 0)
+    return -1;
+  switch (x % 3) {
+    case 0:
+      return 10;
+    case 1:
+      return 11;
+    default:
+      return 12;
+  }
+}
+int run(void) {
+  int total = 0;
+  for (int i = 0; i < 100; ++i)
+    total += classify(i);
+  return total;
+}
+int main(void) {
+  return check_profile(run());
+}
+'''
+
+HOST = r'''
+#include <stdio.h>
+#include <string.h>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+#include "libdyibicc.h"
+
+static bool get_file_by_name(const char* filename, char** contents, size_t* size);
+void* get_host_helper_func(const char* name);
+extern DyibiccContext* test_context;
+
+// Returns how many times classify()'s out of line code was written to the perf
+// map, or -1 where there's no perf map (and nothing is moved out of line).
+static int count_cold_classify(void) {
+#if defined(__linux__)
+  char path[64];
+  char line[256];
+  snprintf(path, sizeof(path), "/tmp/perf-%%d.map", (int)getpid());
+  FILE* fp = fopen(path, "r");
+  int count = 0;
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* name = strrchr(line, ' ');
+    if (name && strcmp(name, " classify.cold\n") == 0)
+      ++count;
+  }
+  if (fp)
+    fclose(fp);
+  return count;
+#else
+  return -1;
+#endif
+}
+
+// Dumps the profile and checks classify()'s counts: the two branches of the
+// if, then each case, for however many times run() has been called. Then
+// compiles the same code in a new context with the profile loaded, and checks
+// that it gets the same |result|, and that the never taken `return -1` was
+// moved out of line. Returns |result| plus 100000 if the counts were right,
+// 10000 if the result was, and 1000000 if the layout was.
+int check_profile(int result) {
+  static const char* expected_counts[] = {"\t0 100 34 33 33\n", "\t0 200 68 66 66\n"};
+  static int runs;
+  if (!dyibicc_dump_profile(test_context, "%(profile_path)s"))
+    return -1;
+
+  int counts_ok = 0;
+  FILE* fp = fopen("%(profile_path)s", "r");
+  char line[256];
+  while (fp && fgets(line, sizeof(line), fp)) {
+    char* counts = strstr(line, "\tclassify\t");
+    if (counts && strstr(counts, expected_counts[runs]))
+      counts_ok = 1;
+  }
+  if (fp)
+    fclose(fp);
+
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"main.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = get_file_by_name,
+      .get_function_address = get_host_helper_func,
+      .perf_map = true,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int same = 0;
+  int cold_before = count_cold_classify();
+  if (dyibicc_load_profile(ctx, "%(profile_path)s") && dyibicc_update(ctx, NULL, NULL)) {
+    int (*run)(void) = (int (*)(void))dyibicc_find_export(ctx, "run");
+    same = run() == result;
+  }
+  int cold_after = count_cold_classify();
+  int layout_ok = cold_after == -1 || cold_after == cold_before + 1;
+  dyibicc_free(ctx);
+  ++runs;
+  return result + layout_ok * 1000000 + counts_ok * 100000 + same * 10000;
+}
+''' % {'profile_path': PROFILE_PATH}
+
+add_to_host(HOST)
+add_host_helper_func("check_profile")
+profile_branches()
+
+initial({'main.c': MAIN})
+update_ok()
+expect(1110000 + 1099)
+
+# classify() is unchanged, so it keeps its code and counts when run() is
+# edited.
+sub('main.c', 17, 'i < 100', 'i < 100 + 0')
+update_ok()
+expect(1110000 + 1099)
+
+done()
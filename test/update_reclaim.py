@@ -0,0 +1,68 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+static size_t retired_bytes(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return stats.retired_bytes;
+}
+
+static int (*old_value)(void);
+static int run;
+
+// Stands in for a worker thread that's still running the old code during an
+// update.
+int check(int (*value)(void)) {
+  switch (run++) {
+    case 0:
+      dyibicc_enter(test_context);
+      old_value = value;
+      return value();
+    case 1: {
+      // The old code for value() has been retired, but not freed.
+      int result = old_value() * 10 + value() + (retired_bytes() > 0 ? 100 : 0);
+      dyibicc_thread_quiescent(test_context);
+      dyibicc_leave(test_context);
+      return result;
+    }
+    default:
+      return retired_bytes() == 0 ? value() : -1;
+  }
+}
+'''
+
+MAIN = '''\
+int check(int (*value)(void));
+int value(void);
+int main(void) {
+  return check(value);
+}
+'''
+
+VALUE = '''\
+int value(void) {
+  return 1;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("check")
+
+initial({'main.c': MAIN, 'value.c': VALUE})
+update_ok()
+expect(1)
+
+sub('value.c', 2, '1', '2')
+update_ok()
+expect(112)
+
+# Nothing is entered any more, so this update frees everything retired.
+sub('value.c', 2, '2', '3')
+update_ok()
+expect(3)
+
+done()
@@ -0,0 +1,68 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdlib.h>
+#include <string.h>
+
+extern DyibiccContext* test_context;
+
+static int nested_results;
+
+// Called by the inner context's update, where neither a new context nor an
+// update of the test's own one is allowed.
+static bool load_and_nest(const char* path, char** contents, size_t* size) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {NULL};
+  DyibiccEnviromentData env_data = {.include_paths = include_paths, .files = files};
+  if (dyibicc_set_environment(&env_data) == NULL)
+    nested_results += 1;
+  if (!dyibicc_update(test_context, NULL, NULL))
+    nested_results += 10;
+  if (strcmp(path, "inner.c") != 0)
+    return false;
+  const char* source = "int inner(void) { return 7; }\n";
+  *size = strlen(source);
+  *contents = malloc(*size);
+  memcpy(*contents, source, *size);
+  return true;
+}
+
+int build_inner(void) {
+  const char* include_paths[] = {NULL};
+  const char* files[] = {"inner.c", NULL};
+  DyibiccEnviromentData env_data = {
+      .include_paths = include_paths,
+      .files = files,
+      .load_file_contents = load_and_nest,
+  };
+  DyibiccContext* ctx = dyibicc_set_environment(&env_data);
+  int result = -1;
+  if (dyibicc_update(ctx, NULL, NULL))
+    result = ((int (*)(void))dyibicc_find_export(ctx, "inner"))();
+  dyibicc_free(ctx);
+  return nested_results * 100 + result;
+}
+'''
+
+MAIN = '''\
+int build_inner(void);
+int main(void) {
+  return build_inner();
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("build_inner")
+
+# The nested calls both fail, but the update they were made from still works.
+initial({'main.c': MAIN})
+update_ok()
+expect(1107)
+
+# The test's own context is still usable afterwards.
+sub('main.c', 3, 'build_inner()', '3')
+update_ok()
+expect(3)
+
+done()
@@ -0,0 +1,56 @@
+from test_helpers_for_update import *
+
+# Everything is compiled each time on Windows.
+REUSES = sys.platform != 'win32'
+
+HOST = r'''
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+int reused(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return (int)stats.functions_reused;
+}
+'''
+
+MAIN = '''\
+int reused(void);
+int twice(int x);
+int thrice(int x);
+int main(void) {
+  return reused() * 1000 + twice(1) + thrice(1);
+}
+'''
+
+OTHER = '''\
+int twice(int x) {
+  return x * 2;
+}
+int thrice(int x) {
+  return x * 3;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("reused")
+generate_debug_symbols()
+
+# other.c is updated after main.c, with the contents it was first built with.
+initial({'main.c': MAIN, 'other.c': OTHER})
+expect(2005 if REUSES else 5)
+
+# twice() is on the same lines, so its code (and the line info registered for
+# it) is kept.
+sub('other.c', 5, 'x * 3', 'x * 4')
+update_ok()
+expect(1006 if REUSES else 6)
+
+# Both functions are a line further down, so the line info for both would be
+# wrong, and they're compiled again.
+sub('other.c', 1, 'int twice', '// Moved.\nint twice')
+update_ok()
+expect(6)
+
+done()
@@ -0,0 +1,81 @@
+from test_helpers_for_update import *
+
+IS_LINUX = sys.platform.startswith('linux')
+PROFILE_PATH = 'update_sampler.prof'
+
+MAIN = '''\
+int profile_start(void);
+int profile_check(void);
+int cpu_ms(void);
+int spin(void) {
+  int start = cpu_ms();
+  int x = 0;
+  while (cpu_ms() - start < 200) {
+    for (int i = 0; i < 1000000; ++i)
+      x += i;
+  }
+  return x & 0;
+}
+int main(void) {
+  profile_start();
+  int x = spin();
+  return x + profile_check();
+}
+'''
+
+HOST = r'''
+#include "libdyibicc.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+int cpu_ms(void) {
+  return (int)(clock() * 1000 / CLOCKS_PER_SEC);
+}
+
+int profile_start(void) {
+  dyibicc_profiler_start(1000);
+  return 0;
+}
+
+static int profile_contains(DyibiccProfilerFormat format, const char* text) {
+  char line[256];
+  int found = 0;
+  if (!dyibicc_profiler_write("%(path)s", format))
+    return 0;
+  FILE* fp = fopen("%(path)s", "r");
+  while (fp && fgets(line, sizeof(line), fp)) {
+    if (strstr(line, text))
+      found = 1;
+  }
+  if (fp)
+    fclose(fp);
+  return found;
+}
+
+// Returns 1 if spin() is in the flat profile, 10 if main() calling spin() is
+// in the collapsed stacks, and 100 if lines in main.c are in the line profile.
+int profile_check(void) {
+  dyibicc_profiler_stop();
+  return profile_contains(DYIBICC_PROFILER_FLAT, "  spin\n") +
+         10 * profile_contains(DYIBICC_PROFILER_COLLAPSED, "main;spin ") +
+         100 * profile_contains(DYIBICC_PROFILER_LINES, "main.c:");
+}
+''' % {'path': PROFILE_PATH}
+
+add_to_host(HOST)
+add_host_helper_func("profile_start")
+add_host_helper_func("profile_check")
+add_host_helper_func("cpu_ms")
+generate_debug_symbols()
+
+initial({'main.c': MAIN})
+update_ok()
+expect(111 if IS_LINUX else 0)
+
+# spin() is compiled again, and only the new code's samples are counted.
+sub('main.c', 8, 'x += i', 'x -= i')
+update_ok()
+expect(111 if IS_LINUX else 0)
+
+done()
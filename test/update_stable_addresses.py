@@ -0,0 +1,47 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+static int (*saved_callback)(void);
+
+void save_callback(int (*f)(void)) {
+  if (!saved_callback)
+    saved_callback = f;
+}
+
+int call_saved_callback(void) {
+  return saved_callback();
+}
+'''
+
+SRC = '''\
+void save_callback(int (*f)(void));
+int call_saved_callback(void);
+int callback(void) {
+  return 1;
+}
+int (*in_data)(void) = callback;
+int main(void) {
+  save_callback(callback);
+  return call_saved_callback() * 10 + in_data();
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("save_callback", "call_saved_callback")
+stable_function_addresses()
+
+initial({'main.c': SRC})
+update_ok()
+expect(11)
+
+# Both the pointer held by the host from the first run, and the one in
+# writable data that isn't reinitialized, now reach the new code.
+sub('main.c', 4, '1', '2')
+update_ok()
+expect(22)
+
+sub('main.c', 4, '2', '3')
+update_ok()
+expect(33)
+
+done()
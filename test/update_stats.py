@@ -0,0 +1,67 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include <string.h>
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Returns 1 for each file with stats from the most recent update, 10 if it's
+// data.c and its counts look right, and 100 if the update's totals do. get()
+// is unchanged, so its code is reused rather than emitted again. Adds 1000 if
+// only data.c's slot for table and main.c's for get() were linked, as nothing
+// else was redefined.
+int check_stats(void) {
+  int result = 0;
+  DyibiccFileStats files[4];
+  size_t n = dyibicc_get_file_stats(test_context, files, 4);
+  for (size_t i = 0; i < n && i < 4; ++i) {
+    ++result;
+    if (strcmp(files[i].name, "data.c") == 0 && !files[i].from_cache && files[i].tokens > 0 &&
+        files[i].nodes > 0 && files[i].data_bytes >= 400 && files[i].compile_heap_peak > 0 &&
+        files[i].parse_seconds >= 0)
+      result += 10;
+  }
+
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  double phases = stats.tokenize_seconds + stats.preprocess_seconds + stats.containers_seconds +
+                  stats.parse_seconds + stats.codegen_seconds + stats.link_seconds;
+  if (stats.tokens > 0 && stats.nodes > 0 && stats.data_bytes >= 400 &&
+      stats.fixups_linked > 0 && stats.compile_heap_peak > 0 &&
+      stats.temp_heap_peak > 0 && phases > 0 &&
+      stats.update_seconds > 0)
+    result += 100;
+  if (stats.fixups_linked == 2)
+    result += 1000;
+  return result;
+}
+'''
+
+MAIN = '''\
+int check_stats(void);
+int get(int i);
+int main(void) {
+  return check_stats() + get(0);
+}
+'''
+
+DATA = '''\
+int table[100] = {0};
+int get(int i) {
+  return table[i];
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("check_stats")
+
+initial({'main.c': MAIN, 'data.c': DATA})
+expect(1111)
+
+# Only data.c is compiled.
+sub('data.c', 1, '{0}', '{1}')
+update_ok()
+expect(1111)
+
+done()
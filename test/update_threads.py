@@ -0,0 +1,34 @@
+from test_helpers_for_update import *
+
+MAIN = '''\
+int part1(void);
+int part2(void);
+int part3(void);
+int main(void) {
+  return part1() + part2() + part3();
+}
+'''
+
+
+def part(n):
+    return '''\
+static const char name[] = "part%d";
+int part%d(void) {
+  return sizeof(name) * %d;
+}
+''' % (n, n, n)
+
+
+# Parallel compilation is opt-in, as the environment's callbacks have to be
+# thread safe for it.
+num_compile_threads(3)
+
+initial({'part1.c': part(1), 'part2.c': part(2), 'part3.c': part(3), 'main.c': MAIN})
+update_ok()
+expect(36)
+
+sub('part2.c', 3, '* 2', '* 20')
+update_ok()
+expect(144)
+
+done()
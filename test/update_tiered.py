@@ -0,0 +1,85 @@
+from test_helpers_for_update import *
+
+# Functions are only counted and promoted where compilation can be lazy.
+IS_TIERED = sys.platform != 'win32'
+
+HOST = r'''
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#define sleep_ms(ms) Sleep(ms)
+#else
+#include <unistd.h>
+#define sleep_ms(ms) usleep((ms) * 1000)
+#endif
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Waits for the two functions that should have been promoted to be compiled
+// again, and returns which ones were: 100 for add(), 10 for sum(), and 1 for
+// anything else.
+int tiers(void) {
+  DyibiccStats stats;
+  for (int i = 0; i < 5000; ++i) {
+    dyibicc_get_stats(test_context, &stats);
+    if (stats.functions_promoted >= 2)
+      break;
+    sleep_ms(1);
+  }
+
+  DyibiccFunctionCounters counters[8];
+  size_t n = dyibicc_get_function_counters(test_context, counters, 8);
+  int result = 0;
+  for (size_t i = 0; i < n && i < 8; ++i) {
+    if (!counters[i].promoted)
+      continue;
+    if (strcmp(counters[i].name, "add") == 0)
+      result += counters[i].calls >= 1000 ? 100 : -1000;
+    else if (strcmp(counters[i].name, "sum") == 0)
+      result += counters[i].backedges >= 10000 ? 10 : -1000;
+    else
+      result += 1;
+  }
+  return result;
+}
+'''
+
+MAIN = '''\
+int tiers(void);
+int add(int a, int b) {
+  return a + b;
+}
+int sum(int n) {
+  int t = 0;
+  for (int i = 0; i < n; ++i)
+    t += i;
+  return t;
+}
+int main(void) {
+  int t = 0;
+  for (int i = 0; i < 1500; ++i)
+    t = add(t, 1);
+  if (t != 1500 || sum(20000) != 199990000)
+    return -1;
+  // Called once promoted, i.e. through the stub to the new code.
+  return tiers() + add(2, 3);
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("tiers")
+tiered_compilation()
+
+# add() is promoted by its calls, and sum() by its loop while it's still
+# running in the counting code. main() has neither many calls nor iterations.
+initial({'main.c': MAIN})
+update_ok()
+expect(115 if IS_TIERED else 5)
+
+# The counts start again for the new code.
+sub('main.c', 3, 'a + b', 'b + a')
+update_ok()
+expect(115 if IS_TIERED else 5)
+
+done()
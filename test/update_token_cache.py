@@ -0,0 +1,48 @@
+from test_helpers_for_update import *
+
+HOST = r'''
+#include "libdyibicc.h"
+
+extern DyibiccContext* test_context;
+
+// Returns 10 if the most recent update copied a header's tokens rather than
+// tokenizing it again.
+int headers_reused(void) {
+  DyibiccStats stats;
+  dyibicc_get_stats(test_context, &stats);
+  return stats.headers_reused > 0 ? 10 : 0;
+}
+'''
+
+MAIN = '''\
+#include "shared.h"
+int headers_reused(void);
+int main(void) {
+  int x = 0;
+  return VALUE + headers_reused() + (greeting[1] == 'i' ? 100 : 0) + x;
+}
+'''
+
+SHARED_H = '''\
+#define VALUE 1
+static const char greeting[] = "hi";
+'''
+
+add_to_host(HOST)
+add_host_helper_func("headers_reused")
+
+# main.c was compiled by the first update too, so shared.h's tokens are reused.
+initial({'shared.h': SHARED_H, 'main.c': MAIN})
+expect(111)
+
+# A changed header is tokenized again.
+sub('shared.h', 1, '1', '2')
+sub('main.c', 4, '0', '1')
+update_ok()
+expect(103)
+
+sub('main.c', 4, '1', '2')
+update_ok()
+expect(114)
+
+done()
@@ -0,0 +1,67 @@
+from test_helpers_for_update import *
+
+TRACE_PATH = 'update_trace.json'
+
+MAIN = '''\
+#include "scale.h"
+int check_trace(void);
+int scaled(int x) {
+  $vec(int) v = {0};
+  v..push_back(x * SCALE);
+  return *v..back();
+}
+int main(void) {
+  return scaled(1) + check_trace();
+}
+'''
+
+SCALE_H = '''\
+#define SCALE 2
+'''
+
+HOST = r'''
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int trace_has(const char* text, const char* contents) {
+  return strstr(contents, text) != NULL;
+}
+
+// Returns 1 if the trace from the most recent update has the header, 10 for
+// the container, 100 for parsing scaled(), and 1000 for the link.
+int check_trace(void) {
+  FILE* fp = fopen("%(path)s", "rb");
+  if (!fp)
+    return 0;
+  char* contents = calloc(1, 1 << 20);
+  fread(contents, 1, (1 << 20) - 1, fp);
+  fclose(fp);
+  int result = 0;
+  if (trace_has("\"name\":\"include\",\"args\":{\"detail\":\"scale.h\"}", contents))
+    result += 1;
+  if (trace_has("\"name\":\"container\",\"args\":{\"detail\":\"type:vec,arg:int\"}", contents))
+    result += 10;
+  if (trace_has("\"name\":\"parse function\",\"args\":{\"detail\":\"scaled\"}", contents))
+    result += 100;
+  if (trace_has("\"name\":\"link\"", contents) && contents[0] == '{')
+    result += 1000;
+  free(contents);
+  return result;
+}
+''' % {'path': TRACE_PATH}
+
+add_to_host(HOST)
+add_host_helper_func("check_trace")
+time_trace_path(TRACE_PATH)
+
+initial({'scale.h': SCALE_H, 'main.c': MAIN})
+expect(1113)
+
+# Each update replaces the trace. scaled() isn't emitted again, as its code is
+# reused, but it's still parsed.
+sub('main.c', 9, 'scaled(1)', 'scaled(2)')
+update_ok()
+expect(1115)
+
+done()
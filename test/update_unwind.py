@@ -0,0 +1,54 @@
+from test_helpers_for_update import *
+
+IS_LINUX = sys.platform.startswith('linux')
+
+MAIN = '''\
+int count_compiled_frames(void);
+int leaf(void) {
+  return count_compiled_frames() + 0;
+}
+int middle(void) {
+  return leaf() + 0;
+}
+int main(void) {
+  return middle() + 0;
+}
+'''
+
+HOST = r'''
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+// Returns how many frames backtrace() finds in compiled code, i.e. that aren't
+// in any loaded module.
+int count_compiled_frames(void) {
+  int result = 0;
+#if defined(__linux__)
+  void* frames[64];
+  int num_frames = backtrace(frames, 64);
+  for (int i = 0; i < num_frames; ++i) {
+    Dl_info info;
+    if (!dladdr(frames[i], &info))
+      ++result;
+  }
+#endif
+  return result;
+}
+'''
+
+add_to_host(HOST)
+add_host_helper_func("count_compiled_frames")
+
+initial({'main.c': MAIN})
+update_ok()
+expect(3 if IS_LINUX else 0)
+
+# middle() now comes from a new chunk, and leaf() and main() from the old one.
+sub('main.c', 6, 'leaf() + 0', '0 + leaf()')
+update_ok()
+expect(3 if IS_LINUX else 0)
+
+done()